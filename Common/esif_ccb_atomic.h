@@ -84,6 +84,7 @@
 # define atomic_dec(v)		(--(*(v)))
 # define atomic_add(i, v)	(*(v) += (i))
 # define atomic_sub(i, v)	(*(v) -= (i))
+# define atomic_cmpxchg(v, old, new)	(*(v) == (old) ? ((*(v) = (new)), (old)) : *(v))
 #endif
 
 #endif /* USER */
@@ -37,6 +37,10 @@ typedef volatile atomic_basetype atomic_t;
 #define atomic_dec(v)		__sync_sub_and_fetch(v, 1)
 #define atomic_add(i, v)	__sync_add_and_fetch(v, i)
 #define atomic_sub(i, v)	__sync_sub_and_fetch(v, i)
+#define atomic_cmpxchg(v, old, new)	__sync_val_compare_and_swap(v, old, new)
 #endif /* !DISABLE */
 
+/* Full memory barrier */
+#define esif_ccb_mb()		__sync_synchronize()
+
 #endif /* LINUX USER */
@@ -222,4 +222,56 @@ static ESIF_INLINE int esif_ccb_file_exists(esif_string filename)
 	return 0 == esif_ccb_stat(filename, &st);
 }
 
+/*
+ * Memory-Mapped Files
+ */
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+
+/* Map an entire file read-only. Returns NULL on error or if the file is empty */
+static ESIF_INLINE void *esif_ccb_mmap_file(
+	esif_string filename,
+	size_t *sizePtr
+	)
+{
+	void *addr = NULL;
+	struct stat st = { 0 };
+	int fd = open(filename, O_RDONLY);
+
+	if (fd < 0) {
+		return NULL;
+	}
+	if (fstat(fd, &st) == 0 && st.st_size > 0) {
+		addr = mmap(NULL, (size_t)st.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+		if (addr == MAP_FAILED) {
+			addr = NULL;
+		}
+		else if (sizePtr) {
+			*sizePtr = (size_t)st.st_size;
+		}
+	}
+	close(fd);
+	return addr;
+}
+
+static ESIF_INLINE void esif_ccb_munmap_file(
+	void *addr,
+	size_t size
+	)
+{
+	if (addr) {
+		munmap(addr, size);
+	}
+}
+
+/* Flush an open file and commit its contents to disk. Returns 0 on success */
+static ESIF_INLINE int esif_ccb_fsync(FILE *fp)
+{
+	if (fflush(fp) != 0) {
+		return EOF;
+	}
+	return fsync(fileno(fp));
+}
+
 #endif /* LINUX USER */
\ No newline at end of file
@@ -22,6 +22,8 @@
 
 #include <semaphore.h>
 #include <pthread.h>
+#include <time.h>
+#include <errno.h>
 
 /* Semphore */
 typedef sem_t esif_ccb_sem_t;
@@ -40,6 +42,27 @@ static ESIF_INLINE int esif_ccb_sem_try_down (
 	return 0;
 }
 
+/* Wait up to ms_timeout msec for a Semaphore. Returns 0 if signaled or nonzero on timeout */
+static ESIF_INLINE int esif_ccb_sem_timed_down(
+	esif_ccb_sem_t *sem_ptr,
+	u32 ms_timeout
+	)
+{
+	struct timespec ts = {0};
+	int rc = 0;
+
+	clock_gettime(CLOCK_REALTIME, &ts);
+	ts.tv_sec += ms_timeout / 1000;
+	ts.tv_nsec += (long)(ms_timeout % 1000) * 1000000L;
+	if (ts.tv_nsec >= 1000000000L) {
+		ts.tv_sec++;
+		ts.tv_nsec -= 1000000000L;
+	}
+	while ((rc = sem_timedwait(sem_ptr, &ts)) != 0 && errno == EINTR)
+		;
+	return rc;
+}
+
 /* Conditional Variable */
 typedef pthread_cond_t esif_ccb_cond_t;
 #define esif_ccb_cond_init(cond) pthread_cond_init(cond, NULL)
@@ -75,4 +75,12 @@ static ESIF_INLINE enum esif_rc esif_ccb_thread_join (
 	return rc;
 }
 
+/* Thread-Local Storage */
+typedef pthread_key_t esif_ccb_tls_t;
+
+#define esif_ccb_tls_create(key_ptr, destructor)	pthread_key_create(key_ptr, destructor)
+#define esif_ccb_tls_delete(key)					pthread_key_delete(key)
+#define esif_ccb_tls_get(key)						pthread_getspecific(key)
+#define esif_ccb_tls_set(key, value)				pthread_setspecific(key, value)
+
 #endif /* LINUX USER */
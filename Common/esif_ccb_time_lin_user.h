@@ -49,6 +49,15 @@ static void ESIF_INLINE esif_ccb_get_time(struct timeval *tv)
 	gettimeofday(tv, NULL);
 }
 
+/* Return Monotonic Time In Microseconds, for measuring intervals unaffected by clock changes */
+static esif_ccb_time_t ESIF_INLINE esif_ccb_monotonic_time_usec(void)
+{
+	struct timespec now = {0};
+
+	clock_gettime(CLOCK_MONOTONIC, &now);
+	return ((esif_ccb_time_t)now.tv_sec * 1000000) + ((esif_ccb_time_t)now.tv_nsec / 1000);
+}
+
 static int ESIF_INLINE esif_ccb_localtime(
 	struct tm *tm_ptr,
 	const time_t *time
@@ -60,6 +60,14 @@
  */
 #define ESIF_CNT_HNDL_RETRIES_MAX 10000
 
+/*
+ * Timers are indexed by handle and by CB handle so they can be found without
+ * walking the timer list.  Must be a power of 2.
+ */
+#define ESIF_TMRM_HANDLE_BUCKETS 64
+#define ESIF_TMRM_HANDLE_BUCKET(handle) \
+	((u32)(size_t)(handle) & (ESIF_TMRM_HANDLE_BUCKETS - 1))
+
 /*
  * STRUCTURE DECLARATIONS
  */
@@ -69,6 +77,10 @@ struct esif_timer_manager {
 	u8 enabled;	/* Indicates the manager lock is initialized */
 	u8 marked_for_delete; /* Indicates no additional timers may be created */
 	struct esif_link_list *timer_list_ptr; /* List of initialized timers */
+
+	/* Hash indexes of the items in timer_list_ptr */
+	struct esif_tmrm_item *handle_buckets[ESIF_TMRM_HANDLE_BUCKETS];
+	struct esif_tmrm_item *cb_handle_buckets[ESIF_TMRM_HANDLE_BUCKETS];
 };
 
 struct esif_tmrm_item {
@@ -88,6 +100,10 @@ struct esif_tmrm_item {
 
 	/* List threads waiting for the timer callback to complete */
 	struct esif_link_list *destroy_list_ptr;
+
+	struct esif_link_list_node *node_ptr;	/* Node in the timer list */
+	struct esif_tmrm_item *next_by_handle_ptr;
+	struct esif_tmrm_item *next_by_cb_handle_ptr;
 };
 
 
@@ -99,6 +115,10 @@ struct esif_timer_manager g_tmrm = {0};
 u32 g_next_timer_handle = 0;
 u32 g_next_timer_cb_handle = 0;
 
+#if defined(ESIF_ATTR_OS_LINUX) && defined(ESIF_ATTR_USER)
+struct esif_timer_dispatcher g_tmr_dispatcher = {PTHREAD_MUTEX_INITIALIZER};
+#endif
+
 
 static enum esif_rc esif_ccb_timer_kill_w_event(
 	esif_ccb_timer_t *timer_ptr,
@@ -149,6 +169,11 @@ static void esif_ccb_tmrm_destroy_timer_node_wlock(
 	struct esif_link_list_node *node_ptr
 	);
 
+static void esif_ccb_tmrm_set_cb_handle_wlock(
+	struct esif_tmrm_item *self,
+	esif_ccb_timer_handle_t cb_handle
+	);
+
 
 static enum esif_rc esif_ccb_tmrm_get_first_timer(
 	esif_ccb_timer_t *timer_ptr
@@ -225,7 +250,16 @@ enum esif_rc esif_ccb_timer_init(
 			goto lock_exit;
 		}
 	}
-	rc = esif_link_list_add_at_back(g_tmrm.timer_list_ptr, tmrm_item_ptr);
+	tmrm_item_ptr->node_ptr = esif_link_list_create_node(tmrm_item_ptr);
+	if (NULL == tmrm_item_ptr->node_ptr) {
+		rc = ESIF_E_NO_MEMORY;
+		goto lock_exit;
+	}
+	esif_link_list_add_node_at_back(g_tmrm.timer_list_ptr, tmrm_item_ptr->node_ptr);
+
+	tmrm_item_ptr->next_by_handle_ptr =
+		g_tmrm.handle_buckets[ESIF_TMRM_HANDLE_BUCKET(tmrm_item_ptr->timer_handle)];
+	g_tmrm.handle_buckets[ESIF_TMRM_HANDLE_BUCKET(tmrm_item_ptr->timer_handle)] = tmrm_item_ptr;
 lock_exit:
 	esif_ccb_write_unlock(&g_tmrm.mgr_lock);
 exit:
@@ -357,8 +391,8 @@ enum esif_rc esif_ccb_timer_set_msec(
 
 	rc = esif_ccb_tmrm_get_next_cb_handle_wlock(&timer_cb_handle);
 	if (rc != ESIF_OK)
-		goto exit;
-	tmrm_item_ptr->timer_cb_handle = timer_cb_handle;
+		goto lock_exit;
+	esif_ccb_tmrm_set_cb_handle_wlock(tmrm_item_ptr, timer_cb_handle);
 
 	timer_obj_ptr = tmrm_item_ptr->timer_obj_ptr;
 	esif_ccb_timer_obj_save_pending_timeout(timer_obj_ptr,
@@ -374,6 +408,49 @@ exit:
 }
 
 
+/*
+ * Cancels the current timeout without destroying the timer.  A callback that
+ * has already started is not waited for.  The timer may be set again with
+ * esif_ccb_timer_set_msec.
+ */
+enum esif_rc esif_ccb_timer_cancel(
+	esif_ccb_timer_t *timer_ptr
+	)
+{
+	enum esif_rc rc = ESIF_E_UNSPECIFIED;
+	struct esif_link_list_node *node_ptr = NULL;
+	struct esif_tmrm_item *tmrm_item_ptr = NULL;
+
+	if (NULL == timer_ptr) {
+		rc = ESIF_E_PARAMETER_IS_NULL;
+		goto exit;
+	}
+
+	if (!g_tmrm.enabled)
+		goto exit;
+
+	esif_ccb_write_lock(&g_tmrm.mgr_lock);
+
+	node_ptr = esif_ccb_tmrm_find_timer_node_wlock(timer_ptr->timer_handle);
+	if ((NULL == node_ptr) || (NULL == node_ptr->data_ptr)) {
+		rc = ESIF_E_INVALID_HANDLE;
+		goto lock_exit;
+	}
+
+	tmrm_item_ptr = (struct esif_tmrm_item *)node_ptr->data_ptr;
+
+	/* A callback for the cancelled timeout that is already queued is dropped */
+	esif_ccb_tmrm_set_cb_handle_wlock(tmrm_item_ptr, 0);
+	tmrm_item_ptr->timer_obj_ptr->set_is_pending = ESIF_FALSE;
+	esif_ccb_timer_obj_disable_timer(tmrm_item_ptr->timer_obj_ptr);
+	rc = ESIF_OK;
+lock_exit:
+	esif_ccb_write_unlock(&g_tmrm.mgr_lock);
+exit:
+	return rc;
+}
+
+
 /*
  * This functions is expected to be called when the system is in a "known" state
  * before any attempt to create a timer
@@ -424,6 +501,11 @@ void esif_ccb_tmrm_exit(void)
 		esif_ccb_timer_kill_w_wait(&cur_timer);
 	}
 
+#if defined(ESIF_ATTR_OS_LINUX) && defined(ESIF_ATTR_USER)
+	/* The dispatcher outlives individual timers, so stop it here */
+	esif_ccb_timer_dispatcher_stop();
+#endif
+
 	g_tmrm.enabled = ESIF_FALSE;
 	esif_ccb_lock_uninit(&g_tmrm.mgr_lock);
 	g_tmrm.marked_for_delete = ESIF_FALSE;
@@ -481,7 +563,7 @@ void esif_ccb_tmrm_callback(
 	tmrm_item_ptr = (struct esif_tmrm_item *)node_ptr->data_ptr;
 
 	/* Clear the CB handle to lower probability of hitting same handle */
-	tmrm_item_ptr->timer_cb_handle = 0;
+	esif_ccb_tmrm_set_cb_handle_wlock(tmrm_item_ptr, 0);
 	tmrm_item_ptr->is_in_cb = ESIF_TRUE;
 
 	esif_ccb_write_unlock(&g_tmrm.mgr_lock);
@@ -609,24 +691,15 @@ static struct esif_link_list_node *esif_ccb_tmrm_find_timer_node_wlock(
 	esif_ccb_timer_handle_t handle
 	)
 {
-	struct esif_link_list_node *node_ptr = NULL;
 	struct esif_tmrm_item *tmrm_item_ptr = NULL;
 
-	if (NULL == g_tmrm.timer_list_ptr)
-		goto exit;
-
-	node_ptr = g_tmrm.timer_list_ptr->head_ptr;
-	while (node_ptr != NULL) {
-		tmrm_item_ptr = (struct esif_tmrm_item *)node_ptr->data_ptr;
-		if (NULL == tmrm_item_ptr) /* Should never happen */
-			continue;
-
+	tmrm_item_ptr = g_tmrm.handle_buckets[ESIF_TMRM_HANDLE_BUCKET(handle)];
+	while (tmrm_item_ptr != NULL) {
 		if (handle == tmrm_item_ptr->timer_handle)
-			break;	
-		node_ptr = node_ptr->next_ptr;
+			return tmrm_item_ptr->node_ptr;
+		tmrm_item_ptr = tmrm_item_ptr->next_by_handle_ptr;
 	}
-exit:
-	return node_ptr;
+	return NULL;
 }
 
 
@@ -634,24 +707,62 @@ static struct esif_link_list_node *esif_ccb_tmrm_find_timer_node_by_cb_wlock(
 	esif_ccb_timer_handle_t cb_handle
 	)
 {
-	struct esif_link_list_node *node_ptr = NULL;
 	struct esif_tmrm_item *tmrm_item_ptr = NULL;
 
-	if (NULL == g_tmrm.timer_list_ptr)
-		goto exit;
-
-	node_ptr = g_tmrm.timer_list_ptr->head_ptr;
-	while (node_ptr != NULL) {
-		tmrm_item_ptr = (struct esif_tmrm_item *)node_ptr->data_ptr;
-		if (NULL == tmrm_item_ptr) /* Should never happen */
-			continue;
+	if (0 == cb_handle)
+		return NULL;
 
+	tmrm_item_ptr = g_tmrm.cb_handle_buckets[ESIF_TMRM_HANDLE_BUCKET(cb_handle)];
+	while (tmrm_item_ptr != NULL) {
 		if (cb_handle == tmrm_item_ptr->timer_cb_handle)
-			break;	
-		node_ptr = node_ptr->next_ptr;
+			return tmrm_item_ptr->node_ptr;
+		tmrm_item_ptr = tmrm_item_ptr->next_by_cb_handle_ptr;
+	}
+	return NULL;
+}
+
+
+/* Removes an item from a hash bucket chain */
+static void esif_ccb_tmrm_unlink_wlock(
+	struct esif_tmrm_item **bucket_ptr,
+	struct esif_tmrm_item *self,
+	u8 by_cb_handle
+	)
+{
+	struct esif_tmrm_item **link_ptr = bucket_ptr;
+
+	while (*link_ptr != NULL) {
+		if (*link_ptr == self) {
+			*link_ptr = by_cb_handle ?
+				self->next_by_cb_handle_ptr : self->next_by_handle_ptr;
+			break;
+		}
+		link_ptr = by_cb_handle ?
+			&(*link_ptr)->next_by_cb_handle_ptr : &(*link_ptr)->next_by_handle_ptr;
+	}
+}
+
+
+static void esif_ccb_tmrm_set_cb_handle_wlock(
+	struct esif_tmrm_item *self,
+	esif_ccb_timer_handle_t cb_handle
+	)
+{
+	if (self->timer_cb_handle != 0) {
+		esif_ccb_tmrm_unlink_wlock(
+			&g_tmrm.cb_handle_buckets[ESIF_TMRM_HANDLE_BUCKET(self->timer_cb_handle)],
+			self,
+			ESIF_TRUE);
+	}
+
+	self->timer_cb_handle = cb_handle;
+	self->next_by_cb_handle_ptr = NULL;
+
+	if (cb_handle != 0) {
+		self->next_by_cb_handle_ptr =
+			g_tmrm.cb_handle_buckets[ESIF_TMRM_HANDLE_BUCKET(cb_handle)];
+		g_tmrm.cb_handle_buckets[ESIF_TMRM_HANDLE_BUCKET(cb_handle)] = self;
 	}
-exit:
-	return node_ptr;
 }
 
 
@@ -665,6 +776,13 @@ static void esif_ccb_tmrm_destroy_timer_node_wlock(
 	ESIF_ASSERT(node_ptr->data_ptr != NULL);
 
 	tmrm_item_ptr = (struct esif_tmrm_item *)node_ptr->data_ptr;
+
+	esif_ccb_tmrm_set_cb_handle_wlock(tmrm_item_ptr, 0);
+	esif_ccb_tmrm_unlink_wlock(
+		&g_tmrm.handle_buckets[ESIF_TMRM_HANDLE_BUCKET(tmrm_item_ptr->timer_handle)],
+		tmrm_item_ptr,
+		ESIF_FALSE);
+
 	esif_ccb_tmrm_destroy_tmrm_item(tmrm_item_ptr);
 
 	esif_link_list_node_remove(g_tmrm.timer_list_ptr, node_ptr);
@@ -763,7 +881,7 @@ static void esif_ccb_timer_obj_destroy(
 	if (NULL == self)
 		return;
 
-	esif_ccb_timer_obj_disable_timer(self);
+	esif_ccb_timer_obj_destroy_timer(self);
 
 	esif_ccb_free(self);
 }
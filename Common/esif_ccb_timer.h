@@ -78,7 +78,11 @@
  *        it is not recommended to kill the timer in the callback function
  *        frequently due to repeated calls to flush the DPC queue.)
  *
- *    esif_ccb_timer_set_msec - Sets the timeout and starts the timer
+ *    esif_ccb_timer_set_msec - Sets the timeout and starts the timer.  Setting
+ *        a timer that is already running reschedules it on the same handle.
+ *
+ *    esif_ccb_timer_cancel - Cancels the current timeout but keeps the timer
+ *        so it can be set again without a kill and init.
  *
  *    esif_ccb_timer_cb - Timer callback typedef
  *
@@ -88,7 +92,8 @@
  *        the first timer at the same time.)
  *
  *    esif_ccb_tmrm_exit - Should be called to cleanup the timer manager after
- *        all timers are destroyed and no other timers will be created.
+ *        all timers are destroyed and no other timers will be created.  The
+ *        thread that services timers runs until this is called.
  *        This functions is expected to be called when the system is in a
  *        "known" state where not attempts to create any timers are in flight
  *        as this function destroys the lock controlling synchronization
@@ -172,6 +177,14 @@ enum esif_rc esif_ccb_timer_set_msec(
 	const esif_ccb_time_t timeout	/* Timeout in msec */
 	);
 
+/*
+ * Cancels the current timeout without destroying the timer.  Does not wait
+ * for a callback that is already running.
+ */
+enum esif_rc esif_ccb_timer_cancel(
+	esif_ccb_timer_t *timer_ptr
+	);
+
 void esif_ccb_tmrm_callback(
 	esif_ccb_timer_handle_t cb_handle
 	);
@@ -25,14 +25,29 @@
 
 #if defined(ESIF_ATTR_OS_LINUX) && defined(ESIF_ATTR_USER)
 
-#include <signal.h>
+#include <pthread.h>
+#include <time.h>
+#include <errno.h>
 
+/*
+ * All timers are serviced by a single dispatcher thread.  Armed timers are
+ * kept in a min-heap ordered by their CLOCK_MONOTONIC expiration time and the
+ * dispatcher sleeps on a condition variable until the earliest one expires,
+ * so setting a timer does not create a thread and timers are not affected by
+ * changes to the wall clock.  Timer callbacks run one at a time on the
+ * dispatcher thread.  The dispatcher starts when the first timer is set and
+ * keeps running, even with no timers, until esif_ccb_tmrm_exit stops it.
+ */
+
+#define ESIF_TIMER_HEAP_INITIAL_SIZE 16
+#define ESIF_TIMER_NOT_ARMED (-1)
 
 #pragma pack(push, 1)
 
 struct esif_timer_obj {
-	/* TODO: OS-specific items*/
-	timer_t  timer;
+	u64 expiration_ns;			/* CLOCK_MONOTONIC expiration time */
+	int heap_index;				/* Position in the heap or ESIF_TIMER_NOT_ARMED */
+	esif_ccb_timer_handle_t armed_cb_handle; /* CB handle when the timer was armed */
 
 	esif_ccb_timer_cb function_ptr;		/* Callback when timer fires */
 	void *context_ptr;			/* Callback context if any */
@@ -51,20 +66,281 @@ struct esif_timer_obj {
 
 #pragma pack(pop)
 
+struct esif_timer_dispatcher {
+	pthread_mutex_t lock;	/* Must be first for static initialization */
+	pthread_cond_t cond;
+	u8 initialized;
+
+	pthread_t thread;
+	u8 is_running;		/* Dispatcher loop is running */
+	u8 is_joinable;		/* Thread has been created but not joined */
+	u8 stop_requested;
+
+	u32 timer_count;	/* Number of timer objects in existence */
+
+	struct esif_timer_obj **heap_ptr;
+	u32 heap_count;
+	u32 heap_size;
+};
+
+/* Defined in esif_ccb_timer.c */
+extern struct esif_timer_dispatcher g_tmr_dispatcher;
+
 static ESIF_INLINE void esif_ccb_timer_obj_disable_timer(
 	struct esif_timer_obj *self
 	);
 
 
-static ESIF_INLINE void esif_ccb_tmrm_cb_wrapper(
-	const union sigval sv
+static ESIF_INLINE u64 esif_ccb_timer_monotonic_ns(void)
+{
+	struct timespec now = {0};
+
+	clock_gettime(CLOCK_MONOTONIC, &now);
+	return ((u64)now.tv_sec * 1000000000) + (u64)now.tv_nsec;
+}
+
+
+static ESIF_INLINE void esif_ccb_timer_dispatcher_init(void)
+{
+	pthread_condattr_t attr;
+
+	/* The lock is statically initialized; the condition needs a clock */
+	pthread_mutex_lock(&g_tmr_dispatcher.lock);
+	if (!g_tmr_dispatcher.initialized) {
+		pthread_condattr_init(&attr);
+		pthread_condattr_setclock(&attr, CLOCK_MONOTONIC);
+		pthread_cond_init(&g_tmr_dispatcher.cond, &attr);
+		pthread_condattr_destroy(&attr);
+		g_tmr_dispatcher.initialized = ESIF_TRUE;
+	}
+	pthread_mutex_unlock(&g_tmr_dispatcher.lock);
+}
+
+
+/*
+ * Heap helpers.  Called with the dispatcher lock held.
+ */
+static ESIF_INLINE void esif_ccb_timer_heap_swap(
+	u32 index1,
+	u32 index2
 	)
 {
-	esif_ccb_timer_handle_t cb_handle = {0};
+	struct esif_timer_obj **heap_ptr = g_tmr_dispatcher.heap_ptr;
+	struct esif_timer_obj *temp_ptr = heap_ptr[index1];
+
+	heap_ptr[index1] = heap_ptr[index2];
+	heap_ptr[index2] = temp_ptr;
+	heap_ptr[index1]->heap_index = (int)index1;
+	heap_ptr[index2]->heap_index = (int)index2;
+}
+
+
+static ESIF_INLINE void esif_ccb_timer_heap_sift_up(u32 index)
+{
+	struct esif_timer_obj **heap_ptr = g_tmr_dispatcher.heap_ptr;
+	u32 parent = 0;
+
+	while (index > 0) {
+		parent = (index - 1) / 2;
+		if (heap_ptr[parent]->expiration_ns <= heap_ptr[index]->expiration_ns)
+			break;
+		esif_ccb_timer_heap_swap(parent, index);
+		index = parent;
+	}
+}
+
+
+static ESIF_INLINE void esif_ccb_timer_heap_sift_down(u32 index)
+{
+	struct esif_timer_obj **heap_ptr = g_tmr_dispatcher.heap_ptr;
+	u32 count = g_tmr_dispatcher.heap_count;
+	u32 smallest = index;
+	u32 child = 0;
+
+	for (;;) {
+		child = (2 * index) + 1;
+		if ((child < count) &&
+		    (heap_ptr[child]->expiration_ns < heap_ptr[smallest]->expiration_ns))
+			smallest = child;
+		child++;
+		if ((child < count) &&
+		    (heap_ptr[child]->expiration_ns < heap_ptr[smallest]->expiration_ns))
+			smallest = child;
+		if (smallest == index)
+			break;
+		esif_ccb_timer_heap_swap(index, smallest);
+		index = smallest;
+	}
+}
+
+
+static ESIF_INLINE enum esif_rc esif_ccb_timer_heap_insert(
+	struct esif_timer_obj *self
+	)
+{
+	struct esif_timer_obj **new_heap_ptr = NULL;
+	u32 new_size = 0;
+
+	if (g_tmr_dispatcher.heap_count >= g_tmr_dispatcher.heap_size) {
+		new_size = (g_tmr_dispatcher.heap_size > 0) ?
+			(g_tmr_dispatcher.heap_size * 2) :
+			ESIF_TIMER_HEAP_INITIAL_SIZE;
+		new_heap_ptr = (struct esif_timer_obj **)esif_ccb_realloc(
+			g_tmr_dispatcher.heap_ptr,
+			new_size * sizeof(*new_heap_ptr));
+		if (NULL == new_heap_ptr)
+			return ESIF_E_NO_MEMORY;
+		g_tmr_dispatcher.heap_ptr = new_heap_ptr;
+		g_tmr_dispatcher.heap_size = new_size;
+	}
+
+	self->heap_index = (int)g_tmr_dispatcher.heap_count;
+	g_tmr_dispatcher.heap_ptr[g_tmr_dispatcher.heap_count++] = self;
+	esif_ccb_timer_heap_sift_up((u32)self->heap_index);
+	return ESIF_OK;
+}
+
+
+static ESIF_INLINE void esif_ccb_timer_heap_remove(
+	struct esif_timer_obj *self
+	)
+{
+	u32 index = (u32)self->heap_index;
+	u32 last = g_tmr_dispatcher.heap_count - 1;
+
+	if (index != last) {
+		esif_ccb_timer_heap_swap(index, last);
+		g_tmr_dispatcher.heap_count--;
+		esif_ccb_timer_heap_sift_down(index);
+		esif_ccb_timer_heap_sift_up(index);
+	} else {
+		g_tmr_dispatcher.heap_count--;
+	}
+	self->heap_index = ESIF_TIMER_NOT_ARMED;
+
+	if (0 == g_tmr_dispatcher.heap_count) {
+		esif_ccb_free(g_tmr_dispatcher.heap_ptr);
+		g_tmr_dispatcher.heap_ptr = NULL;
+		g_tmr_dispatcher.heap_size = 0;
+	}
+}
+
+
+static ESIF_INLINE void *esif_ccb_timer_dispatcher_thread(void *ctx_ptr)
+{
+	struct esif_timer_obj *timer_obj_ptr = NULL;
+	esif_ccb_timer_handle_t cb_handle = 0;
+	struct timespec wait_until = {0};
+	u64 now_ns = 0;
 
-	cb_handle = (esif_ccb_timer_handle_t) sv.sival_int;
+	UNREFERENCED_PARAMETER(ctx_ptr);
 
-	esif_ccb_tmrm_callback(cb_handle);
+	pthread_mutex_lock(&g_tmr_dispatcher.lock);
+
+	while (!g_tmr_dispatcher.stop_requested) {
+		if (0 == g_tmr_dispatcher.heap_count) {
+			pthread_cond_wait(&g_tmr_dispatcher.cond, &g_tmr_dispatcher.lock);
+			continue;
+		}
+
+		timer_obj_ptr = g_tmr_dispatcher.heap_ptr[0];
+		now_ns = esif_ccb_timer_monotonic_ns();
+
+		if (timer_obj_ptr->expiration_ns > now_ns) {
+			wait_until.tv_sec = (time_t)(timer_obj_ptr->expiration_ns / 1000000000);
+			wait_until.tv_nsec = (long)(timer_obj_ptr->expiration_ns % 1000000000);
+			pthread_cond_timedwait(&g_tmr_dispatcher.cond, &g_tmr_dispatcher.lock, &wait_until);
+			continue;
+		}
+
+		/*
+		 * The timer object may be destroyed as soon as the lock is
+		 * released, so only the CB handle is used after this point.
+		 */
+		cb_handle = timer_obj_ptr->armed_cb_handle;
+		esif_ccb_timer_heap_remove(timer_obj_ptr);
+
+		pthread_mutex_unlock(&g_tmr_dispatcher.lock);
+		esif_ccb_tmrm_callback(cb_handle);
+		pthread_mutex_lock(&g_tmr_dispatcher.lock);
+	}
+
+	g_tmr_dispatcher.is_running = ESIF_FALSE;
+	pthread_mutex_unlock(&g_tmr_dispatcher.lock);
+	return NULL;
+}
+
+
+/*
+ * Joins the dispatcher thread if it has stopped.  Must not be called with the
+ * timer manager lock held or from a timer callback.
+ */
+static ESIF_INLINE void esif_ccb_timer_dispatcher_join(void)
+{
+	pthread_t thread;
+	u8 do_join = ESIF_FALSE;
+
+	esif_ccb_memset(&thread, 0, sizeof(thread));
+
+	pthread_mutex_lock(&g_tmr_dispatcher.lock);
+	if (g_tmr_dispatcher.is_joinable &&
+	    g_tmr_dispatcher.stop_requested &&
+	    !pthread_equal(g_tmr_dispatcher.thread, pthread_self())) {
+		thread = g_tmr_dispatcher.thread;
+		g_tmr_dispatcher.is_joinable = ESIF_FALSE;
+		do_join = ESIF_TRUE;
+	}
+	pthread_mutex_unlock(&g_tmr_dispatcher.lock);
+
+	if (do_join)
+		pthread_join(thread, NULL);
+}
+
+
+/*
+ * Stops the dispatcher thread and waits for it to exit.  Must not be called
+ * with the timer manager lock held or from a timer callback.
+ */
+static ESIF_INLINE void esif_ccb_timer_dispatcher_stop(void)
+{
+	pthread_mutex_lock(&g_tmr_dispatcher.lock);
+	if (g_tmr_dispatcher.is_running) {
+		g_tmr_dispatcher.stop_requested = ESIF_TRUE;
+		pthread_cond_signal(&g_tmr_dispatcher.cond);
+	}
+	pthread_mutex_unlock(&g_tmr_dispatcher.lock);
+
+	esif_ccb_timer_dispatcher_join();
+}
+
+
+/* Called with the dispatcher lock held */
+static ESIF_INLINE enum esif_rc esif_ccb_timer_dispatcher_start_locked(void)
+{
+	pthread_t old_thread;
+
+	if (g_tmr_dispatcher.is_running) {
+		/* Keep a stopping dispatcher running instead of starting another */
+		g_tmr_dispatcher.stop_requested = ESIF_FALSE;
+		return ESIF_OK;
+	}
+
+	if (g_tmr_dispatcher.is_joinable) {
+		/* The old dispatcher has left its loop and does not need any locks */
+		old_thread = g_tmr_dispatcher.thread;
+		g_tmr_dispatcher.is_joinable = ESIF_FALSE;
+		pthread_mutex_unlock(&g_tmr_dispatcher.lock);
+		pthread_join(old_thread, NULL);
+		pthread_mutex_lock(&g_tmr_dispatcher.lock);
+	}
+
+	g_tmr_dispatcher.stop_requested = ESIF_FALSE;
+	if (0 != pthread_create(&g_tmr_dispatcher.thread, NULL, esif_ccb_timer_dispatcher_thread, NULL))
+		return ESIF_E_UNSPECIFIED;
+
+	g_tmr_dispatcher.is_running = ESIF_TRUE;
+	g_tmr_dispatcher.is_joinable = ESIF_TRUE;
+	return ESIF_OK;
 }
 
 
@@ -72,52 +348,71 @@ static ESIF_INLINE enum esif_rc esif_ccb_timer_obj_create_timer(
 	struct esif_timer_obj *self
 	)
 {
-	UNREFERENCED_PARAMETER(self);
+	ESIF_ASSERT(self != NULL);
+
+	esif_ccb_timer_dispatcher_init();
+
+	self->heap_index = ESIF_TIMER_NOT_ARMED;
+
+	pthread_mutex_lock(&g_tmr_dispatcher.lock);
+	g_tmr_dispatcher.timer_count++;
+	pthread_mutex_unlock(&g_tmr_dispatcher.lock);
 
 	return ESIF_OK;
 }
 
 
+static ESIF_INLINE void esif_ccb_timer_obj_destroy_timer(
+	struct esif_timer_obj *self
+	)
+{
+	ESIF_ASSERT(self != NULL);
+
+	esif_ccb_timer_obj_disable_timer(self);
+
+	/*
+	 * The dispatcher keeps running without any timers so that re-creating
+	 * a timer doesn't start a new thread.  It is stopped by
+	 * esif_ccb_tmrm_exit.
+	 */
+	pthread_mutex_lock(&g_tmr_dispatcher.lock);
+	if (g_tmr_dispatcher.timer_count > 0)
+		g_tmr_dispatcher.timer_count--;
+	pthread_mutex_unlock(&g_tmr_dispatcher.lock);
+}
+
+
 static ESIF_INLINE enum esif_rc esif_ccb_timer_obj_enable_timer(
 	struct esif_timer_obj *self,
 	const esif_ccb_time_t timeout	/* Timeout in msec */
 	)
 {
 	enum esif_rc rc = ESIF_OK;
-	struct sigevent se;
-	struct itimerspec its;
-	pthread_attr_t attr;
-	u64 freq_nanosecs = timeout * 1000 * 1000; /* convert msec to nsec */
 
 	ESIF_ASSERT(self != NULL);
 
-	pthread_attr_init(&attr);
+	pthread_mutex_lock(&g_tmr_dispatcher.lock);
 
-	esif_ccb_timer_obj_disable_timer(self);
-
-	se.sigev_notify = SIGEV_THREAD;
-	se.sigev_notify_function   = esif_ccb_tmrm_cb_wrapper;
-	se.sigev_value.sival_int   = self->timer_cb_handle;
-	se.sigev_notify_attributes = &attr;
-
-	if (0 != timer_create(CLOCK_REALTIME,
-		&se,
-		(timer_t *)&self->timer)) {
-		rc = ESIF_E_UNSPECIFIED;
+	rc = esif_ccb_timer_dispatcher_start_locked();
+	if (rc != ESIF_OK)
 		goto exit;
-	} 
 
-	its.it_value.tv_sec     = freq_nanosecs / 1000000000;
-	its.it_value.tv_nsec    = freq_nanosecs % 1000000000;
-	its.it_interval.tv_sec  = 0;
-	its.it_interval.tv_nsec = 0;
+	if (self->heap_index != ESIF_TIMER_NOT_ARMED)
+		esif_ccb_timer_heap_remove(self);
+
+	self->timeout = timeout;
+	self->expiration_ns = esif_ccb_timer_monotonic_ns() + (timeout * 1000 * 1000);
+	self->armed_cb_handle = self->timer_cb_handle;
 
-	if (0 != timer_settime(self->timer, 0, &its, NULL)) {
-		rc = ESIF_E_UNSPECIFIED;
+	rc = esif_ccb_timer_heap_insert(self);
+	if (rc != ESIF_OK)
 		goto exit;
-	}
+
+	/* Wake the dispatcher if this is now the first timer to expire */
+	if (0 == self->heap_index)
+		pthread_cond_signal(&g_tmr_dispatcher.cond);
 exit:
-	pthread_attr_destroy(&attr);
+	pthread_mutex_unlock(&g_tmr_dispatcher.lock);
 	return rc;
 }
 
@@ -128,10 +423,10 @@ static ESIF_INLINE void esif_ccb_timer_obj_disable_timer(
 {
 	ESIF_ASSERT(self != NULL);
 
-	if (self->timer != 0) {
-		timer_delete(self->timer);
-		self->timer = 0;
-	}
+	pthread_mutex_lock(&g_tmr_dispatcher.lock);
+	if (self->heap_index != ESIF_TIMER_NOT_ARMED)
+		esif_ccb_timer_heap_remove(self);
+	pthread_mutex_unlock(&g_tmr_dispatcher.lock);
 }
 
 #endif /* LINUX USER */
@@ -233,6 +233,9 @@ typedef enum _t_eAppStatusCommand {
 	eAppStatusCommandGetModuleData,		/* Get the data for a given group id and module id */
 } eAppStatusCommand;
 
+/* Set in appStatusIn to return compact JSON instead of XML (ignored by eAppStatusCommandGetXSLT) */
+#define ESIF_APP_STATUS_FORMAT_JSON	0x80000000
+
 typedef eEsifError (ESIF_CALLCONV *AppGetStatusFunction)(
 	const void *appHandle,		/* Allocated handle for application */
 	const eAppStatusCommand command,/* Command */
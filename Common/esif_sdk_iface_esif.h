@@ -59,7 +59,8 @@
 
 #define ESIF_INTERFACE_VERSION_1 1
 #define ESIF_INTERFACE_VERSION_2 2
-#define ESIF_INTERFACE_VERSION ESIF_INTERFACE_VERSION_2
+#define ESIF_INTERFACE_VERSION_3 3
+#define ESIF_INTERFACE_VERSION ESIF_INTERFACE_VERSION_3
 
 /*
  * INTERFACE Flags
@@ -154,6 +155,47 @@ typedef eEsifError(ESIF_CALLCONV *AppSendEventFunction)(
 	const EsifDataPtr eventData,	/* Data included with the event if any MAY Be NULL */
 	const EsifDataPtr eventGuid	/* Event GUID */
 	);
+
+/* Version 3 */
+/*
+ * Batch Primitive Execution Application -> ESIF
+ * Executes a list of GET_* primitives in a single call.  Each item describes one primitive and receives
+ * its own status.  The results are packed into the single response buffer: the data for each item starts
+ * at an 8 byte aligned offset and is given fResponseSize bytes.  If the response buffer is too small no
+ * primitives are executed, ESIF_E_NEED_LARGER_BUFFER is returned and response->data_len holds the size
+ * required.  ESIF_OK is returned when the batch was processed, even if some of the items failed.
+ */
+#pragma pack(push, 1)
+
+typedef struct EsifPrimitiveBatchItem_s {
+	/* Request */
+	const void *fParticipantHandle;	/* Optional participant handle ESIF_NO_HANDLE */
+	const void *fDomainHandle;	/* Optional required if particpant handle is provided */
+	UInt32      fPrimitive;		/* Primitive ID e.g. GET_TEMPERATURE */
+	UInt32      fResponseType;	/* esif_data_type of the response */
+	UInt32      fResponseSize;	/* Bytes reserved for the response */
+	UInt8       fInstance;		/* Primitive instance may be 255 or ESIF_NO_INSTANCE */
+	UInt8       fReserved[3];
+
+	/* Result */
+	eEsifError  fStatus;		/* Result of the primitive */
+	UInt32      fOffset;		/* Offset of the response data in the response buffer */
+	UInt32      fDataLength;	/* Length of the response data or the size needed if too small */
+} EsifPrimitiveBatchItem, *EsifPrimitiveBatchItemPtr;
+
+#pragma pack(pop)
+
+#define ESIF_PRIMITIVE_BATCH_ALIGNMENT 8
+#define ESIF_PRIMITIVE_BATCH_ALIGN(size) \
+	(((size) + (ESIF_PRIMITIVE_BATCH_ALIGNMENT - 1)) & ~(ESIF_PRIMITIVE_BATCH_ALIGNMENT - 1))
+
+typedef eEsifError(ESIF_CALLCONV *AppPrimitiveBatchFunction)(
+	const void *esifHandle,		/* ESIF provided context handle */
+	const void *appHandle,		/* handled allocated by ESIF hosted application */
+	EsifPrimitiveBatchItemPtr items,	/* Primitives to execute and their results */
+	const UInt32 itemCount,		/* Number of items */
+	EsifDataPtr response		/* Single buffer receiving the data for all items */
+);
 /*
  * ESIF Service Interface ESIF <-- APPLICATION
  * Forward declared and typedef in esif_uf_iface.h
@@ -181,6 +223,9 @@ struct _t_EsifInterface {
 
 	/* Version 2 */
 	AppSendEventFunction fSendEventFuncPtr;
+
+	/* Version 3 */
+	AppPrimitiveBatchFunction fPrimitiveBatchFuncPtr;
 };
 
 #pragma pack(pop)
@@ -0,0 +1,97 @@
+/******************************************************************************
+** Copyright (c) 2013-2016 Intel Corporation All Rights Reserved
+**
+** Licensed under the Apache License, Version 2.0 (the "License"); you may not
+** use this file except in compliance with the License.
+**
+** You may obtain a copy of the License at
+**     http://www.apache.org/licenses/LICENSE-2.0
+**
+** Unless required by applicable law or agreed to in writing, software
+** distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+** WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+**
+** See the License for the specific language governing permissions and
+** limitations under the License.
+**
+******************************************************************************/
+
+#include "ArbitratorBenchmark.h"
+#include "BenchmarkStatistics.h"
+#include "Arbitrator.h"
+#include <algorithm>
+#include <memory>
+
+static const UIntN BenchmarkPolicyCounts[] = {1, 3, 8};
+static const UIntN BenchmarkDomainCounts[] = {4, 16, 64};
+static const UInt64 MinimumRoundCount = 100;
+static const UIntN PerformanceStateCount = 16;
+
+static void runArbitrationRounds(DptfManagerInterface* dptfManager, UIntN policyCount, UIntN domainCount,
+    UInt64 roundCount, std::ostream& output)
+{
+    std::vector<std::shared_ptr<Arbitrator>> arbitrators;
+    for (UIntN domainIndex = 0; domainIndex < domainCount; domainIndex++)
+    {
+        arbitrators.push_back(std::make_shared<Arbitrator>(dptfManager));
+    }
+
+    BenchmarkStatistics statistics("arbitrator",
+        "policies_" + StlOverride::to_string(policyCount) + "_domains_" + StlOverride::to_string(domainCount),
+        "arbitrate_round_cpu");
+    statistics.reserve(roundCount);
+
+    Temperature currentTemperature = Temperature::fromCelsius(50.0);
+    Temperature hysteresis = Temperature::fromCelsius(0);
+    UInt64 changedCount = 0;
+    for (UInt64 roundNumber = 0; roundNumber < roundCount; roundNumber++)
+    {
+        UInt64 startTime = BenchmarkStatistics::getThreadCpuTimeNanoseconds();
+        for (UIntN policyIndex = 0; policyIndex < policyCount; policyIndex++)
+        {
+            // Each policy asks for something a little different every round so the arbitrated values move
+            UIntN step = static_cast<UIntN>((roundNumber + policyIndex) % 10);
+            Power powerLimit = Power::createFromMilliwatts(10000 + (step * 1000));
+            TemperatureThresholds thresholds(Temperature::fromCelsius(40.0 - step),
+                Temperature::fromCelsius(60.0 + step), hysteresis);
+            Percentage fanSpeed = Percentage::fromWholeNumber(step * 10);
+            UIntN performanceState = (step + policyIndex) % PerformanceStateCount;
+
+            for (auto arbitrator = arbitrators.begin(); arbitrator != arbitrators.end(); ++arbitrator)
+            {
+                changedCount += (*arbitrator)->getPowerControlArbitrator()->arbitrate(
+                    policyIndex, PowerControlType::PL1, powerLimit) ? 1 : 0;
+                changedCount += (*arbitrator)->getTemperatureThresholdArbitrator()->arbitrate(
+                    policyIndex, thresholds, currentTemperature) ? 1 : 0;
+                changedCount += (*arbitrator)->getActiveControlArbitrator()->arbitrate(
+                    policyIndex, fanSpeed) ? 1 : 0;
+                changedCount += (*arbitrator)->getPerformanceControlArbitrator()->arbitrate(
+                    policyIndex, performanceState) ? 1 : 0;
+            }
+        }
+        statistics.addSample(BenchmarkStatistics::getThreadCpuTimeNanoseconds() - startTime);
+    }
+
+    if (changedCount == 0)
+    {
+        throw dptf_exception("Arbitrator benchmark did not change any arbitrated values.");
+    }
+
+    output << statistics.toCsv() << std::endl;
+}
+
+void runArbitratorBenchmark(DptfManagerInterface* dptfManager, UInt64 requestCount, std::ostream& output)
+{
+    for (UIntN policyCountIndex = 0; policyCountIndex < sizeof(BenchmarkPolicyCounts) / sizeof(UIntN);
+        policyCountIndex++)
+    {
+        for (UIntN domainCountIndex = 0; domainCountIndex < sizeof(BenchmarkDomainCounts) / sizeof(UIntN);
+            domainCountIndex++)
+        {
+            UIntN policyCount = BenchmarkPolicyCounts[policyCountIndex];
+            UIntN domainCount = BenchmarkDomainCounts[domainCountIndex];
+            UInt64 roundCount = std::max(requestCount / (policyCount * domainCount), MinimumRoundCount);
+            runArbitrationRounds(dptfManager, policyCount, domainCount, roundCount, output);
+        }
+    }
+}
\ No newline at end of file
@@ -0,0 +1,32 @@
+/******************************************************************************
+** Copyright (c) 2013-2016 Intel Corporation All Rights Reserved
+**
+** Licensed under the Apache License, Version 2.0 (the "License"); you may not
+** use this file except in compliance with the License.
+**
+** You may obtain a copy of the License at
+**     http://www.apache.org/licenses/LICENSE-2.0
+**
+** Unless required by applicable law or agreed to in writing, software
+** distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+** WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+**
+** See the License for the specific language governing permissions and
+** limitations under the License.
+**
+******************************************************************************/
+
+#pragma once
+
+#include "Dptf.h"
+#include "DptfManagerInterface.h"
+#include <ostream>
+
+//
+// Runs rounds of control requests through one Arbitrator per domain and reports the thread CPU time per round.
+// In each round every policy asks every domain for a power limit, temperature thresholds, a fan speed and a
+// performance state, the way a busy platform with that many policies and domains would.  Variants are named
+// policies_<count>_domains_<count>.
+//
+
+void runArbitratorBenchmark(DptfManagerInterface* dptfManager, UInt64 requestCount, std::ostream& output);
\ No newline at end of file
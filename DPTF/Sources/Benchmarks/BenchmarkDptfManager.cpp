@@ -0,0 +1,123 @@
+/******************************************************************************
+** Copyright (c) 2013-2016 Intel Corporation All Rights Reserved
+**
+** Licensed under the Apache License, Version 2.0 (the "License"); you may not
+** use this file except in compliance with the License.
+**
+** You may obtain a copy of the License at
+**     http://www.apache.org/licenses/LICENSE-2.0
+**
+** Unless required by applicable law or agreed to in writing, software
+** distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+** WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+**
+** See the License for the specific language governing permissions and
+** limitations under the License.
+**
+******************************************************************************/
+
+#include "BenchmarkDptfManager.h"
+
+BenchmarkDptfManager::BenchmarkDptfManager(void)
+{
+}
+
+BenchmarkDptfManager::~BenchmarkDptfManager(void)
+{
+}
+
+void BenchmarkDptfManager::createDptfManager(const void* esifHandle, EsifInterfacePtr esifInterfacePtr,
+    const std::string& dptfHomeDirectoryPath, eLogType currentLogVerbosityLevel, Bool dptfEnabled)
+{
+}
+
+Bool BenchmarkDptfManager::isDptfManagerCreated(void) const
+{
+    return true;
+}
+
+Bool BenchmarkDptfManager::isDptfShuttingDown(void) const
+{
+    return false;
+}
+
+Bool BenchmarkDptfManager::isWorkItemQueueManagerCreated(void) const
+{
+    return false;
+}
+
+EsifServicesInterface* BenchmarkDptfManager::getEsifServices(void) const
+{
+    return nullptr;
+}
+
+std::shared_ptr<EventCache> BenchmarkDptfManager::getEventCache(void) const
+{
+    return nullptr;
+}
+
+std::shared_ptr<UserPreferredCache> BenchmarkDptfManager::getUserPreferredCache(void) const
+{
+    return nullptr;
+}
+
+WorkItemQueueManagerInterface* BenchmarkDptfManager::getWorkItemQueueManager(void) const
+{
+    return nullptr;
+}
+
+PolicyManagerInterface* BenchmarkDptfManager::getPolicyManager(void) const
+{
+    return nullptr;
+}
+
+ParticipantManagerInterface* BenchmarkDptfManager::getParticipantManager(void) const
+{
+    return nullptr;
+}
+
+DptfStatusInterface* BenchmarkDptfManager::getDptfStatus(void)
+{
+    return nullptr;
+}
+
+IndexContainerInterface* BenchmarkDptfManager::getIndexContainer(void) const
+{
+    return nullptr;
+}
+
+PlatformTraceWriter* BenchmarkDptfManager::getPlatformTrace(void) const
+{
+    return nullptr;
+}
+
+std::string BenchmarkDptfManager::getDptfHomeDirectoryPath(void) const
+{
+    return std::string();
+}
+
+std::string BenchmarkDptfManager::getDptfPolicyDirectoryPath(void) const
+{
+    return std::string();
+}
+
+Bool BenchmarkDptfManager::isDptfPolicyLoadNameOnly(void) const
+{
+    return false;
+}
+
+void BenchmarkDptfManager::bindDomainsToPolicies(UIntN participantIndex) const
+{
+}
+
+void BenchmarkDptfManager::unbindDomainsFromPolicies(UIntN participantIndex) const
+{
+}
+
+void BenchmarkDptfManager::bindParticipantToPolicies(UIntN participantIndex) const
+{
+}
+
+void BenchmarkDptfManager::unbindParticipantFromPolicies(UIntN participantIndex) const
+{
+}
\ No newline at end of file
@@ -0,0 +1,57 @@
+/******************************************************************************
+** Copyright (c) 2013-2016 Intel Corporation All Rights Reserved
+**
+** Licensed under the Apache License, Version 2.0 (the "License"); you may not
+** use this file except in compliance with the License.
+**
+** You may obtain a copy of the License at
+**     http://www.apache.org/licenses/LICENSE-2.0
+**
+** Unless required by applicable law or agreed to in writing, software
+** distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+** WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+**
+** See the License for the specific language governing permissions and
+** limitations under the License.
+**
+******************************************************************************/
+
+#pragma once
+
+#include "Dptf.h"
+#include "DptfManagerInterface.h"
+
+//
+// Minimal DptfManagerInterface used by the benchmarks.  None of the managers are created, so it can only be
+// used with code that does not call into ESIF, the policies, or the participants.
+//
+
+class BenchmarkDptfManager : public DptfManagerInterface
+{
+public:
+
+    BenchmarkDptfManager(void);
+    virtual ~BenchmarkDptfManager(void);
+
+    virtual void createDptfManager(const void* esifHandle, EsifInterfacePtr esifInterfacePtr,
+        const std::string& dptfHomeDirectoryPath, eLogType currentLogVerbosityLevel, Bool dptfEnabled) override;
+    virtual Bool isDptfManagerCreated(void) const override;
+    virtual Bool isDptfShuttingDown(void) const override;
+    virtual Bool isWorkItemQueueManagerCreated(void) const override;
+    virtual EsifServicesInterface* getEsifServices(void) const override;
+    virtual std::shared_ptr<EventCache> getEventCache(void) const override;
+    virtual std::shared_ptr<UserPreferredCache> getUserPreferredCache(void) const override;
+    virtual WorkItemQueueManagerInterface* getWorkItemQueueManager(void) const override;
+    virtual PolicyManagerInterface* getPolicyManager(void) const override;
+    virtual ParticipantManagerInterface* getParticipantManager(void) const override;
+    virtual DptfStatusInterface* getDptfStatus(void) override;
+    virtual IndexContainerInterface* getIndexContainer(void) const override;
+    virtual PlatformTraceWriter* getPlatformTrace(void) const override;
+    virtual std::string getDptfHomeDirectoryPath(void) const override;
+    virtual std::string getDptfPolicyDirectoryPath(void) const override;
+    virtual Bool isDptfPolicyLoadNameOnly(void) const override;
+    virtual void bindDomainsToPolicies(UIntN participantIndex) const override;
+    virtual void unbindDomainsFromPolicies(UIntN participantIndex) const override;
+    virtual void bindParticipantToPolicies(UIntN participantIndex) const override;
+    virtual void unbindParticipantFromPolicies(UIntN participantIndex) const override;
+};
\ No newline at end of file
@@ -0,0 +1,99 @@
+/******************************************************************************
+** Copyright (c) 2013-2016 Intel Corporation All Rights Reserved
+**
+** Licensed under the Apache License, Version 2.0 (the "License"); you may not
+** use this file except in compliance with the License.
+**
+** You may obtain a copy of the License at
+**     http://www.apache.org/licenses/LICENSE-2.0
+**
+** Unless required by applicable law or agreed to in writing, software
+** distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+** WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+**
+** See the License for the specific language governing permissions and
+** limitations under the License.
+**
+******************************************************************************/
+
+#include "BenchmarkStatistics.h"
+#include <algorithm>
+#include <chrono>
+#include <sstream>
+#include <time.h>
+
+BenchmarkStatistics::BenchmarkStatistics(const std::string& benchmarkName, const std::string& variantName,
+    const std::string& operationName) :
+    m_benchmarkName(benchmarkName),
+    m_variantName(variantName),
+    m_operationName(operationName),
+    m_sorted(true)
+{
+}
+
+void BenchmarkStatistics::reserve(UInt64 sampleCount)
+{
+    m_samples.reserve(static_cast<size_t>(sampleCount));
+}
+
+void BenchmarkStatistics::addSample(UInt64 nanoseconds)
+{
+    m_samples.push_back(nanoseconds);
+    m_sorted = false;
+}
+
+UInt64 BenchmarkStatistics::getSampleCount(void) const
+{
+    return m_samples.size();
+}
+
+UInt64 BenchmarkStatistics::getPercentile(UIntN percentile) const
+{
+    if (m_samples.empty() == true)
+    {
+        return 0;
+    }
+
+    if (m_sorted == false)
+    {
+        std::sort(m_samples.begin(), m_samples.end());
+        m_sorted = true;
+    }
+
+    UInt64 index = (static_cast<UInt64>(m_samples.size() - 1) * percentile) / 100;
+    return m_samples[static_cast<size_t>(index)];
+}
+
+std::string BenchmarkStatistics::toCsv(void) const
+{
+    UInt64 total = 0;
+    for (auto sample = m_samples.begin(); sample != m_samples.end(); sample++)
+    {
+        total += *sample;
+    }
+    UInt64 mean = (m_samples.empty() == true) ? 0 : (total / m_samples.size());
+
+    std::stringstream csv;
+    csv << m_benchmarkName << "," << m_variantName << "," << m_operationName << "," << m_samples.size() << "," <<
+        mean << "," << getPercentile(50) << "," << getPercentile(90) << "," << getPercentile(99) << "," <<
+        getPercentile(100);
+    return csv.str();
+}
+
+std::string BenchmarkStatistics::getCsvHeader(void)
+{
+    return "benchmark,variant,operation,count,mean_ns,p50_ns,p90_ns,p99_ns,max_ns";
+}
+
+UInt64 BenchmarkStatistics::getTimestampNanoseconds(void)
+{
+    return static_cast<UInt64>(std::chrono::duration_cast<std::chrono::nanoseconds>(
+        std::chrono::steady_clock::now().time_since_epoch()).count());
+}
+
+UInt64 BenchmarkStatistics::getThreadCpuTimeNanoseconds(void)
+{
+    struct timespec cpuTime = {0};
+    clock_gettime(CLOCK_THREAD_CPUTIME_ID, &cpuTime);
+    return (static_cast<UInt64>(cpuTime.tv_sec) * 1000000000ULL) + static_cast<UInt64>(cpuTime.tv_nsec);
+}
\ No newline at end of file
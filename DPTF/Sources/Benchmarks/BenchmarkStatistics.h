@@ -0,0 +1,54 @@
+/******************************************************************************
+** Copyright (c) 2013-2016 Intel Corporation All Rights Reserved
+**
+** Licensed under the Apache License, Version 2.0 (the "License"); you may not
+** use this file except in compliance with the License.
+**
+** You may obtain a copy of the License at
+**     http://www.apache.org/licenses/LICENSE-2.0
+**
+** Unless required by applicable law or agreed to in writing, software
+** distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+** WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+**
+** See the License for the specific language governing permissions and
+** limitations under the License.
+**
+******************************************************************************/
+
+#pragma once
+
+#include "Dptf.h"
+
+//
+// Collects the latency of each operation measured by a benchmark and reports percentiles.  Results are written
+// as comma separated lines so they can be compared across builds:
+//
+//   benchmark,variant,operation,count,mean_ns,p50_ns,p90_ns,p99_ns,max_ns
+//
+
+class BenchmarkStatistics
+{
+public:
+
+    BenchmarkStatistics(const std::string& benchmarkName, const std::string& variantName,
+        const std::string& operationName);
+
+    void reserve(UInt64 sampleCount);
+    void addSample(UInt64 nanoseconds);
+    UInt64 getSampleCount(void) const;
+    UInt64 getPercentile(UIntN percentile) const;
+    std::string toCsv(void) const;
+
+    static std::string getCsvHeader(void);
+    static UInt64 getTimestampNanoseconds(void);
+    static UInt64 getThreadCpuTimeNanoseconds(void);
+
+private:
+
+    std::string m_benchmarkName;
+    std::string m_variantName;
+    std::string m_operationName;
+    mutable std::vector<UInt64> m_samples;
+    mutable Bool m_sorted;
+};
\ No newline at end of file
@@ -0,0 +1,102 @@
+/******************************************************************************
+** Copyright (c) 2013-2016 Intel Corporation All Rights Reserved
+**
+** Licensed under the Apache License, Version 2.0 (the "License"); you may not
+** use this file except in compliance with the License.
+**
+** You may obtain a copy of the License at
+**     http://www.apache.org/licenses/LICENSE-2.0
+**
+** Unless required by applicable law or agreed to in writing, software
+** distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+** WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+**
+** See the License for the specific language governing permissions and
+** limitations under the License.
+**
+******************************************************************************/
+
+#include "Dptf.h"
+#include "ArbitratorBenchmark.h"
+#include "BenchmarkDptfManager.h"
+#include "BenchmarkStatistics.h"
+#include "ImmediateWorkItemQueueBenchmark.h"
+#include "MessageLoggingBenchmark.h"
+#include "PlatformBenchmark.h"
+#include "RelationshipTableBenchmark.h"
+#include "StatusSerializationBenchmark.h"
+#include "UniqueIdGenerator.h"
+#include <cstdlib>
+#include <iostream>
+
+//
+// Usage: DptfBenchmarks [event count [participant count [relationship table entries]]]
+//
+// Results are written to stdout as comma separated values.  The platform benchmark runs at a few platform sizes
+// unless a participant count is given.
+//
+
+static const UInt64 DefaultEventCount = 100000;
+static const UIntN DefaultPlatformScales[][2] = {{4, 8}, {16, 64}, {64, 256}};
+static const UIntN DefaultRelationshipTableEntriesPerParticipant = 4;
+
+static int printUsage(const char* programName)
+{
+    std::cerr << "Usage: " << programName <<
+        " [event count [participant count [relationship table entries]]]" << std::endl;
+    return 1;
+}
+
+int main(int argc, char* argv[])
+{
+    UInt64 eventCount = DefaultEventCount;
+    if (argc > 1)
+    {
+        eventCount = std::strtoull(argv[1], nullptr, 10);
+        if (eventCount == 0)
+        {
+            return printUsage(argv[0]);
+        }
+    }
+
+    UIntN participantCount = 0;
+    UIntN relationshipTableEntryCount = 0;
+    if (argc > 2)
+    {
+        participantCount = static_cast<UIntN>(std::strtoul(argv[2], nullptr, 10));
+        relationshipTableEntryCount = participantCount * DefaultRelationshipTableEntriesPerParticipant;
+        if (argc > 3)
+        {
+            relationshipTableEntryCount = static_cast<UIntN>(std::strtoul(argv[3], nullptr, 10));
+        }
+        if (participantCount < 2)
+        {
+            return printUsage(argv[0]);
+        }
+    }
+
+    BenchmarkDptfManager dptfManager;
+
+    std::cout << BenchmarkStatistics::getCsvHeader() << std::endl;
+    runImmediateWorkItemQueueBenchmark(&dptfManager, eventCount, std::cout);
+    runMessageLoggingBenchmark(&dptfManager, eventCount, std::cout);
+    runStatusSerializationBenchmark(eventCount, std::cout);
+    runRelationshipTableBenchmark(eventCount, std::cout);
+    runArbitratorBenchmark(&dptfManager, eventCount, std::cout);
+
+    if (participantCount > 0)
+    {
+        runPlatformBenchmark(eventCount, participantCount, relationshipTableEntryCount, std::cout);
+    }
+    else
+    {
+        for (UIntN scale = 0; scale < sizeof(DefaultPlatformScales) / sizeof(DefaultPlatformScales[0]); scale++)
+        {
+            runPlatformBenchmark(eventCount, DefaultPlatformScales[scale][0], DefaultPlatformScales[scale][1],
+                std::cout);
+        }
+    }
+
+    UniqueIdGenerator::destroy();
+    return 0;
+}
\ No newline at end of file
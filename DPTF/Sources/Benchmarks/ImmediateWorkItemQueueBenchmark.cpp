@@ -0,0 +1,278 @@
+/******************************************************************************
+** Copyright (c) 2013-2016 Intel Corporation All Rights Reserved
+**
+** Licensed under the Apache License, Version 2.0 (the "License"); you may not
+** use this file except in compliance with the License.
+**
+** You may obtain a copy of the License at
+**     http://www.apache.org/licenses/LICENSE-2.0
+**
+** Unless required by applicable law or agreed to in writing, software
+** distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+** WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+**
+** See the License for the specific language governing permissions and
+** limitations under the License.
+**
+******************************************************************************/
+
+#include "ImmediateWorkItemQueueBenchmark.h"
+#include "BenchmarkStatistics.h"
+#include "ImmediateWorkItemQueue.h"
+#include "DomainWorkItem.h"
+#include "EsifMutexHelper.h"
+
+static const UIntN BenchmarkParticipantCount = 64;
+static const UIntN BenchmarkDomainCount = 2;
+static const UIntN BenchmarkHighPriority = 10;
+
+//
+// Domain work item that does nothing when executed.  Only used to fill the queue.
+//
+
+class BenchmarkWorkItem : public DomainWorkItem
+{
+public:
+
+    BenchmarkWorkItem(DptfManagerInterface* dptfManager, FrameworkEvent::Type frameworkEventType,
+        UIntN participantIndex, UIntN domainIndex) :
+        DomainWorkItem(dptfManager, frameworkEventType, participantIndex, domainIndex)
+    {
+    }
+
+    virtual void execute(void) override final
+    {
+    }
+};
+
+//
+// Copy of the immediate queue before it was converted to an ordered tree with indexes.  It is kept here so
+// the benchmark can report before and after numbers from the same build.
+//
+
+class ListImmediateWorkItemQueue
+{
+public:
+
+    ListImmediateWorkItemQueue(EsifSemaphore* workItemQueueSemaphore) :
+        m_workItemQueueSemaphore(workItemQueueSemaphore)
+    {
+    }
+
+    ~ListImmediateWorkItemQueue(void)
+    {
+        makeEmtpy();
+    }
+
+    void enqueue(ImmediateWorkItem* newWorkItem)
+    {
+        EsifMutexHelper esifMutexHelper(&m_mutex);
+        esifMutexHelper.lock();
+
+        if (newWorkItem->getFrameworkEventType() == FrameworkEvent::DomainTemperatureThresholdCrossed)
+        {
+            ParticipantWorkItem* participantWorkItem = static_cast<ParticipantWorkItem*>(newWorkItem->getWorkItem());
+
+            WorkItemMatchCriteria matchCriteria;
+            matchCriteria.addFrameworkEventTypeToMatchList(participantWorkItem->getFrameworkEventType());
+            matchCriteria.addParticipantIndexToMatchList(participantWorkItem->getParticipantIndex());
+
+            for (auto it = m_queue.begin(); it != m_queue.end(); it++)
+            {
+                if ((*it)->matches(matchCriteria) == true)
+                {
+                    throw duplicate_work_item("Attempted to insert duplicate thermal threshold crossed event into immediate queue.");
+                }
+            }
+        }
+
+        if (m_queue.empty() == true || newWorkItem->getPriority() == 0)
+        {
+            m_queue.push_back(newWorkItem);
+        }
+        else
+        {
+            auto it = m_queue.begin();
+            for (; it != m_queue.end(); it++)
+            {
+                if (newWorkItem->getPriority() > (*it)->getPriority())
+                {
+                    m_queue.insert(it, newWorkItem);
+                    break;
+                }
+            }
+
+            if (it == m_queue.end())
+            {
+                m_queue.push_back(newWorkItem);
+            }
+        }
+
+        m_workItemQueueSemaphore->signal();
+
+        esifMutexHelper.unlock();
+    }
+
+    ImmediateWorkItem* dequeue(void)
+    {
+        ImmediateWorkItem* firstItemInQueue = nullptr;
+
+        EsifMutexHelper esifMutexHelper(&m_mutex);
+        esifMutexHelper.lock();
+
+        if (m_queue.empty() == false)
+        {
+            firstItemInQueue = m_queue.front();
+            m_queue.pop_front();
+        }
+
+        esifMutexHelper.unlock();
+
+        return firstItemInQueue;
+    }
+
+    void makeEmtpy(void)
+    {
+        EsifMutexHelper esifMutexHelper(&m_mutex);
+        esifMutexHelper.lock();
+
+        while (m_queue.empty() == false)
+        {
+            delete m_queue.front();
+            m_queue.pop_front();
+        }
+
+        esifMutexHelper.unlock();
+    }
+
+    UIntN removeIfMatches(const WorkItemMatchCriteria& matchCriteria)
+    {
+        EsifMutexHelper esifMutexHelper(&m_mutex);
+        esifMutexHelper.lock();
+
+        UIntN numRemoved = 0;
+        auto it = m_queue.begin();
+        while (it != m_queue.end())
+        {
+            if ((*it)->matches(matchCriteria) == true)
+            {
+                DELETE_MEMORY_TC(*it);
+                it = m_queue.erase(it);
+                numRemoved++;
+            }
+            else
+            {
+                it++;
+            }
+        }
+
+        esifMutexHelper.unlock();
+
+        return numRemoved;
+    }
+
+private:
+
+    std::list<ImmediateWorkItem*> m_queue;
+    EsifMutex m_mutex;
+    EsifSemaphore* m_workItemQueueSemaphore;
+};
+
+//
+// Returns the event for the given position in the flood.  Half of the events are temperature threshold
+// crossed events from a small set of domains (the interrupt storm), a quarter are other capability change
+// events, and a quarter are events that are never coalesced.  One event in eight has a high priority.
+//
+
+static ImmediateWorkItem* createBenchmarkEvent(DptfManagerInterface* dptfManager, UInt64 eventNumber)
+{
+    // simple linear congruential generator so every run and every variant sees the same sequence
+    UInt64 random = (eventNumber * 6364136223846793005ULL) + 1442695040888963407ULL;
+    random = random >> 33;
+
+    FrameworkEvent::Type frameworkEventType;
+    switch (random % 4)
+    {
+        case 0:
+        case 1:
+            frameworkEventType = FrameworkEvent::DomainTemperatureThresholdCrossed;
+            break;
+        case 2:
+            frameworkEventType = FrameworkEvent::DomainPerformanceControlCapabilityChanged;
+            break;
+        default:
+            frameworkEventType = FrameworkEvent::DomainRadioConnectionStatusChanged;
+            break;
+    }
+
+    UIntN participantIndex = static_cast<UIntN>((random >> 2) % BenchmarkParticipantCount);
+    UIntN domainIndex = static_cast<UIntN>((random >> 8) % BenchmarkDomainCount);
+    UIntN priority = (((random >> 10) % 8) == 0) ? BenchmarkHighPriority : 0;
+
+    WorkItemInterface* workItem = new BenchmarkWorkItem(dptfManager, frameworkEventType, participantIndex, domainIndex);
+    return new ImmediateWorkItem(workItem, priority);
+}
+
+template <typename QueueType>
+static void runQueueBenchmark(DptfManagerInterface* dptfManager, UInt64 eventCount, const std::string& variantName,
+    std::ostream& output)
+{
+    EsifSemaphore workItemQueueSemaphore;
+    QueueType queue(&workItemQueueSemaphore);
+
+    BenchmarkStatistics enqueueStatistics("immediate_work_item_queue", variantName, "enqueue");
+    BenchmarkStatistics dequeueStatistics("immediate_work_item_queue", variantName, "dequeue");
+    BenchmarkStatistics removeStatistics("immediate_work_item_queue", variantName, "remove_if_matches");
+    enqueueStatistics.reserve(eventCount);
+    dequeueStatistics.reserve(eventCount);
+
+    // Flood the queue.  Duplicates are rejected with an exception just like they are when ESIF sends them.
+    UInt64 queuedCount = 0;
+    for (UInt64 eventNumber = 0; eventNumber < eventCount; eventNumber++)
+    {
+        ImmediateWorkItem* immediateWorkItem = createBenchmarkEvent(dptfManager, eventNumber);
+
+        UInt64 startTime = BenchmarkStatistics::getTimestampNanoseconds();
+        try
+        {
+            queue.enqueue(immediateWorkItem);
+            queuedCount++;
+        }
+        catch (duplicate_work_item&)
+        {
+            delete immediateWorkItem;
+        }
+        enqueueStatistics.addSample(BenchmarkStatistics::getTimestampNanoseconds() - startTime);
+    }
+
+    // Remove the non coalesced events for half of the participants, as is done when participants are destroyed.
+    for (UIntN participantIndex = 0; participantIndex < BenchmarkParticipantCount; participantIndex += 2)
+    {
+        WorkItemMatchCriteria matchCriteria;
+        matchCriteria.addFrameworkEventTypeToMatchList(FrameworkEvent::DomainRadioConnectionStatusChanged);
+        matchCriteria.addParticipantIndexToMatchList(participantIndex);
+
+        UInt64 startTime = BenchmarkStatistics::getTimestampNanoseconds();
+        queuedCount -= queue.removeIfMatches(matchCriteria);
+        removeStatistics.addSample(BenchmarkStatistics::getTimestampNanoseconds() - startTime);
+    }
+
+    // Drain the queue.
+    for (UInt64 dequeueNumber = 0; dequeueNumber < queuedCount; dequeueNumber++)
+    {
+        UInt64 startTime = BenchmarkStatistics::getTimestampNanoseconds();
+        ImmediateWorkItem* immediateWorkItem = queue.dequeue();
+        dequeueStatistics.addSample(BenchmarkStatistics::getTimestampNanoseconds() - startTime);
+        delete immediateWorkItem;
+    }
+
+    output << enqueueStatistics.toCsv() << std::endl;
+    output << dequeueStatistics.toCsv() << std::endl;
+    output << removeStatistics.toCsv() << std::endl;
+}
+
+void runImmediateWorkItemQueueBenchmark(DptfManagerInterface* dptfManager, UInt64 eventCount, std::ostream& output)
+{
+    runQueueBenchmark<ListImmediateWorkItemQueue>(dptfManager, eventCount, "list", output);
+    runQueueBenchmark<ImmediateWorkItemQueue>(dptfManager, eventCount, "indexed", output);
+}
\ No newline at end of file
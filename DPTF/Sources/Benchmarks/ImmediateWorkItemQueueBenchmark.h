@@ -0,0 +1,30 @@
+/******************************************************************************
+** Copyright (c) 2013-2016 Intel Corporation All Rights Reserved
+**
+** Licensed under the Apache License, Version 2.0 (the "License"); you may not
+** use this file except in compliance with the License.
+**
+** You may obtain a copy of the License at
+**     http://www.apache.org/licenses/LICENSE-2.0
+**
+** Unless required by applicable law or agreed to in writing, software
+** distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+** WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+**
+** See the License for the specific language governing permissions and
+** limitations under the License.
+**
+******************************************************************************/
+
+#pragma once
+
+#include "Dptf.h"
+#include "DptfManagerInterface.h"
+#include <ostream>
+
+//
+// Floods the immediate work item queue with a mix of interrupt storm style events and reports the enqueue,
+// dequeue and removeIfMatches latency of the current queue and of the previous list based queue.
+//
+
+void runImmediateWorkItemQueueBenchmark(DptfManagerInterface* dptfManager, UInt64 eventCount, std::ostream& output);
\ No newline at end of file
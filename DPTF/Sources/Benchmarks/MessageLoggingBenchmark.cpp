@@ -0,0 +1,198 @@
+/******************************************************************************
+** Copyright (c) 2013-2016 Intel Corporation All Rights Reserved
+**
+** Licensed under the Apache License, Version 2.0 (the "License"); you may not
+** use this file except in compliance with the License.
+**
+** You may obtain a copy of the License at
+**     http://www.apache.org/licenses/LICENSE-2.0
+**
+** Unless required by applicable law or agreed to in writing, software
+** distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+** WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+**
+** See the License for the specific language governing permissions and
+** limitations under the License.
+**
+******************************************************************************/
+
+#include "MessageLoggingBenchmark.h"
+#include "BenchmarkStatistics.h"
+#include "MessageLoggingInterface.h"
+#include "ManagerMessage.h"
+#include "PolicyMessage.h"
+#include <sstream>
+
+static const UIntN BenchmarkTargetIndex = 3;
+static const UIntN BenchmarkSourceCount = 4;
+
+// Release builds compile the gated debug messages out, so that row does not time debug logging at all
+#ifdef DPTF_DISABLE_DEBUG_MESSAGES
+static const std::string GatedDebugVariantName = "gated_debug_compiled_out";
+#else
+static const std::string GatedDebugVariantName = "gated";
+#endif
+
+//
+// Logger that behaves like PolicyServicesMessageLogging on top of EsifServices.  The message is wrapped in a
+// ManagerMessage before the verbosity is checked, and formatted to a string only if it is written.  The
+// benchmark messages do not carry participant or domain indexes since there is no participant manager to
+// look their names up in.
+//
+
+class BenchmarkMessageLogger : public MessageLoggingInterface
+{
+public:
+
+    BenchmarkMessageLogger(DptfManagerInterface* dptfManager, eLogType currentLogVerbosityLevel) :
+        m_dptfManager(dptfManager),
+        m_currentLogVerbosityLevel(currentLogVerbosityLevel),
+        m_bytesWritten(0)
+    {
+    }
+
+    virtual Bool isMessageLoggingEnabled(eLogType messageLevel) const override final
+    {
+        return (messageLevel <= m_currentLogVerbosityLevel);
+    }
+
+    virtual void writeMessageFatal(const DptfMessage& message) override final
+    {
+        writeMessage(eLogType::eLogTypeFatal, message);
+    }
+
+    virtual void writeMessageError(const DptfMessage& message) override final
+    {
+        writeMessage(eLogType::eLogTypeError, message);
+    }
+
+    virtual void writeMessageWarning(const DptfMessage& message) override final
+    {
+        writeMessage(eLogType::eLogTypeWarning, message);
+    }
+
+    virtual void writeMessageInfo(const DptfMessage& message) override final
+    {
+        writeMessage(eLogType::eLogTypeInfo, message);
+    }
+
+    virtual void writeMessageDebug(const DptfMessage& message) override final
+    {
+        writeMessage(eLogType::eLogTypeDebug, message);
+    }
+
+    UInt64 getBytesWritten(void) const
+    {
+        return m_bytesWritten;
+    }
+
+private:
+
+    DptfManagerInterface* m_dptfManager;
+    eLogType m_currentLogVerbosityLevel;
+    UInt64 m_bytesWritten;
+
+    void writeMessage(eLogType messageLevel, const DptfMessage& message)
+    {
+        ManagerMessage updatedMessage = ManagerMessage(m_dptfManager, message);
+        if (messageLevel <= m_currentLogVerbosityLevel)
+        {
+            std::string outputMessage = updatedMessage;
+            m_bytesWritten += outputMessage.length();
+        }
+    }
+};
+
+//
+// Work item body modeled on TargetLimitAction::execute.  Every message is built before the call, as the
+// policies did before the DPTF_LOG_MESSAGE macros were added.
+//
+
+static UIntN executeLegacyWorkItem(MessageLoggingInterface* logger, UIntN target)
+{
+    logger->writeMessageDebug(PolicyMessage(FLF,
+        "Attempting to limit target participant " + StlOverride::to_string(target) + "."));
+
+    UIntN limitedSources = 0;
+    for (UIntN source = 0; source < BenchmarkSourceCount; source++)
+    {
+        logger->writeMessageDebug(PolicyMessage(FLF,
+            "Attempting to limit source " + StlOverride::to_string(source) + " for target " +
+            StlOverride::to_string(target) + "."));
+
+        std::stringstream message;
+        message << "Requesting to limit performance controls to " << (source + target) << ".";
+        logger->writeMessageDebug(PolicyMessage(FLF, message.str()));
+        limitedSources++;
+    }
+
+    logger->writeMessageInfo(PolicyMessage(FLF,
+        "Limited " + StlOverride::to_string(limitedSources) + " sources for target " + StlOverride::to_string(target) + "."));
+    return limitedSources;
+}
+
+//
+// The same work item body using the level-gated logging macros.
+//
+
+static UIntN executeGatedWorkItem(MessageLoggingInterface* logger, UIntN target)
+{
+    DPTF_LOG_MESSAGE_DEBUG(logger, PolicyMessage(FLF,
+        "Attempting to limit target participant " + StlOverride::to_string(target) + "."));
+
+    UIntN limitedSources = 0;
+    for (UIntN source = 0; source < BenchmarkSourceCount; source++)
+    {
+        DPTF_LOG_MESSAGE_DEBUG(logger, PolicyMessage(FLF,
+            "Attempting to limit source " + StlOverride::to_string(source) + " for target " +
+            StlOverride::to_string(target) + "."));
+
+        if (DPTF_IS_DEBUG_LOGGING_ENABLED(logger))
+        {
+            std::stringstream message;
+            message << "Requesting to limit performance controls to " << (source + target) << ".";
+            logger->writeMessageDebug(PolicyMessage(FLF, message.str()));
+        }
+        limitedSources++;
+    }
+
+    DPTF_LOG_MESSAGE_INFO(logger, PolicyMessage(FLF,
+        "Limited " + StlOverride::to_string(limitedSources) + " sources for target " + StlOverride::to_string(target) + "."));
+    return limitedSources;
+}
+
+static void runWorkItemBenchmark(DptfManagerInterface* dptfManager, UInt64 workItemCount,
+    UIntN (*executeWorkItem)(MessageLoggingInterface*, UIntN), const std::string& variantName,
+    eLogType currentLogVerbosityLevel, const std::string& operationName, std::ostream& output)
+{
+    BenchmarkMessageLogger logger(dptfManager, currentLogVerbosityLevel);
+    BenchmarkStatistics statistics("message_logging", variantName, operationName);
+    statistics.reserve(workItemCount);
+
+    UInt64 limitedSources = 0;
+    for (UInt64 workItemNumber = 0; workItemNumber < workItemCount; workItemNumber++)
+    {
+        UInt64 startTime = BenchmarkStatistics::getThreadCpuTimeNanoseconds();
+        limitedSources += executeWorkItem(&logger, BenchmarkTargetIndex);
+        statistics.addSample(BenchmarkStatistics::getThreadCpuTimeNanoseconds() - startTime);
+    }
+
+    if (limitedSources != (workItemCount * BenchmarkSourceCount))
+    {
+        throw dptf_exception("Message logging benchmark work item did not run to completion.");
+    }
+
+    output << statistics.toCsv() << std::endl;
+}
+
+void runMessageLoggingBenchmark(DptfManagerInterface* dptfManager, UInt64 workItemCount, std::ostream& output)
+{
+    runWorkItemBenchmark(dptfManager, workItemCount, executeLegacyWorkItem, "legacy",
+        eLogType::eLogTypeInfo, "work_item_cpu_at_info", output);
+    runWorkItemBenchmark(dptfManager, workItemCount, executeGatedWorkItem, "gated",
+        eLogType::eLogTypeInfo, "work_item_cpu_at_info", output);
+    runWorkItemBenchmark(dptfManager, workItemCount, executeLegacyWorkItem, "legacy",
+        eLogType::eLogTypeDebug, "work_item_cpu_at_debug", output);
+    runWorkItemBenchmark(dptfManager, workItemCount, executeGatedWorkItem, GatedDebugVariantName,
+        eLogType::eLogTypeDebug, "work_item_cpu_at_debug", output);
+}
\ No newline at end of file
@@ -0,0 +1,31 @@
+/******************************************************************************
+** Copyright (c) 2013-2016 Intel Corporation All Rights Reserved
+**
+** Licensed under the Apache License, Version 2.0 (the "License"); you may not
+** use this file except in compliance with the License.
+**
+** You may obtain a copy of the License at
+**     http://www.apache.org/licenses/LICENSE-2.0
+**
+** Unless required by applicable law or agreed to in writing, software
+** distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+** WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+**
+** See the License for the specific language governing permissions and
+** limitations under the License.
+**
+******************************************************************************/
+
+#pragma once
+
+#include "Dptf.h"
+#include "DptfManagerInterface.h"
+#include <ostream>
+
+//
+// Runs a work item that writes the same debug and info messages as a passive policy target limit action and
+// reports the thread CPU time spent per work item with the log verbosity at Info and at Debug.  The legacy
+// variant builds every message before the verbosity check; the gated variant uses the DPTF_LOG_MESSAGE macros.
+//
+
+void runMessageLoggingBenchmark(DptfManagerInterface* dptfManager, UInt64 workItemCount, std::ostream& output);
\ No newline at end of file
@@ -0,0 +1,382 @@
+/******************************************************************************
+** Copyright (c) 2013-2016 Intel Corporation All Rights Reserved
+**
+** Licensed under the Apache License, Version 2.0 (the "License"); you may not
+** use this file except in compliance with the License.
+**
+** You may obtain a copy of the License at
+**     http://www.apache.org/licenses/LICENSE-2.0
+**
+** Unless required by applicable law or agreed to in writing, software
+** distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+** WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+**
+** See the License for the specific language governing permissions and
+** limitations under the License.
+**
+******************************************************************************/
+
+#include "PlatformBenchmark.h"
+#include "PlatformBenchmarkDptfManager.h"
+#include "SyntheticEsifAppServices.h"
+#include "BenchmarkStatistics.h"
+#include "WorkItemQueueManagerInterface.h"
+#include "PolicyManagerInterface.h"
+#include "DomainWorkItem.h"
+#include "WIDomainTemperatureThresholdCrossed.h"
+#include "EsifMutexHelper.h"
+#include "ActivePolicy.h"
+#include "PassivePolicy.h"
+#include <algorithm>
+
+static const UInt64 EventsPerIteration = 100;
+static const UInt64 MinimumIterationCount = 10;
+static const UInt32 StatusGroupPolicies = 0;
+static const UInt32 StatusGroupParticipants = 1;
+static const UInt32 InitialStatusBufferSize = 64 * 1024;
+
+//
+// Work item timestamps are recorded on the work item threads and read by the benchmark after a fence
+//
+
+class WorkItemTimestamps
+{
+public:
+
+    void add(UInt64 latency, UInt64 executionTime)
+    {
+        EsifMutexHelper esifMutexHelper(&m_mutex);
+        esifMutexHelper.lock();
+        m_latencies.push_back(latency);
+        m_executionTimes.push_back(executionTime);
+        esifMutexHelper.unlock();
+    }
+
+    std::vector<UInt64> getLatencies(void)
+    {
+        EsifMutexHelper esifMutexHelper(&m_mutex);
+        esifMutexHelper.lock();
+        std::vector<UInt64> latencies = m_latencies;
+        esifMutexHelper.unlock();
+        return latencies;
+    }
+
+    std::vector<UInt64> getExecutionTimes(void)
+    {
+        EsifMutexHelper esifMutexHelper(&m_mutex);
+        esifMutexHelper.lock();
+        std::vector<UInt64> executionTimes = m_executionTimes;
+        esifMutexHelper.unlock();
+        return executionTimes;
+    }
+
+private:
+
+    EsifMutex m_mutex;
+    std::vector<UInt64> m_latencies;
+    std::vector<UInt64> m_executionTimes;
+};
+
+//
+// Domain work item that only records when it was created and when it started executing.  It uses an event type
+// no policy in the benchmark handles so it goes through the participant lanes like any other domain event.
+//
+
+class TimestampWorkItem : public DomainWorkItem
+{
+public:
+
+    TimestampWorkItem(DptfManagerInterface* dptfManager, UIntN participantIndex, WorkItemTimestamps* timestamps) :
+        DomainWorkItem(dptfManager, FrameworkEvent::DomainRadioConnectionStatusChanged, participantIndex, 0),
+        m_creationTime(BenchmarkStatistics::getTimestampNanoseconds()), m_timestamps(timestamps)
+    {
+    }
+
+    virtual void execute(void) override final
+    {
+        UInt64 executionTime = BenchmarkStatistics::getTimestampNanoseconds();
+        if (m_timestamps != nullptr)
+        {
+            m_timestamps->add(executionTime - m_creationTime, executionTime);
+        }
+    }
+
+private:
+
+    UInt64 m_creationTime;
+    WorkItemTimestamps* m_timestamps;
+};
+
+//
+// Exclusive work item with the lowest priority, so it starts after every work item enqueued before it has
+// completed.  It uses the status event type so it does not make cached status documents stale.
+//
+
+class FenceWorkItem : public WorkItem
+{
+public:
+
+    FenceWorkItem(DptfManagerInterface* dptfManager) :
+        WorkItem(dptfManager, FrameworkEvent::DptfGetStatus)
+    {
+    }
+
+    virtual void execute(void) override final
+    {
+    }
+};
+
+static void destroyBenchmarkPolicy(PolicyInterface* policyInterface)
+{
+    DELETE_MEMORY_TC(policyInterface);
+}
+
+static std::string toString(eEsifError rc)
+{
+    return esif_rc_str(rc);
+}
+
+static const void* getAppHandle(PlatformBenchmarkDptfManager* dptfManager)
+{
+    // The application interface casts the handle back to DptfManagerInterface
+    return static_cast<DptfManagerInterface*>(dptfManager);
+}
+
+static void createPolicies(PlatformBenchmarkDptfManager* dptfManager)
+{
+    // The supported policy list is read when DPTF starts, so both policies are constructed before that
+    PolicyInterface* activePolicy = new ActivePolicy();
+    PolicyInterface* passivePolicy = new PassivePolicy();
+    std::vector<Guid> policyGuids;
+    policyGuids.push_back(activePolicy->getGuid());
+    policyGuids.push_back(passivePolicy->getGuid());
+    dptfManager->getSyntheticServices()->setSupportedPolicies(policyGuids);
+
+    dptfManager->createDptfManager(nullptr, nullptr, "", eLogType::eLogTypeFatal, true);
+    dptfManager->createPolicy("active", activePolicy, destroyBenchmarkPolicy);
+    dptfManager->createPolicy("passive", passivePolicy, destroyBenchmarkPolicy);
+
+    if (dptfManager->getPolicyManager()->getPolicyListCount() != policyGuids.size())
+    {
+        throw dptf_exception("Platform benchmark was not able to create the active and passive policies.");
+    }
+}
+
+static void createParticipants(PlatformBenchmarkDptfManager* dptfManager, AppInterface& appInterface)
+{
+    SyntheticEsifAppServices* syntheticServices = dptfManager->getSyntheticServices();
+    for (UIntN participantNumber = 0; participantNumber < syntheticServices->getParticipantCount(); participantNumber++)
+    {
+        void* participantHandle = nullptr;
+        eEsifError rc = appInterface.fParticipantAllocateHandleFuncPtr(getAppHandle(dptfManager), &participantHandle);
+        if (rc != ESIF_OK)
+        {
+            throw dptf_exception("Failed to allocate participant handle: " + toString(rc));
+        }
+
+        UIntN participantIndex = dptfManager->getIndexContainer()->getIndex((IndexStructPtr)participantHandle);
+        if (participantIndex != participantNumber)
+        {
+            throw dptf_exception("Participant " + StlOverride::to_string(participantNumber) +
+                " was created at index " + StlOverride::to_string(participantIndex) + ".");
+        }
+
+        AppParticipantData participantData = syntheticServices->getParticipantData(participantIndex);
+        rc = appInterface.fParticipantCreateFuncPtr(getAppHandle(dptfManager), participantHandle, &participantData,
+            eParticipantStateEnabled);
+        if (rc != ESIF_OK)
+        {
+            throw dptf_exception("Failed to create participant: " + toString(rc));
+        }
+
+        void* domainHandle = nullptr;
+        rc = appInterface.fDomainAllocateHandleFuncPtr(getAppHandle(dptfManager), participantHandle, &domainHandle);
+        if (rc != ESIF_OK)
+        {
+            throw dptf_exception("Failed to allocate domain handle: " + toString(rc));
+        }
+
+        AppDomainData domainData = syntheticServices->getDomainData(participantIndex);
+        rc = appInterface.fDomainCreateFuncPtr(getAppHandle(dptfManager), participantHandle, domainHandle,
+            &domainData, eDomainStateEnabled);
+        if (rc != ESIF_OK)
+        {
+            throw dptf_exception("Failed to create domain: " + toString(rc));
+        }
+    }
+}
+
+static void runPacedWorkItemBenchmark(PlatformBenchmarkDptfManager* dptfManager, UInt64 iterationCount,
+    const std::string& variantName, std::ostream& output)
+{
+    BenchmarkStatistics statistics("platform", "paced_" + variantName, "enqueue_to_execute");
+    statistics.reserve(iterationCount);
+
+    WorkItemTimestamps timestamps;
+    UIntN participantCount = dptfManager->getSyntheticServices()->getParticipantCount();
+    for (UInt64 iteration = 0; iteration < iterationCount; iteration++)
+    {
+        dptfManager->getWorkItemQueueManager()->enqueueImmediateWorkItemAndWait(
+            new TimestampWorkItem(dptfManager, iteration % participantCount, &timestamps));
+    }
+
+    std::vector<UInt64> latencies = timestamps.getLatencies();
+    for (auto latency = latencies.begin(); latency != latencies.end(); ++latency)
+    {
+        statistics.addSample(*latency);
+    }
+
+    output << statistics.toCsv() << std::endl;
+}
+
+static void runBurstWorkItemBenchmark(PlatformBenchmarkDptfManager* dptfManager, UInt64 iterationCount,
+    const std::string& variantName, std::ostream& output)
+{
+    BenchmarkStatistics latencyStatistics("platform", "burst_" + variantName, "enqueue_to_execute");
+    BenchmarkStatistics intervalStatistics("platform", "burst_" + variantName, "burst_execute_interval");
+    latencyStatistics.reserve(iterationCount);
+    intervalStatistics.reserve(iterationCount);
+
+    WorkItemTimestamps timestamps;
+    UIntN participantCount = dptfManager->getSyntheticServices()->getParticipantCount();
+    for (UInt64 iteration = 0; iteration < iterationCount; iteration++)
+    {
+        dptfManager->getWorkItemQueueManager()->enqueueImmediateWorkItemAndReturn(
+            new TimestampWorkItem(dptfManager, iteration % participantCount, &timestamps));
+    }
+    dptfManager->getWorkItemQueueManager()->enqueueImmediateWorkItemAndWait(new FenceWorkItem(dptfManager));
+
+    std::vector<UInt64> latencies = timestamps.getLatencies();
+    if (latencies.size() != iterationCount)
+    {
+        throw dptf_exception("Platform benchmark burst work items did not all execute.");
+    }
+    for (auto latency = latencies.begin(); latency != latencies.end(); ++latency)
+    {
+        latencyStatistics.addSample(*latency);
+    }
+
+    // Work items in different participant lanes may start out of order on different workers
+    std::vector<UInt64> executionTimes = timestamps.getExecutionTimes();
+    std::sort(executionTimes.begin(), executionTimes.end());
+    for (size_t executionNumber = 1; executionNumber < executionTimes.size(); executionNumber++)
+    {
+        intervalStatistics.addSample(executionTimes[executionNumber] - executionTimes[executionNumber - 1]);
+    }
+
+    output << latencyStatistics.toCsv() << std::endl;
+    output << intervalStatistics.toCsv() << std::endl;
+}
+
+static void runThresholdCrossedBenchmark(PlatformBenchmarkDptfManager* dptfManager, UInt64 iterationCount,
+    const std::string& variantName, std::ostream& output)
+{
+    BenchmarkStatistics statistics("platform", variantName, "temperature_threshold_crossed");
+    statistics.reserve(iterationCount);
+
+    SyntheticEsifAppServices* syntheticServices = dptfManager->getSyntheticServices();
+    UIntN participantCount = syntheticServices->getParticipantCount();
+    UInt32 passiveTripPoint = syntheticServices->getPassiveTripPoint();
+    Temperature hotTemperature = Temperature(passiveTripPoint + 50);
+    Temperature coolTemperature = Temperature(passiveTripPoint - 50);
+    for (UInt64 iteration = 0; iteration < iterationCount; iteration++)
+    {
+        UIntN participantIndex = iteration % participantCount;
+        Bool hot = ((iteration / participantCount) % 2) == 0;
+        syntheticServices->setTemperature(participantIndex, hot ? hotTemperature : coolTemperature);
+
+        UInt64 startTime = BenchmarkStatistics::getTimestampNanoseconds();
+        dptfManager->getWorkItemQueueManager()->enqueueImmediateWorkItemAndWait(
+            new WIDomainTemperatureThresholdCrossed(dptfManager, participantIndex, 0));
+        statistics.addSample(BenchmarkStatistics::getTimestampNanoseconds() - startTime);
+    }
+
+    output << statistics.toCsv() << std::endl;
+}
+
+static UInt64 getModuleStatus(PlatformBenchmarkDptfManager* dptfManager, AppInterface& appInterface, UInt32 groupId,
+    UInt32 moduleId, std::vector<char>& buffer)
+{
+    EsifData statusOut = {ESIF_DATA_XML, &buffer[0], (UInt32)buffer.size(), 0};
+    UInt32 appStatusIn = (groupId << 16) | moduleId;
+
+    UInt64 startTime = BenchmarkStatistics::getTimestampNanoseconds();
+    eEsifError rc = appInterface.fAppGetStatusFuncPtr(getAppHandle(dptfManager), eAppStatusCommandGetModuleData,
+        appStatusIn, &statusOut);
+    UInt64 elapsedTime = BenchmarkStatistics::getTimestampNanoseconds() - startTime;
+
+    if ((rc == ESIF_E_NEED_LARGER_BUFFER) && (statusOut.data_len > buffer.size()))
+    {
+        // Grow once and measure again so every sample is a complete request
+        buffer.resize(statusOut.data_len);
+        return getModuleStatus(dptfManager, appInterface, groupId, moduleId, buffer);
+    }
+    else if (rc != ESIF_OK)
+    {
+        throw dptf_exception("Failed to get module status: " + toString(rc));
+    }
+
+    return elapsedTime;
+}
+
+static void runStatusBenchmark(PlatformBenchmarkDptfManager* dptfManager, AppInterface& appInterface,
+    UInt64 iterationCount, UInt32 groupId, UIntN moduleCount, Bool cached, const std::string& variantName,
+    std::ostream& output)
+{
+    std::string operationName = (groupId == StatusGroupPolicies) ? "policy_status" : "participant_status";
+    BenchmarkStatistics statistics("platform", (cached ? "cached_" : "uncached_") + variantName, operationName);
+    statistics.reserve(iterationCount);
+
+    // The cached variant builds every document once first so the samples show requests served from the cache
+    std::vector<char> buffer(InitialStatusBufferSize);
+    for (UIntN moduleId = 0; (cached == true) && (moduleId < moduleCount); moduleId++)
+    {
+        getModuleStatus(dptfManager, appInterface, groupId, moduleId, buffer);
+    }
+
+    for (UInt64 iteration = 0; iteration < iterationCount; iteration++)
+    {
+        UInt32 moduleId = static_cast<UInt32>(iteration % moduleCount);
+        if (cached == false)
+        {
+            UIntN participantIndex = moduleId % dptfManager->getSyntheticServices()->getParticipantCount();
+            dptfManager->getWorkItemQueueManager()->enqueueImmediateWorkItemAndWait(
+                new TimestampWorkItem(dptfManager, participantIndex, nullptr));
+        }
+        statistics.addSample(getModuleStatus(dptfManager, appInterface, groupId, moduleId, buffer));
+    }
+
+    output << statistics.toCsv() << std::endl;
+}
+
+void runPlatformBenchmark(UInt64 eventCount, UIntN participantCount, UIntN relationshipTableEntryCount,
+    std::ostream& output)
+{
+    std::string variantName = "participants_" + StlOverride::to_string(participantCount) + "_entries_" +
+        StlOverride::to_string(relationshipTableEntryCount);
+    UInt64 iterationCount = std::max(eventCount / EventsPerIteration, MinimumIterationCount);
+
+    AppInterface appInterface;
+    GetApplicationInterface(&appInterface);
+
+    PlatformBenchmarkDptfManager dptfManager(participantCount, relationshipTableEntryCount,
+        relationshipTableEntryCount);
+    createPolicies(&dptfManager);
+    createParticipants(&dptfManager, appInterface);
+
+    runPacedWorkItemBenchmark(&dptfManager, iterationCount, variantName, output);
+    runBurstWorkItemBenchmark(&dptfManager, iterationCount, variantName, output);
+    runThresholdCrossedBenchmark(&dptfManager, iterationCount, variantName, output);
+
+    UIntN policyCount = dptfManager.getPolicyManager()->getPolicyListCount();
+    runStatusBenchmark(&dptfManager, appInterface, iterationCount, StatusGroupPolicies, policyCount, true,
+        variantName, output);
+    runStatusBenchmark(&dptfManager, appInterface, iterationCount, StatusGroupPolicies, policyCount, false,
+        variantName, output);
+    runStatusBenchmark(&dptfManager, appInterface, iterationCount, StatusGroupParticipants, participantCount, true,
+        variantName, output);
+    runStatusBenchmark(&dptfManager, appInterface, iterationCount, StatusGroupParticipants, participantCount, false,
+        variantName, output);
+
+    dptfManager.shutDown();
+}
\ No newline at end of file
@@ -0,0 +1,40 @@
+/******************************************************************************
+** Copyright (c) 2013-2016 Intel Corporation All Rights Reserved
+**
+** Licensed under the Apache License, Version 2.0 (the "License"); you may not
+** use this file except in compliance with the License.
+**
+** You may obtain a copy of the License at
+**     http://www.apache.org/licenses/LICENSE-2.0
+**
+** Unless required by applicable law or agreed to in writing, software
+** distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+** WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+**
+** See the License for the specific language governing permissions and
+** limitations under the License.
+**
+******************************************************************************/
+
+#pragma once
+
+#include "Dptf.h"
+#include <ostream>
+
+//
+// Starts the real manager, work item queue, active policy and passive policy on a synthetic platform of
+// temperature sensors tied together by a TRT and an ART, then reports:
+//
+//   * enqueue_to_execute: time from creating a domain work item until it starts executing.  The paced variant
+//     waits for each work item; the burst variant enqueues them all at once.
+//   * burst_execute_interval: time between work items starting during a burst, the inverse of throughput.
+//   * temperature_threshold_crossed: time to handle a threshold crossed event in every policy, with the
+//     temperature moving back and forth across the passive trip point.
+//   * policy_status and participant_status: time for a module status request through the application interface.
+//     The uncached variant runs a work item before each request so the cached document is stale.
+//
+// Variants are suffixed with the participant and relationship table entry counts so scaling is visible.
+//
+
+void runPlatformBenchmark(UInt64 eventCount, UIntN participantCount, UIntN relationshipTableEntryCount,
+    std::ostream& output);
\ No newline at end of file
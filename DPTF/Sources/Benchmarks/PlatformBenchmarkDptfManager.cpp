@@ -0,0 +1,222 @@
+/******************************************************************************
+** Copyright (c) 2013-2016 Intel Corporation All Rights Reserved
+**
+** Licensed under the Apache License, Version 2.0 (the "License"); you may not
+** use this file except in compliance with the License.
+**
+** You may obtain a copy of the License at
+**     http://www.apache.org/licenses/LICENSE-2.0
+**
+** Unless required by applicable law or agreed to in writing, software
+** distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+** WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+**
+** See the License for the specific language governing permissions and
+** limitations under the License.
+**
+******************************************************************************/
+
+#include "PlatformBenchmarkDptfManager.h"
+#include "SyntheticEsifAppServices.h"
+#include "WorkItemQueueManager.h"
+#include "WorkItem.h"
+#include "EsifServices.h"
+#include "PolicyManager.h"
+#include "ParticipantManager.h"
+#include "DptfStatus.h"
+#include "IndexContainer.h"
+
+//
+// Creates a linked in policy on the work item thread.  Any failure is kept so the caller can rethrow it after
+// the work item has completed.
+//
+
+class BenchmarkPolicyCreate : public WorkItem
+{
+public:
+
+    BenchmarkPolicyCreate(DptfManagerInterface* dptfManager, PolicyManager* policyManager,
+        const std::string& policyName, PolicyInterface* policyInstance,
+        DestroyPolicyInstanceFuncPtr destroyPolicyInstanceFuncPtr, std::string* errorMessage) :
+        WorkItem(dptfManager, FrameworkEvent::PolicyCreate), m_policyManager(policyManager),
+        m_policyName(policyName), m_policyInstance(policyInstance),
+        m_destroyPolicyInstanceFuncPtr(destroyPolicyInstanceFuncPtr), m_errorMessage(errorMessage)
+    {
+    }
+
+    virtual void execute(void) override final
+    {
+        try
+        {
+            m_policyManager->createPolicy(m_policyName, m_policyInstance, m_destroyPolicyInstanceFuncPtr);
+        }
+        catch (std::exception& ex)
+        {
+            *m_errorMessage = ex.what();
+        }
+    }
+
+private:
+
+    PolicyManager* m_policyManager;
+    std::string m_policyName;
+    PolicyInterface* m_policyInstance;
+    DestroyPolicyInstanceFuncPtr m_destroyPolicyInstanceFuncPtr;
+    std::string* m_errorMessage;
+};
+
+PlatformBenchmarkDptfManager::PlatformBenchmarkDptfManager(UIntN participantCount, UIntN trtEntryCount,
+    UIntN artEntryCount) :
+    m_dptfManagerCreateFinished(false), m_dptfShuttingDown(false), m_indexContainer(nullptr),
+    m_syntheticServices(nullptr), m_esifServices(nullptr), m_participantManager(nullptr), m_policyManager(nullptr),
+    m_workItemQueueManager(nullptr), m_dptfStatus(nullptr)
+{
+    m_eventCache = std::make_shared<EventCache>();
+    m_userPreferredCache = std::make_shared<UserPreferredCache>();
+    m_indexContainer = new IndexContainer(Constants::Participants::MaxParticipantEstimate);
+    m_syntheticServices = new SyntheticEsifAppServices(m_indexContainer, participantCount, trtEntryCount,
+        artEntryCount);
+}
+
+PlatformBenchmarkDptfManager::~PlatformBenchmarkDptfManager(void)
+{
+    shutDown();
+}
+
+void PlatformBenchmarkDptfManager::createDptfManager(const void* esifHandle, EsifInterfacePtr esifInterfacePtr,
+    const std::string& dptfHomeDirectoryPath, eLogType currentLogVerbosityLevel, Bool dptfEnabled)
+{
+    m_dptfHomeDirectoryPath = dptfHomeDirectoryPath;
+    m_esifServices = new EsifServices(this, nullptr, m_syntheticServices, currentLogVerbosityLevel);
+    m_participantManager = new ParticipantManager(this);
+    m_policyManager = new PolicyManager(this);
+
+    // Make sure to create these AFTER creating the ParticipantManager and PolicyManager
+    m_workItemQueueManager = new WorkItemQueueManager(this);
+
+    m_dptfStatus = new DptfStatus(this);
+    m_dptfManagerCreateFinished = true;
+}
+
+Bool PlatformBenchmarkDptfManager::isDptfManagerCreated(void) const
+{
+    return m_dptfManagerCreateFinished;
+}
+
+Bool PlatformBenchmarkDptfManager::isDptfShuttingDown(void) const
+{
+    return m_dptfShuttingDown;
+}
+
+Bool PlatformBenchmarkDptfManager::isWorkItemQueueManagerCreated(void) const
+{
+    return (m_workItemQueueManager != nullptr);
+}
+
+EsifServicesInterface* PlatformBenchmarkDptfManager::getEsifServices(void) const
+{
+    return m_esifServices;
+}
+
+std::shared_ptr<EventCache> PlatformBenchmarkDptfManager::getEventCache(void) const
+{
+    return m_eventCache;
+}
+
+std::shared_ptr<UserPreferredCache> PlatformBenchmarkDptfManager::getUserPreferredCache(void) const
+{
+    return m_userPreferredCache;
+}
+
+WorkItemQueueManagerInterface* PlatformBenchmarkDptfManager::getWorkItemQueueManager(void) const
+{
+    return m_workItemQueueManager;
+}
+
+PolicyManagerInterface* PlatformBenchmarkDptfManager::getPolicyManager(void) const
+{
+    return m_policyManager;
+}
+
+ParticipantManagerInterface* PlatformBenchmarkDptfManager::getParticipantManager(void) const
+{
+    return m_participantManager;
+}
+
+DptfStatusInterface* PlatformBenchmarkDptfManager::getDptfStatus(void)
+{
+    return m_dptfStatus;
+}
+
+IndexContainerInterface* PlatformBenchmarkDptfManager::getIndexContainer(void) const
+{
+    return m_indexContainer;
+}
+
+PlatformTraceWriter* PlatformBenchmarkDptfManager::getPlatformTrace(void) const
+{
+    return nullptr;
+}
+
+std::string PlatformBenchmarkDptfManager::getDptfHomeDirectoryPath(void) const
+{
+    return m_dptfHomeDirectoryPath;
+}
+
+std::string PlatformBenchmarkDptfManager::getDptfPolicyDirectoryPath(void) const
+{
+    return m_dptfHomeDirectoryPath;
+}
+
+Bool PlatformBenchmarkDptfManager::isDptfPolicyLoadNameOnly(void) const
+{
+    return false;
+}
+
+SyntheticEsifAppServices* PlatformBenchmarkDptfManager::getSyntheticServices(void) const
+{
+    return m_syntheticServices;
+}
+
+void PlatformBenchmarkDptfManager::createPolicy(const std::string& policyName, PolicyInterface* policyInstance,
+    DestroyPolicyInstanceFuncPtr destroyPolicyInstanceFuncPtr)
+{
+    std::string errorMessage;
+    m_workItemQueueManager->enqueueImmediateWorkItemAndWait(new BenchmarkPolicyCreate(this, m_policyManager,
+        policyName, policyInstance, destroyPolicyInstanceFuncPtr, &errorMessage));
+
+    if (errorMessage.empty() == false)
+    {
+        throw dptf_exception("Policy " + policyName + " was not created: " + errorMessage);
+    }
+}
+
+void PlatformBenchmarkDptfManager::shutDown(void)
+{
+    if (m_dptfShuttingDown == true)
+    {
+        return;
+    }
+    m_dptfShuttingDown = true;
+
+    // Same order as DptfManager::shutDown.  The singletons are left for the other benchmarks.
+    if (m_workItemQueueManager != nullptr)
+    {
+        m_workItemQueueManager->disableAndEmptyAllQueues();
+    }
+    if (m_policyManager != nullptr)
+    {
+        m_policyManager->destroyAllPolicies();
+    }
+    if (m_participantManager != nullptr)
+    {
+        m_participantManager->destroyAllParticipants();
+    }
+    DELETE_MEMORY_TC(m_workItemQueueManager);
+    DELETE_MEMORY_TC(m_policyManager);
+    DELETE_MEMORY_TC(m_participantManager);
+    DELETE_MEMORY_TC(m_esifServices);
+    DELETE_MEMORY_TC(m_syntheticServices);
+    DELETE_MEMORY_TC(m_indexContainer);
+    DELETE_MEMORY_TC(m_dptfStatus);
+}
\ No newline at end of file
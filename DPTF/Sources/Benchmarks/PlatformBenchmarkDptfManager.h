@@ -0,0 +1,93 @@
+/******************************************************************************
+** Copyright (c) 2013-2016 Intel Corporation All Rights Reserved
+**
+** Licensed under the Apache License, Version 2.0 (the "License"); you may not
+** use this file except in compliance with the License.
+**
+** You may obtain a copy of the License at
+**     http://www.apache.org/licenses/LICENSE-2.0
+**
+** Unless required by applicable law or agreed to in writing, software
+** distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+** WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+**
+** See the License for the specific language governing permissions and
+** limitations under the License.
+**
+******************************************************************************/
+
+#pragma once
+
+#include "Dptf.h"
+#include "DptfManagerBase.h"
+#include "PolicyInterface.h"
+
+class EsifServices;
+class PolicyManager;
+class ParticipantManager;
+class DptfStatus;
+class IndexContainer;
+class WorkItemQueueManager;
+class SyntheticEsifAppServices;
+
+//
+// DptfManagerInterface for the platform benchmark.  Uses the real managers and work item queue on top of
+// SyntheticEsifAppServices, so work items run on the real work item thread.  Policies are linked in and created by
+// the benchmark instead of being loaded from the policy directory.
+//
+
+class PlatformBenchmarkDptfManager : public DptfManagerBase
+{
+public:
+
+    PlatformBenchmarkDptfManager(UIntN participantCount, UIntN trtEntryCount, UIntN artEntryCount);
+    virtual ~PlatformBenchmarkDptfManager(void);
+
+    // The ESIF handle and interface are ignored.  ESIF is replaced by getSyntheticServices().
+    virtual void createDptfManager(const void* esifHandle, EsifInterfacePtr esifInterfacePtr,
+        const std::string& dptfHomeDirectoryPath, eLogType currentLogVerbosityLevel, Bool dptfEnabled) override;
+    virtual Bool isDptfManagerCreated(void) const override;
+    virtual Bool isDptfShuttingDown(void) const override;
+    virtual Bool isWorkItemQueueManagerCreated(void) const override;
+    virtual EsifServicesInterface* getEsifServices(void) const override;
+    virtual std::shared_ptr<EventCache> getEventCache(void) const override;
+    virtual std::shared_ptr<UserPreferredCache> getUserPreferredCache(void) const override;
+    virtual WorkItemQueueManagerInterface* getWorkItemQueueManager(void) const override;
+    virtual PolicyManagerInterface* getPolicyManager(void) const override;
+    virtual ParticipantManagerInterface* getParticipantManager(void) const override;
+    virtual DptfStatusInterface* getDptfStatus(void) override;
+    virtual IndexContainerInterface* getIndexContainer(void) const override;
+    virtual PlatformTraceWriter* getPlatformTrace(void) const override;
+    virtual std::string getDptfHomeDirectoryPath(void) const override;
+    virtual std::string getDptfPolicyDirectoryPath(void) const override;
+    virtual Bool isDptfPolicyLoadNameOnly(void) const override;
+
+    // Available as soon as the manager is constructed so the supported policies can be set before DPTF starts
+    SyntheticEsifAppServices* getSyntheticServices(void) const;
+
+    // Policies may only be created on the work item thread, so this waits for a work item that creates it
+    void createPolicy(const std::string& policyName, PolicyInterface* policyInstance,
+        DestroyPolicyInstanceFuncPtr destroyPolicyInstanceFuncPtr);
+
+    void shutDown(void);
+
+private:
+
+    // hide the copy constructor and assignment operator.
+    PlatformBenchmarkDptfManager(const PlatformBenchmarkDptfManager& rhs);
+    PlatformBenchmarkDptfManager& operator=(const PlatformBenchmarkDptfManager& rhs);
+
+    Bool m_dptfManagerCreateFinished;
+    Bool m_dptfShuttingDown;
+    std::string m_dptfHomeDirectoryPath;
+
+    std::shared_ptr<EventCache> m_eventCache;
+    std::shared_ptr<UserPreferredCache> m_userPreferredCache;
+    IndexContainer* m_indexContainer;
+    SyntheticEsifAppServices* m_syntheticServices;
+    EsifServices* m_esifServices;
+    ParticipantManager* m_participantManager;
+    PolicyManager* m_policyManager;
+    WorkItemQueueManager* m_workItemQueueManager;
+    DptfStatus* m_dptfStatus;
+};
\ No newline at end of file
@@ -0,0 +1,182 @@
+/******************************************************************************
+** Copyright (c) 2013-2016 Intel Corporation All Rights Reserved
+**
+** Licensed under the Apache License, Version 2.0 (the "License"); you may not
+** use this file except in compliance with the License.
+**
+** You may obtain a copy of the License at
+**     http://www.apache.org/licenses/LICENSE-2.0
+**
+** Unless required by applicable law or agreed to in writing, software
+** distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+** WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+**
+** See the License for the specific language governing permissions and
+** limitations under the License.
+**
+******************************************************************************/
+
+#include "RelationshipTableBenchmark.h"
+#include "BenchmarkStatistics.h"
+#include "ThermalRelationshipTable.h"
+#include <algorithm>
+
+static const UIntN BenchmarkTargetCount = 16;
+static const UIntN BenchmarkSourceCount = 16;
+
+typedef std::vector<std::shared_ptr<ThermalRelationshipTableEntry>> TrtEntryList;
+
+static std::string getTargetScope(UIntN target)
+{
+    return "\\_SB_.TZ" + StlOverride::to_string(target);
+}
+
+static std::string getSourceScope(UIntN source)
+{
+    return "\\_SB_.SRC" + StlOverride::to_string(source);
+}
+
+static UIntN getTargetIndex(UIntN target)
+{
+    return target;
+}
+
+static UIntN getSourceIndex(UIntN source)
+{
+    return BenchmarkTargetCount + source;
+}
+
+static TrtEntryList buildEntries(void)
+{
+    TrtEntryList entries;
+    for (UIntN target = 0; target < BenchmarkTargetCount; target++)
+    {
+        for (UIntN source = 0; source < BenchmarkSourceCount; source++)
+        {
+            // A handful of distinct influences so each target has ties at the front and back of its ranking
+            UInt32 influence = ((target * 7 + source * 13) % 5) * 10;
+            entries.push_back(std::make_shared<ThermalRelationshipTableEntry>(
+                getSourceScope(source), getTargetScope(target), influence, TimeSpan::createFromMilliseconds(1000)));
+        }
+    }
+    return entries;
+}
+
+static void associateAllParticipants(ThermalRelationshipTable& trt)
+{
+    for (UIntN target = 0; target < BenchmarkTargetCount; target++)
+    {
+        trt.associateParticipant(getTargetScope(target), getTargetIndex(target));
+    }
+    for (UIntN source = 0; source < BenchmarkSourceCount; source++)
+    {
+        trt.associateParticipant(getSourceScope(source), getSourceIndex(source));
+    }
+}
+
+static Bool compareEntriesOnInfluence(
+    const std::shared_ptr<ThermalRelationshipTableEntry>& left,
+    const std::shared_ptr<ThermalRelationshipTableEntry>& right)
+{
+    return (left->thermalInfluence() > right->thermalInfluence());
+}
+
+static UIntN countHighestInfluenceTies(const TrtEntryList& sortedEntries)
+{
+    UIntN ties = 0;
+    for (auto entry = sortedEntries.begin(); entry != sortedEntries.end(); ++entry)
+    {
+        if ((*entry)->thermalInfluence() != sortedEntries.front()->thermalInfluence())
+        {
+            break;
+        }
+        ties++;
+    }
+    return ties;
+}
+
+static UIntN chooseSourcesWithLinearScan(const TrtEntryList& entries)
+{
+    UIntN sourcesChosen = 0;
+    for (UIntN target = 0; target < BenchmarkTargetCount; target++)
+    {
+        TrtEntryList entriesForTarget;
+        for (auto entry = entries.begin(); entry != entries.end(); ++entry)
+        {
+            if ((*entry)->getTargetDeviceIndex() == getTargetIndex(target))
+            {
+                entriesForTarget.push_back(*entry);
+            }
+        }
+        std::sort(entriesForTarget.begin(), entriesForTarget.end(), compareEntriesOnInfluence);
+        sourcesChosen += countHighestInfluenceTies(entriesForTarget);
+    }
+    return sourcesChosen;
+}
+
+static UIntN chooseSourcesWithIndex(const ThermalRelationshipTable& trt)
+{
+    UIntN sourcesChosen = 0;
+    for (UIntN target = 0; target < BenchmarkTargetCount; target++)
+    {
+        sourcesChosen += countHighestInfluenceTies(trt.getEntriesForTargetSortedByInfluence(getTargetIndex(target)));
+    }
+    return sourcesChosen;
+}
+
+static void runChooseSourcesBenchmark(UInt64 passCount, const std::string& variantName, Bool useIndex,
+    const ThermalRelationshipTable& trt, const TrtEntryList& entries, std::ostream& output)
+{
+    BenchmarkStatistics statistics("relationship_table", variantName, "choose_sources_pass_cpu");
+    statistics.reserve(passCount);
+
+    UInt64 sourcesChosen = 0;
+    for (UInt64 passNumber = 0; passNumber < passCount; passNumber++)
+    {
+        UInt64 startTime = BenchmarkStatistics::getThreadCpuTimeNanoseconds();
+        sourcesChosen += useIndex ? chooseSourcesWithIndex(trt) : chooseSourcesWithLinearScan(entries);
+        statistics.addSample(BenchmarkStatistics::getThreadCpuTimeNanoseconds() - startTime);
+    }
+
+    if (sourcesChosen == 0)
+    {
+        throw dptf_exception("Relationship table benchmark did not choose any sources.");
+    }
+
+    output << statistics.toCsv() << std::endl;
+}
+
+static void runReassociateBenchmark(UInt64 passCount, ThermalRelationshipTable& trt, std::ostream& output)
+{
+    BenchmarkStatistics statistics("relationship_table", "indexed", "reassociate_participant_cpu");
+    statistics.reserve(passCount);
+
+    for (UInt64 passNumber = 0; passNumber < passCount; passNumber++)
+    {
+        UIntN source = passNumber % BenchmarkSourceCount;
+        UInt64 startTime = BenchmarkStatistics::getThreadCpuTimeNanoseconds();
+        trt.disassociateParticipant(getSourceIndex(source));
+        trt.associateParticipant(getSourceScope(source), getSourceIndex(source));
+        statistics.addSample(BenchmarkStatistics::getThreadCpuTimeNanoseconds() - startTime);
+    }
+
+    output << statistics.toCsv() << std::endl;
+}
+
+void runRelationshipTableBenchmark(UInt64 passCount, std::ostream& output)
+{
+    TrtEntryList entries = buildEntries();
+    ThermalRelationshipTable trt(std::vector<std::shared_ptr<RelationshipTableEntryBase>>(
+        entries.begin(), entries.end()));
+    associateAllParticipants(trt);
+
+    // Both variants must pick the same sources or the comparison is meaningless
+    if (chooseSourcesWithLinearScan(entries) != chooseSourcesWithIndex(trt))
+    {
+        throw dptf_exception("Indexed relationship table chose different sources than a linear scan.");
+    }
+
+    runChooseSourcesBenchmark(passCount, "linear_scan", false, trt, entries, output);
+    runChooseSourcesBenchmark(passCount, "indexed", true, trt, entries, output);
+    runReassociateBenchmark(passCount, trt, output);
+}
\ No newline at end of file
@@ -0,0 +1,31 @@
+/******************************************************************************
+** Copyright (c) 2013-2016 Intel Corporation All Rights Reserved
+**
+** Licensed under the Apache License, Version 2.0 (the "License"); you may not
+** use this file except in compliance with the License.
+**
+** You may obtain a copy of the License at
+**     http://www.apache.org/licenses/LICENSE-2.0
+**
+** Unless required by applicable law or agreed to in writing, software
+** distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+** WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+**
+** See the License for the specific language governing permissions and
+** limitations under the License.
+**
+******************************************************************************/
+
+#pragma once
+
+#include "Dptf.h"
+#include <ostream>
+
+//
+// Builds a 256 row thermal relationship table (16 targets with 16 sources each) and reports the thread CPU time
+// spent per pass over every target.  The linear_scan variant walks all rows and sorts the matches on influence the
+// way the passive policy used to on each limit or unlimit; the indexed variant uses the per target row indexes and
+// the cached influence ranking.  reassociate_participant shows the cost of rebuilding the indexes.
+//
+
+void runRelationshipTableBenchmark(UInt64 passCount, std::ostream& output);
\ No newline at end of file
@@ -0,0 +1,133 @@
+/******************************************************************************
+** Copyright (c) 2013-2016 Intel Corporation All Rights Reserved
+**
+** Licensed under the Apache License, Version 2.0 (the "License"); you may not
+** use this file except in compliance with the License.
+**
+** You may obtain a copy of the License at
+**     http://www.apache.org/licenses/LICENSE-2.0
+**
+** Unless required by applicable law or agreed to in writing, software
+** distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+** WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+**
+** See the License for the specific language governing permissions and
+** limitations under the License.
+**
+******************************************************************************/
+
+#include "StatusSerializationBenchmark.h"
+#include "BenchmarkStatistics.h"
+#include "XmlNode.h"
+#include "StatusWriter.h"
+
+static const UIntN BenchmarkRelationshipCount = 16;
+static const UIntN BenchmarkParticipantCount = 8;
+
+static std::string buildXmlNodeDocument(void)
+{
+    auto root = XmlNode::createWrapperElement("passive_policy_status");
+
+    auto trt = XmlNode::createWrapperElement("trt");
+    root->addChild(trt);
+    for (UIntN i = 0; i < BenchmarkRelationshipCount; i++)
+    {
+        auto entry = XmlNode::createWrapperElement("trt_entry");
+        trt->addChild(entry);
+        entry->addChild(XmlNode::createDataElement("target_index", StlOverride::to_string(i % BenchmarkParticipantCount)));
+        entry->addChild(XmlNode::createDataElement("source_index", StlOverride::to_string(i)));
+        entry->addChild(XmlNode::createDataElement("influence", StlOverride::to_string(i * 10)));
+        entry->addChild(XmlNode::createDataElement("sampling_period", StlOverride::to_string(i * 100)));
+    }
+
+    auto participants = XmlNode::createWrapperElement("participant_trip_point_statistics");
+    root->addChild(participants);
+    for (UIntN i = 0; i < BenchmarkParticipantCount; i++)
+    {
+        auto participant = XmlNode::createWrapperElement("participant");
+        participants->addChild(participant);
+        participant->addChild(XmlNode::createDataElement("index", StlOverride::to_string(i)));
+        participant->addChild(XmlNode::createDataElement("name", "TSN" + StlOverride::to_string(i)));
+        participant->addChild(XmlNode::createDataElement("temperature", StlOverride::to_string(300 + i)));
+        participant->addChild(XmlNode::createDataElement("passive_trip_point", StlOverride::to_string(350 + i)));
+    }
+
+    return root->toString();
+}
+
+static std::string buildStatusWriterDocument(StatusWriter& writer, StatusOutputFormat::Type format)
+{
+    writer.reset(format);
+    writer.beginElement("passive_policy_status");
+
+    writer.beginElement("trt");
+    for (UIntN i = 0; i < BenchmarkRelationshipCount; i++)
+    {
+        writer.beginElement("trt_entry");
+        writer.addDataElement("target_index", StlOverride::to_string(i % BenchmarkParticipantCount));
+        writer.addDataElement("source_index", StlOverride::to_string(i));
+        writer.addDataElement("influence", StlOverride::to_string(i * 10));
+        writer.addDataElement("sampling_period", StlOverride::to_string(i * 100));
+        writer.endElement();
+    }
+    writer.endElement();
+
+    writer.beginElement("participant_trip_point_statistics");
+    for (UIntN i = 0; i < BenchmarkParticipantCount; i++)
+    {
+        writer.beginElement("participant");
+        writer.addDataElement("index", StlOverride::to_string(i));
+        writer.addDataElement("name", "TSN" + StlOverride::to_string(i));
+        writer.addDataElement("temperature", StlOverride::to_string(300 + i));
+        writer.addDataElement("passive_trip_point", StlOverride::to_string(350 + i));
+        writer.endElement();
+    }
+    writer.endElement();
+
+    writer.endElement();
+    return writer.getContent();
+}
+
+static void runDocumentBenchmark(UInt64 documentCount, const std::string& variantName, Bool useStatusWriter,
+    StatusOutputFormat::Type format, std::ostream& output)
+{
+    StatusWriter writer;
+    BenchmarkStatistics statistics("status_serialization", variantName, "document_cpu");
+    statistics.reserve(documentCount);
+
+    UInt64 bytesWritten = 0;
+    for (UInt64 documentNumber = 0; documentNumber < documentCount; documentNumber++)
+    {
+        UInt64 startTime = BenchmarkStatistics::getThreadCpuTimeNanoseconds();
+        if (useStatusWriter)
+        {
+            bytesWritten += buildStatusWriterDocument(writer, format).size();
+        }
+        else
+        {
+            bytesWritten += buildXmlNodeDocument().size();
+        }
+        statistics.addSample(BenchmarkStatistics::getThreadCpuTimeNanoseconds() - startTime);
+    }
+
+    if (bytesWritten == 0)
+    {
+        throw dptf_exception("Status serialization benchmark did not produce any output.");
+    }
+
+    output << statistics.toCsv() << std::endl;
+}
+
+void runStatusSerializationBenchmark(UInt64 documentCount, std::ostream& output)
+{
+    // Both Xml paths must produce the same document or the comparison is meaningless
+    StatusWriter writer;
+    if (buildXmlNodeDocument() != buildStatusWriterDocument(writer, StatusOutputFormat::Xml))
+    {
+        throw dptf_exception("StatusWriter Xml output does not match XmlNode output.");
+    }
+
+    runDocumentBenchmark(documentCount, "xml_node", false, StatusOutputFormat::Xml, output);
+    runDocumentBenchmark(documentCount, "status_writer_xml", true, StatusOutputFormat::Xml, output);
+    runDocumentBenchmark(documentCount, "status_writer_json", true, StatusOutputFormat::Json, output);
+}
\ No newline at end of file
@@ -0,0 +1,30 @@
+/******************************************************************************
+** Copyright (c) 2013-2016 Intel Corporation All Rights Reserved
+**
+** Licensed under the Apache License, Version 2.0 (the "License"); you may not
+** use this file except in compliance with the License.
+**
+** You may obtain a copy of the License at
+**     http://www.apache.org/licenses/LICENSE-2.0
+**
+** Unless required by applicable law or agreed to in writing, software
+** distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+** WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+**
+** See the License for the specific language governing permissions and
+** limitations under the License.
+**
+******************************************************************************/
+
+#pragma once
+
+#include "Dptf.h"
+#include <ostream>
+
+//
+// Serializes a document shaped like the passive policy status (a thermal relationship table plus per participant
+// trip points) and reports the thread CPU time spent per document.  The xml_node variant builds an XmlNode tree
+// and calls toString(); the status_writer variants stream the same document into a reused StatusWriter.
+//
+
+void runStatusSerializationBenchmark(UInt64 documentCount, std::ostream& output);
\ No newline at end of file
@@ -0,0 +1,406 @@
+/******************************************************************************
+** Copyright (c) 2013-2016 Intel Corporation All Rights Reserved
+**
+** Licensed under the Apache License, Version 2.0 (the "License"); you may not
+** use this file except in compliance with the License.
+**
+** You may obtain a copy of the License at
+**     http://www.apache.org/licenses/LICENSE-2.0
+**
+** Unless required by applicable law or agreed to in writing, software
+** distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+** WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+**
+** See the License for the specific language governing permissions and
+** limitations under the License.
+**
+******************************************************************************/
+
+#include "SyntheticEsifAppServices.h"
+#include "EsifMutexHelper.h"
+#include "esif_ccb_memory.h"
+#include "esif_sdk_capability_type.h"
+
+static const double PassiveTripPointCelsius = 60.0;
+static const double CriticalTripPointCelsius = 100.0;
+static const double HotTripPointCelsius = 95.0;
+static const double ActiveTripPointsCelsius[] = {70.0, 55.0, 45.0};
+static const double InitialTemperatureCelsius = 40.0;
+static const UInt32 MinimumSamplePeriodMilliseconds = 1000;
+static const UInt32 TrtSamplingPeriodTenthSeconds = 10;
+static const UInt32 ArtWeight = 100;
+static const UInt32 ArtFanSpeeds[] = {100, 80, 60, 40, 20, 0, 0, 0, 0, 0};
+
+static const UInt8 ParticipantDriverType[Constants::GuidSize] = {0x53, 0x59, 0x4e, 0x54, 0x48, 0x45, 0x54, 0x49, 0x43, 0x50,
+    0x41, 0x52, 0x54, 0x00, 0x00, 0x01};
+static const UInt8 DomainGuid[Constants::GuidSize] = {0x53, 0x59, 0x4e, 0x54, 0x48, 0x45, 0x54, 0x49, 0x43, 0x44, 0x4f, 0x4d,
+    0x41, 0x49, 0x4e, 0x01};
+static const char EmptyString[] = "";
+static const char DomainName[] = "TMP0";
+static const char DomainDescription[] = "Synthetic Temperature Sensor";
+
+#pragma pack(push, 1)
+typedef struct _SyntheticAcpiEsifGuid
+{
+    union esif_data_variant esifDataVariant;
+    UInt8 guid[Constants::GuidSize];
+} SyntheticAcpiEsifGuid;
+#pragma pack(pop)
+
+static EsifData createEsifData(esif_data_type type, const void* buffer, UInt32 length)
+{
+    EsifData esifData = {type, const_cast<void*>(buffer), length, length};
+    return esifData;
+}
+
+static void appendVariant(std::vector<UInt8>& buffer, const union esif_data_variant& variant)
+{
+    const UInt8* bytes = reinterpret_cast<const UInt8*>(&variant);
+    buffer.insert(buffer.end(), bytes, bytes + sizeof(variant));
+}
+
+static void appendString(std::vector<UInt8>& buffer, const std::string& value)
+{
+    // The length includes the null terminator and the characters follow the variant
+    union esif_data_variant variant;
+    esif_ccb_memset(&variant, 0, sizeof(variant));
+    variant.string.type = ESIF_DATA_STRING;
+    variant.string.length = static_cast<u32>(value.size() + 1);
+    appendVariant(buffer, variant);
+    buffer.insert(buffer.end(), value.c_str(), value.c_str() + value.size() + 1);
+}
+
+static void appendInteger(std::vector<UInt8>& buffer, UInt64 value)
+{
+    union esif_data_variant variant;
+    esif_ccb_memset(&variant, 0, sizeof(variant));
+    variant.integer.type = ESIF_DATA_UINT64;
+    variant.integer.value = value;
+    appendVariant(buffer, variant);
+}
+
+static eEsifError copyResponse(esif_data_type type, const void* buffer, UInt32 length, EsifDataPtr response)
+{
+    if (response == nullptr)
+    {
+        return ESIF_E_PARAMETER_IS_NULL;
+    }
+
+    response->data_len = length;
+    if ((response->buf_len < length) || ((response->buf_ptr == nullptr) && (length > 0)))
+    {
+        return ESIF_E_NEED_LARGER_BUFFER;
+    }
+
+    if (length > 0)
+    {
+        esif_ccb_memcpy(response->buf_ptr, buffer, length);
+    }
+    response->type = type;
+    return ESIF_OK;
+}
+
+static eEsifError copyResponse(esif_data_type type, UInt32 value, EsifDataPtr response)
+{
+    return copyResponse(type, &value, sizeof(value), response);
+}
+
+static eEsifError copyResponse(const std::vector<UInt8>& buffer, EsifDataPtr response)
+{
+    return copyResponse(ESIF_DATA_BINARY, buffer.empty() ? nullptr : &buffer[0], (UInt32)buffer.size(), response);
+}
+
+SyntheticEsifAppServices::SyntheticEsifAppServices(IndexContainerInterface* indexContainer, UIntN participantCount,
+    UIntN trtEntryCount, UIntN artEntryCount) :
+    m_indexContainer(indexContainer)
+{
+    if (participantCount < 2)
+    {
+        throw dptf_exception("The synthetic platform needs at least two participants for its relationship tables.");
+    }
+
+    for (UIntN participantIndex = 0; participantIndex < participantCount; participantIndex++)
+    {
+        std::string number = StlOverride::to_string(participantIndex);
+        if (number.size() < 2)
+        {
+            number = "0" + number;
+        }
+        m_participantNames.push_back("TS" + number);
+        m_participantScopes.push_back("\\_SB_.TS" + number);
+        m_temperatures.push_back(Temperature::fromCelsius(InitialTemperatureCelsius));
+    }
+
+    buildTrt(trtEntryCount);
+    buildArt(artEntryCount);
+}
+
+void SyntheticEsifAppServices::setSupportedPolicies(const std::vector<Guid>& policyGuids)
+{
+    m_supportedPolicies.clear();
+    for (auto guid = policyGuids.begin(); guid != policyGuids.end(); ++guid)
+    {
+        SyntheticAcpiEsifGuid acpiEsifGuid;
+        esif_ccb_memset(&acpiEsifGuid, 0, sizeof(acpiEsifGuid));
+        guid->copyToBuffer(acpiEsifGuid.guid);
+
+        const UInt8* bytes = reinterpret_cast<const UInt8*>(&acpiEsifGuid);
+        m_supportedPolicies.insert(m_supportedPolicies.end(), bytes, bytes + sizeof(acpiEsifGuid));
+    }
+}
+
+void SyntheticEsifAppServices::setTemperature(UIntN participantIndex, const Temperature& temperature)
+{
+    EsifMutexHelper esifMutexHelper(&m_temperatureMutex);
+    esifMutexHelper.lock();
+    m_temperatures.at(participantIndex) = temperature;
+    esifMutexHelper.unlock();
+}
+
+Temperature SyntheticEsifAppServices::getPassiveTripPoint(void) const
+{
+    return Temperature::fromCelsius(PassiveTripPointCelsius);
+}
+
+UIntN SyntheticEsifAppServices::getParticipantCount(void) const
+{
+    return static_cast<UIntN>(m_participantNames.size());
+}
+
+AppParticipantData SyntheticEsifAppServices::getParticipantData(UIntN participantIndex)
+{
+    const std::string& name = m_participantNames.at(participantIndex);
+    const std::string& scope = m_participantScopes.at(participantIndex);
+
+    AppParticipantData participantData;
+    esif_ccb_memset(&participantData, 0, sizeof(participantData));
+    participantData.fVersion = 1;
+    participantData.fDriverType = createEsifData(ESIF_DATA_GUID, ParticipantDriverType, Constants::GuidSize);
+    participantData.fDeviceType = createEsifData(ESIF_DATA_STRING, EmptyString, sizeof(EmptyString));
+    participantData.fName = createEsifData(ESIF_DATA_STRING, name.c_str(), (UInt32)name.size() + 1);
+    participantData.fDesc = createEsifData(ESIF_DATA_STRING, name.c_str(), (UInt32)name.size() + 1);
+    participantData.fDriverName = createEsifData(ESIF_DATA_STRING, EmptyString, sizeof(EmptyString));
+    participantData.fDeviceName = createEsifData(ESIF_DATA_STRING, EmptyString, sizeof(EmptyString));
+    participantData.fDevicePath = createEsifData(ESIF_DATA_STRING, EmptyString, sizeof(EmptyString));
+    participantData.fDomainCount = 1;
+    participantData.fBusEnumerator = ESIF_PARTICIPANT_ENUM_ACPI;
+    participantData.fAcpiDevice = createEsifData(ESIF_DATA_STRING, name.c_str(), (UInt32)name.size() + 1);
+    participantData.fAcpiScope = createEsifData(ESIF_DATA_STRING, scope.c_str(), (UInt32)scope.size() + 1);
+    participantData.fAcpiUID = createEsifData(ESIF_DATA_STRING, EmptyString, sizeof(EmptyString));
+    participantData.fAcpiType = ESIF_DOMAIN_TYPE_TEMPERATURE;
+    return participantData;
+}
+
+AppDomainData SyntheticEsifAppServices::getDomainData(UIntN participantIndex)
+{
+    AppDomainData domainData;
+    esif_ccb_memset(&domainData, 0, sizeof(domainData));
+    domainData.fVersion = 1;
+    domainData.fName = createEsifData(ESIF_DATA_STRING, DomainName, sizeof(DomainName));
+    domainData.fDescription = createEsifData(ESIF_DATA_STRING, DomainDescription, sizeof(DomainDescription));
+    domainData.fGuid = createEsifData(ESIF_DATA_GUID, DomainGuid, Constants::GuidSize);
+    domainData.fType = ESIF_DOMAIN_TYPE_TEMPERATURE;
+    domainData.fCapabilityBytes[ESIF_CAPABILITY_TYPE_TEMP_STATUS] = 1;
+    domainData.fCapabilityBytes[ESIF_CAPABILITY_TYPE_TEMP_THRESHOLD] = 1;
+    return domainData;
+}
+
+eIfaceType SyntheticEsifAppServices::getInterfaceType(void)
+{
+    return eIfaceTypeEsifService;
+}
+
+UInt16 SyntheticEsifAppServices::getInterfaceVersion(void)
+{
+    return ESIF_INTERFACE_VERSION_3;
+}
+
+UInt64 SyntheticEsifAppServices::getInterfaceSize(void)
+{
+    return sizeof(EsifInterface);
+}
+
+eEsifError SyntheticEsifAppServices::getConfigurationValue(const void* esifHandle, const void* appHandle,
+    const EsifDataPtr nameSpace, const EsifDataPtr elementPath, EsifDataPtr elementValue)
+{
+    return ESIF_E_NOT_FOUND;
+}
+
+eEsifError SyntheticEsifAppServices::setConfigurationValue(const void* esifHandle, const void* appHandle,
+    const EsifDataPtr nameSpace, const EsifDataPtr elementPath, const EsifDataPtr elementValue,
+    const EsifFlags elementFlags)
+{
+    return ESIF_OK;
+}
+
+eEsifError SyntheticEsifAppServices::executePrimitive(const void* esifHandle, const void* appHandle,
+    const void* participantHandle, const void* domainHandle, const EsifDataPtr request,
+    EsifDataPtr response, ePrimitiveType primitive, const UInt8 instance)
+{
+    if ((response == nullptr) || (response->type == ESIF_DATA_VOID))
+    {
+        return ESIF_OK;
+    }
+
+    switch (primitive)
+    {
+        case GET_SUPPORTED_POLICIES:
+            return copyResponse(m_supportedPolicies, response);
+        case GET_THERMAL_RELATIONSHIP_TABLE:
+            return copyResponse(m_trt, response);
+        case GET_ACTIVE_RELATIONSHIP_TABLE:
+            return copyResponse(m_art, response);
+        case GET_MINIMUM_SAMPLE_PERIOD:
+            return copyResponse(ESIF_DATA_TIME, MinimumSamplePeriodMilliseconds, response);
+        default:
+            break;
+    }
+
+    UIntN participantIndex = m_indexContainer->getIndex((IndexStructPtr)participantHandle);
+    if (participantIndex >= getParticipantCount())
+    {
+        return ESIF_E_PRIMITIVE_NOT_FOUND_IN_DSP;
+    }
+    return executeParticipantPrimitive(participantIndex, primitive, instance, response);
+}
+
+eEsifError SyntheticEsifAppServices::writeLog(const void* esifHandle, const void* appHandle,
+    const void* participantHandle, const void* domainHandle, const EsifDataPtr message,
+    const eLogType logType)
+{
+    return ESIF_OK;
+}
+
+eEsifError SyntheticEsifAppServices::registerForEvent(const void* esifHandle, const void* appHandle,
+    const void* participantHandle, const void* domainHandle, const EsifDataPtr eventGuid)
+{
+    return ESIF_OK;
+}
+
+eEsifError SyntheticEsifAppServices::unregisterForEvent(const void* esifHandle, const void* appHandle,
+    const void* participantHandle, const void* domainHandle, const EsifDataPtr eventGuid)
+{
+    return ESIF_OK;
+}
+
+eEsifError SyntheticEsifAppServices::sendEvent(const void* esifHandle, const void* appHandle,
+    const void* participantHandle, const void* domainHandle, const EsifDataPtr eventData,
+    const EsifDataPtr eventGuid)
+{
+    return ESIF_OK;
+}
+
+eEsifError SyntheticEsifAppServices::executePrimitiveBatch(const void* esifHandle, const void* appHandle,
+    EsifPrimitiveBatchItemPtr items, const UInt32 itemCount, EsifDataPtr response)
+{
+    if ((items == nullptr) || (response == nullptr))
+    {
+        return ESIF_E_PARAMETER_IS_NULL;
+    }
+
+    // Same buffer layout as the ESIF batch call
+    UInt64 requiredSize = 0;
+    for (UInt32 i = 0; i < itemCount; i++)
+    {
+        items[i].fOffset = (UInt32)requiredSize;
+        items[i].fDataLength = 0;
+        items[i].fStatus = ESIF_E_UNSPECIFIED;
+        requiredSize += ESIF_PRIMITIVE_BATCH_ALIGN((UInt64)items[i].fResponseSize);
+    }
+
+    if ((response->buf_len < requiredSize) || ((response->buf_ptr == nullptr) && (requiredSize > 0)))
+    {
+        response->data_len = (UInt32)requiredSize;
+        return ESIF_E_NEED_LARGER_BUFFER;
+    }
+
+    for (UInt32 i = 0; i < itemCount; i++)
+    {
+        EsifData itemResponse;
+        itemResponse.type = (esif_data_type)items[i].fResponseType;
+        itemResponse.buf_ptr = (UInt8*)response->buf_ptr + items[i].fOffset;
+        itemResponse.buf_len = items[i].fResponseSize;
+        itemResponse.data_len = 0;
+
+        items[i].fStatus = executePrimitive(esifHandle, appHandle, items[i].fParticipantHandle,
+            items[i].fDomainHandle, nullptr, &itemResponse, (ePrimitiveType)items[i].fPrimitive, items[i].fInstance);
+        items[i].fDataLength = itemResponse.data_len;
+    }
+    response->data_len = (UInt32)requiredSize;
+
+    return ESIF_OK;
+}
+
+void SyntheticEsifAppServices::buildTrt(UIntN entryCount)
+{
+    for (UIntN entryNumber = 0; entryNumber < entryCount; entryNumber++)
+    {
+        appendString(m_trt, m_participantScopes[getRelationshipSource(entryNumber)]);
+        appendString(m_trt, m_participantScopes[getRelationshipTarget(entryNumber)]);
+        appendInteger(m_trt, (entryNumber % 10) * 10); // influence
+        appendInteger(m_trt, TrtSamplingPeriodTenthSeconds);
+        for (UIntN reserved = 0; reserved < 4; reserved++)
+        {
+            appendInteger(m_trt, 0);
+        }
+    }
+}
+
+void SyntheticEsifAppServices::buildArt(UIntN entryCount)
+{
+    appendInteger(m_art, 0); // revision
+    for (UIntN entryNumber = 0; entryNumber < entryCount; entryNumber++)
+    {
+        appendString(m_art, m_participantScopes[getRelationshipSource(entryNumber)]);
+        appendString(m_art, m_participantScopes[getRelationshipTarget(entryNumber)]);
+        appendInteger(m_art, ArtWeight);
+        for (UIntN acIndex = 0; acIndex < sizeof(ArtFanSpeeds) / sizeof(ArtFanSpeeds[0]); acIndex++)
+        {
+            appendInteger(m_art, ArtFanSpeeds[acIndex]);
+        }
+    }
+}
+
+UIntN SyntheticEsifAppServices::getRelationshipSource(UIntN entryNumber) const
+{
+    // Walks every other participant as a source for each target before any pair repeats
+    UIntN participantCount = getParticipantCount();
+    UIntN offset = 1 + ((entryNumber / participantCount) % (participantCount - 1));
+    return (getRelationshipTarget(entryNumber) + offset) % participantCount;
+}
+
+UIntN SyntheticEsifAppServices::getRelationshipTarget(UIntN entryNumber) const
+{
+    return entryNumber % getParticipantCount();
+}
+
+eEsifError SyntheticEsifAppServices::executeParticipantPrimitive(UIntN participantIndex, ePrimitiveType primitive,
+    UInt8 instance, EsifDataPtr response)
+{
+    switch (primitive)
+    {
+        case GET_TEMPERATURE:
+        {
+            EsifMutexHelper esifMutexHelper(&m_temperatureMutex);
+            esifMutexHelper.lock();
+            UInt32 temperature = m_temperatures[participantIndex];
+            esifMutexHelper.unlock();
+            return copyResponse(ESIF_DATA_TEMPERATURE, temperature, response);
+        }
+        case GET_TRIP_POINT_PASSIVE:
+            return copyResponse(ESIF_DATA_TEMPERATURE, Temperature::fromCelsius(PassiveTripPointCelsius), response);
+        case GET_TRIP_POINT_CRITICAL:
+            return copyResponse(ESIF_DATA_TEMPERATURE, Temperature::fromCelsius(CriticalTripPointCelsius), response);
+        case GET_TRIP_POINT_HOT:
+            return copyResponse(ESIF_DATA_TEMPERATURE, Temperature::fromCelsius(HotTripPointCelsius), response);
+        case GET_TRIP_POINT_ACTIVE:
+            if (instance < sizeof(ActiveTripPointsCelsius) / sizeof(ActiveTripPointsCelsius[0]))
+            {
+                return copyResponse(ESIF_DATA_TEMPERATURE, Temperature::fromCelsius(ActiveTripPointsCelsius[instance]),
+                    response);
+            }
+            return ESIF_E_PRIMITIVE_NOT_FOUND_IN_DSP;
+        default:
+            return ESIF_E_PRIMITIVE_NOT_FOUND_IN_DSP;
+    }
+}
\ No newline at end of file
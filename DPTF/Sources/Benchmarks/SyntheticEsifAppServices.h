@@ -0,0 +1,107 @@
+/******************************************************************************
+** Copyright (c) 2013-2016 Intel Corporation All Rights Reserved
+**
+** Licensed under the Apache License, Version 2.0 (the "License"); you may not
+** use this file except in compliance with the License.
+**
+** You may obtain a copy of the License at
+**     http://www.apache.org/licenses/LICENSE-2.0
+**
+** Unless required by applicable law or agreed to in writing, software
+** distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+** WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+**
+** See the License for the specific language governing permissions and
+** limitations under the License.
+**
+******************************************************************************/
+
+#pragma once
+
+#include "Dptf.h"
+#include "esif_sdk_iface_esif.h"
+#include "EsifAppServicesInterface.h"
+#include "IndexContainerInterface.h"
+#include "EsifMutex.h"
+
+//
+// In-process stand-in for ESIF used by the platform benchmark.  The synthetic platform is a set of temperature
+// sensor participants with one domain each, tied together by a TRT and an ART with any number of entries.  Every
+// participant reports the same trip points and the benchmark moves temperatures with setTemperature().
+//
+// Primitives the platform does not describe fail the same way they do on a platform without them.  SET
+// primitives always succeed and configuration values are never found.
+//
+
+class SyntheticEsifAppServices : public EsifAppServicesInterface
+{
+public:
+
+    // Participants must be created in order so participant N is at index N
+    SyntheticEsifAppServices(IndexContainerInterface* indexContainer, UIntN participantCount, UIntN trtEntryCount,
+        UIntN artEntryCount);
+
+    void setSupportedPolicies(const std::vector<Guid>& policyGuids);
+    void setTemperature(UIntN participantIndex, const Temperature& temperature);
+    Temperature getPassiveTripPoint(void) const;
+
+    UIntN getParticipantCount(void) const;
+    AppParticipantData getParticipantData(UIntN participantIndex);
+    AppDomainData getDomainData(UIntN participantIndex);
+
+    virtual eIfaceType getInterfaceType(void) override;
+    virtual UInt16 getInterfaceVersion(void) override;
+    virtual UInt64 getInterfaceSize(void) override;
+
+    virtual eEsifError getConfigurationValue(const void* esifHandle, const void* appHandle,
+        const EsifDataPtr nameSpace, const EsifDataPtr elementPath, EsifDataPtr elementValue) override;
+
+    virtual eEsifError setConfigurationValue(const void* esifHandle, const void* appHandle,
+        const EsifDataPtr nameSpace, const EsifDataPtr elementPath, const EsifDataPtr elementValue,
+        const EsifFlags elementFlags) override;
+
+    virtual eEsifError executePrimitive(const void* esifHandle, const void* appHandle,
+        const void* participantHandle, const void* domainHandle, const EsifDataPtr request,
+        EsifDataPtr response, ePrimitiveType primitive, const UInt8 instance) override;
+
+    virtual eEsifError writeLog(const void* esifHandle, const void* appHandle,
+        const void* participantHandle, const void* domainHandle, const EsifDataPtr message,
+        const eLogType logType) override;
+
+    virtual eEsifError registerForEvent(const void* esifHandle, const void* appHandle,
+        const void* participantHandle, const void* domainHandle, const EsifDataPtr eventGuid) override;
+
+    virtual eEsifError unregisterForEvent(const void* esifHandle, const void* appHandle,
+        const void* participantHandle, const void* domainHandle, const EsifDataPtr eventGuid) override;
+
+    virtual eEsifError sendEvent(const void* esifHandle, const void* appHandle,
+        const void* participantHandle, const void* domainHandle, const EsifDataPtr eventData,
+        const EsifDataPtr eventGuid) override;
+
+    virtual eEsifError executePrimitiveBatch(const void* esifHandle, const void* appHandle,
+        EsifPrimitiveBatchItemPtr items, const UInt32 itemCount, EsifDataPtr response) override;
+
+private:
+
+    // hide the copy constructor and assignment operator.
+    SyntheticEsifAppServices(const SyntheticEsifAppServices& rhs);
+    SyntheticEsifAppServices& operator=(const SyntheticEsifAppServices& rhs);
+
+    IndexContainerInterface* m_indexContainer;
+    std::vector<std::string> m_participantNames;
+    std::vector<std::string> m_participantScopes;
+    std::vector<UInt8> m_supportedPolicies;
+    std::vector<UInt8> m_trt;
+    std::vector<UInt8> m_art;
+
+    // Written by the benchmark while the work item thread reads them
+    std::vector<UInt32> m_temperatures;
+    EsifMutex m_temperatureMutex;
+
+    void buildTrt(UIntN entryCount);
+    void buildArt(UIntN entryCount);
+    UIntN getRelationshipSource(UIntN entryNumber) const;
+    UIntN getRelationshipTarget(UIntN entryNumber) const;
+    eEsifError executeParticipantPrimitive(UIntN participantIndex, ePrimitiveType primitive, UInt8 instance,
+        EsifDataPtr response);
+};
\ No newline at end of file
@@ -21,7 +21,8 @@
 #include "XmlNode.h"
 
 DeferredWorkItemQueue::DeferredWorkItemQueue(EsifSemaphore* workItemQueueSemaphore) :
-    m_maxCount(0), m_workItemQueueSemaphore(workItemQueueSemaphore), m_timer(TimerCallback, this)
+    m_timerWheel(TimerWheelTickMilliseconds), m_maxCount(0), m_totalTimerStarts(0),
+    m_workItemQueueSemaphore(workItemQueueSemaphore), m_timer(TimerCallback, this)
 {
 }
 
@@ -35,14 +36,21 @@ void DeferredWorkItemQueue::enqueue(DeferredWorkItem* newWorkItem)
 {
     // FIMXE:  during round 2, need to add statistics logging
 
-    // Insert into the queue sorted based on time stamp.  The timer must be set to expire
-    // when the first item in the queue is ready to process.
+    // Insert into the timer wheel.  The timer must be set to expire when the first item in the queue is
+    // ready to process.
 
     EsifMutexHelper esifMutexHelper(&m_mutex);
     esifMutexHelper.lock();
 
-    insertSortedByDeferredProcessingTime(newWorkItem);
+    m_timerWheel.insert(newWorkItem, EsifTime().getTimeStamp());
     updateMaxCount();
+
+    if (m_timerWheel.hasReadyWorkItems() == true)
+    {
+        // The work item is already due.  Wake up the work item thread instead of waiting for the timer.
+        m_workItemQueueSemaphore->signal();
+    }
+
     setTimer();
 
     esifMutexHelper.unlock();
@@ -55,7 +63,7 @@ DeferredWorkItem* DeferredWorkItemQueue::dequeue(void)
     EsifMutexHelper esifMutexHelper(&m_mutex);
     esifMutexHelper.lock();
 
-    DeferredWorkItem* firstReadyWorkItem = getFirstReadyWorkItemFromQueue();
+    DeferredWorkItem* firstReadyWorkItem = m_timerWheel.removeFirstReady(EsifTime().getTimeStamp());
     setTimer();
 
     esifMutexHelper.unlock();
@@ -69,13 +77,7 @@ void DeferredWorkItemQueue::makeEmtpy(void)
     esifMutexHelper.lock();
 
     m_timer.cancelTimer();
-
-    while (m_queue.empty() == false)
-    {
-        DeferredWorkItem* currentWorkItem = m_queue.front();
-        delete currentWorkItem;
-        m_queue.pop_front();
-    }
+    m_timerWheel.deleteAll();
 
     esifMutexHelper.unlock();
 }
@@ -86,7 +88,7 @@ UInt64 DeferredWorkItemQueue::getCount(void) const
     EsifMutexHelper esifMutexHelper(&m_mutex);
 
     esifMutexHelper.lock();
-    count = m_queue.size();
+    count = m_timerWheel.getCount();
     esifMutexHelper.unlock();
 
     return count;
@@ -109,23 +111,7 @@ UIntN DeferredWorkItemQueue::removeIfMatches(const WorkItemMatchCriteria& matchC
     EsifMutexHelper esifMutexHelper(&m_mutex);
     esifMutexHelper.lock();
 
-    UIntN numRemoved = 0;
-
-    auto it = m_queue.begin();
-    while (it != m_queue.end())
-    {
-        if ((*it)->matches(matchCriteria) == true)
-        {
-            DELETE_MEMORY_TC(*it);
-            it = m_queue.erase(it);
-            numRemoved++;
-        }
-        else
-        {
-            it++;
-        }
-    }
-
+    UIntN numRemoved = m_timerWheel.removeIfMatches(matchCriteria);
     setTimer();
 
     esifMutexHelper.unlock();
@@ -133,18 +119,18 @@ UIntN DeferredWorkItemQueue::removeIfMatches(const WorkItemMatchCriteria& matchC
     return numRemoved;
 }
 
-std::shared_ptr<XmlNode> DeferredWorkItemQueue::getXml(void) const
+void DeferredWorkItemQueue::writeStatus(StatusWriter& writer) const
 {
     EsifMutexHelper esifMutexHelper(&m_mutex);
     esifMutexHelper.lock();
 
-    auto deferredQueueStastics = XmlNode::createWrapperElement("deferred_queue_statistics");
-    deferredQueueStastics->addChild(XmlNode::createDataElement("current_count", StlOverride::to_string(m_queue.size())));
-    deferredQueueStastics->addChild(XmlNode::createDataElement("max_count", StlOverride::to_string(m_maxCount)));
+    writer.beginElement("deferred_queue_statistics");
+    writer.addDataElement("current_count", StlOverride::to_string(m_timerWheel.getCount()));
+    writer.addDataElement("max_count", StlOverride::to_string(m_maxCount));
+    writer.addDataElement("total_timer_starts", StlOverride::to_string(m_totalTimerStarts));
+    writer.endElement();
 
     esifMutexHelper.unlock();
-
-    return deferredQueueStastics;
 }
 
 //
@@ -154,9 +140,13 @@ std::shared_ptr<XmlNode> DeferredWorkItemQueue::getXml(void) const
 
 void DeferredWorkItemQueue::setTimer(void)
 {
-    // Set the timer to expire when the first item in the queue is ready to process
+    // Set the timer to expire when the first item in the queue is ready to process.  Starting the timer is
+    // expensive, so it is left alone if it is already set for the right time.  The timer clears its expiration
+    // time when it fires, so it is always started again after a callback even if nothing was ready yet.
+
+    TimeSpan nextExpirationTime = m_timerWheel.getNextExpirationTime();
 
-    if (m_queue.empty() == true)
+    if (nextExpirationTime.isValid() == false)
     {
         // the timer shouldn't be running.  cancel it if needed.
         if (m_timer.isExpirationTimeValid() == true)
@@ -164,68 +154,32 @@ void DeferredWorkItemQueue::setTimer(void)
             m_timer.cancelTimer();
         }
     }
-    else
+    else if ((m_timerWheel.hasReadyWorkItems() == true) && (nextExpirationTime <= EsifTime().getTimeStamp()))
     {
-        DeferredWorkItem* firstWorkItem = m_queue.front();
-        auto firstWorkItemTime = firstWorkItem->getDeferredProcessingTime();
-
-        m_timer.startTimer(firstWorkItemTime);
+        // A work item is already due.  The work item thread keeps dequeuing until none are ready, so the
+        // timer isn't needed.
     }
-}
-
-DeferredWorkItem* DeferredWorkItemQueue::getFirstReadyWorkItemFromQueue(void)
-{
-    DeferredWorkItem* firstReadyWorkItem = nullptr;
-
-    if (m_queue.empty() == false)
-    {
-        auto currentTime = EsifTime().getTimeStamp();
-        firstReadyWorkItem = m_queue.front();
-
-        if (firstReadyWorkItem->getDeferredProcessingTime() <= currentTime)
-        {
-            m_queue.pop_front();
-        }
-        else
-        {
-            firstReadyWorkItem = nullptr;
-        }
-    }
-
-    return firstReadyWorkItem;
-}
-
-void DeferredWorkItemQueue::insertSortedByDeferredProcessingTime(DeferredWorkItem* newWorkItem)
-{
-    auto it = m_queue.begin();
-    for (; it != m_queue.end(); it++)
-    {
-        DeferredWorkItem* currentWorkItem = *it;
-        if (currentWorkItem->getDeferredProcessingTime() > newWorkItem->getDeferredProcessingTime())
-        {
-            m_queue.insert(it, newWorkItem);
-            break;
-        }
-    }
-
-    if (it == m_queue.end())
+    else if ((m_timer.isExpirationTimeValid() == false) ||
+        (m_timer.getExpirationTime() != nextExpirationTime) ||
+        (m_timer.getExpirationTime() <= EsifTime().getTimeStamp()))
     {
-        m_queue.push_back(newWorkItem);
+        m_timer.startTimer(nextExpirationTime);
+        m_totalTimerStarts++;
     }
 }
 
 void DeferredWorkItemQueue::updateMaxCount()
 {
-    if (m_queue.size() > m_maxCount)
+    if (m_timerWheel.getCount() > m_maxCount)
     {
-        m_maxCount = m_queue.size();
+        m_maxCount = m_timerWheel.getCount();
     }
 }
 
 //
 // The following two functions get called when the timer expires.  The semaphore is signaled so the
 // work item thread will check the queue for work items that are ready to process.
-// The timer starts again when the work item thread dequeues the first work item.
+// The timer starts again when the work item thread dequeues, whether or not a work item was ready.
 
 void DeferredWorkItemQueue::timerCallback(void) const
 {
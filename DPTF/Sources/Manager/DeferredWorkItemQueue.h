@@ -25,6 +25,7 @@
 #include "EsifSemaphore.h"
 #include "EsifTime.h"
 #include "EsifTimer.h"
+#include "TimerWheel.h"
 
 class DeferredWorkItemQueue : public WorkItemQueueInterface
 {
@@ -41,7 +42,7 @@ public:
     virtual UInt64 getCount(void) const override final;
     virtual UInt64 getMaxCount(void) const override final;
     virtual UIntN removeIfMatches(const WorkItemMatchCriteria& matchCriteria) override final;
-    virtual std::shared_ptr<XmlNode> getXml(void) const override final;
+    virtual void writeStatus(StatusWriter& writer) const override final;
 
 private:
 
@@ -49,15 +50,17 @@ private:
     DeferredWorkItemQueue(const DeferredWorkItemQueue& rhs);
     DeferredWorkItemQueue& operator=(const DeferredWorkItemQueue& rhs);
 
-    std::list<DeferredWorkItem*> m_queue;
+    // Work items that are due in the same tick are processed together with a single timer expiration.
+    static const UIntN TimerWheelTickMilliseconds = 10;
+
+    TimerWheel m_timerWheel;
     UInt64 m_maxCount;                                              // stores the maximum number of items in the queue at any one time
+    UInt64 m_totalTimerStarts;                                      // number of times the timer has been restarted
     mutable EsifMutex m_mutex;
     EsifSemaphore* m_workItemQueueSemaphore;
     EsifTimer m_timer;
 
     void setTimer(void);
-    DeferredWorkItem* getFirstReadyWorkItemFromQueue(void);
-    void insertSortedByDeferredProcessingTime(DeferredWorkItem* newWorkItem);
     void updateMaxCount(void);
 
     // The timer will call a 'C' function which will need to forward the call to our private
@@ -20,6 +20,9 @@
 #include "EsifDataString.h"
 #include "EsifDataGuid.h"
 #include "DptfStatusInterface.h"
+#include "ParticipantManagerInterface.h"
+#include "XmlNode.h"
+#include "EsifMutexHelper.h"
 
 Domain::Domain(DptfManagerInterface* dptfManager) :
     m_domainCreated(false), m_dptfManager(dptfManager), m_theRealParticipant(nullptr),
@@ -27,31 +30,12 @@ Domain::Domain(DptfManagerInterface* dptfManager) :
     m_domainGuid(Guid()), m_domainName(""), m_domainType(DomainType::Invalid),
     m_domainFunctionalityVersions(DomainFunctionalityVersions()),
     m_arbitrator(nullptr),
-    m_activeControlStaticCaps(nullptr), m_activeControlStatus(nullptr), m_activeControlSet(nullptr),
-    m_configTdpControlDynamicCaps(nullptr), m_configTdpControlStatus(nullptr), m_configTdpControlSet(nullptr),
-    m_coreControlStaticCaps(nullptr), m_coreControlDynamicCaps(nullptr),
-    m_coreControlLpoPreference(nullptr), m_coreControlStatus(nullptr),
-    m_displayControlDynamicCaps(nullptr), m_displayControlStatus(nullptr), m_displayControlSet(nullptr),
-    m_performanceControlStaticCaps(nullptr), m_performanceControlDynamicCaps(nullptr),
-    m_performanceControlStatus(nullptr), m_performanceControlSet(nullptr),
-    m_pixelClockCapabilities(nullptr), m_pixelClockDataSet(nullptr),
-    m_powerControlDynamicCapsSet(nullptr),
-    m_powerStatus(nullptr),
-    m_maxBatteryPower(nullptr),
-    m_adapterRating(nullptr),
-    m_platformRestOfPower(nullptr),
-    m_acPeakPower(nullptr),
-    m_acPeakTimeWindow(nullptr),
-    m_platformPowerSource(nullptr),
-    m_chargerType(nullptr),
-    m_batterySteadyState(nullptr),
-    m_domainPriority(nullptr),
-    m_rfProfileCapabilities(nullptr),
-    m_rfProfileData(nullptr),
-    m_temperatureStatus(nullptr), m_temperatureThresholds(nullptr),
-    m_isVirtualTemperature(nullptr),
-    m_utilizationStatus(nullptr)
+    m_participantManager(nullptr), m_cacheEpoch(0), m_cacheHitCount(0), m_cacheMissCount(0)
 {
+    for (UIntN cacheGroup = 0; cacheGroup < DomainCacheGroup::Max; cacheGroup++)
+    {
+        m_cacheGroupEpoch[cacheGroup] = 0;
+    }
 }
 
 Domain::~Domain(void)
@@ -77,6 +61,7 @@ void Domain::createDomain(UIntN participantIndex, UIntN domainIndex, Participant
         m_domainType = EsifDomainTypeToDptfDomainType(domainDataPtr->fType);
         m_domainFunctionalityVersions = DomainFunctionalityVersions(domainDataPtr->fCapabilityBytes);
         m_arbitrator = new Arbitrator(m_dptfManager);
+        m_participantManager = m_dptfManager->getParticipantManager();
 
         m_dptfManager->getDptfStatus()->clearCache();
         m_theRealParticipant->createDomain(
@@ -144,23 +129,39 @@ std::string Domain::getDomainName(void) const
 
 void Domain::clearDomainCachedData(void)
 {
-    m_dptfManager->getDptfStatus()->clearCache();
-    clearDomainCachedDataActiveControl();
-    clearDomainCachedDataConfigTdpControl();
-    clearDomainCachedDataCoreControl();
-    clearDomainCachedDataDisplayControl();
-    clearDomainCachedDataPerformanceControl();
-    //clearDomainCachedDataPixelClockControl(); *** Nothing to cache ***
-    clearDomainCachedDataPixelClockStatus();
-    clearDomainCachedDataPowerControl();
-    clearDomainCachedDataPowerStatus();
-    clearDomainCachedDataPlatformPowerControl();
-    clearDomainCachedDataPriority();
-    clearDomainCachedDataRfProfileControl();
-    clearDomainCachedDataRfProfileStatus();
-    clearDomainCachedDataTemperature();
-    clearDomainCachedDataUtilizationStatus();
-    clearDomainCachedDataPlatformPowerStatus();
+    EsifMutexHelper esifMutexHelper(&m_cacheMutex);
+    esifMutexHelper.lock();
+
+    m_cacheEpoch++;
+}
+
+std::shared_ptr<XmlNode> Domain::getCacheStatusAsXml(void) const
+{
+    EsifMutexHelper esifMutexHelper(&m_cacheMutex);
+    esifMutexHelper.lock();
+
+    auto cache = XmlNode::createWrapperElement("framework_cache");
+    cache->addChild(XmlNode::createDataElement("hits", StlOverride::to_string(m_cacheHitCount)));
+    cache->addChild(XmlNode::createDataElement("misses", StlOverride::to_string(m_cacheMissCount)));
+    cache->addChild(XmlNode::createDataElement("epoch", StlOverride::to_string(m_cacheEpoch)));
+    return cache;
+}
+
+UInt64 Domain::getCacheEpoch(DomainCacheGroup::Type cacheGroup) const
+{
+    // Called with m_cacheMutex held.  Every epoch only ever increases so the sum changes whenever any of them is
+    // incremented.
+    UInt64 participantManagerEpoch =
+        (m_participantManager != nullptr) ? m_participantManager->getCachedDataEpoch() : 0;
+    return participantManagerEpoch + m_cacheEpoch + m_cacheGroupEpoch[cacheGroup];
+}
+
+void Domain::clearCacheGroup(DomainCacheGroup::Type cacheGroup)
+{
+    EsifMutexHelper esifMutexHelper(&m_cacheMutex);
+    esifMutexHelper.lock();
+
+    m_cacheGroupEpoch[cacheGroup]++;
 }
 
 void Domain::clearArbitrationDataForPolicy(UIntN policyIndex)
@@ -171,31 +172,64 @@ void Domain::clearArbitrationDataForPolicy(UIntN policyIndex)
 //
 // The following macro (FILL_CACHE_AND_RETURN) is in place to remove this code many times:
 //
-//if (m_activeControlStaticCaps == nullptr)
+//EsifMutexHelper esifMutexHelper(&m_cacheMutex);
+//esifMutexHelper.lock();
+//UInt64 epoch = getCacheEpoch(DomainCacheGroup::ActiveControl);
+//if (m_activeControlStaticCaps.isValid(epoch) == true)
 //{
-//    ActiveControlStaticCaps var = m_theRealParticipant->getActiveControlStaticCaps(m_participantIndex, m_domainIndex);
-//    m_activeControlStaticCaps = new ActiveControlStaticCaps(var);
+//    m_cacheHitCount++;
+//    return m_activeControlStaticCaps.get();
 //}
+//m_cacheMissCount++;
+//esifMutexHelper.unlock();
+//auto value = m_theRealParticipant->getActiveControlStaticCaps(m_participantIndex, m_domainIndex);
+//esifMutexHelper.lock();
+//m_activeControlStaticCaps.set(value, epoch);
+//return value;
+//
+// The cache is only locked while it is being read or filled, not while the participant is called.  The value is
+// stored with the epoch from before the call, so it is already stale if the cache was cleared in the meantime.
+// FILL_CACHE_FOR_TYPE_AND_RETURN does the same for values that are cached per control or limit type.
 //
-//return *m_activeControlStaticCaps;
 
-#define FILL_CACHE_AND_RETURN(mv, ct, fn) \
-    if (mv == nullptr) {ct var = m_theRealParticipant->fn(m_participantIndex, m_domainIndex); mv = new ct(var); } \
-    return *mv; \
+#define FILL_CACHE_AND_RETURN(mv, cg, fn) \
+    EsifMutexHelper esifMutexHelper(&m_cacheMutex); \
+    esifMutexHelper.lock(); \
+    UInt64 epoch = getCacheEpoch(cg); \
+    if (mv.isValid(epoch) == true) {m_cacheHitCount++; return mv.get();} \
+    m_cacheMissCount++; \
+    esifMutexHelper.unlock(); \
+    auto value = m_theRealParticipant->fn(m_participantIndex, m_domainIndex); \
+    esifMutexHelper.lock(); \
+    mv.set(value, epoch); \
+    return value; \
+
+#define FILL_CACHE_FOR_TYPE_AND_RETURN(mm, type, cg, fn) \
+    EsifMutexHelper esifMutexHelper(&m_cacheMutex); \
+    esifMutexHelper.lock(); \
+    UInt64 epoch = getCacheEpoch(cg); \
+    auto& mv = mm[type]; \
+    if (mv.isValid(epoch) == true) {m_cacheHitCount++; return mv.get();} \
+    m_cacheMissCount++; \
+    esifMutexHelper.unlock(); \
+    auto value = m_theRealParticipant->fn(m_participantIndex, m_domainIndex, type); \
+    esifMutexHelper.lock(); \
+    mv.set(value, epoch); \
+    return value; \
 
 ActiveControlStaticCaps Domain::getActiveControlStaticCaps(void)
 {
-    FILL_CACHE_AND_RETURN(m_activeControlStaticCaps, ActiveControlStaticCaps, getActiveControlStaticCaps)
+    FILL_CACHE_AND_RETURN(m_activeControlStaticCaps, DomainCacheGroup::ActiveControl, getActiveControlStaticCaps)
 }
 
 ActiveControlStatus Domain::getActiveControlStatus(void)
 {
-    FILL_CACHE_AND_RETURN(m_activeControlStatus, ActiveControlStatus, getActiveControlStatus)
+    FILL_CACHE_AND_RETURN(m_activeControlStatus, DomainCacheGroup::ActiveControl, getActiveControlStatus)
 }
 
 ActiveControlSet Domain::getActiveControlSet(void)
 {
-    FILL_CACHE_AND_RETURN(m_activeControlSet, ActiveControlSet, getActiveControlSet)
+    FILL_CACHE_AND_RETURN(m_activeControlSet, DomainCacheGroup::ActiveControl, getActiveControlSet)
 }
 
 void Domain::setActiveControl(UIntN policyIndex, UIntN controlIndex)
@@ -228,17 +262,17 @@ void Domain::setActiveControl(UIntN policyIndex, const Percentage& fanSpeed)
 
 ConfigTdpControlDynamicCaps Domain::getConfigTdpControlDynamicCaps(void)
 {
-    FILL_CACHE_AND_RETURN(m_configTdpControlDynamicCaps, ConfigTdpControlDynamicCaps, getConfigTdpControlDynamicCaps)
+    FILL_CACHE_AND_RETURN(m_configTdpControlDynamicCaps, DomainCacheGroup::ConfigTdpControl, getConfigTdpControlDynamicCaps)
 }
 
 ConfigTdpControlStatus Domain::getConfigTdpControlStatus(void)
 {
-    FILL_CACHE_AND_RETURN(m_configTdpControlStatus, ConfigTdpControlStatus, getConfigTdpControlStatus)
+    FILL_CACHE_AND_RETURN(m_configTdpControlStatus, DomainCacheGroup::ConfigTdpControl, getConfigTdpControlStatus)
 }
 
 ConfigTdpControlSet Domain::getConfigTdpControlSet(void)
 {
-    FILL_CACHE_AND_RETURN(m_configTdpControlSet, ConfigTdpControlSet, getConfigTdpControlSet)
+    FILL_CACHE_AND_RETURN(m_configTdpControlSet, DomainCacheGroup::ConfigTdpControl, getConfigTdpControlSet)
 }
 
 void Domain::setConfigTdpControl(UIntN policyIndex, UIntN controlIndex)
@@ -259,22 +293,22 @@ void Domain::setConfigTdpControl(UIntN policyIndex, UIntN controlIndex)
 
 CoreControlStaticCaps Domain::getCoreControlStaticCaps(void)
 {
-    FILL_CACHE_AND_RETURN(m_coreControlStaticCaps, CoreControlStaticCaps, getCoreControlStaticCaps)
+    FILL_CACHE_AND_RETURN(m_coreControlStaticCaps, DomainCacheGroup::CoreControl, getCoreControlStaticCaps)
 }
 
 CoreControlDynamicCaps Domain::getCoreControlDynamicCaps(void)
 {
-    FILL_CACHE_AND_RETURN(m_coreControlDynamicCaps, CoreControlDynamicCaps, getCoreControlDynamicCaps)
+    FILL_CACHE_AND_RETURN(m_coreControlDynamicCaps, DomainCacheGroup::CoreControl, getCoreControlDynamicCaps)
 }
 
 CoreControlLpoPreference Domain::getCoreControlLpoPreference(void)
 {
-    FILL_CACHE_AND_RETURN(m_coreControlLpoPreference, CoreControlLpoPreference, getCoreControlLpoPreference)
+    FILL_CACHE_AND_RETURN(m_coreControlLpoPreference, DomainCacheGroup::CoreControl, getCoreControlLpoPreference)
 }
 
 CoreControlStatus Domain::getCoreControlStatus(void)
 {
-    FILL_CACHE_AND_RETURN(m_coreControlStatus, CoreControlStatus, getCoreControlStatus)
+    FILL_CACHE_AND_RETURN(m_coreControlStatus, DomainCacheGroup::CoreControl, getCoreControlStatus)
 }
 
 void Domain::setActiveCoreControl(UIntN policyIndex, const CoreControlStatus& coreControlStatus)
@@ -293,7 +327,7 @@ void Domain::setActiveCoreControl(UIntN policyIndex, const CoreControlStatus& co
 
 DisplayControlDynamicCaps Domain::getDisplayControlDynamicCaps(void)
 {
-    FILL_CACHE_AND_RETURN(m_displayControlDynamicCaps, DisplayControlDynamicCaps, getDisplayControlDynamicCaps)
+    FILL_CACHE_AND_RETURN(m_displayControlDynamicCaps, DomainCacheGroup::DisplayControl, getDisplayControlDynamicCaps)
 }
 
 UIntN Domain::getUserPreferredDisplayIndex(void)
@@ -308,12 +342,12 @@ Bool Domain::isUserPreferredIndexModified()
 
 DisplayControlStatus Domain::getDisplayControlStatus(void)
 {
-    FILL_CACHE_AND_RETURN(m_displayControlStatus, DisplayControlStatus, getDisplayControlStatus)
+    FILL_CACHE_AND_RETURN(m_displayControlStatus, DomainCacheGroup::DisplayControl, getDisplayControlStatus)
 }
 
 DisplayControlSet Domain::getDisplayControlSet(void)
 {
-    FILL_CACHE_AND_RETURN(m_displayControlSet, DisplayControlSet, getDisplayControlSet)
+    FILL_CACHE_AND_RETURN(m_displayControlSet, DomainCacheGroup::DisplayControl, getDisplayControlSet)
 }
 
 void Domain::setDisplayControl(UIntN policyIndex, UIntN displayControlIndex)
@@ -350,22 +384,22 @@ void Domain::setDisplayCapsLock(UIntN policyIndex, Bool lock)
 
 PerformanceControlStaticCaps Domain::getPerformanceControlStaticCaps(void)
 {
-    FILL_CACHE_AND_RETURN(m_performanceControlStaticCaps, PerformanceControlStaticCaps, getPerformanceControlStaticCaps)
+    FILL_CACHE_AND_RETURN(m_performanceControlStaticCaps, DomainCacheGroup::PerformanceControl, getPerformanceControlStaticCaps)
 }
 
 PerformanceControlDynamicCaps Domain::getPerformanceControlDynamicCaps(void)
 {
-    FILL_CACHE_AND_RETURN(m_performanceControlDynamicCaps, PerformanceControlDynamicCaps, getPerformanceControlDynamicCaps)
+    FILL_CACHE_AND_RETURN(m_performanceControlDynamicCaps, DomainCacheGroup::PerformanceControl, getPerformanceControlDynamicCaps)
 }
 
 PerformanceControlStatus Domain::getPerformanceControlStatus(void)
 {
-    FILL_CACHE_AND_RETURN(m_performanceControlStatus, PerformanceControlStatus, getPerformanceControlStatus)
+    FILL_CACHE_AND_RETURN(m_performanceControlStatus, DomainCacheGroup::PerformanceControl, getPerformanceControlStatus)
 }
 
 PerformanceControlSet Domain::getPerformanceControlSet(void)
 {
-    FILL_CACHE_AND_RETURN(m_performanceControlSet, PerformanceControlSet, getPerformanceControlSet)
+    FILL_CACHE_AND_RETURN(m_performanceControlSet, DomainCacheGroup::PerformanceControl, getPerformanceControlSet)
 }
 
 void Domain::setPerformanceControl(UIntN policyIndex, UIntN performanceControlIndex)
@@ -415,17 +449,17 @@ void Domain::setPixelClockControl(UIntN policyIndex, const PixelClockDataSet& pi
 
 PixelClockCapabilities Domain::getPixelClockCapabilities(void)
 {
-    FILL_CACHE_AND_RETURN(m_pixelClockCapabilities, PixelClockCapabilities, getPixelClockCapabilities);
+    FILL_CACHE_AND_RETURN(m_pixelClockCapabilities, DomainCacheGroup::PixelClockStatus, getPixelClockCapabilities);
 }
 
 PixelClockDataSet Domain::getPixelClockDataSet(void)
 {
-    FILL_CACHE_AND_RETURN(m_pixelClockDataSet, PixelClockDataSet, getPixelClockDataSet);
+    FILL_CACHE_AND_RETURN(m_pixelClockDataSet, DomainCacheGroup::PixelClockStatus, getPixelClockDataSet);
 }
 
 PowerControlDynamicCapsSet Domain::getPowerControlDynamicCapsSet(void)
 {
-    FILL_CACHE_AND_RETURN(m_powerControlDynamicCapsSet, PowerControlDynamicCapsSet, getPowerControlDynamicCapsSet)
+    FILL_CACHE_AND_RETURN(m_powerControlDynamicCapsSet, DomainCacheGroup::PowerControl, getPowerControlDynamicCapsSet)
 }
 
 void Domain::setPowerControlDynamicCapsSet(UIntN policyIndex, PowerControlDynamicCapsSet capsSet)
@@ -442,24 +476,12 @@ void Domain::setPowerControlDynamicCapsSet(UIntN policyIndex, PowerControlDynami
 
 Bool Domain::isPowerLimitEnabled(PowerControlType::Type controlType)
 {
-    auto enabled = m_powerLimitEnabled.find(controlType);
-    if (enabled == m_powerLimitEnabled.end())
-    {
-        m_powerLimitEnabled[controlType] =
-            m_theRealParticipant->isPowerLimitEnabled(m_participantIndex, m_domainIndex, controlType);
-    }
-    return m_powerLimitEnabled.at(controlType);
+    FILL_CACHE_FOR_TYPE_AND_RETURN(m_powerLimitEnabled, controlType, DomainCacheGroup::PowerControl, isPowerLimitEnabled)
 }
 
 Power Domain::getPowerLimit(PowerControlType::Type controlType)
 {
-    auto limit = m_powerLimit.find(controlType);
-    if (limit == m_powerLimit.end())
-    {
-        m_powerLimit[controlType] =
-            m_theRealParticipant->getPowerLimit(m_participantIndex, m_domainIndex, controlType);
-    }
-    return m_powerLimit.at(controlType);
+    FILL_CACHE_FOR_TYPE_AND_RETURN(m_powerLimit, controlType, DomainCacheGroup::PowerControl, getPowerLimit)
 }
 
 void Domain::setPowerLimit(UIntN policyIndex, PowerControlType::Type controlType, const Power& powerLimit)
@@ -483,13 +505,7 @@ void Domain::setPowerLimitIgnoringCaps(UIntN policyIndex, PowerControlType::Type
 
 TimeSpan Domain::getPowerLimitTimeWindow(PowerControlType::Type controlType)
 {
-    auto limit = m_powerLimitTimeWindow.find(controlType);
-    if (limit == m_powerLimitTimeWindow.end())
-    {
-        m_powerLimitTimeWindow[controlType] =
-            m_theRealParticipant->getPowerLimitTimeWindow(m_participantIndex, m_domainIndex, controlType);
-    }
-    return m_powerLimitTimeWindow.at(controlType);
+    FILL_CACHE_FOR_TYPE_AND_RETURN(m_powerLimitTimeWindow, controlType, DomainCacheGroup::PowerControl, getPowerLimitTimeWindow)
 }
 
 void Domain::setPowerLimitTimeWindow(UIntN policyIndex, PowerControlType::Type controlType, const TimeSpan& timeWindow)
@@ -513,13 +529,7 @@ void Domain::setPowerLimitTimeWindowIgnoringCaps(UIntN policyIndex, PowerControl
 
 Percentage Domain::getPowerLimitDutyCycle(PowerControlType::Type controlType)
 {
-    auto limit = m_powerLimitDutyCycle.find(controlType);
-    if (limit == m_powerLimitDutyCycle.end())
-    {
-        m_powerLimitDutyCycle[controlType] =
-            m_theRealParticipant->getPowerLimitDutyCycle(m_participantIndex, m_domainIndex, controlType);
-    }
-    return m_powerLimitDutyCycle.at(controlType);
+    FILL_CACHE_FOR_TYPE_AND_RETURN(m_powerLimitDutyCycle, controlType, DomainCacheGroup::PowerControl, getPowerLimitDutyCycle)
 }
 
 void Domain::setPowerLimitDutyCycle(UIntN policyIndex, PowerControlType::Type controlType, const Percentage& dutyCycle)
@@ -547,7 +557,7 @@ void Domain::setPowerCapsLock(UIntN policyIndex, Bool lock)
 
 PowerStatus Domain::getPowerStatus(void)
 {
-    FILL_CACHE_AND_RETURN(m_powerStatus, PowerStatus, getPowerStatus)
+    FILL_CACHE_AND_RETURN(m_powerStatus, DomainCacheGroup::PowerStatus, getPowerStatus)
 }
 
 Power Domain::getAveragePower(const PowerControlDynamicCaps& capabilities)
@@ -557,24 +567,12 @@ Power Domain::getAveragePower(const PowerControlDynamicCaps& capabilities)
 
 Bool Domain::isPlatformPowerLimitEnabled(PlatformPowerLimitType::Type limitType)
 {
-    auto enabled = m_platformPowerLimitEnabled.find(limitType);
-    if (enabled == m_platformPowerLimitEnabled.end())
-    {
-        m_platformPowerLimitEnabled[limitType] =
-            m_theRealParticipant->isPlatformPowerLimitEnabled(m_participantIndex, m_domainIndex, limitType);
-    }
-    return m_platformPowerLimitEnabled.at(limitType);
+    FILL_CACHE_FOR_TYPE_AND_RETURN(m_platformPowerLimitEnabled, limitType, DomainCacheGroup::PlatformPowerControl, isPlatformPowerLimitEnabled)
 }
 
 Power Domain::getPlatformPowerLimit(PlatformPowerLimitType::Type limitType)
 {
-    auto limit = m_platformPowerLimit.find(limitType);
-    if (limit == m_platformPowerLimit.end())
-    {
-        m_platformPowerLimit[limitType] = 
-            m_theRealParticipant->getPlatformPowerLimit(m_participantIndex, m_domainIndex, limitType);
-    }
-    return m_platformPowerLimit.at(limitType);
+    FILL_CACHE_FOR_TYPE_AND_RETURN(m_platformPowerLimit, limitType, DomainCacheGroup::PlatformPowerControl, getPlatformPowerLimit)
 }
 
 void Domain::setPlatformPowerLimit(PlatformPowerLimitType::Type limitType, const Power& powerLimit)
@@ -585,13 +583,7 @@ void Domain::setPlatformPowerLimit(PlatformPowerLimitType::Type limitType, const
 
 TimeSpan Domain::getPlatformPowerLimitTimeWindow(PlatformPowerLimitType::Type limitType)
 {
-    auto timeWindow = m_platformPowerLimitTimeWindow.find(limitType);
-    if (timeWindow == m_platformPowerLimitTimeWindow.end())
-    {
-        m_platformPowerLimitTimeWindow[limitType] =
-            m_theRealParticipant->getPlatformPowerLimitTimeWindow(m_participantIndex, m_domainIndex, limitType);
-    }
-    return m_platformPowerLimitTimeWindow.at(limitType);
+    FILL_CACHE_FOR_TYPE_AND_RETURN(m_platformPowerLimitTimeWindow, limitType, DomainCacheGroup::PlatformPowerControl, getPlatformPowerLimitTimeWindow)
 }
 
 void Domain::setPlatformPowerLimitTimeWindow(PlatformPowerLimitType::Type limitType, const TimeSpan& timeWindow)
@@ -602,13 +594,7 @@ void Domain::setPlatformPowerLimitTimeWindow(PlatformPowerLimitType::Type limitT
 
 Percentage Domain::getPlatformPowerLimitDutyCycle(PlatformPowerLimitType::Type limitType)
 {
-    auto dutyCycle = m_platformPowerLimitDutyCycle.find(limitType);
-    if (dutyCycle == m_platformPowerLimitDutyCycle.end())
-    {
-        m_platformPowerLimitDutyCycle[limitType] =
-            m_theRealParticipant->getPlatformPowerLimitDutyCycle(m_participantIndex, m_domainIndex, limitType);
-    }
-    return m_platformPowerLimitDutyCycle.at(limitType);
+    FILL_CACHE_FOR_TYPE_AND_RETURN(m_platformPowerLimitDutyCycle, limitType, DomainCacheGroup::PlatformPowerControl, getPlatformPowerLimitDutyCycle)
 }
 
 void Domain::setPlatformPowerLimitDutyCycle(PlatformPowerLimitType::Type limitType, const Percentage& dutyCycle)
@@ -619,70 +605,62 @@ void Domain::setPlatformPowerLimitDutyCycle(PlatformPowerLimitType::Type limitTy
 
 Power Domain::getMaxBatteryPower(void)
 {
-    FILL_CACHE_AND_RETURN(m_maxBatteryPower, Power, getMaxBatteryPower);
+    FILL_CACHE_AND_RETURN(m_maxBatteryPower, DomainCacheGroup::PlatformPowerStatus, getMaxBatteryPower);
 }
 
 Power Domain::getPlatformRestOfPower(void)
 {
-    FILL_CACHE_AND_RETURN(m_platformRestOfPower, Power, getPlatformRestOfPower);
+    FILL_CACHE_AND_RETURN(m_platformRestOfPower, DomainCacheGroup::PlatformPowerStatus, getPlatformRestOfPower);
 }
 
 Power Domain::getAdapterPowerRating(void)
 {
-    FILL_CACHE_AND_RETURN(m_adapterRating, Power, getAdapterPowerRating);
+    FILL_CACHE_AND_RETURN(m_adapterRating, DomainCacheGroup::PlatformPowerStatus, getAdapterPowerRating);
 }
 
 DptfBuffer Domain::getBatteryStatus(void)
 {
-    if (m_batteryStatusBuffer.size() == 0)
-    {
-        m_batteryStatusBuffer = m_theRealParticipant->getBatteryStatus(m_participantIndex, m_domainIndex);
-    }
-    return m_batteryStatusBuffer;
+    FILL_CACHE_AND_RETURN(m_batteryStatusBuffer, DomainCacheGroup::PlatformPowerStatus, getBatteryStatus)
 }
 
 DptfBuffer Domain::getBatteryInformation(void)
 {
-    if (m_batteryInformationBuffer.size() == 0)
-    {
-        m_batteryInformationBuffer = m_theRealParticipant->getBatteryInformation(m_participantIndex, m_domainIndex);
-    }
-    return m_batteryInformationBuffer;
+    FILL_CACHE_AND_RETURN(m_batteryInformationBuffer, DomainCacheGroup::PlatformPowerStatus, getBatteryInformation)
 }
 
 PlatformPowerSource::Type Domain::getPlatformPowerSource(void)
 {
-    FILL_CACHE_AND_RETURN(m_platformPowerSource, PlatformPowerSource::Type, getPlatformPowerSource);
+    FILL_CACHE_AND_RETURN(m_platformPowerSource, DomainCacheGroup::PlatformPowerStatus, getPlatformPowerSource);
 }
 
 ChargerType::Type Domain::getChargerType(void)
 {
-    FILL_CACHE_AND_RETURN(m_chargerType, ChargerType::Type, getChargerType);
+    FILL_CACHE_AND_RETURN(m_chargerType, DomainCacheGroup::PlatformPowerStatus, getChargerType);
 }
 
 Power Domain::getACPeakPower(void)
 {
-    FILL_CACHE_AND_RETURN(m_acPeakPower, Power, getACPeakPower);
+    FILL_CACHE_AND_RETURN(m_acPeakPower, DomainCacheGroup::PlatformPowerStatus, getACPeakPower);
 }
 
 TimeSpan Domain::getACPeakTimeWindow(void)
 {
-    FILL_CACHE_AND_RETURN(m_acPeakTimeWindow, TimeSpan, getACPeakTimeWindow);
+    FILL_CACHE_AND_RETURN(m_acPeakTimeWindow, DomainCacheGroup::PlatformPowerStatus, getACPeakTimeWindow);
 }
 
 Power Domain::getPlatformBatterySteadyState(void)
 {
-    FILL_CACHE_AND_RETURN(m_batterySteadyState, Power, getPlatformBatterySteadyState);
+    FILL_CACHE_AND_RETURN(m_batterySteadyState, DomainCacheGroup::PlatformPowerStatus, getPlatformBatterySteadyState);
 }
 
 DomainPriority Domain::getDomainPriority(void)
 {
-    FILL_CACHE_AND_RETURN(m_domainPriority, DomainPriority, getDomainPriority)
+    FILL_CACHE_AND_RETURN(m_domainPriority, DomainCacheGroup::Priority, getDomainPriority)
 }
 
 RfProfileCapabilities Domain::getRfProfileCapabilities(void)
 {
-    FILL_CACHE_AND_RETURN(m_rfProfileCapabilities, RfProfileCapabilities, getRfProfileCapabilities);
+    FILL_CACHE_AND_RETURN(m_rfProfileCapabilities, DomainCacheGroup::RfProfileControl, getRfProfileCapabilities);
 }
 
 void Domain::setRfProfileCenterFrequency(UIntN policyIndex, const Frequency& centerFrequency)
@@ -696,17 +674,17 @@ void Domain::setRfProfileCenterFrequency(UIntN policyIndex, const Frequency& cen
 
 RfProfileData Domain::getRfProfileData(void)
 {
-    FILL_CACHE_AND_RETURN(m_rfProfileData, RfProfileData, getRfProfileData);
+    FILL_CACHE_AND_RETURN(m_rfProfileData, DomainCacheGroup::RfProfileStatus, getRfProfileData);
 }
 
 TemperatureStatus Domain::getTemperatureStatus(void)
 {
-    FILL_CACHE_AND_RETURN(m_temperatureStatus, TemperatureStatus, getTemperatureStatus)
+    FILL_CACHE_AND_RETURN(m_temperatureStatus, DomainCacheGroup::Temperature, getTemperatureStatus)
 }
 
 TemperatureThresholds Domain::getTemperatureThresholds(void)
 {
-    FILL_CACHE_AND_RETURN(m_temperatureThresholds, TemperatureThresholds, getTemperatureThresholds)
+    FILL_CACHE_AND_RETURN(m_temperatureThresholds, DomainCacheGroup::Temperature, getTemperatureThresholds)
 }
 
 void Domain::setTemperatureThresholds(UIntN policyIndex, const TemperatureThresholds& temperatureThresholds)
@@ -720,35 +698,27 @@ void Domain::setTemperatureThresholds(UIntN policyIndex, const TemperatureThresh
 
     // DO NOT invalidate the temperature status (m_temperatureStatus)
     // Only invalidate the temperature thresholds.
-    DELETE_MEMORY_TC(m_temperatureThresholds);
+    m_temperatureThresholds.invalidate();
 }
 
 UtilizationStatus Domain::getUtilizationStatus(void)
 {
-    FILL_CACHE_AND_RETURN(m_utilizationStatus, UtilizationStatus, getUtilizationStatus)
+    FILL_CACHE_AND_RETURN(m_utilizationStatus, DomainCacheGroup::UtilizationStatus, getUtilizationStatus)
 }
 
 DptfBuffer Domain::getVirtualSensorCalibrationTable(void)
 {
-    if (m_virtualSensorCalculationTableBuffer.size() == 0)
-    {
-        m_virtualSensorCalculationTableBuffer = m_theRealParticipant->getCalibrationTable(m_participantIndex, m_domainIndex);
-    }
-    return m_virtualSensorCalculationTableBuffer;
+    FILL_CACHE_AND_RETURN(m_virtualSensorCalculationTableBuffer, DomainCacheGroup::Temperature, getCalibrationTable)
 }
 
 DptfBuffer Domain::getVirtualSensorPollingTable(void)
 {
-    if (m_virtualSensorPollingTableBuffer.size() == 0)
-    {
-        m_virtualSensorPollingTableBuffer = m_theRealParticipant->getPollingTable(m_participantIndex, m_domainIndex);
-    }
-    return m_virtualSensorPollingTableBuffer;
+    FILL_CACHE_AND_RETURN(m_virtualSensorPollingTableBuffer, DomainCacheGroup::Temperature, getPollingTable)
 }
 
 Bool Domain::isVirtualTemperature(void)
 {
-    FILL_CACHE_AND_RETURN(m_isVirtualTemperature, Bool, isVirtualTemperature);
+    FILL_CACHE_AND_RETURN(m_isVirtualTemperature, DomainCacheGroup::Temperature, isVirtualTemperature);
 }
 
 void Domain::setVirtualTemperature(const Temperature& temperature)
@@ -759,114 +729,81 @@ void Domain::setVirtualTemperature(const Temperature& temperature)
 
 void Domain::clearDomainCachedDataActiveControl()
 {
-    DELETE_MEMORY_TC(m_activeControlStaticCaps);
-    DELETE_MEMORY_TC(m_activeControlStatus);
-    DELETE_MEMORY_TC(m_activeControlSet);
+    clearCacheGroup(DomainCacheGroup::ActiveControl);
 }
 
 void Domain::clearDomainCachedDataConfigTdpControl()
 {
-    DELETE_MEMORY_TC(m_configTdpControlDynamicCaps);
-    DELETE_MEMORY_TC(m_configTdpControlStatus);
-    DELETE_MEMORY_TC(m_configTdpControlSet);
+    clearCacheGroup(DomainCacheGroup::ConfigTdpControl);
 }
 
 void Domain::clearDomainCachedDataCoreControl()
 {
-    DELETE_MEMORY_TC(m_coreControlStaticCaps);
-    DELETE_MEMORY_TC(m_coreControlDynamicCaps);
-    DELETE_MEMORY_TC(m_coreControlLpoPreference);
-    DELETE_MEMORY_TC(m_coreControlStatus);
+    clearCacheGroup(DomainCacheGroup::CoreControl);
 }
 
 void Domain::clearDomainCachedDataDisplayControl()
 {
-    DELETE_MEMORY_TC(m_displayControlDynamicCaps);
-    DELETE_MEMORY_TC(m_displayControlStatus);
-    DELETE_MEMORY_TC(m_displayControlSet);
+    clearCacheGroup(DomainCacheGroup::DisplayControl);
 }
 
 void Domain::clearDomainCachedDataPerformanceControl()
 {
-    DELETE_MEMORY_TC(m_performanceControlStaticCaps);
-    DELETE_MEMORY_TC(m_performanceControlDynamicCaps);
-    DELETE_MEMORY_TC(m_performanceControlStatus);
-    DELETE_MEMORY_TC(m_performanceControlSet);
+    clearCacheGroup(DomainCacheGroup::PerformanceControl);
 }
 
 // *** Nothing to cache ***
 //void Domain::clearDomainCachedDataPixelClockControl()
 //{
-//    DELETE_MEMORY_TC();
+//    clearCacheGroup(DomainCacheGroup::PixelClockControl);
 //}
 
 void Domain::clearDomainCachedDataPixelClockStatus()
 {
-    DELETE_MEMORY_TC(m_pixelClockCapabilities);
-    DELETE_MEMORY_TC(m_pixelClockDataSet);
+    clearCacheGroup(DomainCacheGroup::PixelClockStatus);
 }
 
 void Domain::clearDomainCachedDataPowerControl()
 {
-    DELETE_MEMORY_TC(m_powerControlDynamicCapsSet);
-    m_powerLimitEnabled.clear();
-    m_powerLimit.clear();
-    m_powerLimitTimeWindow.clear();
-    m_powerLimitDutyCycle.clear();
+    clearCacheGroup(DomainCacheGroup::PowerControl);
 }
 
 void Domain::clearDomainCachedDataPowerStatus()
 {
-    DELETE_MEMORY_TC(m_powerStatus);
+    clearCacheGroup(DomainCacheGroup::PowerStatus);
 }
 
 void Domain::clearDomainCachedDataPriority()
 {
-    DELETE_MEMORY_TC(m_domainPriority);
+    clearCacheGroup(DomainCacheGroup::Priority);
 }
 
 void Domain::clearDomainCachedDataRfProfileControl()
 {
-    DELETE_MEMORY_TC(m_rfProfileCapabilities);
+    clearCacheGroup(DomainCacheGroup::RfProfileControl);
 }
 
 void Domain::clearDomainCachedDataRfProfileStatus()
 {
-    DELETE_MEMORY_TC(m_rfProfileData);
+    clearCacheGroup(DomainCacheGroup::RfProfileStatus);
 }
 
 void Domain::clearDomainCachedDataTemperature()
 {
-    DELETE_MEMORY_TC(m_temperatureStatus);
-    DELETE_MEMORY_TC(m_temperatureThresholds);
-    DELETE_MEMORY_TC(m_isVirtualTemperature);
-    m_virtualSensorCalculationTableBuffer.allocate(0);
-    m_virtualSensorPollingTableBuffer.allocate(0);
+    clearCacheGroup(DomainCacheGroup::Temperature);
 }
 
 void Domain::clearDomainCachedDataUtilizationStatus()
 {
-    DELETE_MEMORY_TC(m_utilizationStatus);
+    clearCacheGroup(DomainCacheGroup::UtilizationStatus);
 }
 
 void Domain::clearDomainCachedDataPlatformPowerStatus()
 {
-    DELETE_MEMORY_TC(m_maxBatteryPower);
-    DELETE_MEMORY_TC(m_adapterRating);
-    DELETE_MEMORY_TC(m_platformRestOfPower);
-    DELETE_MEMORY_TC(m_acPeakPower);
-    DELETE_MEMORY_TC(m_acPeakTimeWindow);
-    DELETE_MEMORY_TC(m_platformPowerSource);
-    DELETE_MEMORY_TC(m_chargerType);
-    DELETE_MEMORY_TC(m_batterySteadyState);
-    m_batteryStatusBuffer.allocate(0);
-    m_batteryInformationBuffer.allocate(0);
+    clearCacheGroup(DomainCacheGroup::PlatformPowerStatus);
 }
 
 void Domain::clearDomainCachedDataPlatformPowerControl()
 {
-    m_platformPowerLimitEnabled.clear();
-    m_platformPowerLimit.clear();
-    m_platformPowerLimitTimeWindow.clear();
-    m_platformPowerLimitDutyCycle.clear();
+    clearCacheGroup(DomainCacheGroup::PlatformPowerControl);
 }
@@ -23,6 +23,35 @@
 #include "esif_sdk_iface_app.h"
 #include "Arbitrator.h"
 #include "PlatformPowerLimitType.h"
+#include "EpochCachedValue.h"
+#include "EsifMutex.h"
+
+class ParticipantManagerInterface;
+class XmlNode;
+
+// Groups of cached data that are invalidated together when a control is changed.
+namespace DomainCacheGroup
+{
+    enum Type
+    {
+        ActiveControl,
+        ConfigTdpControl,
+        CoreControl,
+        DisplayControl,
+        PerformanceControl,
+        PixelClockStatus,
+        PowerControl,
+        PowerStatus,
+        PlatformPowerControl,
+        Priority,
+        RfProfileControl,
+        RfProfileStatus,
+        Temperature,
+        UtilizationStatus,
+        PlatformPowerStatus,
+        Max
+    };
+}
 
 class Domain
 {
@@ -46,6 +75,9 @@ public:
     // actual domain to clear its cache.
     void clearDomainCachedData(void);
 
+    // Cache hit/miss counts for the participant status
+    std::shared_ptr<XmlNode> getCacheStatusAsXml(void) const;
+
     void clearArbitrationDataForPolicy(UIntN policyIndex);
 
     //
@@ -187,90 +219,102 @@ private:
     Arbitrator* m_arbitrator;
 
     //
-    // Cached data.
-    // FIXME:  consider adding a dirty bit to speed up clearing the cache.
+    // Cached data.  Each value is stamped with the cache epoch it was read in.  Clearing the cache increments the
+    // epoch of the domain (or of a single group) so nothing has to be deleted.  ParticipantManager also has an epoch
+    // that clears the cached data for all domains at once.  m_cacheMutex guards the epochs, the counters and the
+    // cached values.
     //
 
+    ParticipantManagerInterface* m_participantManager;
+    mutable EsifMutex m_cacheMutex;
+    UInt64 m_cacheEpoch;
+    UInt64 m_cacheGroupEpoch[DomainCacheGroup::Max];
+    UInt64 m_cacheHitCount;
+    UInt64 m_cacheMissCount;
+
+    UInt64 getCacheEpoch(DomainCacheGroup::Type cacheGroup) const;
+    void clearCacheGroup(DomainCacheGroup::Type cacheGroup);
+
     // Active Controls
-    ActiveControlStaticCaps* m_activeControlStaticCaps;
-    ActiveControlStatus* m_activeControlStatus;
-    ActiveControlSet* m_activeControlSet;
+    EpochCachedValue<ActiveControlStaticCaps> m_activeControlStaticCaps;
+    EpochCachedValue<ActiveControlStatus> m_activeControlStatus;
+    EpochCachedValue<ActiveControlSet> m_activeControlSet;
 
     // ConfigTdp controls
-    ConfigTdpControlDynamicCaps* m_configTdpControlDynamicCaps;
-    ConfigTdpControlStatus* m_configTdpControlStatus;
-    ConfigTdpControlSet* m_configTdpControlSet;
+    EpochCachedValue<ConfigTdpControlDynamicCaps> m_configTdpControlDynamicCaps;
+    EpochCachedValue<ConfigTdpControlStatus> m_configTdpControlStatus;
+    EpochCachedValue<ConfigTdpControlSet> m_configTdpControlSet;
 
     // Core controls
-    CoreControlStaticCaps* m_coreControlStaticCaps;
-    CoreControlDynamicCaps* m_coreControlDynamicCaps;
-    CoreControlLpoPreference* m_coreControlLpoPreference;
-    CoreControlStatus* m_coreControlStatus;
+    EpochCachedValue<CoreControlStaticCaps> m_coreControlStaticCaps;
+    EpochCachedValue<CoreControlDynamicCaps> m_coreControlDynamicCaps;
+    EpochCachedValue<CoreControlLpoPreference> m_coreControlLpoPreference;
+    EpochCachedValue<CoreControlStatus> m_coreControlStatus;
 
     // Display controls
-    DisplayControlDynamicCaps* m_displayControlDynamicCaps;
-    DisplayControlStatus* m_displayControlStatus;
-    DisplayControlSet* m_displayControlSet;
+    EpochCachedValue<DisplayControlDynamicCaps> m_displayControlDynamicCaps;
+    EpochCachedValue<DisplayControlStatus> m_displayControlStatus;
+    EpochCachedValue<DisplayControlSet> m_displayControlSet;
 
     // Performance controls
-    PerformanceControlStaticCaps* m_performanceControlStaticCaps;
-    PerformanceControlDynamicCaps* m_performanceControlDynamicCaps;
-    PerformanceControlStatus* m_performanceControlStatus;
-    PerformanceControlSet* m_performanceControlSet;
+    EpochCachedValue<PerformanceControlStaticCaps> m_performanceControlStaticCaps;
+    EpochCachedValue<PerformanceControlDynamicCaps> m_performanceControlDynamicCaps;
+    EpochCachedValue<PerformanceControlStatus> m_performanceControlStatus;
+    EpochCachedValue<PerformanceControlSet> m_performanceControlSet;
 
     // Pixel Clock Control
     // *** nothing to cache
 
     // Pixel Clock Status
-    PixelClockCapabilities* m_pixelClockCapabilities;
-    PixelClockDataSet* m_pixelClockDataSet;
+    EpochCachedValue<PixelClockCapabilities> m_pixelClockCapabilities;
+    EpochCachedValue<PixelClockDataSet> m_pixelClockDataSet;
 
     // Power controls
-    PowerControlDynamicCapsSet* m_powerControlDynamicCapsSet;
-    std::map<PowerControlType::Type, Bool> m_powerLimitEnabled;
-    std::map<PowerControlType::Type, Power> m_powerLimit;
-    std::map<PowerControlType::Type, TimeSpan> m_powerLimitTimeWindow;
-    std::map<PowerControlType::Type, Percentage> m_powerLimitDutyCycle;
+    EpochCachedValue<PowerControlDynamicCapsSet> m_powerControlDynamicCapsSet;
+    std::map<PowerControlType::Type, EpochCachedValue<Bool>> m_powerLimitEnabled;
+    std::map<PowerControlType::Type, EpochCachedValue<Power>> m_powerLimit;
+    std::map<PowerControlType::Type, EpochCachedValue<TimeSpan>> m_powerLimitTimeWindow;
+    std::map<PowerControlType::Type, EpochCachedValue<Percentage>> m_powerLimitDutyCycle;
 
     // Power status
-    PowerStatus* m_powerStatus;
+    EpochCachedValue<PowerStatus> m_powerStatus;
 
     // Platform Power Controls
-    std::map<PlatformPowerLimitType::Type, Bool> m_platformPowerLimitEnabled;
-    std::map<PlatformPowerLimitType::Type, Power> m_platformPowerLimit;
-    std::map<PlatformPowerLimitType::Type, TimeSpan> m_platformPowerLimitTimeWindow;
-    std::map<PlatformPowerLimitType::Type, Percentage> m_platformPowerLimitDutyCycle;
+    std::map<PlatformPowerLimitType::Type, EpochCachedValue<Bool>> m_platformPowerLimitEnabled;
+    std::map<PlatformPowerLimitType::Type, EpochCachedValue<Power>> m_platformPowerLimit;
+    std::map<PlatformPowerLimitType::Type, EpochCachedValue<TimeSpan>> m_platformPowerLimitTimeWindow;
+    std::map<PlatformPowerLimitType::Type, EpochCachedValue<Percentage>> m_platformPowerLimitDutyCycle;
 
     // Platform Power Status
-    Power* m_maxBatteryPower;
-    Power* m_adapterRating;
-    Power* m_platformRestOfPower;
-    Power* m_acPeakPower;
-    TimeSpan* m_acPeakTimeWindow;
-    PlatformPowerSource::Type* m_platformPowerSource;
-    ChargerType::Type* m_chargerType;
-    DptfBuffer m_batteryStatusBuffer;
-    DptfBuffer m_batteryInformationBuffer;
-    Power* m_batterySteadyState;
+    EpochCachedValue<Power> m_maxBatteryPower;
+    EpochCachedValue<Power> m_adapterRating;
+    EpochCachedValue<Power> m_platformRestOfPower;
+    EpochCachedValue<Power> m_acPeakPower;
+    EpochCachedValue<TimeSpan> m_acPeakTimeWindow;
+    EpochCachedValue<PlatformPowerSource::Type> m_platformPowerSource;
+    EpochCachedValue<ChargerType::Type> m_chargerType;
+    EpochCachedValue<DptfBuffer> m_batteryStatusBuffer;
+    EpochCachedValue<DptfBuffer> m_batteryInformationBuffer;
+    EpochCachedValue<Power> m_batterySteadyState;
 
     // priority
-    DomainPriority* m_domainPriority;
+    EpochCachedValue<DomainPriority> m_domainPriority;
 
     // RF Profile Control
-    RfProfileCapabilities* m_rfProfileCapabilities;
+    EpochCachedValue<RfProfileCapabilities> m_rfProfileCapabilities;
 
     // RF Profile Status
-    RfProfileData* m_rfProfileData;
+    EpochCachedValue<RfProfileData> m_rfProfileData;
 
     // temperature
-    TemperatureStatus* m_temperatureStatus;
-    TemperatureThresholds* m_temperatureThresholds;
-    DptfBuffer m_virtualSensorCalculationTableBuffer;
-    DptfBuffer m_virtualSensorPollingTableBuffer;
-    Bool* m_isVirtualTemperature;
+    EpochCachedValue<TemperatureStatus> m_temperatureStatus;
+    EpochCachedValue<TemperatureThresholds> m_temperatureThresholds;
+    EpochCachedValue<DptfBuffer> m_virtualSensorCalculationTableBuffer;
+    EpochCachedValue<DptfBuffer> m_virtualSensorPollingTableBuffer;
+    EpochCachedValue<Bool> m_isVirtualTemperature;
 
     // utilization
-    UtilizationStatus* m_utilizationStatus;
+    EpochCachedValue<UtilizationStatus> m_utilizationStatus;
 
     void clearDomainCachedDataActiveControl();
     void clearDomainCachedDataConfigTdpControl();
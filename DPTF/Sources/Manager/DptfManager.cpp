@@ -27,11 +27,12 @@
 #include "DptfStatus.h"
 #include "EsifDataString.h"
 #include "EsifAppServices.h"
+#include "RecordingEsifAppServices.h"
 #include "StringParser.h"
 
 DptfManager::DptfManager(void) : m_dptfManagerCreateStarted(false), m_dptfManagerCreateFinished(false),
 m_dptfShuttingDown(false), m_workItemQueueManagerCreated(false), m_dptfEnabled(false), m_esifAppServices(nullptr), 
-m_esifServices(nullptr), m_workItemQueueManager(nullptr), m_policyManager(nullptr), m_participantManager(nullptr),
+m_esifServices(nullptr), m_platformTrace(nullptr), m_workItemQueueManager(nullptr), m_policyManager(nullptr), m_participantManager(nullptr),
 m_dptfStatus(nullptr), m_indexContainer(nullptr), m_dptfPolicyLoadNameOnly(false)
 {
 }
@@ -80,6 +81,7 @@ void DptfManager::createDptfManager(const void* esifHandle, EsifInterfacePtr esi
         m_userPreferredCache = std::make_shared<UserPreferredCache>();
         m_indexContainer = new IndexContainer(Constants::Participants::MaxParticipantEstimate);
         m_esifAppServices = new EsifAppServices(esifInterfacePtr);
+        startPlatformTraceIfConfigured(esifHandle);
         m_esifServices = new EsifServices(this, esifHandle, m_esifAppServices, currentLogVerbosityLevel);
         m_participantManager = new ParticipantManager(this);
         m_policyManager = new PolicyManager(this);
@@ -164,6 +166,11 @@ IndexContainerInterface* DptfManager::getIndexContainer(void) const
     return m_indexContainer;
 }
 
+PlatformTraceWriter* DptfManager::getPlatformTrace(void) const
+{
+    return m_platformTrace;
+}
+
 std::string DptfManager::getDptfHomeDirectoryPath(void) const
 {
     return m_dptfHomeDirectoryPath;
@@ -196,6 +203,7 @@ void DptfManager::shutDown(void)
     deleteParticipantManager();
     deleteEsifServices();
     deleteEsifAppServices();
+    deletePlatformTrace();
     deleteIndexContainer();
     destroyUniqueIdGenerator();
     destroyFrameworkEventInfo();
@@ -281,6 +289,11 @@ void DptfManager::deleteEsifServices(void)
     DELETE_MEMORY_TC(m_esifServices);
 }
 
+void DptfManager::deletePlatformTrace(void)
+{
+    DELETE_MEMORY_TC(m_platformTrace);
+}
+
 void DptfManager::deleteIndexContainer(void)
 {
     DELETE_MEMORY_TC(m_indexContainer);
@@ -308,6 +321,30 @@ void DptfManager::destroyFrameworkEventInfo(void)
     }
 }
 
+void DptfManager::startPlatformTraceIfConfigured(const void* esifHandle)
+{
+    // Read straight from ESIF since EsifServices isn't created yet and a missing value is the normal case
+    EsifDataString traceFileName(Constants::DefaultBufferSize);
+    eEsifError rc = m_esifAppServices->getConfigurationValue(esifHandle, this, EsifDataString("dptf"),
+        EsifDataString("PlatformTraceFile"), traceFileName);
+    std::string fileName = (rc == ESIF_OK) ? std::string(traceFileName) : std::string();
+    if (fileName.empty())
+    {
+        return;
+    }
+
+    try
+    {
+        m_platformTrace = new PlatformTraceWriter(fileName);
+        m_esifAppServices = new RecordingEsifAppServices(m_esifAppServices, m_platformTrace, m_indexContainer);
+    }
+    catch (...)
+    {
+        // Recording is a debug aid so DPTF starts without it
+        DELETE_MEMORY_TC(m_platformTrace);
+    }
+}
+
 void DptfManager::registerDptfFrameworkEvents(void)
 {
     // FIXME:  Do these belong here?
@@ -337,7 +374,7 @@ void DptfManager::registerDptfFrameworkEvents(void)
     catch (...)
     {
     }
-    if (m_esifAppServices->getInterfaceVersion() == ESIF_INTERFACE_VERSION_2)
+    if (m_esifAppServices->getInterfaceVersion() >= ESIF_INTERFACE_VERSION_2)
     {
         try
         {
@@ -398,7 +435,7 @@ void DptfManager::unregisterDptfFrameworkEvents(void)
     catch (...)
     {
     }
-    if (m_esifAppServices->getInterfaceVersion() == ESIF_INTERFACE_VERSION_2)
+    if (m_esifAppServices->getInterfaceVersion() >= ESIF_INTERFACE_VERSION_2)
     {
         try
         {
@@ -443,121 +480,3 @@ std::shared_ptr<UserPreferredCache> DptfManager::getUserPreferredCache(void) con
 {
     return m_userPreferredCache;
 }
-
-void DptfManager::bindDomainsToPolicies(UIntN participantIndex) const
-{
-    UIntN domainCount = m_participantManager->getParticipantPtr(participantIndex)->getDomainCount();
-
-    for (UIntN domainIndex = 0; domainIndex < domainCount; domainIndex++)
-    {
-        for (UIntN policyIndex = 0; policyIndex < m_policyManager->getPolicyListCount(); policyIndex++)
-        {
-            try
-            {
-                Policy* policy = m_policyManager->getPolicyPtr(policyIndex);
-                policy->bindDomain(participantIndex, domainIndex);
-            }
-            catch (dptf_exception ex)
-            {
-                ManagerMessage message = ManagerMessage(this, FLF, "DPTF was not able to bind domain to policies: " + ex.getDescription() + ".");
-                message.addMessage("Participant Index", participantIndex);
-                message.addMessage("Domain Index", domainIndex);
-                message.addMessage("Policy Index", policyIndex);
-                getEsifServices()->writeMessageWarning(message);
-            }
-            catch (...)
-            {
-                ManagerMessage message = ManagerMessage(this, FLF, "DptfManager::bindDomainsToPolicies Failed.");
-                message.addMessage("Participant Index", participantIndex);
-                message.addMessage("Domain Index", domainIndex);
-                message.addMessage("Policy Index", policyIndex);
-                getEsifServices()->writeMessageWarning(message);
-            }
-        }
-    }
-}
-
-void DptfManager::unbindDomainsFromPolicies(UIntN participantIndex) const
-{
-    UIntN domainCount = m_participantManager->getParticipantPtr(participantIndex)->getDomainCount();
-
-    for (UIntN domainIndex = 0; domainIndex < domainCount; domainIndex++)
-    {
-        for (UIntN policyIndex = 0; policyIndex < m_policyManager->getPolicyListCount(); policyIndex++)
-        {
-            try
-            {
-                Policy* policy = m_policyManager->getPolicyPtr(policyIndex);
-                policy->unbindDomain(participantIndex, domainIndex);
-            }
-            catch (dptf_exception ex)
-            {
-                ManagerMessage message = ManagerMessage(this, FLF, "DPTF was not able to unbind domain from policies: " + ex.getDescription() + ".");
-                message.addMessage("Participant Index", participantIndex);
-                message.addMessage("Domain Index", domainIndex);
-                message.addMessage("Policy Index", policyIndex);
-                getEsifServices()->writeMessageWarning(message);
-            }
-            catch (...)
-            {
-                ManagerMessage message = ManagerMessage(this, FLF, "DptfManager::unbindDomainsFromPolicies Failed.");
-                message.addMessage("Participant Index", participantIndex);
-                message.addMessage("Domain Index", domainIndex);
-                message.addMessage("Policy Index", policyIndex);
-                getEsifServices()->writeMessageWarning(message);
-            }
-        }
-    }
-}
-
-void DptfManager::bindParticipantToPolicies(UIntN participantIndex) const
-{
-    for (UIntN policyIndex = 0; policyIndex < m_policyManager->getPolicyListCount(); policyIndex++)
-    {
-        try
-        {
-            Policy* policy = m_policyManager->getPolicyPtr(policyIndex);
-            policy->bindParticipant(participantIndex);
-        }
-        catch (dptf_exception ex)
-        {
-            ManagerMessage message = ManagerMessage(this, FLF, "DPTF was not able to bind participant to policies: " + ex.getDescription() + ".");
-            message.addMessage("Participant Index", participantIndex);
-            message.addMessage("Policy Index", policyIndex);
-            getEsifServices()->writeMessageWarning(message);
-        }
-        catch (...)
-        {
-            ManagerMessage message = ManagerMessage(this, FLF, "DptfManager::bindParticipantToPolicies Failed.");
-            message.addMessage("Participant Index", participantIndex);
-            message.addMessage("Policy Index", policyIndex);
-            getEsifServices()->writeMessageWarning(message);
-        }
-    }
-}
-
-void DptfManager::unbindParticipantFromPolicies(UIntN participantIndex) const
-{
-    for (UIntN policyIndex = 0; policyIndex < m_policyManager->getPolicyListCount(); policyIndex++)
-    {
-        try
-        {
-            Policy* policy = m_policyManager->getPolicyPtr(policyIndex);
-            policy->unbindParticipant(participantIndex);
-        }
-        catch (dptf_exception ex)
-        {
-            ManagerMessage message = ManagerMessage(this, FLF, "DPTF was not able to unbind participant from policies: " + ex.getDescription() + ".");
-            message.addMessage("Participant Index", participantIndex);
-            message.addMessage("Policy Index", policyIndex);
-            getEsifServices()->writeMessageWarning(message);
-        }
-        catch (...)
-        {
-            ManagerMessage message = ManagerMessage(this, FLF, "DptfManager::unbindParticipantFromPolicies Failed.");
-            message.addMessage("Participant Index", participantIndex);
-            message.addMessage("Policy Index", policyIndex);
-            getEsifServices()->writeMessageWarning(message);
-        }
-    }
-}
@@ -18,7 +18,7 @@
 
 #pragma once
 
-#include "DptfManagerInterface.h"
+#include "DptfManagerBase.h"
 #include "EsifAppServicesInterface.h"
 #include "EventCache.h"
 #include "UserPreferredCache.h"
@@ -33,7 +33,7 @@ class DptfStatusInterface;
 // DPTF starts here!!!
 //
 
-class DptfManager : public DptfManagerInterface
+class DptfManager : public DptfManagerBase
 {
 public:
 
@@ -59,16 +59,12 @@ public:
     virtual ParticipantManagerInterface* getParticipantManager(void) const override;
     virtual DptfStatusInterface* getDptfStatus(void) override;
     virtual IndexContainerInterface* getIndexContainer(void) const override;
+    virtual PlatformTraceWriter* getPlatformTrace(void) const override;
 
     virtual std::string getDptfHomeDirectoryPath(void) const override;
     virtual std::string getDptfPolicyDirectoryPath(void) const override;
     virtual Bool isDptfPolicyLoadNameOnly(void) const override;
 
-    void bindDomainsToPolicies(UIntN participantIndex) const override;
-    void unbindDomainsFromPolicies(UIntN participantIndex) const override;
-    void bindParticipantToPolicies(UIntN participantIndex) const override;
-    void unbindParticipantFromPolicies(UIntN participantIndex) const override;
-
 private:
 
     // hide the copy constructor and assignment operator.
@@ -86,6 +82,9 @@ private:
     EsifAppServicesInterface* m_esifAppServices;
     EsifServicesInterface* m_esifServices;
 
+    // Only created when the PlatformTraceFile configuration value is set.  Records what DPTF receives from ESIF.
+    PlatformTraceWriter* m_platformTrace;
+
     // All work item threads, enqueueing, dequeuing, and work item dispatch is handled by the WorkItemQueueManager.
     WorkItemQueueManagerInterface* m_workItemQueueManager;
 
@@ -120,10 +119,13 @@ private:
     void deleteParticipantManager(void);
     void deleteEsifAppServices(void);
     void deleteEsifServices(void);
+    void deletePlatformTrace(void);
     void deleteIndexContainer(void);
     void destroyUniqueIdGenerator(void);
     void destroyFrameworkEventInfo(void);
 
+    void startPlatformTraceIfConfigured(const void* esifHandle);
+
     void registerDptfFrameworkEvents(void);
     void unregisterDptfFrameworkEvents(void);
 };
\ No newline at end of file
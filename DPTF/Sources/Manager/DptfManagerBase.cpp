@@ -0,0 +1,150 @@
+/******************************************************************************
+** Copyright (c) 2013-2016 Intel Corporation All Rights Reserved
+**
+** Licensed under the Apache License, Version 2.0 (the "License"); you may not
+** use this file except in compliance with the License.
+**
+** You may obtain a copy of the License at
+**     http://www.apache.org/licenses/LICENSE-2.0
+**
+** Unless required by applicable law or agreed to in writing, software
+** distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+** WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+**
+** See the License for the specific language governing permissions and
+** limitations under the License.
+**
+******************************************************************************/
+
+
+#include "DptfManagerBase.h"
+#include "EsifServicesInterface.h"
+#include "PolicyManagerInterface.h"
+#include "ParticipantManagerInterface.h"
+#include "ManagerMessage.h"
+#include "Policy.h"
+#include "Participant.h"
+
+void DptfManagerBase::bindDomainsToPolicies(UIntN participantIndex) const
+{
+    PolicyManagerInterface* policyManager = getPolicyManager();
+    UIntN domainCount = getParticipantManager()->getParticipantPtr(participantIndex)->getDomainCount();
+
+    for (UIntN domainIndex = 0; domainIndex < domainCount; domainIndex++)
+    {
+        for (UIntN policyIndex = 0; policyIndex < policyManager->getPolicyListCount(); policyIndex++)
+        {
+            try
+            {
+                Policy* policy = policyManager->getPolicyPtr(policyIndex);
+                policy->bindDomain(participantIndex, domainIndex);
+            }
+            catch (dptf_exception ex)
+            {
+                ManagerMessage message = ManagerMessage(this, FLF, "DPTF was not able to bind domain to policies: " + ex.getDescription() + ".");
+                message.addMessage("Participant Index", participantIndex);
+                message.addMessage("Domain Index", domainIndex);
+                message.addMessage("Policy Index", policyIndex);
+                getEsifServices()->writeMessageWarning(message);
+            }
+            catch (...)
+            {
+                ManagerMessage message = ManagerMessage(this, FLF, "DptfManager::bindDomainsToPolicies Failed.");
+                message.addMessage("Participant Index", participantIndex);
+                message.addMessage("Domain Index", domainIndex);
+                message.addMessage("Policy Index", policyIndex);
+                getEsifServices()->writeMessageWarning(message);
+            }
+        }
+    }
+}
+
+void DptfManagerBase::unbindDomainsFromPolicies(UIntN participantIndex) const
+{
+    PolicyManagerInterface* policyManager = getPolicyManager();
+    UIntN domainCount = getParticipantManager()->getParticipantPtr(participantIndex)->getDomainCount();
+
+    for (UIntN domainIndex = 0; domainIndex < domainCount; domainIndex++)
+    {
+        for (UIntN policyIndex = 0; policyIndex < policyManager->getPolicyListCount(); policyIndex++)
+        {
+            try
+            {
+                Policy* policy = policyManager->getPolicyPtr(policyIndex);
+                policy->unbindDomain(participantIndex, domainIndex);
+            }
+            catch (dptf_exception ex)
+            {
+                ManagerMessage message = ManagerMessage(this, FLF, "DPTF was not able to unbind domain from policies: " + ex.getDescription() + ".");
+                message.addMessage("Participant Index", participantIndex);
+                message.addMessage("Domain Index", domainIndex);
+                message.addMessage("Policy Index", policyIndex);
+                getEsifServices()->writeMessageWarning(message);
+            }
+            catch (...)
+            {
+                ManagerMessage message = ManagerMessage(this, FLF, "DptfManager::unbindDomainsFromPolicies Failed.");
+                message.addMessage("Participant Index", participantIndex);
+                message.addMessage("Domain Index", domainIndex);
+                message.addMessage("Policy Index", policyIndex);
+                getEsifServices()->writeMessageWarning(message);
+            }
+        }
+    }
+}
+
+void DptfManagerBase::bindParticipantToPolicies(UIntN participantIndex) const
+{
+    PolicyManagerInterface* policyManager = getPolicyManager();
+
+    for (UIntN policyIndex = 0; policyIndex < policyManager->getPolicyListCount(); policyIndex++)
+    {
+        try
+        {
+            Policy* policy = policyManager->getPolicyPtr(policyIndex);
+            policy->bindParticipant(participantIndex);
+        }
+        catch (dptf_exception ex)
+        {
+            ManagerMessage message = ManagerMessage(this, FLF, "DPTF was not able to bind participant to policies: " + ex.getDescription() + ".");
+            message.addMessage("Participant Index", participantIndex);
+            message.addMessage("Policy Index", policyIndex);
+            getEsifServices()->writeMessageWarning(message);
+        }
+        catch (...)
+        {
+            ManagerMessage message = ManagerMessage(this, FLF, "DptfManager::bindParticipantToPolicies Failed.");
+            message.addMessage("Participant Index", participantIndex);
+            message.addMessage("Policy Index", policyIndex);
+            getEsifServices()->writeMessageWarning(message);
+        }
+    }
+}
+
+void DptfManagerBase::unbindParticipantFromPolicies(UIntN participantIndex) const
+{
+    PolicyManagerInterface* policyManager = getPolicyManager();
+
+    for (UIntN policyIndex = 0; policyIndex < policyManager->getPolicyListCount(); policyIndex++)
+    {
+        try
+        {
+            Policy* policy = policyManager->getPolicyPtr(policyIndex);
+            policy->unbindParticipant(participantIndex);
+        }
+        catch (dptf_exception ex)
+        {
+            ManagerMessage message = ManagerMessage(this, FLF, "DPTF was not able to unbind participant from policies: " + ex.getDescription() + ".");
+            message.addMessage("Participant Index", participantIndex);
+            message.addMessage("Policy Index", policyIndex);
+            getEsifServices()->writeMessageWarning(message);
+        }
+        catch (...)
+        {
+            ManagerMessage message = ManagerMessage(this, FLF, "DptfManager::unbindParticipantFromPolicies Failed.");
+            message.addMessage("Participant Index", participantIndex);
+            message.addMessage("Policy Index", policyIndex);
+            getEsifServices()->writeMessageWarning(message);
+        }
+    }
+}
\ No newline at end of file
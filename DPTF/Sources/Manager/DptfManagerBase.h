@@ -0,0 +1,41 @@
+/******************************************************************************
+** Copyright (c) 2013-2016 Intel Corporation All Rights Reserved
+**
+** Licensed under the Apache License, Version 2.0 (the "License"); you may not
+** use this file except in compliance with the License.
+**
+** You may obtain a copy of the License at
+**     http://www.apache.org/licenses/LICENSE-2.0
+**
+** Unless required by applicable law or agreed to in writing, software
+** distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+** WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+**
+** See the License for the specific language governing permissions and
+** limitations under the License.
+**
+******************************************************************************/
+
+
+#pragma once
+
+#include "Dptf.h"
+#include "DptfManagerInterface.h"
+
+//
+// Binds and unbinds participants and their domains across every loaded policy.  The DPTF manager, the simulator
+// and the platform benchmark all share this through their getPolicyManager(), getParticipantManager() and
+// getEsifServices() implementations.  Failures are logged as warnings and the remaining policies are still bound.
+//
+
+class DptfManagerBase : public DptfManagerInterface
+{
+public:
+
+    virtual ~DptfManagerBase(void) {};
+
+    virtual void bindDomainsToPolicies(UIntN participantIndex) const override;
+    virtual void unbindDomainsFromPolicies(UIntN participantIndex) const override;
+    virtual void bindParticipantToPolicies(UIntN participantIndex) const override;
+    virtual void unbindParticipantFromPolicies(UIntN participantIndex) const override;
+};
\ No newline at end of file
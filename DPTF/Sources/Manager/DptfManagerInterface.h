@@ -31,6 +31,7 @@ class WorkItemQueueManagerInterface;
 class PolicyManagerInterface;
 class ParticipantManagerInterface;
 class DptfStatusInterface;
+class PlatformTraceWriter;
 
 class DptfManagerInterface
 {
@@ -49,6 +50,7 @@ public:
     virtual ParticipantManagerInterface* getParticipantManager(void) const = 0;
     virtual DptfStatusInterface* getDptfStatus(void) = 0;
     virtual IndexContainerInterface* getIndexContainer(void) const = 0;
+    virtual PlatformTraceWriter* getPlatformTrace(void) const = 0;
     virtual std::string getDptfHomeDirectoryPath(void) const = 0;
     virtual std::string getDptfPolicyDirectoryPath(void) const = 0;
     virtual Bool isDptfPolicyLoadNameOnly(void) const = 0;
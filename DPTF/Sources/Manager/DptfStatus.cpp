@@ -29,11 +29,24 @@
 #include "XmlNode.h"
 #include "ParticipantStatusMap.h"
 #include "EsifDataString.h"
+#include "EsifMutexHelper.h"
+#include "EsifTime.h"
+#include "WorkItemExecutor.h"
+#include <sys/stat.h>
 
 static const Guid FormatId(0x3E, 0x58, 0x63, 0x46, 0xF8, 0xF7, 0x45, 0x4A, 0xA8, 0xF7, 0xDE, 0x7E, 0xC6, 0xF7, 0x61, 0xA8);
 
+// Module data includes live sensor readings that change without any work item running, so cached copies expire
+static const Int64 MaxModuleDataAgeInMilliseconds = 1000;
+
 DptfStatus::DptfStatus(DptfManagerInterface* dptfManager) :
-    m_dptfManager(dptfManager)
+    m_dptfManager(dptfManager),
+    m_statusCacheStructureVersion(0),
+    m_structureVersion(0),
+    m_frameworkVersion(0),
+    m_allPoliciesVersion(0),
+    m_xsltModifiedTime(0),
+    m_xsltSize(0)
 {
     m_policyManager = m_dptfManager->getPolicyManager();
     m_participantManager = m_dptfManager->getParticipantManager();
@@ -58,32 +71,200 @@ namespace GroupType
 void DptfStatus::getStatus(const eAppStatusCommand command, const UInt32 appStatusIn,
     EsifDataPtr appStatusOut, eEsifError* returnCode)
 {
+    UInt64 structureVersion = 0;
+    UInt64 version = 0;
+    if (getStatusVersion(command, appStatusIn, structureVersion, version) == false)
+    {
+        std::string response = generateStatus(command, appStatusIn, returnCode);
+        fillEsifString(appStatusOut, response, returnCode);
+        return;
+    }
+
+    // Participants, domains or policies were added or removed so every cached document is suspect
+    if (structureVersion != m_statusCacheStructureVersion)
+    {
+        m_statusCache.clear();
+        m_statusCacheStructureVersion = structureVersion;
+    }
+
+    UInt64 cacheKey = getStatusCacheKey(command, appStatusIn);
+    TimeSpan currentTime = EsifTime().getTimeStamp();
+    auto cachedStatus = m_statusCache.find(cacheKey);
+    if ((cachedStatus != m_statusCache.end()) && (cachedStatus->second.version == version) &&
+        ((command != eAppStatusCommandGetModuleData) ||
+         ((currentTime - cachedStatus->second.generationTime) <
+          TimeSpan::createFromMilliseconds(MaxModuleDataAgeInMilliseconds))))
+    {
+        fillEsifString(appStatusOut, cachedStatus->second.content, returnCode);
+        return;
+    }
+
+    eEsifError generateReturnCode = ESIF_OK;
     std::string response;
+    try
+    {
+        response = generateStatus(command, appStatusIn, &generateReturnCode);
+    }
+    catch (...)
+    {
+        if (generateReturnCode != ESIF_OK)
+        {
+            *returnCode = generateReturnCode;
+        }
+        throw;
+    }
 
-    switch (command)
+    if (generateReturnCode == ESIF_OK)
+    {
+        CachedStatus newStatus;
+        newStatus.version = version;
+        newStatus.generationTime = currentTime;
+        newStatus.content = response;
+        m_statusCache[cacheKey] = newStatus;
+    }
+    else
     {
-        case eAppStatusCommandGetXSLT:
-            response = getXsltContent(returnCode);
+        *returnCode = generateReturnCode;
+    }
+
+    fillEsifString(appStatusOut, response, returnCode);
+}
+
+void DptfStatus::clearCache()
+{
+    m_participantStatusMap->clearCachedData();
+
+    EsifMutexHelper esifMutexHelper(&m_versionMutex);
+    esifMutexHelper.lock();
+    m_structureVersion++;
+    esifMutexHelper.unlock();
+}
+
+void DptfStatus::workItemExecuted(WorkItemInterface* workItem)
+{
+    // Status requests only read data, so they must not invalidate the documents they just cached
+    if ((workItem == nullptr) || (workItem->getFrameworkEventType() == FrameworkEvent::DptfGetStatus))
+    {
+        return;
+    }
+
+    // A participant work item changes its own participant and every policy reacts to it.  A policy callback changes
+    // that policy.  Controls the policies change on other participants are reported through participantChanged.
+    // Exclusive work items can change anything, including what modules exist.
+    WorkItemLane::Type laneType;
+    UIntN laneIndex;
+    WorkItemExecutor::classifyWorkItem(workItem, laneType, laneIndex);
+
+    EsifMutexHelper esifMutexHelper(&m_versionMutex);
+    esifMutexHelper.lock();
+    m_frameworkVersion++;
+    switch (laneType)
+    {
+        case WorkItemLane::Participant:
+            m_participantVersions[laneIndex]++;
+            m_allPoliciesVersion++;
+            break;
+        case WorkItemLane::Policy:
+            m_policyVersions[laneIndex]++;
+            break;
+        default:
+            m_structureVersion++;
             break;
+    }
+    esifMutexHelper.unlock();
+}
+
+void DptfStatus::participantChanged(UIntN participantIndex)
+{
+    EsifMutexHelper esifMutexHelper(&m_versionMutex);
+    esifMutexHelper.lock();
+    m_participantVersions[participantIndex]++;
+    esifMutexHelper.unlock();
+}
+
+std::string DptfStatus::generateStatus(const eAppStatusCommand command, const UInt32 appStatusIn,
+    eEsifError* returnCode)
+{
+    if (command == eAppStatusCommandGetXSLT)
+    {
+        return getXsltContent(returnCode);
+    }
+
+    // The same writer is reused for every request so its buffer only grows to the largest document once
+    UInt32 statusIn = appStatusIn & ~ESIF_APP_STATUS_FORMAT_JSON;
+    m_statusWriter.reset(((appStatusIn & ESIF_APP_STATUS_FORMAT_JSON) != 0) ?
+        StatusOutputFormat::Json : StatusOutputFormat::Xml);
+
+    switch (command)
+    {
         case eAppStatusCommandGetGroups:
-            response = getGroupsXml(returnCode);
+            writeGroups(returnCode);
             break;
         case eAppStatusCommandGetModulesInGroup:
-            response = getModulesInGroup(appStatusIn, returnCode);
+            writeModulesInGroup(statusIn, returnCode);
             break;
         case eAppStatusCommandGetModuleData:
-            response = getModuleData(appStatusIn, returnCode);
+            writeModuleData(statusIn, returnCode);
             break;
         default:
             *returnCode = ESIF_E_UNSPECIFIED;
             throw dptf_exception("Received invalid command status code.");
     }
-    fillEsifString(appStatusOut, response, returnCode);
+    return m_statusWriter.getContent();
 }
 
-void DptfStatus::clearCache()
+Bool DptfStatus::getStatusVersion(const eAppStatusCommand command, const UInt32 appStatusIn,
+    UInt64& structureVersion, UInt64& version)
 {
-    m_participantStatusMap->clearCachedData();
+    if ((command != eAppStatusCommandGetGroups) && (command != eAppStatusCommandGetModulesInGroup) &&
+        (command != eAppStatusCommandGetModuleData))
+    {
+        // The XSLT is cached separately against the file on disk
+        return false;
+    }
+
+    UInt32 statusIn = appStatusIn & ~ESIF_APP_STATUS_FORMAT_JSON;
+    UInt32 groupId = static_cast<UInt32>(BinaryParse::extractBits(32, 16, statusIn));
+    UInt32 moduleId = static_cast<UInt32>(BinaryParse::extractBits(15, 0, statusIn));
+    UIntN participantIndex = Constants::Invalid;
+    if ((command == eAppStatusCommandGetModuleData) && (groupId == GroupType::Participants))
+    {
+        participantIndex = m_participantStatusMap->getParticipantIndex(moduleId);
+    }
+
+    EsifMutexHelper esifMutexHelper(&m_versionMutex);
+    esifMutexHelper.lock();
+    structureVersion = m_structureVersion;
+    if (command != eAppStatusCommandGetModuleData)
+    {
+        version = m_structureVersion;
+    }
+    else if (groupId == GroupType::Policies)
+    {
+        version = m_allPoliciesVersion + getModuleVersion(m_policyVersions, moduleId);
+    }
+    else if (groupId == GroupType::Participants)
+    {
+        version = getModuleVersion(m_participantVersions, participantIndex);
+    }
+    else
+    {
+        version = m_frameworkVersion;
+    }
+    esifMutexHelper.unlock();
+
+    return true;
+}
+
+UInt64 DptfStatus::getModuleVersion(const std::map<UIntN, UInt64>& moduleVersions, UIntN moduleIndex)
+{
+    auto moduleVersion = moduleVersions.find(moduleIndex);
+    return (moduleVersion != moduleVersions.end()) ? moduleVersion->second : 0;
+}
+
+UInt64 DptfStatus::getStatusCacheKey(const eAppStatusCommand command, const UInt32 appStatusIn)
+{
+    return (static_cast<UInt64>(command) << 32) | static_cast<UInt64>(appStatusIn);
 }
 
 std::string DptfStatus::getFileContent(std::string fileName)
@@ -109,67 +290,81 @@ std::string DptfStatus::getFileContent(std::string fileName)
 
 std::string DptfStatus::getXsltContent(eEsifError* returnCode)
 {
-    try
+    std::string fileName = m_dptfManager->getDptfHomeDirectoryPath() + "combined.xsl";
+
+    // Only re-read the file when it has been replaced since the last request
+    struct stat fileStatus;
+    if (stat(fileName.c_str(), &fileStatus) != 0)
     {
-        return getFileContent(m_dptfManager->getDptfHomeDirectoryPath() + "combined.xsl");
+        *returnCode = ESIF_E_UNSPECIFIED;
+        throw dptf_exception("File not found.");
     }
-    catch (dptf_exception)
+
+    if (m_xsltContent.empty() ||
+        (static_cast<UInt64>(fileStatus.st_mtime) != m_xsltModifiedTime) ||
+        (static_cast<UInt64>(fileStatus.st_size) != m_xsltSize))
     {
-        // Could not find file, try from Resources/
-        *returnCode = ESIF_E_UNSPECIFIED;
-        throw;
+        try
+        {
+            m_xsltContent = getFileContent(fileName);
+            m_xsltModifiedTime = static_cast<UInt64>(fileStatus.st_mtime);
+            m_xsltSize = static_cast<UInt64>(fileStatus.st_size);
+        }
+        catch (dptf_exception)
+        {
+            // Could not find file, try from Resources/
+            *returnCode = ESIF_E_UNSPECIFIED;
+            throw;
+        }
     }
+
+    return m_xsltContent;
 }
 
-std::string DptfStatus::getGroupsXml(eEsifError* returnCode)
+void DptfStatus::writeGroups(eEsifError* returnCode)
 {
-    auto groups = XmlNode::createWrapperElement("groups");
+    m_statusWriter.beginElement("groups");
 
-    auto group0 = XmlNode::createWrapperElement("group");
-    groups->addChild(group0);
-    group0->addChild(XmlNode::createDataElement("id", "0"));
-    group0->addChild(XmlNode::createDataElement("name", "Policies"));
+    m_statusWriter.beginElement("group");
+    m_statusWriter.addDataElement("id", "0");
+    m_statusWriter.addDataElement("name", "Policies");
+    m_statusWriter.endElement();
 
-    auto group1 = XmlNode::createWrapperElement("group");
-    groups->addChild(group1);
-    group1->addChild(XmlNode::createDataElement("id", "1"));
-    group1->addChild(XmlNode::createDataElement("name", "Participants"));
+    m_statusWriter.beginElement("group");
+    m_statusWriter.addDataElement("id", "1");
+    m_statusWriter.addDataElement("name", "Participants");
+    m_statusWriter.endElement();
 
-    auto group2 = XmlNode::createWrapperElement("group");
-    groups->addChild(group2);
-    group2->addChild(XmlNode::createDataElement("id", "2"));
-    group2->addChild(XmlNode::createDataElement("name", "Manager"));
+    m_statusWriter.beginElement("group");
+    m_statusWriter.addDataElement("id", "2");
+    m_statusWriter.addDataElement("name", "Manager");
+    m_statusWriter.endElement();
 
-    std::string s = groups->toString();
-
-    return s;
+    m_statusWriter.endElement();
 }
 
-std::string DptfStatus::getModulesInGroup(const UInt32 appStatusIn, eEsifError* returnCode)
+void DptfStatus::writeModulesInGroup(const UInt32 appStatusIn, eEsifError* returnCode)
 {
-    std::string modulesInGroup;
-
     switch (appStatusIn)
     {
         case GroupType::Policies:
-            modulesInGroup = getPoliciesGroup();
+            writePoliciesGroup();
             break;
         case GroupType::Participants:
-            modulesInGroup = getParticipantsGroup();
+            writeParticipantsGroup();
             break;
         case GroupType::Framework:
-            modulesInGroup = getFrameworkGroup();
+            writeFrameworkGroup();
             break;
         default:
             *returnCode = ESIF_E_UNSPECIFIED;
             throw dptf_exception("Invalid group ID specified.");
     }
-    return modulesInGroup;
 }
 
-std::string DptfStatus::getPoliciesGroup()
+void DptfStatus::writePoliciesGroup()
 {
-    auto modules = XmlNode::createWrapperElement("modules");
+    m_statusWriter.beginElement("modules");
 
     UIntN policyCount = m_policyManager->getPolicyListCount();
     for (UIntN policyIndex = 0; policyIndex < policyCount; policyIndex++)
@@ -181,14 +376,10 @@ std::string DptfStatus::getPoliciesGroup()
             Policy* policy = m_policyManager->getPolicyPtr(policyIndex);
             std::string name = policy->getName();
 
-            auto module = XmlNode::createWrapperElement("module");
-            modules->addChild(module);
-
-            auto policyId = XmlNode::createDataElement("id", StlOverride::to_string(policyIndex));
-            module->addChild(policyId);
-
-            auto policyName = XmlNode::createDataElement("name", name);
-            module->addChild(policyName);
+            m_statusWriter.beginElement("module");
+            m_statusWriter.addDataElement("id", StlOverride::to_string(policyIndex));
+            m_statusWriter.addDataElement("name", name);
+            m_statusWriter.endElement();
         }
         catch (...)
         {
@@ -196,77 +387,62 @@ std::string DptfStatus::getPoliciesGroup()
         }
     }
 
-    std::string s = modules->toString();
-
-    return s;
+    m_statusWriter.endElement();
 }
 
-std::string DptfStatus::getParticipantsGroup()
+void DptfStatus::writeParticipantsGroup()
 {
-    return m_participantStatusMap->getGroupsString();
+    m_participantStatusMap->writeGroups(m_statusWriter);
 }
 
-std::string DptfStatus::getFrameworkGroup()
+void DptfStatus::writeFrameworkGroup()
 {
-    auto modules = XmlNode::createWrapperElement("modules");
+    m_statusWriter.beginElement("modules");
 
     // Manager Status
 
-    auto module = XmlNode::createWrapperElement("module");
-    modules->addChild(module);
-
-    auto moduleId = XmlNode::createDataElement("id", StlOverride::to_string(0));
-    module->addChild(moduleId);
-
-    auto moduleName = XmlNode::createDataElement("name", "Manager Status");
-    module->addChild(moduleName);
+    m_statusWriter.beginElement("module");
+    m_statusWriter.addDataElement("id", StlOverride::to_string(0));
+    m_statusWriter.addDataElement("name", "Manager Status");
+    m_statusWriter.endElement();
 
 #ifdef INCLUDE_WORK_ITEM_STATISTICS
 
     // Work Item Statistics
 
-    module = XmlNode::createWrapperElement("module");
-    modules->addChild(module);
-
-    moduleId = XmlNode::createDataElement("id", StlOverride::to_string(1));
-    module->addChild(moduleId);
-
-    moduleName = XmlNode::createDataElement("name", "Work Item Statistics");
-    module->addChild(moduleName);
+    m_statusWriter.beginElement("module");
+    m_statusWriter.addDataElement("id", StlOverride::to_string(1));
+    m_statusWriter.addDataElement("name", "Work Item Statistics");
+    m_statusWriter.endElement();
 
 #endif
 
-    std::string s = modules->toString();
-
-    return s;
+    m_statusWriter.endElement();
 }
 
-std::string DptfStatus::getModuleData(const UInt32 appStatusIn, eEsifError* returnCode)
+void DptfStatus::writeModuleData(const UInt32 appStatusIn, eEsifError* returnCode)
 {
-    std::string moduleData;
-
     UInt32 groupId = static_cast<UInt32>(BinaryParse::extractBits(32, 16, appStatusIn));
     UInt32 moduleId = static_cast<UInt32>(BinaryParse::extractBits(15, 0, appStatusIn));
 
     switch (groupId)
     {
         case GroupType::Policies:
-            moduleData = getXmlForPolicy(moduleId, returnCode);
+            writePolicyStatus(moduleId, returnCode);
             break;
         case GroupType::Participants:
-            moduleData = getXmlForParticipant(moduleId, returnCode);
+            writeParticipantStatus(moduleId, returnCode);
             break;
         case GroupType::Framework:
-            moduleData = getXmlForFramework(moduleId, returnCode);
+            writeFrameworkStatus(moduleId, returnCode);
             break;
         default:
             *returnCode = ESIF_E_UNSPECIFIED;
             throw dptf_exception("Invalid group ID specified.");
     }
-    return moduleData;
 }
 
-std::string DptfStatus::getXmlForPolicy(UInt32 policyIndex, eEsifError* returnCode)
+void DptfStatus::writePolicyStatus(UInt32 policyIndex, eEsifError* returnCode)
 {
     UIntN policyCount = m_policyManager->getPolicyListCount();
     if (policyIndex >= policyCount)
@@ -277,8 +453,9 @@ std::string DptfStatus::getXmlForPolicy(UInt32 policyIndex, eEsifError* returnCo
 
     try
     {
+        // Policies write straight into the writer, or hand back XML that is re-emitted in the requested format
         Policy* policy = m_policyManager->getPolicyPtr(policyIndex);
-        return policy->getStatusAsXml();
+        policy->writeStatus(m_statusWriter);
     }
     catch (...)
     {
@@ -287,7 +464,7 @@ std::string DptfStatus::getXmlForPolicy(UInt32 policyIndex, eEsifError* returnCo
     }
 }
 
-std::string DptfStatus::getXmlForParticipant(UInt32 mappedIndex, eEsifError* returnCode)
+void DptfStatus::writeParticipantStatus(UInt32 mappedIndex, eEsifError* returnCode)
 {
     auto participantIndexList = m_participantManager->getParticipantIndexes();
     UIntN totalDomainCount = 0;
@@ -316,9 +493,7 @@ std::string DptfStatus::getXmlForParticipant(UInt32 mappedIndex, eEsifError* ret
     try
     {
         auto participantData = m_participantStatusMap->getStatusAsXml(mappedIndex);
-        std::string s = participantData->toString();
-
-        return s;
+        participantData->write(m_statusWriter);
     }
     catch (...)
     {
@@ -327,36 +502,26 @@ std::string DptfStatus::getXmlForParticipant(UInt32 mappedIndex, eEsifError* ret
     }
 }
 
-std::string DptfStatus::getXmlForFramework(UInt32 moduleIndex, eEsifError* returnCode)
+void DptfStatus::writeFrameworkStatus(UInt32 moduleIndex, eEsifError* returnCode)
 {
-    std::shared_ptr<XmlNode> frameworkRoot;
-
     switch (moduleIndex)
     {
         case 0:
         {
-            frameworkRoot = XmlNode::createRoot();
-            auto formatId = XmlNode::createComment("format_id=" + FormatId.toString());
-            frameworkRoot->addChild(formatId);
-
-            auto dppmRoot = XmlNode::createWrapperElement("dppm_status");
-            frameworkRoot->addChild(dppmRoot);
-
-            auto policiesRoot = getXmlForFrameworkLoadedPolicies();
-            dppmRoot->addChild(policiesRoot);
-
-            auto participantsRoot = getXmlForFrameworkLoadedParticipants();
-            dppmRoot->addChild(participantsRoot);
+            m_statusWriter.addComment(" format_id=" + FormatId.toString() + " ");
 
-            auto policyManagerRoot = m_policyManager->getStatusAsXml();
-            dppmRoot->addChild(policyManagerRoot);
+            m_statusWriter.beginElement("dppm_status");
+            writeFrameworkLoadedPolicies();
+            writeFrameworkLoadedParticipants();
+            m_policyManager->getStatusAsXml()->write(m_statusWriter);
+            m_statusWriter.endElement();
 
             *returnCode = ESIF_OK;
             break;
         }
         case 1:
         {
-            frameworkRoot = m_dptfManager->getWorkItemQueueManager()->getStatusAsXml();
+            m_dptfManager->getWorkItemQueueManager()->writeStatus(m_statusWriter);
             *returnCode = ESIF_OK;
             break;
         }
@@ -364,22 +529,14 @@ std::string DptfStatus::getXmlForFramework(UInt32 moduleIndex, eEsifError* retur
             *returnCode = ESIF_E_UNSPECIFIED;
             break;
     }
-
-    std::string s;
-    if (frameworkRoot != nullptr)
-    {
-        s = frameworkRoot->toString();
-    }
-
-    return s;
 }
 
-std::shared_ptr<XmlNode> DptfStatus::getXmlForFrameworkLoadedPolicies()
+void DptfStatus::writeFrameworkLoadedPolicies()
 {
-    auto policiesRoot = XmlNode::createWrapperElement("policies");
+    m_statusWriter.beginElement("policies");
 
     UIntN policyCount = m_policyManager->getPolicyListCount();
-    policiesRoot->addChild(XmlNode::createDataElement("policy_count", StlOverride::to_string(policyCount)));
+    m_statusWriter.addDataElement("policy_count", StlOverride::to_string(policyCount));
 
     for (UIntN i = 0; i < policyCount; i++)
     {
@@ -388,15 +545,10 @@ std::shared_ptr<XmlNode> DptfStatus::getXmlForFrameworkLoadedPolicies()
             Policy* policy = m_policyManager->getPolicyPtr(i);
             std::string name = policy->getName();
 
-            auto policyRoot = XmlNode::createWrapperElement("policy");
-
-            auto policyIndex = XmlNode::createDataElement("policy_index", StlOverride::to_string(i));
-            policyRoot->addChild(policyIndex);
-
-            auto policyName = XmlNode::createDataElement("policy_name", name);
-            policyRoot->addChild(policyName);
-
-            policiesRoot->addChild(policyRoot);
+            m_statusWriter.beginElement("policy");
+            m_statusWriter.addDataElement("policy_index", StlOverride::to_string(i));
+            m_statusWriter.addDataElement("policy_name", name);
+            m_statusWriter.endElement();
         }
         catch (...)
         {
@@ -404,12 +556,12 @@ std::shared_ptr<XmlNode> DptfStatus::getXmlForFrameworkLoadedPolicies()
         }
     }
 
-    return policiesRoot;
+    m_statusWriter.endElement();
 }
 
-std::shared_ptr<XmlNode> DptfStatus::getXmlForFrameworkLoadedParticipants()
+void DptfStatus::writeFrameworkLoadedParticipants()
 {
-    auto participantsRoot = XmlNode::createWrapperElement("participants");
+    m_statusWriter.beginElement("participants");
 
     auto participantIndexList = m_participantManager->getParticipantIndexes();
     for (auto i = participantIndexList.begin(); i != participantIndexList.end(); ++i)
@@ -417,7 +569,8 @@ std::shared_ptr<XmlNode> DptfStatus::getXmlForFrameworkLoadedParticipants()
         try
         {
             Participant* participant = m_participantManager->getParticipantPtr(*i);
-            participantsRoot->addChild(participant->getXml(Constants::Invalid));
+            auto participantRoot = participant->getXml(Constants::Invalid);
+            participantRoot->write(m_statusWriter);
         }
         catch (...)
         {
@@ -425,7 +578,7 @@ std::shared_ptr<XmlNode> DptfStatus::getXmlForFrameworkLoadedParticipants()
         }
     }
 
-    return participantsRoot;
+    m_statusWriter.endElement();
 }
 
 void DptfStatus::fillEsifString(EsifDataPtr outputLocation, std::string inputString, eEsifError* returnCode)
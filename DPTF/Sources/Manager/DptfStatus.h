@@ -20,6 +20,9 @@
 
 #include "Dptf.h"
 #include "DptfStatusInterface.h"
+#include "EsifMutex.h"
+#include "StatusWriter.h"
+#include <map>
 
 class XmlNode;
 class Indent;
@@ -36,27 +39,62 @@ public:
     virtual void getStatus(const eAppStatusCommand command, const UInt32 appStatusIn,
         EsifDataPtr appStatusOut, eEsifError* returnCode) override;
     virtual void clearCache() override;
+    virtual void workItemExecuted(WorkItemInterface* workItem) override;
+    virtual void participantChanged(UIntN participantIndex) override;
 
 private:
 
+    // Serialized status documents are cached along with the version of the data they were built from.  Work items
+    // bump the version of the data they can affect so only stale documents are regenerated.
+    struct CachedStatus
+    {
+        UInt64 version;
+        TimeSpan generationTime;
+        std::string content;
+    };
+
     DptfManagerInterface* m_dptfManager;
     PolicyManagerInterface* m_policyManager;
     ParticipantManagerInterface* m_participantManager;
     ParticipantStatusMap* m_participantStatusMap;
 
+    std::map<UInt64, CachedStatus> m_statusCache;
+    UInt64 m_statusCacheStructureVersion;
+
+    // Module data versions.  A module's version is the sum of the version shared by its group and its own version,
+    // both of which only increase.
+    EsifMutex m_versionMutex;
+    UInt64 m_structureVersion;
+    UInt64 m_frameworkVersion;
+    UInt64 m_allPoliciesVersion;
+    std::map<UIntN, UInt64> m_policyVersions;
+    std::map<UIntN, UInt64> m_participantVersions;
+
+    std::string m_xsltContent;
+    UInt64 m_xsltModifiedTime;
+    UInt64 m_xsltSize;
+
+    std::string generateStatus(const eAppStatusCommand command, const UInt32 appStatusIn, eEsifError* returnCode);
+    Bool getStatusVersion(const eAppStatusCommand command, const UInt32 appStatusIn, UInt64& structureVersion,
+        UInt64& version);
+    static UInt64 getModuleVersion(const std::map<UIntN, UInt64>& moduleVersions, UIntN moduleIndex);
+    static UInt64 getStatusCacheKey(const eAppStatusCommand command, const UInt32 appStatusIn);
+
+    StatusWriter m_statusWriter;
+
     std::string getFileContent(std::string fileName);
     std::string getXsltContent(eEsifError* returnCode);
-    std::string getGroupsXml(eEsifError* returnCode);
-    std::string getModulesInGroup(const UInt32 appStatusIn, eEsifError* returnCode);
-    std::string getPoliciesGroup();
-    std::string getParticipantsGroup();
-    std::string getFrameworkGroup();
-    std::string getModuleData(const UInt32 appStatusIn, eEsifError* returnCode);
-    std::string getXmlForPolicy(UInt32 policyIndex, eEsifError* returnCode);
-    std::string getXmlForParticipant(UInt32 mappedIndex, eEsifError* returnCode);
-    std::string getXmlForFramework(UInt32 moduleIndex, eEsifError* returnCode);
-    std::shared_ptr<XmlNode> getXmlForFrameworkLoadedPolicies();
-    std::shared_ptr<XmlNode> getXmlForFrameworkLoadedParticipants();
+    void writeGroups(eEsifError* returnCode);
+    void writeModulesInGroup(const UInt32 appStatusIn, eEsifError* returnCode);
+    void writePoliciesGroup();
+    void writeParticipantsGroup();
+    void writeFrameworkGroup();
+    void writeModuleData(const UInt32 appStatusIn, eEsifError* returnCode);
+    void writePolicyStatus(UInt32 policyIndex, eEsifError* returnCode);
+    void writeParticipantStatus(UInt32 mappedIndex, eEsifError* returnCode);
+    void writeFrameworkStatus(UInt32 moduleIndex, eEsifError* returnCode);
+    void writeFrameworkLoadedPolicies();
+    void writeFrameworkLoadedParticipants();
 
     void fillEsifString(EsifDataPtr outputLocation, std::string inputString, eEsifError* returnCode);
 
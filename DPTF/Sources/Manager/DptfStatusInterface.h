@@ -22,6 +22,8 @@
 #include "DptfManagerInterface.h"
 #include "esif_ccb_rc.h"
 
+class WorkItemInterface;
+
 class DptfStatusInterface
 {
 public:
@@ -30,4 +32,10 @@ public:
 	virtual void getStatus(const eAppStatusCommand command, const UInt32 appStatusIn,
 		EsifDataPtr appStatusOut, eEsifError* returnCode) = 0;
 	virtual void clearCache() = 0;
+
+	// Called after each work item executes so status documents it may have changed are regenerated
+	virtual void workItemExecuted(WorkItemInterface* workItem) = 0;
+
+	// Called when a policy changes a control on a participant, which can happen while handling any work item
+	virtual void participantChanged(UIntN participantIndex) = 0;
 };
\ No newline at end of file
@@ -0,0 +1,111 @@
+/******************************************************************************
+** Copyright (c) 2013-2016 Intel Corporation All Rights Reserved
+**
+** Licensed under the Apache License, Version 2.0 (the "License"); you may not
+** use this file except in compliance with the License.
+**
+** You may obtain a copy of the License at
+**     http://www.apache.org/licenses/LICENSE-2.0
+**
+** Unless required by applicable law or agreed to in writing, software
+** distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+** WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+**
+** See the License for the specific language governing permissions and
+** limitations under the License.
+**
+******************************************************************************/
+
+#pragma once
+
+#include "Dptf.h"
+#include <new>
+#include <type_traits>
+
+//
+// Cached value that is stored inline together with the cache epoch it was filled in.  It is only valid while the
+// owner's epoch hasn't changed, so the owner can invalidate all of its cached values by incrementing a counter.
+// The storage is reused when the value is filled again.  The value does no locking of its own, so the owner has to
+// guard it together with its epochs.
+//
+template <typename T>
+class EpochCachedValue
+{
+public:
+
+    EpochCachedValue();
+    ~EpochCachedValue();
+
+    Bool isValid(UInt64 epoch) const;
+    const T& get() const;
+    void set(const T& value, UInt64 epoch);
+    void invalidate();
+
+private:
+
+    // hide the copy constructor and assignment operator.
+    EpochCachedValue(const EpochCachedValue& rhs);
+    EpochCachedValue& operator=(const EpochCachedValue& rhs);
+
+    typename std::aligned_storage<sizeof(T), std::alignment_of<T>::value>::type m_value;
+    UInt64 m_epoch;
+    Bool m_valid;
+    Bool m_constructed;
+
+    void destroyValue();
+};
+
+template <typename T>
+EpochCachedValue<T>::EpochCachedValue()
+    : m_epoch(0), m_valid(false), m_constructed(false)
+{
+}
+
+template <typename T>
+EpochCachedValue<T>::~EpochCachedValue()
+{
+    destroyValue();
+}
+
+template <typename T>
+Bool EpochCachedValue<T>::isValid(UInt64 epoch) const
+{
+    return (m_valid == true) && (m_epoch == epoch);
+}
+
+template <typename T>
+const T& EpochCachedValue<T>::get() const
+{
+    if (m_valid == false)
+    {
+        throw dptf_exception("Cached value is not valid.");
+    }
+    return *reinterpret_cast<const T*>(&m_value);
+}
+
+template <typename T>
+void EpochCachedValue<T>::set(const T& value, UInt64 epoch)
+{
+    destroyValue();
+    new (&m_value) T(value);
+    m_constructed = true;
+    m_epoch = epoch;
+    m_valid = true;
+}
+
+template <typename T>
+void EpochCachedValue<T>::invalidate()
+{
+    m_valid = false;
+}
+
+template <typename T>
+void EpochCachedValue<T>::destroyValue()
+{
+    m_valid = false;
+    if (m_constructed == true)
+    {
+        reinterpret_cast<T*>(&m_value)->~T();
+        m_constructed = false;
+    }
+}
\ No newline at end of file
@@ -18,10 +18,14 @@
 
 #include "EsifAppServices.h"
 #include "esif_ccb_memory.h"
+#include <algorithm>
 
 EsifAppServices::EsifAppServices(const EsifInterfacePtr esifInterfacePtr)
 {
-    esif_ccb_memcpy(&m_esifInterface, esifInterfacePtr, sizeof(m_esifInterface));
+    // Older versions of ESIF provide a smaller interface.  Anything they don't provide is left null.
+    UInt64 interfaceSize = std::min((UInt64)esifInterfacePtr->fIfaceSize, (UInt64)sizeof(m_esifInterface));
+    esif_ccb_memset(&m_esifInterface, 0, sizeof(m_esifInterface));
+    esif_ccb_memcpy(&m_esifInterface, esifInterfacePtr, (size_t)interfaceSize);
 }
 
 EsifAppServices::~EsifAppServices()
@@ -88,4 +92,66 @@ eEsifError EsifAppServices::sendEvent(const void* esifHandle, const void* appHan
     const void* participantHandle, const void* domainHandle, const EsifDataPtr eventData, const EsifDataPtr eventGuid)
 {
     return m_esifInterface.fSendEventFuncPtr(esifHandle, appHandle, participantHandle, domainHandle, eventData, eventGuid);
+}
+
+eEsifError EsifAppServices::executePrimitiveBatch(const void* esifHandle, const void* appHandle,
+    EsifPrimitiveBatchItemPtr items, const UInt32 itemCount, EsifDataPtr response)
+{
+    if (supportsPrimitiveBatch())
+    {
+        return m_esifInterface.fPrimitiveBatchFuncPtr(esifHandle, appHandle, items, itemCount, response);
+    }
+    else
+    {
+        return executePrimitiveBatchOneAtATime(esifHandle, appHandle, items, itemCount, response);
+    }
+}
+
+Bool EsifAppServices::supportsPrimitiveBatch(void) const
+{
+    return ((m_esifInterface.fIfaceVersion >= ESIF_INTERFACE_VERSION_3) &&
+        (m_esifInterface.fPrimitiveBatchFuncPtr != nullptr));
+}
+
+eEsifError EsifAppServices::executePrimitiveBatchOneAtATime(const void* esifHandle, const void* appHandle,
+    EsifPrimitiveBatchItemPtr items, const UInt32 itemCount, EsifDataPtr response)
+{
+    if ((items == nullptr) || (response == nullptr))
+    {
+        return ESIF_E_PARAMETER_IS_NULL;
+    }
+
+    // Same buffer layout as the ESIF batch call
+    UInt64 requiredSize = 0;
+    for (UInt32 i = 0; i < itemCount; i++)
+    {
+        items[i].fOffset = (UInt32)requiredSize;
+        items[i].fDataLength = 0;
+        items[i].fStatus = ESIF_E_UNSPECIFIED;
+        requiredSize += ESIF_PRIMITIVE_BATCH_ALIGN((UInt64)items[i].fResponseSize);
+    }
+
+    if ((response->buf_len < requiredSize) || ((response->buf_ptr == nullptr) && (requiredSize > 0)))
+    {
+        response->data_len = (UInt32)requiredSize;
+        return ESIF_E_NEED_LARGER_BUFFER;
+    }
+
+    EsifData voidRequest = {ESIF_DATA_VOID, nullptr, 0, 0};
+    for (UInt32 i = 0; i < itemCount; i++)
+    {
+        EsifData itemResponse;
+        itemResponse.type = (esif_data_type)items[i].fResponseType;
+        itemResponse.buf_ptr = (UInt8*)response->buf_ptr + items[i].fOffset;
+        itemResponse.buf_len = items[i].fResponseSize;
+        itemResponse.data_len = 0;
+
+        items[i].fStatus = m_esifInterface.fPrimitiveFuncPtr(esifHandle, appHandle, items[i].fParticipantHandle,
+            items[i].fDomainHandle, &voidRequest, &itemResponse, (ePrimitiveType)items[i].fPrimitive,
+            items[i].fInstance);
+        items[i].fDataLength = itemResponse.data_len;
+    }
+    response->data_len = (UInt32)requiredSize;
+
+    return ESIF_OK;
 }
\ No newline at end of file
@@ -54,7 +54,15 @@ public:
 
     virtual eEsifError sendEvent(const void* esifHandle, const void* appHandle,
         const void* participantHandle, const void* domainHandle, const EsifDataPtr eventData, const EsifDataPtr eventGuid) override;
+
+    virtual eEsifError executePrimitiveBatch(const void* esifHandle, const void* appHandle,
+        EsifPrimitiveBatchItemPtr items, const UInt32 itemCount, EsifDataPtr response) override;
+
 private:
 
     EsifInterface m_esifInterface;
+
+    Bool supportsPrimitiveBatch(void) const;
+    eEsifError executePrimitiveBatchOneAtATime(const void* esifHandle, const void* appHandle,
+        EsifPrimitiveBatchItemPtr items, const UInt32 itemCount, EsifDataPtr response);
 };
\ No newline at end of file
@@ -50,4 +50,9 @@ public:
 
     virtual eEsifError sendEvent(const void* esifHandle, const void* appHandle,
         const void* participantHandle, const void* domainHandle, const EsifDataPtr eventData, const EsifDataPtr eventGuid) = 0;
+
+    // Executes a list of GET primitives with a single call into ESIF.  Falls back to executing the items one at a
+    // time if ESIF does not support the batch call.
+    virtual eEsifError executePrimitiveBatch(const void* esifHandle, const void* appHandle,
+        EsifPrimitiveBatchItemPtr items, const UInt32 itemCount, EsifDataPtr response) = 0;
 };
\ No newline at end of file
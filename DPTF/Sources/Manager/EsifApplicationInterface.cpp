@@ -28,6 +28,8 @@
 #include "EsifServicesInterface.h"
 #include "EsifDataGuid.h"
 #include "EsifDataUInt32.h"
+#include "PlatformTrace.h"
+#include "EsifTimer.h"
 
 //
 // Macros must be used to reduce the code and still allow writing out the file name, line number, and function name
@@ -136,16 +138,22 @@ extern "C"
         if (esifInterfacePtr == nullptr ||
             esifInterfacePtr->fIfaceType != eIfaceTypeEsifService ||
             ((esifInterfacePtr->fIfaceVersion != ESIF_INTERFACE_VERSION_1) &&
-            (esifInterfacePtr->fIfaceVersion != ESIF_INTERFACE_VERSION_2))||
-            esifInterfacePtr->fIfaceSize != (UInt16)sizeof(EsifInterface) ||
+            (esifInterfacePtr->fIfaceVersion != ESIF_INTERFACE_VERSION_2) &&
+            (esifInterfacePtr->fIfaceVersion != ESIF_INTERFACE_VERSION_3)) ||
+            // Older versions of ESIF do not provide the version 3 batch primitive function
+            ((esifInterfacePtr->fIfaceSize != (UInt16)sizeof(EsifInterface)) &&
+            ((esifInterfacePtr->fIfaceVersion == ESIF_INTERFACE_VERSION_3) ||
+            (esifInterfacePtr->fIfaceSize != (UInt16)offsetof(EsifInterface, fPrimitiveBatchFuncPtr)))) ||
             esifInterfacePtr->fGetConfigFuncPtr == nullptr ||
             esifInterfacePtr->fSetConfigFuncPtr == nullptr ||
             esifInterfacePtr->fPrimitiveFuncPtr == nullptr ||
             esifInterfacePtr->fWriteLogFuncPtr == nullptr ||
             esifInterfacePtr->fRegisterEventFuncPtr == nullptr ||
             esifInterfacePtr->fUnregisterEventFuncPtr == nullptr ||
-            ((esifInterfacePtr->fIfaceVersion == ESIF_INTERFACE_VERSION_2) &&
+            ((esifInterfacePtr->fIfaceVersion >= ESIF_INTERFACE_VERSION_2) &&
             (esifInterfacePtr->fSendEventFuncPtr == nullptr)) ||
+            ((esifInterfacePtr->fIfaceVersion >= ESIF_INTERFACE_VERSION_3) &&
+            (esifInterfacePtr->fPrimitiveBatchFuncPtr == nullptr)) ||
             appHandle == nullptr ||
             appData == nullptr)
         {
@@ -204,6 +212,9 @@ extern "C"
         try
         {
             DELETE_MEMORY(dptfManager);
+
+            // The timer thread lives in this library, so stop it before the library can be unloaded
+            EsifTimer::destroyTimerManager();
         }
         catch (...)
         {
@@ -396,9 +407,15 @@ extern "C"
         try
         {
             Bool participantEnabled = (particiapntInitialState == eParticipantState::eParticipantStateEnabled);
+            UIntN participantIndex = dptfManager->getIndexContainer()->getIndex((IndexStructPtr)participantHandle);
 
-            WorkItem* workItem = new WIParticipantCreate(dptfManager,
-                dptfManager->getIndexContainer()->getIndex((IndexStructPtr)participantHandle),
+            PlatformTraceWriter* platformTrace = dptfManager->getPlatformTrace();
+            if (platformTrace != nullptr)
+            {
+                platformTrace->writeParticipantCreate(participantIndex, participantDataPtr, particiapntInitialState);
+            }
+
+            WorkItem* workItem = new WIParticipantCreate(dptfManager, participantIndex,
                 participantDataPtr, participantEnabled, &participantCreated);
             dptfManager->getWorkItemQueueManager()->enqueueImmediateWorkItemAndWait(workItem);
         }
@@ -421,8 +438,16 @@ extern "C"
 
         try
         {
-            WorkItem* workItem = new WIParticipantDestroy(dptfManager,
-                dptfManager->getIndexContainer()->getIndex((IndexStructPtr)participantHandle));
+            UIntN participantIndex = dptfManager->getIndexContainer()->getIndex((IndexStructPtr)participantHandle);
+
+            PlatformTraceWriter* platformTrace = dptfManager->getPlatformTrace();
+            if (platformTrace != nullptr)
+            {
+                platformTrace->writeDestroy(PlatformTraceEntryType::ParticipantDestroy, participantIndex,
+                    Constants::Esif::NoDomain);
+            }
+
+            WorkItem* workItem = new WIParticipantDestroy(dptfManager, participantIndex);
             dptfManager->getWorkItemQueueManager()->enqueueImmediateWorkItemAndWait(workItem);
         }
         catch (...)
@@ -491,10 +516,16 @@ extern "C"
         try
         {
             Bool domainEnabled = (domainInitialState == eDomainState::eDomainStateEnabled);
+            UIntN participantIndex = dptfManager->getIndexContainer()->getIndex((IndexStructPtr)participantHandle);
+            UIntN domainIndex = dptfManager->getIndexContainer()->getIndex((IndexStructPtr)domainHandle);
 
-            WorkItem* workItem = new WIDomainCreate(dptfManager,
-                dptfManager->getIndexContainer()->getIndex((IndexStructPtr)participantHandle),
-                dptfManager->getIndexContainer()->getIndex((IndexStructPtr)domainHandle),
+            PlatformTraceWriter* platformTrace = dptfManager->getPlatformTrace();
+            if (platformTrace != nullptr)
+            {
+                platformTrace->writeDomainCreate(participantIndex, domainIndex, domainDataPtr, domainInitialState);
+            }
+
+            WorkItem* workItem = new WIDomainCreate(dptfManager, participantIndex, domainIndex,
                 domainDataPtr, domainEnabled, &domainCreated);
             dptfManager->getWorkItemQueueManager()->enqueueImmediateWorkItemAndWait(workItem);
         }
@@ -517,9 +548,16 @@ extern "C"
 
         try
         {
-            WorkItem* workItem = new WIDomainDestroy(dptfManager,
-                dptfManager->getIndexContainer()->getIndex((IndexStructPtr)participantHandle),
-                dptfManager->getIndexContainer()->getIndex((IndexStructPtr)domainHandle));
+            UIntN participantIndex = dptfManager->getIndexContainer()->getIndex((IndexStructPtr)participantHandle);
+            UIntN domainIndex = dptfManager->getIndexContainer()->getIndex((IndexStructPtr)domainHandle);
+
+            PlatformTraceWriter* platformTrace = dptfManager->getPlatformTrace();
+            if (platformTrace != nullptr)
+            {
+                platformTrace->writeDestroy(PlatformTraceEntryType::DomainDestroy, participantIndex, domainIndex);
+            }
+
+            WorkItem* workItem = new WIDomainDestroy(dptfManager, participantIndex, domainIndex);
             dptfManager->getWorkItemQueueManager()->enqueueImmediateWorkItemAndWait(workItem);
         }
         catch (...)
@@ -589,6 +627,12 @@ extern "C"
 
         try
         {
+            PlatformTraceWriter* platformTrace = dptfManager->getPlatformTrace();
+            if (platformTrace != nullptr)
+            {
+                platformTrace->writeEvent(participantIndex, domainIndex, eventGuid, esifEventDataPtr);
+            }
+
             WorkItem* wi = nullptr;
             UInt32 uint32param = Constants::Invalid;
 
@@ -33,6 +33,7 @@
 #include "esif_ccb_rc.h"
 #include "ManagerMessage.h"
 #include "EsifDataTime.h"
+#include "esif_ccb_memory.h"
 
 using namespace std;
 
@@ -459,6 +460,55 @@ DptfBuffer EsifServices::primitiveExecuteGet(esif_primitive_type primitive, esif
     return buffer;
 }
 
+void EsifServices::primitiveExecuteGetBatch(EsifPrimitiveBatch& batch)
+{
+    UIntN numberOfRequests = batch.getCount();
+    if (numberOfRequests == 0)
+    {
+        return;
+    }
+
+    // Every request gets an aligned slot in a single result buffer
+    std::vector<EsifPrimitiveBatchItem> items(numberOfRequests);
+    UInt32 bufferSize = 0;
+    for (UIntN requestIndex = 0; requestIndex < numberOfRequests; requestIndex++)
+    {
+        UIntN participantIndex = batch.getParticipantIndex(requestIndex);
+        UIntN domainIndex = batch.getDomainIndex(requestIndex);
+        throwIfParticipantDomainCombinationInvalid(FLF, participantIndex, domainIndex);
+
+        EsifPrimitiveBatchItem& item = items[requestIndex];
+        esif_ccb_memset(&item, 0, sizeof(item));
+        item.fParticipantHandle = (void*)m_dptfManager->getIndexContainer()->getIndexPtr(participantIndex);
+        item.fDomainHandle = (void*)m_dptfManager->getIndexContainer()->getIndexPtr(domainIndex);
+        item.fPrimitive = batch.getPrimitive(requestIndex);
+        item.fResponseType = batch.getDataType(requestIndex);
+        item.fResponseSize = batch.getResponseSize(requestIndex);
+        item.fInstance = batch.getInstance(requestIndex);
+        bufferSize += ESIF_PRIMITIVE_BATCH_ALIGN(item.fResponseSize);
+    }
+
+    DptfBuffer buffer(bufferSize);
+    EsifDataContainer esifData(esif_data_type::ESIF_DATA_BINARY, buffer.get(), buffer.size(), 0);
+    eEsifError rc = m_appServices->executePrimitiveBatch(m_esifHandle, m_dptfManager,
+        items.data(), numberOfRequests, esifData);
+    throwIfNotSuccessful(FLF, rc, "Failed to execute primitive batch.");
+
+    for (UIntN requestIndex = 0; requestIndex < numberOfRequests; requestIndex++)
+    {
+        const EsifPrimitiveBatchItem& item = items[requestIndex];
+        std::string errorDescription;
+        if (item.fStatus != ESIF_OK)
+        {
+            errorDescription = writePrimitiveFailureMessage(FLF, item.fStatus, batch.getPrimitive(requestIndex),
+                batch.getParticipantIndex(requestIndex), batch.getDomainIndex(requestIndex),
+                batch.getInstance(requestIndex));
+        }
+        batch.setResult(requestIndex, item.fStatus, item.fOffset, item.fDataLength, errorDescription);
+    }
+    batch.setResultBuffer(buffer);
+}
+
 void EsifServices::primitiveExecuteSet(esif_primitive_type primitive, esif_data_type esifDataType,
     void* bufferPtr, UInt32 bufferLength, UInt32 dataLength, UIntN participantIndex,
     UIntN domainIndex, UInt8 instance)
@@ -611,20 +661,8 @@ void EsifServices::throwIfNotSuccessful(const std::string& fileName, UIntN lineN
         return;
     }
 
-    ManagerMessage message = ManagerMessage(m_dptfManager, fileName, lineNumber, executingFunctionName,
-        "Error returned from ESIF services interface function call");
-    message.setEsifPrimitive(primitive, instance);
-    message.setParticipantAndDomainIndex(participantIndex, domainIndex);
-    message.setEsifErrorCode(returnCode);
-
-    if ((primitive == GET_TRIP_POINT_ACTIVE) && (returnCode == ESIF_I_ACPI_TRIP_POINT_NOT_PRESENT))
-    {
-        // no message.  we still throw an exception to inform the policy.
-    }
-    else
-    {
-        writeMessageWarning(message);
-    }
+    std::string message = writePrimitiveFailureMessage(fileName, lineNumber, executingFunctionName, returnCode,
+        primitive, participantIndex, domainIndex, instance);
 
     if (returnCode == ESIF_I_AGAIN)
     {
@@ -646,6 +684,28 @@ void EsifServices::throwIfNotSuccessful(const std::string& fileName, UIntN lineN
     throw primitive_execution_failed(message);
 }
 
+std::string EsifServices::writePrimitiveFailureMessage(const std::string& fileName, UIntN lineNumber,
+    const std::string& executingFunctionName, eEsifError returnCode, esif_primitive_type primitive,
+    UIntN participantIndex, UIntN domainIndex, UInt8 instance)
+{
+    ManagerMessage message = ManagerMessage(m_dptfManager, fileName, lineNumber, executingFunctionName,
+        "Error returned from ESIF services interface function call");
+    message.setEsifPrimitive(primitive, instance);
+    message.setParticipantAndDomainIndex(participantIndex, domainIndex);
+    message.setEsifErrorCode(returnCode);
+
+    if ((primitive == GET_TRIP_POINT_ACTIVE) && (returnCode == ESIF_I_ACPI_TRIP_POINT_NOT_PRESENT))
+    {
+        // no message.  we still throw an exception to inform the policy.
+    }
+    else
+    {
+        writeMessageWarning(message);
+    }
+
+    return message;
+}
+
 void EsifServices::throwIfNotSuccessful(const std::string& fileName, UIntN lineNumber, 
     const std::string& executingFunctionName, eEsifError returnCode, const std::string& messageText)
 {
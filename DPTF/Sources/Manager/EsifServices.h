@@ -163,6 +163,8 @@ public:
         UIntN domainIndex = Constants::Esif::NoDomain,
         UInt8 instance = Constants::Esif::NoInstance) override;
 
+    virtual void primitiveExecuteGetBatch(EsifPrimitiveBatch& batch) override;
+
     virtual void primitiveExecuteSet(
         esif_primitive_type primitive,
         esif_data_type esifDataType,
@@ -221,6 +223,9 @@ private:
         UInt8 instance);
     void throwIfNotSuccessful(const std::string& fileName, UIntN lineNumber, const std::string& executingFunctionName,
         eEsifError returnCode, const std::string& messageText);
+    std::string writePrimitiveFailureMessage(const std::string& fileName, UIntN lineNumber,
+        const std::string& executingFunctionName, eEsifError returnCode, esif_primitive_type primitive,
+        UIntN participantIndex, UIntN domainIndex, UInt8 instance);
     void throwIfParticipantDomainCombinationInvalid(const std::string& fileName, UIntN lineNumber,
         const std::string& executingFunctionName, UIntN participantIndex, UIntN domainIndex);
 };
\ No newline at end of file
@@ -28,6 +28,7 @@
 #include "MessageCategory.h"
 #include "DptfBuffer.h"
 #include "TimeSpan.h"
+#include "EsifPrimitiveBatch.h"
 
 //
 // Implements the ESIF services interface which allows the framework to call into ESIF.  See the ESIF HLD for a
@@ -177,6 +178,10 @@ public:
         UIntN domainIndex = Constants::Esif::NoDomain,
         UInt8 instance = Constants::Esif::NoInstance) = 0;
 
+    // Executes every request in the batch with a single call into ESIF.  A request that fails does not throw here.
+    // The failure is reported when the result of that request is retrieved from the batch.
+    virtual void primitiveExecuteGetBatch(EsifPrimitiveBatch& batch) = 0;
+
     virtual void primitiveExecuteSet(
         esif_primitive_type primitive,
         esif_data_type esifDataType,
@@ -19,6 +19,7 @@
 #define ESIF_CCB_LINK_LIST_MAIN
 #define ESIF_CCB_TIMER_MAIN
 #include "EsifTimer.h"
+#include "EsifMutexHelper.h"
 
 EsifTimer::EsifTimer(esif_ccb_timer_cb callbackFunction, void* contextPtr) :
     m_callbackFunction(callbackFunction), m_contextPtr(contextPtr), m_timerInitialized(false),
@@ -39,24 +40,46 @@ void EsifTimer::startTimer(const TimeSpan& expirationTime)
 
 void EsifTimer::cancelTimer(void)
 {
-    esifTimerKill();
+    // The ESIF timer is kept so it can be started again without creating a new one
+    if (m_timerInitialized == true)
+    {
+        esif_ccb_timer_cancel(&m_timer);
+        setExpirationTime(TimeSpan::createFromMilliseconds(0));
+    }
+}
+
+void EsifTimer::destroyTimerManager(void)
+{
+    esif_ccb_tmrm_exit();
 }
 
 Bool EsifTimer::isExpirationTimeValid(void) const
 {
-    return (m_expirationTime.asMillisecondsInt() != 0);
+    return (getExpirationTime().asMillisecondsInt() != 0);
 }
 
-const TimeSpan& EsifTimer::getExpirationTime(void) const
+TimeSpan EsifTimer::getExpirationTime(void) const
 {
-    return m_expirationTime;
+    EsifMutexHelper esifMutexHelper(&m_expirationTimeMutex);
+    esifMutexHelper.lock();
+    TimeSpan expirationTime = m_expirationTime;
+    esifMutexHelper.unlock();
+    return expirationTime;
+}
+
+void EsifTimer::setExpirationTime(const TimeSpan& expirationTime)
+{
+    EsifMutexHelper esifMutexHelper(&m_expirationTimeMutex);
+    esifMutexHelper.lock();
+    m_expirationTime = expirationTime;
+    esifMutexHelper.unlock();
 }
 
 void EsifTimer::esifTimerInit()
 {
     if (m_timerInitialized == false)
     {
-        eEsifError rc = esif_ccb_timer_init(&m_timer, m_callbackFunction, m_contextPtr);
+        eEsifError rc = esif_ccb_timer_init(&m_timer, EsifTimerCallback, this);
         if (rc != ESIF_OK)
         {
             esif_ccb_memset(&m_timer, 0, sizeof(esif_ccb_timer_t));
@@ -77,27 +100,48 @@ void EsifTimer::esifTimerKill()
 
         esif_ccb_memset(&m_timer, 0, sizeof(esif_ccb_timer_t));
         m_timerInitialized = false;
-        m_expirationTime = TimeSpan::createFromMilliseconds(0);
+        setExpirationTime(TimeSpan::createFromMilliseconds(0));
     }
 }
 
 void EsifTimer::esifTimerSet(const TimeSpan& expirationTime)
 {
-    esifTimerKill();
+    // Setting a running ESIF timer reschedules it, so the timer is only created the first time.  The expiration
+    // time is stored first since the new timeout may expire before esif_ccb_timer_set_msec returns.
     esifTimerInit();
+    setExpirationTime(expirationTime);
 
     eEsifError rc = esif_ccb_timer_set_msec(&m_timer, calculateMilliSecondsUntilTimerExpires(expirationTime));
     if (rc != ESIF_OK)
     {
+        setExpirationTime(TimeSpan::createFromMilliseconds(0));
         throw dptf_exception("Failed to start timer.");
     }
-
-    m_expirationTime = expirationTime;
 }
 
 UInt64 EsifTimer::calculateMilliSecondsUntilTimerExpires(const TimeSpan& expirationTime)
 {
+    // Round up so the timer never fires before the expiration time.  Callers compare the expiration time with
+    // the current time when the callback runs and would find nothing to do.
     auto currentTime = EsifTime().getTimeStamp();
-    auto numMilliSeconds = (expirationTime > currentTime) ? (expirationTime - currentTime) : TimeSpan::createFromMilliseconds(1);
-    return numMilliSeconds.asMillisecondsUInt();
+    if (expirationTime <= currentTime)
+    {
+        return 1;
+    }
+    UInt64 numMicroSeconds = static_cast<UInt64>((expirationTime - currentTime).asMicroseconds());
+    return (numMicroSeconds + 999) / 1000;
+}
+
+void EsifTimer::timerExpired(void)
+{
+    // The timer is no longer pending, so the owner has to start it again to get another callback.  This has to
+    // happen before the callback, which may wake up a thread that checks the expiration time.
+    setExpirationTime(TimeSpan::createFromMilliseconds(0));
+    m_callbackFunction(m_contextPtr);
+}
+
+void EsifTimerCallback(void* contextPtr)
+{
+    EsifTimer* esifTimer = static_cast<EsifTimer*>(contextPtr);
+    esifTimer->timerExpired();
 }
\ No newline at end of file
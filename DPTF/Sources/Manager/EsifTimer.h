@@ -22,6 +22,7 @@
 #include "esif_ccb_thread.h"
 #include "esif_ccb_timer.h"
 #include "EsifTime.h"
+#include "EsifMutex.h"
 
 // Function prototype for timer callback:
 // void (*esif_ccb_timer_cb)(void *context);
@@ -36,8 +37,12 @@ public:
     void startTimer(const TimeSpan& expirationTime);
     void cancelTimer(void);
 
+    // The thread that services timers runs until this is called.  Call it once every timer has been destroyed.
+    static void destroyTimerManager(void);
+
+    // The expiration time is only valid while the timer is pending.  It is cleared before the callback runs.
     Bool isExpirationTimeValid(void) const;
-    const TimeSpan& getExpirationTime(void) const;
+    TimeSpan getExpirationTime(void) const;
 
 private:
 
@@ -50,11 +55,21 @@ private:
 
     Bool m_timerInitialized;
     esif_ccb_timer_t m_timer;
+
+    // Written by the timer thread when the timer fires.  Never held while calling into the ESIF timer, since
+    // killing the timer waits for the callback to finish.
+    mutable EsifMutex m_expirationTimeMutex;
     TimeSpan m_expirationTime;
 
     void esifTimerInit(void);
     void esifTimerKill(void);
     void esifTimerSet(const TimeSpan& expirationTime);
+    void setExpirationTime(const TimeSpan& expirationTime);
 
     UInt64 calculateMilliSecondsUntilTimerExpires(const TimeSpan& expirationTime);
-};
\ No newline at end of file
+
+    void timerExpired(void);
+    friend void EsifTimerCallback(void* contextPtr);
+};
+
+void EsifTimerCallback(void* contextPtr);
\ No newline at end of file
@@ -18,11 +18,12 @@
 
 #include "ImmediateWorkItemQueue.h"
 #include "EsifMutexHelper.h"
-#include "ParticipantWorkItem.h"
+#include "DomainWorkItem.h"
 #include "XmlNode.h"
 
 ImmediateWorkItemQueue::ImmediateWorkItemQueue(EsifSemaphore* workItemQueueSemaphore) :
-    m_maxCount(0), m_workItemQueueSemaphore(workItemQueueSemaphore)
+    m_nextSequenceNumber(0), m_maxCount(0), m_totalCoalesced(0), m_workItemQueueSemaphore(workItemQueueSemaphore),
+    m_frameworkEventIndex(FrameworkEvent::Max)
 {
 }
 
@@ -37,11 +38,13 @@ void ImmediateWorkItemQueue::enqueue(ImmediateWorkItem* newWorkItem)
     EsifMutexHelper esifMutexHelper(&m_mutex);
     esifMutexHelper.lock();
 
-    // In the case of an interrupt storm we need to make sure we don't enqueue a temperature threshold crossed
-    // event if the same event is already in the queue.
-    throwIfDuplicateThermalThresholdCrossedEvent(newWorkItem);
+    // In the case of an interrupt storm we need to make sure we don't enqueue an event if the same
+    // event is already in the queue.
+    Bool isCoalescingEvent = false;
+    UInt64 coalescingKey = 0;
+    throwIfDuplicateEvent(newWorkItem, isCoalescingEvent, coalescingKey);
 
-    insertSortedByPriority(newWorkItem);
+    insertSortedByPriority(newWorkItem, isCoalescingEvent, coalescingKey);
     updateMaxCount();
 
     esifMutexHelper.unlock();
@@ -56,8 +59,8 @@ ImmediateWorkItem* ImmediateWorkItemQueue::dequeue(void)
 
     if (m_queue.empty() == false)
     {
-        firstItemInQueue = m_queue.front();
-        m_queue.pop_front();
+        firstItemInQueue = m_queue.begin()->second;
+        eraseFromQueue(m_queue.begin());
     }
 
     esifMutexHelper.unlock();
@@ -72,9 +75,9 @@ void ImmediateWorkItemQueue::makeEmtpy(void)
 
     while (m_queue.empty() == false)
     {
-        ImmediateWorkItem* currentWorkItem = m_queue.front();
+        ImmediateWorkItem* currentWorkItem = m_queue.begin()->second;
+        eraseFromQueue(m_queue.begin());
         delete currentWorkItem;
-        m_queue.pop_front();
     }
 
     esifMutexHelper.unlock();
@@ -111,18 +114,78 @@ UIntN ImmediateWorkItemQueue::removeIfMatches(const WorkItemMatchCriteria& match
 
     UIntN numRemoved = 0;
 
-    auto it = m_queue.begin();
-    while (it != m_queue.end())
+    if (matchCriteria.isUniqueIdInMatchList() == true)
     {
-        if ((*it)->matches(matchCriteria) == true)
+        auto uniqueId = m_uniqueIdIndex.find(matchCriteria.getUniqueIdToMatch());
+        auto it = (uniqueId != m_uniqueIdIndex.end()) ? m_queue.find(uniqueId->second) : m_queue.end();
+        if ((it != m_queue.end()) && (it->second->matches(matchCriteria) == true))
         {
-            DELETE_MEMORY_TC(*it);
-            it = m_queue.erase(it);
+            ImmediateWorkItem* matchingWorkItem = it->second;
+            eraseFromQueue(it);
+            DELETE_MEMORY_TC(matchingWorkItem);
             numRemoved++;
         }
+    }
+    else
+    {
+        // Only test the work items in the smallest index bucket that the match criteria select.
+        const std::set<ImmediateWorkItemQueueKey>* candidates = nullptr;
+
+        if ((matchCriteria.isFrameworkEventTypeInMatchList() == true) &&
+            (matchCriteria.getFrameworkEventTypeToMatch() < FrameworkEvent::Max))
+        {
+            candidates = &m_frameworkEventIndex[matchCriteria.getFrameworkEventTypeToMatch()];
+        }
+
+        if (matchCriteria.isParticipantIndexInMatchList() == true)
+        {
+            // A participant without a bucket has no work items in the queue.
+            auto participant = m_participantIndex.find(matchCriteria.getParticipantIndexToMatch());
+            if (participant == m_participantIndex.end())
+            {
+                esifMutexHelper.unlock();
+                return 0;
+            }
+
+            if ((candidates == nullptr) || (participant->second.size() < candidates->size()))
+            {
+                candidates = &participant->second;
+            }
+        }
+
+        if (candidates != nullptr)
+        {
+            // eraseFromQueue removes keys from the index and drops empty participant buckets, so walk a copy.
+            std::vector<ImmediateWorkItemQueueKey> candidateKeys(candidates->begin(), candidates->end());
+            for (auto candidate = candidateKeys.begin(); candidate != candidateKeys.end(); candidate++)
+            {
+                auto it = m_queue.find(*candidate);
+                if (it->second->matches(matchCriteria) == true)
+                {
+                    ImmediateWorkItem* matchingWorkItem = it->second;
+                    eraseFromQueue(it);
+                    DELETE_MEMORY_TC(matchingWorkItem);
+                    numRemoved++;
+                }
+            }
+        }
         else
         {
-            it++;
+            auto it = m_queue.begin();
+            while (it != m_queue.end())
+            {
+                if (it->second->matches(matchCriteria) == true)
+                {
+                    ImmediateWorkItem* matchingWorkItem = it->second;
+                    it = eraseFromQueue(it);
+                    DELETE_MEMORY_TC(matchingWorkItem);
+                    numRemoved++;
+                }
+                else
+                {
+                    it++;
+                }
+            }
         }
     }
 
@@ -131,18 +194,18 @@ UIntN ImmediateWorkItemQueue::removeIfMatches(const WorkItemMatchCriteria& match
     return numRemoved;
 }
 
-std::shared_ptr<XmlNode> ImmediateWorkItemQueue::getXml(void) const
+void ImmediateWorkItemQueue::writeStatus(StatusWriter& writer) const
 {
     EsifMutexHelper esifMutexHelper(&m_mutex);
     esifMutexHelper.lock();
 
-    auto immediateQueueStastics = XmlNode::createWrapperElement("immediate_queue_statistics");
-    immediateQueueStastics->addChild(XmlNode::createDataElement("current_count", StlOverride::to_string(m_queue.size())));
-    immediateQueueStastics->addChild(XmlNode::createDataElement("max_count", StlOverride::to_string(m_maxCount)));
+    writer.beginElement("immediate_queue_statistics");
+    writer.addDataElement("current_count", StlOverride::to_string(m_queue.size()));
+    writer.addDataElement("max_count", StlOverride::to_string(m_maxCount));
+    writer.addDataElement("total_coalesced", StlOverride::to_string(m_totalCoalesced));
+    writer.endElement();
 
     esifMutexHelper.unlock();
-
-    return immediateQueueStastics;
 }
 
 //
@@ -150,61 +213,88 @@ std::shared_ptr<XmlNode> ImmediateWorkItemQueue::getXml(void) const
 // locking and unlocking.
 //
 
-void ImmediateWorkItemQueue::throwIfDuplicateThermalThresholdCrossedEvent(ImmediateWorkItem* newWorkItem)
+void ImmediateWorkItemQueue::throwIfDuplicateEvent(ImmediateWorkItem* newWorkItem,
+    Bool& isCoalescingEvent, UInt64& coalescingKey)
 {
-    // FIXME: need to update once domain support has been added.  In that case we should
-    // check the domain field as well.
+    isCoalescingEvent = ImmediateWorkItemQueue::isCoalescingEvent(newWorkItem->getFrameworkEventType());
 
-    if (newWorkItem->getFrameworkEventType() == FrameworkEvent::DomainTemperatureThresholdCrossed)
+    if (isCoalescingEvent == true)
     {
-        WorkItemInterface* workItem = newWorkItem->getWorkItem();
-        ParticipantWorkItem* participantWorkItem = static_cast<ParticipantWorkItem*>(workItem);
-
-        WorkItemMatchCriteria matchCriteria;
-        matchCriteria.addFrameworkEventTypeToMatchList(participantWorkItem->getFrameworkEventType());
-        matchCriteria.addParticipantIndexToMatchList(participantWorkItem->getParticipantIndex());
+        coalescingKey = getCoalescingKey(newWorkItem->getWorkItem());
 
-        for (auto it = m_queue.begin(); it != m_queue.end(); it++)
+        if (m_coalescingIndex.find(coalescingKey) != m_coalescingIndex.end())
         {
-            ImmediateWorkItem* currentWorkItem = *it;
-            Bool foundDuplicate = currentWorkItem->matches(matchCriteria);
-            if (foundDuplicate == true)
-            {
-                throw duplicate_work_item("Attempted to insert duplicate thermal threshold crossed event into immediate queue.");
-            }
+            m_totalCoalesced++;
+            throw duplicate_work_item("Attempted to insert duplicate event into immediate queue.");
         }
     }
 }
 
-void ImmediateWorkItemQueue::insertSortedByPriority(ImmediateWorkItem* newWorkItem)
+void ImmediateWorkItemQueue::insertSortedByPriority(ImmediateWorkItem* newWorkItem,
+    Bool isCoalescingEvent, UInt64 coalescingKey)
 {
-    // To improve performance we check for the common cases first and skip the queue
-    // iteration when we can.
-    if (m_queue.empty() == true || newWorkItem->getPriority() == 0)
+    ImmediateWorkItemQueueKey key;
+    key.priority = newWorkItem->getPriority();
+    key.sequenceNumber = m_nextSequenceNumber++;
+
+    m_queue.insert(std::make_pair(key, newWorkItem));
+    m_uniqueIdIndex[newWorkItem->getUniqueId()] = key;
+
+    FrameworkEvent::Type frameworkEventType = newWorkItem->getFrameworkEventType();
+    if (frameworkEventType < FrameworkEvent::Max)
     {
-        m_queue.push_back(newWorkItem);
+        m_frameworkEventIndex[frameworkEventType].insert(key);
     }
-    else
+
+    UIntN participantIndex = getParticipantIndex(newWorkItem->getWorkItem());
+    if (participantIndex != Constants::Invalid)
     {
-        auto it = m_queue.begin();
+        m_participantIndex[participantIndex].insert(key);
+    }
+
+    if (isCoalescingEvent == true)
+    {
+        m_coalescingIndex[coalescingKey] = key;
+    }
 
-        for (; it != m_queue.end(); it++)
+    m_workItemQueueSemaphore->signal();
+}
+
+std::map<ImmediateWorkItemQueueKey, ImmediateWorkItem*>::iterator ImmediateWorkItemQueue::eraseFromQueue(
+    std::map<ImmediateWorkItemQueueKey, ImmediateWorkItem*>::iterator it)
+{
+    // Removes the work item from the queue and all indexes.  The work item itself is not deleted.
+
+    ImmediateWorkItem* workItem = it->second;
+    FrameworkEvent::Type frameworkEventType = workItem->getFrameworkEventType();
+
+    m_uniqueIdIndex.erase(workItem->getUniqueId());
+
+    if (frameworkEventType < FrameworkEvent::Max)
+    {
+        m_frameworkEventIndex[frameworkEventType].erase(it->first);
+    }
+
+    UIntN participantIndex = getParticipantIndex(workItem->getWorkItem());
+    if (participantIndex != Constants::Invalid)
+    {
+        auto participant = m_participantIndex.find(participantIndex);
+        if (participant != m_participantIndex.end())
         {
-            ImmediateWorkItem* currentWorkItem = *it;
-            if (newWorkItem->getPriority() > currentWorkItem->getPriority())
+            participant->second.erase(it->first);
+            if (participant->second.empty() == true)
             {
-                m_queue.insert(it, newWorkItem);
-                break;
+                m_participantIndex.erase(participant);
             }
         }
+    }
 
-        if (it == m_queue.end())
-        {
-            m_queue.push_back(newWorkItem);
-        }
+    if (isCoalescingEvent(frameworkEventType) == true)
+    {
+        m_coalescingIndex.erase(getCoalescingKey(workItem->getWorkItem()));
     }
 
-    m_workItemQueueSemaphore->signal();
+    return m_queue.erase(it);
 }
 
 void ImmediateWorkItemQueue::updateMaxCount()
@@ -213,4 +303,76 @@ void ImmediateWorkItemQueue::updateMaxCount()
     {
         m_maxCount = m_queue.size();
     }
+}
+
+Bool ImmediateWorkItemQueue::isCoalescingEvent(FrameworkEvent::Type frameworkEventType)
+{
+    // These events only tell the framework that something changed and carry no data of their own.  If the same
+    // event for the same participant and domain is already waiting in the queue, the new one adds nothing.
+
+    switch (frameworkEventType)
+    {
+        case FrameworkEvent::ParticipantSpecificInfoChanged:
+        case FrameworkEvent::DomainConfigTdpCapabilityChanged:
+        case FrameworkEvent::DomainCoreControlCapabilityChanged:
+        case FrameworkEvent::DomainDisplayControlCapabilityChanged:
+        case FrameworkEvent::DomainDisplayStatusChanged:
+        case FrameworkEvent::DomainPerformanceControlCapabilityChanged:
+        case FrameworkEvent::DomainPerformanceControlsChanged:
+        case FrameworkEvent::DomainPowerControlCapabilityChanged:
+        case FrameworkEvent::DomainPriorityChanged:
+        case FrameworkEvent::DomainRfProfileChanged:
+        case FrameworkEvent::DomainTemperatureThresholdCrossed:
+        case FrameworkEvent::DomainVirtualSensorCalibrationTableChanged:
+        case FrameworkEvent::DomainVirtualSensorPollingTableChanged:
+        case FrameworkEvent::DomainVirtualSensorRecalcChanged:
+        case FrameworkEvent::DomainBatteryStatusChanged:
+        case FrameworkEvent::DomainBatteryInformationChanged:
+        case FrameworkEvent::DomainPlatformPowerSourceChanged:
+        case FrameworkEvent::DomainAdapterPowerRatingChanged:
+        case FrameworkEvent::DomainChargerTypeChanged:
+        case FrameworkEvent::DomainPlatformRestOfPowerChanged:
+        case FrameworkEvent::DomainACPeakPowerChanged:
+        case FrameworkEvent::DomainACPeakTimeWindowChanged:
+        case FrameworkEvent::DomainMaxBatteryPowerChanged:
+        case FrameworkEvent::DomainPlatformBatterySteadyStateChanged:
+        case FrameworkEvent::PolicyActiveRelationshipTableChanged:
+        case FrameworkEvent::PolicyPassiveTableChanged:
+        case FrameworkEvent::PolicyThermalRelationshipTableChanged:
+        case FrameworkEvent::PolicyAdaptivePerformanceConditionsTableChanged:
+        case FrameworkEvent::PolicyAdaptivePerformanceParticipantConditionTableChanged:
+        case FrameworkEvent::PolicyAdaptivePerformanceActionsTableChanged:
+        case FrameworkEvent::PolicyOemVariablesChanged:
+        case FrameworkEvent::PolicyPowerBossConditionsTableChanged:
+        case FrameworkEvent::PolicyPowerBossActionsTableChanged:
+        case FrameworkEvent::PolicyPowerBossMathTableChanged:
+        case FrameworkEvent::PolicyEmergencyCallModeTableChanged:
+        case FrameworkEvent::PolicyPidAlgorithmTableChanged:
+        case FrameworkEvent::PolicyActiveControlPointRelationshipTableChanged:
+            return true;
+        default:
+            return false;
+    }
+}
+
+UInt64 ImmediateWorkItemQueue::getCoalescingKey(WorkItemInterface* workItem)
+{
+    UInt64 participantIndex = getParticipantIndex(workItem);
+    UInt64 domainIndex = Constants::Invalid;
+
+    DomainWorkItem* domainWorkItem = dynamic_cast<DomainWorkItem*>(workItem);
+    if (domainWorkItem != nullptr)
+    {
+        domainIndex = domainWorkItem->getDomainIndex();
+    }
+
+    // 16 bits for the event type and 24 bits each for the participant and domain index
+    return (static_cast<UInt64>(workItem->getFrameworkEventType()) << 48) |
+        ((participantIndex & 0xFFFFFF) << 24) | (domainIndex & 0xFFFFFF);
+}
+
+UIntN ImmediateWorkItemQueue::getParticipantIndex(WorkItemInterface* workItem)
+{
+    ParticipantWorkItem* participantWorkItem = dynamic_cast<ParticipantWorkItem*>(workItem);
+    return (participantWorkItem != nullptr) ? participantWorkItem->getParticipantIndex() : Constants::Invalid;
 }
\ No newline at end of file
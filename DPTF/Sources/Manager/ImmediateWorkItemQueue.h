@@ -23,6 +23,21 @@
 #include "ImmediateWorkItem.h"
 #include "EsifMutex.h"
 #include "EsifSemaphore.h"
+#include <unordered_map>
+
+// Position of a work item in the immediate queue.  Higher priority work items come first and work items with the
+// same priority are kept in the order they were enqueued.
+struct ImmediateWorkItemQueueKey
+{
+    UIntN priority;
+    UInt64 sequenceNumber;
+
+    Bool operator<(const ImmediateWorkItemQueueKey& rhs) const
+    {
+        return (priority > rhs.priority) ||
+            ((priority == rhs.priority) && (sequenceNumber < rhs.sequenceNumber));
+    }
+};
 
 class ImmediateWorkItemQueue : public WorkItemQueueInterface
 {
@@ -39,7 +54,11 @@ public:
     virtual UInt64 getCount(void) const override final;
     virtual UInt64 getMaxCount(void) const override final;
     virtual UIntN removeIfMatches(const WorkItemMatchCriteria& matchCriteria) override final;
-    virtual std::shared_ptr<XmlNode> getXml(void) const override final;
+    virtual void writeStatus(StatusWriter& writer) const override final;
+
+    // Also used by the WorkItemExecutor to coalesce work items waiting for a worker.
+    static Bool isCoalescingEvent(FrameworkEvent::Type frameworkEventType);
+    static UInt64 getCoalescingKey(WorkItemInterface* workItem);
 
 private:
 
@@ -47,12 +66,25 @@ private:
     ImmediateWorkItemQueue(const ImmediateWorkItemQueue& rhs);
     ImmediateWorkItemQueue& operator=(const ImmediateWorkItemQueue& rhs);
 
-    std::list<ImmediateWorkItem*> m_queue;
+    // The queue is an ordered tree so enqueue, dequeue, and removal of any work item are O(log n).
+    std::map<ImmediateWorkItemQueueKey, ImmediateWorkItem*> m_queue;
+    UInt64 m_nextSequenceNumber;
     UInt64 m_maxCount;                                              // stores the maximum number of items in the queue at any one time
+    UInt64 m_totalCoalesced;                                        // number of duplicate events rejected
     mutable EsifMutex m_mutex;
     EsifSemaphore* m_workItemQueueSemaphore;
 
-    void throwIfDuplicateThermalThresholdCrossedEvent(ImmediateWorkItem* newWorkItem);
-    void insertSortedByPriority(ImmediateWorkItem* newWorkItem);
+    // Indexes into m_queue.  They must be updated whenever a work item is added or removed.
+    std::unordered_map<UInt64, ImmediateWorkItemQueueKey> m_uniqueIdIndex;
+    std::vector<std::set<ImmediateWorkItemQueueKey>> m_frameworkEventIndex;
+    std::unordered_map<UIntN, std::set<ImmediateWorkItemQueueKey>> m_participantIndex;  // empty buckets are erased
+    std::unordered_map<UInt64, ImmediateWorkItemQueueKey> m_coalescingIndex;  // keyed by (event, participant, domain)
+
+    void throwIfDuplicateEvent(ImmediateWorkItem* newWorkItem, Bool& isCoalescingEvent, UInt64& coalescingKey);
+    void insertSortedByPriority(ImmediateWorkItem* newWorkItem, Bool isCoalescingEvent, UInt64 coalescingKey);
+    std::map<ImmediateWorkItemQueueKey, ImmediateWorkItem*>::iterator eraseFromQueue(
+        std::map<ImmediateWorkItemQueueKey, ImmediateWorkItem*>::iterator it);
     void updateMaxCount(void);
+
+    static UIntN getParticipantIndex(WorkItemInterface* workItem);
 };
\ No newline at end of file
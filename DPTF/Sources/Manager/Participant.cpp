@@ -24,7 +24,10 @@
 #include "esif_sdk_iface_app.h"
 #include "ManagerMessage.h"
 #include "MapOps.h"
+#include "XmlNode.h"
 #include "Utility.h"
+#include "EsifMutexHelper.h"
+#include "DptfStatusInterface.h"
 
 Participant::Participant(DptfManagerInterface* dptfManager) :
     m_participantCreated(false),
@@ -129,18 +132,27 @@ void Participant::destroyParticipant(void)
 
 void Participant::enableParticipant(void)
 {
+    EsifMutexHelper esifMutexHelper(&m_mutex);
+    esifMutexHelper.lock();
+
     throwIfRealParticipantIsInvalid();
     m_theRealParticipant->enableParticipant();
 }
 
 void Participant::disableParticipant(void)
 {
+    EsifMutexHelper esifMutexHelper(&m_mutex);
+    esifMutexHelper.lock();
+
     throwIfRealParticipantIsInvalid();
     m_theRealParticipant->disableParticipant();
 }
 
 Bool Participant::isParticipantEnabled(void)
 {
+    EsifMutexHelper esifMutexHelper(&m_mutex);
+    esifMutexHelper.lock();
+
     throwIfRealParticipantIsInvalid();
     return m_theRealParticipant->isParticipantEnabled();
 }
@@ -211,18 +223,27 @@ Bool Participant::isDomainValid(UIntN domainIndex) const
 
 void Participant::enableDomain(UIntN domainIndex)
 {
+    EsifMutexHelper esifMutexHelper(&m_mutex);
+    esifMutexHelper.lock();
+
     throwIfDomainInvalid(domainIndex);
     m_domains[domainIndex]->enableDomain();
 }
 
 void Participant::disableDomain(UIntN domainIndex)
 {
+    EsifMutexHelper esifMutexHelper(&m_mutex);
+    esifMutexHelper.lock();
+
     throwIfDomainInvalid(domainIndex);
     m_domains[domainIndex]->disableDomain();
 }
 
 Bool Participant::isDomainEnabled(UIntN domainIndex)
 {
+    EsifMutexHelper esifMutexHelper(&m_mutex);
+    esifMutexHelper.lock();
+
     throwIfDomainInvalid(domainIndex);
     return m_domains[domainIndex]->isDomainEnabled();
 }
@@ -244,6 +265,9 @@ UIntN Participant::getDomainCount(void) const
 
 void Participant::clearParticipantCachedData(void)
 {
+    EsifMutexHelper esifMutexHelper(&m_mutex);
+    esifMutexHelper.lock();
+
     for (auto domain = m_domains.begin(); domain != m_domains.end(); ++domain)
     {
         if (domain->second != nullptr)
@@ -255,6 +279,9 @@ void Participant::clearParticipantCachedData(void)
 
 void Participant::clearArbitrationDataForPolicy(UIntN policyIndex)
 {
+    EsifMutexHelper esifMutexHelper(&m_mutex);
+    esifMutexHelper.lock();
+
     for (auto domain = m_domains.begin(); domain != m_domains.end(); ++domain)
     {
         if (domain->second != nullptr)
@@ -296,20 +323,51 @@ std::string Participant::getParticipantName(void) const
 
 std::string Participant::getDomainName(UIntN domainIndex)
 {
+    EsifMutexHelper esifMutexHelper(&m_mutex);
+    esifMutexHelper.lock();
+
     throwIfDomainInvalid(domainIndex);
     return m_domains[domainIndex]->getDomainName();
 }
 
 std::shared_ptr<XmlNode> Participant::getXml(UIntN domainIndex) const
 {
+    EsifMutexHelper esifMutexHelper(&m_mutex);
+    esifMutexHelper.lock();
+
     throwIfRealParticipantIsInvalid();
     return m_theRealParticipant->getXml(domainIndex);
 }
 
 std::shared_ptr<XmlNode> Participant::getStatusAsXml(UIntN domainIndex) const
 {
+    EsifMutexHelper esifMutexHelper(&m_mutex);
+    esifMutexHelper.lock();
+
     throwIfRealParticipantIsInvalid();
-    return m_theRealParticipant->getStatusAsXml(domainIndex);
+    auto participantRoot = m_theRealParticipant->getStatusAsXml(domainIndex);
+
+    // Add the framework cache statistics for the domain to the participant status
+    auto domain = m_domains.find(domainIndex);
+    if ((domain != m_domains.end()) && (domain->second != nullptr))
+    {
+        std::shared_ptr<XmlNode> participantNode;
+        for (auto child : participantRoot->getChildren())
+        {
+            if ((child->getNodeType() == NodeType::Element) && (child->getXmlTag() == "participant"))
+            {
+                participantNode = child;
+                break;
+            }
+        }
+
+        if (participantNode != nullptr)
+        {
+            participantNode->addChild(domain->second->getCacheStatusAsXml());
+        }
+    }
+
+    return participantRoot;
 }
 
 //
@@ -318,6 +376,9 @@ std::shared_ptr<XmlNode> Participant::getStatusAsXml(UIntN domainIndex) const
 
 void Participant::connectedStandbyEntry(void)
 {
+    EsifMutexHelper esifMutexHelper(&m_mutex);
+    esifMutexHelper.lock();
+
     if (isEventRegistered(ParticipantEvent::DptfConnectedStandbyEntry))
     {
         throwIfRealParticipantIsInvalid();
@@ -327,6 +388,9 @@ void Participant::connectedStandbyEntry(void)
 
 void Participant::connectedStandbyExit(void)
 {
+    EsifMutexHelper esifMutexHelper(&m_mutex);
+    esifMutexHelper.lock();
+
     if (isEventRegistered(ParticipantEvent::DptfConnectedStandbyExit))
     {
         throwIfRealParticipantIsInvalid();
@@ -336,6 +400,9 @@ void Participant::connectedStandbyExit(void)
 
 void Participant::suspend(void)
 {
+    EsifMutexHelper esifMutexHelper(&m_mutex);
+    esifMutexHelper.lock();
+
     if (isEventRegistered(ParticipantEvent::DptfSuspend))
     {
         throwIfRealParticipantIsInvalid();
@@ -345,6 +412,9 @@ void Participant::suspend(void)
 
 void Participant::resume(void)
 {
+    EsifMutexHelper esifMutexHelper(&m_mutex);
+    esifMutexHelper.lock();
+
     if (isEventRegistered(ParticipantEvent::DptfResume))
     {
         throwIfRealParticipantIsInvalid();
@@ -354,6 +424,9 @@ void Participant::resume(void)
 
 void Participant::activityLoggingEnabled(UInt32 domainIndex, UInt32 capabilityBitMask)
 {
+    EsifMutexHelper esifMutexHelper(&m_mutex);
+    esifMutexHelper.lock();
+
     if (isEventRegistered(ParticipantEvent::DptfParticipantActivityLoggingEnabled))
     {
         throwIfRealParticipantIsInvalid();
@@ -363,6 +436,9 @@ void Participant::activityLoggingEnabled(UInt32 domainIndex, UInt32 capabilityBi
 
 void Participant::activityLoggingDisabled(UInt32 domainIndex, UInt32 capabilityBitMask)
 {
+    EsifMutexHelper esifMutexHelper(&m_mutex);
+    esifMutexHelper.lock();
+
     if (isEventRegistered(ParticipantEvent::DptfParticipantActivityLoggingDisabled))
     {
         throwIfRealParticipantIsInvalid();
@@ -372,6 +448,9 @@ void Participant::activityLoggingDisabled(UInt32 domainIndex, UInt32 capabilityB
 
 void Participant::domainConfigTdpCapabilityChanged(void)
 {
+    EsifMutexHelper esifMutexHelper(&m_mutex);
+    esifMutexHelper.lock();
+
     if (isEventRegistered(ParticipantEvent::DomainConfigTdpCapabilityChanged))
     {
         throwIfRealParticipantIsInvalid();
@@ -381,6 +460,9 @@ void Participant::domainConfigTdpCapabilityChanged(void)
 
 void Participant::domainCoreControlCapabilityChanged(void)
 {
+    EsifMutexHelper esifMutexHelper(&m_mutex);
+    esifMutexHelper.lock();
+
     if (isEventRegistered(ParticipantEvent::DomainCoreControlCapabilityChanged))
     {
         throwIfRealParticipantIsInvalid();
@@ -390,6 +472,9 @@ void Participant::domainCoreControlCapabilityChanged(void)
 
 void Participant::domainDisplayControlCapabilityChanged(void)
 {
+    EsifMutexHelper esifMutexHelper(&m_mutex);
+    esifMutexHelper.lock();
+
     if (isEventRegistered(ParticipantEvent::DomainDisplayControlCapabilityChanged))
     {
         throwIfRealParticipantIsInvalid();
@@ -399,6 +484,9 @@ void Participant::domainDisplayControlCapabilityChanged(void)
 
 void Participant::domainDisplayStatusChanged(void)
 {
+    EsifMutexHelper esifMutexHelper(&m_mutex);
+    esifMutexHelper.lock();
+
     if (isEventRegistered(ParticipantEvent::DomainDisplayStatusChanged))
     {
         throwIfRealParticipantIsInvalid();
@@ -408,6 +496,9 @@ void Participant::domainDisplayStatusChanged(void)
 
 void Participant::domainPerformanceControlCapabilityChanged(void)
 {
+    EsifMutexHelper esifMutexHelper(&m_mutex);
+    esifMutexHelper.lock();
+
     if (isEventRegistered(ParticipantEvent::DomainPerformanceControlCapabilityChanged))
     {
         throwIfRealParticipantIsInvalid();
@@ -417,6 +508,9 @@ void Participant::domainPerformanceControlCapabilityChanged(void)
 
 void Participant::domainPerformanceControlsChanged(void)
 {
+    EsifMutexHelper esifMutexHelper(&m_mutex);
+    esifMutexHelper.lock();
+
     if (isEventRegistered(ParticipantEvent::DomainPerformanceControlsChanged))
     {
         throwIfRealParticipantIsInvalid();
@@ -426,6 +520,9 @@ void Participant::domainPerformanceControlsChanged(void)
 
 void Participant::domainPowerControlCapabilityChanged(void)
 {
+    EsifMutexHelper esifMutexHelper(&m_mutex);
+    esifMutexHelper.lock();
+
     if (isEventRegistered(ParticipantEvent::DomainPowerControlCapabilityChanged))
     {
         throwIfRealParticipantIsInvalid();
@@ -435,6 +532,9 @@ void Participant::domainPowerControlCapabilityChanged(void)
 
 void Participant::domainPriorityChanged(void)
 {
+    EsifMutexHelper esifMutexHelper(&m_mutex);
+    esifMutexHelper.lock();
+
     if (isEventRegistered(ParticipantEvent::DomainPriorityChanged))
     {
         throwIfRealParticipantIsInvalid();
@@ -444,6 +544,9 @@ void Participant::domainPriorityChanged(void)
 
 void Participant::domainRadioConnectionStatusChanged(RadioConnectionStatus::Type radioConnectionStatus)
 {
+    EsifMutexHelper esifMutexHelper(&m_mutex);
+    esifMutexHelper.lock();
+
     if (isEventRegistered(ParticipantEvent::DomainRadioConnectionStatusChanged))
     {
         throwIfRealParticipantIsInvalid();
@@ -453,6 +556,9 @@ void Participant::domainRadioConnectionStatusChanged(RadioConnectionStatus::Type
 
 void Participant::domainRfProfileChanged(void)
 {
+    EsifMutexHelper esifMutexHelper(&m_mutex);
+    esifMutexHelper.lock();
+
     if (isEventRegistered(ParticipantEvent::DomainRfProfileChanged))
     {
         throwIfRealParticipantIsInvalid();
@@ -462,6 +568,9 @@ void Participant::domainRfProfileChanged(void)
 
 void Participant::domainTemperatureThresholdCrossed(void)
 {
+    EsifMutexHelper esifMutexHelper(&m_mutex);
+    esifMutexHelper.lock();
+
     if (isEventRegistered(ParticipantEvent::DomainTemperatureThresholdCrossed))
     {
         throwIfRealParticipantIsInvalid();
@@ -471,6 +580,9 @@ void Participant::domainTemperatureThresholdCrossed(void)
 
 void Participant::participantSpecificInfoChanged(void)
 {
+    EsifMutexHelper esifMutexHelper(&m_mutex);
+    esifMutexHelper.lock();
+
     if (isEventRegistered(ParticipantEvent::ParticipantSpecificInfoChanged))
     {
         throwIfRealParticipantIsInvalid();
@@ -480,6 +592,9 @@ void Participant::participantSpecificInfoChanged(void)
 
 void Participant::domainVirtualSensorCalibrationTableChanged(void)
 {
+    EsifMutexHelper esifMutexHelper(&m_mutex);
+    esifMutexHelper.lock();
+
     if (isEventRegistered(ParticipantEvent::DomainVirtualSensorCalibrationTableChanged))
     {
         throwIfRealParticipantIsInvalid();
@@ -489,6 +604,9 @@ void Participant::domainVirtualSensorCalibrationTableChanged(void)
 
 void Participant::domainVirtualSensorPollingTableChanged(void)
 {
+    EsifMutexHelper esifMutexHelper(&m_mutex);
+    esifMutexHelper.lock();
+
     if (isEventRegistered(ParticipantEvent::DomainVirtualSensorPollingTableChanged))
     {
         throwIfRealParticipantIsInvalid();
@@ -498,6 +616,9 @@ void Participant::domainVirtualSensorPollingTableChanged(void)
 
 void Participant::domainVirtualSensorRecalcChanged(void)
 {
+    EsifMutexHelper esifMutexHelper(&m_mutex);
+    esifMutexHelper.lock();
+
     if (isEventRegistered(ParticipantEvent::DomainVirtualSensorRecalcChanged))
     {
         throwIfRealParticipantIsInvalid();
@@ -507,6 +628,9 @@ void Participant::domainVirtualSensorRecalcChanged(void)
 
 void Participant::domainBatteryStatusChanged(void)
 {
+    EsifMutexHelper esifMutexHelper(&m_mutex);
+    esifMutexHelper.lock();
+
     if (isEventRegistered(ParticipantEvent::DomainBatteryStatusChanged))
     {
         throwIfRealParticipantIsInvalid();
@@ -516,6 +640,9 @@ void Participant::domainBatteryStatusChanged(void)
 
 void Participant::domainBatteryInformationChanged(void)
 {
+    EsifMutexHelper esifMutexHelper(&m_mutex);
+    esifMutexHelper.lock();
+
     if (isEventRegistered(ParticipantEvent::DomainBatteryInformationChanged))
     {
         throwIfRealParticipantIsInvalid();
@@ -525,6 +652,9 @@ void Participant::domainBatteryInformationChanged(void)
 
 void Participant::domainPlatformPowerSourceChanged(void)
 {
+    EsifMutexHelper esifMutexHelper(&m_mutex);
+    esifMutexHelper.lock();
+
     if (isEventRegistered(ParticipantEvent::DomainPlatformPowerSourceChanged))
     {
         throwIfRealParticipantIsInvalid();
@@ -534,6 +664,9 @@ void Participant::domainPlatformPowerSourceChanged(void)
 
 void Participant::domainAdapterPowerRatingChanged(void)
 {
+    EsifMutexHelper esifMutexHelper(&m_mutex);
+    esifMutexHelper.lock();
+
     if (isEventRegistered(ParticipantEvent::DomainAdapterPowerRatingChanged))
     {
         throwIfRealParticipantIsInvalid();
@@ -543,6 +676,9 @@ void Participant::domainAdapterPowerRatingChanged(void)
 
 void Participant::domainChargerTypeChanged(void)
 {
+    EsifMutexHelper esifMutexHelper(&m_mutex);
+    esifMutexHelper.lock();
+
     if (isEventRegistered(ParticipantEvent::DomainChargerTypeChanged))
     {
         throwIfRealParticipantIsInvalid();
@@ -552,6 +688,9 @@ void Participant::domainChargerTypeChanged(void)
 
 void Participant::domainPlatformRestOfPowerChanged(void)
 {
+    EsifMutexHelper esifMutexHelper(&m_mutex);
+    esifMutexHelper.lock();
+
     if (isEventRegistered(ParticipantEvent::DomainPlatformRestOfPowerChanged))
     {
         throwIfRealParticipantIsInvalid();
@@ -561,6 +700,9 @@ void Participant::domainPlatformRestOfPowerChanged(void)
 
 void Participant::domainACPeakPowerChanged(void)
 {
+    EsifMutexHelper esifMutexHelper(&m_mutex);
+    esifMutexHelper.lock();
+
     if (isEventRegistered(ParticipantEvent::DomainACPeakPowerChanged))
     {
         throwIfRealParticipantIsInvalid();
@@ -570,6 +712,9 @@ void Participant::domainACPeakPowerChanged(void)
 
 void Participant::domainACPeakTimeWindowChanged(void)
 {
+    EsifMutexHelper esifMutexHelper(&m_mutex);
+    esifMutexHelper.lock();
+
     if (isEventRegistered(ParticipantEvent::DomainACPeakTimeWindowChanged))
     {
         throwIfRealParticipantIsInvalid();
@@ -579,6 +724,9 @@ void Participant::domainACPeakTimeWindowChanged(void)
 
 void Participant::domainMaxBatteryPowerChanged(void)
 {
+    EsifMutexHelper esifMutexHelper(&m_mutex);
+    esifMutexHelper.lock();
+
     if (isEventRegistered(ParticipantEvent::DomainMaxBatteryPowerChanged))
     {
         throwIfRealParticipantIsInvalid();
@@ -588,6 +736,9 @@ void Participant::domainMaxBatteryPowerChanged(void)
 
 void Participant::domainPlatformBatterySteadyStateChanged(void)
 {
+    EsifMutexHelper esifMutexHelper(&m_mutex);
+    esifMutexHelper.lock();
+
     if (isEventRegistered(ParticipantEvent::DomainPlatformBatterySteadyStateChanged))
     {
         throwIfRealParticipantIsInvalid();
@@ -601,218 +752,338 @@ void Participant::domainPlatformBatterySteadyStateChanged(void)
 
 ActiveControlStaticCaps Participant::getActiveControlStaticCaps(UIntN domainIndex)
 {
+    EsifMutexHelper esifMutexHelper(&m_mutex);
+    esifMutexHelper.lock();
+
     throwIfDomainInvalid(domainIndex);
     return m_domains[domainIndex]->getActiveControlStaticCaps();
 }
 
 ActiveControlStatus Participant::getActiveControlStatus(UIntN domainIndex)
 {
+    EsifMutexHelper esifMutexHelper(&m_mutex);
+    esifMutexHelper.lock();
+
     throwIfDomainInvalid(domainIndex);
     return m_domains[domainIndex]->getActiveControlStatus();
 }
 
 ActiveControlSet Participant::getActiveControlSet(UIntN domainIndex)
 {
+    EsifMutexHelper esifMutexHelper(&m_mutex);
+    esifMutexHelper.lock();
+
     throwIfDomainInvalid(domainIndex);
     return m_domains[domainIndex]->getActiveControlSet();
 }
 
 void Participant::setActiveControl(UIntN domainIndex, UIntN policyIndex, UIntN controlIndex)
 {
+    EsifMutexHelper esifMutexHelper(&m_mutex);
+    esifMutexHelper.lock();
+
     throwIfDomainInvalid(domainIndex);
     m_domains[domainIndex]->setActiveControl(policyIndex, controlIndex);
+    m_dptfManager->getDptfStatus()->participantChanged(m_participantIndex);
 }
 
 void Participant::setActiveControl(UIntN domainIndex, UIntN policyIndex, const Percentage& fanSpeed)
 {
+    EsifMutexHelper esifMutexHelper(&m_mutex);
+    esifMutexHelper.lock();
+
     throwIfDomainInvalid(domainIndex);
     m_domains[domainIndex]->setActiveControl(policyIndex, fanSpeed);
+    m_dptfManager->getDptfStatus()->participantChanged(m_participantIndex);
 }
 
 ConfigTdpControlDynamicCaps Participant::getConfigTdpControlDynamicCaps(UIntN domainIndex)
 {
+    EsifMutexHelper esifMutexHelper(&m_mutex);
+    esifMutexHelper.lock();
+
     throwIfDomainInvalid(domainIndex);
     return m_domains[domainIndex]->getConfigTdpControlDynamicCaps();
 }
 
 ConfigTdpControlStatus Participant::getConfigTdpControlStatus(UIntN domainIndex)
 {
+    EsifMutexHelper esifMutexHelper(&m_mutex);
+    esifMutexHelper.lock();
+
     throwIfDomainInvalid(domainIndex);
     return m_domains[domainIndex]->getConfigTdpControlStatus();
 }
 
 ConfigTdpControlSet Participant::getConfigTdpControlSet(UIntN domainIndex)
 {
+    EsifMutexHelper esifMutexHelper(&m_mutex);
+    esifMutexHelper.lock();
+
     throwIfDomainInvalid(domainIndex);
     return m_domains[domainIndex]->getConfigTdpControlSet();
 }
 
 void Participant::setConfigTdpControl(UIntN domainIndex, UIntN policyIndex, UIntN controlIndex)
 {
+    EsifMutexHelper esifMutexHelper(&m_mutex);
+    esifMutexHelper.lock();
+
     throwIfDomainInvalid(domainIndex);
     m_domains[domainIndex]->setConfigTdpControl(policyIndex, controlIndex);
+    m_dptfManager->getDptfStatus()->participantChanged(m_participantIndex);
 }
 
 CoreControlStaticCaps Participant::getCoreControlStaticCaps(UIntN domainIndex)
 {
+    EsifMutexHelper esifMutexHelper(&m_mutex);
+    esifMutexHelper.lock();
+
     throwIfDomainInvalid(domainIndex);
     return m_domains[domainIndex]->getCoreControlStaticCaps();
 }
 
 CoreControlDynamicCaps Participant::getCoreControlDynamicCaps(UIntN domainIndex)
 {
+    EsifMutexHelper esifMutexHelper(&m_mutex);
+    esifMutexHelper.lock();
+
     throwIfDomainInvalid(domainIndex);
     return m_domains[domainIndex]->getCoreControlDynamicCaps();
 }
 
 CoreControlLpoPreference Participant::getCoreControlLpoPreference(UIntN domainIndex)
 {
+    EsifMutexHelper esifMutexHelper(&m_mutex);
+    esifMutexHelper.lock();
+
     throwIfDomainInvalid(domainIndex);
     return m_domains[domainIndex]->getCoreControlLpoPreference();
 }
 
 CoreControlStatus Participant::getCoreControlStatus(UIntN domainIndex)
 {
+    EsifMutexHelper esifMutexHelper(&m_mutex);
+    esifMutexHelper.lock();
+
     throwIfDomainInvalid(domainIndex);
     return m_domains[domainIndex]->getCoreControlStatus();
 }
 
 void Participant::setActiveCoreControl(UIntN domainIndex, UIntN policyIndex, const CoreControlStatus& coreControlStatus)
 {
+    EsifMutexHelper esifMutexHelper(&m_mutex);
+    esifMutexHelper.lock();
+
     throwIfDomainInvalid(domainIndex);
     m_domains[domainIndex]->setActiveCoreControl(policyIndex, coreControlStatus);
+    m_dptfManager->getDptfStatus()->participantChanged(m_participantIndex);
 }
 
 DisplayControlDynamicCaps Participant::getDisplayControlDynamicCaps(UIntN domainIndex)
 {
+    EsifMutexHelper esifMutexHelper(&m_mutex);
+    esifMutexHelper.lock();
+
     throwIfDomainInvalid(domainIndex);
     return m_domains[domainIndex]->getDisplayControlDynamicCaps();
 }
 
 DisplayControlStatus Participant::getDisplayControlStatus(UIntN domainIndex)
 {
+    EsifMutexHelper esifMutexHelper(&m_mutex);
+    esifMutexHelper.lock();
+
     throwIfDomainInvalid(domainIndex);
     return m_domains[domainIndex]->getDisplayControlStatus();
 }
 
 UIntN Participant::getUserPreferredDisplayIndex(UIntN domainIndex)
 {
+    EsifMutexHelper esifMutexHelper(&m_mutex);
+    esifMutexHelper.lock();
+
     throwIfDomainInvalid(domainIndex);
     return m_domains[domainIndex]->getUserPreferredDisplayIndex();
 }
 
 Bool Participant::isUserPreferredIndexModified(UIntN domainIndex)
 {
+    EsifMutexHelper esifMutexHelper(&m_mutex);
+    esifMutexHelper.lock();
+
     throwIfDomainInvalid(domainIndex);
     return m_domains[domainIndex]->isUserPreferredIndexModified();
 }
 
 DisplayControlSet Participant::getDisplayControlSet(UIntN domainIndex)
 {
+    EsifMutexHelper esifMutexHelper(&m_mutex);
+    esifMutexHelper.lock();
+
     throwIfDomainInvalid(domainIndex);
     return m_domains[domainIndex]->getDisplayControlSet();
 }
 
 void Participant::setDisplayControl(UIntN domainIndex, UIntN policyIndex, UIntN displayControlIndex)
 {
+    EsifMutexHelper esifMutexHelper(&m_mutex);
+    esifMutexHelper.lock();
+
     throwIfDomainInvalid(domainIndex);
     m_domains[domainIndex]->setDisplayControl(policyIndex, displayControlIndex);
+    m_dptfManager->getDptfStatus()->participantChanged(m_participantIndex);
 }
 
 void Participant::setDisplayControlDynamicCaps(UIntN domainIndex, UIntN policyIndex, 
     DisplayControlDynamicCaps newCapabilities)
 {
+    EsifMutexHelper esifMutexHelper(&m_mutex);
+    esifMutexHelper.lock();
+
     throwIfDomainInvalid(domainIndex);
     m_domains[domainIndex]->setDisplayControlDynamicCaps(policyIndex, newCapabilities);
+    m_dptfManager->getDptfStatus()->participantChanged(m_participantIndex);
 }
 
 void Participant::setDisplayCapsLock(UIntN domainIndex, UIntN policyIndex, Bool lock)
 {
+    EsifMutexHelper esifMutexHelper(&m_mutex);
+    esifMutexHelper.lock();
+
     throwIfDomainInvalid(domainIndex);
     m_domains[domainIndex]->setDisplayCapsLock(policyIndex, lock);
+    m_dptfManager->getDptfStatus()->participantChanged(m_participantIndex);
 }
 
 PerformanceControlStaticCaps Participant::getPerformanceControlStaticCaps(UIntN domainIndex)
 {
+    EsifMutexHelper esifMutexHelper(&m_mutex);
+    esifMutexHelper.lock();
+
     throwIfDomainInvalid(domainIndex);
     return m_domains[domainIndex]->getPerformanceControlStaticCaps();
 }
 
 PerformanceControlDynamicCaps Participant::getPerformanceControlDynamicCaps(UIntN domainIndex)
 {
+    EsifMutexHelper esifMutexHelper(&m_mutex);
+    esifMutexHelper.lock();
+
     throwIfDomainInvalid(domainIndex);
     return m_domains[domainIndex]->getPerformanceControlDynamicCaps();
 }
 
 PerformanceControlStatus Participant::getPerformanceControlStatus(UIntN domainIndex)
 {
+    EsifMutexHelper esifMutexHelper(&m_mutex);
+    esifMutexHelper.lock();
+
     throwIfDomainInvalid(domainIndex);
     return m_domains[domainIndex]->getPerformanceControlStatus();
 }
 
 PerformanceControlSet Participant::getPerformanceControlSet(UIntN domainIndex)
 {
+    EsifMutexHelper esifMutexHelper(&m_mutex);
+    esifMutexHelper.lock();
+
     throwIfDomainInvalid(domainIndex);
     return m_domains[domainIndex]->getPerformanceControlSet();
 }
 
 void Participant::setPerformanceControl(UIntN domainIndex, UIntN policyIndex, UIntN performanceControlIndex)
 {
+    EsifMutexHelper esifMutexHelper(&m_mutex);
+    esifMutexHelper.lock();
+
     throwIfDomainInvalid(domainIndex);
     m_domains[domainIndex]->setPerformanceControl(policyIndex, performanceControlIndex);
+    m_dptfManager->getDptfStatus()->participantChanged(m_participantIndex);
 }
 
 void Participant::setPerformanceControlDynamicCaps(UIntN domainIndex, UIntN policyIndex, 
     PerformanceControlDynamicCaps newCapabilities)
 {
+    EsifMutexHelper esifMutexHelper(&m_mutex);
+    esifMutexHelper.lock();
+
     throwIfDomainInvalid(domainIndex);
     m_domains[domainIndex]->setPerformanceControlDynamicCaps(policyIndex, newCapabilities);
+    m_dptfManager->getDptfStatus()->participantChanged(m_participantIndex);
 }
 
 void Participant::setPerformanceCapsLock(UIntN domainIndex, UIntN policyIndex, Bool lock)
 {
+    EsifMutexHelper esifMutexHelper(&m_mutex);
+    esifMutexHelper.lock();
+
     throwIfDomainInvalid(domainIndex);
     m_domains[domainIndex]->setPerformanceCapsLock(policyIndex, lock);
+    m_dptfManager->getDptfStatus()->participantChanged(m_participantIndex);
 }
 
 void Participant::setPixelClockControl(UIntN domainIndex, UIntN policyIndex, const PixelClockDataSet& pixelClockDataSet)
 {
+    EsifMutexHelper esifMutexHelper(&m_mutex);
+    esifMutexHelper.lock();
+
     throwIfDomainInvalid(domainIndex);
     m_domains[domainIndex]->setPixelClockControl(policyIndex, pixelClockDataSet);
+    m_dptfManager->getDptfStatus()->participantChanged(m_participantIndex);
 }
 
 PixelClockCapabilities Participant::getPixelClockCapabilities(UIntN domainIndex)
 {
+    EsifMutexHelper esifMutexHelper(&m_mutex);
+    esifMutexHelper.lock();
+
     throwIfDomainInvalid(domainIndex);
     return m_domains[domainIndex]->getPixelClockCapabilities();
 }
 
 PixelClockDataSet Participant::getPixelClockDataSet(UIntN domainIndex)
 {
+    EsifMutexHelper esifMutexHelper(&m_mutex);
+    esifMutexHelper.lock();
+
     throwIfDomainInvalid(domainIndex);
     return m_domains[domainIndex]->getPixelClockDataSet();
 }
 
 PowerControlDynamicCapsSet Participant::getPowerControlDynamicCapsSet(UIntN domainIndex)
 {
+    EsifMutexHelper esifMutexHelper(&m_mutex);
+    esifMutexHelper.lock();
+
     throwIfDomainInvalid(domainIndex);
     return m_domains[domainIndex]->getPowerControlDynamicCapsSet();
 }
 
 void Participant::setPowerControlDynamicCapsSet(UIntN domainIndex, UIntN policyIndex, PowerControlDynamicCapsSet capsSet)
 {
+    EsifMutexHelper esifMutexHelper(&m_mutex);
+    esifMutexHelper.lock();
+
     throwIfDomainInvalid(domainIndex);
     m_domains[domainIndex]->setPowerControlDynamicCapsSet(policyIndex, capsSet);
+    m_dptfManager->getDptfStatus()->participantChanged(m_participantIndex);
 }
 
 Bool Participant::isPowerLimitEnabled(UIntN domainIndex, PowerControlType::Type controlType)
 {
+    EsifMutexHelper esifMutexHelper(&m_mutex);
+    esifMutexHelper.lock();
+
     throwIfDomainInvalid(domainIndex);
     return m_domains[domainIndex]->isPowerLimitEnabled(controlType);
 }
 
 Power Participant::getPowerLimit(UIntN domainIndex, PowerControlType::Type controlType)
 {
+    EsifMutexHelper esifMutexHelper(&m_mutex);
+    esifMutexHelper.lock();
+
     throwIfDomainInvalid(domainIndex);
     return m_domains[domainIndex]->getPowerLimit(controlType);
 }
@@ -820,19 +1091,30 @@ Power Participant::getPowerLimit(UIntN domainIndex, PowerControlType::Type contr
 void Participant::setPowerLimit(UIntN domainIndex, UIntN policyIndex, PowerControlType::Type controlType,
     const Power& powerLimit)
 {
+    EsifMutexHelper esifMutexHelper(&m_mutex);
+    esifMutexHelper.lock();
+
     throwIfDomainInvalid(domainIndex);
     m_domains[domainIndex]->setPowerLimit(policyIndex, controlType, powerLimit);
+    m_dptfManager->getDptfStatus()->participantChanged(m_participantIndex);
 }
 
 void Participant::setPowerLimitIgnoringCaps(UIntN domainIndex, UIntN policyIndex,
     PowerControlType::Type controlType, const Power& powerLimit)
 {
+    EsifMutexHelper esifMutexHelper(&m_mutex);
+    esifMutexHelper.lock();
+
     throwIfDomainInvalid(domainIndex);
     m_domains[domainIndex]->setPowerLimitIgnoringCaps(policyIndex, controlType, powerLimit);
+    m_dptfManager->getDptfStatus()->participantChanged(m_participantIndex);
 }
 
 TimeSpan Participant::getPowerLimitTimeWindow(UIntN domainIndex, PowerControlType::Type controlType)
 {
+    EsifMutexHelper esifMutexHelper(&m_mutex);
+    esifMutexHelper.lock();
+
     throwIfDomainInvalid(domainIndex);
     return m_domains[domainIndex]->getPowerLimitTimeWindow(controlType);
 }
@@ -840,19 +1122,30 @@ TimeSpan Participant::getPowerLimitTimeWindow(UIntN domainIndex, PowerControlTyp
 void Participant::setPowerLimitTimeWindow(UIntN domainIndex, UIntN policyIndex, PowerControlType::Type controlType,
     const TimeSpan& timeWindow)
 {
+    EsifMutexHelper esifMutexHelper(&m_mutex);
+    esifMutexHelper.lock();
+
     throwIfDomainInvalid(domainIndex);
     m_domains[domainIndex]->setPowerLimitTimeWindow(policyIndex, controlType, timeWindow);
+    m_dptfManager->getDptfStatus()->participantChanged(m_participantIndex);
 }
 
 void Participant::setPowerLimitTimeWindowIgnoringCaps(UIntN domainIndex, UIntN policyIndex,
     PowerControlType::Type controlType, const TimeSpan& timeWindow)
 {
+    EsifMutexHelper esifMutexHelper(&m_mutex);
+    esifMutexHelper.lock();
+
     throwIfDomainInvalid(domainIndex);
     m_domains[domainIndex]->setPowerLimitTimeWindowIgnoringCaps(policyIndex, controlType, timeWindow);
+    m_dptfManager->getDptfStatus()->participantChanged(m_participantIndex);
 }
 
 Percentage Participant::getPowerLimitDutyCycle(UIntN domainIndex, PowerControlType::Type controlType)
 {
+    EsifMutexHelper esifMutexHelper(&m_mutex);
+    esifMutexHelper.lock();
+
     throwIfDomainInvalid(domainIndex);
     return m_domains[domainIndex]->getPowerLimitDutyCycle(controlType);
 }
@@ -860,231 +1153,355 @@ Percentage Participant::getPowerLimitDutyCycle(UIntN domainIndex, PowerControlTy
 void Participant::setPowerLimitDutyCycle(UIntN domainIndex, UIntN policyIndex, PowerControlType::Type controlType,
     const Percentage& dutyCycle)
 {
+    EsifMutexHelper esifMutexHelper(&m_mutex);
+    esifMutexHelper.lock();
+
     throwIfDomainInvalid(domainIndex);
     m_domains[domainIndex]->setPowerLimitDutyCycle(policyIndex, controlType, dutyCycle);
+    m_dptfManager->getDptfStatus()->participantChanged(m_participantIndex);
 }
 
 void Participant::setPowerCapsLock(UIntN domainIndex, UIntN policyIndex, Bool lock)
 {
+    EsifMutexHelper esifMutexHelper(&m_mutex);
+    esifMutexHelper.lock();
+
     throwIfDomainInvalid(domainIndex);
     m_domains[domainIndex]->setPowerCapsLock(policyIndex, lock);
+    m_dptfManager->getDptfStatus()->participantChanged(m_participantIndex);
 }
 
 PowerStatus Participant::getPowerStatus(UIntN domainIndex)
 {
+    EsifMutexHelper esifMutexHelper(&m_mutex);
+    esifMutexHelper.lock();
+
     throwIfDomainInvalid(domainIndex);
     return m_domains[domainIndex]->getPowerStatus();
 }
 
 Power Participant::getAveragePower(UIntN domainIndex, const PowerControlDynamicCaps& capabilities)
 {
+    EsifMutexHelper esifMutexHelper(&m_mutex);
+    esifMutexHelper.lock();
+
     throwIfDomainInvalid(domainIndex);
     return m_domains[domainIndex]->getAveragePower(capabilities);
 }
 
 Bool Participant::isPlatformPowerLimitEnabled(UIntN domainIndex, PlatformPowerLimitType::Type limitType)
 {
+    EsifMutexHelper esifMutexHelper(&m_mutex);
+    esifMutexHelper.lock();
+
     throwIfDomainInvalid(domainIndex);
     return m_domains[domainIndex]->isPlatformPowerLimitEnabled(limitType);
 }
 
 Power Participant::getPlatformPowerLimit(UIntN domainIndex, PlatformPowerLimitType::Type limitType)
 {
+    EsifMutexHelper esifMutexHelper(&m_mutex);
+    esifMutexHelper.lock();
+
     throwIfDomainInvalid(domainIndex);
     return m_domains[domainIndex]->getPlatformPowerLimit(limitType);
 }
 
 void Participant::setPlatformPowerLimit(UIntN domainIndex, PlatformPowerLimitType::Type limitType, const Power& powerLimit)
 {
+    EsifMutexHelper esifMutexHelper(&m_mutex);
+    esifMutexHelper.lock();
+
     throwIfDomainInvalid(domainIndex);
     m_domains[domainIndex]->setPlatformPowerLimit(limitType, powerLimit);
+    m_dptfManager->getDptfStatus()->participantChanged(m_participantIndex);
 }
 
 TimeSpan Participant::getPlatformPowerLimitTimeWindow(UIntN domainIndex, PlatformPowerLimitType::Type limitType)
 {
+    EsifMutexHelper esifMutexHelper(&m_mutex);
+    esifMutexHelper.lock();
+
     throwIfDomainInvalid(domainIndex);
     return m_domains[domainIndex]->getPlatformPowerLimitTimeWindow(limitType);
 }
 
 void Participant::setPlatformPowerLimitTimeWindow(UIntN domainIndex, PlatformPowerLimitType::Type limitType, const TimeSpan& timeWindow)
 {
+    EsifMutexHelper esifMutexHelper(&m_mutex);
+    esifMutexHelper.lock();
+
     throwIfDomainInvalid(domainIndex);
     m_domains[domainIndex]->setPlatformPowerLimitTimeWindow(limitType, timeWindow);
+    m_dptfManager->getDptfStatus()->participantChanged(m_participantIndex);
 }
 
 Percentage Participant::getPlatformPowerLimitDutyCycle(UIntN domainIndex, PlatformPowerLimitType::Type limitType)
 {
+    EsifMutexHelper esifMutexHelper(&m_mutex);
+    esifMutexHelper.lock();
+
     throwIfDomainInvalid(domainIndex);
     return m_domains[domainIndex]->getPlatformPowerLimitDutyCycle(limitType);
 }
 
 void Participant::setPlatformPowerLimitDutyCycle(UIntN domainIndex, PlatformPowerLimitType::Type limitType, const Percentage& dutyCycle)
 {
+    EsifMutexHelper esifMutexHelper(&m_mutex);
+    esifMutexHelper.lock();
+
     throwIfDomainInvalid(domainIndex);
     m_domains[domainIndex]->setPlatformPowerLimitDutyCycle(limitType, dutyCycle);
+    m_dptfManager->getDptfStatus()->participantChanged(m_participantIndex);
 }
 
 Power Participant::getMaxBatteryPower(UIntN domainIndex)
 {
+    EsifMutexHelper esifMutexHelper(&m_mutex);
+    esifMutexHelper.lock();
+
     throwIfDomainInvalid(domainIndex);
     return m_domains[domainIndex]->getMaxBatteryPower();
 }
 
 Power Participant::getPlatformRestOfPower(UIntN domainIndex)
 {
+    EsifMutexHelper esifMutexHelper(&m_mutex);
+    esifMutexHelper.lock();
+
     throwIfDomainInvalid(domainIndex);
     return m_domains[domainIndex]->getPlatformRestOfPower();
 }
 
 Power Participant::getAdapterPowerRating(UIntN domainIndex)
 {
+    EsifMutexHelper esifMutexHelper(&m_mutex);
+    esifMutexHelper.lock();
+
     throwIfDomainInvalid(domainIndex);
     return m_domains[domainIndex]->getAdapterPowerRating();
 }
 
 DptfBuffer Participant::getBatteryStatus(UIntN domainIndex)
 {
+    EsifMutexHelper esifMutexHelper(&m_mutex);
+    esifMutexHelper.lock();
+
     throwIfDomainInvalid(domainIndex);
     return m_domains[domainIndex]->getBatteryStatus();
 }
 
 DptfBuffer Participant::getBatteryInformation(UIntN domainIndex)
 {
+    EsifMutexHelper esifMutexHelper(&m_mutex);
+    esifMutexHelper.lock();
+
     throwIfDomainInvalid(domainIndex);
     return m_domains[domainIndex]->getBatteryInformation();
 }
 
 PlatformPowerSource::Type Participant::getPlatformPowerSource(UIntN domainIndex)
 {
+    EsifMutexHelper esifMutexHelper(&m_mutex);
+    esifMutexHelper.lock();
+
     throwIfDomainInvalid(domainIndex);
     return m_domains[domainIndex]->getPlatformPowerSource();
 }
 
 ChargerType::Type Participant::getChargerType(UIntN domainIndex)
 {
+    EsifMutexHelper esifMutexHelper(&m_mutex);
+    esifMutexHelper.lock();
+
     throwIfDomainInvalid(domainIndex);
     return m_domains[domainIndex]->getChargerType();
 }
 
 Power Participant::getACPeakPower(UIntN domainIndex)
 {
+    EsifMutexHelper esifMutexHelper(&m_mutex);
+    esifMutexHelper.lock();
+
     throwIfDomainInvalid(domainIndex);
     return m_domains[domainIndex]->getACPeakPower();
 }
 
 TimeSpan Participant::getACPeakTimeWindow(UIntN domainIndex)
 {
+    EsifMutexHelper esifMutexHelper(&m_mutex);
+    esifMutexHelper.lock();
+
     throwIfDomainInvalid(domainIndex);
     return m_domains[domainIndex]->getACPeakTimeWindow();
 }
 
 Power Participant::getPlatformBatterySteadyState(UIntN domainIndex)
 {
+    EsifMutexHelper esifMutexHelper(&m_mutex);
+    esifMutexHelper.lock();
+
     throwIfDomainInvalid(domainIndex);
     return m_domains[domainIndex]->getPlatformBatterySteadyState();
 }
 
 DomainPriority Participant::getDomainPriority(UIntN domainIndex)
 {
+    EsifMutexHelper esifMutexHelper(&m_mutex);
+    esifMutexHelper.lock();
+
     throwIfDomainInvalid(domainIndex);
     return m_domains[domainIndex]->getDomainPriority();
 }
 
 RfProfileCapabilities Participant::getRfProfileCapabilities(UIntN domainIndex)
 {
+    EsifMutexHelper esifMutexHelper(&m_mutex);
+    esifMutexHelper.lock();
+
     throwIfDomainInvalid(domainIndex);
     return m_domains[domainIndex]->getRfProfileCapabilities();
 }
 
 void Participant::setRfProfileCenterFrequency(UIntN domainIndex, UIntN policyIndex, const Frequency& centerFrequency)
 {
+    EsifMutexHelper esifMutexHelper(&m_mutex);
+    esifMutexHelper.lock();
+
     throwIfDomainInvalid(domainIndex);
     m_domains[domainIndex]->setRfProfileCenterFrequency(policyIndex, centerFrequency);
+    m_dptfManager->getDptfStatus()->participantChanged(m_participantIndex);
 }
 
 RfProfileData Participant::getRfProfileData(UIntN domainIndex)
 {
+    EsifMutexHelper esifMutexHelper(&m_mutex);
+    esifMutexHelper.lock();
+
     throwIfDomainInvalid(domainIndex);
     return m_domains[domainIndex]->getRfProfileData();
 }
 
 TemperatureStatus Participant::getTemperatureStatus(UIntN domainIndex)
 {
+    EsifMutexHelper esifMutexHelper(&m_mutex);
+    esifMutexHelper.lock();
+
     throwIfDomainInvalid(domainIndex);
     return m_domains[domainIndex]->getTemperatureStatus();
 }
 
 TemperatureThresholds Participant::getTemperatureThresholds(UIntN domainIndex)
 {
+    EsifMutexHelper esifMutexHelper(&m_mutex);
+    esifMutexHelper.lock();
+
     throwIfDomainInvalid(domainIndex);
     return m_domains[domainIndex]->getTemperatureThresholds();
 }
 
 void Participant::setTemperatureThresholds(UIntN domainIndex, UIntN policyIndex, const TemperatureThresholds& temperatureThresholds)
 {
+    EsifMutexHelper esifMutexHelper(&m_mutex);
+    esifMutexHelper.lock();
+
     throwIfDomainInvalid(domainIndex);
     m_domains[domainIndex]->setTemperatureThresholds(policyIndex, temperatureThresholds);
+    m_dptfManager->getDptfStatus()->participantChanged(m_participantIndex);
 }
 
 UtilizationStatus Participant::getUtilizationStatus(UIntN domainIndex)
 {
+    EsifMutexHelper esifMutexHelper(&m_mutex);
+    esifMutexHelper.lock();
+
     throwIfDomainInvalid(domainIndex);
     return m_domains[domainIndex]->getUtilizationStatus();
 }
 
 DptfBuffer Participant::getVirtualSensorCalibrationTable(UIntN domainIndex)
 {
+    EsifMutexHelper esifMutexHelper(&m_mutex);
+    esifMutexHelper.lock();
+
     throwIfDomainInvalid(domainIndex);
     return m_domains[domainIndex]->getVirtualSensorCalibrationTable();
 }
 
 DptfBuffer Participant::getVirtualSensorPollingTable(UIntN domainIndex)
 {
+    EsifMutexHelper esifMutexHelper(&m_mutex);
+    esifMutexHelper.lock();
+
     throwIfDomainInvalid(domainIndex);
     return m_domains[domainIndex]->getVirtualSensorPollingTable();
 }
 
 Bool Participant::isVirtualTemperature(UIntN domainIndex)
 {
+    EsifMutexHelper esifMutexHelper(&m_mutex);
+    esifMutexHelper.lock();
+
     throwIfDomainInvalid(domainIndex);
     return m_domains[domainIndex]->isVirtualTemperature();
 }
 
 void Participant::setVirtualTemperature(UIntN domainIndex, const Temperature& temperature)
 {
+    EsifMutexHelper esifMutexHelper(&m_mutex);
+    esifMutexHelper.lock();
+
     throwIfDomainInvalid(domainIndex);
     m_domains[domainIndex]->setVirtualTemperature(temperature);
+    m_dptfManager->getDptfStatus()->participantChanged(m_participantIndex);
 }
 
 std::map<ParticipantSpecificInfoKey::Type, Temperature> Participant::getParticipantSpecificInfo(
     const std::vector<ParticipantSpecificInfoKey::Type>& requestedInfo)
 {
+    EsifMutexHelper esifMutexHelper(&m_mutex);
+    esifMutexHelper.lock();
+
     throwIfRealParticipantIsInvalid();
     return m_theRealParticipant->getParticipantSpecificInfo(m_participantIndex, requestedInfo);
 }
 
 ParticipantProperties Participant::getParticipantProperties(void) const
 {
+    EsifMutexHelper esifMutexHelper(&m_mutex);
+    esifMutexHelper.lock();
+
     throwIfRealParticipantIsInvalid();
     return m_theRealParticipant->getParticipantProperties(m_participantIndex);
 }
 
 DomainPropertiesSet Participant::getDomainPropertiesSet(void) const
 {
+    EsifMutexHelper esifMutexHelper(&m_mutex);
+    esifMutexHelper.lock();
+
     throwIfRealParticipantIsInvalid();
     return m_theRealParticipant->getDomainPropertiesSet(m_participantIndex);
 }
 
 void Participant::setParticipantDeviceTemperatureIndication(const Temperature& temperature)
 {
+    EsifMutexHelper esifMutexHelper(&m_mutex);
+    esifMutexHelper.lock();
+
     throwIfRealParticipantIsInvalid();
     m_theRealParticipant->setParticipantDeviceTemperatureIndication(m_participantIndex, temperature);
+    m_dptfManager->getDptfStatus()->participantChanged(m_participantIndex);
 }
 
 void Participant::setParticipantSpecificInfo(ParticipantSpecificInfoKey::Type tripPoint, const Temperature& tripValue)
 {
+    EsifMutexHelper esifMutexHelper(&m_mutex);
+    esifMutexHelper.lock();
+
     throwIfRealParticipantIsInvalid();
     m_theRealParticipant->setParticipantSpecificInfo(m_participantIndex, tripPoint, tripValue);
+    m_dptfManager->getDptfStatus()->participantChanged(m_participantIndex);
 }
 
 void Participant::throwIfDomainInvalid(UIntN domainIndex) const
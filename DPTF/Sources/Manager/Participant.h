@@ -23,6 +23,7 @@
 #include "ParticipantInterface.h"
 #include "ParticipantServices.h"
 #include "PlatformPowerLimitType.h"
+#include "EsifMutex.h"
 
 class XmlNode;
 
@@ -251,6 +252,12 @@ private:
 
     std::map<UIntN, std::shared_ptr<Domain>> m_domains;
 
+    // Work items for different participants can run at the same time on the work item executor, and policies
+    // running on any of them can call into this participant.  The domain caches, the arbitrators and the real
+    // participant are only accessed while this is locked.  Creating and destroying the participant and its
+    // domains runs exclusively and doesn't lock it.
+    mutable EsifMutex m_mutex;
+
     void throwIfDomainInvalid(UIntN domainIndex) const;
     void throwIfRealParticipantIsInvalid() const;
 };
\ No newline at end of file
@@ -23,8 +23,10 @@
 #include "DptfStatusInterface.h"
 #include "MapOps.h"
 #include "Utility.h"
+#include "EsifMutexHelper.h"
 
-ParticipantManager::ParticipantManager(DptfManagerInterface* dptfManager) : m_dptfManager(dptfManager)
+ParticipantManager::ParticipantManager(DptfManagerInterface* dptfManager) : m_dptfManager(dptfManager),
+    m_cachedDataEpoch(0)
 {
 }
 
@@ -130,14 +132,20 @@ Participant* ParticipantManager::getParticipantPtr(UIntN participantIndex) const
 
 void ParticipantManager::clearAllParticipantCachedData()
 {
-    m_dptfManager->getDptfStatus()->clearCache();
-    for (auto p = m_participants.begin(); p != m_participants.end(); p++)
-    {
-        if (p->second != nullptr)
-        {
-            p->second->clearParticipantCachedData();
-        }
-    }
+    // Every domain includes this epoch in its own cache epoch so this clears the cached data for all of them.
+    // Status documents are versioned by DptfStatus::workItemExecuted, so they are left alone here.
+    EsifMutexHelper esifMutexHelper(&m_cachedDataEpochMutex);
+    esifMutexHelper.lock();
+
+    m_cachedDataEpoch++;
+}
+
+UInt64 ParticipantManager::getCachedDataEpoch(void) const
+{
+    EsifMutexHelper esifMutexHelper(&m_cachedDataEpochMutex);
+    esifMutexHelper.lock();
+
+    return m_cachedDataEpoch;
 }
 
 std::string ParticipantManager::GetStatusAsXml(void)
@@ -19,6 +19,7 @@
 #pragma once
 
 #include "ParticipantManagerInterface.h"
+#include "EsifMutex.h"
 
 class dptf_export ParticipantManager : public ParticipantManagerInterface
 {
@@ -40,6 +41,7 @@ public:
     // This will clear the cached data stored within all participants *within* the framework.  It will not ask the
     // actual participants to clear their caches.
     virtual void clearAllParticipantCachedData() override;
+    virtual UInt64 getCachedDataEpoch(void) const override;
 
     virtual std::string GetStatusAsXml(void) override;
 
@@ -51,4 +53,6 @@ private:
 
     DptfManagerInterface* m_dptfManager;
     std::map<UIntN, std::shared_ptr<Participant>> m_participants;
+    UInt64 m_cachedDataEpoch;
+    mutable EsifMutex m_cachedDataEpochMutex;
 };
\ No newline at end of file
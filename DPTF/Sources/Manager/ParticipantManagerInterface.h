@@ -38,5 +38,8 @@ public:
     virtual Participant* getParticipantPtr(UIntN participantIndex) const = 0;
     virtual void clearAllParticipantCachedData() = 0;
 
+    // Incremented every time the cached data for all participants is cleared
+    virtual UInt64 getCachedDataEpoch(void) const = 0;
+
     virtual std::string GetStatusAsXml(void) = 0;
 };
\ No newline at end of file
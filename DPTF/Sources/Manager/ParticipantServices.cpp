@@ -178,6 +178,13 @@ DptfBuffer ParticipantServices::primitiveExecuteGet(esif_primitive_type primitiv
         m_participantIndex, domainIndex, instance);
 }
 
+void ParticipantServices::primitiveExecuteGetBatch(EsifPrimitiveBatch& batch)
+{
+    throwIfNotWorkItemThread();
+    batch.setParticipantIndex(m_participantIndex);
+    m_esifServices->primitiveExecuteGetBatch(batch);
+}
+
 void ParticipantServices::primitiveExecuteSet(esif_primitive_type primitive, esif_data_type esifDataType,
     void* bufferPtr, UInt32 bufferLength, UInt32 dataLength, UIntN domainIndex, UInt8 instance)
 {
@@ -186,6 +193,11 @@ void ParticipantServices::primitiveExecuteSet(esif_primitive_type primitive, esi
         m_participantIndex, domainIndex, instance);
 }
 
+Bool ParticipantServices::isMessageLoggingEnabled(eLogType messageLevel) const
+{
+    return (messageLevel <= m_esifServices->getCurrentLogVerbosityLevel());
+}
+
 void ParticipantServices::writeMessageFatal(const DptfMessage& message)
 {
     throwIfNotWorkItemThread();
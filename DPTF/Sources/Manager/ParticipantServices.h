@@ -141,6 +141,8 @@ public:
         UIntN domainIndex = Constants::Esif::NoDomain,
         UInt8 instance = Constants::Esif::NoInstance) override final;
 
+    virtual void primitiveExecuteGetBatch(EsifPrimitiveBatch& batch) override final;
+
     virtual void primitiveExecuteSet(
         esif_primitive_type primitive,
         esif_data_type esifDataType,
@@ -150,6 +152,7 @@ public:
         UIntN domainIndex = Constants::Esif::NoDomain,
         UInt8 instance = Constants::Esif::NoInstance) override final;
 
+    virtual Bool isMessageLoggingEnabled(eLogType messageLevel) const override final;
     virtual void writeMessageFatal(const DptfMessage& message) override final;
     virtual void writeMessageError(const DptfMessage& message) override final;
     virtual void writeMessageWarning(const DptfMessage& message) override final;
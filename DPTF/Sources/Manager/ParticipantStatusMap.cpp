@@ -19,6 +19,7 @@
 #include "ParticipantStatusMap.h"
 #include "ParticipantManagerInterface.h"
 #include "XmlNode.h"
+#include "StatusWriter.h"
 
 ParticipantStatusMap::ParticipantStatusMap(ParticipantManagerInterface* participantManager) :
     m_participantManager(participantManager)
@@ -30,14 +31,14 @@ void ParticipantStatusMap::clearCachedData()
     m_participantDomainsList.clear();
 }
 
-std::string ParticipantStatusMap::getGroupsString()
+void ParticipantStatusMap::writeGroups(StatusWriter& writer)
 {
     if (m_participantDomainsList.size() == 0)
     {
         buildParticipantDomainsList();
     }
 
-    auto modules = XmlNode::createWrapperElement("modules");
+    writer.beginElement("modules");
 
     for (UIntN i = 0; i < m_participantDomainsList.size(); i++)
     {
@@ -53,14 +54,10 @@ std::string ParticipantStatusMap::getGroupsString()
                 name << '(' << m_participantDomainsList[i].second << ')';
             }
 
-            auto module = XmlNode::createWrapperElement("module");
-            modules->addChild(module);
-
-            auto participantId = XmlNode::createDataElement("id", StlOverride::to_string(i));
-            module->addChild(participantId);
-
-            auto participantName = XmlNode::createDataElement("name", name.str());
-            module->addChild(participantName);
+            writer.beginElement("module");
+            writer.addDataElement("id", StlOverride::to_string(i));
+            writer.addDataElement("name", name.str());
+            writer.endElement();
         }
         catch (dptf_exception)
         {
@@ -68,9 +65,7 @@ std::string ParticipantStatusMap::getGroupsString()
         }
     }
 
-    std::string s = modules->toString();
-
-    return s;
+    writer.endElement();
 }
 
 void ParticipantStatusMap::buildParticipantDomainsList()
@@ -116,4 +111,18 @@ std::shared_ptr<XmlNode> ParticipantStatusMap::getStatusAsXml(UIntN mappedIndex)
         // Participant not available
         return XmlNode::createRoot();
     }
+}
+
+UIntN ParticipantStatusMap::getParticipantIndex(UIntN mappedIndex)
+{
+    if (m_participantDomainsList.size() == 0)
+    {
+        buildParticipantDomainsList();
+    }
+
+    if (mappedIndex >= m_participantDomainsList.size())
+    {
+        return Constants::Invalid;
+    }
+    return m_participantDomainsList[mappedIndex].first;
 }
\ No newline at end of file
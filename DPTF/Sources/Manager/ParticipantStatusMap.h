@@ -21,6 +21,7 @@
 #include "Dptf.h"
 
 class XmlNode;
+class StatusWriter;
 class ParticipantManagerInterface;
 
 class ParticipantStatusMap
@@ -29,8 +30,9 @@ public:
 
     ParticipantStatusMap(ParticipantManagerInterface* participantManager);
 
-    std::string getGroupsString();
+    void writeGroups(StatusWriter& writer);
     std::shared_ptr<XmlNode> getStatusAsXml(UIntN mappedIndex);
+    UIntN getParticipantIndex(UIntN mappedIndex);
     void clearCachedData();
 
 private:
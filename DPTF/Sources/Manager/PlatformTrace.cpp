@@ -0,0 +1,382 @@
+/******************************************************************************
+** Copyright (c) 2013-2016 Intel Corporation All Rights Reserved
+**
+** Licensed under the Apache License, Version 2.0 (the "License"); you may not
+** use this file except in compliance with the License.
+**
+** You may obtain a copy of the License at
+**     http://www.apache.org/licenses/LICENSE-2.0
+**
+** Unless required by applicable law or agreed to in writing, software
+** distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+** WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+**
+** See the License for the specific language governing permissions and
+** limitations under the License.
+**
+******************************************************************************/
+
+#include "PlatformTrace.h"
+#include "EsifTime.h"
+#include "EsifMutexHelper.h"
+#include "StringConverter.h"
+#include "esif_ccb_memory.h"
+#include <algorithm>
+#include <sstream>
+
+static const std::string PlatformTraceHeader = "DPTF_PLATFORM_TRACE 1";
+static const char HexDigits[] = "0123456789abcdef";
+
+namespace PlatformTraceEntryType
+{
+    std::string toString(PlatformTraceEntryType::Type type)
+    {
+        switch (type)
+        {
+        case ParticipantCreate:
+            return "participant_create";
+        case ParticipantDestroy:
+            return "participant_destroy";
+        case DomainCreate:
+            return "domain_create";
+        case DomainDestroy:
+            return "domain_destroy";
+        case Event:
+            return "event";
+        case Primitive:
+            return "primitive";
+        case Configuration:
+            return "configuration";
+        default:
+            throw dptf_exception("PlatformTraceEntryType::Type is invalid");
+        }
+    }
+
+    PlatformTraceEntryType::Type fromString(const std::string& type)
+    {
+        for (UIntN index = 0; index < Max; index++)
+        {
+            if (toString((PlatformTraceEntryType::Type)index) == type)
+            {
+                return (PlatformTraceEntryType::Type)index;
+            }
+        }
+        throw dptf_exception("Unknown platform trace entry type: " + type);
+    }
+}
+
+// ESIF fills in data_len for strings and results but some callers only set buf_len
+static UInt32 getDataLength(const EsifDataPtr esifData)
+{
+    if ((esifData == nullptr) || (esifData->buf_ptr == nullptr))
+    {
+        return 0;
+    }
+    else if ((esifData->data_len > 0) && (esifData->data_len <= esifData->buf_len))
+    {
+        return esifData->data_len;
+    }
+    else
+    {
+        return esifData->buf_len;
+    }
+}
+
+static UInt8 parseHexDigit(char digit)
+{
+    if ((digit >= '0') && (digit <= '9'))
+    {
+        return (UInt8)(digit - '0');
+    }
+    else if ((digit >= 'a') && (digit <= 'f'))
+    {
+        return (UInt8)(digit - 'a' + 10);
+    }
+    else if ((digit >= 'A') && (digit <= 'F'))
+    {
+        return (UInt8)(digit - 'A' + 10);
+    }
+    throw dptf_exception("Invalid hex digit in platform trace.");
+}
+
+PlatformTraceData::PlatformTraceData(void) : type(ESIF_DATA_VOID)
+{
+}
+
+PlatformTraceData::PlatformTraceData(const EsifDataPtr esifData, UInt32 length) : type(ESIF_DATA_VOID)
+{
+    if (esifData != nullptr)
+    {
+        type = esifData->type;
+        if ((esifData->buf_ptr != nullptr) && (length > 0))
+        {
+            const UInt8* source = static_cast<const UInt8*>(esifData->buf_ptr);
+            bytes.assign(source, source + std::min(length, esifData->buf_len));
+        }
+    }
+}
+
+PlatformTraceEntry::PlatformTraceEntry(void) : time(TimeSpan::createFromMicroseconds(0)),
+    type(PlatformTraceEntryType::Max), participantIndex(Constants::Invalid), domainIndex(Constants::Invalid),
+    primitive(0), instance(Constants::Esif::NoInstance), status(ESIF_OK), state(0)
+{
+}
+
+PlatformTraceWriter::PlatformTraceWriter(const std::string& fileName) : m_fileName(fileName),
+    m_startTime(EsifTime().getTimeStamp())
+{
+    m_file.open(fileName.c_str(), std::ios::out | std::ios::trunc);
+    if (m_file.is_open() == false)
+    {
+        throw dptf_exception("Failed to create platform trace file " + fileName + ".");
+    }
+    m_file << PlatformTraceHeader << std::endl;
+}
+
+PlatformTraceWriter::~PlatformTraceWriter(void)
+{
+    m_file.close();
+}
+
+const std::string& PlatformTraceWriter::getFileName(void) const
+{
+    return m_fileName;
+}
+
+void PlatformTraceWriter::write(PlatformTraceEntry& entry)
+{
+    EsifMutexHelper esifMutexHelper(&m_mutex);
+    esifMutexHelper.lock();
+
+    entry.time = EsifTime().getTimeStamp() - m_startTime;
+
+    std::string line;
+    line.reserve(128);
+    line.append(std::to_string(entry.time.asMicroseconds()));
+    line.push_back(' ');
+    line.append(PlatformTraceEntryType::toString(entry.type));
+    line.push_back(' ');
+    line.append(std::to_string(entry.participantIndex));
+    line.push_back(' ');
+    line.append(std::to_string(entry.domainIndex));
+    line.push_back(' ');
+    line.append(std::to_string(entry.primitive));
+    line.push_back(' ');
+    line.append(std::to_string((UInt32)entry.instance));
+    line.push_back(' ');
+    line.append(std::to_string((Int32)entry.status));
+    line.push_back(' ');
+    line.append(std::to_string(entry.state));
+    line.push_back(' ');
+    line.append(std::to_string(entry.data.size()));
+    for (auto data = entry.data.begin(); data != entry.data.end(); ++data)
+    {
+        line.push_back(' ');
+        line.append(std::to_string((UInt32)data->type));
+        line.push_back(':');
+        for (auto byte = data->bytes.begin(); byte != data->bytes.end(); ++byte)
+        {
+            line.push_back(HexDigits[(*byte >> 4) & 0xF]);
+            line.push_back(HexDigits[*byte & 0xF]);
+        }
+    }
+    line.push_back('\n');
+
+    // Flushed per entry so the trace survives ESIF being stopped without unloading DPTF
+    m_file << line;
+    m_file.flush();
+
+    esifMutexHelper.unlock();
+}
+
+void PlatformTraceWriter::writeParticipantCreate(UIntN participantIndex, const AppParticipantDataPtr participantData,
+    UInt32 state)
+{
+    PlatformTraceEntry entry;
+    entry.type = PlatformTraceEntryType::ParticipantCreate;
+    entry.participantIndex = participantIndex;
+    entry.state = state;
+
+    EsifData structure = {ESIF_DATA_STRUCTURE, participantData, sizeof(AppParticipantData), sizeof(AppParticipantData)};
+    entry.data.push_back(PlatformTraceData(&structure, sizeof(AppParticipantData)));
+
+    EsifDataPtr members[] = {&participantData->fDriverType, &participantData->fDeviceType, &participantData->fName,
+        &participantData->fDesc, &participantData->fDriverName, &participantData->fDeviceName,
+        &participantData->fDevicePath, &participantData->fAcpiDevice, &participantData->fAcpiScope,
+        &participantData->fAcpiUID};
+    for (UIntN index = 0; index < sizeof(members) / sizeof(members[0]); index++)
+    {
+        entry.data.push_back(PlatformTraceData(members[index], getDataLength(members[index])));
+    }
+
+    write(entry);
+}
+
+void PlatformTraceWriter::writeDomainCreate(UIntN participantIndex, UIntN domainIndex,
+    const AppDomainDataPtr domainData, UInt32 state)
+{
+    PlatformTraceEntry entry;
+    entry.type = PlatformTraceEntryType::DomainCreate;
+    entry.participantIndex = participantIndex;
+    entry.domainIndex = domainIndex;
+    entry.state = state;
+
+    EsifData structure = {ESIF_DATA_STRUCTURE, domainData, sizeof(AppDomainData), sizeof(AppDomainData)};
+    entry.data.push_back(PlatformTraceData(&structure, sizeof(AppDomainData)));
+
+    EsifDataPtr members[] = {&domainData->fName, &domainData->fDescription, &domainData->fGuid};
+    for (UIntN index = 0; index < sizeof(members) / sizeof(members[0]); index++)
+    {
+        entry.data.push_back(PlatformTraceData(members[index], getDataLength(members[index])));
+    }
+
+    write(entry);
+}
+
+void PlatformTraceWriter::writeDestroy(PlatformTraceEntryType::Type type, UIntN participantIndex, UIntN domainIndex)
+{
+    PlatformTraceEntry entry;
+    entry.type = type;
+    entry.participantIndex = participantIndex;
+    entry.domainIndex = domainIndex;
+    write(entry);
+}
+
+void PlatformTraceWriter::writeEvent(UIntN participantIndex, UIntN domainIndex, const EsifDataPtr eventGuid,
+    const EsifDataPtr eventData)
+{
+    PlatformTraceEntry entry;
+    entry.type = PlatformTraceEntryType::Event;
+    entry.participantIndex = participantIndex;
+    entry.domainIndex = domainIndex;
+
+    // The state records whether ESIF passed event data at all
+    entry.state = (eventData != nullptr) ? 1 : 0;
+    entry.data.push_back(PlatformTraceData(eventGuid, getDataLength(eventGuid)));
+    entry.data.push_back(PlatformTraceData(eventData, getDataLength(eventData)));
+    write(entry);
+}
+
+PlatformTraceReader::PlatformTraceReader(const std::string& fileName) : m_lineNumber(0)
+{
+    m_file.open(fileName.c_str(), std::ios::in);
+    if (m_file.is_open() == false)
+    {
+        throw dptf_exception("Failed to open platform trace file " + fileName + ".");
+    }
+
+    std::string header;
+    std::getline(m_file, header);
+    m_lineNumber++;
+    if (StringConverter::trimWhitespace(header) != PlatformTraceHeader)
+    {
+        throw dptf_exception(fileName + " is not a platform trace.");
+    }
+}
+
+Bool PlatformTraceReader::read(PlatformTraceEntry& entry)
+{
+    std::string line;
+    while (std::getline(m_file, line))
+    {
+        m_lineNumber++;
+        if (line.empty() || (line[0] == '#'))
+        {
+            continue;
+        }
+
+        std::istringstream fields(line);
+        Int64 time = 0;
+        std::string type;
+        UInt32 instance = 0;
+        Int32 status = 0;
+        UInt64 dataCount = 0;
+        fields >> time >> type >> entry.participantIndex >> entry.domainIndex >> entry.primitive >> instance >>
+            status >> entry.state >> dataCount;
+        if (fields.fail())
+        {
+            throw dptf_exception("Platform trace line " + std::to_string(m_lineNumber) + " is not valid.");
+        }
+
+        entry.time = TimeSpan::createFromMicroseconds(time);
+        entry.type = PlatformTraceEntryType::fromString(type);
+        entry.instance = (UInt8)instance;
+        entry.status = (eEsifError)status;
+        entry.data.clear();
+
+        for (UInt64 index = 0; index < dataCount; index++)
+        {
+            std::string field;
+            fields >> field;
+            auto separator = field.find(':');
+            if (fields.fail() || (separator == std::string::npos) || (((field.size() - separator - 1) % 2) != 0))
+            {
+                throw dptf_exception("Platform trace line " + std::to_string(m_lineNumber) + " has invalid data.");
+            }
+
+            PlatformTraceData data;
+            data.type = (esif_data_type)StringConverter::toUInt32(field.substr(0, separator));
+            data.bytes.reserve((field.size() - separator - 1) / 2);
+            for (auto digit = separator + 1; digit < field.size(); digit += 2)
+            {
+                data.bytes.push_back((UInt8)((parseHexDigit(field[digit]) << 4) | parseHexDigit(field[digit + 1])));
+            }
+            entry.data.push_back(data);
+        }
+
+        return true;
+    }
+
+    return false;
+}
+
+EsifData createEsifData(PlatformTraceData& data)
+{
+    EsifData esifData;
+    esifData.type = data.type;
+    esifData.buf_ptr = data.bytes.empty() ? nullptr : &data.bytes[0];
+    esifData.buf_len = (UInt32)data.bytes.size();
+    esifData.data_len = (UInt32)data.bytes.size();
+    return esifData;
+}
+
+AppParticipantData createAppParticipantData(PlatformTraceEntry& entry)
+{
+    if ((entry.data.size() != 11) || (entry.data[0].bytes.size() != sizeof(AppParticipantData)))
+    {
+        throw dptf_exception("Platform trace participant data does not match this build.");
+    }
+
+    AppParticipantData participantData;
+    esif_ccb_memcpy(&participantData, &entry.data[0].bytes[0], sizeof(AppParticipantData));
+
+    EsifDataPtr members[] = {&participantData.fDriverType, &participantData.fDeviceType, &participantData.fName,
+        &participantData.fDesc, &participantData.fDriverName, &participantData.fDeviceName,
+        &participantData.fDevicePath, &participantData.fAcpiDevice, &participantData.fAcpiScope,
+        &participantData.fAcpiUID};
+    for (UIntN index = 0; index < sizeof(members) / sizeof(members[0]); index++)
+    {
+        *members[index] = createEsifData(entry.data[index + 1]);
+    }
+
+    return participantData;
+}
+
+AppDomainData createAppDomainData(PlatformTraceEntry& entry)
+{
+    if ((entry.data.size() != 4) || (entry.data[0].bytes.size() != sizeof(AppDomainData)))
+    {
+        throw dptf_exception("Platform trace domain data does not match this build.");
+    }
+
+    AppDomainData domainData;
+    esif_ccb_memcpy(&domainData, &entry.data[0].bytes[0], sizeof(AppDomainData));
+
+    EsifDataPtr members[] = {&domainData.fName, &domainData.fDescription, &domainData.fGuid};
+    for (UIntN index = 0; index < sizeof(members) / sizeof(members[0]); index++)
+    {
+        *members[index] = createEsifData(entry.data[index + 1]);
+    }
+
+    return domainData;
+}
\ No newline at end of file
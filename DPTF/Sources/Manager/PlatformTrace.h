@@ -0,0 +1,133 @@
+/******************************************************************************
+** Copyright (c) 2013-2016 Intel Corporation All Rights Reserved
+**
+** Licensed under the Apache License, Version 2.0 (the "License"); you may not
+** use this file except in compliance with the License.
+**
+** You may obtain a copy of the License at
+**     http://www.apache.org/licenses/LICENSE-2.0
+**
+** Unless required by applicable law or agreed to in writing, software
+** distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+** WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+**
+** See the License for the specific language governing permissions and
+** limitations under the License.
+**
+******************************************************************************/
+
+#pragma once
+
+#include "Dptf.h"
+#include "esif_sdk_iface_app.h"
+#include "esif_ccb_rc.h"
+#include "EsifMutex.h"
+#include <fstream>
+
+//
+// A platform trace is a text file holding everything DPTF received from ESIF while it was recorded:  participant
+// and domain arrival and removal, events, primitive results and configuration values.  It is written by the
+// manager when the "PlatformTraceFile" configuration value is set and is replayed by the DPTF simulator.
+//
+// Each line after the header is one entry:
+//   <time us> <type> <participant> <domain> <primitive> <instance> <status> <state> <count> [<esif type>:<hex>]...
+// Times are relative to the start of the recording.  Participant and domain metadata is stored as the raw
+// AppParticipantData/AppDomainData structure followed by the contents of each EsifData member it points to.
+//
+
+namespace PlatformTraceEntryType
+{
+    enum Type
+    {
+        ParticipantCreate,
+        ParticipantDestroy,
+        DomainCreate,
+        DomainDestroy,
+        Event,
+        Primitive,
+        Configuration,
+        Max
+    };
+
+    std::string toString(PlatformTraceEntryType::Type type);
+    PlatformTraceEntryType::Type fromString(const std::string& type);
+}
+
+struct PlatformTraceData
+{
+    PlatformTraceData(void);
+    PlatformTraceData(const EsifDataPtr esifData, UInt32 length);
+
+    esif_data_type type;
+    std::vector<UInt8> bytes;
+};
+
+struct PlatformTraceEntry
+{
+    PlatformTraceEntry(void);
+
+    TimeSpan time;
+    PlatformTraceEntryType::Type type;
+    UIntN participantIndex;
+    UIntN domainIndex;
+    UInt32 primitive;
+    UInt8 instance;
+    eEsifError status;
+    UInt32 state;
+    std::vector<PlatformTraceData> data;
+};
+
+class PlatformTraceWriter final
+{
+public:
+
+    // Throws if the file cannot be created
+    PlatformTraceWriter(const std::string& fileName);
+    ~PlatformTraceWriter(void);
+
+    const std::string& getFileName(void) const;
+
+    // Can be called from any thread.  The entry time is filled in here so entries are always in time order.
+    void write(PlatformTraceEntry& entry);
+
+    // Helpers for the calls DPTF receives from ESIF
+    void writeParticipantCreate(UIntN participantIndex, const AppParticipantDataPtr participantData, UInt32 state);
+    void writeDomainCreate(UIntN participantIndex, UIntN domainIndex, const AppDomainDataPtr domainData,
+        UInt32 state);
+    void writeDestroy(PlatformTraceEntryType::Type type, UIntN participantIndex, UIntN domainIndex);
+    void writeEvent(UIntN participantIndex, UIntN domainIndex, const EsifDataPtr eventGuid,
+        const EsifDataPtr eventData);
+
+private:
+
+    // hide the copy constructor and assignment operator.
+    PlatformTraceWriter(const PlatformTraceWriter& rhs);
+    PlatformTraceWriter& operator=(const PlatformTraceWriter& rhs);
+
+    std::string m_fileName;
+    std::ofstream m_file;
+    TimeSpan m_startTime;
+    EsifMutex m_mutex;
+};
+
+class PlatformTraceReader final
+{
+public:
+
+    // Throws if the file cannot be opened or is not a platform trace
+    PlatformTraceReader(const std::string& fileName);
+
+    // Returns false at the end of the trace.  Throws if an entry cannot be parsed.
+    Bool read(PlatformTraceEntry& entry);
+
+private:
+
+    std::ifstream m_file;
+    UInt64 m_lineNumber;
+};
+
+// Rebuild what ESIF passed to DPTF from a trace entry.  The EsifData buffers point into the entry, so it must
+// outlive the returned structure.
+EsifData createEsifData(PlatformTraceData& data);
+AppParticipantData createAppParticipantData(PlatformTraceEntry& entry);
+AppDomainData createAppDomainData(PlatformTraceEntry& entry);
\ No newline at end of file
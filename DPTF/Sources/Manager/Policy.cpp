@@ -48,6 +48,7 @@
 #include "PolicyServicesDomainPlatformPowerStatus.h"
 #include "PolicyServicesPlatformState.h"
 #include "esif_ccb_string.h"
+#include "EsifMutexHelper.h"
 
 Policy::Policy(DptfManagerInterface* dptfManager) : m_dptfManager(dptfManager), m_theRealPolicy(nullptr),
 m_theRealPolicyCreated(false), m_policyIndex(Constants::Invalid), m_isPolicyLoggingEnabled(false), m_esifLibrary(nullptr),
@@ -79,6 +80,22 @@ void Policy::createPolicy(const std::string& policyFileName, UIntN newPolicyInde
 
     // Call the function that is exposed in the .dll/.so and ask it to create an instance of the class
     m_theRealPolicy = m_createPolicyInstanceFuncPtr();
+    createPolicyInstance(newPolicyIndex, supportedPolicyList);
+}
+
+void Policy::createPolicy(const std::string& policyName, PolicyInterface* policyInstance,
+    DestroyPolicyInstanceFuncPtr destroyPolicyInstanceFuncPtr, UIntN newPolicyIndex,
+    const SupportedPolicyList& supportedPolicyList)
+{
+    m_policyFileName = policyName;
+    m_policyIndex = newPolicyIndex;
+    m_theRealPolicy = policyInstance;
+    m_destroyPolicyInstanceFuncPtr = destroyPolicyInstanceFuncPtr;
+    createPolicyInstance(newPolicyIndex, supportedPolicyList);
+}
+
+void Policy::createPolicyInstance(UIntN newPolicyIndex, const SupportedPolicyList& supportedPolicyList)
+{
     if (m_theRealPolicy == nullptr)
     {
         std::stringstream message;
@@ -185,8 +202,16 @@ std::string Policy::getStatusAsXml(void) const
     return m_theRealPolicy->getStatusAsXml();
 }
 
+void Policy::writeStatus(StatusWriter& writer) const
+{
+    m_theRealPolicy->writeStatus(writer);
+}
+
 void Policy::executeConnectedStandbyEntry(void)
 {
+    EsifMutexHelper esifMutexHelper(&m_executionMutex);
+    esifMutexHelper.lock();
+
     if (isEventRegistered(PolicyEvent::DptfConnectedStandbyEntry))
     {
         m_theRealPolicy->connectedStandbyEntry();
@@ -195,6 +220,9 @@ void Policy::executeConnectedStandbyEntry(void)
 
 void Policy::executeConnectedStandbyExit(void)
 {
+    EsifMutexHelper esifMutexHelper(&m_executionMutex);
+    esifMutexHelper.lock();
+
     if (isEventRegistered(PolicyEvent::DptfConnectedStandbyExit))
     {
         m_theRealPolicy->connectedStandbyExit();
@@ -203,6 +231,9 @@ void Policy::executeConnectedStandbyExit(void)
 
 void Policy::executeSuspend(void)
 {
+    EsifMutexHelper esifMutexHelper(&m_executionMutex);
+    esifMutexHelper.lock();
+
     if (isEventRegistered(PolicyEvent::DptfSuspend))
     {
         m_theRealPolicy->suspend();
@@ -211,6 +242,9 @@ void Policy::executeSuspend(void)
 
 void Policy::executeResume(void)
 {
+    EsifMutexHelper esifMutexHelper(&m_executionMutex);
+    esifMutexHelper.lock();
+
     if (isEventRegistered(PolicyEvent::DptfResume))
     {
         m_theRealPolicy->resume();
@@ -219,6 +253,9 @@ void Policy::executeResume(void)
 
 void Policy::executeDomainConfigTdpCapabilityChanged(UIntN participantIndex)
 {
+    EsifMutexHelper esifMutexHelper(&m_executionMutex);
+    esifMutexHelper.lock();
+
     if (isEventRegistered(PolicyEvent::DomainConfigTdpCapabilityChanged))
     {
         m_theRealPolicy->domainConfigTdpCapabilityChanged(participantIndex);
@@ -227,6 +264,9 @@ void Policy::executeDomainConfigTdpCapabilityChanged(UIntN participantIndex)
 
 void Policy::executeDomainCoreControlCapabilityChanged(UIntN participantIndex)
 {
+    EsifMutexHelper esifMutexHelper(&m_executionMutex);
+    esifMutexHelper.lock();
+
     if (isEventRegistered(PolicyEvent::DomainCoreControlCapabilityChanged))
     {
         m_theRealPolicy->domainCoreControlCapabilityChanged(participantIndex);
@@ -235,6 +275,9 @@ void Policy::executeDomainCoreControlCapabilityChanged(UIntN participantIndex)
 
 void Policy::executeDomainDisplayControlCapabilityChanged(UIntN participantIndex)
 {
+    EsifMutexHelper esifMutexHelper(&m_executionMutex);
+    esifMutexHelper.lock();
+
     if (isEventRegistered(PolicyEvent::DomainDisplayControlCapabilityChanged))
     {
         m_theRealPolicy->domainDisplayControlCapabilityChanged(participantIndex);
@@ -243,6 +286,9 @@ void Policy::executeDomainDisplayControlCapabilityChanged(UIntN participantIndex
 
 void Policy::executeDomainDisplayStatusChanged(UIntN participantIndex)
 {
+    EsifMutexHelper esifMutexHelper(&m_executionMutex);
+    esifMutexHelper.lock();
+
     if (isEventRegistered(PolicyEvent::DomainDisplayStatusChanged))
     {
         m_theRealPolicy->domainDisplayStatusChanged(participantIndex);
@@ -251,6 +297,9 @@ void Policy::executeDomainDisplayStatusChanged(UIntN participantIndex)
 
 void Policy::executeDomainPerformanceControlCapabilityChanged(UIntN participantIndex)
 {
+    EsifMutexHelper esifMutexHelper(&m_executionMutex);
+    esifMutexHelper.lock();
+
     if (isEventRegistered(PolicyEvent::DomainPerformanceControlCapabilityChanged))
     {
         m_theRealPolicy->domainPerformanceControlCapabilityChanged(participantIndex);
@@ -259,6 +308,9 @@ void Policy::executeDomainPerformanceControlCapabilityChanged(UIntN participantI
 
 void Policy::executeDomainPerformanceControlsChanged(UIntN participantIndex)
 {
+    EsifMutexHelper esifMutexHelper(&m_executionMutex);
+    esifMutexHelper.lock();
+
     if (isEventRegistered(PolicyEvent::DomainPerformanceControlsChanged))
     {
         m_theRealPolicy->domainPerformanceControlsChanged(participantIndex);
@@ -267,6 +319,9 @@ void Policy::executeDomainPerformanceControlsChanged(UIntN participantIndex)
 
 void Policy::executeDomainPowerControlCapabilityChanged(UIntN participantIndex)
 {
+    EsifMutexHelper esifMutexHelper(&m_executionMutex);
+    esifMutexHelper.lock();
+
     if (isEventRegistered(PolicyEvent::DomainPowerControlCapabilityChanged))
     {
         m_theRealPolicy->domainPowerControlCapabilityChanged(participantIndex);
@@ -275,6 +330,9 @@ void Policy::executeDomainPowerControlCapabilityChanged(UIntN participantIndex)
 
 void Policy::executeDomainPriorityChanged(UIntN participantIndex)
 {
+    EsifMutexHelper esifMutexHelper(&m_executionMutex);
+    esifMutexHelper.lock();
+
     if (isEventRegistered(PolicyEvent::DomainPriorityChanged))
     {
         m_theRealPolicy->domainPriorityChanged(participantIndex);
@@ -284,6 +342,9 @@ void Policy::executeDomainPriorityChanged(UIntN participantIndex)
 void Policy::executeDomainRadioConnectionStatusChanged(UIntN participantIndex,
     RadioConnectionStatus::Type radioConnectionStatus)
 {
+    EsifMutexHelper esifMutexHelper(&m_executionMutex);
+    esifMutexHelper.lock();
+
     if (isEventRegistered(PolicyEvent::DomainRadioConnectionStatusChanged))
     {
         m_theRealPolicy->domainRadioConnectionStatusChanged(participantIndex, radioConnectionStatus);
@@ -292,6 +353,9 @@ void Policy::executeDomainRadioConnectionStatusChanged(UIntN participantIndex,
 
 void Policy::executeDomainRfProfileChanged(UIntN participantIndex)
 {
+    EsifMutexHelper esifMutexHelper(&m_executionMutex);
+    esifMutexHelper.lock();
+
     if (isEventRegistered(PolicyEvent::DomainRfProfileChanged))
     {
         m_theRealPolicy->domainRfProfileChanged(participantIndex);
@@ -300,6 +364,9 @@ void Policy::executeDomainRfProfileChanged(UIntN participantIndex)
 
 void Policy::executeDomainTemperatureThresholdCrossed(UIntN participantIndex)
 {
+    EsifMutexHelper esifMutexHelper(&m_executionMutex);
+    esifMutexHelper.lock();
+
     if (isEventRegistered(PolicyEvent::DomainTemperatureThresholdCrossed))
     {
         m_theRealPolicy->domainTemperatureThresholdCrossed(participantIndex);
@@ -308,6 +375,9 @@ void Policy::executeDomainTemperatureThresholdCrossed(UIntN participantIndex)
 
 void Policy::executeDomainVirtualSensorCalibrationTableChanged(UIntN participantIndex)
 {
+    EsifMutexHelper esifMutexHelper(&m_executionMutex);
+    esifMutexHelper.lock();
+
     if (isEventRegistered(PolicyEvent::DomainVirtualSensorCalibrationTableChanged))
     {
         m_theRealPolicy->domainVirtualSensorCalibrationTableChanged(participantIndex);
@@ -316,6 +386,9 @@ void Policy::executeDomainVirtualSensorCalibrationTableChanged(UIntN participant
 
 void Policy::executeDomainVirtualSensorPollingTableChanged(UIntN participantIndex)
 {
+    EsifMutexHelper esifMutexHelper(&m_executionMutex);
+    esifMutexHelper.lock();
+
     if (isEventRegistered(PolicyEvent::DomainVirtualSensorPollingTableChanged))
     {
         m_theRealPolicy->domainVirtualSensorPollingTableChanged(participantIndex);
@@ -324,6 +397,9 @@ void Policy::executeDomainVirtualSensorPollingTableChanged(UIntN participantInde
 
 void Policy::executeDomainVirtualSensorRecalcChanged(UIntN participantIndex)
 {
+    EsifMutexHelper esifMutexHelper(&m_executionMutex);
+    esifMutexHelper.lock();
+
     if (isEventRegistered(PolicyEvent::DomainVirtualSensorRecalcChanged))
     {
         m_theRealPolicy->domainVirtualSensorRecalcChanged(participantIndex);
@@ -332,6 +408,9 @@ void Policy::executeDomainVirtualSensorRecalcChanged(UIntN participantIndex)
 
 void Policy::executeParticipantSpecificInfoChanged(UIntN participantIndex)
 {
+    EsifMutexHelper esifMutexHelper(&m_executionMutex);
+    esifMutexHelper.lock();
+
     if (isEventRegistered(PolicyEvent::ParticipantSpecificInfoChanged))
     {
         m_theRealPolicy->participantSpecificInfoChanged(participantIndex);
@@ -340,6 +419,9 @@ void Policy::executeParticipantSpecificInfoChanged(UIntN participantIndex)
 
 void Policy::executePolicyActiveRelationshipTableChanged(void)
 {
+    EsifMutexHelper esifMutexHelper(&m_executionMutex);
+    esifMutexHelper.lock();
+
     if (isEventRegistered(PolicyEvent::PolicyActiveRelationshipTableChanged))
     {
         m_theRealPolicy->activeRelationshipTableChanged();
@@ -348,6 +430,9 @@ void Policy::executePolicyActiveRelationshipTableChanged(void)
 
 void Policy::executePolicyCoolingModePolicyChanged(CoolingMode::Type coolingMode)
 {
+    EsifMutexHelper esifMutexHelper(&m_executionMutex);
+    esifMutexHelper.lock();
+
     if (isEventRegistered(PolicyEvent::PolicyCoolingModePolicyChanged))
     {
         m_theRealPolicy->coolingModePolicyChanged(coolingMode);
@@ -356,6 +441,9 @@ void Policy::executePolicyCoolingModePolicyChanged(CoolingMode::Type coolingMode
 
 void Policy::executePolicyForegroundApplicationChanged(const std::string& foregroundApplicationName)
 {
+    EsifMutexHelper esifMutexHelper(&m_executionMutex);
+    esifMutexHelper.lock();
+
     if (isEventRegistered(PolicyEvent::PolicyForegroundApplicationChanged))
     {
         m_theRealPolicy->foregroundApplicationChanged(foregroundApplicationName);
@@ -364,11 +452,17 @@ void Policy::executePolicyForegroundApplicationChanged(const std::string& foregr
 
 void Policy::executePolicyInitiatedCallback(UInt64 policyDefinedEventCode, UInt64 param1, void* param2)
 {
+    EsifMutexHelper esifMutexHelper(&m_executionMutex);
+    esifMutexHelper.lock();
+
     m_theRealPolicy->policyInitiatedCallback(policyDefinedEventCode, param1, param2);
 }
 
 void Policy::executePolicyOperatingSystemConfigTdpLevelChanged(UIntN configTdpLevel)
 {
+    EsifMutexHelper esifMutexHelper(&m_executionMutex);
+    esifMutexHelper.lock();
+
     if (isEventRegistered(PolicyEvent::PolicyOperatingSystemConfigTdpLevelChanged))
     {
         m_theRealPolicy->operatingSystemConfigTdpLevelChanged(configTdpLevel);
@@ -377,6 +471,9 @@ void Policy::executePolicyOperatingSystemConfigTdpLevelChanged(UIntN configTdpLe
 
 void Policy::executePolicyOperatingSystemPowerSourceChanged(OsPowerSource::Type powerSource)
 {
+    EsifMutexHelper esifMutexHelper(&m_executionMutex);
+    esifMutexHelper.lock();
+
     if (isEventRegistered(PolicyEvent::PolicyOperatingSystemPowerSourceChanged))
     {
         m_theRealPolicy->operatingSystemPowerSourceChanged(powerSource);
@@ -385,6 +482,9 @@ void Policy::executePolicyOperatingSystemPowerSourceChanged(OsPowerSource::Type
 
 void Policy::executePolicyOperatingSystemLidStateChanged(OsLidState::Type lidState)
 {
+    EsifMutexHelper esifMutexHelper(&m_executionMutex);
+    esifMutexHelper.lock();
+
     if (isEventRegistered(PolicyEvent::PolicyOperatingSystemLidStateChanged))
     {
         m_theRealPolicy->operatingSystemLidStateChanged(lidState);
@@ -393,6 +493,9 @@ void Policy::executePolicyOperatingSystemLidStateChanged(OsLidState::Type lidSta
 
 void Policy::executePolicyOperatingSystemBatteryPercentageChanged(UIntN batteryPercentage)
 {
+    EsifMutexHelper esifMutexHelper(&m_executionMutex);
+    esifMutexHelper.lock();
+
     if (isEventRegistered(PolicyEvent::PolicyOperatingSystemBatteryPercentageChanged))
     {
         m_theRealPolicy->operatingSystemBatteryPercentageChanged(batteryPercentage);
@@ -401,6 +504,9 @@ void Policy::executePolicyOperatingSystemBatteryPercentageChanged(UIntN batteryP
 
 void Policy::executePolicyOperatingSystemPlatformTypeChanged(OsPlatformType::Type platformType)
 {
+    EsifMutexHelper esifMutexHelper(&m_executionMutex);
+    esifMutexHelper.lock();
+
     if (isEventRegistered(PolicyEvent::PolicyOperatingSystemPlatformTypeChanged))
     {
         m_theRealPolicy->operatingSystemPlatformTypeChanged(platformType);
@@ -409,6 +515,9 @@ void Policy::executePolicyOperatingSystemPlatformTypeChanged(OsPlatformType::Typ
 
 void Policy::executePolicyOperatingSystemDockModeChanged(OsDockMode::Type dockMode)
 {
+    EsifMutexHelper esifMutexHelper(&m_executionMutex);
+    esifMutexHelper.lock();
+
     if (isEventRegistered(PolicyEvent::PolicyOperatingSystemDockModeChanged))
     {
         m_theRealPolicy->operatingSystemDockModeChanged(dockMode);
@@ -417,6 +526,9 @@ void Policy::executePolicyOperatingSystemDockModeChanged(OsDockMode::Type dockMo
 
 void Policy::executePolicyOperatingSystemEmergencyCallModeStateChanged(OnOffToggle::Type emergencyCallModeState)
 {
+    EsifMutexHelper esifMutexHelper(&m_executionMutex);
+    esifMutexHelper.lock();
+
     if (isEventRegistered(PolicyEvent::PolicyOperatingSystemMobileNotification))
     {
         m_theRealPolicy->operatingSystemEmergencyCallModeStateChanged(emergencyCallModeState);
@@ -425,6 +537,9 @@ void Policy::executePolicyOperatingSystemEmergencyCallModeStateChanged(OnOffTogg
 
 void Policy::executePolicyOperatingSystemMobileNotification(OsMobileNotificationType::Type notificationType, UIntN value)
 {
+    EsifMutexHelper esifMutexHelper(&m_executionMutex);
+    esifMutexHelper.lock();
+
     if (isEventRegistered(PolicyEvent::PolicyOperatingSystemMobileNotification))
     {
         m_theRealPolicy->operatingSystemMobileNotification(notificationType, value);
@@ -433,6 +548,9 @@ void Policy::executePolicyOperatingSystemMobileNotification(OsMobileNotification
 
 void Policy::executePolicyPassiveTableChanged(void)
 {
+    EsifMutexHelper esifMutexHelper(&m_executionMutex);
+    esifMutexHelper.lock();
+
     if (isEventRegistered(PolicyEvent::PolicyPassiveTableChanged))
     {
         m_theRealPolicy->passiveTableChanged();
@@ -441,6 +559,9 @@ void Policy::executePolicyPassiveTableChanged(void)
 
 void Policy::executePolicySensorOrientationChanged(SensorOrientation::Type sensorOrientation)
 {
+    EsifMutexHelper esifMutexHelper(&m_executionMutex);
+    esifMutexHelper.lock();
+
     if (isEventRegistered(PolicyEvent::PolicySensorOrientationChanged))
     {
         m_theRealPolicy->sensorOrientationChanged(sensorOrientation);
@@ -449,6 +570,9 @@ void Policy::executePolicySensorOrientationChanged(SensorOrientation::Type senso
 
 void Policy::executePolicySensorMotionChanged(OnOffToggle::Type sensorMotion)
 {
+    EsifMutexHelper esifMutexHelper(&m_executionMutex);
+    esifMutexHelper.lock();
+
     if (isEventRegistered(PolicyEvent::PolicySensorMotionChanged))
     {
         m_theRealPolicy->sensorMotionChanged(sensorMotion);
@@ -457,6 +581,9 @@ void Policy::executePolicySensorMotionChanged(OnOffToggle::Type sensorMotion)
 
 void Policy::executePolicySensorSpatialOrientationChanged(SensorSpatialOrientation::Type sensorSpatialOrientation)
 {
+    EsifMutexHelper esifMutexHelper(&m_executionMutex);
+    esifMutexHelper.lock();
+
     if (isEventRegistered(PolicyEvent::PolicySensorSpatialOrientationChanged))
     {
         m_theRealPolicy->sensorSpatialOrientationChanged(sensorSpatialOrientation);
@@ -465,6 +592,9 @@ void Policy::executePolicySensorSpatialOrientationChanged(SensorSpatialOrientati
 
 void Policy::executePolicyThermalRelationshipTableChanged(void)
 {
+    EsifMutexHelper esifMutexHelper(&m_executionMutex);
+    esifMutexHelper.lock();
+
     if (isEventRegistered(PolicyEvent::PolicyThermalRelationshipTableChanged))
     {
         m_theRealPolicy->thermalRelationshipTableChanged();
@@ -473,6 +603,9 @@ void Policy::executePolicyThermalRelationshipTableChanged(void)
 
 void Policy::executePolicyAdaptivePerformanceConditionsTableChanged(void)
 {
+    EsifMutexHelper esifMutexHelper(&m_executionMutex);
+    esifMutexHelper.lock();
+
     if (isEventRegistered(PolicyEvent::PolicyAdaptivePerformanceConditionsTableChanged))
     {
         m_theRealPolicy->adaptivePerformanceConditionsTableChanged();
@@ -481,6 +614,9 @@ void Policy::executePolicyAdaptivePerformanceConditionsTableChanged(void)
 
 void Policy::executePolicyAdaptivePerformanceParticipantConditionTableChanged(void)
 {
+    EsifMutexHelper esifMutexHelper(&m_executionMutex);
+    esifMutexHelper.lock();
+
     if (isEventRegistered(PolicyEvent::PolicyAdaptivePerformanceParticipantConditionTableChanged))
     {
         m_theRealPolicy->adaptivePerformanceParticipantConditionTableChanged();
@@ -489,6 +625,9 @@ void Policy::executePolicyAdaptivePerformanceParticipantConditionTableChanged(vo
 
 void Policy::executePolicyAdaptivePerformanceActionsTableChanged(void)
 {
+    EsifMutexHelper esifMutexHelper(&m_executionMutex);
+    esifMutexHelper.lock();
+
     if (isEventRegistered(PolicyEvent::PolicyAdaptivePerformanceActionsTableChanged))
     {
         m_theRealPolicy->adaptivePerformanceActionsTableChanged();
@@ -497,6 +636,9 @@ void Policy::executePolicyAdaptivePerformanceActionsTableChanged(void)
 
 void Policy::executePolicyOemVariablesChanged(void)
 {
+    EsifMutexHelper esifMutexHelper(&m_executionMutex);
+    esifMutexHelper.lock();
+
     if (isEventRegistered(PolicyEvent::PolicyOemVariablesChanged))
     {
         m_theRealPolicy->oemVariablesChanged();
@@ -505,6 +647,9 @@ void Policy::executePolicyOemVariablesChanged(void)
 
 void Policy::executePolicyPowerBossConditionsTableChanged(void)
 {
+    EsifMutexHelper esifMutexHelper(&m_executionMutex);
+    esifMutexHelper.lock();
+
     if (isEventRegistered(PolicyEvent::PolicyPowerBossConditionsTableChanged))
     {
         m_theRealPolicy->powerBossConditionsTableChanged();
@@ -513,6 +658,9 @@ void Policy::executePolicyPowerBossConditionsTableChanged(void)
 
 void Policy::executePolicyPowerBossActionsTableChanged(void)
 {
+    EsifMutexHelper esifMutexHelper(&m_executionMutex);
+    esifMutexHelper.lock();
+
     if (isEventRegistered(PolicyEvent::PolicyPowerBossActionsTableChanged))
     {
         m_theRealPolicy->powerBossActionsTableChanged();
@@ -521,6 +669,9 @@ void Policy::executePolicyPowerBossActionsTableChanged(void)
 
 void Policy::executePolicyPowerBossMathTableChanged(void)
 {
+    EsifMutexHelper esifMutexHelper(&m_executionMutex);
+    esifMutexHelper.lock();
+
     if (isEventRegistered(PolicyEvent::PolicyPowerBossMathTableChanged))
     {
         m_theRealPolicy->powerBossMathTableChanged();
@@ -529,6 +680,9 @@ void Policy::executePolicyPowerBossMathTableChanged(void)
 
 void Policy::executePolicyOperatingSystemPowerSchemePersonalityChanged(OsPowerSchemePersonality::Type powerSchemePersonality)
 {
+    EsifMutexHelper esifMutexHelper(&m_executionMutex);
+    esifMutexHelper.lock();
+
     if (isEventRegistered(PolicyEvent::PolicyOperatingSystemPowerSchemePersonalityChanged))
     {
         m_theRealPolicy->operatingSystemPowerSchemePersonalityChanged(powerSchemePersonality);
@@ -537,17 +691,26 @@ void Policy::executePolicyOperatingSystemPowerSchemePersonalityChanged(OsPowerSc
 
 void Policy::executePolicyActivityLoggingEnabled(void)
 {
+    EsifMutexHelper esifMutexHelper(&m_executionMutex);
+    esifMutexHelper.lock();
+
     enablePolicyLogging();
     sendPolicyLogDataIfLoggingEnabled(true);
 }
 
 void Policy::executePolicyActivityLoggingDisabled(void)
 {
+    EsifMutexHelper esifMutexHelper(&m_executionMutex);
+    esifMutexHelper.lock();
+
     disablePolicyLogging();    
 }
 
 void Policy::executePolicyEmergencyCallModeTableChanged(void)
 {
+    EsifMutexHelper esifMutexHelper(&m_executionMutex);
+    esifMutexHelper.lock();
+
     if (isEventRegistered(PolicyEvent::PolicyEmergencyCallModeTableChanged))
     {
         m_theRealPolicy->emergencyCallModeTableChanged();
@@ -556,6 +719,9 @@ void Policy::executePolicyEmergencyCallModeTableChanged(void)
 
 void Policy::executePolicyPidAlgorithmTableChanged(void)
 {
+    EsifMutexHelper esifMutexHelper(&m_executionMutex);
+    esifMutexHelper.lock();
+
     if (isEventRegistered(PolicyEvent::PolicyPidAlgorithmTableChanged))
     {
         m_theRealPolicy->pidAlgorithmTableChanged();
@@ -564,6 +730,9 @@ void Policy::executePolicyPidAlgorithmTableChanged(void)
 
 void Policy::executePolicyActiveControlPointRelationshipTableChanged(void)
 {
+    EsifMutexHelper esifMutexHelper(&m_executionMutex);
+    esifMutexHelper.lock();
+
     if (isEventRegistered(PolicyEvent::PolicyActiveControlPointRelationshipTableChanged))
     {
         m_theRealPolicy->activeControlPointRelationshipTableChanged();
@@ -674,6 +843,9 @@ void Policy::destroyPolicyServices(void)
 
 void Policy::executeDomainBatteryStatusChanged(UIntN participantIndex)
 {
+    EsifMutexHelper esifMutexHelper(&m_executionMutex);
+    esifMutexHelper.lock();
+
     if (isEventRegistered(PolicyEvent::DomainBatteryStatusChanged))
     {
         m_theRealPolicy->domainBatteryStatusChanged(participantIndex);
@@ -682,6 +854,9 @@ void Policy::executeDomainBatteryStatusChanged(UIntN participantIndex)
 
 void Policy::executeDomainBatteryInformationChanged(UIntN participantIndex)
 {
+    EsifMutexHelper esifMutexHelper(&m_executionMutex);
+    esifMutexHelper.lock();
+
     if (isEventRegistered(PolicyEvent::DomainBatteryInformationChanged))
     {
         m_theRealPolicy->domainBatteryInformationChanged(participantIndex);
@@ -690,6 +865,9 @@ void Policy::executeDomainBatteryInformationChanged(UIntN participantIndex)
 
 void Policy::executeDomainPlatformPowerSourceChanged(UIntN participantIndex)
 {
+    EsifMutexHelper esifMutexHelper(&m_executionMutex);
+    esifMutexHelper.lock();
+
     if (isEventRegistered(PolicyEvent::DomainPlatformPowerSourceChanged))
     {
         m_theRealPolicy->domainPlatformPowerSourceChanged(participantIndex);
@@ -698,6 +876,9 @@ void Policy::executeDomainPlatformPowerSourceChanged(UIntN participantIndex)
 
 void Policy::executeDomainAdapterPowerRatingChanged(UIntN participantIndex)
 {
+    EsifMutexHelper esifMutexHelper(&m_executionMutex);
+    esifMutexHelper.lock();
+
     if (isEventRegistered(PolicyEvent::DomainAdapterPowerRatingChanged))
     {
         m_theRealPolicy->domainAdapterPowerRatingChanged(participantIndex);
@@ -706,6 +887,9 @@ void Policy::executeDomainAdapterPowerRatingChanged(UIntN participantIndex)
 
 void Policy::executeDomainChargerTypeChanged(UIntN participantIndex)
 {
+    EsifMutexHelper esifMutexHelper(&m_executionMutex);
+    esifMutexHelper.lock();
+
     if (isEventRegistered(PolicyEvent::DomainChargerTypeChanged))
     {
         m_theRealPolicy->domainChargerTypeChanged(participantIndex);
@@ -714,6 +898,9 @@ void Policy::executeDomainChargerTypeChanged(UIntN participantIndex)
 
 void Policy::executeDomainPlatformRestOfPowerChanged(UIntN participantIndex)
 {
+    EsifMutexHelper esifMutexHelper(&m_executionMutex);
+    esifMutexHelper.lock();
+
     if (isEventRegistered(PolicyEvent::DomainPlatformRestOfPowerChanged))
     {
         m_theRealPolicy->domainPlatformRestOfPowerChanged(participantIndex);
@@ -722,6 +909,9 @@ void Policy::executeDomainPlatformRestOfPowerChanged(UIntN participantIndex)
 
 void Policy::executeDomainACPeakPowerChanged(UIntN participantIndex)
 {
+    EsifMutexHelper esifMutexHelper(&m_executionMutex);
+    esifMutexHelper.lock();
+
     if (isEventRegistered(PolicyEvent::DomainACPeakPowerChanged))
     {
         m_theRealPolicy->domainACPeakPowerChanged(participantIndex);
@@ -730,6 +920,9 @@ void Policy::executeDomainACPeakPowerChanged(UIntN participantIndex)
 
 void Policy::executeDomainACPeakTimeWindowChanged(UIntN participantIndex)
 {
+    EsifMutexHelper esifMutexHelper(&m_executionMutex);
+    esifMutexHelper.lock();
+
     if (isEventRegistered(PolicyEvent::DomainACPeakTimeWindowChanged))
     {
         m_theRealPolicy->domainACPeakTimeWindowChanged(participantIndex);
@@ -738,6 +931,9 @@ void Policy::executeDomainACPeakTimeWindowChanged(UIntN participantIndex)
 
 void Policy::executeDomainMaxBatteryPowerChanged(UIntN participantIndex)
 {
+    EsifMutexHelper esifMutexHelper(&m_executionMutex);
+    esifMutexHelper.lock();
+
     if (isEventRegistered(PolicyEvent::DomainMaxBatteryPowerChanged))
     {
         m_theRealPolicy->domainMaxBatteryPowerChanged(participantIndex);
@@ -746,6 +942,9 @@ void Policy::executeDomainMaxBatteryPowerChanged(UIntN participantIndex)
 
 void Policy::executeDomainPlatformBatterySteadyStateChanged(UIntN participantIndex)
 {
+    EsifMutexHelper esifMutexHelper(&m_executionMutex);
+    esifMutexHelper.lock();
+
     if (isEventRegistered(PolicyEvent::DomainPlatformBatterySteadyStateChanged))
     {
         m_theRealPolicy->domainPlatformBatterySteadyStateChanged(participantIndex);
@@ -23,6 +23,7 @@
 #include "PolicyInterface.h"
 #include "EsifLibrary.h"
 #include "esif_sdk_logging_data.h"
+#include "EsifMutex.h"
 
 class DptfManager;
 
@@ -35,6 +36,12 @@ public:
 
     void createPolicy(const std::string& policyFileName, UIntN newPolicyIndex,
         const SupportedPolicyList& supportedPolicyList);
+
+    // Takes ownership of a policy instance that was linked in rather than loaded from a .dll/.so.  Used by the
+    // simulator so it can give the policy a virtual time source before it is created.
+    void createPolicy(const std::string& policyName, PolicyInterface* policyInstance,
+        DestroyPolicyInstanceFuncPtr destroyPolicyInstanceFuncPtr, UIntN newPolicyIndex,
+        const SupportedPolicyList& supportedPolicyList);
     void destroyPolicy(void);
 
     Guid getGuid(void);
@@ -49,6 +56,7 @@ public:
 
     std::string getName(void) const;
     std::string getStatusAsXml(void) const;
+    void writeStatus(StatusWriter& writer) const;
 
     // Event handlers
 
@@ -154,9 +162,14 @@ private:
     // the manager which is why the following functions are here.  This should be improved
     // in the future.
     PolicyServicesInterfaceContainer m_policyServices;
+    void createPolicyInstance(UIntN newPolicyIndex, const SupportedPolicyList& supportedPolicyList);
     void createPolicyServices(void);
     void destroyPolicyServices(void);
 
+    // When the work item executor runs work items on several threads, events for different participants can
+    // reach the same policy at the same time.  The policy itself is not thread safe so entry is serialized here.
+    EsifMutex m_executionMutex;
+
     // track the events that will be forwarded to the policy
     std::bitset<PolicyEvent::Max> m_registeredEvents;
 
@@ -98,6 +98,36 @@ void PolicyManager::createPolicy(const std::string& policyFileName)
     }
 }
 
+void PolicyManager::createPolicy(const std::string& policyName, PolicyInterface* policyInstance,
+    DestroyPolicyInstanceFuncPtr destroyPolicyInstanceFuncPtr)
+{
+    UIntN firstAvailableIndex = Constants::Invalid;
+
+    try
+    {
+        auto indexesInUse = MapOps<UIntN, std::shared_ptr<Policy>>::getKeys(m_policies);
+        firstAvailableIndex = getFirstAvailableIndex(indexesInUse);
+        m_policies[firstAvailableIndex] = std::make_shared<Policy>(m_dptfManager);
+        m_policies[firstAvailableIndex]->createPolicy(policyName, policyInstance, destroyPolicyInstanceFuncPtr,
+            firstAvailableIndex, m_supportedPolicyList);
+
+        ManagerMessage message = ManagerMessage(m_dptfManager, FLF, "Policy has been created.");
+        message.setPolicyIndex(firstAvailableIndex);
+        message.addMessage("Policy Index", firstAvailableIndex);
+        message.addMessage("Policy Name", policyName);
+        m_dptfManager->getEsifServices()->writeMessageInfo(message);
+    }
+    catch (policy_not_in_idsp_list ex)
+    {
+        destroyPolicy(firstAvailableIndex);
+    }
+    catch (...)
+    {
+        destroyPolicy(firstAvailableIndex);
+        throw;
+    }
+}
+
 void PolicyManager::destroyAllPolicies(void)
 {
     auto policyIndexes = MapOps<UIntN, std::shared_ptr<Policy>>::getKeys(m_policies);
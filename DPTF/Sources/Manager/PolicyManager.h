@@ -30,6 +30,8 @@ public:
     // Create policies
     virtual void createAllPolicies(const std::string& dptfHomeDirectoryPath) override;
     virtual void createPolicy(const std::string& policyFileName) override;
+    void createPolicy(const std::string& policyName, PolicyInterface* policyInstance,
+        DestroyPolicyInstanceFuncPtr destroyPolicyInstanceFuncPtr);
 
     // ReCreate Policies
     virtual void reloadAllPolicies(const std::string& dptfHomeDirectoryPath) override;
@@ -25,6 +25,11 @@ PolicyServicesMessageLogging::PolicyServicesMessageLogging(DptfManagerInterface*
 {
 }
 
+Bool PolicyServicesMessageLogging::isMessageLoggingEnabled(eLogType messageLevel) const
+{
+    return (messageLevel <= getEsifServices()->getCurrentLogVerbosityLevel());
+}
+
 void PolicyServicesMessageLogging::writeMessageFatal(const DptfMessage& message)
 {
     throwIfNotWorkItemThread();
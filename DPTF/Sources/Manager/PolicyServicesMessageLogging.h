@@ -28,6 +28,7 @@ public:
 
     PolicyServicesMessageLogging(DptfManagerInterface* dptfManager, UIntN policyIndex);
 
+    virtual Bool isMessageLoggingEnabled(eLogType messageLevel) const override final;
     virtual void writeMessageFatal(const DptfMessage& message) override final;
     virtual void writeMessageError(const DptfMessage& message) override final;
     virtual void writeMessageWarning(const DptfMessage& message) override final;
@@ -0,0 +1,169 @@
+/******************************************************************************
+** Copyright (c) 2013-2016 Intel Corporation All Rights Reserved
+**
+** Licensed under the Apache License, Version 2.0 (the "License"); you may not
+** use this file except in compliance with the License.
+**
+** You may obtain a copy of the License at
+**     http://www.apache.org/licenses/LICENSE-2.0
+**
+** Unless required by applicable law or agreed to in writing, software
+** distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+** WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+**
+** See the License for the specific language governing permissions and
+** limitations under the License.
+**
+******************************************************************************/
+
+#include "RecordingEsifAppServices.h"
+
+RecordingEsifAppServices::RecordingEsifAppServices(EsifAppServicesInterface* appServices,
+    PlatformTraceWriter* platformTrace, IndexContainerInterface* indexContainer) :
+    m_appServices(appServices), m_platformTrace(platformTrace), m_indexContainer(indexContainer)
+{
+}
+
+RecordingEsifAppServices::~RecordingEsifAppServices()
+{
+    DELETE_MEMORY_TC(m_appServices);
+}
+
+eIfaceType RecordingEsifAppServices::getInterfaceType(void)
+{
+    return m_appServices->getInterfaceType();
+}
+
+UInt16 RecordingEsifAppServices::getInterfaceVersion(void)
+{
+    return m_appServices->getInterfaceVersion();
+}
+
+UInt64 RecordingEsifAppServices::getInterfaceSize(void)
+{
+    return m_appServices->getInterfaceSize();
+}
+
+eEsifError RecordingEsifAppServices::getConfigurationValue(const void* esifHandle, const void* appHandle,
+    const EsifDataPtr nameSpace, const EsifDataPtr elementPath, EsifDataPtr elementValue)
+{
+    eEsifError rc = m_appServices->getConfigurationValue(esifHandle, appHandle, nameSpace, elementPath, elementValue);
+
+    // Buffer size negotiation is repeated during replay so only the final answer is kept
+    if (rc != ESIF_E_NEED_LARGER_BUFFER)
+    {
+        try
+        {
+            PlatformTraceEntry entry;
+            entry.type = PlatformTraceEntryType::Configuration;
+            entry.status = rc;
+            entry.data.push_back(PlatformTraceData(nameSpace, nameSpace->data_len));
+            entry.data.push_back(PlatformTraceData(elementPath, elementPath->data_len));
+            entry.data.push_back(PlatformTraceData(elementValue, (rc == ESIF_OK) ? elementValue->data_len : 0));
+            m_platformTrace->write(entry);
+        }
+        catch (...)
+        {
+        }
+    }
+
+    return rc;
+}
+
+eEsifError RecordingEsifAppServices::setConfigurationValue(const void* esifHandle, const void* appHandle,
+    const EsifDataPtr nameSpace, const EsifDataPtr elementPath, const EsifDataPtr elementValue,
+    const EsifFlags elementFlags)
+{
+    return m_appServices->setConfigurationValue(esifHandle, appHandle, nameSpace, elementPath, elementValue,
+        elementFlags);
+}
+
+eEsifError RecordingEsifAppServices::executePrimitive(const void* esifHandle, const void* appHandle,
+    const void* participantHandle, const void* domainHandle, const EsifDataPtr request,
+    EsifDataPtr response, ePrimitiveType primitive, const UInt8 instance)
+{
+    eEsifError rc = m_appServices->executePrimitive(esifHandle, appHandle, participantHandle, domainHandle,
+        request, response, primitive, instance);
+
+    if (rc != ESIF_E_NEED_LARGER_BUFFER)
+    {
+        writePrimitive(participantHandle, domainHandle, primitive, instance, rc, request, response,
+            ((rc == ESIF_OK) && (response != nullptr)) ? response->data_len : 0);
+    }
+
+    return rc;
+}
+
+eEsifError RecordingEsifAppServices::writeLog(const void* esifHandle, const void* appHandle,
+    const void* participantHandle, const void* domainHandle, const EsifDataPtr message,
+    const eLogType logType)
+{
+    return m_appServices->writeLog(esifHandle, appHandle, participantHandle, domainHandle, message, logType);
+}
+
+eEsifError RecordingEsifAppServices::registerForEvent(const void* esifHandle, const void* appHandle,
+    const void* participantHandle, const void* domainHandle, const EsifDataPtr eventGuid)
+{
+    return m_appServices->registerForEvent(esifHandle, appHandle, participantHandle, domainHandle, eventGuid);
+}
+
+eEsifError RecordingEsifAppServices::unregisterForEvent(const void* esifHandle, const void* appHandle,
+    const void* participantHandle, const void* domainHandle, const EsifDataPtr eventGuid)
+{
+    return m_appServices->unregisterForEvent(esifHandle, appHandle, participantHandle, domainHandle, eventGuid);
+}
+
+eEsifError RecordingEsifAppServices::sendEvent(const void* esifHandle, const void* appHandle,
+    const void* participantHandle, const void* domainHandle, const EsifDataPtr eventData, const EsifDataPtr eventGuid)
+{
+    return m_appServices->sendEvent(esifHandle, appHandle, participantHandle, domainHandle, eventData, eventGuid);
+}
+
+eEsifError RecordingEsifAppServices::executePrimitiveBatch(const void* esifHandle, const void* appHandle,
+    EsifPrimitiveBatchItemPtr items, const UInt32 itemCount, EsifDataPtr response)
+{
+    eEsifError rc = m_appServices->executePrimitiveBatch(esifHandle, appHandle, items, itemCount, response);
+
+    // Each item is written as a single primitive so the replay does not depend on how the reads were grouped
+    if (rc == ESIF_OK)
+    {
+        for (UInt32 i = 0; i < itemCount; i++)
+        {
+            if (items[i].fStatus != ESIF_E_NEED_LARGER_BUFFER)
+            {
+                EsifData itemResponse;
+                itemResponse.type = (esif_data_type)items[i].fResponseType;
+                itemResponse.buf_ptr = (UInt8*)response->buf_ptr + items[i].fOffset;
+                itemResponse.buf_len = items[i].fResponseSize;
+                itemResponse.data_len = items[i].fDataLength;
+                writePrimitive(items[i].fParticipantHandle, items[i].fDomainHandle, items[i].fPrimitive,
+                    items[i].fInstance, items[i].fStatus, nullptr, &itemResponse,
+                    (items[i].fStatus == ESIF_OK) ? items[i].fDataLength : 0);
+            }
+        }
+    }
+
+    return rc;
+}
+
+void RecordingEsifAppServices::writePrimitive(const void* participantHandle, const void* domainHandle,
+    UInt32 primitive, UInt8 instance, eEsifError status, const EsifDataPtr request, const EsifDataPtr response,
+    UInt32 responseLength)
+{
+    try
+    {
+        PlatformTraceEntry entry;
+        entry.type = PlatformTraceEntryType::Primitive;
+        entry.participantIndex = m_indexContainer->getIndex((IndexStructPtr)participantHandle);
+        entry.domainIndex = m_indexContainer->getIndex((IndexStructPtr)domainHandle);
+        entry.primitive = primitive;
+        entry.instance = instance;
+        entry.status = status;
+        entry.data.push_back(PlatformTraceData(request, (request != nullptr) ? request->buf_len : 0));
+        entry.data.push_back(PlatformTraceData(response, responseLength));
+        m_platformTrace->write(entry);
+    }
+    catch (...)
+    {
+    }
+}
\ No newline at end of file
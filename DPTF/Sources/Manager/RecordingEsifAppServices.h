@@ -0,0 +1,82 @@
+/******************************************************************************
+** Copyright (c) 2013-2016 Intel Corporation All Rights Reserved
+**
+** Licensed under the Apache License, Version 2.0 (the "License"); you may not
+** use this file except in compliance with the License.
+**
+** You may obtain a copy of the License at
+**     http://www.apache.org/licenses/LICENSE-2.0
+**
+** Unless required by applicable law or agreed to in writing, software
+** distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+** WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+**
+** See the License for the specific language governing permissions and
+** limitations under the License.
+**
+******************************************************************************/
+
+#pragma once
+
+#include "Dptf.h"
+#include "esif_sdk_iface_esif.h"
+#include "EsifAppServicesInterface.h"
+#include "IndexContainerInterface.h"
+#include "PlatformTrace.h"
+
+//
+// Passes every call through to ESIF and writes the primitive results and configuration values DPTF receives to
+// a platform trace so they can be replayed later.  Takes ownership of the wrapped app services.
+//
+class RecordingEsifAppServices : public EsifAppServicesInterface
+{
+public:
+
+    RecordingEsifAppServices(EsifAppServicesInterface* appServices, PlatformTraceWriter* platformTrace,
+        IndexContainerInterface* indexContainer);
+    ~RecordingEsifAppServices();
+
+    virtual eIfaceType getInterfaceType(void) override;
+    virtual UInt16 getInterfaceVersion(void) override;
+    virtual UInt64 getInterfaceSize(void) override;
+
+    virtual eEsifError getConfigurationValue(const void* esifHandle, const void* appHandle,
+        const EsifDataPtr nameSpace, const EsifDataPtr elementPath, EsifDataPtr elementValue) override;
+
+    virtual eEsifError setConfigurationValue(const void* esifHandle, const void* appHandle,
+        const EsifDataPtr nameSpace, const EsifDataPtr elementPath, const EsifDataPtr elementValue,
+        const EsifFlags elementFlags) override;
+
+    virtual eEsifError executePrimitive(const void* esifHandle, const void* appHandle,
+        const void* participantHandle, const void* domainHandle, const EsifDataPtr request,
+        EsifDataPtr response, ePrimitiveType primitive, const UInt8 instance) override;
+
+    virtual eEsifError writeLog(const void* esifHandle, const void* appHandle,
+        const void* participantHandle, const void* domainHandle, const EsifDataPtr message,
+        const eLogType logType) override;
+
+    virtual eEsifError registerForEvent(const void* esifHandle, const void* appHandle,
+        const void* participantHandle, const void* domainHandle, const EsifDataPtr eventGuid) override;
+
+    virtual eEsifError unregisterForEvent(const void* esifHandle, const void* appHandle,
+        const void* participantHandle, const void* domainHandle, const EsifDataPtr eventGuid) override;
+
+    virtual eEsifError sendEvent(const void* esifHandle, const void* appHandle,
+        const void* participantHandle, const void* domainHandle, const EsifDataPtr eventData, const EsifDataPtr eventGuid) override;
+
+    virtual eEsifError executePrimitiveBatch(const void* esifHandle, const void* appHandle,
+        EsifPrimitiveBatchItemPtr items, const UInt32 itemCount, EsifDataPtr response) override;
+
+private:
+
+    // hide the copy constructor and assignment operator.
+    RecordingEsifAppServices(const RecordingEsifAppServices& rhs);
+    RecordingEsifAppServices& operator=(const RecordingEsifAppServices& rhs);
+
+    EsifAppServicesInterface* m_appServices;
+    PlatformTraceWriter* m_platformTrace;
+    IndexContainerInterface* m_indexContainer;
+
+    void writePrimitive(const void* participantHandle, const void* domainHandle, UInt32 primitive, UInt8 instance,
+        eEsifError status, const EsifDataPtr request, const EsifDataPtr response, UInt32 responseLength);
+};
\ No newline at end of file
@@ -0,0 +1,370 @@
+/******************************************************************************
+** Copyright (c) 2013-2016 Intel Corporation All Rights Reserved
+**
+** Licensed under the Apache License, Version 2.0 (the "License"); you may not
+** use this file except in compliance with the License.
+**
+** You may obtain a copy of the License at
+**     http://www.apache.org/licenses/LICENSE-2.0
+**
+** Unless required by applicable law or agreed to in writing, software
+** distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+** WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+**
+** See the License for the specific language governing permissions and
+** limitations under the License.
+**
+******************************************************************************/
+
+#include "TimerWheel.h"
+#include <iterator>
+
+TimerWheel::TimerWheel(UIntN tickMilliseconds) :
+    m_tickMilliseconds((tickMilliseconds > 0) ? tickMilliseconds : 1),
+    m_nextTick(0),
+    m_slots(NumberOfSlots + 1),
+    m_wheelCount(0)
+{
+    for (UIntN level = 0; level < NumberOfLevels; level++)
+    {
+        m_levelCount[level] = 0;
+    }
+}
+
+TimerWheel::~TimerWheel(void)
+{
+    deleteAll();
+}
+
+void TimerWheel::insert(DeferredWorkItem* newWorkItem, const TimeSpan& currentTime)
+{
+    if (m_wheelCount == 0)
+    {
+        // Nothing is waiting so the wheel can jump straight to the current time.
+        m_nextTick = getTick(currentTime, false) + 1;
+    }
+
+    TimerWheelEntry newEntry;
+    newEntry.workItem = newWorkItem;
+    newEntry.expirationTick = getTick(newWorkItem->getDeferredProcessingTime(), true);
+
+    std::list<TimerWheelEntry> newList;
+    newList.push_back(newEntry);
+
+    TimerWheelLocation location;
+    location.slot = ReadySlot;
+    location.entry = newList.begin();
+    m_uniqueIdIndex[newWorkItem->getUniqueId()] = location;
+
+    place(newList, newList.begin());
+}
+
+DeferredWorkItem* TimerWheel::removeFirstReady(const TimeSpan& currentTime)
+{
+    advance(getTick(currentTime, false));
+
+    std::list<TimerWheelEntry>& readyList = m_slots[ReadySlot];
+    if ((readyList.empty() == false) &&
+        (readyList.front().workItem->getDeferredProcessingTime() <= currentTime))
+    {
+        DeferredWorkItem* firstReadyWorkItem = readyList.front().workItem;
+        remove(ReadySlot, readyList.begin());
+        return firstReadyWorkItem;
+    }
+
+    return nullptr;
+}
+
+UIntN TimerWheel::removeIfMatches(const WorkItemMatchCriteria& matchCriteria)
+{
+    UIntN numRemoved = 0;
+
+    if (matchCriteria.isUniqueIdInMatchList() == true)
+    {
+        auto location = m_uniqueIdIndex.find(matchCriteria.getUniqueIdToMatch());
+        if ((location != m_uniqueIdIndex.end()) && (location->second.entry->workItem->matches(matchCriteria) == true))
+        {
+            DeferredWorkItem* matchingWorkItem = location->second.entry->workItem;
+            remove(location->second.slot, location->second.entry);
+            DELETE_MEMORY_TC(matchingWorkItem);
+            numRemoved++;
+        }
+    }
+    else
+    {
+        for (UIntN slot = 0; slot <= ReadySlot; slot++)
+        {
+            auto it = m_slots[slot].begin();
+            while (it != m_slots[slot].end())
+            {
+                auto current = it++;
+                if (current->workItem->matches(matchCriteria) == true)
+                {
+                    DeferredWorkItem* matchingWorkItem = current->workItem;
+                    remove(slot, current);
+                    DELETE_MEMORY_TC(matchingWorkItem);
+                    numRemoved++;
+                }
+            }
+        }
+    }
+
+    return numRemoved;
+}
+
+void TimerWheel::deleteAll(void)
+{
+    for (UIntN slot = 0; slot <= ReadySlot; slot++)
+    {
+        for (auto it = m_slots[slot].begin(); it != m_slots[slot].end(); it++)
+        {
+            DELETE_MEMORY_TC(it->workItem);
+        }
+        m_slots[slot].clear();
+    }
+
+    for (UIntN level = 0; level < NumberOfLevels; level++)
+    {
+        m_levelCount[level] = 0;
+    }
+
+    m_wheelCount = 0;
+    m_uniqueIdIndex.clear();
+}
+
+UInt64 TimerWheel::getCount(void) const
+{
+    return m_wheelCount + m_slots[ReadySlot].size();
+}
+
+Bool TimerWheel::hasReadyWorkItems(void) const
+{
+    return (m_slots[ReadySlot].empty() == false);
+}
+
+TimeSpan TimerWheel::getNextExpirationTime(void) const
+{
+    if (m_slots[ReadySlot].empty() == false)
+    {
+        return m_slots[ReadySlot].front().workItem->getDeferredProcessingTime();
+    }
+
+    if (m_wheelCount == 0)
+    {
+        return TimeSpan::createInvalid();
+    }
+
+    UInt64 nextExpirationTick = 0xFFFFFFFFFFFFFFFFULL;
+
+    // Work items on the first level are in the slot for their exact tick.
+    if (m_levelCount[0] > 0)
+    {
+        for (UInt64 tick = m_nextTick; tick < (m_nextTick + FirstLevelSlots); tick++)
+        {
+            if (m_slots[tick & (FirstLevelSlots - 1)].empty() == false)
+            {
+                nextExpirationTick = tick;
+                break;
+            }
+        }
+    }
+
+    // On the higher levels the earliest work item is in the first occupied slot, but work items in that slot
+    // are not sorted.  The levels can overlap, so every level is checked.  The last
+    // level also holds the work items that are beyond the range of the wheel, so all of its slots are checked.
+    for (UIntN level = 1; level < NumberOfLevels; level++)
+    {
+        if (m_levelCount[level] == 0)
+        {
+            continue;
+        }
+
+        // When the next tick starts a new slot on this level, that slot has not cascaded yet and comes first.
+        // Otherwise the current slot only holds work items from the next rotation and comes last.
+        Bool isLastLevel = (level == (NumberOfLevels - 1));
+        UIntN levelShift = getLevelShift(level);
+        UInt64 currentIndex = m_nextTick >> levelShift;
+        UInt64 firstOffset = ((m_nextTick & ((1ULL << levelShift) - 1)) == 0) ? 0 : 1;
+        for (UInt64 offset = firstOffset; offset < (firstOffset + UpperLevelSlots); offset++)
+        {
+            const std::list<TimerWheelEntry>& slotList =
+                m_slots[getLevelFirstSlot(level) + ((currentIndex + offset) & (UpperLevelSlots - 1))];
+            for (auto it = slotList.begin(); it != slotList.end(); it++)
+            {
+                if (it->expirationTick < nextExpirationTick)
+                {
+                    nextExpirationTick = it->expirationTick;
+                }
+            }
+
+            if ((slotList.empty() == false) && (isLastLevel == false))
+            {
+                break;
+            }
+        }
+    }
+
+    return TimeSpan::createFromMilliseconds(static_cast<Int64>(nextExpirationTick * m_tickMilliseconds));
+}
+
+UInt64 TimerWheel::getTick(const TimeSpan& time, Bool roundUp) const
+{
+    UInt64 milliseconds = time.asMillisecondsUInt();
+    if (roundUp == true)
+    {
+        milliseconds += (m_tickMilliseconds - 1);
+    }
+    return milliseconds / m_tickMilliseconds;
+}
+
+UIntN TimerWheel::getSlot(UInt64 expirationTick) const
+{
+    UInt64 ticksUntilExpiration = expirationTick - m_nextTick;
+
+    if (ticksUntilExpiration < FirstLevelSlots)
+    {
+        return static_cast<UIntN>(expirationTick & (FirstLevelSlots - 1));
+    }
+
+    for (UIntN level = 1; level < NumberOfLevels; level++)
+    {
+        UIntN levelShift = getLevelShift(level);
+        if (ticksUntilExpiration < (1ULL << (levelShift + UpperLevelBits)))
+        {
+            return getLevelFirstSlot(level) + static_cast<UIntN>((expirationTick >> levelShift) & (UpperLevelSlots - 1));
+        }
+    }
+
+    // Beyond the range of the wheel.  Keep it in the last slot in range until it cascades again.
+    UIntN lastLevel = NumberOfLevels - 1;
+    UIntN lastLevelShift = getLevelShift(lastLevel);
+    UInt64 lastTickInRange = m_nextTick + (1ULL << (lastLevelShift + UpperLevelBits)) - 1;
+    return getLevelFirstSlot(lastLevel) + static_cast<UIntN>((lastTickInRange >> lastLevelShift) & (UpperLevelSlots - 1));
+}
+
+void TimerWheel::addToLevelCount(UIntN slot, Int64 change)
+{
+    if (slot != ReadySlot)
+    {
+        m_levelCount[getLevel(slot)] += change;
+        m_wheelCount += change;
+    }
+}
+
+void TimerWheel::place(std::list<TimerWheelEntry>& sourceList, std::list<TimerWheelEntry>::iterator entry)
+{
+    // Moves the entry from the source list to the slot for its expiration tick.  The source list must not be
+    // a slot list.
+
+    if (entry->expirationTick < m_nextTick)
+    {
+        moveToReady(sourceList, entry);
+    }
+    else
+    {
+        UIntN slot = getSlot(entry->expirationTick);
+        m_slots[slot].splice(m_slots[slot].end(), sourceList, entry);
+        m_uniqueIdIndex[entry->workItem->getUniqueId()].slot = slot;
+        addToLevelCount(slot, 1);
+    }
+}
+
+void TimerWheel::moveToReady(std::list<TimerWheelEntry>& sourceList, std::list<TimerWheelEntry>::iterator entry)
+{
+    // The ready list is sorted by deferred processing time.  New entries are usually the latest, so search
+    // from the back.
+
+    std::list<TimerWheelEntry>& readyList = m_slots[ReadySlot];
+    const TimeSpan& deferredProcessingTime = entry->workItem->getDeferredProcessingTime();
+
+    auto position = readyList.end();
+    while ((position != readyList.begin()) &&
+        (std::prev(position)->workItem->getDeferredProcessingTime() > deferredProcessingTime))
+    {
+        position--;
+    }
+
+    readyList.splice(position, sourceList, entry);
+    m_uniqueIdIndex[entry->workItem->getUniqueId()].slot = ReadySlot;
+}
+
+void TimerWheel::advance(UInt64 currentTick)
+{
+    while ((m_nextTick <= currentTick) && (m_wheelCount > 0))
+    {
+        UIntN index = static_cast<UIntN>(m_nextTick & (FirstLevelSlots - 1));
+
+        if (index == 0)
+        {
+            // Move the work items that are now within range down from the higher levels.
+            for (UIntN level = 1; level < NumberOfLevels; level++)
+            {
+                if (cascade(level) != 0)
+                {
+                    break;
+                }
+            }
+        }
+        else if (m_levelCount[0] == 0)
+        {
+            // Nothing can expire before the first level wraps around, so skip ahead to it.
+            UInt64 wrapTick = (m_nextTick | (FirstLevelSlots - 1)) + 1;
+            m_nextTick = (wrapTick < (currentTick + 1)) ? wrapTick : (currentTick + 1);
+            continue;
+        }
+
+        std::list<TimerWheelEntry>& slotList = m_slots[index];
+        while (slotList.empty() == false)
+        {
+            addToLevelCount(index, -1);
+            moveToReady(slotList, slotList.begin());
+        }
+
+        m_nextTick++;
+    }
+
+    if (m_nextTick <= currentTick)
+    {
+        // The wheel is empty
+        m_nextTick = currentTick + 1;
+    }
+}
+
+UIntN TimerWheel::cascade(UIntN level)
+{
+    UIntN index = static_cast<UIntN>((m_nextTick >> getLevelShift(level)) & (UpperLevelSlots - 1));
+    UIntN slot = getLevelFirstSlot(level) + index;
+
+    std::list<TimerWheelEntry> cascadeList;
+    cascadeList.splice(cascadeList.end(), m_slots[slot]);
+    addToLevelCount(slot, -static_cast<Int64>(cascadeList.size()));
+
+    while (cascadeList.empty() == false)
+    {
+        place(cascadeList, cascadeList.begin());
+    }
+
+    return index;
+}
+
+void TimerWheel::remove(UIntN slot, std::list<TimerWheelEntry>::iterator entry)
+{
+    m_uniqueIdIndex.erase(entry->workItem->getUniqueId());
+    addToLevelCount(slot, -1);
+    m_slots[slot].erase(entry);
+}
+
+UIntN TimerWheel::getLevelShift(UIntN level)
+{
+    return (level == 0) ? 0 : (FirstLevelBits + ((level - 1) * UpperLevelBits));
+}
+
+UIntN TimerWheel::getLevelFirstSlot(UIntN level)
+{
+    return (level == 0) ? 0 : (FirstLevelSlots + ((level - 1) * UpperLevelSlots));
+}
+
+UIntN TimerWheel::getLevel(UIntN slot)
+{
+    return (slot < FirstLevelSlots) ? 0 : (1 + ((slot - FirstLevelSlots) / UpperLevelSlots));
+}
\ No newline at end of file
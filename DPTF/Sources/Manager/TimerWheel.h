@@ -0,0 +1,109 @@
+/******************************************************************************
+** Copyright (c) 2013-2016 Intel Corporation All Rights Reserved
+**
+** Licensed under the Apache License, Version 2.0 (the "License"); you may not
+** use this file except in compliance with the License.
+**
+** You may obtain a copy of the License at
+**     http://www.apache.org/licenses/LICENSE-2.0
+**
+** Unless required by applicable law or agreed to in writing, software
+** distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+** WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+**
+** See the License for the specific language governing permissions and
+** limitations under the License.
+**
+******************************************************************************/
+
+#pragma once
+
+#include "Dptf.h"
+#include "DeferredWorkItem.h"
+#include "WorkItemMatchCriteria.h"
+#include <unordered_map>
+
+//
+// Hierarchical timer wheel that holds deferred work items until they are ready to process.
+//
+// Time is divided into ticks.  The first level has one slot per tick for the next 256 ticks and each of the
+// higher levels has 64 slots that each cover 64 times the span of a slot on the level below.  Inserting and
+// removing a work item is O(1).  When a slot on a higher level comes due its work items are moved down to the
+// level below.  Work items are never returned before their deferred processing time, and all work items that
+// fall in the same tick are returned together, so they are handled with a single wakeup.
+//
+// The caller is responsible for locking.
+//
+
+class TimerWheel
+{
+public:
+
+    TimerWheel(UIntN tickMilliseconds);
+    ~TimerWheel(void);
+
+    // The timer wheel takes ownership of the work item.
+    void insert(DeferredWorkItem* newWorkItem, const TimeSpan& currentTime);
+
+    // Returns the first work item whose deferred processing time is <= currentTime, or nullptr.  The caller
+    // takes ownership of the work item.
+    DeferredWorkItem* removeFirstReady(const TimeSpan& currentTime);
+
+    // Deletes the matching work items.  Matching on a unique id is O(1).
+    UIntN removeIfMatches(const WorkItemMatchCriteria& matchCriteria);
+    void deleteAll(void);
+
+    UInt64 getCount(void) const;
+    Bool hasReadyWorkItems(void) const;
+
+    // Returns the time of the next tick that has work items, or an invalid TimeSpan if the wheel is empty.
+    TimeSpan getNextExpirationTime(void) const;
+
+private:
+
+    // hide the copy constructor and assignment operator.
+    TimerWheel(const TimerWheel& rhs);
+    TimerWheel& operator=(const TimerWheel& rhs);
+
+    static const UIntN FirstLevelBits = 8;
+    static const UIntN FirstLevelSlots = 1 << FirstLevelBits;
+    static const UIntN UpperLevelBits = 6;
+    static const UIntN UpperLevelSlots = 1 << UpperLevelBits;
+    static const UIntN NumberOfLevels = 4;
+    static const UIntN NumberOfSlots = FirstLevelSlots + ((NumberOfLevels - 1) * UpperLevelSlots);
+    static const UIntN ReadySlot = NumberOfSlots;
+
+    struct TimerWheelEntry
+    {
+        DeferredWorkItem* workItem;
+        UInt64 expirationTick;
+    };
+
+    struct TimerWheelLocation
+    {
+        UIntN slot;
+        std::list<TimerWheelEntry>::iterator entry;
+    };
+
+    UInt64 m_tickMilliseconds;
+    UInt64 m_nextTick;                                              // the next tick that has not been processed
+
+    // One list per slot plus the ready list (ReadySlot), which is kept sorted by deferred processing time.
+    std::vector<std::list<TimerWheelEntry>> m_slots;
+    UInt64 m_levelCount[NumberOfLevels];
+    UInt64 m_wheelCount;                                            // number of work items in all levels
+    std::unordered_map<UInt64, TimerWheelLocation> m_uniqueIdIndex;
+
+    UInt64 getTick(const TimeSpan& time, Bool roundUp) const;
+    UIntN getSlot(UInt64 expirationTick) const;
+    void addToLevelCount(UIntN slot, Int64 change);
+    void place(std::list<TimerWheelEntry>& sourceList, std::list<TimerWheelEntry>::iterator entry);
+    void moveToReady(std::list<TimerWheelEntry>& sourceList, std::list<TimerWheelEntry>::iterator entry);
+    void advance(UInt64 currentTick);
+    UIntN cascade(UIntN level);
+    void remove(UIntN slot, std::list<TimerWheelEntry>::iterator entry);
+
+    static UIntN getLevelShift(UIntN level);
+    static UIntN getLevelFirstSlot(UIntN level);
+    static UIntN getLevel(UIntN slot);
+};
\ No newline at end of file
@@ -51,4 +51,9 @@ Bool WIPolicyInitiatedCallback::matches(const WorkItemMatchCriteria& matchCriter
 {
     return matchCriteria.testAgainstMatchList(getFrameworkEventType(), getUniqueId(),
         Constants::Invalid, Constants::Invalid, m_policyIndex);
+}
+
+UIntN WIPolicyInitiatedCallback::getPolicyIndex(void) const
+{
+    return m_policyIndex;
 }
\ No newline at end of file
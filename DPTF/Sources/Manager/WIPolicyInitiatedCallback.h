@@ -32,6 +32,8 @@ public:
     virtual Bool matches(const WorkItemMatchCriteria& matchCriteria) const override;
     virtual void execute(void) override final;
 
+    UIntN getPolicyIndex(void) const;
+
 private:
 
     const UIntN m_policyIndex;
@@ -0,0 +1,731 @@
+/******************************************************************************
+** Copyright (c) 2013-2016 Intel Corporation All Rights Reserved
+**
+** Licensed under the Apache License, Version 2.0 (the "License"); you may not
+** use this file except in compliance with the License.
+**
+** You may obtain a copy of the License at
+**     http://www.apache.org/licenses/LICENSE-2.0
+**
+** Unless required by applicable law or agreed to in writing, software
+** distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+** WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+**
+** See the License for the specific language governing permissions and
+** limitations under the License.
+**
+******************************************************************************/
+
+#include "WorkItemExecutor.h"
+#include "ImmediateWorkItemQueue.h"
+#include "EsifMutexHelper.h"
+#include "ParticipantManagerInterface.h"
+#include "ParticipantWorkItem.h"
+#include "WIPolicyInitiatedCallback.h"
+#include "DptfStatusInterface.h"
+#include "EsifServicesInterface.h"
+#include "XmlNode.h"
+
+WorkItemExecutor::WorkItemExecutor(DptfManagerInterface* dptfManager, UIntN numberOfWorkers,
+    WorkItemStatistics* workItemStatistics) :
+    m_dptfManager(dptfManager),
+    m_participantManager(dptfManager->getParticipantManager()),
+    m_workItemStatistics(workItemStatistics),
+    m_destroyWorkers(false),
+    m_currentEpoch(0),
+    m_pendingCountByEpoch(1, 0),
+    m_runningCount(0),
+    m_exclusiveTaskRunning(false),
+    m_pendingCount(0),
+    m_maxPendingCount(0),
+    m_totalCoalesced(0),
+    m_tasksSinceCacheCleared(0),
+    m_drainingForCacheClear(false)
+{
+    if ((numberOfWorkers == 0) || (numberOfWorkers > MaxNumberOfWorkers))
+    {
+        throw dptf_exception("Invalid number of work item worker threads requested.");
+    }
+
+    m_workItemStatistics->initializeWorkerStatistics(numberOfWorkers);
+
+    try
+    {
+        for (UIntN workerIndex = 0; workerIndex < numberOfWorkers; workerIndex++)
+        {
+            WorkerContext* workerContext = new WorkerContext();
+            workerContext->executor = this;
+            workerContext->workerIndex = workerIndex;
+            workerContext->thread = nullptr;
+            workerContext->threadId = nullptr;
+            workerContext->isExecuting = false;
+            workerContext->laneType = WorkItemLane::Exclusive;
+            workerContext->laneIndex = Constants::Invalid;
+            m_workers.push_back(workerContext);
+
+            workerContext->thread = new EsifThread(WorkItemExecutorWorkerStart, workerContext);
+        }
+    }
+    catch (...)
+    {
+        destroyAllWorkers();
+        throw;
+    }
+}
+
+WorkItemExecutor::~WorkItemExecutor(void)
+{
+    destroyAllWorkers();
+    makeEmpty();
+}
+
+void WorkItemExecutor::destroyAllWorkers(void)
+{
+    EsifMutexHelper esifMutexHelper(&m_mutex);
+    esifMutexHelper.lock();
+    m_destroyWorkers = true;
+    esifMutexHelper.unlock();
+
+    for (UIntN i = 0; i < m_workers.size(); i++)
+    {
+        m_workAvailableSemaphore.signal();
+    }
+
+    // Deleting the thread waits for it to exit.
+    for (auto it = m_workers.begin(); it != m_workers.end(); it++)
+    {
+        DELETE_MEMORY_TC((*it)->thread);
+        DELETE_MEMORY_TC(*it);
+    }
+    m_workers.clear();
+}
+
+void WorkItemExecutor::submit(ImmediateWorkItem* immediateWorkItem)
+{
+    submitTask(immediateWorkItem, immediateWorkItem->getWorkItem(), false);
+}
+
+void WorkItemExecutor::submit(DeferredWorkItem* deferredWorkItem)
+{
+    submitTask(deferredWorkItem, deferredWorkItem->getWorkItem(), true);
+}
+
+UIntN WorkItemExecutor::getNumberOfWorkers(void) const
+{
+    return static_cast<UIntN>(m_workers.size());
+}
+
+Bool WorkItemExecutor::isWorkerThread(void) const
+{
+    EsifMutexHelper esifMutexHelper(&m_mutex);
+    esifMutexHelper.lock();
+
+    Bool isWorkerThread = (findCurrentWorker() != nullptr);
+
+    esifMutexHelper.unlock();
+
+    return isWorkerThread;
+}
+
+Bool WorkItemExecutor::canExecuteOnCurrentWorker(WorkItemInterface* wrappedWorkItem) const
+{
+    WorkItemLane::Type laneType;
+    UIntN laneIndex;
+    classifyWorkItem(wrappedWorkItem, laneType, laneIndex);
+
+    EsifMutexHelper esifMutexHelper(&m_mutex);
+    esifMutexHelper.lock();
+
+    Bool canExecute = false;
+    WorkerContext* workerContext = findCurrentWorker();
+    if ((workerContext != nullptr) && (workerContext->isExecuting == true))
+    {
+        // Nothing else runs while an exclusive work item executes
+        canExecute = (workerContext->laneType == WorkItemLane::Exclusive) ||
+            ((laneType == workerContext->laneType) && (laneIndex == workerContext->laneIndex));
+    }
+
+    esifMutexHelper.unlock();
+
+    return canExecute;
+}
+
+void WorkItemExecutor::makeEmpty(void)
+{
+    EsifMutexHelper esifMutexHelper(&m_mutex);
+    esifMutexHelper.lock();
+
+    // Removed exclusive work items keep their place so the epochs stay in step.
+    auto lane = m_lanes.begin();
+    while (lane != m_lanes.end())
+    {
+        removeMatchingTasks(lane->first, nullptr);
+        auto nextLane = lane;
+        nextLane++;
+        if ((lane->second.isBusy == false) && (lane->second.isScheduled == false))
+        {
+            m_lanes.erase(lane);
+        }
+        lane = nextLane;
+    }
+    removeMatchingTasks(getLaneKey(WorkItemLane::Exclusive, Constants::Invalid), nullptr);
+
+    esifMutexHelper.unlock();
+}
+
+UIntN WorkItemExecutor::removeIfMatches(const WorkItemMatchCriteria& matchCriteria)
+{
+    EsifMutexHelper esifMutexHelper(&m_mutex);
+    esifMutexHelper.lock();
+
+    UIntN numRemoved = 0;
+
+    if (matchCriteria.isUniqueIdInMatchList() == true)
+    {
+        auto location = m_uniqueIdIndex.find(matchCriteria.getUniqueIdToMatch());
+        if ((location != m_uniqueIdIndex.end()) && (location->second.task->workItem->matches(matchCriteria) == true))
+        {
+            removePendingTask(location->second.laneKey, location->second.task);
+            numRemoved++;
+        }
+    }
+    else if (matchCriteria.isParticipantIndexInMatchList() == true)
+    {
+        // Participant work items are either in the participant's lane or exclusive.
+        numRemoved += removeMatchingTasks(
+            getLaneKey(WorkItemLane::Participant, matchCriteria.getParticipantIndexToMatch()), &matchCriteria);
+        numRemoved += removeMatchingTasks(getLaneKey(WorkItemLane::Exclusive, Constants::Invalid), &matchCriteria);
+    }
+    else
+    {
+        for (auto lane = m_lanes.begin(); lane != m_lanes.end(); lane++)
+        {
+            numRemoved += removeMatchingTasks(lane->first, &matchCriteria);
+        }
+        numRemoved += removeMatchingTasks(getLaneKey(WorkItemLane::Exclusive, Constants::Invalid), &matchCriteria);
+    }
+
+    esifMutexHelper.unlock();
+
+    return numRemoved;
+}
+
+void WorkItemExecutor::writeStatus(StatusWriter& writer) const
+{
+    EsifMutexHelper esifMutexHelper(&m_mutex);
+    esifMutexHelper.lock();
+
+    writer.beginElement("work_item_executor");
+    writer.addDataElement("worker_count", StlOverride::to_string(m_workers.size()));
+    writer.addDataElement("running_count", StlOverride::to_string(m_runningCount));
+    writer.addDataElement("current_count", StlOverride::to_string(m_pendingCount));
+    writer.addDataElement("max_count", StlOverride::to_string(m_maxPendingCount));
+    writer.addDataElement("total_coalesced", StlOverride::to_string(m_totalCoalesced));
+    writer.endElement();
+
+    esifMutexHelper.unlock();
+}
+
+//
+// The following *private* methods do not need to lock the mutex unless noted.
+// The caller is responsible for locking and unlocking.
+//
+
+WorkItemExecutor::WorkerContext* WorkItemExecutor::findCurrentWorker(void) const
+{
+    EsifThreadId currentThreadId;
+
+    for (auto it = m_workers.begin(); it != m_workers.end(); it++)
+    {
+        if (((*it)->threadId != nullptr) && (*((*it)->threadId) == currentThreadId))
+        {
+            return *it;
+        }
+    }
+
+    return nullptr;
+}
+
+void WorkItemExecutor::submitTask(WorkItemInterface* workItem, WorkItemInterface* wrappedWorkItem, Bool isDeferred)
+{
+    // locks the mutex
+
+    WorkItemTask task;
+    task.workItem = workItem;
+    task.wrappedWorkItem = wrappedWorkItem;
+    task.isDeferred = isDeferred;
+    task.epoch = 0;
+    task.isCoalescingEvent =
+        (isDeferred == false) && ImmediateWorkItemQueue::isCoalescingEvent(workItem->getFrameworkEventType());
+    task.coalescingKey = (task.isCoalescingEvent == true) ? ImmediateWorkItemQueue::getCoalescingKey(wrappedWorkItem) : 0;
+    classifyWorkItem(wrappedWorkItem, task.laneType, task.laneIndex);
+    UInt64 laneKey = getLaneKey(task.laneType, task.laneIndex);
+
+    EsifMutexHelper esifMutexHelper(&m_mutex);
+    esifMutexHelper.lock();
+
+    // The same event for the same participant and domain is already waiting for a worker
+    if ((task.isCoalescingEvent == true) && (m_coalescingIndex.find(task.coalescingKey) != m_coalescingIndex.end()))
+    {
+        m_totalCoalesced++;
+        deleteTask(task);
+        esifMutexHelper.unlock();
+        return;
+    }
+
+    // The last epoch is the one that started with the most recently submitted exclusive work item
+    task.epoch = m_currentEpoch + m_pendingCountByEpoch.size() - 1;
+
+    WorkItemTaskList::iterator it;
+    if (task.laneType == WorkItemLane::Exclusive)
+    {
+        it = m_exclusiveTasks.insert(m_exclusiveTasks.end(), task);
+        m_pendingCountByEpoch.push_back(0);
+    }
+    else
+    {
+        auto lane = m_lanes.find(laneKey);
+        if (lane == m_lanes.end())
+        {
+            WorkItemLaneQueue newLane;
+            newLane.isBusy = false;
+            newLane.isScheduled = false;
+            lane = m_lanes.insert(std::make_pair(laneKey, newLane)).first;
+        }
+        it = lane->second.pendingTasks.insert(lane->second.pendingTasks.end(), task);
+        m_pendingCountByEpoch.back()++;
+        scheduleLane(lane);
+    }
+
+    WorkItemTaskLocation location;
+    location.laneKey = laneKey;
+    location.task = it;
+    m_uniqueIdIndex[workItem->getUniqueId()] = location;
+    if (task.isCoalescingEvent == true)
+    {
+        m_coalescingIndex.insert(task.coalescingKey);
+    }
+
+    m_pendingCount++;
+    if (m_pendingCount > m_maxPendingCount)
+    {
+        m_maxPendingCount = m_pendingCount;
+    }
+
+    esifMutexHelper.unlock();
+
+    m_workAvailableSemaphore.signal();
+}
+
+void WorkItemExecutor::classifyWorkItem(WorkItemInterface* wrappedWorkItem,
+    WorkItemLane::Type& laneType, UIntN& laneIndex)
+{
+    laneType = WorkItemLane::Exclusive;
+    laneIndex = Constants::Invalid;
+
+    switch (wrappedWorkItem->getFrameworkEventType())
+    {
+        // participants and domains coming and going change state shared by everything else
+        case FrameworkEvent::ParticipantAllocate:
+        case FrameworkEvent::ParticipantCreate:
+        case FrameworkEvent::ParticipantDestroy:
+        case FrameworkEvent::DomainAllocate:
+        case FrameworkEvent::DomainCreate:
+        case FrameworkEvent::DomainDestroy:
+            return;
+        default:
+            break;
+    }
+
+    ParticipantWorkItem* participantWorkItem = dynamic_cast<ParticipantWorkItem*>(wrappedWorkItem);
+    if (participantWorkItem != nullptr)
+    {
+        laneType = WorkItemLane::Participant;
+        laneIndex = participantWorkItem->getParticipantIndex();
+        return;
+    }
+
+    WIPolicyInitiatedCallback* policyCallback = dynamic_cast<WIPolicyInitiatedCallback*>(wrappedWorkItem);
+    if (policyCallback != nullptr)
+    {
+        laneType = WorkItemLane::Policy;
+        laneIndex = policyCallback->getPolicyIndex();
+    }
+}
+
+UInt64 WorkItemExecutor::getLaneKey(WorkItemLane::Type laneType, UIntN laneIndex)
+{
+    return (static_cast<UInt64>(laneType) << 32) | static_cast<UInt64>(static_cast<UInt32>(laneIndex));
+}
+
+WorkItemExecutor::WorkItemTaskList& WorkItemExecutor::getPendingTasks(UInt64 laneKey)
+{
+    // The lane must exist unless it is the exclusive lane
+    if (laneKey == getLaneKey(WorkItemLane::Exclusive, Constants::Invalid))
+    {
+        return m_exclusiveTasks;
+    }
+    return m_lanes.at(laneKey).pendingTasks;
+}
+
+UIntN WorkItemExecutor::removeMatchingTasks(UInt64 laneKey, const WorkItemMatchCriteria* matchCriteria)
+{
+    // Removes every pending work item in the lane if matchCriteria is nullptr
+
+    UIntN numRemoved = 0;
+
+    if ((laneKey != getLaneKey(WorkItemLane::Exclusive, Constants::Invalid)) && (m_lanes.find(laneKey) == m_lanes.end()))
+    {
+        return 0;
+    }
+
+    WorkItemTaskList& pendingTasks = getPendingTasks(laneKey);
+    auto it = pendingTasks.begin();
+    while (it != pendingTasks.end())
+    {
+        auto current = it;
+        it++;
+        if ((current->workItem != nullptr) &&
+            ((matchCriteria == nullptr) || (current->workItem->matches(*matchCriteria) == true)))
+        {
+            removePendingTask(laneKey, current);
+            numRemoved++;
+        }
+    }
+
+    return numRemoved;
+}
+
+void WorkItemExecutor::removePendingTask(UInt64 laneKey, WorkItemTaskList::iterator it)
+{
+    // An empty lane is not erased here.  It is erased when it is next scheduled.
+
+    unindexTask(*it);
+    deleteTask(*it);
+    m_pendingCount--;
+
+    if (it->laneType != WorkItemLane::Exclusive)
+    {
+        m_pendingCountByEpoch[static_cast<size_t>(it->epoch - m_currentEpoch)]--;
+        m_lanes.at(laneKey).pendingTasks.erase(it);
+    }
+}
+
+void WorkItemExecutor::unindexTask(const WorkItemTask& task)
+{
+    m_uniqueIdIndex.erase(task.workItem->getUniqueId());
+    if (task.isCoalescingEvent == true)
+    {
+        m_coalescingIndex.erase(task.coalescingKey);
+    }
+}
+
+void WorkItemExecutor::scheduleLane(std::unordered_map<UInt64, WorkItemLaneQueue>::iterator lane)
+{
+    if ((lane->second.isBusy == true) || (lane->second.isScheduled == true))
+    {
+        return;
+    }
+
+    if (lane->second.pendingTasks.empty() == true)
+    {
+        m_lanes.erase(lane);
+    }
+    else
+    {
+        lane->second.isScheduled = true;
+        m_readyLanes.push_back(lane->first);
+    }
+}
+
+void WorkItemExecutor::advanceEpoch(void)
+{
+    m_currentEpoch++;
+    m_pendingCountByEpoch.pop_front();
+
+    // Held lanes are checked again the next time they reach the front of the ready queue
+    m_readyLanes.insert(m_readyLanes.end(), m_heldLanes.begin(), m_heldLanes.end());
+    m_heldLanes.clear();
+}
+
+Bool WorkItemExecutor::takeNextRunnableTask(WorkItemTask& task)
+{
+    if ((m_exclusiveTaskRunning == true) || (m_drainingForCacheClear == true))
+    {
+        return false;
+    }
+
+    // An exclusive work item starts once every work item before it has completed.  A removed one only ends its epoch.
+    while ((m_exclusiveTasks.empty() == false) && (m_runningCount == 0) && (m_pendingCountByEpoch.front() == 0))
+    {
+        task = m_exclusiveTasks.front();
+        m_exclusiveTasks.pop_front();
+
+        if (task.workItem == nullptr)
+        {
+            advanceEpoch();
+            continue;
+        }
+
+        unindexTask(task);
+        m_pendingCount--;
+        m_exclusiveTaskRunning = true;
+        m_runningCount++;
+        return true;
+    }
+
+    while (m_readyLanes.empty() == false)
+    {
+        UInt64 laneKey = m_readyLanes.front();
+        m_readyLanes.pop_front();
+
+        auto lane = m_lanes.find(laneKey);
+        if (lane == m_lanes.end())
+        {
+            continue;
+        }
+        lane->second.isScheduled = false;
+
+        if ((lane->second.isBusy == true) || (lane->second.pendingTasks.empty() == true))
+        {
+            // A busy lane is scheduled again when its work item completes
+            scheduleLane(lane);
+            continue;
+        }
+
+        if (lane->second.pendingTasks.front().epoch != m_currentEpoch)
+        {
+            lane->second.isScheduled = true;
+            m_heldLanes.push_back(laneKey);
+            continue;
+        }
+
+        task = lane->second.pendingTasks.front();
+        lane->second.pendingTasks.pop_front();
+        lane->second.isBusy = true;
+
+        unindexTask(task);
+        m_pendingCount--;
+        m_pendingCountByEpoch.front()--;
+        m_runningCount++;
+        return true;
+    }
+
+    return false;
+}
+
+void WorkItemExecutor::executeTask(UIntN workerIndex, WorkItemTask& task)
+{
+    // Runs without the mutex locked
+
+    try
+    {
+        task.workItem->setWorkItemExecutionStartTime();
+    }
+    catch (std::exception& ex)
+    {
+        writeExceptionMessage(task, "WorkItem::setWorkItemExecutionStartTime", ex.what());
+    }
+    catch (...)
+    {
+        writeExceptionMessage(task, "WorkItem::setWorkItemExecutionStartTime", "Unknown exception");
+    }
+
+    try
+    {
+        task.workItem->execute();
+    }
+    catch (std::exception& ex)
+    {
+        writeExceptionMessage(task, "WorkItem::execute", ex.what());
+    }
+    catch (...)
+    {
+        writeExceptionMessage(task, "WorkItem::execute", "Unknown exception");
+    }
+
+    try
+    {
+        DptfStatusInterface* dptfStatus = m_dptfManager->getDptfStatus();
+        if (dptfStatus != nullptr)
+        {
+            dptfStatus->workItemExecuted(task.wrappedWorkItem);
+        }
+    }
+    catch (std::exception& ex)
+    {
+        writeExceptionMessage(task, "DptfStatus::workItemExecuted", ex.what());
+    }
+    catch (...)
+    {
+        writeExceptionMessage(task, "DptfStatus::workItemExecuted", "Unknown exception");
+    }
+
+    try
+    {
+        auto completionTime = EsifTime().getTimeStamp();
+        auto startTime = task.workItem->getWorkItemExecutionStartTime();
+        m_workItemStatistics->incrementWorkerTotals(workerIndex,
+            startTime - task.workItem->getWorkItemCreationTime(), completionTime - startTime);
+    }
+    catch (std::exception& ex)
+    {
+        writeExceptionMessage(task, "WorkItemStatistics::incrementWorkerTotals", ex.what());
+    }
+    catch (...)
+    {
+        writeExceptionMessage(task, "WorkItemStatistics::incrementWorkerTotals", "Unknown exception");
+    }
+
+#ifdef INCLUDE_WORK_ITEM_STATISTICS
+    try
+    {
+        if (task.isDeferred == true)
+        {
+            m_workItemStatistics->incrementDeferredTotals(task.workItem);
+        }
+        else
+        {
+            m_workItemStatistics->incrementImmediateTotals(task.workItem);
+        }
+    }
+    catch (std::exception& ex)
+    {
+        writeExceptionMessage(task, "WorkItemStatistics::incrementTotals", ex.what());
+    }
+    catch (...)
+    {
+        writeExceptionMessage(task, "WorkItemStatistics::incrementTotals", "Unknown exception");
+    }
+#endif
+
+    // deleting the work item signals anyone waiting on its completion
+    deleteTask(task);
+}
+
+void WorkItemExecutor::writeExceptionMessage(const WorkItemTask& task, const std::string& functionName,
+    const std::string& exceptionText)
+{
+    try
+    {
+        ManagerMessage message = ManagerMessage(m_dptfManager, FLF,
+            "Unhandled exception caught during execution of work item");
+        message.setFrameworkEvent(task.wrappedWorkItem->getFrameworkEventType());
+        message.addMessage("Work Item Unique ID", task.wrappedWorkItem->getUniqueId());
+        message.setExceptionCaught(functionName, exceptionText);
+        m_dptfManager->getEsifServices()->writeMessageError(message);
+    }
+    catch (...)
+    {
+    }
+}
+
+void WorkItemExecutor::completeTask(const WorkItemTask& task)
+{
+    m_runningCount--;
+
+    if (task.laneType == WorkItemLane::Exclusive)
+    {
+        m_exclusiveTaskRunning = false;
+        advanceEpoch();
+    }
+    else
+    {
+        auto lane = m_lanes.find(getLaneKey(task.laneType, task.laneIndex));
+        lane->second.isBusy = false;
+        scheduleLane(lane);
+    }
+
+    m_tasksSinceCacheCleared++;
+
+    if (m_runningCount == 0)
+    {
+        // No work item is running and none can start while we hold the mutex.
+        try
+        {
+            m_participantManager->clearAllParticipantCachedData();
+        }
+        catch (...)
+        {
+        }
+
+        m_tasksSinceCacheCleared = 0;
+        m_drainingForCacheClear = false;
+    }
+    else if (m_tasksSinceCacheCleared >= MaxTasksBetweenCacheClears)
+    {
+        m_drainingForCacheClear = true;
+    }
+}
+
+void WorkItemExecutor::deleteTask(WorkItemTask& task)
+{
+    if (task.workItem == nullptr)
+    {
+        return;
+    }
+
+    if (task.isDeferred == true)
+    {
+        DeferredWorkItem* deferredWorkItem = static_cast<DeferredWorkItem*>(task.workItem);
+        DELETE_MEMORY_TC(deferredWorkItem);
+    }
+    else
+    {
+        ImmediateWorkItem* immediateWorkItem = static_cast<ImmediateWorkItem*>(task.workItem);
+        DELETE_MEMORY_TC(immediateWorkItem);
+    }
+    task.workItem = nullptr;
+}
+
+void WorkItemExecutor::executeWorker(WorkerContext* workerContext)
+{
+    // This is running on a worker thread and processes work items until the destructor is executed
+
+    EsifMutexHelper esifMutexHelper(&m_mutex);
+    esifMutexHelper.lock();
+
+    workerContext->threadId = new EsifThreadId();
+
+    while (m_destroyWorkers == false)
+    {
+        WorkItemTask task;
+
+        if (takeNextRunnableTask(task) == true)
+        {
+            // If there is still something another worker can start, pass the wake-up along.
+            if ((m_readyLanes.empty() == false) && (m_exclusiveTaskRunning == false))
+            {
+                m_workAvailableSemaphore.signal();
+            }
+
+            workerContext->isExecuting = true;
+            workerContext->laneType = task.laneType;
+            workerContext->laneIndex = task.laneIndex;
+
+            esifMutexHelper.unlock();
+            executeTask(workerContext->workerIndex, task);
+            esifMutexHelper.lock();
+
+            workerContext->isExecuting = false;
+            completeTask(task);
+        }
+        else
+        {
+            esifMutexHelper.unlock();
+            m_workAvailableSemaphore.wait();
+            esifMutexHelper.lock();
+        }
+    }
+
+    DELETE_MEMORY_TC(workerContext->threadId);
+
+    esifMutexHelper.unlock();
+}
+
+void* WorkItemExecutorWorkerStart(void* contextPtr)
+{
+    WorkItemExecutor::WorkerContext* workerContext = static_cast<WorkItemExecutor::WorkerContext*>(contextPtr);
+    workerContext->executor->executeWorker(workerContext);
+    return nullptr;
+}
@@ -0,0 +1,204 @@
+/******************************************************************************
+** Copyright (c) 2013-2016 Intel Corporation All Rights Reserved
+**
+** Licensed under the Apache License, Version 2.0 (the "License"); you may not
+** use this file except in compliance with the License.
+**
+** You may obtain a copy of the License at
+**     http://www.apache.org/licenses/LICENSE-2.0
+**
+** Unless required by applicable law or agreed to in writing, software
+** distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+** WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+**
+** See the License for the specific language governing permissions and
+** limitations under the License.
+**
+******************************************************************************/
+
+#pragma once
+
+#include "Dptf.h"
+#include "ImmediateWorkItem.h"
+#include "DeferredWorkItem.h"
+#include "EsifMutex.h"
+#include "EsifSemaphore.h"
+#include "EsifThread.h"
+#include "EsifThreadId.h"
+#include "WorkItemStatistics.h"
+#include <unordered_map>
+#include <unordered_set>
+#include <deque>
+
+class ParticipantManagerInterface;
+
+//
+// Optional pool of worker threads used by the WorkItemQueueManager.  The work item queue thread still dequeues
+// work items in priority/time order, but instead of executing them directly it submits them here.  Each work
+// item is assigned to an ordering lane:
+//
+//   * Participant and domain work items are ordered per participant.
+//   * Policy initiated callbacks are ordered per policy.
+//   * All other work items (framework wide events and participant/domain/policy life cycle events) are
+//     exclusive.  They start after every earlier work item has completed and no later work item starts
+//     until they complete.
+//
+// Work items in different lanes may run at the same time on different workers.  Pending work items are kept
+// in a FIFO per lane, and a lane is put on the ready queue when its first work item can start, so picking the
+// next work item does not depend on how many are pending.  Duplicate coalescing events are discarded here too,
+// the same way the immediate queue discards them.  Participant cached data is
+// cleared whenever the pool goes idle, so all work items that overlap see the same cached platform state.
+// Policies serialize their own callbacks and each participant serializes access to its domains, so a policy
+// changing a control on a participant that is handling an event in another lane waits for that call to finish.
+//
+
+namespace WorkItemLane
+{
+    enum Type
+    {
+        Participant,
+        Policy,
+        Exclusive
+    };
+}
+
+class WorkItemExecutor
+{
+public:
+
+    WorkItemExecutor(DptfManagerInterface* dptfManager, UIntN numberOfWorkers,
+        WorkItemStatistics* workItemStatistics);
+    ~WorkItemExecutor(void);
+
+    // The executor takes ownership of the work item and deletes it after it executes.
+    void submit(ImmediateWorkItem* immediateWorkItem);
+    void submit(DeferredWorkItem* deferredWorkItem);
+
+    UIntN getNumberOfWorkers(void) const;
+    Bool isWorkerThread(void) const;
+
+    // Returns true if the calling thread is a worker executing an exclusive work item, or a work item in the same
+    // lane as wrappedWorkItem.  Only then can the worker execute wrappedWorkItem directly without breaking the
+    // lane ordering or letting an exclusive work item overlap other work items.
+    Bool canExecuteOnCurrentWorker(WorkItemInterface* wrappedWorkItem) const;
+
+    // Only removes work items that have not started executing.
+    void makeEmpty(void);
+    UIntN removeIfMatches(const WorkItemMatchCriteria& matchCriteria);
+
+    // Returns the ordering lane for a work item
+    static void classifyWorkItem(WorkItemInterface* wrappedWorkItem, WorkItemLane::Type& laneType, UIntN& laneIndex);
+
+    void writeStatus(StatusWriter& writer) const;
+
+    static const UIntN MaxNumberOfWorkers = 16;
+
+private:
+
+    // hide the copy constructor and assignment operator.
+    WorkItemExecutor(const WorkItemExecutor& rhs);
+    WorkItemExecutor& operator=(const WorkItemExecutor& rhs);
+
+    struct WorkItemTask
+    {
+        WorkItemInterface* workItem;        // nullptr for a removed exclusive work item, which still holds its place
+        WorkItemInterface* wrappedWorkItem;
+        Bool isDeferred;
+        WorkItemLane::Type laneType;
+        UIntN laneIndex;
+        UInt64 epoch;                       // number of exclusive work items submitted before this one
+        Bool isCoalescingEvent;
+        UInt64 coalescingKey;
+    };
+
+    typedef std::list<WorkItemTask> WorkItemTaskList;
+
+    struct WorkItemLaneQueue
+    {
+        WorkItemTaskList pendingTasks;
+        Bool isBusy;
+        Bool isScheduled;                   // the lane is in m_readyLanes or m_heldLanes
+    };
+
+    struct WorkItemTaskLocation
+    {
+        UInt64 laneKey;
+        WorkItemTaskList::iterator task;
+    };
+
+    struct WorkerContext
+    {
+        WorkItemExecutor* executor;
+        UIntN workerIndex;
+        EsifThread* thread;
+        EsifThreadId* threadId;
+        Bool isExecuting;
+        WorkItemLane::Type laneType;        // lane of the work item being executed
+        UIntN laneIndex;
+    };
+
+    DptfManagerInterface* m_dptfManager;
+    ParticipantManagerInterface* m_participantManager;
+    WorkItemStatistics* m_workItemStatistics;
+    mutable EsifMutex m_mutex;
+
+    // Signaled when a work item is submitted, when a worker leaves work behind that another worker can start,
+    // and when the workers need to exit.
+    EsifSemaphore m_workAvailableSemaphore;
+
+    std::vector<WorkerContext*> m_workers;
+    Bool m_destroyWorkers;
+
+    // Participant and policy lanes with pending or running work items.  Exclusive work items have their own FIFO.
+    std::unordered_map<UInt64, WorkItemLaneQueue> m_lanes;
+    WorkItemTaskList m_exclusiveTasks;
+
+    // Lanes that are not busy and have a pending work item, in the order they became ready.  A lane whose first
+    // work item has to wait for an earlier exclusive work item is held until that exclusive work item completes.
+    std::deque<UInt64> m_readyLanes;
+    std::vector<UInt64> m_heldLanes;
+
+    // Work items after an exclusive work item belong to the next epoch.  Element 0 is the number of pending
+    // participant and policy work items in the current epoch; an exclusive work item starts when it reaches 0.
+    UInt64 m_currentEpoch;
+    std::deque<UIntN> m_pendingCountByEpoch;
+
+    std::unordered_map<UInt64, WorkItemTaskLocation> m_uniqueIdIndex;
+    std::unordered_set<UInt64> m_coalescingIndex;
+
+    UIntN m_runningCount;
+    Bool m_exclusiveTaskRunning;
+    UInt64 m_pendingCount;
+    UInt64 m_maxPendingCount;
+    UInt64 m_totalCoalesced;
+
+    // When work items keep overlapping the pool never goes idle and cached data would never be refreshed.
+    // After this many completions without an idle period new work items are held until the pool drains.
+    UIntN m_tasksSinceCacheCleared;
+    Bool m_drainingForCacheClear;
+    static const UIntN MaxTasksBetweenCacheClears = 32;
+
+    WorkerContext* findCurrentWorker(void) const;
+    void submitTask(WorkItemInterface* workItem, WorkItemInterface* wrappedWorkItem, Bool isDeferred);
+    static UInt64 getLaneKey(WorkItemLane::Type laneType, UIntN laneIndex);
+
+    WorkItemTaskList& getPendingTasks(UInt64 laneKey);
+    UIntN removeMatchingTasks(UInt64 laneKey, const WorkItemMatchCriteria* matchCriteria);
+    void removePendingTask(UInt64 laneKey, WorkItemTaskList::iterator it);
+    void unindexTask(const WorkItemTask& task);
+    void scheduleLane(std::unordered_map<UInt64, WorkItemLaneQueue>::iterator lane);
+    void advanceEpoch(void);
+
+    Bool takeNextRunnableTask(WorkItemTask& task);
+    void executeTask(UIntN workerIndex, WorkItemTask& task);
+    void writeExceptionMessage(const WorkItemTask& task, const std::string& functionName,
+        const std::string& exceptionText);
+    void completeTask(const WorkItemTask& task);
+    void deleteTask(WorkItemTask& task);
+    void destroyAllWorkers(void);
+
+    friend void* WorkItemExecutorWorkerStart(void* contextPtr);
+    void executeWorker(WorkerContext* workerContext);
+};
+
+void* WorkItemExecutorWorkerStart(void* contextPtr);
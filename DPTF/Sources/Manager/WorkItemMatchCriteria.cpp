@@ -108,4 +108,34 @@ Bool WorkItemMatchCriteria::testAgainstMatchList(FrameworkEvent::Type frameworkE
     }
 
     return true;
+}
+
+Bool WorkItemMatchCriteria::isFrameworkEventTypeInMatchList(void) const
+{
+    return m_testFrameworkEventType;
+}
+
+FrameworkEvent::Type WorkItemMatchCriteria::getFrameworkEventTypeToMatch(void) const
+{
+    return m_frameworkEventType;
+}
+
+Bool WorkItemMatchCriteria::isUniqueIdInMatchList(void) const
+{
+    return m_testUniqueId;
+}
+
+UInt64 WorkItemMatchCriteria::getUniqueIdToMatch(void) const
+{
+    return m_uniqueId;
+}
+
+Bool WorkItemMatchCriteria::isParticipantIndexInMatchList(void) const
+{
+    return m_testParticipantIndex;
+}
+
+UIntN WorkItemMatchCriteria::getParticipantIndexToMatch(void) const
+{
+    return m_participantIndex;
 }
\ No newline at end of file
@@ -37,6 +37,14 @@ public:
         UIntN participantIndex = Constants::Invalid, UIntN domainIndex = Constants::Invalid,
         UIntN policyIndex = Constants::Invalid) const;
 
+    // The following let a queue narrow down the set of work items it needs to test.
+    Bool isFrameworkEventTypeInMatchList(void) const;
+    FrameworkEvent::Type getFrameworkEventTypeToMatch(void) const;
+    Bool isUniqueIdInMatchList(void) const;
+    UInt64 getUniqueIdToMatch(void) const;
+    Bool isParticipantIndexInMatchList(void) const;
+    UIntN getParticipantIndexToMatch(void) const;
+
 private:
 
     Bool m_matchCriteriaAdded;
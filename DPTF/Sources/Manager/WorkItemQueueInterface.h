@@ -20,7 +20,7 @@
 
 #include "Dptf.h"
 #include "WorkItemMatchCriteria.h"
-#include "XmlNode.h"
+#include "StatusWriter.h"
 
 class WorkItemQueueInterface
 {
@@ -41,5 +41,5 @@ public:
     virtual UInt64 getMaxCount(void) const = 0;
 
     virtual UIntN removeIfMatches(const WorkItemMatchCriteria& matchCriteria) = 0;
-    virtual std::shared_ptr<XmlNode> getXml(void) const = 0;
+    virtual void writeStatus(StatusWriter& writer) const = 0;
 };
\ No newline at end of file
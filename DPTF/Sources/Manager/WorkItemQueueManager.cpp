@@ -21,6 +21,7 @@
 #include "EsifMutexHelper.h"
 #include "EsifThreadId.h"
 #include "XmlNode.h"
+#include "DptfStatusInterface.h"
 
 WorkItemQueueManager::WorkItemQueueManager(DptfManagerInterface* dptfManager) :
     m_dptfManager(dptfManager),
@@ -29,6 +30,7 @@ WorkItemQueueManager::WorkItemQueueManager(DptfManagerInterface* dptfManager) :
     m_immediateQueue(nullptr),
     m_deferredQueue(nullptr),
     m_workItemQueueThread(nullptr),
+    m_workItemExecutor(nullptr),
     m_workItemQueueSemaphore(nullptr)
 {
     try
@@ -37,8 +39,15 @@ WorkItemQueueManager::WorkItemQueueManager(DptfManagerInterface* dptfManager) :
         m_workItemQueueSemaphore = new EsifSemaphore();
         m_immediateQueue = new ImmediateWorkItemQueue(m_workItemQueueSemaphore);
         m_deferredQueue = new DeferredWorkItemQueue(m_workItemQueueSemaphore);
+
+        UIntN numberOfWorkerThreads = readNumberOfWorkerThreads();
+        if (numberOfWorkerThreads > 1)
+        {
+            m_workItemExecutor = new WorkItemExecutor(m_dptfManager, numberOfWorkerThreads, m_workItemStatistics);
+        }
+
         m_workItemQueueThread = new WorkItemQueueThread(m_dptfManager, m_immediateQueue, m_deferredQueue,
-            m_workItemQueueSemaphore, m_workItemStatistics);
+            m_workItemQueueSemaphore, m_workItemStatistics, m_workItemExecutor);
     }
     catch (...)
     {
@@ -61,7 +70,9 @@ WorkItemQueueManager::~WorkItemQueueManager(void)
 void WorkItemQueueManager::deleteAllObjects(void)
 {
     // Do not acquire mutex for this function.
+    // The work item queue thread must exit before the executor so nothing else is submitted to it.
     DELETE_MEMORY_TC(m_workItemQueueThread);
+    DELETE_MEMORY_TC(m_workItemExecutor);
     DELETE_MEMORY_TC(m_deferredQueue);
     DELETE_MEMORY_TC(m_immediateQueue);
     DELETE_MEMORY_TC(m_workItemQueueSemaphore);
@@ -78,6 +89,10 @@ void WorkItemQueueManager::disableAndEmptyAllQueues(void)
     m_enqueueingEnabled = false;
     m_immediateQueue->makeEmtpy();
     m_deferredQueue->makeEmtpy();
+    if (m_workItemExecutor != nullptr)
+    {
+        m_workItemExecutor->makeEmpty();
+    }
 
     esifMutexHelper.unlock();
 }
@@ -132,7 +147,24 @@ void WorkItemQueueManager::enqueueImmediateWorkItemAndWait(WorkItem* workItem, U
         // in place.  When this happens we just treat it like a function call and execute the work item directly
         // and return.  Without this in place the work item would just sit in the queue and never execute since
         // the thread is being held by the currently running work item.
+        // An executor worker can only do this for a work item in the lane it already holds, or from an exclusive
+        // work item.  Any other work item would run alongside work items in other lanes, and waiting for it could
+        // deadlock, so it is rejected.
+        if ((m_workItemExecutor != nullptr) && (m_workItemExecutor->isWorkerThread() == true) &&
+            (m_workItemExecutor->canExecuteOnCurrentWorker(workItem) == false))
+        {
+            delete workItem;
+            throw dptf_exception("Cannot wait for a work item outside the current lane from a work item worker thread.");
+        }
+
         workItem->execute();
+
+        DptfStatusInterface* dptfStatus = m_dptfManager->getDptfStatus();
+        if (dptfStatus != nullptr)
+        {
+            dptfStatus->workItemExecuted(workItem);
+        }
+
         delete workItem;
     }
     else
@@ -204,16 +236,22 @@ UIntN WorkItemQueueManager::removeIfMatches(const WorkItemMatchCriteria& matchCr
 
     UIntN numRemovedImmediate = m_immediateQueue->removeIfMatches(matchCriteria);
     UIntN numRemovedDeferred = m_deferredQueue->removeIfMatches(matchCriteria);
+    UIntN numRemovedExecutor = 0;
+    if (m_workItemExecutor != nullptr)
+    {
+        numRemovedExecutor = m_workItemExecutor->removeIfMatches(matchCriteria);
+    }
 
     esifMutexHelper.unlock();
 
-    UIntN numRemoved = numRemovedImmediate + numRemovedDeferred;
+    UIntN numRemoved = numRemovedImmediate + numRemovedDeferred + numRemovedExecutor;
 
     if (numRemoved > 0)
     {
         ManagerMessage message = ManagerMessage(m_dptfManager, FLF, "One or more work items have been removed from the queues.");
         message.addMessage("Immediate Queue removed", numRemovedImmediate);
         message.addMessage("Deferred Queue removed", numRemovedDeferred);
+        message.addMessage("Executor removed", numRemovedExecutor);
         m_dptfManager->getEsifServices()->writeMessageDebug(message);
     }
 
@@ -229,6 +267,11 @@ Bool WorkItemQueueManager::isWorkItemThread()
         EsifThreadId currentThreadId;
         EsifThreadId workItemQueueThreadId = m_workItemQueueThread->getWorkItemQueueThreadId();
         isWorkItemThread = (currentThreadId == workItemQueueThreadId);
+
+        if ((isWorkItemThread == false) && (m_workItemExecutor != nullptr))
+        {
+            isWorkItemThread = m_workItemExecutor->isWorkerThread();
+        }
     }
     catch (...)
     {
@@ -237,24 +280,25 @@ Bool WorkItemQueueManager::isWorkItemThread()
     return isWorkItemThread;
 }
 
-std::shared_ptr<XmlNode> WorkItemQueueManager::getStatusAsXml(void)
+void WorkItemQueueManager::writeStatus(StatusWriter& writer)
 {
     EsifMutexHelper esifMutexHelper(&m_mutex);
     esifMutexHelper.lock();
 
-    auto root = XmlNode::createRoot();
-    root->addChild(XmlNode::createComment("format_id=C5-61-4D-E9-30-80-4D-B5-98-1A-D1-D1-67-DD-4C-D7"));
+    writer.addComment("format_id=C5-61-4D-E9-30-80-4D-B5-98-1A-D1-D1-67-DD-4C-D7");
+    writer.beginElement("work_item_queue_manager_status");
 
-    auto workItemQueueManagerStatus = XmlNode::createWrapperElement("work_item_queue_manager_status");
-    root->addChild(workItemQueueManagerStatus);
+    m_immediateQueue->writeStatus(writer);
+    m_deferredQueue->writeStatus(writer);
+    if (m_workItemExecutor != nullptr)
+    {
+        m_workItemExecutor->writeStatus(writer);
+    }
+    m_workItemStatistics->writeStatus(writer);
 
-    workItemQueueManagerStatus->addChild(m_immediateQueue->getXml());
-    workItemQueueManagerStatus->addChild(m_deferredQueue->getXml());
-    workItemQueueManagerStatus->addChild(m_workItemStatistics->getXml());
+    writer.endElement();
 
     esifMutexHelper.unlock();
-
-    return root;
 }
 
 Bool WorkItemQueueManager::canEnqueueImmediateWorkItem(WorkItem* workItem) const
@@ -262,4 +306,27 @@ Bool WorkItemQueueManager::canEnqueueImmediateWorkItem(WorkItem* workItem) const
     return  ((m_enqueueingEnabled == true) ||
              (workItem->getFrameworkEventType() == FrameworkEvent::PolicyDestroy) ||
              (workItem->getFrameworkEventType() == FrameworkEvent::ParticipantDestroy));
+}
+
+UIntN WorkItemQueueManager::readNumberOfWorkerThreads(void) const
+{
+    // The executor is optional.  If the worker count isn't configured all work items run on the single
+    // work item queue thread.
+    UIntN numberOfWorkerThreads = 1;
+
+    try
+    {
+        numberOfWorkerThreads = m_dptfManager->getEsifServices()->readConfigurationUInt32("WorkItemWorkerThreadCount");
+    }
+    catch (...)
+    {
+        numberOfWorkerThreads = 1;
+    }
+
+    if (numberOfWorkerThreads > WorkItemExecutor::MaxNumberOfWorkers)
+    {
+        numberOfWorkerThreads = WorkItemExecutor::MaxNumberOfWorkers;
+    }
+
+    return numberOfWorkerThreads;
 }
\ No newline at end of file
@@ -22,6 +22,7 @@
 #include "WorkItemQueueThread.h"
 #include "ImmediateWorkItemQueue.h"
 #include "DeferredWorkItemQueue.h"
+#include "WorkItemExecutor.h"
 #include "EsifMutex.h"
 
 class WorkItemQueueManager : public WorkItemQueueManagerInterface
@@ -42,7 +43,7 @@ public:
 
     virtual void disableAndEmptyAllQueues(void) override;
 
-    virtual std::shared_ptr<XmlNode> getStatusAsXml(void) override;
+    virtual void writeStatus(StatusWriter& writer) override;
 
 private:
 
@@ -58,6 +59,10 @@ private:
     DeferredWorkItemQueue* m_deferredQueue;
     WorkItemQueueThread* m_workItemQueueThread;
 
+    // Only created when more than one worker thread is configured.  Otherwise all work items are executed
+    // on the work item queue thread.
+    WorkItemExecutor* m_workItemExecutor;
+
     // - The following semaphore is signaled when:
     //    * an item is placed in the immediate or deferred queue
     //    * the system is shutting down and the thread needs to exit
@@ -66,5 +71,6 @@ private:
     EsifSemaphore* m_workItemQueueSemaphore;
 
     void deleteAllObjects(void);
+    UIntN readNumberOfWorkerThreads(void) const;
     Bool canEnqueueImmediateWorkItem(WorkItem* workItem) const;
 };
\ No newline at end of file
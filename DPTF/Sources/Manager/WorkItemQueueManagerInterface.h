@@ -20,6 +20,7 @@
 
 #include "Dptf.h"
 #include "WorkItem.h"
+#include "StatusWriter.h"
 
 class WorkItemQueueManagerInterface
 {
@@ -37,5 +38,5 @@ public:
 
     virtual void disableAndEmptyAllQueues(void) = 0;
 
-    virtual std::shared_ptr<XmlNode> getStatusAsXml(void) = 0;
+    virtual void writeStatus(StatusWriter& writer) = 0;
 };
\ No newline at end of file
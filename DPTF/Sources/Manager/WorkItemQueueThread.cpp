@@ -18,16 +18,18 @@
 
 #include "WorkItemQueueThread.h"
 #include "ParticipantManagerInterface.h"
+#include "DptfStatusInterface.h"
 
 WorkItemQueueThread::WorkItemQueueThread(DptfManagerInterface* dptfManager, ImmediateWorkItemQueue* immediateQueue,
     DeferredWorkItemQueue* deferredQueue, EsifSemaphore* workItemQueueSemaphore,
-    WorkItemStatistics* workItemStatistics) :
+    WorkItemStatistics* workItemStatistics, WorkItemExecutor* workItemExecutor) :
     m_dptfManager(dptfManager), m_participantManager(nullptr), m_destroyThread(false),
     m_immediateQueue(immediateQueue), m_deferredQueue(deferredQueue),
     m_workItemQueueSemaphore(workItemQueueSemaphore), 
     m_workItemQueueThreadHandle(nullptr), m_workItemQueueThreadId(nullptr),
     m_workItemQueueThreadExitSemaphore(nullptr),
-    m_workItemStatistics(workItemStatistics)
+    m_workItemStatistics(workItemStatistics),
+    m_workItemExecutor(workItemExecutor)
 {
     m_participantManager = m_dptfManager->getParticipantManager();
     m_workItemQueueThreadExitSemaphore = new EsifSemaphore();
@@ -86,6 +88,14 @@ void WorkItemQueueThread::processImmediateQueue(void)
 
     while (immediateWorkItem != nullptr)
     {
+        if (m_workItemExecutor != nullptr)
+        {
+            // the executor takes ownership of the work item
+            m_workItemExecutor->submit(immediateWorkItem);
+            immediateWorkItem = m_immediateQueue->dequeue();
+            continue;
+        }
+
         //FrameworkEvent::Type eventType = immediateWorkItem->getFrameworkEventType();
 
 #ifdef INCLUDE_WORK_ITEM_STATISTICS
@@ -106,6 +116,18 @@ void WorkItemQueueThread::processImmediateQueue(void)
         {
         }
 
+        try
+        {
+            DptfStatusInterface* dptfStatus = m_dptfManager->getDptfStatus();
+            if (dptfStatus != nullptr)
+            {
+                dptfStatus->workItemExecuted(immediateWorkItem->getWorkItem());
+            }
+        }
+        catch (...)
+        {
+        }
+
         try
         {
             m_participantManager->clearAllParticipantCachedData();
@@ -136,6 +158,14 @@ void WorkItemQueueThread::processDeferredQueue(void)
 
     while (deferredWorkItem != nullptr)
     {
+        if (m_workItemExecutor != nullptr)
+        {
+            // the executor takes ownership of the work item
+            m_workItemExecutor->submit(deferredWorkItem);
+            deferredWorkItem = m_deferredQueue->dequeue();
+            continue;
+        }
+
         //FrameworkEvent::Type eventType = deferredWorkItem->getFrameworkEventType();
 
 #ifdef INCLUDE_WORK_ITEM_STATISTICS
@@ -156,6 +186,18 @@ void WorkItemQueueThread::processDeferredQueue(void)
         {
         }
 
+        try
+        {
+            DptfStatusInterface* dptfStatus = m_dptfManager->getDptfStatus();
+            if (dptfStatus != nullptr)
+            {
+                dptfStatus->workItemExecuted(deferredWorkItem->getWorkItem());
+            }
+        }
+        catch (...)
+        {
+        }
+
         try
         {
             m_participantManager->clearAllParticipantCachedData();
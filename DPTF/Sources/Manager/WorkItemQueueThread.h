@@ -24,6 +24,7 @@
 #include "EsifThread.h"
 #include "EsifThreadId.h"
 #include "WorkItemStatistics.h"
+#include "WorkItemExecutor.h"
 
 class ParticipantManagerInterface;
 
@@ -31,9 +32,11 @@ class WorkItemQueueThread
 {
 public:
 
+    // If a work item executor is provided the work items are submitted to it instead of being
+    // executed on this thread.
     WorkItemQueueThread(DptfManagerInterface* dptfManager, ImmediateWorkItemQueue* immediateQueue,
         DeferredWorkItemQueue* deferredQueue, EsifSemaphore* workItemQueueSemaphore,
-        WorkItemStatistics* workItemStatistics);
+        WorkItemStatistics* workItemStatistics, WorkItemExecutor* workItemExecutor = nullptr);
     ~WorkItemQueueThread(void);
 
     EsifThreadId getWorkItemQueueThreadId(void) const;
@@ -55,6 +58,7 @@ private:
     EsifThreadId* m_workItemQueueThreadId;
     EsifSemaphore* m_workItemQueueThreadExitSemaphore;
     WorkItemStatistics* m_workItemStatistics;
+    WorkItemExecutor* m_workItemExecutor;
 
     friend void* ThreadStart(void* contextPtr);
     void executeThread(void);
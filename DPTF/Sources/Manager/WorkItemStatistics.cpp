@@ -19,6 +19,7 @@
 #include "WorkItemStatistics.h"
 #include "XmlNode.h"
 #include "FrameworkEvent.h"
+#include "EsifMutexHelper.h"
 
 WorkItemStatistics::WorkItemStatistics(void)
 {
@@ -42,6 +43,7 @@ WorkItemStatistics::WorkItemStatistics(void)
     m_lastDptfGetStatusWorkItemExecutionStartTime = TimeSpan::createFromSeconds(0);
     m_lastDptfGetStatusWorkItemCompletionTime = TimeSpan::createFromSeconds(0);
     m_lastDptfGetStatusWorkItemExecutionTime = TimeSpan::createFromSeconds(0);
+    m_workerStatisticsStartTime = TimeSpan::createFromSeconds(0);
 }
 
 WorkItemStatistics::~WorkItemStatistics(void)
@@ -130,21 +132,60 @@ void WorkItemStatistics::incrementDeferredTotals(WorkItemInterface* workItem)
     m_totalDeferredWorkItemsExecuted += 1;
 }
 
-std::shared_ptr<XmlNode> WorkItemStatistics::getXml(void)
+void WorkItemStatistics::initializeWorkerStatistics(UIntN numberOfWorkers)
 {
-    auto workItemStatistics = XmlNode::createWrapperElement("work_item_statistics");
+    EsifMutexHelper esifMutexHelper(&m_workerStatisticsMutex);
+    esifMutexHelper.lock();
+
+    WorkerExecutionStatistics initialStatistics;
+    initialStatistics.totalExecuted = 0;
+    initialStatistics.totalQueueTime = TimeSpan::createFromSeconds(0);
+    initialStatistics.maxQueueTime = TimeSpan::createFromSeconds(0);
+    initialStatistics.totalBusyTime = TimeSpan::createFromSeconds(0);
+
+    m_workerStatistics.assign(numberOfWorkers, initialStatistics);
+    m_workerStatisticsStartTime = EsifTime().getTimeStamp();
+
+    esifMutexHelper.unlock();
+}
+
+void WorkItemStatistics::incrementWorkerTotals(UIntN workerIndex, const TimeSpan& queueTime,
+    const TimeSpan& executionTime)
+{
+    EsifMutexHelper esifMutexHelper(&m_workerStatisticsMutex);
+    esifMutexHelper.lock();
+
+    if (workerIndex < m_workerStatistics.size())
+    {
+        WorkerExecutionStatistics& workerStatistics = m_workerStatistics[workerIndex];
+        workerStatistics.totalExecuted += 1;
+        workerStatistics.totalQueueTime += queueTime;
+        workerStatistics.totalBusyTime += executionTime;
+
+        if (queueTime > workerStatistics.maxQueueTime)
+        {
+            workerStatistics.maxQueueTime = queueTime;
+        }
+    }
+
+    esifMutexHelper.unlock();
+}
+
+void WorkItemStatistics::writeStatus(StatusWriter& writer)
+{
+    writer.beginElement("work_item_statistics");
 
     // print the total number that have executed in each queue
 
-    workItemStatistics->addChild(XmlNode::createDataElement("total_deferred_work_items_executed",
-        StlOverride::to_string(m_totalDeferredWorkItemsExecuted)));
-    workItemStatistics->addChild(XmlNode::createDataElement("total_immediate_work_items_executed",
-        StlOverride::to_string(m_totalImmediateWorkItemsExecuted)));
+    writer.addDataElement("total_deferred_work_items_executed",
+        StlOverride::to_string(m_totalDeferredWorkItemsExecuted));
+    writer.addDataElement("total_immediate_work_items_executed",
+        StlOverride::to_string(m_totalImmediateWorkItemsExecuted));
 
     // create a table containing one row for each work item type.  this is for immediate work items only.
 
-    auto immediateWorkItemStatistics = XmlNode::createWrapperElement("immediate_work_item_statistics");
-    workItemStatistics->addChild(immediateWorkItemStatistics);
+    writer.beginElement("immediate_work_item_statistics");
+    writer.beginList("work_item");
 
     for (UIntN i = 0; i < FrameworkEvent::Max; i++)
     {
@@ -160,20 +201,71 @@ std::shared_ptr<XmlNode> WorkItemStatistics::getXml(void)
             averageExecutionTime = m_immediateWorkItemStatistics[i].totalExecutionTime / totalExecuted;
         }
 
-        auto workItem = XmlNode::createWrapperElement("work_item");
-        immediateWorkItemStatistics->addChild(workItem);
+        writer.beginElement("work_item");
+
+        writer.addDataElement("work_item_type", event.name);
+        writer.addDataElement("total_executed", StlOverride::to_string(totalExecuted));
+
+        writer.addDataElement("average_queue_time", averageQueueTime.toStringMilliseconds());
+        writer.addDataElement("min_queue_time", m_immediateWorkItemStatistics[i].minQueueTime.toStringMilliseconds());
+        writer.addDataElement("max_queue_time", m_immediateWorkItemStatistics[i].maxQueueTime.toStringMilliseconds());
+
+        writer.addDataElement("average_execution_time", averageExecutionTime.toStringMilliseconds());
+        writer.addDataElement("min_execution_time", m_immediateWorkItemStatistics[i].minExecutionTime.toStringMilliseconds());
+        writer.addDataElement("max_execution_time", m_immediateWorkItemStatistics[i].maxExecutionTime.toStringMilliseconds());
 
-        workItem->addChild(XmlNode::createDataElement("work_item_type", event.name));
-        workItem->addChild(XmlNode::createDataElement("total_executed", StlOverride::to_string(totalExecuted)));
+        writer.endElement();
+    }
 
-        workItem->addChild(XmlNode::createDataElement("average_queue_time", averageQueueTime.toStringMilliseconds()));
-        workItem->addChild(XmlNode::createDataElement("min_queue_time", m_immediateWorkItemStatistics[i].minQueueTime.toStringMilliseconds()));
-        workItem->addChild(XmlNode::createDataElement("max_queue_time", m_immediateWorkItemStatistics[i].maxQueueTime.toStringMilliseconds()));
+    writer.endList();
+    writer.endElement();
 
-        workItem->addChild(XmlNode::createDataElement("average_execution_time", averageExecutionTime.toStringMilliseconds()));
-        workItem->addChild(XmlNode::createDataElement("min_execution_time", m_immediateWorkItemStatistics[i].minExecutionTime.toStringMilliseconds()));
-        workItem->addChild(XmlNode::createDataElement("max_execution_time", m_immediateWorkItemStatistics[i].maxExecutionTime.toStringMilliseconds()));
+    if (m_workerStatistics.empty() == false)
+    {
+        writeWorkerStatistics(writer);
     }
 
-    return workItemStatistics;
+    writer.endElement();
+}
+
+void WorkItemStatistics::writeWorkerStatistics(StatusWriter& writer) const
+{
+    EsifMutexHelper esifMutexHelper(&m_workerStatisticsMutex);
+    esifMutexHelper.lock();
+
+    writer.beginElement("worker_statistics");
+    writer.beginList("worker");
+    auto elapsedTime = EsifTime().getTimeStamp() - m_workerStatisticsStartTime;
+
+    for (UIntN i = 0; i < m_workerStatistics.size(); i++)
+    {
+        const WorkerExecutionStatistics& statistics = m_workerStatistics[i];
+
+        auto averageQueueTime = TimeSpan::createFromSeconds(0);
+        if (statistics.totalExecuted > 0)
+        {
+            averageQueueTime = statistics.totalQueueTime / statistics.totalExecuted;
+        }
+
+        Percentage utilization(0.0);
+        if (elapsedTime > TimeSpan::createFromSeconds(0))
+        {
+            double busyRatio = statistics.totalBusyTime.asMilliseconds() / elapsedTime.asMilliseconds();
+            utilization = Percentage((busyRatio > 1.0) ? 1.0 : busyRatio);
+        }
+
+        writer.beginElement("worker");
+        writer.addDataElement("worker_index", StlOverride::to_string(i));
+        writer.addDataElement("total_executed", StlOverride::to_string(statistics.totalExecuted));
+        writer.addDataElement("utilization", utilization.toString());
+        writer.addDataElement("average_queue_time", averageQueueTime.toStringMilliseconds());
+        writer.addDataElement("max_queue_time", statistics.maxQueueTime.toStringMilliseconds());
+        writer.addDataElement("total_busy_time", statistics.totalBusyTime.toStringMilliseconds());
+        writer.endElement();
+    }
+
+    writer.endList();
+    writer.endElement();
+
+    esifMutexHelper.unlock();
 }
\ No newline at end of file
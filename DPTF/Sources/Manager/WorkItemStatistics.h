@@ -21,6 +21,8 @@
 #include "Dptf.h"
 #include "WorkItem.h"
 #include "FrameworkEvent.h"
+#include "EsifMutex.h"
+#include "StatusWriter.h"
 
 class XmlNode;
 
@@ -38,6 +40,17 @@ struct WorkItemTypeExecutionStatistics
     TimeSpan maxExecutionTime;
 };
 
+// Stores the statistics for a single worker thread when the work item executor is in use.
+struct WorkerExecutionStatistics
+{
+    UInt64 totalExecuted;
+
+    TimeSpan totalQueueTime;
+    TimeSpan maxQueueTime;
+
+    TimeSpan totalBusyTime;
+};
+
 class WorkItemStatistics
 {
 public:
@@ -48,7 +61,11 @@ public:
     void incrementImmediateTotals(WorkItemInterface* workItem);
     void incrementDeferredTotals(WorkItemInterface* workItem);
 
-    std::shared_ptr<XmlNode> getXml(void);
+    // Worker thread statistics.  These can be updated from multiple worker threads at the same time.
+    void initializeWorkerStatistics(UIntN numberOfWorkers);
+    void incrementWorkerTotals(UIntN workerIndex, const TimeSpan& queueTime, const TimeSpan& executionTime);
+
+    void writeStatus(StatusWriter& writer);
 
 private:
 
@@ -63,4 +80,10 @@ private:
     TimeSpan m_lastDptfGetStatusWorkItemExecutionStartTime;
     TimeSpan m_lastDptfGetStatusWorkItemCompletionTime;
     TimeSpan m_lastDptfGetStatusWorkItemExecutionTime;
+
+    mutable EsifMutex m_workerStatisticsMutex;
+    TimeSpan m_workerStatisticsStartTime;
+    std::vector<WorkerExecutionStatistics> m_workerStatistics;
+
+    void writeWorkerStatistics(StatusWriter& writer) const;
 };
\ No newline at end of file
@@ -42,7 +42,7 @@ void ActivePolicy::onCreate(void)
     }
     catch (std::exception& ex)
     {
-        getPolicyServices().messageLogging->writeMessageInfo(PolicyMessage(
+        DPTF_LOG_MESSAGE_INFO(getPolicyServices().messageLogging, PolicyMessage(
             FLF, "No active relationship table was found. " + string(ex.what())));
         m_art.reset(new ActiveRelationshipTable());
     }
@@ -236,7 +236,7 @@ void ActivePolicy::onActiveRelationshipTableChanged(void)
         }
         catch (std::exception& ex)
         {
-            getPolicyServices().messageLogging->writeMessageDebug(
+            DPTF_LOG_MESSAGE_DEBUG(getPolicyServices().messageLogging,
                 PolicyMessage(FLF, "Failed to reset temperature thresholds for participant: " + std::string(ex.what())));
         }
 
@@ -271,7 +271,7 @@ void ActivePolicy::coolTargetParticipant(ParticipantProxyInterface* participant)
         if (participant->getDomainPropertiesSet().getDomainCount() > 0)
         {
             auto currentTemperature = participant->getFirstDomainTemperature();
-            getPolicyServices().messageLogging->writeMessageDebug(PolicyMessage(FLF, "Considering actions based on temperature of " + 
+            DPTF_LOG_MESSAGE_DEBUG(getPolicyServices().messageLogging, PolicyMessage(FLF, "Considering actions based on temperature of " + 
                 currentTemperature.toString() + "."));
             setTripPointNotificationForTarget(participant, currentTemperature);
             requestFanSpeedChangesForTarget(participant, currentTemperature);
@@ -305,13 +305,13 @@ void ActivePolicy::requestFanSpeedChange(
         if (coolingControl->supportsFineGrainControl())
         {
             Percentage fanSpeed = selectFanSpeed(entry, tripPoints, currentTemperature);
-            getPolicyServices().messageLogging->writeMessageDebug(PolicyMessage(FLF, "Requesting fan speed of " + fanSpeed.toString() + "."));
+            DPTF_LOG_MESSAGE_DEBUG(getPolicyServices().messageLogging, PolicyMessage(FLF, "Requesting fan speed of " + fanSpeed.toString() + "."));
             coolingControl->requestFanSpeedPercentage(entry->getTargetDeviceIndex(), fanSpeed);
         }
         else
         {
             UIntN activeControlIndex = selectActiveControlIndex(entry, tripPoints, currentTemperature);
-            getPolicyServices().messageLogging->writeMessageDebug(PolicyMessage(
+            DPTF_LOG_MESSAGE_DEBUG(getPolicyServices().messageLogging, PolicyMessage(
                 FLF, "Requesting fan speed index of " + StlOverride::to_string(activeControlIndex) + "."));
             coolingControl->requestActiveControlIndex(entry->getTargetDeviceIndex(), activeControlIndex);
         }
@@ -320,7 +320,7 @@ void ActivePolicy::requestFanSpeedChange(
 
 void ActivePolicy::requestFanTurnedOff(std::shared_ptr<ActiveRelationshipTableEntry> entry)
 {
-    getPolicyServices().messageLogging->writeMessageDebug(PolicyMessage(
+    DPTF_LOG_MESSAGE_DEBUG(getPolicyServices().messageLogging, PolicyMessage(
         FLF, "Requesting fan turned off for participant " + StlOverride::to_string(entry->getSourceDeviceIndex()) + "."));
     auto domainIndexes = getParticipantTracker()->getParticipant(entry->getSourceDeviceIndex())->getDomainIndexes();
     for (auto domainIndex = domainIndexes.begin(); domainIndex != domainIndexes.end(); domainIndex++)
@@ -345,7 +345,7 @@ void ActivePolicy::requestFanTurnedOff(std::shared_ptr<ActiveRelationshipTableEn
 
 void ActivePolicy::turnOffAllFans()
 {
-    getPolicyServices().messageLogging->writeMessageDebug(PolicyMessage(FLF, "Turning off all fans."));
+    DPTF_LOG_MESSAGE_DEBUG(getPolicyServices().messageLogging, PolicyMessage(FLF, "Turning off all fans."));
     vector<UIntN> sources = m_art->getAllSources();
     for (auto source = sources.begin(); source != sources.end(); source++)
     {
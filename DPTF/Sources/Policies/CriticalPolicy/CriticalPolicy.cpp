@@ -200,7 +200,7 @@ void CriticalPolicy::onDomainTemperatureThresholdCrossed(UIntN participantIndex)
 void CriticalPolicy::takePowerActionBasedOnThermalState(ParticipantProxyInterface* participant)
 {
     auto currentTemperature = participant->getFirstDomainTemperature();
-    getPolicyServices().messageLogging->writeMessageDebug(PolicyMessage(
+    DPTF_LOG_MESSAGE_DEBUG(getPolicyServices().messageLogging, PolicyMessage(
         FLF, "Considering actions based on temperature of " + currentTemperature.toString() + "."));
     auto tripPoints = participant->getCriticalTripPointProperty().getTripPoints();
     setParticipantTemperatureThresholdNotification(currentTemperature, tripPoints.getSortedByValue(), participant);
@@ -220,7 +220,7 @@ void CriticalPolicy::takePowerAction(const Temperature& currentTemperature,
     {
         std::string debugMessage = "Participant crossed the " + ParticipantSpecificInfoKey::ToString(crossedTripPoint) 
             + " trip point but no action is being taken since system is in emergency call mode.";
-        getPolicyServices().messageLogging->writeMessageDebug(PolicyMessage(FLF, debugMessage));
+        DPTF_LOG_MESSAGE_DEBUG(getPolicyServices().messageLogging, PolicyMessage(FLF, debugMessage));
         return;
     }
     
@@ -229,7 +229,7 @@ void CriticalPolicy::takePowerAction(const Temperature& currentTemperature,
         case ParticipantSpecificInfoKey::Warm:
             if (!m_sleepRequested)
             {
-                getPolicyServices().messageLogging->writeMessageDebug(
+                DPTF_LOG_MESSAGE_DEBUG(getPolicyServices().messageLogging,
                     PolicyMessage(FLF, "Instructing system to sleep."));
                 m_stats.sleepSignalled();
                 m_sleepRequested = true;
@@ -237,14 +237,14 @@ void CriticalPolicy::takePowerAction(const Temperature& currentTemperature,
             }
             else
             {
-                getPolicyServices().messageLogging->writeMessageDebug(
+                DPTF_LOG_MESSAGE_DEBUG(getPolicyServices().messageLogging,
                     PolicyMessage(FLF, "Sleep has already been requested. Nothing to do."));
             }
             break;
         case ParticipantSpecificInfoKey::Hot:
             if (!m_hibernateRequested)
             {
-                getPolicyServices().messageLogging->writeMessageDebug(
+                DPTF_LOG_MESSAGE_DEBUG(getPolicyServices().messageLogging,
                     PolicyMessage(FLF, string("Instructing system to hibernate. ")
                     + string("Current temperature is ") + currentTemperature.toString() + string(". ")
                     + string("Trip point temperature is ") + crossedTripPointTemperature.toString() + string(".")));
@@ -254,12 +254,12 @@ void CriticalPolicy::takePowerAction(const Temperature& currentTemperature,
             }
             else
             {
-                getPolicyServices().messageLogging->writeMessageDebug(
+                DPTF_LOG_MESSAGE_DEBUG(getPolicyServices().messageLogging,
                     PolicyMessage(FLF, "Hibernate has already been requested. Nothing to do."));
             }
             break;
         case ParticipantSpecificInfoKey::Critical:
-            getPolicyServices().messageLogging->writeMessageDebug(
+            DPTF_LOG_MESSAGE_DEBUG(getPolicyServices().messageLogging,
                 PolicyMessage(FLF, string("Instructing system to shut down. ")
                 + string("Current temperature is ") + currentTemperature.toString() + string(". ")
                 + string("Trip point temperature is ") + crossedTripPointTemperature.toString() + string(".")));
@@ -267,7 +267,7 @@ void CriticalPolicy::takePowerAction(const Temperature& currentTemperature,
             getPolicyServices().platformPowerState->shutDown(currentTemperature, crossedTripPointTemperature);
             break;
         case ParticipantSpecificInfoKey::None:
-            getPolicyServices().messageLogging->writeMessageDebug(
+            DPTF_LOG_MESSAGE_DEBUG(getPolicyServices().messageLogging,
                 PolicyMessage(FLF, "No power action needed."));
             break;
         default:
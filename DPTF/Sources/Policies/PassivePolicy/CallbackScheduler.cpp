@@ -63,7 +63,7 @@ void CallbackScheduler::ensureCallbackByNextSamplePeriod(UIntN target, UIntN sou
     if (sampleTime.isInvalid() || (m_minSampleTime.isValid() && sampleTime.isValid() && (sampleTime < m_minSampleTime)))
     {
         sampleTime = m_minSampleTime;
-        m_logger->writeMessageDebug(PolicyMessage(
+        DPTF_LOG_MESSAGE_DEBUG(m_logger, PolicyMessage(
             FLF, "Sample time requested is below min for target #" +
             StlOverride::to_string(target) + ". Setting sample time to" + m_minSampleTime.toStringSeconds() + "s."));
     }
@@ -81,7 +81,7 @@ void CallbackScheduler::ensureCallbackByShortestSamplePeriod(UIntN target, const
     if (sampleTime.isInvalid() || (m_minSampleTime.isValid() && sampleTime.isValid() && (sampleTime < m_minSampleTime)))
     {
         sampleTime = m_minSampleTime;
-        m_logger->writeMessageDebug(PolicyMessage(
+        DPTF_LOG_MESSAGE_DEBUG(m_logger, PolicyMessage(
             FLF, "Sample time requested is below min for target #" +
             StlOverride::to_string(target) + ". Setting sample time to" + m_minSampleTime.toStringSeconds() + "s."));
     }
@@ -127,10 +127,10 @@ void CallbackScheduler::setTimeObject(std::shared_ptr<TimeInterface> time)
     m_sourceAvailability.setTime(time);
 }
 
-std::shared_ptr<XmlNode> CallbackScheduler::getXml() const
+void CallbackScheduler::writeStatus(StatusWriter& writer) const
 {
-    auto status = XmlNode::createWrapperElement("callback_scheduler");
-    status->addChild(m_sourceAvailability.getXml());
-    status->addChild(m_targetScheduler->getStatus());
-    return status;
+    writer.beginElement("callback_scheduler");
+    m_sourceAvailability.writeStatus(writer);
+    m_targetScheduler->getStatus()->write(writer);
+    writer.endElement();
 }
\ No newline at end of file
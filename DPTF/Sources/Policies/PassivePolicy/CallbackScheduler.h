@@ -55,7 +55,7 @@ public:
     void setTimeObject(std::shared_ptr<TimeInterface> time);
 
     // status
-    std::shared_ptr<XmlNode> getXml() const;
+    void writeStatus(StatusWriter& writer) const;
     
 private:
 
@@ -26,12 +26,12 @@ ControlStatus::ControlStatus(const std::string& name, UIntN min, UIntN max, UInt
 {
 }
 
-std::shared_ptr<XmlNode> ControlStatus::getXml()
+void ControlStatus::writeStatus(StatusWriter& writer)
 {
-    auto control = XmlNode::createWrapperElement("control");
-    control->addChild(XmlNode::createDataElement("name", m_name));
-    control->addChild(XmlNode::createDataElement("min", friendlyValue(m_min)));
-    control->addChild(XmlNode::createDataElement("max", friendlyValue(m_max)));
-    control->addChild(XmlNode::createDataElement("current", friendlyValue(m_current)));
-    return control;
+    writer.beginElement("control");
+    writer.addDataElement("name", m_name);
+    writer.addDataElement("min", friendlyValue(m_min));
+    writer.addDataElement("max", friendlyValue(m_max));
+    writer.addDataElement("current", friendlyValue(m_current));
+    writer.endElement();
 }
\ No newline at end of file
@@ -20,6 +20,7 @@
 
 #include "Dptf.h"
 #include "DomainProxy.h"
+#include "StatusWriter.h"
 
 // contains generic control status information.
 // all controls report their status in the form of name, min, max, current.
@@ -29,7 +30,7 @@ public:
 
     ControlStatus(const std::string& name, UIntN min, UIntN max, UIntN current);
 
-    std::shared_ptr<XmlNode> getXml();
+    void writeStatus(StatusWriter& writer);
 
 private:
 
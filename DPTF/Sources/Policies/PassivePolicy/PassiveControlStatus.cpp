@@ -35,12 +35,14 @@ PassiveControlStatus::PassiveControlStatus(
     }
 }
 
-std::shared_ptr<XmlNode> PassiveControlStatus::getXml()
+void PassiveControlStatus::writeStatus(StatusWriter& writer)
 {
-    auto controlStatus = XmlNode::createWrapperElement("passive_control_status");
+    writer.beginElement("passive_control_status");
+    writer.beginList("participant_control_status");
     for (auto status = m_participantStatus.begin(); status != m_participantStatus.end(); status++)
     {
-        controlStatus->addChild(status->getXml());
+        status->writeStatus(writer);
     }
-    return controlStatus;
+    writer.endList();
+    writer.endElement();
 }
\ No newline at end of file
@@ -31,7 +31,7 @@ public:
 
     PassiveControlStatus(std::shared_ptr<ThermalRelationshipTable> trt, 
         std::shared_ptr<ParticipantTrackerInterface> trackedParticipants);
-    std::shared_ptr<XmlNode> getXml();
+    void writeStatus(StatusWriter& writer);
 
 private:
 
@@ -37,24 +37,23 @@ PassiveDomainControlStatus::PassiveDomainControlStatus(std::shared_ptr<DomainPro
     addDisplayStatus(domain);
 }
 
-std::shared_ptr<XmlNode> PassiveDomainControlStatus::getXml()
+void PassiveDomainControlStatus::writeStatus(StatusWriter& writer)
 {
-    auto domainControlStatus = XmlNode::createWrapperElement("domain_control_status");
-    domainControlStatus->addChild(XmlNode::createDataElement("index", friendlyValue(m_domainIndex)));
-    domainControlStatus->addChild(XmlNode::createDataElement("name", m_domainName));
-    domainControlStatus->addChild(
-        XmlNode::createDataElement("temperature", m_domainTemperature.toString()));
-    domainControlStatus->addChild(m_domainUtilization.getXml("utilization"));
-    domainControlStatus->addChild(
-        XmlNode::createDataElement("priority",
-            friendlyValue(m_domainPriority.getCurrentPriority())));
-    auto controls = XmlNode::createWrapperElement("controls");
+    writer.beginElement("domain_control_status");
+    writer.addDataElement("index", friendlyValue(m_domainIndex));
+    writer.addDataElement("name", m_domainName);
+    writer.addDataElement("temperature", m_domainTemperature.toString());
+    m_domainUtilization.getXml("utilization")->write(writer);
+    writer.addDataElement("priority", friendlyValue(m_domainPriority.getCurrentPriority()));
+    writer.beginElement("controls");
+    writer.beginList("control");
     for (auto control = m_controlStatus.begin(); control != m_controlStatus.end(); control++)
     {
-        controls->addChild(control->getXml());
+        control->writeStatus(writer);
     }
-    domainControlStatus->addChild(controls);
-    return domainControlStatus;
+    writer.endList();
+    writer.endElement();
+    writer.endElement();
 }
 
 void PassiveDomainControlStatus::addPstateStatus(std::shared_ptr<DomainProxyInterface> domain)
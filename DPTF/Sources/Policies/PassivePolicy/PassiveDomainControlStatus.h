@@ -28,7 +28,7 @@ class dptf_export PassiveDomainControlStatus
 public:
 
     PassiveDomainControlStatus(std::shared_ptr<DomainProxyInterface> domain);
-    std::shared_ptr<XmlNode> getXml();
+    void writeStatus(StatusWriter& writer);
 
 private:
 
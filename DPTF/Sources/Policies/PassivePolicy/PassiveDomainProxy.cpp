@@ -310,17 +310,23 @@ void PassiveDomainProxy::setArbitratedPerformanceLimit()
     // set the value
     if (arbitratedRequest != m_performanceControl->getStatus().getCurrentControlSetIndex())
     {
-        stringstream messageBefore;
-        messageBefore << "Attempting to change performance limit to " << arbitratedRequest << ".";
-        m_policyServices.messageLogging->writeMessageDebug(
-            PolicyMessage(FLF, messageBefore.str(), getParticipantIndex(), getDomainIndex()));
+        if (DPTF_IS_DEBUG_LOGGING_ENABLED(m_policyServices.messageLogging))
+        {
+            stringstream messageBefore;
+            messageBefore << "Attempting to change performance limit to " << arbitratedRequest << ".";
+            m_policyServices.messageLogging->writeMessageDebug(
+                PolicyMessage(FLF, messageBefore.str(), getParticipantIndex(), getDomainIndex()));
+        }
 
         m_performanceControl->setControl(arbitratedRequest);
 
-        stringstream messageAfter;
-        messageAfter << "Changed performance limit to " << arbitratedRequest << ".";
-        m_policyServices.messageLogging->writeMessageDebug(
-            PolicyMessage(FLF, messageAfter.str(), getParticipantIndex(), getDomainIndex()));
+        if (DPTF_IS_DEBUG_LOGGING_ENABLED(m_policyServices.messageLogging))
+        {
+            stringstream messageAfter;
+            messageAfter << "Changed performance limit to " << arbitratedRequest << ".";
+            m_policyServices.messageLogging->writeMessageDebug(
+                PolicyMessage(FLF, messageAfter.str(), getParticipantIndex(), getDomainIndex()));
+        }
     }
 }
 
@@ -34,14 +34,16 @@ PassiveParticipantControlStatus::PassiveParticipantControlStatus(ParticipantProx
     }
 }
 
-std::shared_ptr<XmlNode> PassiveParticipantControlStatus::getXml()
+void PassiveParticipantControlStatus::writeStatus(StatusWriter& writer)
 {
-    auto participantControlStatus = XmlNode::createWrapperElement("participant_control_status");
-    participantControlStatus->addChild(XmlNode::createDataElement("index", friendlyValue(m_participantIndex)));
-    participantControlStatus->addChild(XmlNode::createDataElement("name", m_name));
+    writer.beginElement("participant_control_status");
+    writer.addDataElement("index", friendlyValue(m_participantIndex));
+    writer.addDataElement("name", m_name);
+    writer.beginList("domain_control_status");
     for (auto status = m_domainStatus.begin(); status != m_domainStatus.end(); status++)
     {
-        participantControlStatus->addChild(status->getXml());
+        status->writeStatus(writer);
     }
-    return participantControlStatus;
+    writer.endList();
+    writer.endElement();
 }
\ No newline at end of file
@@ -28,7 +28,7 @@ class dptf_export PassiveParticipantControlStatus
 public:
 
     PassiveParticipantControlStatus(ParticipantProxyInterface* participant);
-    std::shared_ptr<XmlNode> getXml();
+    void writeStatus(StatusWriter& writer);
 
 private:
 
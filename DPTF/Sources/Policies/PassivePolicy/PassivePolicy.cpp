@@ -49,7 +49,7 @@ void PassivePolicy::onCreate(void)
     }
     catch (std::exception& ex)
     {
-        getPolicyServices().messageLogging->writeMessageInfo(PolicyMessage(
+        DPTF_LOG_MESSAGE_INFO(getPolicyServices().messageLogging, PolicyMessage(
             FLF, "No thermal relationship table was found. " + string(ex.what())));
         m_trt.reset(new ThermalRelationshipTable());
     }
@@ -140,20 +140,23 @@ string PassivePolicy::getName(void) const
 
 string PassivePolicy::getStatusAsXml(void) const
 {
-    auto root = XmlNode::createRoot();
-    auto format = XmlNode::createComment("format_id=" + getGuid().toString());
-    root->addChild(format);
-    auto status = XmlNode::createWrapperElement("passive_policy_status");
-    status->addChild(getXmlForPassiveTripPoints());
-    status->addChild(m_trt->getXml());
+    StatusWriter writer(StatusOutputFormat::Xml);
+    writeStatus(writer);
+    return writer.getContent();
+}
+
+void PassivePolicy::writeStatus(StatusWriter& writer) const
+{
+    writer.addComment("format_id=" + getGuid().toString());
+    writer.beginElement("passive_policy_status");
+    writePassiveTripPointStatus(writer);
+    m_trt->writeStatus(writer);
     PassiveControlStatus controlStatus(m_trt, getParticipantTracker());
-    status->addChild(controlStatus.getXml());
-    status->addChild(getXmlForTripPointStatistics(m_trt->getAllTargetIndexes()));
-    status->addChild(m_callbackScheduler->getXml());
-    status->addChild(XmlNode::createDataElement("utilization_threshold", m_utilizationBiasThreshold.getCurrentUtilization().toString()));
-    root->addChild(status);
-    string statusString = root->toString();
-    return statusString;
+    controlStatus.writeStatus(writer);
+    writeTripPointStatistics(writer, m_trt->getAllTargetIndexes());
+    m_callbackScheduler->writeStatus(writer);
+    writer.addDataElement("utilization_threshold", m_utilizationBiasThreshold.getCurrentUtilization().toString());
+    writer.endElement();
 }
 
 void PassivePolicy::onBindParticipant(UIntN participantIndex)
@@ -416,7 +419,11 @@ void PassivePolicy::onPolicyInitiatedCallback(UInt64 eventCode, UInt64 param1, v
 
 void PassivePolicy::onOverrideTimeObject(std::shared_ptr<TimeInterface> timeObject)
 {
-    m_callbackScheduler->setTimeObject(timeObject);
+    // The scheduler is made in onCreate and picks up the overridden time object from getTime() there
+    if (m_callbackScheduler.get() != nullptr)
+    {
+        m_callbackScheduler->setTimeObject(timeObject);
+    }
 }
 
 void PassivePolicy::takeThermalActionForTarget(UIntN target)
@@ -581,9 +588,10 @@ Bool PassivePolicy::participantIsTargetDevice(UIntN participantIndex) const
            m_trt->isParticipantTargetDevice(participantIndex);
 }
 
-std::shared_ptr<XmlNode> PassivePolicy::getXmlForPassiveTripPoints() const
+void PassivePolicy::writePassiveTripPointStatus(StatusWriter& writer) const
 {
-    auto allStatus = XmlNode::createWrapperElement("passive_trip_point_status");
+    writer.beginElement("passive_trip_point_status");
+    writer.beginList("participant");
     vector<UIntN> participantIndexes = getParticipantTracker()->getAllTrackedIndexes();
     for (auto participantIndex = participantIndexes.begin(); 
         participantIndex != participantIndexes.end(); 
@@ -593,10 +601,11 @@ std::shared_ptr<XmlNode> PassivePolicy::getXmlForPassiveTripPoints() const
         if (participantIsTargetDevice(*participantIndex) && 
             participant->getPassiveTripPointProperty().supportsProperty())
         {
-            allStatus->addChild(participant->getXmlForPassiveTripPoints());
+            participant->writePassiveTripPointStatus(writer);
         }
     }
-    return allStatus;
+    writer.endList();
+    writer.endElement();
 }
 
 void PassivePolicy::clearAllSourceControls()
@@ -48,6 +48,7 @@ public:
     virtual Guid getGuid(void) const override;
     virtual std::string getName(void) const override;
     virtual std::string getStatusAsXml(void) const override;
+    virtual void writeStatus(StatusWriter& writer) const override;
 
     virtual void onBindParticipant(UIntN participantIndex) override;
     virtual void onUnbindParticipant(UIntN participantIndex) override;
@@ -99,5 +100,5 @@ private:
     Bool participantIsTargetDevice(UIntN participantIndex) const;
 
     // status
-    std::shared_ptr<XmlNode> getXmlForPassiveTripPoints() const;
+    void writePassiveTripPointStatus(StatusWriter& writer) const;
 };
\ No newline at end of file
@@ -47,19 +47,21 @@ void SourceAvailability::remove(UIntN source)
     }
 }
 
-std::shared_ptr<XmlNode> SourceAvailability::getXml() const
+void SourceAvailability::writeStatus(StatusWriter& writer) const
 {
     auto currentTime = m_time->getCurrentTime();
-    auto status = XmlNode::createWrapperElement("source_availability");
+    writer.beginElement("source_availability");
+    writer.beginList("activity");
     for (auto source = m_schedule.begin(); source != m_schedule.end(); source++)
     {
-        auto activeSource = XmlNode::createWrapperElement("activity");
-        activeSource->addChild(XmlNode::createDataElement("source", friendlyValue(source->first)));
+        writer.beginElement("activity");
+        writer.addDataElement("source", friendlyValue(source->first));
         auto timeTilAvailable = source->second - currentTime;
-        activeSource->addChild(XmlNode::createDataElement("time_until_available", timeTilAvailable.toStringSeconds()));
-        status->addChild(activeSource);
+        writer.addDataElement("time_until_available", timeTilAvailable.toStringSeconds());
+        writer.endElement();
     }
-    return status;
+    writer.endList();
+    writer.endElement();
 }
 
 void SourceAvailability::setTime(std::shared_ptr<TimeInterface> time)
@@ -20,6 +20,7 @@
 
 #include "Dptf.h"
 #include "TimeInterface.h"
+#include "StatusWriter.h"
 #include "PolicyServicesInterfaceContainer.h"
 
 // responsible for keeping track of when sources are available for limiting and unlimiting controls.
@@ -42,7 +43,7 @@ public:
     void setTime(std::shared_ptr<TimeInterface> time);
 
     // status
-    std::shared_ptr<XmlNode> getXml() const;
+    void writeStatus(StatusWriter& writer) const;
     
 private:
 
@@ -88,13 +88,6 @@ std::vector<UIntN> TargetActionBase::getDomainsThatDoNotReportTemperature(UIntN
     return domainsWithNoTemperature;
 }
 
-Bool TargetActionBase::compareTrtTableEntriesOnInfluence(
-    const  std::shared_ptr<ThermalRelationshipTableEntry>& left,
-    const  std::shared_ptr<ThermalRelationshipTableEntry>& right)
-{
-    return (left->thermalInfluence() > right->thermalInfluence());
-}
-
 Bool TargetActionBase::compareDomainsOnPriorityAndUtilization(
     const tuple<UIntN, DomainPriority, UtilizationStatus>& left,
     const tuple<UIntN, DomainPriority, UtilizationStatus>& right)
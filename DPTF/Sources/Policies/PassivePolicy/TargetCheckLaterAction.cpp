@@ -39,7 +39,7 @@ void TargetCheckLaterAction::execute()
         getTargetMonitor().startMonitoring(getTarget());
 
         // schedule a callback as soon as possible
-        getPolicyServices().messageLogging->writeMessageDebug(
+        DPTF_LOG_MESSAGE_DEBUG(getPolicyServices().messageLogging,
             PolicyMessage(FLF, "Attempting to schedule callback for target participant.", getTarget()));
         auto time = getTime()->getCurrentTime();
         getCallbackScheduler()->ensureCallbackByShortestSamplePeriod(getTarget(), time);
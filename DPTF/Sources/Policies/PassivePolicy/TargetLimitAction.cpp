@@ -40,7 +40,7 @@ void TargetLimitAction::execute()
         // make sure target is now being monitored
         getTargetMonitor().startMonitoring(getTarget());
         
-        getPolicyServices().messageLogging->writeMessageDebug(
+        DPTF_LOG_MESSAGE_DEBUG(getPolicyServices().messageLogging,
             PolicyMessage(FLF, "Attempting to limit target participant.", getTarget()));
 
         // choose sources to limit for target
@@ -48,7 +48,7 @@ void TargetLimitAction::execute()
         vector<UIntN> sourcesToLimit = chooseSourcesToLimitForTarget(getTarget());
         if (sourcesToLimit.size() > 0)
         {
-            getPolicyServices().messageLogging->writeMessageDebug(
+            DPTF_LOG_MESSAGE_DEBUG(getPolicyServices().messageLogging,
                 PolicyMessage(FLF, constructMessageForSources("limit", getTarget(), sourcesToLimit)));
 
             for (auto source = sourcesToLimit.begin(); source != sourcesToLimit.end(); source++)
@@ -56,7 +56,7 @@ void TargetLimitAction::execute()
                 if (getCallbackScheduler()->isFreeForRequests(getTarget(), *source, time))
                 {
                     vector<UIntN> domains = chooseDomainsToLimitForSource(getTarget(), *source);
-                    getPolicyServices().messageLogging->writeMessageDebug(
+                    DPTF_LOG_MESSAGE_DEBUG(getPolicyServices().messageLogging,
                         PolicyMessage(FLF, constructMessageForSourceDomains("limit", getTarget(), *source, domains)));
                     for (auto domain = domains.begin(); domain != domains.end(); domain++)
                     {
@@ -75,7 +75,7 @@ void TargetLimitAction::execute()
         else
         {
             // schedule a callback as soon as possible if there are no sources that can be limited
-            getPolicyServices().messageLogging->writeMessageDebug(
+            DPTF_LOG_MESSAGE_DEBUG(getPolicyServices().messageLogging,
                 PolicyMessage(FLF, "No sources to limit for target.", getTarget()));
             getCallbackScheduler()->ensureCallbackByShortestSamplePeriod(getTarget(), time);
         }
@@ -91,11 +91,10 @@ std::vector<UIntN> TargetLimitAction::chooseSourcesToLimitForTarget(UIntN target
 {
     // choose sources that are tied for the highest influence in the TRT
     vector<UIntN> sourcesToLimit;
-    auto availableSourcesForTarget = getTrt()->getEntriesForTarget(target);
-    availableSourcesForTarget = getEntriesWithControlsToLimit(target, availableSourcesForTarget);
+    auto availableSourcesForTarget = getEntriesWithControlsToLimit(
+        target, getTrt()->getEntriesForTargetSortedByInfluence(target));
     if (availableSourcesForTarget.size() > 0)
     {
-        sort(availableSourcesForTarget.begin(), availableSourcesForTarget.end(), compareTrtTableEntriesOnInfluence);
         for (auto entry = availableSourcesForTarget.begin(); entry != availableSourcesForTarget.end(); entry++)
         {
             if ((*entry)->thermalInfluence() == availableSourcesForTarget.front()->thermalInfluence())
@@ -293,7 +292,7 @@ void TargetLimitAction::commitLimit(UIntN source, const TimeSpan& time)
     {
         try
         {
-            getPolicyServices().messageLogging->writeMessageDebug(
+            DPTF_LOG_MESSAGE_DEBUG(getPolicyServices().messageLogging,
                 PolicyMessage(FLF, "Committing limits to source.", source, *domainIndex));
             auto domain = std::dynamic_pointer_cast<PassiveDomainProxy>(participant->getDomain(*domainIndex));
             Bool madeChange = domain->commitLimits();
@@ -33,5 +33,5 @@ TargetNoAction::~TargetNoAction()
 
 void TargetNoAction::execute()
 {
-    getPolicyServices().messageLogging->writeMessageDebug(PolicyMessage(FLF, "Nothing to do for target.", getTarget()));
+    DPTF_LOG_MESSAGE_DEBUG(getPolicyServices().messageLogging, PolicyMessage(FLF, "Nothing to do for target.", getTarget()));
 }
\ No newline at end of file
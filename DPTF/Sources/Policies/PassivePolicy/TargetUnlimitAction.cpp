@@ -38,14 +38,14 @@ void TargetUnlimitAction::execute()
     try
     {
         // choose sources to unlimit for target
-        getPolicyServices().messageLogging->writeMessageDebug(
+        DPTF_LOG_MESSAGE_DEBUG(getPolicyServices().messageLogging,
             PolicyMessage(FLF, "Attempting to unlimit target participant.", getTarget()));
 
         auto time = getTime()->getCurrentTime();
         vector<UIntN> sourcesToUnlimit = chooseSourcesToUnlimitForTarget(getTarget());
         if (sourcesToUnlimit.size() > 0)
         {
-            getPolicyServices().messageLogging->writeMessageDebug(
+            DPTF_LOG_MESSAGE_DEBUG(getPolicyServices().messageLogging,
                 PolicyMessage(FLF, constructMessageForSources("unlimit", getTarget(), sourcesToUnlimit)));
 
             for (auto source = sourcesToUnlimit.begin(); source != sourcesToUnlimit.end(); source++)
@@ -53,7 +53,7 @@ void TargetUnlimitAction::execute()
                 if (getCallbackScheduler()->isFreeForRequests(getTarget(), *source, time))
                 {
                     vector<UIntN> domains = chooseDomainsToUnlimitForSource(getTarget(), *source);
-                    getPolicyServices().messageLogging->writeMessageDebug(
+                    DPTF_LOG_MESSAGE_DEBUG(getPolicyServices().messageLogging,
                         PolicyMessage(FLF, constructMessageForSourceDomains("unlimit", getTarget(), *source, domains)));
                     for (auto domain = domains.begin(); domain != domains.end(); domain++)
                     {
@@ -102,13 +102,12 @@ std::vector<UIntN> TargetUnlimitAction::chooseSourcesToUnlimitForTarget(UIntN ta
 {
     // get TRT entries for target with sources that have controls that can be unlimited
     vector<UIntN> sourcesToLimit;
-    auto availableSourcesForTarget = getTrt()->getEntriesForTarget(target);
-    availableSourcesForTarget = getEntriesWithControlsToUnlimit(target, availableSourcesForTarget);
+    auto availableSourcesForTarget = getEntriesWithControlsToUnlimit(
+        target, getTrt()->getEntriesForTargetSortedByInfluence(target));
 
     if (availableSourcesForTarget.size() > 0)
     {
         // choose all sources that are tied for the lowest influence value in the TRT for the target
-        sort(availableSourcesForTarget.begin(), availableSourcesForTarget.end(), compareTrtTableEntriesOnInfluence);
         for (auto entry = availableSourcesForTarget.begin(); entry != availableSourcesForTarget.end(); entry++)
         {
             if ((*entry)->thermalInfluence() == availableSourcesForTarget.back()->thermalInfluence())
@@ -295,7 +294,7 @@ void TargetUnlimitAction::commitUnlimit(UIntN source, const TimeSpan& time)
     {
         try
         {
-            getPolicyServices().messageLogging->writeMessageDebug(
+            DPTF_LOG_MESSAGE_DEBUG(getPolicyServices().messageLogging,
                 PolicyMessage(FLF, "Committing limits to source.", source, *domain));
 
             auto sourceDomain = std::dynamic_pointer_cast<PassiveDomainProxy>(sourceParticipant->getDomain(*domain));
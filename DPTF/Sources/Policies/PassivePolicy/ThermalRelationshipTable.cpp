@@ -19,10 +19,19 @@
 #include "ThermalRelationshipTable.h"
 #include "EsifDataBinaryTrtPackage.h"
 #include "BinaryParse.h"
+#include <algorithm>
+
+static Bool compareEntriesOnInfluence(
+    const std::shared_ptr<ThermalRelationshipTableEntry>& left,
+    const std::shared_ptr<ThermalRelationshipTableEntry>& right)
+{
+    return (left->thermalInfluence() > right->thermalInfluence());
+}
 
 ThermalRelationshipTable::ThermalRelationshipTable(const std::vector<std::shared_ptr<RelationshipTableEntryBase>>& entries)
     : RelationshipTableBase(entries)
 {
+    buildEntriesSortedByInfluence();
 }
 
 ThermalRelationshipTable::ThermalRelationshipTable()
@@ -112,30 +121,39 @@ ThermalRelationshipTable ThermalRelationshipTable::createTrtFromDptfBuffer(const
 std::vector<std::shared_ptr<ThermalRelationshipTableEntry>> ThermalRelationshipTable::getEntriesForTarget(UIntN targetIndex)
 {
     std::vector<std::shared_ptr<ThermalRelationshipTableEntry>> entries;
-    for (auto entry = m_entries.begin(); entry != m_entries.end(); ++entry)
+    const std::vector<UIntN>& rows = findTableRowsWithTargetIndex(targetIndex);
+    for (auto row = rows.begin(); row != rows.end(); ++row)
     {
-        if ((*entry)->getTargetDeviceIndex() == targetIndex)
+        auto trtEntry = std::dynamic_pointer_cast<ThermalRelationshipTableEntry>(m_entries[*row]);
+        if (trtEntry)
         {
-            auto trtEntry = std::dynamic_pointer_cast<ThermalRelationshipTableEntry>(*entry);
-            if (trtEntry)
-            {
-                entries.push_back(trtEntry);
-            }
+            entries.push_back(trtEntry);
         }
     }
     return entries;
 }
 
+const std::vector<std::shared_ptr<ThermalRelationshipTableEntry>>& ThermalRelationshipTable::getEntriesForTargetSortedByInfluence(
+    UIntN targetIndex) const
+{
+    auto entries = m_entriesForTargetSortedByInfluence.find(targetIndex);
+    if (entries == m_entriesForTargetSortedByInfluence.end())
+    {
+        return m_noEntries;
+    }
+    return entries->second;
+}
+
 TimeSpan ThermalRelationshipTable::getMinimumActiveSamplePeriodForSource(
     UIntN sourceIndex, std::set<UIntN> activeTargets)
 {
     auto minimumSamplePeriod = TimeSpan::createInvalid();
-    for (auto entry = m_entries.begin(); entry != m_entries.end(); ++entry)
+    const std::vector<UIntN>& rows = findTableRowsWithSourceIndex(sourceIndex);
+    for (auto row = rows.begin(); row != rows.end(); ++row)
     {
-        if (((*entry)->getSourceDeviceIndex() == sourceIndex) &&
-            (activeTargets.find((*entry)->getTargetDeviceIndex()) != activeTargets.end()))
+        if (activeTargets.find(m_entries[*row]->getTargetDeviceIndex()) != activeTargets.end())
         {
-            auto trtEntry = std::dynamic_pointer_cast<ThermalRelationshipTableEntry>(*entry);
+            auto trtEntry = std::dynamic_pointer_cast<ThermalRelationshipTableEntry>(m_entries[*row]);
             if (trtEntry)
             {
                 auto samplingPeriod = trtEntry->thermalSamplingPeriod();
@@ -152,18 +170,16 @@ TimeSpan ThermalRelationshipTable::getMinimumActiveSamplePeriodForSource(
 TimeSpan ThermalRelationshipTable::getShortestSamplePeriodForTarget(UIntN target)
 {
     auto shortestSamplePeriod = TimeSpan::createInvalid();
-    for (auto entry = m_entries.begin(); entry != m_entries.end(); ++entry)
+    const std::vector<UIntN>& rows = findTableRowsWithTargetIndex(target);
+    for (auto row = rows.begin(); row != rows.end(); ++row)
     {
-        if ((*entry)->getTargetDeviceIndex() == target)
+        auto trtEntry = std::dynamic_pointer_cast<ThermalRelationshipTableEntry>(m_entries[*row]);
+        if (trtEntry)
         {
-            auto trtEntry = std::dynamic_pointer_cast<ThermalRelationshipTableEntry>(*entry);
-            if (trtEntry)
+            auto samplingPeriod = trtEntry->thermalSamplingPeriod();
+            if (shortestSamplePeriod.isInvalid() || samplingPeriod < shortestSamplePeriod)
             {
-                auto samplingPeriod = trtEntry->thermalSamplingPeriod();
-                if (shortestSamplePeriod.isInvalid() || samplingPeriod < shortestSamplePeriod)
-                {
-                    shortestSamplePeriod = samplingPeriod;
-                }
+                shortestSamplePeriod = samplingPeriod;
             }
         }
     }
@@ -173,12 +189,12 @@ TimeSpan ThermalRelationshipTable::getShortestSamplePeriodForTarget(UIntN target
 
 TimeSpan ThermalRelationshipTable::getSampleTimeForRelationship(UIntN target, UIntN source) const
 {
-    for (auto entry = m_entries.begin(); entry != m_entries.end(); ++entry)
+    const std::vector<UIntN>& rows = findTableRowsWithTargetIndex(target);
+    for (auto row = rows.begin(); row != rows.end(); ++row)
     {
-        if (((*entry)->getTargetDeviceIndex() == target) &&
-            ((*entry)->getSourceDeviceIndex() == source))
+        if (m_entries[*row]->getSourceDeviceIndex() == source)
         {
-            auto trtEntry = std::dynamic_pointer_cast<ThermalRelationshipTableEntry>(*entry);
+            auto trtEntry = std::dynamic_pointer_cast<ThermalRelationshipTableEntry>(m_entries[*row]);
             if (trtEntry)
             {
                 return trtEntry->thermalSamplingPeriod();
@@ -188,18 +204,37 @@ TimeSpan ThermalRelationshipTable::getSampleTimeForRelationship(UIntN target, UI
     throw dptf_exception("No match found for target and source in TRT.");
 }
 
-std::shared_ptr<XmlNode> ThermalRelationshipTable::getXml()
+void ThermalRelationshipTable::onParticipantIndexesChanged(void)
+{
+    buildEntriesSortedByInfluence();
+}
+
+void ThermalRelationshipTable::buildEntriesSortedByInfluence(void)
+{
+    m_entriesForTargetSortedByInfluence.clear();
+    auto targets = getAllTargetIndexes();
+    for (auto target = targets.begin(); target != targets.end(); ++target)
+    {
+        auto entries = getEntriesForTarget(*target);
+        std::stable_sort(entries.begin(), entries.end(), compareEntriesOnInfluence);
+        m_entriesForTargetSortedByInfluence[*target] = entries;
+    }
+}
+
+void ThermalRelationshipTable::writeStatus(StatusWriter& writer)
 {
-    auto status = XmlNode::createWrapperElement("trt");
+    writer.beginElement("trt");
+    writer.beginList("trt_entry");
     for (auto entry = m_entries.begin(); entry != m_entries.end(); entry++)
     {
         auto trtEntry = std::dynamic_pointer_cast<ThermalRelationshipTableEntry>(*entry);
         if (trtEntry)
         {
-            status->addChild(trtEntry->getXml());
+            trtEntry->writeStatus(writer);
         }
     }
-    return status;
+    writer.endList();
+    writer.endElement();
 }
 
 UIntN ThermalRelationshipTable::countTrtRows(UInt32 size, UInt8* data)
@@ -35,16 +35,30 @@ public:
     DptfBuffer toTrtBinary(void) const;
 
     std::vector<std::shared_ptr<ThermalRelationshipTableEntry>> getEntriesForTarget(UIntN targetIndex);
+
+    // Entries for the target from highest to lowest thermal influence, with ties left in table order.  The lists
+    // are only rebuilt when participants are associated or disassociated.
+    const std::vector<std::shared_ptr<ThermalRelationshipTableEntry>>& getEntriesForTargetSortedByInfluence(
+        UIntN targetIndex) const;
     TimeSpan getMinimumActiveSamplePeriodForSource(UIntN sourceIndex, std::set<UIntN> activeTargets);
     TimeSpan getShortestSamplePeriodForTarget(UIntN target);
     TimeSpan getSampleTimeForRelationship(UIntN target, UIntN source) const;
 
-    std::shared_ptr<XmlNode> getXml();
+    void writeStatus(StatusWriter& writer);
     Bool operator==(const ThermalRelationshipTable& trt) const;
     Bool operator!=(const ThermalRelationshipTable& trt) const;
     
+protected:
+
+    virtual void onParticipantIndexesChanged(void) override;
+
 private:
 
+    std::unordered_map<UIntN, std::vector<std::shared_ptr<ThermalRelationshipTableEntry>>>
+        m_entriesForTargetSortedByInfluence;
+    std::vector<std::shared_ptr<ThermalRelationshipTableEntry>> m_noEntries;
+
+    void buildEntriesSortedByInfluence(void);
     static UIntN countTrtRows(UInt32 size, UInt8* data);
     static void throwIfOutOfRange(IntN bytesRemaining);
 };
\ No newline at end of file
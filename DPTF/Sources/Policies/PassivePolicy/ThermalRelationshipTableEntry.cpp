@@ -41,16 +41,16 @@ const TimeSpan& ThermalRelationshipTableEntry::thermalSamplingPeriod() const
     return m_thermalSamplingPeriod;
 }
 
-std::shared_ptr<XmlNode> ThermalRelationshipTableEntry::getXml()
+void ThermalRelationshipTableEntry::writeStatus(StatusWriter& writer)
 {
-    auto entry = XmlNode::createWrapperElement("trt_entry");
-    entry->addChild(XmlNode::createDataElement("target_index", friendlyValue(getTargetDeviceIndex())));
-    entry->addChild(XmlNode::createDataElement("target_acpi_scope", getTargetDeviceScope()));
-    entry->addChild(XmlNode::createDataElement("source_index", friendlyValue(getSourceDeviceIndex())));
-    entry->addChild(XmlNode::createDataElement("source_acpi_scope", getSourceDeviceScope()));
-    entry->addChild(XmlNode::createDataElement("influence", friendlyValue(m_thermalInfluence)));
-    entry->addChild(XmlNode::createDataElement("sampling_period", m_thermalSamplingPeriod.toStringSeconds()));
-    return entry;
+    writer.beginElement("trt_entry");
+    writer.addDataElement("target_index", friendlyValue(getTargetDeviceIndex()));
+    writer.addDataElement("target_acpi_scope", getTargetDeviceScope());
+    writer.addDataElement("source_index", friendlyValue(getSourceDeviceIndex()));
+    writer.addDataElement("source_acpi_scope", getSourceDeviceScope());
+    writer.addDataElement("influence", friendlyValue(m_thermalInfluence));
+    writer.addDataElement("sampling_period", m_thermalSamplingPeriod.toStringSeconds());
+    writer.endElement();
 }
 
 Bool ThermalRelationshipTableEntry::isSameAs(const ThermalRelationshipTableEntry& trtEntry) const
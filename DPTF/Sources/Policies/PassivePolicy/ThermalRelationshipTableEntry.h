@@ -35,7 +35,7 @@ public:
     const UInt32& thermalInfluence() const;
     const TimeSpan& thermalSamplingPeriod() const;
 
-    std::shared_ptr<XmlNode> getXml();
+    void writeStatus(StatusWriter& writer);
     Bool isSameAs(const ThermalRelationshipTableEntry& trtEntry) const;
     Bool operator==(const ThermalRelationshipTableEntry& trtEntry) const;
 
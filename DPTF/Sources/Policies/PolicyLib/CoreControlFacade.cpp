@@ -50,7 +50,7 @@ void CoreControlFacade::initializeControlsIfNeeded()
 {
     if (supportsCoreControls())
     {
-        m_policyServices.messageLogging->writeMessageDebug(
+        DPTF_LOG_MESSAGE_DEBUG(m_policyServices.messageLogging,
             PolicyMessage(FLF, "Core control initialization started."));
         CoreControlDynamicCaps caps = getDynamicCapabilities();
         if (m_controlsHaveBeenInitialized == false)
@@ -65,18 +65,18 @@ void CoreControlFacade::initializeControlsIfNeeded()
             UIntN lastSetActiveCores = m_lastSetCoreControlStatus.getNumActiveLogicalProcessors();
             if (lastSetActiveCores > maxActiveCores)
             {
-                m_policyServices.messageLogging->writeMessageDebug(
+                DPTF_LOG_MESSAGE_DEBUG(m_policyServices.messageLogging,
                     PolicyMessage(FLF, "Adjusting active core limit to minimum allowed."));
                 setActiveCoreControl(CoreControlStatus(maxActiveCores));
             }
             else if (lastSetActiveCores < minActiveCores)
             {
-                m_policyServices.messageLogging->writeMessageDebug(
+                DPTF_LOG_MESSAGE_DEBUG(m_policyServices.messageLogging,
                     PolicyMessage(FLF, "Adjusting active core limit to minimum allowed."));
                 setActiveCoreControl(CoreControlStatus(minActiveCores));
             }
         }
-        m_policyServices.messageLogging->writeMessageDebug(
+        DPTF_LOG_MESSAGE_DEBUG(m_policyServices.messageLogging,
             PolicyMessage(FLF, "Core control initialization finished."));
     }
 }
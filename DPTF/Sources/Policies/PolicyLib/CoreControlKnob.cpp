@@ -42,10 +42,13 @@ void CoreControlKnob::limit(UIntN target)
     {
         try
         {
-            stringstream messageBefore;
-            messageBefore << "Calculating request to limit active cores.";
-            getPolicyServices().messageLogging->writeMessageDebug(
-                PolicyMessage(FLF, messageBefore.str(), getParticipantIndex(), getDomainIndex()));
+            if (DPTF_IS_DEBUG_LOGGING_ENABLED(getPolicyServices().messageLogging))
+            {
+                stringstream messageBefore;
+                messageBefore << "Calculating request to limit active cores.";
+                getPolicyServices().messageLogging->writeMessageDebug(
+                    PolicyMessage(FLF, messageBefore.str(), getParticipantIndex(), getDomainIndex()));
+            }
 
             Percentage stepSize = m_coreControl->getPreferences().getStepSize();
             UIntN totalCores = m_coreControl->getStaticCapabilities().getTotalLogicalProcessors();
@@ -55,14 +58,17 @@ void CoreControlKnob::limit(UIntN target)
             UIntN nextActiveCores = std::max((int)currentActiveCores - (int)stepAmount, (int)minActiveCores);
             m_requests[target] = nextActiveCores;
 
-            stringstream messageAfter;
-            messageAfter << "Requesting to limit active cores to" << nextActiveCores << ".";
-            getPolicyServices().messageLogging->writeMessageDebug(
-                PolicyMessage(FLF, messageAfter.str(), getParticipantIndex(), getDomainIndex()));
+            if (DPTF_IS_DEBUG_LOGGING_ENABLED(getPolicyServices().messageLogging))
+            {
+                stringstream messageAfter;
+                messageAfter << "Requesting to limit active cores to" << nextActiveCores << ".";
+                getPolicyServices().messageLogging->writeMessageDebug(
+                    PolicyMessage(FLF, messageAfter.str(), getParticipantIndex(), getDomainIndex()));
+            }
         }
         catch (std::exception& ex)
         {
-            getPolicyServices().messageLogging->writeMessageDebug(
+            DPTF_LOG_MESSAGE_DEBUG(getPolicyServices().messageLogging,
                 PolicyMessage(FLF, ex.what(), getParticipantIndex(), getDomainIndex()));
             throw ex;
         }
@@ -75,10 +81,13 @@ void CoreControlKnob::unlimit(UIntN target)
     {
         try
         {
-            stringstream messageBefore;
-            messageBefore << "Calculating request to unlimit active cores.";
-            getPolicyServices().messageLogging->writeMessageDebug(
-                PolicyMessage(FLF, messageBefore.str(), getParticipantIndex(), getDomainIndex()));
+            if (DPTF_IS_DEBUG_LOGGING_ENABLED(getPolicyServices().messageLogging))
+            {
+                stringstream messageBefore;
+                messageBefore << "Calculating request to unlimit active cores.";
+                getPolicyServices().messageLogging->writeMessageDebug(
+                    PolicyMessage(FLF, messageBefore.str(), getParticipantIndex(), getDomainIndex()));
+            }
 
             Percentage stepSize = m_coreControl->getPreferences().getStepSize();
             UIntN totalCores = m_coreControl->getStaticCapabilities().getTotalLogicalProcessors();
@@ -88,14 +97,17 @@ void CoreControlKnob::unlimit(UIntN target)
             UIntN nextActiveCores = std::min((int)currentActiveCores + (int)stepAmount, (int)maxActiveCores);
             m_requests[target] = nextActiveCores;
 
-            stringstream messageAfter;
-            messageAfter << "Requesting to unlimit active cores to" << nextActiveCores << ".";
-            getPolicyServices().messageLogging->writeMessageDebug(
-                PolicyMessage(FLF, messageAfter.str(), getParticipantIndex(), getDomainIndex()));
+            if (DPTF_IS_DEBUG_LOGGING_ENABLED(getPolicyServices().messageLogging))
+            {
+                stringstream messageAfter;
+                messageAfter << "Requesting to unlimit active cores to" << nextActiveCores << ".";
+                getPolicyServices().messageLogging->writeMessageDebug(
+                    PolicyMessage(FLF, messageAfter.str(), getParticipantIndex(), getDomainIndex()));
+            }
         }
         catch (std::exception& ex)
         {
-            getPolicyServices().messageLogging->writeMessageDebug(
+            DPTF_LOG_MESSAGE_DEBUG(getPolicyServices().messageLogging,
                 PolicyMessage(FLF, ex.what(), getParticipantIndex(), getDomainIndex()));
             throw ex;
         }
@@ -169,17 +181,23 @@ Bool CoreControlKnob::commitSetting()
             UIntN nextActiveCores = snapToCapabilitiesBounds(findLowestActiveCoresRequest());
             if (m_coreControl->getStatus().getNumActiveLogicalProcessors() != nextActiveCores)
             {
-                stringstream messageBefore;
-                messageBefore << "Attempting to change active core limit to " << nextActiveCores << ".";
-                getPolicyServices().messageLogging->writeMessageDebug(
-                    PolicyMessage(FLF, messageBefore.str(), getParticipantIndex(), getDomainIndex()));
+                if (DPTF_IS_DEBUG_LOGGING_ENABLED(getPolicyServices().messageLogging))
+                {
+                    stringstream messageBefore;
+                    messageBefore << "Attempting to change active core limit to " << nextActiveCores << ".";
+                    getPolicyServices().messageLogging->writeMessageDebug(
+                        PolicyMessage(FLF, messageBefore.str(), getParticipantIndex(), getDomainIndex()));
+                }
 
                 m_coreControl->setActiveCoreControl(CoreControlStatus(nextActiveCores));
 
-                stringstream messageAfter;
-                messageAfter << "Changed active core limit to " << nextActiveCores << ".";
-                getPolicyServices().messageLogging->writeMessageDebug(
-                    PolicyMessage(FLF, messageAfter.str(), getParticipantIndex(), getDomainIndex()));
+                if (DPTF_IS_DEBUG_LOGGING_ENABLED(getPolicyServices().messageLogging))
+                {
+                    stringstream messageAfter;
+                    messageAfter << "Changed active core limit to " << nextActiveCores << ".";
+                    getPolicyServices().messageLogging->writeMessageDebug(
+                        PolicyMessage(FLF, messageAfter.str(), getParticipantIndex(), getDomainIndex()));
+                }
                 return true;
             }
             else
@@ -194,7 +212,7 @@ Bool CoreControlKnob::commitSetting()
     }
     catch (std::exception& ex)
     {
-        getPolicyServices().messageLogging->writeMessageDebug(
+        DPTF_LOG_MESSAGE_DEBUG(getPolicyServices().messageLogging,
             PolicyMessage(FLF, ex.what(), getParticipantIndex(), getDomainIndex()));
         throw ex;
     }
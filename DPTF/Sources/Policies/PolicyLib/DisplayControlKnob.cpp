@@ -41,22 +41,28 @@ void DisplayControlKnob::limit(UIntN target)
     {
         try
         {
-            stringstream messageBefore;
-            messageBefore << "Calculating request to limit display brightness.";
-            getPolicyServices().messageLogging->writeMessageDebug(
-                PolicyMessage(FLF, messageBefore.str(), getParticipantIndex(), getDomainIndex()));
+            if (DPTF_IS_DEBUG_LOGGING_ENABLED(getPolicyServices().messageLogging))
+            {
+                stringstream messageBefore;
+                messageBefore << "Calculating request to limit display brightness.";
+                getPolicyServices().messageLogging->writeMessageDebug(
+                    PolicyMessage(FLF, messageBefore.str(), getParticipantIndex(), getDomainIndex()));
+            }
 
             UIntN nextControlIndex = calculateNextIndex(target);
             m_requests[target] = nextControlIndex;
 
-            stringstream messageAfter;
-            messageAfter << "Requesting to limit display brightness to " << nextControlIndex << ".";
-            getPolicyServices().messageLogging->writeMessageDebug(
-                PolicyMessage(FLF, messageAfter.str(), getParticipantIndex(), getDomainIndex()));
+            if (DPTF_IS_DEBUG_LOGGING_ENABLED(getPolicyServices().messageLogging))
+            {
+                stringstream messageAfter;
+                messageAfter << "Requesting to limit display brightness to " << nextControlIndex << ".";
+                getPolicyServices().messageLogging->writeMessageDebug(
+                    PolicyMessage(FLF, messageAfter.str(), getParticipantIndex(), getDomainIndex()));
+            }
         }
         catch (std::exception& ex)
         {
-            getPolicyServices().messageLogging->writeMessageDebug(PolicyMessage(FLF, ex.what(), getParticipantIndex(), getDomainIndex()));
+            DPTF_LOG_MESSAGE_DEBUG(getPolicyServices().messageLogging, PolicyMessage(FLF, ex.what(), getParticipantIndex(), getDomainIndex()));
             throw ex;
         }
     }
@@ -68,10 +74,13 @@ void DisplayControlKnob::unlimit(UIntN target)
     {
         try
         {
-            stringstream messageBefore;
-            messageBefore << "Calculating request to unlimit display brightness.";
-            getPolicyServices().messageLogging->writeMessageDebug(
-                PolicyMessage(FLF, messageBefore.str(), getParticipantIndex(), getDomainIndex()));
+            if (DPTF_IS_DEBUG_LOGGING_ENABLED(getPolicyServices().messageLogging))
+            {
+                stringstream messageBefore;
+                messageBefore << "Calculating request to unlimit display brightness.";
+                getPolicyServices().messageLogging->writeMessageDebug(
+                    PolicyMessage(FLF, messageBefore.str(), getParticipantIndex(), getDomainIndex()));
+            }
 
             UIntN currentControlIndex = getTargetRequest(target);
             UIntN upperLimit = m_displayControl->getCapabilities().getCurrentUpperLimit();
@@ -89,14 +98,17 @@ void DisplayControlKnob::unlimit(UIntN target)
             }
             m_requests[target] = nextControlIndex;
 
-            stringstream messageAfter;
-            messageAfter << "Requesting to unlimit display brightness to " << nextControlIndex << ".";
-            getPolicyServices().messageLogging->writeMessageDebug(
-                PolicyMessage(FLF, messageAfter.str(), getParticipantIndex(), getDomainIndex()));
+            if (DPTF_IS_DEBUG_LOGGING_ENABLED(getPolicyServices().messageLogging))
+            {
+                stringstream messageAfter;
+                messageAfter << "Requesting to unlimit display brightness to " << nextControlIndex << ".";
+                getPolicyServices().messageLogging->writeMessageDebug(
+                    PolicyMessage(FLF, messageAfter.str(), getParticipantIndex(), getDomainIndex()));
+            }
         }
         catch (std::exception& ex)
         {
-            getPolicyServices().messageLogging->writeMessageDebug(PolicyMessage(FLF, ex.what(), getParticipantIndex(), getDomainIndex()));
+            DPTF_LOG_MESSAGE_DEBUG(getPolicyServices().messageLogging, PolicyMessage(FLF, ex.what(), getParticipantIndex(), getDomainIndex()));
             throw ex;
         }
     }
@@ -164,10 +176,13 @@ Bool DisplayControlKnob::commitSetting()
             auto currentValue = m_displayControl->getStatus().getBrightnessLimitIndex();
             if (currentValue != nextIndex)
             {
-                stringstream messageBefore;
-                messageBefore << "Attempting to change display brightness limit to " << nextIndex << ".";
-                getPolicyServices().messageLogging->writeMessageDebug(
-                    PolicyMessage(FLF, messageBefore.str(), getParticipantIndex(), getDomainIndex()));
+                if (DPTF_IS_DEBUG_LOGGING_ENABLED(getPolicyServices().messageLogging))
+                {
+                    stringstream messageBefore;
+                    messageBefore << "Attempting to change display brightness limit to " << nextIndex << ".";
+                    getPolicyServices().messageLogging->writeMessageDebug(
+                        PolicyMessage(FLF, messageBefore.str(), getParticipantIndex(), getDomainIndex()));
+                }
 
                 m_displayControl->setControl(nextIndex);
                 if (m_hasBeenLimited == false)
@@ -175,10 +190,13 @@ Bool DisplayControlKnob::commitSetting()
                     m_hasBeenLimited = true;
                 }
 
-                stringstream messageAfter;
-                messageAfter << "Changed display brightness limit to " << nextIndex << ".";
-                getPolicyServices().messageLogging->writeMessageDebug(
-                    PolicyMessage(FLF, messageAfter.str(), getParticipantIndex(), getDomainIndex()));
+                if (DPTF_IS_DEBUG_LOGGING_ENABLED(getPolicyServices().messageLogging))
+                {
+                    stringstream messageAfter;
+                    messageAfter << "Changed display brightness limit to " << nextIndex << ".";
+                    getPolicyServices().messageLogging->writeMessageDebug(
+                        PolicyMessage(FLF, messageAfter.str(), getParticipantIndex(), getDomainIndex()));
+                }
                 return true;
             }
 
@@ -196,7 +214,7 @@ Bool DisplayControlKnob::commitSetting()
     }
     catch (std::exception& ex)
     {
-        getPolicyServices().messageLogging->writeMessageDebug(
+        DPTF_LOG_MESSAGE_DEBUG(getPolicyServices().messageLogging,
             PolicyMessage(FLF, ex.what(), getParticipantIndex(), getDomainIndex()));
         throw ex;
     }
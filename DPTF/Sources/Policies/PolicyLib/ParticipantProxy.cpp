@@ -128,7 +128,7 @@ void ParticipantProxy::setTemperatureThresholds(const Temperature& lowerBound, c
     {
         if (m_domains[0]->getTemperatureControl()->supportsTemperatureThresholds())
         {
-            m_policyServices.messageLogging->writeMessageDebug(PolicyMessage(FLF,
+            DPTF_LOG_MESSAGE_DEBUG(m_policyServices.messageLogging, PolicyMessage(FLF,
                 "Setting thresholds to " + lowerBound.toString() + ":" + upperBound.toString() + "."));
             m_domains[0]->getTemperatureControl()->setTemperatureNotificationThresholds(lowerBound, upperBound);
         }
@@ -212,7 +212,7 @@ void ParticipantProxy::setThresholdCrossed(const Temperature& temperature, const
 {
     m_lastThresholdCrossedTemperature = temperature;
     m_timeOfLastThresholdCrossed = timestamp;
-    m_policyServices.messageLogging->writeMessageDebug(PolicyMessage(FLF,
+    DPTF_LOG_MESSAGE_DEBUG(m_policyServices.messageLogging, PolicyMessage(FLF,
         "Temperature threshold crossed for participant with temperature " + temperature.toString() + ".", getIndex()));
 }
 
@@ -272,61 +272,52 @@ std::shared_ptr<XmlNode> ParticipantProxy::getXmlForActiveTripPoints()
     return participant;
 }
 
-std::shared_ptr<XmlNode> ParticipantProxy::getXmlForPassiveTripPoints()
+void ParticipantProxy::writePassiveTripPointStatus(StatusWriter& writer)
 {
-    auto participant = XmlNode::createWrapperElement("participant");
-    participant->addChild(XmlNode::createDataElement("index", 
-        friendlyValue(m_index)));
-    participant->addChild(XmlNode::createDataElement("name", 
-        m_participantProperties.getParticipantProperties().getName()));
+    writer.beginElement("participant");
+    writer.addDataElement("index", friendlyValue(m_index));
+    writer.addDataElement("name", m_participantProperties.getParticipantProperties().getName());
     if (m_domains.find(0) != m_domains.end())
     {
-        participant->addChild(XmlNode::createDataElement("temperature",
-            getTemperatureForStatus(getDomain(0)).toString()));
+        writer.addDataElement("temperature", getTemperatureForStatus(getDomain(0)).toString());
     }
     else
     {
-        participant->addChild(XmlNode::createDataElement("temperature", "Error"));
+        writer.addDataElement("temperature", "Error");
     }
-    participant->addChild(getTemperatureThresholdsForStatus().getXml());
-    participant->addChild(m_passiveTripPointProperty.getXml());
-    return participant;
+    getTemperatureThresholdsForStatus().getXml()->write(writer);
+    m_passiveTripPointProperty.getXml()->write(writer);
+    writer.endElement();
 }
 
-std::shared_ptr<XmlNode> ParticipantProxy::getXmlForTripPointStatistics()
+void ParticipantProxy::writeTripPointStatistics(StatusWriter& writer)
 {
-    auto stats = XmlNode::createWrapperElement("participant_trip_point_statistics");
-    stats->addChild
-        (XmlNode::createDataElement("participant_index", friendlyValue(m_index)));
-    stats->addChild(
-        XmlNode::createDataElement("participant_name", m_participantProperties.getParticipantProperties().getName()));
+    writer.beginElement("participant_trip_point_statistics");
+    writer.addDataElement("participant_index", friendlyValue(m_index));
+    writer.addDataElement("participant_name", m_participantProperties.getParticipantProperties().getName());
     if (m_domains.find(0) != m_domains.end())
     {
         Bool supportsTripPoints = getDomain(0)->getTemperatureControl()->supportsTemperatureControls();
-        stats->addChild(
-            XmlNode::createDataElement("supports_trip_points", friendlyValue(supportsTripPoints)));
+        writer.addDataElement("supports_trip_points", friendlyValue(supportsTripPoints));
     }
     else
     {
-        stats->addChild(
-            XmlNode::createDataElement("supports_trip_points", friendlyValue(false)));
+        writer.addDataElement("supports_trip_points", friendlyValue(false));
     }
 
     if (m_timeOfLastThresholdCrossed.isInvalid() || m_timeOfLastThresholdCrossed.asMillisecondsInt() == 0)
     {
-        stats->addChild(XmlNode::createDataElement("time_since_last_trip", Constants::InvalidString));
+        writer.addDataElement("time_since_last_trip", Constants::InvalidString);
     }
     else
     {
         auto timeSinceLastTrip = m_time->getCurrentTime() - m_timeOfLastThresholdCrossed;
-        stats->addChild(XmlNode::createDataElement("time_since_last_trip", timeSinceLastTrip.toStringSeconds()));
+        writer.addDataElement("time_since_last_trip", timeSinceLastTrip.toStringSeconds());
     }
 
-    stats->addChild(
-        XmlNode::createDataElement(
-            "temperature_of_last_trip", m_lastThresholdCrossedTemperature.toString()));
+    writer.addDataElement("temperature_of_last_trip", m_lastThresholdCrossedTemperature.toString());
 
-    return stats;
+    writer.endElement();
 }
 
 std::shared_ptr<XmlNode> ParticipantProxy::getXmlForConfigTdpLevel()
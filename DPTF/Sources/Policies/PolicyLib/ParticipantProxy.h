@@ -61,7 +61,7 @@ public:
     virtual PassiveTripPointsCachedProperty& getPassiveTripPointProperty() override;
     virtual std::shared_ptr<XmlNode> getXmlForCriticalTripPoints() override;
     virtual std::shared_ptr<XmlNode> getXmlForActiveTripPoints() override;
-    virtual std::shared_ptr<XmlNode> getXmlForPassiveTripPoints() override;
+    virtual void writePassiveTripPointStatus(StatusWriter& writer) override;
 
     // temperatures
     virtual Bool supportsTemperatureInterface()  override;
@@ -69,7 +69,7 @@ public:
     virtual void setTemperatureThresholds(const Temperature& lowerBound, const Temperature& upperBound) override;
     virtual TemperatureThresholds getTemperatureThresholds() override;
     virtual void notifyPlatformOfDeviceTemperature(const Temperature& currentTemperature) override;
-    virtual std::shared_ptr<XmlNode> getXmlForTripPointStatistics() override;
+    virtual void writeTripPointStatistics(StatusWriter& writer) override;
     virtual void refreshHysteresis() override;
     virtual void refreshVirtualSensorTables() override;
 
@@ -66,7 +66,7 @@ public:
 
     virtual std::shared_ptr<XmlNode> getXmlForCriticalTripPoints() = 0;
     virtual std::shared_ptr<XmlNode> getXmlForActiveTripPoints() = 0;
-    virtual std::shared_ptr<XmlNode> getXmlForPassiveTripPoints() = 0;
+    virtual void writePassiveTripPointStatus(StatusWriter& writer) = 0;
     virtual std::shared_ptr<XmlNode> getXmlForConfigTdpLevel() = 0;
-    virtual std::shared_ptr<XmlNode> getXmlForTripPointStatistics() = 0;
+    virtual void writeTripPointStatistics(StatusWriter& writer) = 0;
 };
\ No newline at end of file
@@ -73,14 +73,16 @@ void ParticipantTracker::setPolicyServices(const PolicyServicesInterfaceContaine
     m_policyServices = policyServices;
 }
 
-std::shared_ptr<XmlNode> ParticipantTracker::getXmlForTripPointStatistics()
+void ParticipantTracker::writeTripPointStatistics(StatusWriter& writer)
 {
-    auto allStatus = XmlNode::createWrapperElement("trip_point_statistics");
+    writer.beginElement("trip_point_statistics");
+    writer.beginList("participant_trip_point_statistics");
     for (auto item = m_trackedParticipants.begin(); item != m_trackedParticipants.end(); item++)
     {
-        allStatus->addChild(item->second.getXmlForTripPointStatistics());
+        item->second.writeTripPointStatistics(writer);
     }
-    return allStatus;
+    writer.endList();
+    writer.endElement();
 }
 
 std::shared_ptr<DomainProxyInterface> ParticipantTracker::findDomain(DomainType::Type domainType)
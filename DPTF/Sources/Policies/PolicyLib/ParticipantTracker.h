@@ -40,7 +40,7 @@ public:
     virtual void setPolicyServices(const PolicyServicesInterfaceContainer &policyServices) override;
     virtual void setTimeServiceObject(std::shared_ptr<TimeInterface> time) override;
 
-    virtual std::shared_ptr<XmlNode> getXmlForTripPointStatistics() override;
+    virtual void writeTripPointStatistics(StatusWriter& writer) override;
 
     virtual std::shared_ptr<DomainProxyInterface> findDomain(DomainType::Type domainType);
 
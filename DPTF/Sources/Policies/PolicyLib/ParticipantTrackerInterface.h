@@ -38,6 +38,6 @@ public:
     virtual std::vector<UIntN> getAllTrackedIndexes() const = 0;
     virtual void setPolicyServices(const PolicyServicesInterfaceContainer &policyServices) = 0;
     virtual void setTimeServiceObject(std::shared_ptr<TimeInterface> time) = 0;
-    virtual std::shared_ptr<XmlNode> getXmlForTripPointStatistics() = 0;
+    virtual void writeTripPointStatistics(StatusWriter& writer) = 0;
 
 };
\ No newline at end of file
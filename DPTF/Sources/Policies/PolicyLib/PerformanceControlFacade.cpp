@@ -135,7 +135,7 @@ void PerformanceControlFacade::initializeControlsIfNeeded()
 {
     if (supportsPerformanceControls())
     {
-        m_policyServices.messageLogging->writeMessageDebug(
+        DPTF_LOG_MESSAGE_DEBUG(m_policyServices.messageLogging,
             PolicyMessage(FLF, "Performance control initialization started."));
         const PerformanceControlDynamicCaps& caps = getDynamicCapabilities();
         if (m_controlsHaveBeenInitialized == false)
@@ -150,18 +150,18 @@ void PerformanceControlFacade::initializeControlsIfNeeded()
             UIntN lastLimitSet = m_lastIssuedPerformanceControlIndex;
             if (lastLimitSet < upperLimit)
             {
-                m_policyServices.messageLogging->writeMessageDebug(
+                DPTF_LOG_MESSAGE_DEBUG(m_policyServices.messageLogging,
                     PolicyMessage(FLF, "Adjusting performance limit to maximum allowed."));
                 setControl(upperLimit);
             }
             else if (lastLimitSet > lowerLimit)
             {
-                m_policyServices.messageLogging->writeMessageDebug(
+                DPTF_LOG_MESSAGE_DEBUG(m_policyServices.messageLogging,
                     PolicyMessage(FLF, "Adjusting performance limit to minimum allowed."));
                 setControl(lowerLimit);
             }
         }
-        m_policyServices.messageLogging->writeMessageDebug(
+        DPTF_LOG_MESSAGE_DEBUG(m_policyServices.messageLogging,
             PolicyMessage(FLF, "Performance control initialization finished."));
     }
 }
@@ -46,10 +46,13 @@ void PerformanceControlKnob::limit(UIntN target)
     {
         try
         {
-            stringstream messageBefore;
-            messageBefore << "Calculating request to limit " << controlTypeToString(m_controlType) << " controls.";
-            getPolicyServices().messageLogging->writeMessageDebug(
-                PolicyMessage(FLF, messageBefore.str(), getParticipantIndex(), getDomainIndex()));
+            if (DPTF_IS_DEBUG_LOGGING_ENABLED(getPolicyServices().messageLogging))
+            {
+                stringstream messageBefore;
+                messageBefore << "Calculating request to limit " << controlTypeToString(m_controlType) << " controls.";
+                getPolicyServices().messageLogging->writeMessageDebug(
+                    PolicyMessage(FLF, messageBefore.str(), getParticipantIndex(), getDomainIndex()));
+            }
 
             const PerformanceControlDynamicCaps& dynamicCapabilities = m_performanceControl->getDynamicCapabilities();
             UIntN lowerLimitIndex = dynamicCapabilities.getCurrentLowerLimitIndex();
@@ -58,15 +61,18 @@ void PerformanceControlKnob::limit(UIntN target)
             UIntN nextIndex = std::min(currentIndex + 1, lowerLimitIndex);
             (*m_requests)[target] = nextIndex;
 
-            stringstream messageAfter;
-            messageAfter << "Requesting to limit " << controlTypeToString(m_controlType) << " controls to"
-                << nextIndex << ".";
-            getPolicyServices().messageLogging->writeMessageDebug(
-                PolicyMessage(FLF, messageAfter.str(), getParticipantIndex(), getDomainIndex()));
+            if (DPTF_IS_DEBUG_LOGGING_ENABLED(getPolicyServices().messageLogging))
+            {
+                stringstream messageAfter;
+                messageAfter << "Requesting to limit " << controlTypeToString(m_controlType) << " controls to"
+                    << nextIndex << ".";
+                getPolicyServices().messageLogging->writeMessageDebug(
+                    PolicyMessage(FLF, messageAfter.str(), getParticipantIndex(), getDomainIndex()));
+            }
         }
         catch (std::exception& ex)
         {
-            getPolicyServices().messageLogging->writeMessageDebug(
+            DPTF_LOG_MESSAGE_DEBUG(getPolicyServices().messageLogging,
                 PolicyMessage(FLF, ex.what(), getParticipantIndex(), getDomainIndex()));
             throw ex;
         }
@@ -79,10 +85,13 @@ void PerformanceControlKnob::unlimit(UIntN target)
     {
         try
         {
-            stringstream messageBefore;
-            messageBefore << "Calculating request to unlimit " << controlTypeToString(m_controlType) << " controls.";
-            getPolicyServices().messageLogging->writeMessageDebug(
-                PolicyMessage(FLF, messageBefore.str(), getParticipantIndex(), getDomainIndex()));
+            if (DPTF_IS_DEBUG_LOGGING_ENABLED(getPolicyServices().messageLogging))
+            {
+                stringstream messageBefore;
+                messageBefore << "Calculating request to unlimit " << controlTypeToString(m_controlType) << " controls.";
+                getPolicyServices().messageLogging->writeMessageDebug(
+                    PolicyMessage(FLF, messageBefore.str(), getParticipantIndex(), getDomainIndex()));
+            }
 
             const PerformanceControlDynamicCaps& dynamicCapabilities = m_performanceControl->getDynamicCapabilities();
             UIntN lowerLimitIndex = dynamicCapabilities.getCurrentLowerLimitIndex();
@@ -91,15 +100,18 @@ void PerformanceControlKnob::unlimit(UIntN target)
             UIntN nextIndex = std::max(currentIndex - 1, upperLimitIndex);
             (*m_requests)[target] = nextIndex;
 
-            stringstream messageAfter;
-            messageAfter << "Requesting to unlimit " << controlTypeToString(m_controlType) << " controls to"
-                << nextIndex << ".";
-            getPolicyServices().messageLogging->writeMessageDebug(
-                PolicyMessage(FLF, messageAfter.str(), getParticipantIndex(), getDomainIndex()));
+            if (DPTF_IS_DEBUG_LOGGING_ENABLED(getPolicyServices().messageLogging))
+            {
+                stringstream messageAfter;
+                messageAfter << "Requesting to unlimit " << controlTypeToString(m_controlType) << " controls to"
+                    << nextIndex << ".";
+                getPolicyServices().messageLogging->writeMessageDebug(
+                    PolicyMessage(FLF, messageAfter.str(), getParticipantIndex(), getDomainIndex()));
+            }
         }
         catch (std::exception& ex)
         {
-            getPolicyServices().messageLogging->writeMessageDebug(
+            DPTF_LOG_MESSAGE_DEBUG(getPolicyServices().messageLogging,
                 PolicyMessage(FLF, ex.what(), getParticipantIndex(), getDomainIndex()));
             throw ex;
         }
@@ -255,18 +267,24 @@ Bool PerformanceControlKnob::commitSetting()
             UIntN nextIndex = snapToCapabilitiesBounds(findHighestPerformanceIndexRequest());
             if (currentIndex != nextIndex)
             {
-                stringstream messageBefore;
-                messageBefore << "Attempting to change " << controlTypeToString(m_controlType) << " limit to "
-                    << nextIndex << ".";
-                getPolicyServices().messageLogging->writeMessageDebug(
-                    PolicyMessage(FLF, messageBefore.str(), getParticipantIndex(), getDomainIndex()));
+                if (DPTF_IS_DEBUG_LOGGING_ENABLED(getPolicyServices().messageLogging))
+                {
+                    stringstream messageBefore;
+                    messageBefore << "Attempting to change " << controlTypeToString(m_controlType) << " limit to "
+                        << nextIndex << ".";
+                    getPolicyServices().messageLogging->writeMessageDebug(
+                        PolicyMessage(FLF, messageBefore.str(), getParticipantIndex(), getDomainIndex()));
+                }
 
                 m_performanceControl->setControl(nextIndex);
 
-                stringstream messageAfter;
-                messageAfter << "Changed " << controlTypeToString(m_controlType) << " limit to " << nextIndex << ".";
-                getPolicyServices().messageLogging->writeMessageDebug(
-                    PolicyMessage(FLF, messageAfter.str(), getParticipantIndex(), getDomainIndex()));
+                if (DPTF_IS_DEBUG_LOGGING_ENABLED(getPolicyServices().messageLogging))
+                {
+                    stringstream messageAfter;
+                    messageAfter << "Changed " << controlTypeToString(m_controlType) << " limit to " << nextIndex << ".";
+                    getPolicyServices().messageLogging->writeMessageDebug(
+                        PolicyMessage(FLF, messageAfter.str(), getParticipantIndex(), getDomainIndex()));
+                }
                 return true;
             }
             else
@@ -281,7 +299,7 @@ Bool PerformanceControlKnob::commitSetting()
     }
     catch (std::exception& ex)
     {
-        getPolicyServices().messageLogging->writeMessageDebug(
+        DPTF_LOG_MESSAGE_DEBUG(getPolicyServices().messageLogging,
             PolicyMessage(FLF, ex.what(), getParticipantIndex(), getDomainIndex()));
         throw ex;
     }
@@ -340,12 +358,15 @@ Bool PerformanceControlKnob::checkUtilizationIsLessThanThreshold() const
 
     if (currentUtilization.getCurrentUtilization() < m_tstateUtilizationThreshold.getCurrentUtilization())
     {
-        stringstream message;
-        message << "Cannot set T-state because utilization (" + 
-            currentUtilization.getCurrentUtilization().toString() + ") is less than the threshold (" +
-            m_tstateUtilizationThreshold.getCurrentUtilization().toString() + ").";
-        getPolicyServices().messageLogging->writeMessageDebug(
-            PolicyMessage(FLF, message.str(), getParticipantIndex(), getDomainIndex()));
+        if (DPTF_IS_DEBUG_LOGGING_ENABLED(getPolicyServices().messageLogging))
+        {
+            stringstream message;
+            message << "Cannot set T-state because utilization (" + 
+                currentUtilization.getCurrentUtilization().toString() + ") is less than the threshold (" +
+                m_tstateUtilizationThreshold.getCurrentUtilization().toString() + ").";
+            getPolicyServices().messageLogging->writeMessageDebug(
+                PolicyMessage(FLF, message.str(), getParticipantIndex(), getDomainIndex()));
+        }
         return false;
     }
     else
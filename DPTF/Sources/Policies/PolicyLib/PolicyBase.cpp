@@ -76,7 +76,7 @@ void PolicyBase::enable(void)
     takeControlOfOsc(autoNotifyPlatformOscOnEnableDisable());
     try
     {
-        m_policyServices.messageLogging->writeMessageInfo(PolicyMessage(FLF, getName() + ": Policy enable event received."));
+        DPTF_LOG_MESSAGE_INFO(m_policyServices.messageLogging, PolicyMessage(FLF, getName() + ": Policy enable event received."));
         onEnable();
         m_enabled = true;
     }
@@ -91,7 +91,7 @@ void PolicyBase::disable(void)
 {
     try
     {
-        m_policyServices.messageLogging->writeMessageInfo(
+        DPTF_LOG_MESSAGE_INFO(m_policyServices.messageLogging,
             PolicyMessage(FLF, getName() + ": Policy disable event received."));
         onDisable();
     }
@@ -108,7 +108,7 @@ void PolicyBase::disable(void)
 void PolicyBase::bindParticipant(UIntN participantIndex)
 {
     throwIfPolicyIsDisabled();
-    m_policyServices.messageLogging->writeMessageInfo(
+    DPTF_LOG_MESSAGE_INFO(m_policyServices.messageLogging,
         PolicyMessage(FLF, getName() + ": Binding participant.", participantIndex));
     onBindParticipant(participantIndex);
 }
@@ -116,7 +116,7 @@ void PolicyBase::bindParticipant(UIntN participantIndex)
 void PolicyBase::unbindParticipant(UIntN participantIndex)
 {
     throwIfPolicyIsDisabled();
-    m_policyServices.messageLogging->writeMessageInfo(
+    DPTF_LOG_MESSAGE_INFO(m_policyServices.messageLogging,
         PolicyMessage(FLF, getName() + ": Unbinding participant.", participantIndex));
     onUnbindParticipant(participantIndex);
 }
@@ -124,7 +124,7 @@ void PolicyBase::unbindParticipant(UIntN participantIndex)
 void PolicyBase::bindDomain(UIntN participantIndex, UIntN domainIndex)
 {
     throwIfPolicyIsDisabled();
-    m_policyServices.messageLogging->writeMessageInfo(
+    DPTF_LOG_MESSAGE_INFO(m_policyServices.messageLogging,
         PolicyMessage(FLF, getName() + ": Binding domain for participant.", participantIndex, domainIndex));
     onBindDomain(participantIndex, domainIndex);
 }
@@ -132,7 +132,7 @@ void PolicyBase::bindDomain(UIntN participantIndex, UIntN domainIndex)
 void PolicyBase::unbindDomain(UIntN participantIndex, UIntN domainIndex)
 {
     throwIfPolicyIsDisabled();
-    m_policyServices.messageLogging->writeMessageInfo(
+    DPTF_LOG_MESSAGE_INFO(m_policyServices.messageLogging,
         PolicyMessage(FLF, getName() + ": Unbinding domain for participant.", participantIndex, domainIndex));
     onUnbindDomain(participantIndex, domainIndex);
 }
@@ -140,7 +140,7 @@ void PolicyBase::unbindDomain(UIntN participantIndex, UIntN domainIndex)
 void PolicyBase::domainTemperatureThresholdCrossed(UIntN participantIndex)
 {
     throwIfPolicyIsDisabled();
-    m_policyServices.messageLogging->writeMessageInfo(
+    DPTF_LOG_MESSAGE_INFO(m_policyServices.messageLogging,
         PolicyMessage(FLF, getName() + ": Temperature threshold crossed for participant.", participantIndex));
     onDomainTemperatureThresholdCrossed(participantIndex);
 }
@@ -148,7 +148,7 @@ void PolicyBase::domainTemperatureThresholdCrossed(UIntN participantIndex)
 void PolicyBase::domainPowerControlCapabilityChanged(UIntN participantIndex)
 {
     throwIfPolicyIsDisabled();
-    m_policyServices.messageLogging->writeMessageInfo(
+    DPTF_LOG_MESSAGE_INFO(m_policyServices.messageLogging,
         PolicyMessage(FLF, getName() + ": Power Control Capabilities Changed for participant.", participantIndex));
     onDomainPowerControlCapabilityChanged(participantIndex);
 }
@@ -156,7 +156,7 @@ void PolicyBase::domainPowerControlCapabilityChanged(UIntN participantIndex)
 void PolicyBase::domainPerformanceControlCapabilityChanged(UIntN participantIndex)
 {
     throwIfPolicyIsDisabled();
-    m_policyServices.messageLogging->writeMessageInfo(
+    DPTF_LOG_MESSAGE_INFO(m_policyServices.messageLogging,
         PolicyMessage(FLF, getName() + ": Performance Control Capabilities Changed for participant.", participantIndex));
     onDomainPerformanceControlCapabilityChanged(participantIndex);
 }
@@ -164,7 +164,7 @@ void PolicyBase::domainPerformanceControlCapabilityChanged(UIntN participantInde
 void PolicyBase::domainPerformanceControlsChanged(UIntN participantIndex)
 {
     throwIfPolicyIsDisabled();
-    m_policyServices.messageLogging->writeMessageInfo(
+    DPTF_LOG_MESSAGE_INFO(m_policyServices.messageLogging,
         PolicyMessage(FLF, getName() + ": Performance control set changed for participant.", participantIndex));
     onDomainPerformanceControlsChanged(participantIndex);
 }
@@ -172,7 +172,7 @@ void PolicyBase::domainPerformanceControlsChanged(UIntN participantIndex)
 void PolicyBase::domainCoreControlCapabilityChanged(UIntN participantIndex)
 {
     throwIfPolicyIsDisabled();
-    m_policyServices.messageLogging->writeMessageInfo(
+    DPTF_LOG_MESSAGE_INFO(m_policyServices.messageLogging,
         PolicyMessage(FLF, getName() + ": Core control capabilities changed for participant.", participantIndex));
     onDomainCoreControlCapabilityChanged(participantIndex);
 }
@@ -180,7 +180,7 @@ void PolicyBase::domainCoreControlCapabilityChanged(UIntN participantIndex)
 void PolicyBase::domainConfigTdpCapabilityChanged(UIntN participantIndex)
 {
     throwIfPolicyIsDisabled();
-    m_policyServices.messageLogging->writeMessageInfo(
+    DPTF_LOG_MESSAGE_INFO(m_policyServices.messageLogging,
         PolicyMessage(FLF, getName() + ": Config TDP Capabilities Changed for participant.", participantIndex));
     onDomainConfigTdpCapabilityChanged(participantIndex);
 }
@@ -188,7 +188,7 @@ void PolicyBase::domainConfigTdpCapabilityChanged(UIntN participantIndex)
 void PolicyBase::domainPriorityChanged(UIntN participantIndex)
 {
     throwIfPolicyIsDisabled();
-    m_policyServices.messageLogging->writeMessageInfo(
+    DPTF_LOG_MESSAGE_INFO(m_policyServices.messageLogging,
         PolicyMessage(FLF, getName() + ": Domain priority changed for participant.", participantIndex));
     onDomainPriorityChanged(participantIndex);
 }
@@ -196,7 +196,7 @@ void PolicyBase::domainPriorityChanged(UIntN participantIndex)
 void PolicyBase::domainDisplayControlCapabilityChanged(UIntN participantIndex)
 {
     throwIfPolicyIsDisabled();
-    m_policyServices.messageLogging->writeMessageInfo(
+    DPTF_LOG_MESSAGE_INFO(m_policyServices.messageLogging,
         PolicyMessage(FLF, getName() + ": Display control capabilities changed for participant.", participantIndex));
     onDomainDisplayControlCapabilityChanged(participantIndex);
 }
@@ -204,7 +204,7 @@ void PolicyBase::domainDisplayControlCapabilityChanged(UIntN participantIndex)
 void PolicyBase::domainDisplayStatusChanged(UIntN participantIndex)
 {
     throwIfPolicyIsDisabled();
-    m_policyServices.messageLogging->writeMessageInfo(
+    DPTF_LOG_MESSAGE_INFO(m_policyServices.messageLogging,
         PolicyMessage(FLF, getName() + ": Display status changed for participant.", participantIndex));
     onDomainDisplayStatusChanged(participantIndex);
 }
@@ -213,7 +213,7 @@ void PolicyBase::domainRadioConnectionStatusChanged(UIntN participantIndex,
     RadioConnectionStatus::Type radioConnectionStatus)
 {
     throwIfPolicyIsDisabled();
-    m_policyServices.messageLogging->writeMessageInfo(
+    DPTF_LOG_MESSAGE_INFO(m_policyServices.messageLogging,
         PolicyMessage(FLF, getName() + ": Radio Connection Status Changed to " +
         RadioConnectionStatus::ToString(radioConnectionStatus) + ".", participantIndex));
     onDomainRadioConnectionStatusChanged(participantIndex, radioConnectionStatus);
@@ -222,7 +222,7 @@ void PolicyBase::domainRadioConnectionStatusChanged(UIntN participantIndex,
 void PolicyBase::domainRfProfileChanged(UIntN participantIndex)
 {
     throwIfPolicyIsDisabled();
-    m_policyServices.messageLogging->writeMessageInfo(
+    DPTF_LOG_MESSAGE_INFO(m_policyServices.messageLogging,
         PolicyMessage(FLF, getName() + ": RF Profile Changed for participant.", participantIndex));
     onDomainRfProfileChanged(participantIndex);
 }
@@ -230,7 +230,7 @@ void PolicyBase::domainRfProfileChanged(UIntN participantIndex)
 void PolicyBase::participantSpecificInfoChanged(UIntN participantIndex)
 {
     throwIfPolicyIsDisabled();
-    m_policyServices.messageLogging->writeMessageInfo(
+    DPTF_LOG_MESSAGE_INFO(m_policyServices.messageLogging,
         PolicyMessage(FLF, getName() + ": Specific info changed for participant.", participantIndex));
     onParticipantSpecificInfoChanged(participantIndex);
 }
@@ -238,7 +238,7 @@ void PolicyBase::participantSpecificInfoChanged(UIntN participantIndex)
 void PolicyBase::domainVirtualSensorCalibrationTableChanged(UIntN participantIndex)
 {
     throwIfPolicyIsDisabled();
-    m_policyServices.messageLogging->writeMessageInfo(
+    DPTF_LOG_MESSAGE_INFO(m_policyServices.messageLogging,
         PolicyMessage(FLF, getName() + ": VSCT changed for participant.", participantIndex));
     onDomainVirtualSensorCalibrationTableChanged(participantIndex);
 }
@@ -246,7 +246,7 @@ void PolicyBase::domainVirtualSensorCalibrationTableChanged(UIntN participantInd
 void PolicyBase::domainVirtualSensorPollingTableChanged(UIntN participantIndex)
 {
     throwIfPolicyIsDisabled();
-    m_policyServices.messageLogging->writeMessageInfo(
+    DPTF_LOG_MESSAGE_INFO(m_policyServices.messageLogging,
         PolicyMessage(FLF, getName() + ": VSPT changed for participant.", participantIndex));
     onDomainVirtualSensorPollingTableChanged(participantIndex);
 }
@@ -254,7 +254,7 @@ void PolicyBase::domainVirtualSensorPollingTableChanged(UIntN participantIndex)
 void PolicyBase::domainVirtualSensorRecalcChanged(UIntN participantIndex)
 {
     throwIfPolicyIsDisabled();
-    m_policyServices.messageLogging->writeMessageInfo(
+    DPTF_LOG_MESSAGE_INFO(m_policyServices.messageLogging,
         PolicyMessage(FLF, getName() + ": Virtual Sensor recalculation requested for participant.", participantIndex));
     onDomainVirtualSensorRecalcChanged(participantIndex);
 }
@@ -262,7 +262,7 @@ void PolicyBase::domainVirtualSensorRecalcChanged(UIntN participantIndex)
 void PolicyBase::domainBatteryStatusChanged(UIntN participantIndex)
 {
     throwIfPolicyIsDisabled();
-    m_policyServices.messageLogging->writeMessageInfo(
+    DPTF_LOG_MESSAGE_INFO(m_policyServices.messageLogging,
         PolicyMessage(FLF, getName() + ": Battery status changed for participant.", participantIndex));
     onDomainBatteryStatusChanged(participantIndex);
 }
@@ -270,7 +270,7 @@ void PolicyBase::domainBatteryStatusChanged(UIntN participantIndex)
 void PolicyBase::domainBatteryInformationChanged(UIntN participantIndex)
 {
     throwIfPolicyIsDisabled();
-    m_policyServices.messageLogging->writeMessageInfo(
+    DPTF_LOG_MESSAGE_INFO(m_policyServices.messageLogging,
         PolicyMessage(FLF, getName() + ": Battery information changed for participant.", participantIndex));
     onDomainBatteryInformationChanged(participantIndex);
 }
@@ -278,7 +278,7 @@ void PolicyBase::domainBatteryInformationChanged(UIntN participantIndex)
 void PolicyBase::domainPlatformPowerSourceChanged(UIntN participantIndex)
 {
     throwIfPolicyIsDisabled();
-    m_policyServices.messageLogging->writeMessageInfo(
+    DPTF_LOG_MESSAGE_INFO(m_policyServices.messageLogging,
         PolicyMessage(FLF, getName() + ": Platform power source changed."));
     onDomainPlatformPowerSourceChanged(participantIndex);
 }
@@ -286,7 +286,7 @@ void PolicyBase::domainPlatformPowerSourceChanged(UIntN participantIndex)
 void PolicyBase::domainAdapterPowerRatingChanged(UIntN participantIndex)
 {
     throwIfPolicyIsDisabled();
-    m_policyServices.messageLogging->writeMessageInfo(
+    DPTF_LOG_MESSAGE_INFO(m_policyServices.messageLogging,
         PolicyMessage(FLF, getName() + ": Adapter power rating changed."));
     onDomainAdapterPowerRatingChanged(participantIndex);
 }
@@ -294,7 +294,7 @@ void PolicyBase::domainAdapterPowerRatingChanged(UIntN participantIndex)
 void PolicyBase::domainChargerTypeChanged(UIntN participantIndex)
 {
     throwIfPolicyIsDisabled();
-    m_policyServices.messageLogging->writeMessageInfo(
+    DPTF_LOG_MESSAGE_INFO(m_policyServices.messageLogging,
         PolicyMessage(FLF, getName() + ": Charger type changed."));
     onDomainChargerTypeChanged(participantIndex);
 }
@@ -302,7 +302,7 @@ void PolicyBase::domainChargerTypeChanged(UIntN participantIndex)
 void PolicyBase::domainPlatformRestOfPowerChanged(UIntN participantIndex)
 {
     throwIfPolicyIsDisabled();
-    m_policyServices.messageLogging->writeMessageInfo(
+    DPTF_LOG_MESSAGE_INFO(m_policyServices.messageLogging,
         PolicyMessage(FLF, getName() + ": Platform rest of power changed."));
     onDomainPlatformRestOfPowerChanged(participantIndex);
 }
@@ -310,7 +310,7 @@ void PolicyBase::domainPlatformRestOfPowerChanged(UIntN participantIndex)
 void PolicyBase::domainACPeakPowerChanged(UIntN participantIndex)
 {
     throwIfPolicyIsDisabled();
-    m_policyServices.messageLogging->writeMessageInfo(
+    DPTF_LOG_MESSAGE_INFO(m_policyServices.messageLogging,
         PolicyMessage(FLF, getName() + ": AC peak power changed."));
     onDomainACPeakPowerChanged(participantIndex);
 }
@@ -318,7 +318,7 @@ void PolicyBase::domainACPeakPowerChanged(UIntN participantIndex)
 void PolicyBase::domainACPeakTimeWindowChanged(UIntN participantIndex)
 {
     throwIfPolicyIsDisabled();
-    m_policyServices.messageLogging->writeMessageInfo(
+    DPTF_LOG_MESSAGE_INFO(m_policyServices.messageLogging,
         PolicyMessage(FLF, getName() + ": AC peak time window changed."));
     onDomainACPeakTimeWindowChanged(participantIndex);
 }
@@ -326,7 +326,7 @@ void PolicyBase::domainACPeakTimeWindowChanged(UIntN participantIndex)
 void PolicyBase::domainMaxBatteryPowerChanged(UIntN participantIndex)
 {
     throwIfPolicyIsDisabled();
-    m_policyServices.messageLogging->writeMessageInfo(
+    DPTF_LOG_MESSAGE_INFO(m_policyServices.messageLogging,
         PolicyMessage(FLF, getName() + ": Max battery power changed."));
     onDomainMaxBatteryPowerChanged(participantIndex);
 }
@@ -334,7 +334,7 @@ void PolicyBase::domainMaxBatteryPowerChanged(UIntN participantIndex)
 void PolicyBase::domainPlatformBatterySteadyStateChanged(UIntN participantIndex)
 {
     throwIfPolicyIsDisabled();
-    m_policyServices.messageLogging->writeMessageInfo(
+    DPTF_LOG_MESSAGE_INFO(m_policyServices.messageLogging,
         PolicyMessage(FLF, getName() + ": Platform Battery Steady State changed."));
     onDomainPlatformBatterySteadyStateChanged(participantIndex);
 }
@@ -342,7 +342,7 @@ void PolicyBase::domainPlatformBatterySteadyStateChanged(UIntN participantIndex)
 void PolicyBase::activeRelationshipTableChanged(void)
 {
     throwIfPolicyIsDisabled();
-    m_policyServices.messageLogging->writeMessageInfo(
+    DPTF_LOG_MESSAGE_INFO(m_policyServices.messageLogging,
         PolicyMessage(FLF, getName() + ": Active Relationship Table changed."));
     onActiveRelationshipTableChanged();
 }
@@ -350,7 +350,7 @@ void PolicyBase::activeRelationshipTableChanged(void)
 void PolicyBase::thermalRelationshipTableChanged(void)
 {
     throwIfPolicyIsDisabled();
-    m_policyServices.messageLogging->writeMessageInfo(
+    DPTF_LOG_MESSAGE_INFO(m_policyServices.messageLogging,
         PolicyMessage(FLF, getName() + ": Thermal Relationship Table changed"));
     onThermalRelationshipTableChanged();
 }
@@ -358,7 +358,7 @@ void PolicyBase::thermalRelationshipTableChanged(void)
 void PolicyBase::adaptivePerformanceConditionsTableChanged(void)
 {
     throwIfPolicyIsDisabled();
-    m_policyServices.messageLogging->writeMessageInfo(
+    DPTF_LOG_MESSAGE_INFO(m_policyServices.messageLogging,
         PolicyMessage(FLF, getName() + ": Adaptive Performance Conditions Table changed."));
     onAdaptivePerformanceConditionsTableChanged();
 }
@@ -366,7 +366,7 @@ void PolicyBase::adaptivePerformanceConditionsTableChanged(void)
 void PolicyBase::adaptivePerformanceParticipantConditionTableChanged(void)
 {
     throwIfPolicyIsDisabled();
-    m_policyServices.messageLogging->writeMessageInfo(
+    DPTF_LOG_MESSAGE_INFO(m_policyServices.messageLogging,
         PolicyMessage(FLF, getName() + ": Adaptive Performance Participant Condition Table changed."));
     onAdaptivePerformanceParticipantConditionTableChanged();
 }
@@ -374,7 +374,7 @@ void PolicyBase::adaptivePerformanceParticipantConditionTableChanged(void)
 void PolicyBase::adaptivePerformanceActionsTableChanged(void)
 {
     throwIfPolicyIsDisabled();
-    m_policyServices.messageLogging->writeMessageInfo(
+    DPTF_LOG_MESSAGE_INFO(m_policyServices.messageLogging,
         PolicyMessage(FLF, getName() + ": Adaptive Performance Actions Table changed."));
     onAdaptivePerformanceActionsTableChanged();
 }
@@ -382,7 +382,7 @@ void PolicyBase::adaptivePerformanceActionsTableChanged(void)
 void PolicyBase::pidAlgorithmTableChanged(void)
 {
     throwIfPolicyIsDisabled();
-    m_policyServices.messageLogging->writeMessageInfo(
+    DPTF_LOG_MESSAGE_INFO(m_policyServices.messageLogging,
         PolicyMessage(FLF, getName() + ": PID Algorithm Table changed."));
     onPidAlgorithmTableChanged();
 }
@@ -390,7 +390,7 @@ void PolicyBase::pidAlgorithmTableChanged(void)
 void PolicyBase::activeControlPointRelationshipTableChanged(void)
 {
     throwIfPolicyIsDisabled();
-    m_policyServices.messageLogging->writeMessageInfo(
+    DPTF_LOG_MESSAGE_INFO(m_policyServices.messageLogging,
         PolicyMessage(FLF, getName() + ": Active Control Point Relationship Table changed."));
     onActiveControlPointRelationshipTableChanged();
 }
@@ -398,7 +398,7 @@ void PolicyBase::activeControlPointRelationshipTableChanged(void)
 void PolicyBase::connectedStandbyEntry(void)
 {
     throwIfPolicyIsDisabled();
-    m_policyServices.messageLogging->writeMessageInfo(
+    DPTF_LOG_MESSAGE_INFO(m_policyServices.messageLogging,
         PolicyMessage(FLF, getName() + ": Connected standby entry event received."));
     try
     {
@@ -418,7 +418,7 @@ void PolicyBase::connectedStandbyEntry(void)
 void PolicyBase::connectedStandbyExit(void)
 {
     throwIfPolicyIsDisabled();
-    m_policyServices.messageLogging->writeMessageInfo(
+    DPTF_LOG_MESSAGE_INFO(m_policyServices.messageLogging,
         PolicyMessage(FLF, getName() + ": Connected standby exit event received."));
     try
     {
@@ -438,7 +438,7 @@ void PolicyBase::connectedStandbyExit(void)
 void PolicyBase::suspend(void)
 {
     throwIfPolicyIsDisabled();
-    m_policyServices.messageLogging->writeMessageInfo(
+    DPTF_LOG_MESSAGE_INFO(m_policyServices.messageLogging,
         PolicyMessage(FLF, getName() + ": Policy suspend event received."));
     onSuspend();
 }
@@ -446,7 +446,7 @@ void PolicyBase::suspend(void)
 void PolicyBase::resume(void)
 {
     throwIfPolicyIsDisabled();
-    m_policyServices.messageLogging->writeMessageInfo(
+    DPTF_LOG_MESSAGE_INFO(m_policyServices.messageLogging,
         PolicyMessage(FLF, getName() + ": Policy resume event received."));
     onResume();
 }
@@ -454,7 +454,7 @@ void PolicyBase::resume(void)
 void PolicyBase::foregroundApplicationChanged(const std::string& foregroundApplicationName)
 {
     throwIfPolicyIsDisabled();
-    m_policyServices.messageLogging->writeMessageInfo(
+    DPTF_LOG_MESSAGE_INFO(m_policyServices.messageLogging,
         PolicyMessage(FLF, getName() + ": Foreground application changed to " + foregroundApplicationName + "."));
     onForegroundApplicationChanged(foregroundApplicationName);
 }
@@ -462,7 +462,7 @@ void PolicyBase::foregroundApplicationChanged(const std::string& foregroundAppli
 void PolicyBase::policyInitiatedCallback(UInt64 policyDefinedEventCode, UInt64 param1, void* param2)
 {
     throwIfPolicyIsDisabled();
-    m_policyServices.messageLogging->writeMessageInfo(
+    DPTF_LOG_MESSAGE_INFO(m_policyServices.messageLogging,
         PolicyMessage(FLF, getName() + ": Policy Initiated Callback."));
     onPolicyInitiatedCallback(policyDefinedEventCode, param1, param2);
 }
@@ -470,7 +470,7 @@ void PolicyBase::policyInitiatedCallback(UInt64 policyDefinedEventCode, UInt64 p
 void PolicyBase::operatingSystemConfigTdpLevelChanged(UIntN configTdpLevel)
 {
     throwIfPolicyIsDisabled();
-    m_policyServices.messageLogging->writeMessageInfo(
+    DPTF_LOG_MESSAGE_INFO(m_policyServices.messageLogging,
         PolicyMessage(FLF, getName() + ": Config TDP Level Changed to index "
         + StlOverride::to_string(configTdpLevel) + "."));
     onOperatingSystemConfigTdpLevelChanged(configTdpLevel);
@@ -479,7 +479,7 @@ void PolicyBase::operatingSystemConfigTdpLevelChanged(UIntN configTdpLevel)
 void PolicyBase::operatingSystemPowerSourceChanged(OsPowerSource::Type powerSource)
 {
     throwIfPolicyIsDisabled();
-    m_policyServices.messageLogging->writeMessageInfo(
+    DPTF_LOG_MESSAGE_INFO(m_policyServices.messageLogging,
         PolicyMessage(FLF, getName() + ": OS Power Source changed to " + OsPowerSource::toString(powerSource) + "."));
     onOperatingSystemPowerSourceChanged(powerSource);
 }
@@ -487,7 +487,7 @@ void PolicyBase::operatingSystemPowerSourceChanged(OsPowerSource::Type powerSour
 void PolicyBase::operatingSystemLidStateChanged(OsLidState::Type lidState)
 {
     throwIfPolicyIsDisabled();
-    m_policyServices.messageLogging->writeMessageInfo(
+    DPTF_LOG_MESSAGE_INFO(m_policyServices.messageLogging,
         PolicyMessage(FLF, getName() + ": OS Lid state changed to " + OsLidState::toString(lidState) + "."));
     onOperatingSystemLidStateChanged(lidState);
 }
@@ -495,7 +495,7 @@ void PolicyBase::operatingSystemLidStateChanged(OsLidState::Type lidState)
 void PolicyBase::operatingSystemBatteryPercentageChanged(UIntN batteryPercentage)
 {
     throwIfPolicyIsDisabled();
-    m_policyServices.messageLogging->writeMessageInfo(
+    DPTF_LOG_MESSAGE_INFO(m_policyServices.messageLogging,
         PolicyMessage(FLF, getName() + ": OS battery percentage changed to "
         + StlOverride::to_string(batteryPercentage) + "."));
     onOperatingSystemBatteryPercentageChanged(batteryPercentage);
@@ -504,7 +504,7 @@ void PolicyBase::operatingSystemBatteryPercentageChanged(UIntN batteryPercentage
 void PolicyBase::operatingSystemPowerSchemePersonalityChanged(OsPowerSchemePersonality::Type powerSchemePersosnality)
 {
     throwIfPolicyIsDisabled();
-    m_policyServices.messageLogging->writeMessageInfo(
+    DPTF_LOG_MESSAGE_INFO(m_policyServices.messageLogging,
         PolicyMessage(FLF, getName() + ": OS Power Scheme Personality changed to "
         + OsPowerSchemePersonality::toString(powerSchemePersosnality) + "."));
     onOperatingSystemPowerSchemePersonalityChanged(powerSchemePersosnality);
@@ -513,7 +513,7 @@ void PolicyBase::operatingSystemPowerSchemePersonalityChanged(OsPowerSchemePerso
 void PolicyBase::operatingSystemPlatformTypeChanged(OsPlatformType::Type platformType)
 {
     throwIfPolicyIsDisabled();
-    m_policyServices.messageLogging->writeMessageInfo(
+    DPTF_LOG_MESSAGE_INFO(m_policyServices.messageLogging,
         PolicyMessage(FLF, getName() + ": OS Platform Type changed to "
         + OsPlatformType::toString(platformType) + "."));
     onOperatingSystemPlatformTypeChanged(platformType);
@@ -522,7 +522,7 @@ void PolicyBase::operatingSystemPlatformTypeChanged(OsPlatformType::Type platfor
 void PolicyBase::operatingSystemDockModeChanged(OsDockMode::Type dockMode)
 {
     throwIfPolicyIsDisabled();
-    m_policyServices.messageLogging->writeMessageInfo(
+    DPTF_LOG_MESSAGE_INFO(m_policyServices.messageLogging,
         PolicyMessage(FLF, getName() + ": OS Dock Mode changed to " + OsDockMode::toString(dockMode) + "."));
     onOperatingSystemDockModeChanged(dockMode);
 }
@@ -530,7 +530,7 @@ void PolicyBase::operatingSystemDockModeChanged(OsDockMode::Type dockMode)
 void PolicyBase::operatingSystemEmergencyCallModeStateChanged(OnOffToggle::Type emergencyCallModeState)
 {
     throwIfPolicyIsDisabled();
-    m_policyServices.messageLogging->writeMessageInfo(
+    DPTF_LOG_MESSAGE_INFO(m_policyServices.messageLogging,
         PolicyMessage(FLF, getName() + ": OS Emergency Call Mode State changed to " + 
         OnOffToggle::toString(emergencyCallModeState) + "."));
     onOperatingSystemEmergencyCallModeChanged(emergencyCallModeState);
@@ -539,7 +539,7 @@ void PolicyBase::operatingSystemEmergencyCallModeStateChanged(OnOffToggle::Type
 void PolicyBase::operatingSystemMobileNotification(OsMobileNotificationType::Type notificationType, UIntN value)
 {
     throwIfPolicyIsDisabled();
-    m_policyServices.messageLogging->writeMessageInfo(
+    DPTF_LOG_MESSAGE_INFO(m_policyServices.messageLogging,
         PolicyMessage(FLF, getName() + ": OS Mobile Notification for " +
         OsMobileNotificationType::ToString(notificationType) + " changed to " +
         StlOverride::to_string(value) + "."));
@@ -549,7 +549,7 @@ void PolicyBase::operatingSystemMobileNotification(OsMobileNotificationType::Typ
 void PolicyBase::coolingModePolicyChanged(CoolingMode::Type coolingMode)
 {
     throwIfPolicyIsDisabled();
-    m_policyServices.messageLogging->writeMessageInfo(
+    DPTF_LOG_MESSAGE_INFO(m_policyServices.messageLogging,
         PolicyMessage(FLF, getName() + ": Cooling mode changed to " + CoolingMode::toString(coolingMode) + "."));
     onCoolingModePolicyChanged(coolingMode);
 }
@@ -557,14 +557,14 @@ void PolicyBase::coolingModePolicyChanged(CoolingMode::Type coolingMode)
 void PolicyBase::passiveTableChanged(void)
 {
     throwIfPolicyIsDisabled();
-    m_policyServices.messageLogging->writeMessageInfo(PolicyMessage(FLF, getName() + ": Passive Table changed."));
+    DPTF_LOG_MESSAGE_INFO(m_policyServices.messageLogging, PolicyMessage(FLF, getName() + ": Passive Table changed."));
     onPassiveTableChanged();
 }
 
 void PolicyBase::sensorOrientationChanged(SensorOrientation::Type sensorOrientation)
 {
     throwIfPolicyIsDisabled();
-    m_policyServices.messageLogging->writeMessageInfo(
+    DPTF_LOG_MESSAGE_INFO(m_policyServices.messageLogging,
         PolicyMessage(FLF, getName() + ": Sensor orientation changed to "
         + SensorOrientation::toString(sensorOrientation) + "."));
     onSensorOrientationChanged(sensorOrientation);
@@ -573,7 +573,7 @@ void PolicyBase::sensorOrientationChanged(SensorOrientation::Type sensorOrientat
 void PolicyBase::sensorSpatialOrientationChanged(SensorSpatialOrientation::Type sensorSpatialOrientation)
 {
     throwIfPolicyIsDisabled();
-    m_policyServices.messageLogging->writeMessageInfo(
+    DPTF_LOG_MESSAGE_INFO(m_policyServices.messageLogging,
         PolicyMessage(FLF, getName() + ": Sensor spatial orientation changed to "
         + SensorSpatialOrientation::toString(sensorSpatialOrientation) + "."));
     onSensorSpatialOrientationChanged(sensorSpatialOrientation);
@@ -582,7 +582,7 @@ void PolicyBase::sensorSpatialOrientationChanged(SensorSpatialOrientation::Type
 void PolicyBase::sensorMotionChanged(OnOffToggle::Type sensorMotion)
 {
     throwIfPolicyIsDisabled();
-    m_policyServices.messageLogging->writeMessageInfo(
+    DPTF_LOG_MESSAGE_INFO(m_policyServices.messageLogging,
         PolicyMessage(FLF, getName() + ": Sensor motion state changed to "
         + OnOffToggle::toString(sensorMotion) + "."));
     onSensorMotionChanged(sensorMotion);
@@ -591,7 +591,7 @@ void PolicyBase::sensorMotionChanged(OnOffToggle::Type sensorMotion)
 void PolicyBase::oemVariablesChanged(void)
 {
     throwIfPolicyIsDisabled();
-    m_policyServices.messageLogging->writeMessageInfo(
+    DPTF_LOG_MESSAGE_INFO(m_policyServices.messageLogging,
         PolicyMessage(FLF, getName() + ": OEM variable(s) changed."));
     onOemVariablesChanged();
 }
@@ -599,7 +599,7 @@ void PolicyBase::oemVariablesChanged(void)
 void PolicyBase::powerBossConditionsTableChanged(void)
 {
     throwIfPolicyIsDisabled();
-    m_policyServices.messageLogging->writeMessageInfo(
+    DPTF_LOG_MESSAGE_INFO(m_policyServices.messageLogging,
         PolicyMessage(FLF, getName() + ": Power Boss Conditions Table changed."));
     onPowerBossConditionsTableChanged();
 }
@@ -607,7 +607,7 @@ void PolicyBase::powerBossConditionsTableChanged(void)
 void PolicyBase::powerBossActionsTableChanged(void)
 {
     throwIfPolicyIsDisabled();
-    m_policyServices.messageLogging->writeMessageInfo(
+    DPTF_LOG_MESSAGE_INFO(m_policyServices.messageLogging,
         PolicyMessage(FLF, getName() + ": Power Boss Actions Table changed."));
     onPowerBossActionsTableChanged();
 }
@@ -615,7 +615,7 @@ void PolicyBase::powerBossActionsTableChanged(void)
 void PolicyBase::powerBossMathTableChanged(void)
 {
     throwIfPolicyIsDisabled();
-    m_policyServices.messageLogging->writeMessageInfo(
+    DPTF_LOG_MESSAGE_INFO(m_policyServices.messageLogging,
         PolicyMessage(FLF, getName() + ": Power Boss Math Table changed."));
     onPowerBossMathTableChanged();
 }
@@ -623,7 +623,7 @@ void PolicyBase::powerBossMathTableChanged(void)
 void PolicyBase::emergencyCallModeTableChanged(void)
 {
     throwIfPolicyIsDisabled();
-    m_policyServices.messageLogging->writeMessageInfo(
+    DPTF_LOG_MESSAGE_INFO(m_policyServices.messageLogging,
         PolicyMessage(FLF, getName() + ": Emergency Call Mode Table changed."));
     onEmergencyCallModeTableChanged();
 }
@@ -1003,15 +1003,23 @@ void PolicyBase::releaseControlofOsc(Bool shouldReleaseControl)
     }
 }
 
-std::shared_ptr<XmlNode> PolicyBase::getXmlForTripPointStatistics(std::set<UIntN> targetIndexes) const
+void PolicyBase::writeStatus(StatusWriter& writer) const
 {
-    auto status = XmlNode::createWrapperElement("trip_point_statistics");
+    // Policies that only build their status as XML are re-emitted in the writer's format
+    writer.addXmlDocument(getStatusAsXml());
+}
+
+void PolicyBase::writeTripPointStatistics(StatusWriter& writer, std::set<UIntN> targetIndexes) const
+{
+    writer.beginElement("trip_point_statistics");
+    writer.beginList("participant_trip_point_statistics");
 
     for (auto targetIndex = targetIndexes.begin(); targetIndex != targetIndexes.end(); ++targetIndex)
     {
         auto participant = getParticipantTracker()->getParticipant(*targetIndex);
-        status->addChild(participant->getXmlForTripPointStatistics());
+        participant->writeTripPointStatistics(writer);
     }
 
-    return status;
+    writer.endList();
+    writer.endElement();
 }
\ No newline at end of file
@@ -44,6 +44,7 @@ public:
     virtual Guid getGuid() const = 0;
     virtual std::string getName() const = 0;
     virtual std::string getStatusAsXml(void) const = 0;
+    virtual void writeStatus(StatusWriter& writer) const override;
     virtual Bool autoNotifyPlatformOscOnCreateDestroy() const = 0;
     virtual Bool autoNotifyPlatformOscOnConnectedStandbyEntryExit() const = 0;
     virtual Bool autoNotifyPlatformOscOnEnableDisable() const = 0;
@@ -181,7 +182,7 @@ public:
     void overrideTimeObject(std::shared_ptr<TimeInterface> timeObject);
 
     // trip point statistics
-    std::shared_ptr<XmlNode> getXmlForTripPointStatistics(std::set<UIntN> targetIndexes) const;
+    void writeTripPointStatistics(StatusWriter& writer, std::set<UIntN> targetIndexes) const;
 
 protected:
 
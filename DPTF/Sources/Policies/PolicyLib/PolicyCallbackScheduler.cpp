@@ -178,7 +178,7 @@ void PolicyCallbackScheduler::scheduleCallback(ParticipantRole::Type participant
     (participantRole, participantIndex, nullptr, pollTime);
     m_schedule[std::make_pair(participantRole, participantIndex)] = ParticipantCallback(pollTime, currentTime, callbackHandle);
 
-    m_policyServices.messageLogging->writeMessageDebug(PolicyMessage(FLF,
+    DPTF_LOG_MESSAGE_DEBUG(m_policyServices.messageLogging, PolicyMessage(FLF,
         "Scheduled a callback in " + pollTime.toStringMilliseconds() + " ms" +
         " for participant " + StlOverride::to_string(participantIndex) + " with event code = " + 
         StlOverride::to_string(participantRole) + ".", participantIndex));
@@ -41,7 +41,7 @@ void PowerControlKnob::limit(UIntN target)
     {
         try
         {
-            getPolicyServices().messageLogging->writeMessageDebug(
+            DPTF_LOG_MESSAGE_DEBUG(getPolicyServices().messageLogging,
                 PolicyMessage(FLF, "Calculating request to limit power controls.",
                 getParticipantIndex(), getDomainIndex()));
 
@@ -55,7 +55,7 @@ void PowerControlKnob::limit(UIntN target)
             {
                 // limit one step from current power
                 Power currentPower = m_powerControl->getAveragePower();
-                getPolicyServices().messageLogging->writeMessageDebug(PolicyMessage(
+                DPTF_LOG_MESSAGE_DEBUG(getPolicyServices().messageLogging, PolicyMessage(
                     FLF, "Current power is " + currentPower.toString() + ".",
                     getParticipantIndex(), getDomainIndex()));
                 nextPowerLimit = calculateNextLowerPowerLimit(
@@ -68,14 +68,17 @@ void PowerControlKnob::limit(UIntN target)
             }
             m_requests[target] = nextPowerLimit;
 
-            stringstream message;
-            message << "Requesting to limit power to " << nextPowerLimit.toString() << ".";
-            getPolicyServices().messageLogging->writeMessageDebug(
-                PolicyMessage(FLF, message.str(), getParticipantIndex(), getDomainIndex()));
+            if (DPTF_IS_DEBUG_LOGGING_ENABLED(getPolicyServices().messageLogging))
+            {
+                stringstream message;
+                message << "Requesting to limit power to " << nextPowerLimit.toString() << ".";
+                getPolicyServices().messageLogging->writeMessageDebug(
+                    PolicyMessage(FLF, message.str(), getParticipantIndex(), getDomainIndex()));
+            }
         }
         catch (std::exception& ex)
         {
-            getPolicyServices().messageLogging->writeMessageDebug(
+            DPTF_LOG_MESSAGE_DEBUG(getPolicyServices().messageLogging,
                 PolicyMessage(FLF, ex.what(), getParticipantIndex(), getDomainIndex()));
             throw ex;
         }
@@ -88,7 +91,7 @@ void PowerControlKnob::unlimit(UIntN target)
     {
         try
         {
-            getPolicyServices().messageLogging->writeMessageDebug(
+            DPTF_LOG_MESSAGE_DEBUG(getPolicyServices().messageLogging,
                 PolicyMessage(FLF, "Calculating request to unlimit power controls.",
                 getParticipantIndex(), getDomainIndex()));
 
@@ -99,14 +102,17 @@ void PowerControlKnob::unlimit(UIntN target)
             Power nextPowerLimit(std::min(nextPowerAfterStep, pl1Capabilities.getMaxPowerLimit()));
             m_requests[target] = nextPowerLimit;
 
-            stringstream message;
-            message << "Requesting to unlimit power to " << nextPowerLimit.toString() << ".";
-            getPolicyServices().messageLogging->writeMessageDebug(
-                PolicyMessage(FLF, message.str(), getParticipantIndex(), getDomainIndex()));
+            if (DPTF_IS_DEBUG_LOGGING_ENABLED(getPolicyServices().messageLogging))
+            {
+                stringstream message;
+                message << "Requesting to unlimit power to " << nextPowerLimit.toString() << ".";
+                getPolicyServices().messageLogging->writeMessageDebug(
+                    PolicyMessage(FLF, message.str(), getParticipantIndex(), getDomainIndex()));
+            }
         }
         catch (std::exception& ex)
         {
-            getPolicyServices().messageLogging->writeMessageDebug(
+            DPTF_LOG_MESSAGE_DEBUG(getPolicyServices().messageLogging,
                 PolicyMessage(FLF, ex.what(), getParticipantIndex(), getDomainIndex()));
             throw ex;
         }
@@ -193,16 +199,22 @@ Bool PowerControlKnob::commitSetting()
             Power currentPowerLimit = m_powerControl->getPowerLimitPL1();
             if (currentPowerLimit != lowestPowerLimit)
             {
-                stringstream messageBefore;
-                messageBefore << "Attempting to change power limit to " << lowestPowerLimit.toString() << ".";
-                getPolicyServices().messageLogging->writeMessageDebug(
-                    PolicyMessage(FLF, messageBefore.str(), getParticipantIndex(), getDomainIndex()));
+                if (DPTF_IS_DEBUG_LOGGING_ENABLED(getPolicyServices().messageLogging))
+                {
+                    stringstream messageBefore;
+                    messageBefore << "Attempting to change power limit to " << lowestPowerLimit.toString() << ".";
+                    getPolicyServices().messageLogging->writeMessageDebug(
+                        PolicyMessage(FLF, messageBefore.str(), getParticipantIndex(), getDomainIndex()));
+                }
                 m_powerControl->setPowerLimitPL1(lowestPowerLimit);
 
-                stringstream messageAfter;
-                messageAfter << "Changed power limit to " << lowestPowerLimit.toString() << ".";
-                getPolicyServices().messageLogging->writeMessageDebug(
-                    PolicyMessage(FLF, messageAfter.str(), getParticipantIndex(), getDomainIndex()));
+                if (DPTF_IS_DEBUG_LOGGING_ENABLED(getPolicyServices().messageLogging))
+                {
+                    stringstream messageAfter;
+                    messageAfter << "Changed power limit to " << lowestPowerLimit.toString() << ".";
+                    getPolicyServices().messageLogging->writeMessageDebug(
+                        PolicyMessage(FLF, messageAfter.str(), getParticipantIndex(), getDomainIndex()));
+                }
                 return true;
             }
             else
@@ -217,7 +229,7 @@ Bool PowerControlKnob::commitSetting()
     }
     catch (std::exception& ex)
     {
-        getPolicyServices().messageLogging->writeMessageDebug(
+        DPTF_LOG_MESSAGE_DEBUG(getPolicyServices().messageLogging,
             PolicyMessage(FLF, ex.what(), getParticipantIndex(), getDomainIndex()));
         throw ex;
     }
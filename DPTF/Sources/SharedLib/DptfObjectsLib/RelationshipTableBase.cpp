@@ -17,6 +17,7 @@
 ******************************************************************************/
 
 #include "RelationshipTableBase.h"
+#include <algorithm>
 
 RelationshipTableBase::RelationshipTableBase()
 {
@@ -25,6 +26,8 @@ RelationshipTableBase::RelationshipTableBase()
 RelationshipTableBase::RelationshipTableBase(const std::vector<std::shared_ptr<RelationshipTableEntryBase>>& entries)
     : m_entries(entries)
 {
+    buildScopeIndex();
+    buildParticipantIndexes();
 }
 
 RelationshipTableBase::~RelationshipTableBase()
@@ -38,6 +41,12 @@ void RelationshipTableBase::associateParticipant(std::string participantScope, U
     {
         m_entries.at(*tableRow)->associateParticipant(participantScope, participantIndex);
     }
+
+    if (tableRows.size() > 0)
+    {
+        buildParticipantIndexes();
+        onParticipantIndexesChanged();
+    }
 }
 
 void RelationshipTableBase::disassociateParticipant(UIntN participantIndex)
@@ -47,6 +56,12 @@ void RelationshipTableBase::disassociateParticipant(UIntN participantIndex)
     {
         m_entries.at(*tableRow)->disassociateParticipant(participantIndex);
     }
+
+    if (tableRows.size() > 0)
+    {
+        buildParticipantIndexes();
+        onParticipantIndexesChanged();
+    }
 }
 
 void RelationshipTableBase::associateDomain(std::string participantScope, DomainType::Type domainType, UIntN domainIndex)
@@ -78,28 +93,12 @@ void RelationshipTableBase::disassociateDomain(UIntN participantIndex, UIntN dom
 
 Bool RelationshipTableBase::isParticipantSourceDevice(UIntN participantIndex) const
 {
-    auto tableRows = findTableRowsWithParticipantIndex(participantIndex);
-    for (auto tableRow = tableRows.begin(); tableRow != tableRows.end(); ++tableRow)
-    {
-        if (m_entries.at(*tableRow)->getSourceDeviceIndex() == participantIndex)
-        {
-            return true;
-        }
-    }
-    return false;
+    return (m_rowsWithSourceIndex.find(participantIndex) != m_rowsWithSourceIndex.end());
 }
 
 Bool RelationshipTableBase::isParticipantTargetDevice(UIntN participantIndex) const
 {
-    auto tableRows = findTableRowsWithParticipantIndex(participantIndex);
-    for (auto tableRow = tableRows.begin(); tableRow != tableRows.end(); ++tableRow)
-    {
-        if (m_entries.at(*tableRow)->getTargetDeviceIndex() == participantIndex)
-        {
-            return true;
-        }
-    }
-    return false;
+    return (m_rowsWithTargetIndex.find(participantIndex) != m_rowsWithTargetIndex.end());
 }
 
 UIntN RelationshipTableBase::getNumberOfEntries(void) const
@@ -109,42 +108,55 @@ UIntN RelationshipTableBase::getNumberOfEntries(void) const
 
 std::vector<UIntN> RelationshipTableBase::findTableRowsWithParticipantScope(std::string participantScope) const
 {
-    std::vector<UIntN> rows;
-    for (UIntN row = 0; row < getNumberOfEntries(); ++row)
+    auto rows = m_rowsWithScope.find(participantScope);
+    if (rows == m_rowsWithScope.end())
     {
-        auto entry = m_entries.at(row);
-        if ((entry->getSourceDeviceScope() == participantScope) ||
-            (entry->getTargetDeviceScope() == participantScope))
-        {
-            rows.push_back(row);
-        }
+        return std::vector<UIntN>();
     }
-    return rows;
+    return rows->second;
 }
 
 std::vector<UIntN> RelationshipTableBase::findTableRowsWithParticipantIndex(UIntN participantIndex) const
 {
+    const std::vector<UIntN>& sourceRows = findTableRowsWithSourceIndex(participantIndex);
+    const std::vector<UIntN>& targetRows = findTableRowsWithTargetIndex(participantIndex);
+
+    // Both lists are in row order, so merging them keeps the rows in table order without duplicates
     std::vector<UIntN> rows;
-    for (UIntN row = 0; row < getNumberOfEntries(); ++row)
+    rows.reserve(sourceRows.size() + targetRows.size());
+    std::set_union(sourceRows.begin(), sourceRows.end(), targetRows.begin(), targetRows.end(),
+        std::back_inserter(rows));
+    return rows;
+}
+
+const std::vector<UIntN>& RelationshipTableBase::findTableRowsWithTargetIndex(UIntN targetIndex) const
+{
+    auto rows = m_rowsWithTargetIndex.find(targetIndex);
+    if (rows == m_rowsWithTargetIndex.end())
     {
-        auto entry = m_entries.at(row);
-        if ((entry->getSourceDeviceIndex() == participantIndex) ||
-            (entry->getTargetDeviceIndex() == participantIndex))
-        {
-            rows.push_back(row);
-        }
+        return m_noRows;
     }
-    return rows;
+    return rows->second;
+}
+
+const std::vector<UIntN>& RelationshipTableBase::findTableRowsWithSourceIndex(UIntN sourceIndex) const
+{
+    auto rows = m_rowsWithSourceIndex.find(sourceIndex);
+    if (rows == m_rowsWithSourceIndex.end())
+    {
+        return m_noRows;
+    }
+    return rows->second;
 }
 
 std::set<UIntN> RelationshipTableBase::getAllTargetIndexes() const
 {
     std::set<UIntN> targetIndexes;
-    for (auto entry = m_entries.begin(); entry < m_entries.end(); ++entry)
+    for (auto target = m_rowsWithTargetIndex.begin(); target != m_rowsWithTargetIndex.end(); ++target)
     {
-        if ((*entry)->targetDeviceIndexValid())
+        if (target->first != Constants::Invalid)
         {
-            targetIndexes.insert((*entry)->getTargetDeviceIndex());
+            targetIndexes.insert(target->first);
         }
     }
     return targetIndexes;
@@ -153,12 +165,42 @@ std::set<UIntN> RelationshipTableBase::getAllTargetIndexes() const
 std::set<UIntN> RelationshipTableBase::getAllSourceIndexes() const
 {
     std::set<UIntN> sourceIndexes;
-    for (auto entry = m_entries.begin(); entry < m_entries.end(); ++entry)
+    for (auto source = m_rowsWithSourceIndex.begin(); source != m_rowsWithSourceIndex.end(); ++source)
     {
-        if ((*entry)->sourceDeviceIndexValid())
+        if (source->first != Constants::Invalid)
         {
-            sourceIndexes.insert((*entry)->getSourceDeviceIndex());
+            sourceIndexes.insert(source->first);
         }
     }
     return sourceIndexes;
+}
+
+void RelationshipTableBase::onParticipantIndexesChanged(void)
+{
+}
+
+void RelationshipTableBase::buildScopeIndex(void)
+{
+    m_rowsWithScope.clear();
+    for (UIntN row = 0; row < getNumberOfEntries(); ++row)
+    {
+        auto& entry = m_entries[row];
+        m_rowsWithScope[entry->getSourceDeviceScope()].push_back(row);
+        if (entry->getTargetDeviceScope() != entry->getSourceDeviceScope())
+        {
+            m_rowsWithScope[entry->getTargetDeviceScope()].push_back(row);
+        }
+    }
+}
+
+void RelationshipTableBase::buildParticipantIndexes(void)
+{
+    m_rowsWithTargetIndex.clear();
+    m_rowsWithSourceIndex.clear();
+    for (UIntN row = 0; row < getNumberOfEntries(); ++row)
+    {
+        auto& entry = m_entries[row];
+        m_rowsWithTargetIndex[entry->getTargetDeviceIndex()].push_back(row);
+        m_rowsWithSourceIndex[entry->getSourceDeviceIndex()].push_back(row);
+    }
 }
\ No newline at end of file
@@ -21,6 +21,7 @@
 #include "Dptf.h"
 #include "RelationshipTableInterface.h"
 #include "RelationshipTableEntryBase.h"
+#include <unordered_map>
 
 class dptf_export RelationshipTableBase : public RelationshipTableInterface
 {
@@ -45,6 +46,24 @@ protected:
 
     std::vector<UIntN> findTableRowsWithParticipantScope(std::string participantScope) const;
     std::vector<UIntN> findTableRowsWithParticipantIndex(UIntN participantIndex) const;
+    const std::vector<UIntN>& findTableRowsWithTargetIndex(UIntN targetIndex) const;
+    const std::vector<UIntN>& findTableRowsWithSourceIndex(UIntN sourceIndex) const;
+
+    // Called after participants are associated or disassociated so derived tables can rebuild anything they
+    // derive from the source and target indexes
+    virtual void onParticipantIndexesChanged(void);
 
     std::vector<std::shared_ptr<RelationshipTableEntryBase>> m_entries;
+
+private:
+
+    // Table rows in ascending order, keyed by scope and by associated participant index.  Scopes never change
+    // after the table is created; the participant indexes are rebuilt when a participant is (dis)associated.
+    std::unordered_map<std::string, std::vector<UIntN>> m_rowsWithScope;
+    std::unordered_map<UIntN, std::vector<UIntN>> m_rowsWithTargetIndex;
+    std::unordered_map<UIntN, std::vector<UIntN>> m_rowsWithSourceIndex;
+    std::vector<UIntN> m_noRows;
+
+    void buildScopeIndex(void);
+    void buildParticipantIndexes(void);
 };
\ No newline at end of file
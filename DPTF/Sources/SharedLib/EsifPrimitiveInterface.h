@@ -23,6 +23,7 @@
 #include "esif_sdk_primitive_type.h"
 #include "DptfBuffer.h"
 #include "TimeSpan.h"
+#include "EsifPrimitiveBatch.h"
 
 class EsifPrimitiveInterface
 {
@@ -137,6 +138,10 @@ public:
         UIntN domainIndex = Constants::Esif::NoDomain,
         UInt8 instance = Constants::Esif::NoInstance) = 0;
 
+    // Executes every request in the batch with a single call into ESIF.  The participant index of each request is
+    // replaced with the participant that owns these services.
+    virtual void primitiveExecuteGetBatch(EsifPrimitiveBatch& batch) = 0;
+
     virtual void primitiveExecuteSet(
         esif_primitive_type primitive,
         esif_data_type esifDataType,
@@ -0,0 +1,261 @@
+/******************************************************************************
+** Copyright (c) 2013-2016 Intel Corporation All Rights Reserved
+**
+** Licensed under the Apache License, Version 2.0 (the "License"); you may not
+** use this file except in compliance with the License.
+**
+** You may obtain a copy of the License at
+**     http://www.apache.org/licenses/LICENSE-2.0
+**
+** Unless required by applicable law or agreed to in writing, software
+** distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+** WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+**
+** See the License for the specific language governing permissions and
+** limitations under the License.
+**
+******************************************************************************/
+
+#include "EsifPrimitiveBatch.h"
+#include "EsifDataUInt8.h"
+#include "EsifDataUInt32.h"
+#include "EsifDataUInt64.h"
+#include "EsifDataTemperature.h"
+#include "EsifDataPercentage.h"
+#include "EsifDataPower.h"
+#include "EsifDataFrequency.h"
+#include "EsifDataTime.h"
+#include "esif_ccb_memory.h"
+#include <algorithm>
+
+EsifPrimitiveBatch::EsifPrimitiveBatch(void)
+{
+}
+
+EsifPrimitiveBatch::~EsifPrimitiveBatch(void)
+{
+}
+
+UIntN EsifPrimitiveBatch::add(esif_primitive_type primitive, esif_data_type esifDataType, UIntN domainIndex,
+    UInt8 instance, UIntN participantIndex)
+{
+    if (getResponseSize(esifDataType) == 0)
+    {
+        throw dptf_exception("Data type is not supported in a primitive batch.");
+    }
+
+    Request request;
+    request.primitive = primitive;
+    request.dataType = esifDataType;
+    request.participantIndex = participantIndex;
+    request.domainIndex = domainIndex;
+    request.instance = instance;
+    request.status = ESIF_E_UNSPECIFIED;
+    request.offset = 0;
+    request.dataLength = 0;
+    m_requests.push_back(request);
+
+    return static_cast<UIntN>(m_requests.size() - 1);
+}
+
+UIntN EsifPrimitiveBatch::getCount(void) const
+{
+    return static_cast<UIntN>(m_requests.size());
+}
+
+void EsifPrimitiveBatch::clear(void)
+{
+    m_requests.clear();
+    m_resultBuffer = DptfBuffer();
+}
+
+eEsifError EsifPrimitiveBatch::getStatus(UIntN requestIndex) const
+{
+    return getRequest(requestIndex).status;
+}
+
+Bool EsifPrimitiveBatch::isSuccessful(UIntN requestIndex) const
+{
+    return (getStatus(requestIndex) == ESIF_OK);
+}
+
+UInt8 EsifPrimitiveBatch::getUInt8(UIntN requestIndex) const
+{
+    EsifDataUInt8 esifResult;
+    copyResult(requestIndex, esifResult);
+    return esifResult;
+}
+
+UInt32 EsifPrimitiveBatch::getUInt32(UIntN requestIndex) const
+{
+    EsifDataUInt32 esifResult;
+    copyResult(requestIndex, esifResult);
+    return esifResult;
+}
+
+UInt64 EsifPrimitiveBatch::getUInt64(UIntN requestIndex) const
+{
+    EsifDataUInt64 esifResult;
+    copyResult(requestIndex, esifResult);
+    return esifResult;
+}
+
+Temperature EsifPrimitiveBatch::getTemperature(UIntN requestIndex) const
+{
+    EsifDataTemperature esifResult;
+    copyResult(requestIndex, esifResult);
+    return esifResult;
+}
+
+Percentage EsifPrimitiveBatch::getPercentage(UIntN requestIndex) const
+{
+    EsifDataPercentage esifResult;
+    copyResult(requestIndex, esifResult);
+    return esifResult;
+}
+
+Power EsifPrimitiveBatch::getPower(UIntN requestIndex) const
+{
+    EsifDataPower esifResult;
+    copyResult(requestIndex, esifResult);
+    return esifResult;
+}
+
+Frequency EsifPrimitiveBatch::getFrequency(UIntN requestIndex) const
+{
+    EsifDataFrequency esifResult;
+    copyResult(requestIndex, esifResult);
+    return esifResult;
+}
+
+TimeSpan EsifPrimitiveBatch::getTimeInMilliseconds(UIntN requestIndex) const
+{
+    EsifDataTime esifResult;
+    copyResult(requestIndex, esifResult);
+    return esifResult.createTimeSpanFromMilliseconds();
+}
+
+esif_primitive_type EsifPrimitiveBatch::getPrimitive(UIntN requestIndex) const
+{
+    return getRequest(requestIndex).primitive;
+}
+
+esif_data_type EsifPrimitiveBatch::getDataType(UIntN requestIndex) const
+{
+    return getRequest(requestIndex).dataType;
+}
+
+UInt32 EsifPrimitiveBatch::getResponseSize(UIntN requestIndex) const
+{
+    return getResponseSize(getRequest(requestIndex).dataType);
+}
+
+UIntN EsifPrimitiveBatch::getParticipantIndex(UIntN requestIndex) const
+{
+    return getRequest(requestIndex).participantIndex;
+}
+
+UIntN EsifPrimitiveBatch::getDomainIndex(UIntN requestIndex) const
+{
+    return getRequest(requestIndex).domainIndex;
+}
+
+UInt8 EsifPrimitiveBatch::getInstance(UIntN requestIndex) const
+{
+    return getRequest(requestIndex).instance;
+}
+
+void EsifPrimitiveBatch::setParticipantIndex(UIntN participantIndex)
+{
+    for (auto request = m_requests.begin(); request != m_requests.end(); request++)
+    {
+        request->participantIndex = participantIndex;
+    }
+}
+
+void EsifPrimitiveBatch::setResultBuffer(const DptfBuffer& resultBuffer)
+{
+    m_resultBuffer = resultBuffer;
+}
+
+void EsifPrimitiveBatch::setResult(UIntN requestIndex, eEsifError status, UInt32 offset, UInt32 dataLength,
+    const std::string& errorDescription)
+{
+    Request& request = getRequest(requestIndex);
+    request.status = status;
+    request.offset = offset;
+    request.dataLength = dataLength;
+    request.errorDescription = errorDescription;
+}
+
+UInt32 EsifPrimitiveBatch::getResponseSize(esif_data_type esifDataType)
+{
+    switch (esifDataType)
+    {
+        case ESIF_DATA_UINT8:
+            return sizeof(UInt8);
+        case ESIF_DATA_UINT32:
+        case ESIF_DATA_TEMPERATURE:
+        case ESIF_DATA_PERCENT:
+        case ESIF_DATA_POWER:
+            return sizeof(UInt32);
+        case ESIF_DATA_UINT64:
+        case ESIF_DATA_FREQUENCY:
+        case ESIF_DATA_TIME:
+            return sizeof(UInt64);
+        default:
+            return 0;
+    }
+}
+
+const EsifPrimitiveBatch::Request& EsifPrimitiveBatch::getRequest(UIntN requestIndex) const
+{
+    if (requestIndex >= m_requests.size())
+    {
+        throw dptf_exception("Primitive batch request index is out of range.");
+    }
+    return m_requests[requestIndex];
+}
+
+EsifPrimitiveBatch::Request& EsifPrimitiveBatch::getRequest(UIntN requestIndex)
+{
+    if (requestIndex >= m_requests.size())
+    {
+        throw dptf_exception("Primitive batch request index is out of range.");
+    }
+    return m_requests[requestIndex];
+}
+
+void EsifPrimitiveBatch::copyResult(UIntN requestIndex, EsifDataPtr esifResult) const
+{
+    const Request& request = getRequest(requestIndex);
+    throwIfNotSuccessful(request);
+
+    // Like the single primitive call the whole response is used even if ESIF reports a shorter data length
+    UInt32 length = std::min(getResponseSize(request.dataType), esifResult->buf_len);
+    if ((UInt64)request.offset + length > m_resultBuffer.size())
+    {
+        throw dptf_exception("Primitive batch result is outside of the result buffer.");
+    }
+    esif_ccb_memcpy(esifResult->buf_ptr, m_resultBuffer.get() + request.offset, length);
+    esifResult->data_len = length;
+}
+
+void EsifPrimitiveBatch::throwIfNotSuccessful(const Request& request) const
+{
+    switch (request.status)
+    {
+        case ESIF_OK:
+            return;
+        case ESIF_I_AGAIN:
+            throw primitive_try_again(request.errorDescription);
+        case ESIF_E_PRIMITIVE_NOT_FOUND_IN_DSP:
+            throw primitive_not_found_in_dsp(request.errorDescription);
+        case ESIF_E_PRIMITIVE_DST_UNAVAIL:
+            throw primitive_destination_unavailable(request.errorDescription);
+        case ESIF_E_IO_OPEN_FAILED:
+            throw file_open_create_failure(request.errorDescription);
+        default:
+            throw primitive_execution_failed(request.errorDescription);
+    }
+}
\ No newline at end of file
@@ -0,0 +1,97 @@
+/******************************************************************************
+** Copyright (c) 2013-2016 Intel Corporation All Rights Reserved
+**
+** Licensed under the Apache License, Version 2.0 (the "License"); you may not
+** use this file except in compliance with the License.
+**
+** You may obtain a copy of the License at
+**     http://www.apache.org/licenses/LICENSE-2.0
+**
+** Unless required by applicable law or agreed to in writing, software
+** distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+** WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+**
+** See the License for the specific language governing permissions and
+** limitations under the License.
+**
+******************************************************************************/
+
+#pragma once
+
+#include "Dptf.h"
+#include "esif_ccb_rc.h"
+#include "esif_sdk_data.h"
+#include "esif_sdk_primitive_type.h"
+#include "DptfBuffer.h"
+#include "TimeSpan.h"
+
+//
+// A list of GET primitives that are executed with a single call into ESIF.  Requests are added with add(), which
+// returns the index used to retrieve the result once the batch has been executed.  Getting the value of a request
+// that failed throws the same exception the single primitive call would have thrown.
+//
+class EsifPrimitiveBatch final
+{
+public:
+
+    EsifPrimitiveBatch(void);
+    ~EsifPrimitiveBatch(void);
+
+    UIntN add(
+        esif_primitive_type primitive,
+        esif_data_type esifDataType,
+        UIntN domainIndex = Constants::Esif::NoDomain,
+        UInt8 instance = Constants::Esif::NoInstance,
+        UIntN participantIndex = Constants::Esif::NoParticipant);
+    UIntN getCount(void) const;
+    void clear(void);
+
+    // Results
+    eEsifError getStatus(UIntN requestIndex) const;
+    Bool isSuccessful(UIntN requestIndex) const;
+    UInt8 getUInt8(UIntN requestIndex) const;
+    UInt32 getUInt32(UIntN requestIndex) const;
+    UInt64 getUInt64(UIntN requestIndex) const;
+    Temperature getTemperature(UIntN requestIndex) const;
+    Percentage getPercentage(UIntN requestIndex) const;
+    Power getPower(UIntN requestIndex) const;
+    Frequency getFrequency(UIntN requestIndex) const;
+    TimeSpan getTimeInMilliseconds(UIntN requestIndex) const;
+
+    // Used by the code executing the batch
+    esif_primitive_type getPrimitive(UIntN requestIndex) const;
+    esif_data_type getDataType(UIntN requestIndex) const;
+    UInt32 getResponseSize(UIntN requestIndex) const;
+    UIntN getParticipantIndex(UIntN requestIndex) const;
+    UIntN getDomainIndex(UIntN requestIndex) const;
+    UInt8 getInstance(UIntN requestIndex) const;
+    void setParticipantIndex(UIntN participantIndex);
+    void setResultBuffer(const DptfBuffer& resultBuffer);
+    void setResult(UIntN requestIndex, eEsifError status, UInt32 offset, UInt32 dataLength,
+        const std::string& errorDescription);
+
+    static UInt32 getResponseSize(esif_data_type esifDataType);
+
+private:
+
+    struct Request
+    {
+        esif_primitive_type primitive;
+        esif_data_type dataType;
+        UIntN participantIndex;
+        UIntN domainIndex;
+        UInt8 instance;
+        eEsifError status;
+        UInt32 offset;
+        UInt32 dataLength;
+        std::string errorDescription;
+    };
+
+    std::vector<Request> m_requests;
+    DptfBuffer m_resultBuffer;
+
+    const Request& getRequest(UIntN requestIndex) const;
+    Request& getRequest(UIntN requestIndex);
+    void copyResult(UIntN requestIndex, EsifDataPtr esifResult) const;
+    void throwIfNotSuccessful(const Request& request) const;
+};
\ No newline at end of file
@@ -20,6 +20,7 @@
 
 #include "Dptf.h"
 #include "DptfMessage.h"
+#include "esif_sdk_iface.h"
 
 class MessageLoggingInterface
 {
@@ -29,9 +30,65 @@ public:
     {
     };
 
+    // Returns true if a message at the given level would be written at the current log verbosity level
+    virtual Bool isMessageLoggingEnabled(eLogType messageLevel) const = 0;
+
     virtual void writeMessageFatal(const DptfMessage& message) = 0;
     virtual void writeMessageError(const DptfMessage& message) = 0;
     virtual void writeMessageWarning(const DptfMessage& message) = 0;
     virtual void writeMessageInfo(const DptfMessage& message) = 0;
     virtual void writeMessageDebug(const DptfMessage& message) = 0;
-};
\ No newline at end of file
+};
+
+//
+// Level-gated logging.  The message arguments are only evaluated if the logger will write a message at that
+// level, so a DptfMessage is never built just to be discarded:
+//
+//   DPTF_LOG_MESSAGE_DEBUG(getPolicyServices().messageLogging, PolicyMessage(FLF, "Limiting target.", target));
+//
+// When a message needs more than one statement to build, guard the whole block instead:
+//
+//   if (DPTF_IS_DEBUG_LOGGING_ENABLED(getPolicyServices().messageLogging))
+//   {
+//       std::stringstream message;
+//       ...
+//   }
+//
+// Debug messages are compiled out when DPTF_DISABLE_DEBUG_MESSAGES is defined (release builds).  The message
+// is still type checked so the call sites do not rot.
+//
+
+#define DPTF_LOG_MESSAGE(logger, messageLevel, writeFunction, ...) \
+    do \
+    { \
+        MessageLoggingInterface* dptfMessageLogger = (logger); \
+        if (dptfMessageLogger->isMessageLoggingEnabled(messageLevel) == true) \
+        { \
+            dptfMessageLogger->writeFunction(__VA_ARGS__); \
+        } \
+    } while (0)
+
+#define DPTF_LOG_MESSAGE_FATAL(logger, ...) \
+    DPTF_LOG_MESSAGE(logger, eLogType::eLogTypeFatal, writeMessageFatal, __VA_ARGS__)
+#define DPTF_LOG_MESSAGE_ERROR(logger, ...) \
+    DPTF_LOG_MESSAGE(logger, eLogType::eLogTypeError, writeMessageError, __VA_ARGS__)
+#define DPTF_LOG_MESSAGE_WARNING(logger, ...) \
+    DPTF_LOG_MESSAGE(logger, eLogType::eLogTypeWarning, writeMessageWarning, __VA_ARGS__)
+#define DPTF_LOG_MESSAGE_INFO(logger, ...) \
+    DPTF_LOG_MESSAGE(logger, eLogType::eLogTypeInfo, writeMessageInfo, __VA_ARGS__)
+
+#ifdef DPTF_DISABLE_DEBUG_MESSAGES
+#define DPTF_IS_DEBUG_LOGGING_ENABLED(logger) ((void)(logger), false)
+#define DPTF_LOG_MESSAGE_DEBUG(logger, ...) \
+    do \
+    { \
+        if (false) \
+        { \
+            (logger)->writeMessageDebug(__VA_ARGS__); \
+        } \
+    } while (0)
+#else
+#define DPTF_IS_DEBUG_LOGGING_ENABLED(logger) ((logger)->isMessageLoggingEnabled(eLogType::eLogTypeDebug) == true)
+#define DPTF_LOG_MESSAGE_DEBUG(logger, ...) \
+    DPTF_LOG_MESSAGE(logger, eLogType::eLogTypeDebug, writeMessageDebug, __VA_ARGS__)
+#endif
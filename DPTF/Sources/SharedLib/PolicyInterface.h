@@ -31,6 +31,8 @@
 #include "OsDockMode.h"
 #include "OsPowerSchemePersonality.h"
 
+class StatusWriter;
+
 class dptf_export PolicyInterface
 {
 public:
@@ -94,6 +96,10 @@ public:
     virtual std::string getName(void) const = 0;
     virtual std::string getStatusAsXml(void) const = 0;
 
+    // Writes the same status document as getStatusAsXml() into a writer that is already open, so the policy can
+    // produce its status without building an intermediate XML string.
+    virtual void writeStatus(StatusWriter& writer) const = 0;
+
     // DPTF Event handlers
     virtual void connectedStandbyEntry(void) = 0;
     virtual void connectedStandbyExit(void) = 0;
@@ -0,0 +1,497 @@
+/******************************************************************************
+** Copyright (c) 2013-2016 Intel Corporation All Rights Reserved
+**
+** Licensed under the Apache License, Version 2.0 (the "License"); you may not
+** use this file except in compliance with the License.
+**
+** You may obtain a copy of the License at
+**     http://www.apache.org/licenses/LICENSE-2.0
+**
+** Unless required by applicable law or agreed to in writing, software
+** distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+** WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+**
+** See the License for the specific language governing permissions and
+** limitations under the License.
+**
+******************************************************************************/
+
+#include "StatusWriter.h"
+#include "rapidxml/rapidxml.hpp"
+
+static void writeRapidXmlNode(StatusWriter& writer, RapidXml::xml_node<>* node)
+{
+    switch (node->type())
+    {
+        case RapidXml::node_element:
+        {
+            Bool hasNodeChildren = false;
+            for (auto child = node->first_node(); child != nullptr; child = child->next_sibling())
+            {
+                if ((child->type() == RapidXml::node_element) || (child->type() == RapidXml::node_comment))
+                {
+                    hasNodeChildren = true;
+                    break;
+                }
+            }
+
+            if (hasNodeChildren)
+            {
+                writer.beginElement(std::string(node->name(), node->name_size()));
+                for (auto child = node->first_node(); child != nullptr; child = child->next_sibling())
+                {
+                    writeRapidXmlNode(writer, child);
+                }
+                writer.endElement();
+            }
+            else
+            {
+                writer.addDataElement(std::string(node->name(), node->name_size()),
+                    std::string(node->value(), node->value_size()));
+            }
+            break;
+        }
+        case RapidXml::node_comment:
+            writer.addComment(std::string(node->value(), node->value_size()));
+            break;
+        default:
+            // Data nodes are written with their element and there are no other node types in status documents
+            break;
+    }
+}
+
+StatusWriter::StatusWriter(StatusOutputFormat::Type format)
+{
+    reset(format);
+}
+
+void StatusWriter::reset(StatusOutputFormat::Type format)
+{
+    m_format = format;
+    m_buffer.clear();
+    m_frames.clear();
+    m_jsonMembers.clear();
+    m_openXmlLists.clear();
+    m_finished = false;
+
+    // The first frame stands for the document itself
+    if (m_format == StatusOutputFormat::Json)
+    {
+        m_buffer.push_back('{');
+    }
+    pushFrame(0, 0);
+}
+
+StatusOutputFormat::Type StatusWriter::getFormat(void) const
+{
+    return m_format;
+}
+
+void StatusWriter::beginElement(const std::string& tagName)
+{
+    if (m_format == StatusOutputFormat::Json)
+    {
+        beginJsonChild(tagName);
+        m_buffer.push_back('{');
+        pushFrame(0, 0);
+    }
+    else
+    {
+        beginXmlChild();
+        appendIndent();
+        m_buffer.push_back('<');
+        size_t tagOffset = m_buffer.size();
+        m_buffer.append(tagName);
+        pushFrame(tagOffset, tagName.size());
+    }
+}
+
+void StatusWriter::endElement(void)
+{
+    if ((m_frames.size() <= 1) || m_frames.back().isList ||
+        ((m_openXmlLists.empty() == false) && (m_openXmlLists.back() == m_frames.size())))
+    {
+        throw dptf_exception("Status element ended without a matching begin.");
+    }
+
+    Frame frame = m_frames.back();
+    m_frames.pop_back();
+
+    if (m_format == StatusOutputFormat::Json)
+    {
+        endJsonObject(frame);
+    }
+    else if (frame.hasChildren == false)
+    {
+        m_buffer.append("/>\n");
+    }
+    else
+    {
+        appendIndent();
+        m_buffer.append("</");
+        m_buffer.append(m_buffer, frame.tagOffset, frame.tagLength);
+        m_buffer.append(">\n");
+    }
+}
+
+void StatusWriter::addDataElement(const std::string& tagName, const std::string& data)
+{
+    if (m_format == StatusOutputFormat::Json)
+    {
+        beginJsonChild(tagName);
+        m_buffer.push_back('"');
+        appendJsonEscaped(data);
+        m_buffer.push_back('"');
+    }
+    else
+    {
+        beginXmlChild();
+        appendIndent();
+        m_buffer.push_back('<');
+        m_buffer.append(tagName);
+        if (data.empty())
+        {
+            m_buffer.append("/>\n");
+        }
+        else
+        {
+            m_buffer.push_back('>');
+            appendXmlEscaped(data);
+            m_buffer.append("</");
+            m_buffer.append(tagName);
+            m_buffer.append(">\n");
+        }
+    }
+}
+
+void StatusWriter::beginList(const std::string& tagName)
+{
+    if (m_format == StatusOutputFormat::Json)
+    {
+        beginJsonChild(tagName);
+        m_buffer.push_back('[');
+        pushFrame(0, 0, true);
+    }
+    else
+    {
+        if (m_finished)
+        {
+            throw dptf_exception("Status document has already been completed.");
+        }
+        m_openXmlLists.push_back(m_frames.size());
+    }
+}
+
+void StatusWriter::endList(void)
+{
+    if (m_format == StatusOutputFormat::Json)
+    {
+        if (m_frames.back().isList == false)
+        {
+            throw dptf_exception("Status list ended without a matching begin.");
+        }
+        m_frames.pop_back();
+        m_buffer.push_back(']');
+    }
+    else
+    {
+        if (m_openXmlLists.empty() || (m_openXmlLists.back() != m_frames.size()))
+        {
+            throw dptf_exception("Status list ended without a matching begin.");
+        }
+        m_openXmlLists.pop_back();
+    }
+}
+
+void StatusWriter::addComment(const std::string& comment)
+{
+    // Json has no comments
+    if (m_format == StatusOutputFormat::Xml)
+    {
+        beginXmlChild();
+        appendIndent();
+        m_buffer.append("<!--");
+        m_buffer.append(comment);
+        m_buffer.append("-->\n");
+    }
+}
+
+void StatusWriter::addXmlDocument(const std::string& xml)
+{
+    // Nothing to convert when the document would be the whole Xml output
+    if ((m_format == StatusOutputFormat::Xml) && (m_frames.size() == 1) && (m_frames.back().hasChildren == false) &&
+        m_openXmlLists.empty() && (m_finished == false))
+    {
+        m_buffer.append(xml);
+        m_finished = true;
+        return;
+    }
+
+    // RapidXML parses in place so it needs a modifiable, null terminated copy
+    std::vector<char> text(xml.begin(), xml.end());
+    text.push_back('\0');
+
+    RapidXml::xml_document<> document;
+    try
+    {
+        document.parse<RapidXml::parse_comment_nodes>(&text[0]);
+    }
+    catch (...)
+    {
+        throw dptf_exception("Status document is not valid XML.");
+    }
+
+    for (auto node = document.first_node(); node != nullptr; node = node->next_sibling())
+    {
+        writeRapidXmlNode(*this, node);
+    }
+}
+
+const std::string& StatusWriter::getContent(void)
+{
+    if (m_finished == false)
+    {
+        if ((m_frames.size() > 1) || (m_openXmlLists.empty() == false))
+        {
+            throw dptf_exception("Status document has elements that were not ended.");
+        }
+
+        if (m_format == StatusOutputFormat::Json)
+        {
+            endJsonObject(m_frames.back());
+        }
+        else
+        {
+            m_buffer.push_back('\n');
+        }
+        m_finished = true;
+    }
+    return m_buffer;
+}
+
+void StatusWriter::beginXmlChild(void)
+{
+    if (m_finished)
+    {
+        throw dptf_exception("Status document has already been completed.");
+    }
+
+    Frame& frame = currentFrame();
+    if ((m_frames.size() > 1) && (frame.hasChildren == false))
+    {
+        m_buffer.append(">\n");
+    }
+    frame.hasChildren = true;
+}
+
+void StatusWriter::beginJsonChild(const std::string& tagName)
+{
+    if (m_finished)
+    {
+        throw dptf_exception("Status document has already been completed.");
+    }
+
+    Frame& frame = currentFrame();
+    if (frame.isList)
+    {
+        // List members are array values, so they have no key
+        if (frame.hasChildren)
+        {
+            m_buffer.push_back(',');
+        }
+    }
+    else
+    {
+        if (frame.hasChildren)
+        {
+            m_jsonMembers.back().valueEnd = m_buffer.size();
+            m_buffer.push_back(',');
+        }
+
+        JsonMember member;
+        m_buffer.push_back('"');
+        member.keyOffset = m_buffer.size();
+        appendJsonEscaped(tagName);
+        member.keyLength = m_buffer.size() - member.keyOffset;
+        m_buffer.append("\":");
+        member.valueOffset = m_buffer.size();
+        member.valueEnd = m_buffer.size();
+
+        // Repeated tags are usually next to each other, so search from the most recent member
+        for (size_t i = m_jsonMembers.size(); (frame.hasRepeatedKeys == false) && (i > frame.firstMember); i--)
+        {
+            frame.hasRepeatedKeys = isSameJsonKey(m_jsonMembers[i - 1], member);
+        }
+        m_jsonMembers.push_back(member);
+    }
+    frame.hasChildren = true;
+}
+
+void StatusWriter::endJsonObject(const Frame& frame)
+{
+    if (frame.hasChildren)
+    {
+        m_jsonMembers.back().valueEnd = m_buffer.size();
+    }
+    if (frame.hasRepeatedKeys)
+    {
+        groupRepeatedJsonKeys(frame);
+    }
+    m_jsonMembers.resize(frame.firstMember);
+    m_buffer.push_back('}');
+}
+
+void StatusWriter::groupRepeatedJsonKeys(const Frame& frame)
+{
+    // Rewrites the members of the object, which are at the end of the buffer, with each key once.  A key that was
+    // repeated gets an array of its values in the order they were written.
+    size_t memberCount = m_jsonMembers.size() - frame.firstMember;
+    std::vector<Bool> isWritten(memberCount, false);
+    std::string grouped;
+    grouped.reserve(m_buffer.size() - frame.contentOffset + 2 * memberCount);
+
+    for (size_t i = 0; i < memberCount; i++)
+    {
+        if (isWritten[i])
+        {
+            continue;
+        }
+
+        const JsonMember& member = m_jsonMembers[frame.firstMember + i];
+        if (grouped.empty() == false)
+        {
+            grouped.push_back(',');
+        }
+        grouped.append(m_buffer, member.keyOffset - 1, member.valueOffset - member.keyOffset + 1);
+
+        Bool isRepeated = false;
+        for (size_t j = i + 1; j < memberCount; j++)
+        {
+            if (isSameJsonKey(m_jsonMembers[frame.firstMember + j], member))
+            {
+                isRepeated = true;
+                break;
+            }
+        }
+
+        if (isRepeated == false)
+        {
+            grouped.append(m_buffer, member.valueOffset, member.valueEnd - member.valueOffset);
+            continue;
+        }
+
+        grouped.push_back('[');
+        for (size_t j = i; j < memberCount; j++)
+        {
+            const JsonMember& repeated = m_jsonMembers[frame.firstMember + j];
+            if ((j == i) || ((isWritten[j] == false) && isSameJsonKey(repeated, member)))
+            {
+                if (j != i)
+                {
+                    grouped.push_back(',');
+                }
+                grouped.append(m_buffer, repeated.valueOffset, repeated.valueEnd - repeated.valueOffset);
+                isWritten[j] = true;
+            }
+        }
+        grouped.push_back(']');
+    }
+
+    m_buffer.replace(frame.contentOffset, std::string::npos, grouped);
+}
+
+Bool StatusWriter::isSameJsonKey(const JsonMember& lhs, const JsonMember& rhs) const
+{
+    return (lhs.keyLength == rhs.keyLength) &&
+        (m_buffer.compare(lhs.keyOffset, lhs.keyLength, m_buffer, rhs.keyOffset, rhs.keyLength) == 0);
+}
+
+void StatusWriter::appendIndent(void)
+{
+    m_buffer.append(m_frames.size() - 1, '\t');
+}
+
+void StatusWriter::appendXmlEscaped(const std::string& text)
+{
+    for (auto c = text.begin(); c != text.end(); ++c)
+    {
+        switch (*c)
+        {
+            case '<':
+                m_buffer.append("&lt;");
+                break;
+            case '>':
+                m_buffer.append("&gt;");
+                break;
+            case '\'':
+                m_buffer.append("&apos;");
+                break;
+            case '"':
+                m_buffer.append("&quot;");
+                break;
+            case '&':
+                m_buffer.append("&amp;");
+                break;
+            default:
+                m_buffer.push_back(*c);
+                break;
+        }
+    }
+}
+
+void StatusWriter::appendJsonEscaped(const std::string& text)
+{
+    static const char hexDigits[] = "0123456789abcdef";
+
+    for (auto c = text.begin(); c != text.end(); ++c)
+    {
+        switch (*c)
+        {
+            case '"':
+                m_buffer.append("\\\"");
+                break;
+            case '\\':
+                m_buffer.append("\\\\");
+                break;
+            case '\n':
+                m_buffer.append("\\n");
+                break;
+            case '\r':
+                m_buffer.append("\\r");
+                break;
+            case '\t':
+                m_buffer.append("\\t");
+                break;
+            default:
+                if (static_cast<unsigned char>(*c) < 0x20)
+                {
+                    m_buffer.append("\\u00");
+                    m_buffer.push_back(hexDigits[(static_cast<unsigned char>(*c) >> 4) & 0xF]);
+                    m_buffer.push_back(hexDigits[static_cast<unsigned char>(*c) & 0xF]);
+                }
+                else
+                {
+                    m_buffer.push_back(*c);
+                }
+                break;
+        }
+    }
+}
+
+StatusWriter::Frame& StatusWriter::currentFrame(void)
+{
+    return m_frames.back();
+}
+
+void StatusWriter::pushFrame(size_t tagOffset, size_t tagLength, Bool isList)
+{
+    Frame frame;
+    frame.tagOffset = tagOffset;
+    frame.tagLength = tagLength;
+    frame.hasChildren = false;
+    frame.isList = isList;
+    frame.contentOffset = m_buffer.size();
+    frame.firstMember = m_jsonMembers.size();
+    frame.hasRepeatedKeys = false;
+    m_frames.push_back(frame);
+}
\ No newline at end of file
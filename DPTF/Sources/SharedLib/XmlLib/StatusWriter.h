@@ -0,0 +1,109 @@
+/******************************************************************************
+** Copyright (c) 2013-2016 Intel Corporation All Rights Reserved
+**
+** Licensed under the Apache License, Version 2.0 (the "License"); you may not
+** use this file except in compliance with the License.
+**
+** You may obtain a copy of the License at
+**     http://www.apache.org/licenses/LICENSE-2.0
+**
+** Unless required by applicable law or agreed to in writing, software
+** distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+** WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+**
+** See the License for the specific language governing permissions and
+** limitations under the License.
+**
+******************************************************************************/
+
+#pragma once
+
+#include "Dptf.h"
+
+namespace StatusOutputFormat
+{
+    enum Type
+    {
+        Xml,
+        Json
+    };
+}
+
+//
+// Writes status documents straight into a single buffer as elements are begun and ended, so no node tree is built.
+// The buffer keeps its capacity across reset() so a long lived writer stops allocating once it has grown.
+//
+// Xml output matches what RapidXML prints for the equivalent XmlNode tree.  Json output is compact:  wrapper
+// elements become objects, data elements become string members and comments are dropped.  Elements that can repeat
+// should be written between beginList() and endList() so Json always gets an array for them, however many there
+// are.  Documents re-emitted through addXmlDocument() carry no list information, so when an object ends, members
+// that share a key are grouped into one array member at the position of the first, wherever they were written.
+//
+class StatusWriter final
+{
+public:
+
+    StatusWriter(StatusOutputFormat::Type format = StatusOutputFormat::Xml);
+
+    void reset(StatusOutputFormat::Type format);
+    StatusOutputFormat::Type getFormat(void) const;
+
+    void beginElement(const std::string& tagName);
+    void endElement(void);
+    void addDataElement(const std::string& tagName, const std::string& data);
+
+    // Json writes the elements added until endList() as an array named tagName.  Xml has no list markup, so the
+    // elements are written where they are and tagName is not used.
+    void beginList(const std::string& tagName);
+    void endList(void);
+
+    // The comment text is written verbatim, so include any padding wanted inside the delimiters
+    void addComment(const std::string& comment);
+
+    // Re-emits a serialized XML document, such as the status returned by a policy, in the writer's format.  An Xml
+    // writer that is still empty takes the document unchanged and completes it.
+    void addXmlDocument(const std::string& xml);
+
+    // Closes the document and returns it.  The content stays valid until the next reset().
+    const std::string& getContent(void);
+
+private:
+
+    struct Frame
+    {
+        size_t tagOffset;           // Xml only
+        size_t tagLength;
+        Bool hasChildren;
+        Bool isList;
+        size_t contentOffset;       // Json only:  start of the object members
+        size_t firstMember;         // Json only:  index of the first object member in m_jsonMembers
+        Bool hasRepeatedKeys;
+    };
+
+    // Json object member text in m_buffer.  The members of every open object are kept so they can be grouped.
+    struct JsonMember
+    {
+        size_t keyOffset;
+        size_t keyLength;
+        size_t valueOffset;
+        size_t valueEnd;
+    };
+
+    StatusOutputFormat::Type m_format;
+    std::string m_buffer;
+    std::vector<Frame> m_frames;
+    std::vector<JsonMember> m_jsonMembers;
+    std::vector<size_t> m_openXmlLists;
+    Bool m_finished;
+
+    void beginXmlChild(void);
+    void beginJsonChild(const std::string& tagName);
+    void endJsonObject(const Frame& frame);
+    void groupRepeatedJsonKeys(const Frame& frame);
+    Bool isSameJsonKey(const JsonMember& lhs, const JsonMember& rhs) const;
+    void appendIndent(void);
+    void appendXmlEscaped(const std::string& text);
+    void appendJsonEscaped(const std::string& text);
+    Frame& currentFrame(void);
+    void pushFrame(size_t tagOffset, size_t tagLength, Bool isList = false);
+};
\ No newline at end of file
@@ -17,7 +17,6 @@
 ******************************************************************************/
 
 #include "XmlNode.h"
-#include "XmlGeneratorFactory.h"
 
 XmlNode::XmlNode(NodeType::Type type, std::string rootXmlTag) :
     m_type(type), m_rootXmlTag(rootXmlTag), m_data("")
@@ -90,15 +89,45 @@ std::string XmlNode::getData()
 
 std::string XmlNode::toString()
 {
-    XmlGeneratorFactoryInterface* factory = new XmlGeneratorFactory();
-    XmlGeneratorInterface* xmlGenerator = factory->createXmlGeneratorObject(1);
-
-    xmlGenerator->addNode(this);
-
-    std::string s = xmlGenerator->toString();
+    return toString(StatusOutputFormat::Xml);
+}
 
-    delete xmlGenerator;
-    delete factory;
+std::string XmlNode::toString(StatusOutputFormat::Type format)
+{
+    StatusWriter writer(format);
+    write(writer);
+    return writer.getContent();
+}
 
-    return s;
+void XmlNode::write(StatusWriter& writer)
+{
+    switch (m_type)
+    {
+        case NodeType::Root:
+            for (auto child = m_children.begin(); child != m_children.end(); ++child)
+            {
+                (*child)->write(writer);
+            }
+            break;
+        case NodeType::Comment:
+            writer.addComment(m_data);
+            break;
+        case NodeType::Element:
+            if (m_children.empty())
+            {
+                writer.addDataElement(m_rootXmlTag, m_data);
+            }
+            else
+            {
+                writer.beginElement(m_rootXmlTag);
+                for (auto child = m_children.begin(); child != m_children.end(); ++child)
+                {
+                    (*child)->write(writer);
+                }
+                writer.endElement();
+            }
+            break;
+        default:
+            throw dptf_exception("Bad node type.");
+    }
 }
\ No newline at end of file
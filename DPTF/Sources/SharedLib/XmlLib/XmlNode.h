@@ -19,6 +19,7 @@
 #pragma once
 
 #include "Dptf.h"
+#include "StatusWriter.h"
 
 namespace NodeType
 {
@@ -49,6 +50,8 @@ public:
     std::string getData();
     NodeType::Type getNodeType();
     std::string toString();
+    std::string toString(StatusOutputFormat::Type format);
+    void write(StatusWriter& writer);
 
 private:
 
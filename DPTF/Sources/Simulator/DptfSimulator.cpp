@@ -0,0 +1,144 @@
+/******************************************************************************
+** Copyright (c) 2013-2016 Intel Corporation All Rights Reserved
+**
+** Licensed under the Apache License, Version 2.0 (the "License"); you may not
+** use this file except in compliance with the License.
+**
+** You may obtain a copy of the License at
+**     http://www.apache.org/licenses/LICENSE-2.0
+**
+** Unless required by applicable law or agreed to in writing, software
+** distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+** WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+**
+** See the License for the specific language governing permissions and
+** limitations under the License.
+**
+******************************************************************************/
+
+#include "Dptf.h"
+#include "PlatformSimulator.h"
+#include "PlatformTraceCheck.h"
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <iostream>
+
+//
+// Usage: DptfSimulator <trace file> [options]
+//        DptfSimulator --check-trace <scratch file>
+//
+//   --policy <active|passive|critical>   Simulate only this policy.  May be repeated.  Default is all three.
+//   --duration <seconds>                  Stop after this much virtual time instead of at the end of the trace.
+//   --controls <file>                     Write every SET primitive with its virtual time to this file.
+//   --log <file> [level]                  Write DPTF log messages up to level (0 fatal - 4 debug) to this file.
+//
+// A summary with the simulated time, wall time and work item execution cost is written to stdout as comma
+// separated name,value lines.  Record a trace by setting the "PlatformTraceFile" configuration value in the
+// dptf namespace to a file name before DPTF starts.
+//
+// --check-trace writes every kind of trace entry to the scratch file, reads it back and exits with an error if
+// anything differs.
+//
+
+static int usage(const char* programName)
+{
+    std::cerr << "Usage: " << programName << " <trace file> [--policy <active|passive|critical>]... "
+        << "[--duration <seconds>] [--controls <file>] [--log <file> [level]]" << std::endl;
+    std::cerr << "       " << programName << " --check-trace <scratch file>" << std::endl;
+    return 1;
+}
+
+int main(int argc, char* argv[])
+{
+    if (argc < 2)
+    {
+        return usage(argv[0]);
+    }
+
+    if (std::strcmp(argv[1], "--check-trace") == 0)
+    {
+        if (argc != 3)
+        {
+            return usage(argv[0]);
+        }
+
+        try
+        {
+            checkPlatformTraceRoundTrip(argv[2]);
+            std::cout << "platform_trace_round_trip,passed" << std::endl;
+        }
+        catch (std::exception& ex)
+        {
+            std::cerr << ex.what() << std::endl;
+            return 1;
+        }
+        return 0;
+    }
+
+    std::vector<std::string> policyNames;
+    TimeSpan duration = TimeSpan::createInvalid();
+    std::ofstream controlsFile;
+    std::ofstream logFile;
+    eLogType logVerbosity = eLogType::eLogTypeWarning;
+
+    for (int arg = 2; arg < argc; arg++)
+    {
+        if ((std::strcmp(argv[arg], "--policy") == 0) && (arg + 1 < argc))
+        {
+            policyNames.push_back(argv[++arg]);
+        }
+        else if ((std::strcmp(argv[arg], "--duration") == 0) && (arg + 1 < argc))
+        {
+            double seconds = std::strtod(argv[++arg], nullptr);
+            if (seconds <= 0.0)
+            {
+                return usage(argv[0]);
+            }
+            duration = TimeSpan::createFromMicroseconds((Int64)(seconds * 1000000.0));
+        }
+        else if ((std::strcmp(argv[arg], "--controls") == 0) && (arg + 1 < argc))
+        {
+            controlsFile.open(argv[++arg], std::ios::out | std::ios::trunc);
+        }
+        else if ((std::strcmp(argv[arg], "--log") == 0) && (arg + 1 < argc))
+        {
+            logFile.open(argv[++arg], std::ios::out | std::ios::trunc);
+            if ((arg + 1 < argc) && (argv[arg + 1][0] >= '0') && (argv[arg + 1][0] <= '4'))
+            {
+                logVerbosity = (eLogType)std::atoi(argv[++arg]);
+            }
+        }
+        else
+        {
+            return usage(argv[0]);
+        }
+    }
+
+    try
+    {
+        PlatformSimulator simulator(argv[1]);
+        for (auto policyName = policyNames.begin(); policyName != policyNames.end(); ++policyName)
+        {
+            simulator.addPolicy(*policyName);
+        }
+        if (controlsFile.is_open())
+        {
+            simulator.setControlsOutput(&controlsFile);
+        }
+        if (logFile.is_open())
+        {
+            simulator.setLogOutput(&logFile, logVerbosity);
+        }
+
+        simulator.run(duration);
+        simulator.writeReport(std::cout);
+    }
+    catch (std::exception& ex)
+    {
+        std::cerr << "Simulation failed: " << ex.what() << std::endl;
+        return 1;
+    }
+
+    return 0;
+}
\ No newline at end of file
@@ -0,0 +1,325 @@
+/******************************************************************************
+** Copyright (c) 2013-2016 Intel Corporation All Rights Reserved
+**
+** Licensed under the Apache License, Version 2.0 (the "License"); you may not
+** use this file except in compliance with the License.
+**
+** You may obtain a copy of the License at
+**     http://www.apache.org/licenses/LICENSE-2.0
+**
+** Unless required by applicable law or agreed to in writing, software
+** distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+** WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+**
+** See the License for the specific language governing permissions and
+** limitations under the License.
+**
+******************************************************************************/
+
+#include "PlatformSimulator.h"
+#include "ReplayEsifAppServices.h"
+#include "SimulationWorkItemQueueManager.h"
+#include "PolicyManagerInterface.h"
+#include "ActivePolicy.h"
+#include "CriticalPolicy.h"
+#include "PassivePolicy.h"
+#include <chrono>
+#include <iomanip>
+#include <iostream>
+
+static void destroySimulatedPolicy(PolicyInterface* policyInterface)
+{
+    DELETE_MEMORY_TC(policyInterface);
+}
+
+static std::string toString(eEsifError rc)
+{
+    return esif_rc_str(rc);
+}
+
+static PolicyBase* newPolicy(const std::string& policyName)
+{
+    if (policyName == "active")
+    {
+        return new ActivePolicy();
+    }
+    else if (policyName == "passive")
+    {
+        return new PassivePolicy();
+    }
+    else
+    {
+        return new CriticalPolicy();
+    }
+}
+
+PlatformSimulator::PlatformSimulator(const std::string& traceFileName) :
+    m_clock(std::make_shared<SimulationClock>()), m_dptfManager(nullptr),
+    m_traceEndTime(TimeSpan::createFromMicroseconds(0)), m_logVerbosity(eLogType::eLogTypeFatal),
+    m_simulatedTime(TimeSpan::createFromMicroseconds(0)), m_wallSeconds(0.0), m_replayedEntryCount(0),
+    m_unmatchedCallCount(0), m_workItemCount(0), m_workItemExecutionTimeNanoseconds(0)
+{
+    GetApplicationInterface(&m_appInterface);
+    m_dptfManager = new SimulationDptfManager(m_clock.get());
+
+    try
+    {
+        loadTrace(traceFileName);
+    }
+    catch (...)
+    {
+        DELETE_MEMORY_TC(m_dptfManager);
+        throw;
+    }
+}
+
+PlatformSimulator::~PlatformSimulator(void)
+{
+    DELETE_MEMORY_TC(m_dptfManager);
+}
+
+void PlatformSimulator::setControlsOutput(std::ostream* controlsOutput)
+{
+    m_dptfManager->getReplayServices()->setControlsOutput(controlsOutput);
+}
+
+void PlatformSimulator::setLogOutput(std::ostream* logOutput, eLogType logVerbosity)
+{
+    m_dptfManager->getReplayServices()->setLogOutput(logOutput);
+    m_logVerbosity = logVerbosity;
+}
+
+void PlatformSimulator::addPolicy(const std::string& policyName)
+{
+    if ((policyName != "active") && (policyName != "passive") && (policyName != "critical"))
+    {
+        throw dptf_exception("Unknown policy " + policyName + ".");
+    }
+    m_policyNames.push_back(policyName);
+}
+
+void PlatformSimulator::run(const TimeSpan& duration)
+{
+    TimeSpan endTime = duration.isValid() ? duration : m_traceEndTime;
+    auto startTime = std::chrono::steady_clock::now();
+
+    startDptf();
+
+    SimulationWorkItemQueueManager* workItemQueueManager = m_dptfManager->getSimulationWorkItemQueueManager();
+    for (auto entry = m_entries.begin(); entry != m_entries.end(); ++entry)
+    {
+        if (entry->time > endTime)
+        {
+            break;
+        }
+
+        workItemQueueManager->runUntil(entry->time);
+        replayEntry(*entry);
+        m_replayedEntryCount++;
+    }
+    workItemQueueManager->runUntil(endTime);
+    m_simulatedTime = m_clock->getCurrentTime();
+
+    // Shutting down deletes the queue manager and the ESIF services, so collect their statistics first
+    m_unmatchedCallCount = m_dptfManager->getReplayServices()->getUnmatchedCallCount();
+    m_workItemCount = workItemQueueManager->getExecutedCount();
+    m_workItemExecutionTimeNanoseconds = workItemQueueManager->getExecutionTimeNanoseconds();
+
+    m_dptfManager->shutDown();
+
+    m_wallSeconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - startTime).count();
+}
+
+void PlatformSimulator::writeReport(std::ostream& output) const
+{
+    double workItemMilliseconds = m_workItemExecutionTimeNanoseconds / 1000000.0;
+    double simulatedHours = m_simulatedTime.asHours();
+
+    output << std::fixed << std::setprecision(3);
+    output << "simulated_seconds," << m_simulatedTime.asSeconds() << std::endl;
+    output << "wall_seconds," << m_wallSeconds << std::endl;
+    output << "speedup," << ((m_wallSeconds > 0.0) ? (m_simulatedTime.asSeconds() / m_wallSeconds) : 0.0) << std::endl;
+    output << "replayed_entries," << m_replayedEntryCount << std::endl;
+    output << "unmatched_esif_calls," << m_unmatchedCallCount << std::endl;
+    output << "work_items," << m_workItemCount << std::endl;
+    output << "work_item_execution_ms," << workItemMilliseconds << std::endl;
+    output << "work_item_execution_ms_per_simulated_hour,"
+        << ((simulatedHours > 0.0) ? (workItemMilliseconds / simulatedHours) : 0.0) << std::endl;
+}
+
+void PlatformSimulator::loadTrace(const std::string& traceFileName)
+{
+    PlatformTraceReader reader(traceFileName);
+    ReplayEsifAppServices* replayServices = m_dptfManager->getReplayServices();
+
+    PlatformTraceEntry entry;
+    while (reader.read(entry))
+    {
+        if (entry.time > m_traceEndTime)
+        {
+            m_traceEndTime = entry.time;
+        }
+
+        if ((entry.type == PlatformTraceEntryType::Primitive) ||
+            (entry.type == PlatformTraceEntryType::Configuration))
+        {
+            replayServices->addEntry(entry);
+        }
+        else
+        {
+            m_entries.push_back(entry);
+        }
+    }
+}
+
+void PlatformSimulator::startDptf(void)
+{
+    std::vector<std::string> policyNames = m_policyNames;
+    if (policyNames.empty())
+    {
+        policyNames.push_back("active");
+        policyNames.push_back("passive");
+        policyNames.push_back("critical");
+    }
+
+    // The supported policy list is read when DPTF starts, so the policies are constructed before that
+    std::vector<PolicyBase*> policies;
+    std::vector<Guid> policyGuids;
+    for (auto policyName = policyNames.begin(); policyName != policyNames.end(); ++policyName)
+    {
+        policies.push_back(newPolicy(*policyName));
+        policyGuids.push_back(policies.back()->getGuid());
+    }
+    m_dptfManager->getReplayServices()->setDefaultSupportedPolicies(policyGuids);
+    m_dptfManager->createDptfManager(nullptr, nullptr, "", m_logVerbosity, true);
+
+    for (size_t policyNumber = 0; policyNumber < policies.size(); policyNumber++)
+    {
+        const std::string& policyName = policyNames[policyNumber];
+        PolicyBase* policy = policies[policyNumber];
+
+        // Must happen before the policy is created so its timers and statistics use virtual time
+        policy->overrideTimeObject(m_clock);
+
+        // Policies that are not in the recorded IDSP are destroyed here, just as DPTF would not load them.  A
+        // policy that fails to create is skipped like it is in WIPolicyCreateAll.
+        try
+        {
+            m_dptfManager->createPolicy(policyName, policy, destroySimulatedPolicy);
+        }
+        catch (std::exception& ex)
+        {
+            std::cerr << "Policy " << policyName << " was not created: " << ex.what() << std::endl;
+        }
+    }
+
+    if (m_dptfManager->getPolicyManager()->getPolicyListCount() == 0)
+    {
+        throw dptf_exception("DPTF was not able to load any policies.");
+    }
+}
+
+void PlatformSimulator::replayEntry(PlatformTraceEntry& entry)
+{
+    switch (entry.type)
+    {
+        case PlatformTraceEntryType::ParticipantCreate:
+            replayParticipantCreate(entry);
+            break;
+        case PlatformTraceEntryType::ParticipantDestroy:
+            m_appInterface.fParticipantDestroyFuncPtr(getAppHandle(), getHandle(entry.participantIndex));
+            m_failedParticipants.erase(entry.participantIndex);
+            break;
+        case PlatformTraceEntryType::DomainCreate:
+            // ESIF does not create domains for a participant that DPTF failed to create
+            if (m_failedParticipants.find(entry.participantIndex) == m_failedParticipants.end())
+            {
+                replayDomainCreate(entry);
+            }
+            break;
+        case PlatformTraceEntryType::DomainDestroy:
+            if (m_failedParticipants.find(entry.participantIndex) == m_failedParticipants.end())
+            {
+                m_appInterface.fDomainDestroyFuncPtr(getAppHandle(), getHandle(entry.participantIndex),
+                    getHandle(entry.domainIndex));
+            }
+            break;
+        case PlatformTraceEntryType::Event:
+            replayEvent(entry);
+            break;
+        default:
+            break;
+    }
+}
+
+void PlatformSimulator::replayParticipantCreate(PlatformTraceEntry& entry)
+{
+    void* participantHandle = nullptr;
+    eEsifError rc = m_appInterface.fParticipantAllocateHandleFuncPtr(getAppHandle(), &participantHandle);
+    if (rc != ESIF_OK)
+    {
+        throw dptf_exception("Failed to allocate participant handle: " + toString(rc));
+    }
+
+    // Recorded primitives are matched by index so participants must land where they did on the real system
+    UIntN participantIndex = m_dptfManager->getIndexContainer()->getIndex((IndexStructPtr)participantHandle);
+    if (participantIndex != entry.participantIndex)
+    {
+        throw dptf_exception("Participant was created at index " + std::to_string(participantIndex) +
+            " but was recorded at index " + std::to_string(entry.participantIndex) + ".");
+    }
+
+    AppParticipantData participantData = createAppParticipantData(entry);
+    rc = m_appInterface.fParticipantCreateFuncPtr(getAppHandle(), participantHandle, &participantData,
+        (eParticipantState)entry.state);
+    if (rc != ESIF_OK)
+    {
+        m_failedParticipants.insert(entry.participantIndex);
+    }
+}
+
+void PlatformSimulator::replayDomainCreate(PlatformTraceEntry& entry)
+{
+    void* participantHandle = getHandle(entry.participantIndex);
+    void* domainHandle = nullptr;
+    eEsifError rc = m_appInterface.fDomainAllocateHandleFuncPtr(getAppHandle(), participantHandle, &domainHandle);
+    if (rc != ESIF_OK)
+    {
+        throw dptf_exception("Failed to allocate domain handle: " + toString(rc));
+    }
+
+    UIntN domainIndex = m_dptfManager->getIndexContainer()->getIndex((IndexStructPtr)domainHandle);
+    if (domainIndex != entry.domainIndex)
+    {
+        throw dptf_exception("Domain was created at index " + std::to_string(domainIndex) +
+            " but was recorded at index " + std::to_string(entry.domainIndex) + ".");
+    }
+
+    AppDomainData domainData = createAppDomainData(entry);
+    m_appInterface.fDomainCreateFuncPtr(getAppHandle(), participantHandle, domainHandle, &domainData,
+        (eDomainState)entry.state);
+}
+
+void PlatformSimulator::replayEvent(PlatformTraceEntry& entry)
+{
+    if (entry.data.size() != 2)
+    {
+        throw dptf_exception("Platform trace event is missing data.");
+    }
+
+    EsifData eventGuid = createEsifData(entry.data[0]);
+    EsifData eventData = createEsifData(entry.data[1]);
+    m_appInterface.fAppEventFuncPtr(getAppHandle(), getHandle(entry.participantIndex), getHandle(entry.domainIndex),
+        (entry.state != 0) ? &eventData : nullptr, &eventGuid);
+}
+
+const void* PlatformSimulator::getAppHandle(void) const
+{
+    // The application interface casts the handle back to DptfManagerInterface
+    return static_cast<DptfManagerInterface*>(m_dptfManager);
+}
+
+void* PlatformSimulator::getHandle(UIntN index) const
+{
+    return (void*)m_dptfManager->getIndexContainer()->getIndexPtr(index);
+}
\ No newline at end of file
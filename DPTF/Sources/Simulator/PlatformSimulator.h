@@ -0,0 +1,85 @@
+/******************************************************************************
+** Copyright (c) 2013-2016 Intel Corporation All Rights Reserved
+**
+** Licensed under the Apache License, Version 2.0 (the "License"); you may not
+** use this file except in compliance with the License.
+**
+** You may obtain a copy of the License at
+**     http://www.apache.org/licenses/LICENSE-2.0
+**
+** Unless required by applicable law or agreed to in writing, software
+** distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+** WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+**
+** See the License for the specific language governing permissions and
+** limitations under the License.
+**
+******************************************************************************/
+
+#pragma once
+
+#include "Dptf.h"
+#include "PlatformTrace.h"
+#include "SimulationClock.h"
+#include "SimulationDptfManager.h"
+#include <ostream>
+#include <set>
+
+//
+// Replays a platform trace into DPTF with the Active, Passive and Critical policies linked in.  Participants,
+// domains and events arrive at their recorded times, primitives are answered from the trace, and policy timers
+// fire in virtual time, so hours of platform activity run in seconds and every run of a trace is identical.
+//
+
+class PlatformSimulator
+{
+public:
+
+    PlatformSimulator(const std::string& traceFileName);
+    ~PlatformSimulator(void);
+
+    // SET primitive calls are written here so the control decisions of two builds can be compared
+    void setControlsOutput(std::ostream* controlsOutput);
+
+    // DPTF log messages up to the given level are written here
+    void setLogOutput(std::ostream* logOutput, eLogType logVerbosity);
+
+    // Names are "active", "passive" and "critical".  All three are simulated if none are added.
+    void addPolicy(const std::string& policyName);
+
+    // Runs to the end of the trace, or for the given duration when it is valid
+    void run(const TimeSpan& duration);
+
+    void writeReport(std::ostream& output) const;
+
+private:
+
+    // hide the copy constructor and assignment operator.
+    PlatformSimulator(const PlatformSimulator& rhs);
+    PlatformSimulator& operator=(const PlatformSimulator& rhs);
+
+    std::shared_ptr<SimulationClock> m_clock;
+    SimulationDptfManager* m_dptfManager;
+    AppInterface m_appInterface;
+    std::vector<std::string> m_policyNames;
+    std::vector<PlatformTraceEntry> m_entries;
+    std::set<UIntN> m_failedParticipants;
+    TimeSpan m_traceEndTime;
+    eLogType m_logVerbosity;
+
+    TimeSpan m_simulatedTime;
+    double m_wallSeconds;
+    UInt64 m_replayedEntryCount;
+    UInt64 m_unmatchedCallCount;
+    UInt64 m_workItemCount;
+    UInt64 m_workItemExecutionTimeNanoseconds;
+
+    void loadTrace(const std::string& traceFileName);
+    void startDptf(void);
+    void replayEntry(PlatformTraceEntry& entry);
+    void replayParticipantCreate(PlatformTraceEntry& entry);
+    void replayDomainCreate(PlatformTraceEntry& entry);
+    void replayEvent(PlatformTraceEntry& entry);
+    const void* getAppHandle(void) const;
+    void* getHandle(UIntN index) const;
+};
\ No newline at end of file
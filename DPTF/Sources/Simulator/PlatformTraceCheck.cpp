@@ -0,0 +1,198 @@
+/******************************************************************************
+** Copyright (c) 2013-2016 Intel Corporation All Rights Reserved
+**
+** Licensed under the Apache License, Version 2.0 (the "License"); you may not
+** use this file except in compliance with the License.
+**
+** You may obtain a copy of the License at
+**     http://www.apache.org/licenses/LICENSE-2.0
+**
+** Unless required by applicable law or agreed to in writing, software
+** distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+** WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+**
+** See the License for the specific language governing permissions and
+** limitations under the License.
+**
+******************************************************************************/
+
+#include "PlatformTraceCheck.h"
+#include "PlatformTrace.h"
+#include "esif_ccb_memory.h"
+#include <cstring>
+
+static const char ParticipantName[] = "TSEN";
+static const char ParticipantDescription[] = "Platform Trace Check Sensor";
+static const char ParticipantScope[] = "\\_SB_.PCI0.TSEN";
+static const char DomainName[] = "TMP0";
+static const UInt8 EventGuid[Constants::GuidSize] = {0x50, 0x54, 0x52, 0x41, 0x43, 0x45, 0x43, 0x48, 0x45, 0x43,
+    0x4b, 0x45, 0x56, 0x45, 0x4e, 0x54};
+
+static EsifData createEsifData(esif_data_type type, const void* buffer, UInt32 length)
+{
+    EsifData esifData = {type, const_cast<void*>(buffer), length, length};
+    return esifData;
+}
+
+static EsifData createStringData(const char* text)
+{
+    return createEsifData(ESIF_DATA_STRING, text, (UInt32)std::strlen(text) + 1);
+}
+
+static PlatformTraceData createTraceData(esif_data_type type, const void* buffer, UInt32 length)
+{
+    EsifData esifData = createEsifData(type, buffer, length);
+    return PlatformTraceData(&esifData, length);
+}
+
+static void check(Bool condition, const std::string& what)
+{
+    if (condition == false)
+    {
+        throw dptf_exception("Platform trace round trip failed: " + what + ".");
+    }
+}
+
+static void checkData(const EsifData& actual, const EsifData& expected, const std::string& what)
+{
+    check(actual.type == expected.type, what + " type differs");
+    check(actual.data_len == expected.data_len, what + " length differs");
+    check((expected.data_len == 0) || (std::memcmp(actual.buf_ptr, expected.buf_ptr, expected.data_len) == 0),
+        what + " contents differ");
+}
+
+static void checkData(const PlatformTraceData& actual, const PlatformTraceData& expected, const std::string& what)
+{
+    check(actual.type == expected.type, what + " type differs");
+    check(actual.bytes == expected.bytes, what + " contents differ");
+}
+
+static void checkEntry(const PlatformTraceEntry& actual, const PlatformTraceEntry& expected)
+{
+    std::string what = PlatformTraceEntryType::toString(expected.type) + " entry";
+    check(actual.time == expected.time, what + " time differs");
+    check(actual.type == expected.type, what + " type differs");
+    check(actual.participantIndex == expected.participantIndex, what + " participant differs");
+    check(actual.domainIndex == expected.domainIndex, what + " domain differs");
+    check(actual.primitive == expected.primitive, what + " primitive differs");
+    check(actual.instance == expected.instance, what + " instance differs");
+    check(actual.status == expected.status, what + " status differs");
+    check(actual.state == expected.state, what + " state differs");
+    check(actual.data.size() == expected.data.size(), what + " data count differs");
+    for (size_t index = 0; index < expected.data.size(); index++)
+    {
+        checkData(actual.data[index], expected.data[index], what + " data " + std::to_string(index));
+    }
+}
+
+static void readEntry(PlatformTraceReader& reader, PlatformTraceEntry& entry, PlatformTraceEntryType::Type type)
+{
+    check(reader.read(entry), "trace ended before the " + PlatformTraceEntryType::toString(type) + " entry");
+    check(entry.type == type, PlatformTraceEntryType::toString(type) + " entry was read as " +
+        PlatformTraceEntryType::toString(entry.type));
+}
+
+void checkPlatformTraceRoundTrip(const std::string& fileName)
+{
+    AppParticipantData participantData;
+    esif_ccb_memset(&participantData, 0, sizeof(participantData));
+    participantData.fVersion = 1;
+    participantData.fName = createStringData(ParticipantName);
+    participantData.fDesc = createStringData(ParticipantDescription);
+    participantData.fAcpiScope = createStringData(ParticipantScope);
+    participantData.fDomainCount = 1;
+    participantData.fAcpiType = ESIF_DOMAIN_TYPE_TEMPERATURE;
+
+    AppDomainData domainData;
+    esif_ccb_memset(&domainData, 0, sizeof(domainData));
+    domainData.fVersion = 1;
+    domainData.fName = createStringData(DomainName);
+    domainData.fType = ESIF_DOMAIN_TYPE_TEMPERATURE;
+
+    UInt32 temperature = 3215;
+    UInt32 fanSpeed = 50;
+    PlatformTraceEntry temperatureEntry;
+    temperatureEntry.type = PlatformTraceEntryType::Primitive;
+    temperatureEntry.participantIndex = 0;
+    temperatureEntry.domainIndex = 0;
+    temperatureEntry.primitive = GET_TEMPERATURE;
+    temperatureEntry.data.push_back(PlatformTraceData());
+    temperatureEntry.data.push_back(createTraceData(ESIF_DATA_TEMPERATURE, &temperature, sizeof(temperature)));
+
+    PlatformTraceEntry fanSpeedEntry;
+    fanSpeedEntry.type = PlatformTraceEntryType::Primitive;
+    fanSpeedEntry.participantIndex = 0;
+    fanSpeedEntry.domainIndex = 0;
+    fanSpeedEntry.primitive = SET_FAN_LEVEL;
+    fanSpeedEntry.instance = 2;
+    fanSpeedEntry.status = ESIF_E_PRIMITIVE_NOT_FOUND_IN_DSP;
+    fanSpeedEntry.data.push_back(createTraceData(ESIF_DATA_PERCENT, &fanSpeed, sizeof(fanSpeed)));
+    fanSpeedEntry.data.push_back(PlatformTraceData());
+
+    PlatformTraceEntry configurationEntry;
+    configurationEntry.type = PlatformTraceEntryType::Configuration;
+    configurationEntry.data.push_back(createTraceData(ESIF_DATA_STRING, "dptf", 5));
+    configurationEntry.data.push_back(createTraceData(ESIF_DATA_STRING, "PlatformTraceCheck", 19));
+    configurationEntry.data.push_back(createTraceData(ESIF_DATA_UINT32, &temperature, sizeof(temperature)));
+
+    EsifData eventGuid = createEsifData(ESIF_DATA_GUID, EventGuid, sizeof(EventGuid));
+    EsifData eventData = createEsifData(ESIF_DATA_UINT32, &temperature, sizeof(temperature));
+
+    // Written in a block so the file is closed before it is read back
+    {
+        PlatformTraceWriter writer(fileName);
+        writer.writeParticipantCreate(0, &participantData, eParticipantStateEnabled);
+        writer.writeDomainCreate(0, 0, &domainData, eDomainStateEnabled);
+        writer.write(temperatureEntry);
+        writer.write(fanSpeedEntry);
+        writer.write(configurationEntry);
+        writer.writeEvent(0, 0, &eventGuid, nullptr);
+        writer.writeEvent(0, 0, &eventGuid, &eventData);
+        writer.writeDestroy(PlatformTraceEntryType::DomainDestroy, 0, 0);
+        writer.writeDestroy(PlatformTraceEntryType::ParticipantDestroy, 0, Constants::Invalid);
+    }
+
+    PlatformTraceReader reader(fileName);
+    PlatformTraceEntry entry;
+
+    readEntry(reader, entry, PlatformTraceEntryType::ParticipantCreate);
+    check((entry.participantIndex == 0) && (entry.state == eParticipantStateEnabled), "participant create differs");
+    AppParticipantData readParticipantData = createAppParticipantData(entry);
+    check(readParticipantData.fVersion == participantData.fVersion, "participant version differs");
+    check(readParticipantData.fDomainCount == participantData.fDomainCount, "participant domain count differs");
+    check(readParticipantData.fAcpiType == participantData.fAcpiType, "participant type differs");
+    checkData(readParticipantData.fName, participantData.fName, "participant name");
+    checkData(readParticipantData.fDesc, participantData.fDesc, "participant description");
+    checkData(readParticipantData.fAcpiScope, participantData.fAcpiScope, "participant scope");
+    checkData(readParticipantData.fDriverName, participantData.fDriverName, "participant driver name");
+
+    readEntry(reader, entry, PlatformTraceEntryType::DomainCreate);
+    check((entry.participantIndex == 0) && (entry.domainIndex == 0) && (entry.state == eDomainStateEnabled),
+        "domain create differs");
+    AppDomainData readDomainData = createAppDomainData(entry);
+    check(readDomainData.fType == domainData.fType, "domain type differs");
+    checkData(readDomainData.fName, domainData.fName, "domain name");
+    checkData(readDomainData.fGuid, domainData.fGuid, "domain guid");
+
+    readEntry(reader, entry, PlatformTraceEntryType::Primitive);
+    checkEntry(entry, temperatureEntry);
+    readEntry(reader, entry, PlatformTraceEntryType::Primitive);
+    checkEntry(entry, fanSpeedEntry);
+    readEntry(reader, entry, PlatformTraceEntryType::Configuration);
+    checkEntry(entry, configurationEntry);
+
+    readEntry(reader, entry, PlatformTraceEntryType::Event);
+    check((entry.state == 0) && (entry.data.size() == 2) && entry.data[1].bytes.empty(),
+        "event without data differs");
+    checkData(createEsifData(entry.data[0]), eventGuid, "event guid");
+    readEntry(reader, entry, PlatformTraceEntryType::Event);
+    check((entry.state == 1) && (entry.data.size() == 2), "event with data differs");
+    checkData(createEsifData(entry.data[1]), eventData, "event data");
+
+    readEntry(reader, entry, PlatformTraceEntryType::DomainDestroy);
+    check((entry.participantIndex == 0) && (entry.domainIndex == 0), "domain destroy differs");
+    readEntry(reader, entry, PlatformTraceEntryType::ParticipantDestroy);
+    check((entry.participantIndex == 0) && (entry.domainIndex == Constants::Invalid), "participant destroy differs");
+
+    check(reader.read(entry) == false, "trace has entries that were not written");
+}
\ No newline at end of file
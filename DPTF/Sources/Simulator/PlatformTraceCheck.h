@@ -0,0 +1,29 @@
+/******************************************************************************
+** Copyright (c) 2013-2016 Intel Corporation All Rights Reserved
+**
+** Licensed under the Apache License, Version 2.0 (the "License"); you may not
+** use this file except in compliance with the License.
+**
+** You may obtain a copy of the License at
+**     http://www.apache.org/licenses/LICENSE-2.0
+**
+** Unless required by applicable law or agreed to in writing, software
+** distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+** WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+**
+** See the License for the specific language governing permissions and
+** limitations under the License.
+**
+******************************************************************************/
+
+#pragma once
+
+#include "Dptf.h"
+
+//
+// Writes one entry of every type with the platform trace writer, reads the file back and compares each field, so
+// a change to the trace format that breaks replay is caught before a recorded trace is needed.  Throws on the first
+// difference.
+//
+
+void checkPlatformTraceRoundTrip(const std::string& fileName);
\ No newline at end of file
@@ -0,0 +1,401 @@
+/******************************************************************************
+** Copyright (c) 2013-2016 Intel Corporation All Rights Reserved
+**
+** Licensed under the Apache License, Version 2.0 (the "License"); you may not
+** use this file except in compliance with the License.
+**
+** You may obtain a copy of the License at
+**     http://www.apache.org/licenses/LICENSE-2.0
+**
+** Unless required by applicable law or agreed to in writing, software
+** distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+** WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+**
+** See the License for the specific language governing permissions and
+** limitations under the License.
+**
+******************************************************************************/
+
+#include "ReplayEsifAppServices.h"
+#include "esif_ccb_memory.h"
+#include <algorithm>
+#include <cstring>
+#include <iomanip>
+
+// How far past the current virtual time a recorded result may be and still count as the answer to the same call.
+// Covers the time the recorded DPTF took to get from an event or timer to the primitive call.
+static const Int64 ResultLookaheadMicroseconds = 1000000;
+
+// Layout of each entry in the GET_SUPPORTED_POLICIES result
+#pragma pack(push, 1)
+typedef struct _ReplayAcpiEsifGuid
+{
+    union esif_data_variant esifDataVariant;
+    UInt8 guid[Constants::GuidSize];
+} ReplayAcpiEsifGuid;
+#pragma pack(pop)
+
+static std::vector<UInt8> getBytes(const EsifDataPtr esifData)
+{
+    std::vector<UInt8> bytes;
+    if ((esifData != nullptr) && (esifData->buf_ptr != nullptr) && (esifData->buf_len > 0))
+    {
+        const UInt8* source = static_cast<const UInt8*>(esifData->buf_ptr);
+        bytes.assign(source, source + esifData->buf_len);
+    }
+    return bytes;
+}
+
+static std::string getString(const UInt8* bytes, size_t length)
+{
+    const char* text = reinterpret_cast<const char*>(bytes);
+    size_t end = 0;
+    while ((end < length) && (text[end] != '\0'))
+    {
+        end++;
+    }
+    return std::string(text, end);
+}
+
+static std::string getString(const EsifDataPtr esifData)
+{
+    if ((esifData == nullptr) || (esifData->buf_ptr == nullptr))
+    {
+        return std::string();
+    }
+    return getString(static_cast<const UInt8*>(esifData->buf_ptr), esifData->buf_len);
+}
+
+static std::string getString(const PlatformTraceData& data)
+{
+    return data.bytes.empty() ? std::string() : getString(&data.bytes[0], data.bytes.size());
+}
+
+Bool ReplayEsifAppServices::PrimitiveKey::operator<(const PrimitiveKey& rhs) const
+{
+    if (participantIndex != rhs.participantIndex)
+    {
+        return participantIndex < rhs.participantIndex;
+    }
+    if (domainIndex != rhs.domainIndex)
+    {
+        return domainIndex < rhs.domainIndex;
+    }
+    if (primitive != rhs.primitive)
+    {
+        return primitive < rhs.primitive;
+    }
+    return instance < rhs.instance;
+}
+
+ReplayEsifAppServices::ReplayEsifAppServices(SimulationClock* clock, IndexContainerInterface* indexContainer) :
+    m_clock(clock), m_indexContainer(indexContainer), m_controlsOutput(nullptr), m_logOutput(nullptr),
+    m_unmatchedCallCount(0)
+{
+}
+
+void ReplayEsifAppServices::addEntry(const PlatformTraceEntry& entry)
+{
+    RecordedResult result;
+    result.time = entry.time.asMicroseconds();
+    result.status = entry.status;
+
+    if ((entry.type == PlatformTraceEntryType::Primitive) && (entry.data.size() == 2))
+    {
+        PrimitiveKey key;
+        key.participantIndex = entry.participantIndex;
+        key.domainIndex = entry.domainIndex;
+        key.primitive = entry.primitive;
+        key.instance = entry.instance;
+        result.data = entry.data[1];
+        m_primitives[key][entry.data[0].bytes].push_back(result);
+    }
+    else if ((entry.type == PlatformTraceEntryType::Configuration) && (entry.data.size() == 3))
+    {
+        result.data = entry.data[2];
+        m_configuration[std::make_pair(getString(entry.data[0]), getString(entry.data[1]))].push_back(result);
+    }
+}
+
+void ReplayEsifAppServices::setDefaultSupportedPolicies(const std::vector<Guid>& policyGuids)
+{
+    PrimitiveKey key;
+    key.participantIndex = Constants::Invalid;
+    key.domainIndex = Constants::Invalid;
+    key.primitive = GET_SUPPORTED_POLICIES;
+    key.instance = Constants::Esif::NoInstance;
+    if (m_primitives.find(key) != m_primitives.end())
+    {
+        return;
+    }
+
+    RecordedResult result;
+    result.time = 0;
+    result.status = ESIF_OK;
+    result.data.type = ESIF_DATA_BINARY;
+    for (auto guid = policyGuids.begin(); guid != policyGuids.end(); ++guid)
+    {
+        ReplayAcpiEsifGuid acpiEsifGuid;
+        esif_ccb_memset(&acpiEsifGuid, 0, sizeof(acpiEsifGuid));
+        guid->copyToBuffer(acpiEsifGuid.guid);
+
+        const UInt8* bytes = reinterpret_cast<const UInt8*>(&acpiEsifGuid);
+        result.data.bytes.insert(result.data.bytes.end(), bytes, bytes + sizeof(acpiEsifGuid));
+    }
+    m_primitives[key][std::vector<UInt8>()].push_back(result);
+}
+
+void ReplayEsifAppServices::setControlsOutput(std::ostream* controlsOutput)
+{
+    m_controlsOutput = controlsOutput;
+}
+
+void ReplayEsifAppServices::setLogOutput(std::ostream* logOutput)
+{
+    m_logOutput = logOutput;
+}
+
+UInt64 ReplayEsifAppServices::getUnmatchedCallCount(void) const
+{
+    return m_unmatchedCallCount;
+}
+
+eIfaceType ReplayEsifAppServices::getInterfaceType(void)
+{
+    return eIfaceTypeEsifService;
+}
+
+UInt16 ReplayEsifAppServices::getInterfaceVersion(void)
+{
+    return ESIF_INTERFACE_VERSION_3;
+}
+
+UInt64 ReplayEsifAppServices::getInterfaceSize(void)
+{
+    return sizeof(EsifInterface);
+}
+
+eEsifError ReplayEsifAppServices::getConfigurationValue(const void* esifHandle, const void* appHandle,
+    const EsifDataPtr nameSpace, const EsifDataPtr elementPath, EsifDataPtr elementValue)
+{
+    auto results = m_configuration.find(std::make_pair(getString(nameSpace), getString(elementPath)));
+    if (results == m_configuration.end())
+    {
+        // Values that were never read on the recorded system were not set there either
+        return ESIF_E_NOT_FOUND;
+    }
+
+    return copyResult(*findResult(results->second), elementValue);
+}
+
+eEsifError ReplayEsifAppServices::setConfigurationValue(const void* esifHandle, const void* appHandle,
+    const EsifDataPtr nameSpace, const EsifDataPtr elementPath, const EsifDataPtr elementValue,
+    const EsifFlags elementFlags)
+{
+    return ESIF_OK;
+}
+
+eEsifError ReplayEsifAppServices::executePrimitive(const void* esifHandle, const void* appHandle,
+    const void* participantHandle, const void* domainHandle, const EsifDataPtr request,
+    EsifDataPtr response, ePrimitiveType primitive, const UInt8 instance)
+{
+    PrimitiveKey key;
+    key.participantIndex = m_indexContainer->getIndex((IndexStructPtr)participantHandle);
+    key.domainIndex = m_indexContainer->getIndex((IndexStructPtr)domainHandle);
+    key.primitive = primitive;
+    key.instance = instance;
+
+    Bool isSetPrimitive = ((response == nullptr) || (response->type == ESIF_DATA_VOID));
+    if (isSetPrimitive)
+    {
+        writeControl(key, request);
+    }
+
+    const RecordedResult* result = findPrimitiveResult(key, request);
+    if (result == nullptr)
+    {
+        m_unmatchedCallCount++;
+
+        // A control the recorded policies never set is still accepted since nothing reads it back from the trace
+        return isSetPrimitive ? ESIF_OK : ESIF_E_PRIMITIVE_NOT_FOUND_IN_DSP;
+    }
+
+    return isSetPrimitive ? result->status : copyResult(*result, response);
+}
+
+eEsifError ReplayEsifAppServices::writeLog(const void* esifHandle, const void* appHandle,
+    const void* participantHandle, const void* domainHandle, const EsifDataPtr message,
+    const eLogType logType)
+{
+    if (m_logOutput != nullptr)
+    {
+        *m_logOutput << std::fixed << std::setprecision(3) << m_clock->getCurrentTime().asSeconds() << " "
+            << getString(message) << std::endl;
+    }
+    return ESIF_OK;
+}
+
+eEsifError ReplayEsifAppServices::registerForEvent(const void* esifHandle, const void* appHandle,
+    const void* participantHandle, const void* domainHandle, const EsifDataPtr eventGuid)
+{
+    // Every recorded event is replayed whether or not DPTF registers for it, just as ESIF delivered it
+    return ESIF_OK;
+}
+
+eEsifError ReplayEsifAppServices::unregisterForEvent(const void* esifHandle, const void* appHandle,
+    const void* participantHandle, const void* domainHandle, const EsifDataPtr eventGuid)
+{
+    return ESIF_OK;
+}
+
+eEsifError ReplayEsifAppServices::sendEvent(const void* esifHandle, const void* appHandle,
+    const void* participantHandle, const void* domainHandle, const EsifDataPtr eventData,
+    const EsifDataPtr eventGuid)
+{
+    return ESIF_OK;
+}
+
+eEsifError ReplayEsifAppServices::executePrimitiveBatch(const void* esifHandle, const void* appHandle,
+    EsifPrimitiveBatchItemPtr items, const UInt32 itemCount, EsifDataPtr response)
+{
+    if ((items == nullptr) || (response == nullptr))
+    {
+        return ESIF_E_PARAMETER_IS_NULL;
+    }
+
+    // Same buffer layout as the ESIF batch call
+    UInt64 requiredSize = 0;
+    for (UInt32 i = 0; i < itemCount; i++)
+    {
+        items[i].fOffset = (UInt32)requiredSize;
+        items[i].fDataLength = 0;
+        items[i].fStatus = ESIF_E_UNSPECIFIED;
+        requiredSize += ESIF_PRIMITIVE_BATCH_ALIGN((UInt64)items[i].fResponseSize);
+    }
+
+    if ((response->buf_len < requiredSize) || ((response->buf_ptr == nullptr) && (requiredSize > 0)))
+    {
+        response->data_len = (UInt32)requiredSize;
+        return ESIF_E_NEED_LARGER_BUFFER;
+    }
+
+    for (UInt32 i = 0; i < itemCount; i++)
+    {
+        EsifData itemResponse;
+        itemResponse.type = (esif_data_type)items[i].fResponseType;
+        itemResponse.buf_ptr = (UInt8*)response->buf_ptr + items[i].fOffset;
+        itemResponse.buf_len = items[i].fResponseSize;
+        itemResponse.data_len = 0;
+
+        items[i].fStatus = executePrimitive(esifHandle, appHandle, items[i].fParticipantHandle,
+            items[i].fDomainHandle, nullptr, &itemResponse, (ePrimitiveType)items[i].fPrimitive, items[i].fInstance);
+        items[i].fDataLength = itemResponse.data_len;
+    }
+    response->data_len = (UInt32)requiredSize;
+
+    return ESIF_OK;
+}
+
+const ReplayEsifAppServices::RecordedResult* ReplayEsifAppServices::findResult(
+    const std::vector<RecordedResult>& results) const
+{
+    // Results were added in time order
+    Int64 now = m_clock->getCurrentTime().asMicroseconds();
+    auto next = std::lower_bound(results.begin(), results.end(), now,
+        [](const RecordedResult& result, Int64 time) { return result.time < time; });
+
+    if ((next != results.end()) && ((next->time - now) <= ResultLookaheadMicroseconds))
+    {
+        return &(*next);
+    }
+    else if (next != results.begin())
+    {
+        return &(*(next - 1));
+    }
+    else
+    {
+        return &results.front();
+    }
+}
+
+const ReplayEsifAppServices::RecordedResult* ReplayEsifAppServices::findPrimitiveResult(const PrimitiveKey& key,
+    const EsifDataPtr request) const
+{
+    auto resultsByRequest = m_primitives.find(key);
+    if ((resultsByRequest == m_primitives.end()) || (resultsByRequest->second.empty()))
+    {
+        return nullptr;
+    }
+
+    auto results = resultsByRequest->second.find(getBytes(request));
+    if (results == resultsByRequest->second.end())
+    {
+        // The request differs from every recorded one, such as a control value the recorded policy never chose
+        results = resultsByRequest->second.begin();
+    }
+
+    return findResult(results->second);
+}
+
+eEsifError ReplayEsifAppServices::copyResult(const RecordedResult& result, EsifDataPtr response) const
+{
+    if ((result.status != ESIF_OK) || (response == nullptr))
+    {
+        return result.status;
+    }
+
+    UInt32 length = (UInt32)result.data.bytes.size();
+    response->data_len = length;
+    if ((response->buf_len < length) || ((response->buf_ptr == nullptr) && (length > 0)))
+    {
+        return ESIF_E_NEED_LARGER_BUFFER;
+    }
+
+    if (length > 0)
+    {
+        esif_ccb_memcpy(response->buf_ptr, &result.data.bytes[0], length);
+    }
+    if (result.data.type != ESIF_DATA_VOID)
+    {
+        response->type = result.data.type;
+    }
+
+    return ESIF_OK;
+}
+
+void ReplayEsifAppServices::writeControl(const PrimitiveKey& key, const EsifDataPtr request) const
+{
+    if (m_controlsOutput == nullptr)
+    {
+        return;
+    }
+
+    std::vector<UInt8> bytes = getBytes(request);
+    std::ostream& output = *m_controlsOutput;
+    output << std::fixed << std::setprecision(3) << m_clock->getCurrentTime().asSeconds() << " "
+        << esif_primitive_str((esif_primitive_type)key.primitive) << " "
+        << (Int32)key.participantIndex << " " << (Int32)key.domainIndex << " " << (UInt32)key.instance << " ";
+
+    if (bytes.size() == sizeof(UInt32))
+    {
+        UInt32 value;
+        std::memcpy(&value, &bytes[0], sizeof(value));
+        output << value;
+    }
+    else if (bytes.size() == sizeof(UInt64))
+    {
+        UInt64 value;
+        std::memcpy(&value, &bytes[0], sizeof(value));
+        output << value;
+    }
+    else
+    {
+        output << std::hex << std::setfill('0');
+        for (auto byte = bytes.begin(); byte != bytes.end(); ++byte)
+        {
+            output << std::setw(2) << (UInt32)*byte;
+        }
+        output << std::dec << std::setfill(' ');
+    }
+    output << std::endl;
+}
\ No newline at end of file
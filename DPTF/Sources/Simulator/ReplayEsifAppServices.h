@@ -0,0 +1,124 @@
+/******************************************************************************
+** Copyright (c) 2013-2016 Intel Corporation All Rights Reserved
+**
+** Licensed under the Apache License, Version 2.0 (the "License"); you may not
+** use this file except in compliance with the License.
+**
+** You may obtain a copy of the License at
+**     http://www.apache.org/licenses/LICENSE-2.0
+**
+** Unless required by applicable law or agreed to in writing, software
+** distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+** WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+**
+** See the License for the specific language governing permissions and
+** limitations under the License.
+**
+******************************************************************************/
+
+#pragma once
+
+#include "Dptf.h"
+#include "esif_sdk_iface_esif.h"
+#include "EsifAppServicesInterface.h"
+#include "IndexContainerInterface.h"
+#include "PlatformTrace.h"
+#include "SimulationClock.h"
+#include <ostream>
+
+//
+// Answers DPTF's calls into ESIF from the primitive results and configuration values in a platform trace.
+//
+// A call is matched on participant, domain, primitive, instance and request data.  When the same call was
+// recorded more than once, the first result recorded shortly after the current virtual time is used since that
+// is what the recorded DPTF saw while handling the same event.  Otherwise the most recent earlier result is used.
+// SET primitives are written to the controls output so two runs can be compared.
+//
+
+class ReplayEsifAppServices : public EsifAppServicesInterface
+{
+public:
+
+    ReplayEsifAppServices(SimulationClock* clock, IndexContainerInterface* indexContainer);
+
+    // Primitive and configuration entries are kept.  Other entry types are ignored.
+    void addEntry(const PlatformTraceEntry& entry);
+
+    // Answers GET_SUPPORTED_POLICIES with these policies when the trace did not record it, such as a trace that
+    // stopped before DPTF started or one that was written by hand
+    void setDefaultSupportedPolicies(const std::vector<Guid>& policyGuids);
+
+    void setControlsOutput(std::ostream* controlsOutput);
+    void setLogOutput(std::ostream* logOutput);
+    UInt64 getUnmatchedCallCount(void) const;
+
+    virtual eIfaceType getInterfaceType(void) override;
+    virtual UInt16 getInterfaceVersion(void) override;
+    virtual UInt64 getInterfaceSize(void) override;
+
+    virtual eEsifError getConfigurationValue(const void* esifHandle, const void* appHandle,
+        const EsifDataPtr nameSpace, const EsifDataPtr elementPath, EsifDataPtr elementValue) override;
+
+    virtual eEsifError setConfigurationValue(const void* esifHandle, const void* appHandle,
+        const EsifDataPtr nameSpace, const EsifDataPtr elementPath, const EsifDataPtr elementValue,
+        const EsifFlags elementFlags) override;
+
+    virtual eEsifError executePrimitive(const void* esifHandle, const void* appHandle,
+        const void* participantHandle, const void* domainHandle, const EsifDataPtr request,
+        EsifDataPtr response, ePrimitiveType primitive, const UInt8 instance) override;
+
+    virtual eEsifError writeLog(const void* esifHandle, const void* appHandle,
+        const void* participantHandle, const void* domainHandle, const EsifDataPtr message,
+        const eLogType logType) override;
+
+    virtual eEsifError registerForEvent(const void* esifHandle, const void* appHandle,
+        const void* participantHandle, const void* domainHandle, const EsifDataPtr eventGuid) override;
+
+    virtual eEsifError unregisterForEvent(const void* esifHandle, const void* appHandle,
+        const void* participantHandle, const void* domainHandle, const EsifDataPtr eventGuid) override;
+
+    virtual eEsifError sendEvent(const void* esifHandle, const void* appHandle,
+        const void* participantHandle, const void* domainHandle, const EsifDataPtr eventData,
+        const EsifDataPtr eventGuid) override;
+
+    virtual eEsifError executePrimitiveBatch(const void* esifHandle, const void* appHandle,
+        EsifPrimitiveBatchItemPtr items, const UInt32 itemCount, EsifDataPtr response) override;
+
+private:
+
+    // hide the copy constructor and assignment operator.
+    ReplayEsifAppServices(const ReplayEsifAppServices& rhs);
+    ReplayEsifAppServices& operator=(const ReplayEsifAppServices& rhs);
+
+    struct RecordedResult
+    {
+        Int64 time;
+        eEsifError status;
+        PlatformTraceData data;
+    };
+
+    struct PrimitiveKey
+    {
+        UIntN participantIndex;
+        UIntN domainIndex;
+        UInt32 primitive;
+        UInt8 instance;
+
+        Bool operator<(const PrimitiveKey& rhs) const;
+    };
+
+    typedef std::map<std::vector<UInt8>, std::vector<RecordedResult>> ResultsByRequest;
+
+    SimulationClock* m_clock;
+    IndexContainerInterface* m_indexContainer;
+    std::ostream* m_controlsOutput;
+    std::ostream* m_logOutput;
+    UInt64 m_unmatchedCallCount;
+    std::map<PrimitiveKey, ResultsByRequest> m_primitives;
+    std::map<std::pair<std::string, std::string>, std::vector<RecordedResult>> m_configuration;
+
+    const RecordedResult* findResult(const std::vector<RecordedResult>& results) const;
+    const RecordedResult* findPrimitiveResult(const PrimitiveKey& key, const EsifDataPtr request) const;
+    eEsifError copyResult(const RecordedResult& result, EsifDataPtr response) const;
+    void writeControl(const PrimitiveKey& key, const EsifDataPtr request) const;
+};
\ No newline at end of file
@@ -0,0 +1,36 @@
+/******************************************************************************
+** Copyright (c) 2013-2016 Intel Corporation All Rights Reserved
+**
+** Licensed under the Apache License, Version 2.0 (the "License"); you may not
+** use this file except in compliance with the License.
+**
+** You may obtain a copy of the License at
+**     http://www.apache.org/licenses/LICENSE-2.0
+**
+** Unless required by applicable law or agreed to in writing, software
+** distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+** WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+**
+** See the License for the specific language governing permissions and
+** limitations under the License.
+**
+******************************************************************************/
+
+#include "SimulationClock.h"
+
+SimulationClock::SimulationClock(void) : m_now(TimeSpan::createFromMicroseconds(0))
+{
+}
+
+TimeSpan SimulationClock::getCurrentTime(void)
+{
+    return m_now;
+}
+
+void SimulationClock::advanceTo(const TimeSpan& time)
+{
+    if (time > m_now)
+    {
+        m_now = time;
+    }
+}
\ No newline at end of file
@@ -0,0 +1,44 @@
+/******************************************************************************
+** Copyright (c) 2013-2016 Intel Corporation All Rights Reserved
+**
+** Licensed under the Apache License, Version 2.0 (the "License"); you may not
+** use this file except in compliance with the License.
+**
+** You may obtain a copy of the License at
+**     http://www.apache.org/licenses/LICENSE-2.0
+**
+** Unless required by applicable law or agreed to in writing, software
+** distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+** WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+**
+** See the License for the specific language governing permissions and
+** limitations under the License.
+**
+******************************************************************************/
+
+#pragma once
+
+#include "Dptf.h"
+#include "TimeInterface.h"
+
+//
+// Virtual time source shared by the policies, the simulated work item queues and the replayed ESIF services.
+// Time only moves when the simulator advances it, so a run gives the same result every time and is not limited
+// by the wall clock.
+//
+
+class SimulationClock : public TimeInterface
+{
+public:
+
+    SimulationClock(void);
+
+    virtual TimeSpan getCurrentTime(void) override;
+
+    // Time never moves backwards.  Requests for an earlier time are ignored.
+    void advanceTo(const TimeSpan& time);
+
+private:
+
+    TimeSpan m_now;
+};
\ No newline at end of file
@@ -0,0 +1,185 @@
+/******************************************************************************
+** Copyright (c) 2013-2016 Intel Corporation All Rights Reserved
+**
+** Licensed under the Apache License, Version 2.0 (the "License"); you may not
+** use this file except in compliance with the License.
+**
+** You may obtain a copy of the License at
+**     http://www.apache.org/licenses/LICENSE-2.0
+**
+** Unless required by applicable law or agreed to in writing, software
+** distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+** WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+**
+** See the License for the specific language governing permissions and
+** limitations under the License.
+**
+******************************************************************************/
+
+#include "SimulationDptfManager.h"
+#include "ReplayEsifAppServices.h"
+#include "SimulationWorkItemQueueManager.h"
+#include "EsifServices.h"
+#include "PolicyManager.h"
+#include "ParticipantManager.h"
+#include "DptfStatus.h"
+#include "IndexContainer.h"
+#include "UniqueIdGenerator.h"
+
+SimulationDptfManager::SimulationDptfManager(SimulationClock* clock) : m_clock(clock),
+    m_dptfManagerCreateFinished(false), m_dptfShuttingDown(false), m_indexContainer(nullptr),
+    m_replayServices(nullptr), m_esifServices(nullptr), m_participantManager(nullptr), m_policyManager(nullptr),
+    m_workItemQueueManager(nullptr), m_dptfStatus(nullptr)
+{
+    m_eventCache = std::make_shared<EventCache>();
+    m_userPreferredCache = std::make_shared<UserPreferredCache>();
+    m_indexContainer = new IndexContainer(Constants::Participants::MaxParticipantEstimate);
+    m_replayServices = new ReplayEsifAppServices(m_clock, m_indexContainer);
+    m_workItemQueueManager = new SimulationWorkItemQueueManager(this, m_clock);
+}
+
+SimulationDptfManager::~SimulationDptfManager(void)
+{
+    shutDown();
+}
+
+void SimulationDptfManager::createDptfManager(const void* esifHandle, EsifInterfacePtr esifInterfacePtr,
+    const std::string& dptfHomeDirectoryPath, eLogType currentLogVerbosityLevel, Bool dptfEnabled)
+{
+    m_dptfHomeDirectoryPath = dptfHomeDirectoryPath;
+    m_esifServices = new EsifServices(this, esifHandle, m_replayServices, currentLogVerbosityLevel);
+    m_participantManager = new ParticipantManager(this);
+    m_policyManager = new PolicyManager(this);
+    m_dptfStatus = new DptfStatus(this);
+    m_dptfManagerCreateFinished = true;
+}
+
+Bool SimulationDptfManager::isDptfManagerCreated(void) const
+{
+    return m_dptfManagerCreateFinished;
+}
+
+Bool SimulationDptfManager::isDptfShuttingDown(void) const
+{
+    return m_dptfShuttingDown;
+}
+
+Bool SimulationDptfManager::isWorkItemQueueManagerCreated(void) const
+{
+    return (m_workItemQueueManager != nullptr);
+}
+
+EsifServicesInterface* SimulationDptfManager::getEsifServices(void) const
+{
+    return m_esifServices;
+}
+
+std::shared_ptr<EventCache> SimulationDptfManager::getEventCache(void) const
+{
+    return m_eventCache;
+}
+
+std::shared_ptr<UserPreferredCache> SimulationDptfManager::getUserPreferredCache(void) const
+{
+    return m_userPreferredCache;
+}
+
+WorkItemQueueManagerInterface* SimulationDptfManager::getWorkItemQueueManager(void) const
+{
+    return m_workItemQueueManager;
+}
+
+PolicyManagerInterface* SimulationDptfManager::getPolicyManager(void) const
+{
+    return m_policyManager;
+}
+
+ParticipantManagerInterface* SimulationDptfManager::getParticipantManager(void) const
+{
+    return m_participantManager;
+}
+
+DptfStatusInterface* SimulationDptfManager::getDptfStatus(void)
+{
+    return m_dptfStatus;
+}
+
+IndexContainerInterface* SimulationDptfManager::getIndexContainer(void) const
+{
+    return m_indexContainer;
+}
+
+PlatformTraceWriter* SimulationDptfManager::getPlatformTrace(void) const
+{
+    return nullptr;
+}
+
+std::string SimulationDptfManager::getDptfHomeDirectoryPath(void) const
+{
+    return m_dptfHomeDirectoryPath;
+}
+
+std::string SimulationDptfManager::getDptfPolicyDirectoryPath(void) const
+{
+    return m_dptfHomeDirectoryPath;
+}
+
+Bool SimulationDptfManager::isDptfPolicyLoadNameOnly(void) const
+{
+    return false;
+}
+
+ReplayEsifAppServices* SimulationDptfManager::getReplayServices(void) const
+{
+    return m_replayServices;
+}
+
+SimulationWorkItemQueueManager* SimulationDptfManager::getSimulationWorkItemQueueManager(void) const
+{
+    return m_workItemQueueManager;
+}
+
+void SimulationDptfManager::createPolicy(const std::string& policyName, PolicyInterface* policyInstance,
+    DestroyPolicyInstanceFuncPtr destroyPolicyInstanceFuncPtr)
+{
+    m_policyManager->createPolicy(policyName, policyInstance, destroyPolicyInstanceFuncPtr);
+}
+
+void SimulationDptfManager::shutDown(void)
+{
+    if (m_dptfShuttingDown == true)
+    {
+        return;
+    }
+    m_dptfShuttingDown = true;
+
+    // Same order as DptfManager::shutDown
+    if (m_workItemQueueManager != nullptr)
+    {
+        m_workItemQueueManager->disableAndEmptyAllQueues();
+    }
+    if (m_policyManager != nullptr)
+    {
+        m_policyManager->destroyAllPolicies();
+    }
+    if (m_participantManager != nullptr)
+    {
+        m_participantManager->destroyAllParticipants();
+    }
+    DELETE_MEMORY_TC(m_workItemQueueManager);
+    DELETE_MEMORY_TC(m_policyManager);
+    DELETE_MEMORY_TC(m_participantManager);
+    DELETE_MEMORY_TC(m_esifServices);
+    DELETE_MEMORY_TC(m_replayServices);
+    DELETE_MEMORY_TC(m_indexContainer);
+    DELETE_MEMORY_TC(m_dptfStatus);
+
+    try
+    {
+        UniqueIdGenerator::destroy();
+        FrameworkEventInfo::destroy();
+    }
+    catch (...)
+    {
+    }
+}
\ No newline at end of file
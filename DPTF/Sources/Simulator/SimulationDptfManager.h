@@ -0,0 +1,95 @@
+/******************************************************************************
+** Copyright (c) 2013-2016 Intel Corporation All Rights Reserved
+**
+** Licensed under the Apache License, Version 2.0 (the "License"); you may not
+** use this file except in compliance with the License.
+**
+** You may obtain a copy of the License at
+**     http://www.apache.org/licenses/LICENSE-2.0
+**
+** Unless required by applicable law or agreed to in writing, software
+** distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+** WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+**
+** See the License for the specific language governing permissions and
+** limitations under the License.
+**
+******************************************************************************/
+
+#pragma once
+
+#include "Dptf.h"
+#include "DptfManagerBase.h"
+#include "PolicyInterface.h"
+#include "SimulationClock.h"
+
+class EsifServices;
+class PolicyManager;
+class ParticipantManager;
+class DptfStatus;
+class IndexContainer;
+class ReplayEsifAppServices;
+class SimulationWorkItemQueueManager;
+
+//
+// DptfManagerInterface for the simulator.  Uses the real participant, policy and ESIF services managers on top of
+// replayed ESIF services and a work item queue that runs in virtual time.  Policies are linked in and created by
+// the simulator instead of being loaded from the policy directory.
+//
+
+class SimulationDptfManager : public DptfManagerBase
+{
+public:
+
+    SimulationDptfManager(SimulationClock* clock);
+    virtual ~SimulationDptfManager(void);
+
+    // Only the home directory path and log verbosity are used.  ESIF is replaced by getReplayServices().
+    virtual void createDptfManager(const void* esifHandle, EsifInterfacePtr esifInterfacePtr,
+        const std::string& dptfHomeDirectoryPath, eLogType currentLogVerbosityLevel, Bool dptfEnabled) override;
+    virtual Bool isDptfManagerCreated(void) const override;
+    virtual Bool isDptfShuttingDown(void) const override;
+    virtual Bool isWorkItemQueueManagerCreated(void) const override;
+    virtual EsifServicesInterface* getEsifServices(void) const override;
+    virtual std::shared_ptr<EventCache> getEventCache(void) const override;
+    virtual std::shared_ptr<UserPreferredCache> getUserPreferredCache(void) const override;
+    virtual WorkItemQueueManagerInterface* getWorkItemQueueManager(void) const override;
+    virtual PolicyManagerInterface* getPolicyManager(void) const override;
+    virtual ParticipantManagerInterface* getParticipantManager(void) const override;
+    virtual DptfStatusInterface* getDptfStatus(void) override;
+    virtual IndexContainerInterface* getIndexContainer(void) const override;
+    virtual PlatformTraceWriter* getPlatformTrace(void) const override;
+    virtual std::string getDptfHomeDirectoryPath(void) const override;
+    virtual std::string getDptfPolicyDirectoryPath(void) const override;
+    virtual Bool isDptfPolicyLoadNameOnly(void) const override;
+
+    // Available as soon as the manager is constructed so the trace can be loaded before DPTF starts
+    ReplayEsifAppServices* getReplayServices(void) const;
+    SimulationWorkItemQueueManager* getSimulationWorkItemQueueManager(void) const;
+
+    void createPolicy(const std::string& policyName, PolicyInterface* policyInstance,
+        DestroyPolicyInstanceFuncPtr destroyPolicyInstanceFuncPtr);
+
+    void shutDown(void);
+
+private:
+
+    // hide the copy constructor and assignment operator.
+    SimulationDptfManager(const SimulationDptfManager& rhs);
+    SimulationDptfManager& operator=(const SimulationDptfManager& rhs);
+
+    SimulationClock* m_clock;
+    Bool m_dptfManagerCreateFinished;
+    Bool m_dptfShuttingDown;
+    std::string m_dptfHomeDirectoryPath;
+
+    std::shared_ptr<EventCache> m_eventCache;
+    std::shared_ptr<UserPreferredCache> m_userPreferredCache;
+    IndexContainer* m_indexContainer;
+    ReplayEsifAppServices* m_replayServices;
+    EsifServices* m_esifServices;
+    ParticipantManager* m_participantManager;
+    PolicyManager* m_policyManager;
+    SimulationWorkItemQueueManager* m_workItemQueueManager;
+    DptfStatus* m_dptfStatus;
+};
\ No newline at end of file
@@ -0,0 +1,256 @@
+/******************************************************************************
+** Copyright (c) 2013-2016 Intel Corporation All Rights Reserved
+**
+** Licensed under the Apache License, Version 2.0 (the "License"); you may not
+** use this file except in compliance with the License.
+**
+** You may obtain a copy of the License at
+**     http://www.apache.org/licenses/LICENSE-2.0
+**
+** Unless required by applicable law or agreed to in writing, software
+** distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+** WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+**
+** See the License for the specific language governing permissions and
+** limitations under the License.
+**
+******************************************************************************/
+
+#include "SimulationWorkItemQueueManager.h"
+#include "DptfStatusInterface.h"
+#include "ParticipantManagerInterface.h"
+#include "XmlNode.h"
+#include "StatusFormat.h"
+#include <chrono>
+
+SimulationWorkItemQueueManager::SimulationWorkItemQueueManager(DptfManagerInterface* dptfManager,
+    SimulationClock* clock) :
+    m_dptfManager(dptfManager), m_clock(clock), m_enqueueingEnabled(true), m_executing(false),
+    m_nextSequenceNumber(0), m_executedCount(0), m_executionTimeNanoseconds(0)
+{
+}
+
+SimulationWorkItemQueueManager::~SimulationWorkItemQueueManager(void)
+{
+    disableAndEmptyAllQueues();
+}
+
+void SimulationWorkItemQueueManager::enqueueImmediateWorkItemAndReturn(WorkItem* workItem)
+{
+    const FrameworkEventData event = (*FrameworkEventInfo::instance())[workItem->getFrameworkEventType()];
+    enqueueImmediateWorkItemAndReturn(workItem, event.priority);
+}
+
+void SimulationWorkItemQueueManager::enqueueImmediateWorkItemAndReturn(WorkItem* workItem, UIntN priority)
+{
+    if (canEnqueueImmediateWorkItem(workItem) == false)
+    {
+        DELETE_MEMORY_TC(workItem);
+        throw dptf_exception("Failed to enqueue work item.  Enqueueing has been disabled.");
+    }
+
+    ImmediateWorkItemQueueKey key;
+    key.priority = priority;
+    key.sequenceNumber = m_nextSequenceNumber++;
+    m_immediateQueue.insert(std::make_pair(key, workItem));
+
+    // The real queue thread would pick this up right away.  If a work item is running it is picked up when
+    // that work item finishes.
+    processImmediateQueue();
+}
+
+void SimulationWorkItemQueueManager::enqueueImmediateWorkItemAndWait(WorkItem* workItem)
+{
+    const FrameworkEventData event = (*FrameworkEventInfo::instance())[workItem->getFrameworkEventType()];
+    enqueueImmediateWorkItemAndWait(workItem, event.priority);
+}
+
+void SimulationWorkItemQueueManager::enqueueImmediateWorkItemAndWait(WorkItem* workItem, UIntN priority)
+{
+    if (m_executing == true)
+    {
+        // Same as WorkItemQueueManager:  a work item waiting on another work item runs it as a function call
+        execute(workItem);
+    }
+    else
+    {
+        enqueueImmediateWorkItemAndReturn(workItem, priority);
+    }
+}
+
+void SimulationWorkItemQueueManager::enqueueDeferredWorkItem(WorkItem* workItem, const TimeSpan& timeUntilExecution)
+{
+    if (m_enqueueingEnabled == false)
+    {
+        DELETE_MEMORY_TC(workItem);
+        throw dptf_exception("Failed to enqueue work item.  Enqueueing has been disabled.");
+    }
+
+    Int64 dueTime = (m_clock->getCurrentTime() + timeUntilExecution).asMicroseconds();
+    m_deferredQueue.insert(std::make_pair(dueTime, workItem));
+}
+
+UIntN SimulationWorkItemQueueManager::removeIfMatches(const WorkItemMatchCriteria& matchCriteria)
+{
+    UIntN numRemoved = 0;
+
+    for (auto it = m_immediateQueue.begin(); it != m_immediateQueue.end();)
+    {
+        if (it->second->matches(matchCriteria))
+        {
+            DELETE_MEMORY_TC(it->second);
+            it = m_immediateQueue.erase(it);
+            numRemoved++;
+        }
+        else
+        {
+            ++it;
+        }
+    }
+
+    for (auto it = m_deferredQueue.begin(); it != m_deferredQueue.end();)
+    {
+        if (it->second->matches(matchCriteria))
+        {
+            DELETE_MEMORY_TC(it->second);
+            it = m_deferredQueue.erase(it);
+            numRemoved++;
+        }
+        else
+        {
+            ++it;
+        }
+    }
+
+    return numRemoved;
+}
+
+Bool SimulationWorkItemQueueManager::isWorkItemThread(void)
+{
+    // Everything runs on the simulator thread
+    return true;
+}
+
+void SimulationWorkItemQueueManager::disableAndEmptyAllQueues(void)
+{
+    m_enqueueingEnabled = false;
+
+    for (auto it = m_immediateQueue.begin(); it != m_immediateQueue.end(); ++it)
+    {
+        DELETE_MEMORY_TC(it->second);
+    }
+    m_immediateQueue.clear();
+
+    for (auto it = m_deferredQueue.begin(); it != m_deferredQueue.end(); ++it)
+    {
+        DELETE_MEMORY_TC(it->second);
+    }
+    m_deferredQueue.clear();
+}
+
+void SimulationWorkItemQueueManager::writeStatus(StatusWriter& writer)
+{
+    writer.beginElement("work_item_queue_manager_status");
+    writer.addDataElement("immediate_queue_count", StatusFormat::friendlyValue((UInt64)m_immediateQueue.size()));
+    writer.addDataElement("deferred_queue_count", StatusFormat::friendlyValue((UInt64)m_deferredQueue.size()));
+    writer.addDataElement("executed_count", StatusFormat::friendlyValue(m_executedCount));
+    writer.endElement();
+}
+
+void SimulationWorkItemQueueManager::runUntil(const TimeSpan& time)
+{
+    Int64 endTime = time.asMicroseconds();
+
+    while ((m_deferredQueue.empty() == false) && (m_deferredQueue.begin()->first <= endTime))
+    {
+        auto next = m_deferredQueue.begin();
+        WorkItem* workItem = next->second;
+        m_clock->advanceTo(TimeSpan::createFromMicroseconds(next->first));
+        m_deferredQueue.erase(next);
+        execute(workItem);
+        processImmediateQueue();
+    }
+
+    m_clock->advanceTo(time);
+}
+
+UInt64 SimulationWorkItemQueueManager::getExecutedCount(void) const
+{
+    return m_executedCount;
+}
+
+UInt64 SimulationWorkItemQueueManager::getExecutionTimeNanoseconds(void) const
+{
+    return m_executionTimeNanoseconds;
+}
+
+Bool SimulationWorkItemQueueManager::canEnqueueImmediateWorkItem(WorkItem* workItem) const
+{
+    return ((m_enqueueingEnabled == true) ||
+        (workItem->getFrameworkEventType() == FrameworkEvent::PolicyDestroy) ||
+        (workItem->getFrameworkEventType() == FrameworkEvent::ParticipantDestroy));
+}
+
+void SimulationWorkItemQueueManager::processImmediateQueue(void)
+{
+    if (m_executing == true)
+    {
+        return;
+    }
+
+    while (m_immediateQueue.empty() == false)
+    {
+        auto next = m_immediateQueue.begin();
+        WorkItem* workItem = next->second;
+        m_immediateQueue.erase(next);
+        execute(workItem);
+    }
+}
+
+void SimulationWorkItemQueueManager::execute(WorkItem* workItem)
+{
+    // Nested work items are counted once as part of the work item that ran them
+    Bool nested = m_executing;
+    m_executing = true;
+
+    auto startTime = std::chrono::steady_clock::now();
+
+    try
+    {
+        workItem->setWorkItemExecutionStartTime();
+        workItem->execute();
+    }
+    catch (...)
+    {
+    }
+
+    try
+    {
+        DptfStatusInterface* dptfStatus = m_dptfManager->getDptfStatus();
+        if (dptfStatus != nullptr)
+        {
+            dptfStatus->workItemExecuted(workItem);
+        }
+    }
+    catch (...)
+    {
+    }
+
+    DELETE_MEMORY_TC(workItem);
+
+    if (nested == false)
+    {
+        try
+        {
+            m_dptfManager->getParticipantManager()->clearAllParticipantCachedData();
+        }
+        catch (...)
+        {
+        }
+
+        m_executionTimeNanoseconds += std::chrono::duration_cast<std::chrono::nanoseconds>(
+            std::chrono::steady_clock::now() - startTime).count();
+        m_executedCount++;
+        m_executing = false;
+    }
+}
\ No newline at end of file
@@ -0,0 +1,80 @@
+/******************************************************************************
+** Copyright (c) 2013-2016 Intel Corporation All Rights Reserved
+**
+** Licensed under the Apache License, Version 2.0 (the "License"); you may not
+** use this file except in compliance with the License.
+**
+** You may obtain a copy of the License at
+**     http://www.apache.org/licenses/LICENSE-2.0
+**
+** Unless required by applicable law or agreed to in writing, software
+** distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+** WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+**
+** See the License for the specific language governing permissions and
+** limitations under the License.
+**
+******************************************************************************/
+
+#pragma once
+
+#include "Dptf.h"
+#include "WorkItemQueueManagerInterface.h"
+#include "ImmediateWorkItemQueue.h"
+#include "SimulationClock.h"
+
+//
+// Runs work items on the calling thread in virtual time.  Immediate work items run in priority order as soon as
+// they are enqueued.  Deferred work items run when the simulator moves the clock past their due time, which
+// replaces the timers and the work item thread used by WorkItemQueueManager.
+//
+
+class SimulationWorkItemQueueManager : public WorkItemQueueManagerInterface
+{
+public:
+
+    SimulationWorkItemQueueManager(DptfManagerInterface* dptfManager, SimulationClock* clock);
+    virtual ~SimulationWorkItemQueueManager(void);
+
+    virtual void enqueueImmediateWorkItemAndReturn(WorkItem* workItem) override;
+    virtual void enqueueImmediateWorkItemAndReturn(WorkItem* workItem, UIntN priority) override;
+    virtual void enqueueImmediateWorkItemAndWait(WorkItem* workItem) override;
+    virtual void enqueueImmediateWorkItemAndWait(WorkItem* workItem, UIntN priority) override;
+    virtual void enqueueDeferredWorkItem(WorkItem* workItem, const TimeSpan& timeUntilExecution) override;
+
+    virtual UIntN removeIfMatches(const WorkItemMatchCriteria& matchCriteria) override;
+    virtual Bool isWorkItemThread(void) override;
+
+    virtual void disableAndEmptyAllQueues(void) override;
+
+    virtual void writeStatus(StatusWriter& writer) override;
+
+    // Runs every deferred work item due at or before the given time, moving the clock to each due time in turn
+    void runUntil(const TimeSpan& time);
+
+    UInt64 getExecutedCount(void) const;
+    UInt64 getExecutionTimeNanoseconds(void) const;
+
+private:
+
+    // hide the copy constructor and assignment operator.
+    SimulationWorkItemQueueManager(const SimulationWorkItemQueueManager& rhs);
+    SimulationWorkItemQueueManager& operator=(const SimulationWorkItemQueueManager& rhs);
+
+    DptfManagerInterface* m_dptfManager;
+    SimulationClock* m_clock;
+    Bool m_enqueueingEnabled;
+    Bool m_executing;
+    UInt64 m_nextSequenceNumber;
+    UInt64 m_executedCount;
+    UInt64 m_executionTimeNanoseconds;
+
+    std::map<ImmediateWorkItemQueueKey, WorkItem*> m_immediateQueue;
+
+    // Keyed by due time in microseconds.  Items due at the same time keep the order they were enqueued in.
+    std::multimap<Int64, WorkItem*> m_deferredQueue;
+
+    Bool canEnqueueImmediateWorkItem(WorkItem* workItem) const;
+    void processImmediateQueue(void);
+    void execute(WorkItem* workItem);
+};
\ No newline at end of file
@@ -228,12 +228,22 @@ PerformanceControlDynamicCaps DomainPerformanceControl_001::createPerformanceCon
     UInt32 upperLimitIndex;
     auto controlSetSize = getPerformanceControlSet(getParticipantIndex(), domainIndex).getCount();
 
+    // Read both limits with a single call into ESIF
+    EsifPrimitiveBatch batch;
+    auto ppdlRequest = batch.add(esif_primitive_type::GET_PERF_PSTATE_DEPTH_LIMIT, ESIF_DATA_UINT32, domainIndex);
+    auto pppcRequest = batch.add(esif_primitive_type::GET_PARTICIPANT_PERF_PRESENT_CAPABILITY, ESIF_DATA_UINT32,
+        domainIndex);
     try
     {
-        lowerLimitIndex =
-            getParticipantServices()->primitiveExecuteGetAsUInt32(
-                esif_primitive_type::GET_PERF_PSTATE_DEPTH_LIMIT,
-                domainIndex);
+        getParticipantServices()->primitiveExecuteGetBatch(batch);
+    }
+    catch (...)
+    {
+    }
+
+    try
+    {
+        lowerLimitIndex = batch.getUInt32(ppdlRequest);
     }
     catch (...)
     {
@@ -244,10 +254,7 @@ PerformanceControlDynamicCaps DomainPerformanceControl_001::createPerformanceCon
     try
     {
         // If PPPC is not supported, default to P0
-        upperLimitIndex =
-            getParticipantServices()->primitiveExecuteGetAsUInt32(
-                esif_primitive_type::GET_PARTICIPANT_PERF_PRESENT_CAPABILITY,
-                domainIndex);
+        upperLimitIndex = batch.getUInt32(pppcRequest);
     }
     catch (...)
     {
@@ -262,19 +262,19 @@ void DomainPerformanceControl_002::calculatePerformanceStateLimits(UIntN& pState
     // limit to 0 and arbitrate with ConfigTDP.  This primitive simply gives us the last set P-state index.  If 3rd
     // party tools set this or if we have throttled P-states and then crash and reload, our upper limit will be
     // whatever the last set P-state index was, which is wrong.
-    pStateUpperLimitIndex =
-        getParticipantServices()->primitiveExecuteGetAsUInt32(
-        esif_primitive_type::GET_PROC_PERF_PRESENT_CAPABILITY,
+    EsifPrimitiveBatch batch;
+    auto ppcRequest = batch.add(esif_primitive_type::GET_PROC_PERF_PRESENT_CAPABILITY, ESIF_DATA_UINT32,
         domainIndex);
+    auto pdlRequest = batch.add(esif_primitive_type::GET_PROC_PERF_PSTATE_DEPTH_LIMIT, ESIF_DATA_UINT32,
+        domainIndex);
+    getParticipantServices()->primitiveExecuteGetBatch(batch);
+    pStateUpperLimitIndex = batch.getUInt32(ppcRequest);
 
     auto performanceStateSetSize = getPerformanceStateSet(domainIndex).getCount();
     try
     {
         // _PDL is an optional object
-        pStateLowerLimitIndex =
-            getParticipantServices()->primitiveExecuteGetAsUInt32(
-            esif_primitive_type::GET_PROC_PERF_PSTATE_DEPTH_LIMIT,
-            domainIndex);
+        pStateLowerLimitIndex = batch.getUInt32(pdlRequest);
     }
     catch (dptf_exception)
     {
@@ -304,13 +304,24 @@ void DomainPerformanceControl_002::calculatePerformanceStateLimits(UIntN& pState
 void DomainPerformanceControl_002::calculateThrottlingStateLimits(UIntN& tStateUpperLimitIndex, 
     UIntN& tStateLowerLimitIndex, UIntN domainIndex)
 {
+    EsifPrimitiveBatch batch;
+    auto tpcRequest = batch.add(esif_primitive_type::GET_PROC_PERF_THROTTLE_PRESENT_CAPABILITY, ESIF_DATA_UINT32,
+        domainIndex);
+    auto tdlRequest = batch.add(esif_primitive_type::GET_PROC_PERF_TSTATE_DEPTH_LIMIT, ESIF_DATA_UINT32,
+        domainIndex);
+    try
+    {
+        getParticipantServices()->primitiveExecuteGetBatch(batch);
+    }
+    catch (dptf_exception)
+    {
+        // Every request in the batch reports the failure below
+    }
+
     // Required object if T-states are supported
     try
     {
-        tStateUpperLimitIndex =
-            getParticipantServices()->primitiveExecuteGetAsUInt32(
-            esif_primitive_type::GET_PROC_PERF_THROTTLE_PRESENT_CAPABILITY,
-            domainIndex);
+        tStateUpperLimitIndex = batch.getUInt32(tpcRequest);
     }
     catch (dptf_exception)
     {
@@ -323,10 +334,7 @@ void DomainPerformanceControl_002::calculateThrottlingStateLimits(UIntN& tStateU
     try
     {
         // _TDL is an optional object
-        tStateLowerLimitIndex =
-            getParticipantServices()->primitiveExecuteGetAsUInt32(
-            esif_primitive_type::GET_PROC_PERF_TSTATE_DEPTH_LIMIT,
-            domainIndex);
+        tStateLowerLimitIndex = batch.getUInt32(tdlRequest);
     }
     catch (dptf_exception)
     {
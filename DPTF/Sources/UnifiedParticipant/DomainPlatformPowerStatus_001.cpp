@@ -109,6 +109,25 @@ void DomainPlatformPowerStatus_001::clearCachedData(void)
 
 std::shared_ptr<XmlNode> DomainPlatformPowerStatus_001::getXml(UIntN domainIndex)
 {
+    // Read all of the status values with a single call into ESIF.  If the batch can't be executed every value
+    // below reports an error.
+    EsifPrimitiveBatch batch;
+    auto pmax = batch.add(esif_primitive_type::GET_PLATFORM_MAX_BATTERY_POWER, ESIF_DATA_POWER, domainIndex);
+    auto psrc = batch.add(esif_primitive_type::GET_PLATFORM_POWER_SOURCE, ESIF_DATA_UINT32, domainIndex);
+    auto artg = batch.add(esif_primitive_type::GET_ADAPTER_POWER_RATING, ESIF_DATA_POWER, domainIndex);
+    auto ctyp = batch.add(esif_primitive_type::GET_CHARGER_TYPE, ESIF_DATA_UINT32, domainIndex);
+    auto prop = batch.add(esif_primitive_type::GET_PLATFORM_REST_OF_POWER, ESIF_DATA_POWER, domainIndex);
+    auto apkp = batch.add(esif_primitive_type::GET_AC_PEAK_POWER, ESIF_DATA_POWER, domainIndex);
+    auto apkt = batch.add(esif_primitive_type::GET_AC_PEAK_TIME_WINDOW, ESIF_DATA_TIME, domainIndex);
+    auto pbss = batch.add(esif_primitive_type::GET_PLATFORM_BATTERY_STEADY_STATE, ESIF_DATA_POWER, domainIndex);
+    try
+    {
+        getParticipantServices()->primitiveExecuteGetBatch(batch);
+    }
+    catch (...)
+    {
+    }
+
     auto root = XmlNode::createWrapperElement("platform_power_status");
     root->addChild(XmlNode::createDataElement("control_knob_version", "001"));
 
@@ -116,8 +135,8 @@ std::shared_ptr<XmlNode> DomainPlatformPowerStatus_001::getXml(UIntN domainIndex
     pmaxStatus->addChild(XmlNode::createDataElement("name", "Max Battery Power (PMAX)"));
     try
     {
-        pmaxStatus->addChild(XmlNode::createDataElement(
-            "value", getMaxBatteryPower(getParticipantIndex(), domainIndex).toString() + "mW"));
+        m_maxBatteryPower = batch.getPower(pmax);
+        pmaxStatus->addChild(XmlNode::createDataElement("value", m_maxBatteryPower.toString() + "mW"));
     }
     catch (...)
     {
@@ -129,8 +148,9 @@ std::shared_ptr<XmlNode> DomainPlatformPowerStatus_001::getXml(UIntN domainIndex
     psrcStatus->addChild(XmlNode::createDataElement("name", "Platform Power Source (PSRC)"));
     try
     {
+        m_platformPowerSource = PlatformPowerSource::Type(batch.getUInt32(psrc));
         psrcStatus->addChild(XmlNode::createDataElement("value",
-        PlatformPowerSource::ToString(getPlatformPowerSource(getParticipantIndex(), domainIndex))));
+        PlatformPowerSource::ToString(m_platformPowerSource)));
     }
     catch (...)
     {
@@ -142,8 +162,8 @@ std::shared_ptr<XmlNode> DomainPlatformPowerStatus_001::getXml(UIntN domainIndex
     artgStatus->addChild(XmlNode::createDataElement("name", "Adapter Power Rating (ARTG)"));
     try
     {
-        artgStatus->addChild(XmlNode::createDataElement(
-        "value", getAdapterPowerRating(getParticipantIndex(), domainIndex).toString() + "mW"));
+        m_adapterRating = batch.getPower(artg);
+        artgStatus->addChild(XmlNode::createDataElement("value", m_adapterRating.toString() + "mW"));
     }
     catch (...)
     {
@@ -155,8 +175,8 @@ std::shared_ptr<XmlNode> DomainPlatformPowerStatus_001::getXml(UIntN domainIndex
     ctypStatus->addChild(XmlNode::createDataElement("name", "Charger Type (CTYP)"));
     try
     {
-        ctypStatus->addChild(XmlNode::createDataElement("value",
-        ChargerType::ToString(getChargerType(getParticipantIndex(), domainIndex))));
+        m_chargerType = ChargerType::Type(batch.getUInt32(ctyp));
+        ctypStatus->addChild(XmlNode::createDataElement("value", ChargerType::ToString(m_chargerType)));
     }
     catch (...)
     {
@@ -168,8 +188,8 @@ std::shared_ptr<XmlNode> DomainPlatformPowerStatus_001::getXml(UIntN domainIndex
     propStatus->addChild(XmlNode::createDataElement("name", "Platform Rest Of Power (PROP)"));
     try
     {
-        propStatus->addChild(XmlNode::createDataElement(
-        "value", getPlatformRestOfPower(getParticipantIndex(), domainIndex).toString() + "mW"));
+        m_platformRestOfPower = batch.getPower(prop);
+        propStatus->addChild(XmlNode::createDataElement("value", m_platformRestOfPower.toString() + "mW"));
     }
     catch (...)
     {
@@ -181,8 +201,8 @@ std::shared_ptr<XmlNode> DomainPlatformPowerStatus_001::getXml(UIntN domainIndex
     apkpStatus->addChild(XmlNode::createDataElement("name", "AC Peak Power (APKP)"));
     try
     {
-        apkpStatus->addChild(XmlNode::createDataElement(
-        "value", getACPeakPower(getParticipantIndex(), domainIndex).toString() + "mW"));
+        m_acPeakPower = batch.getPower(apkp);
+        apkpStatus->addChild(XmlNode::createDataElement("value", m_acPeakPower.toString() + "mW"));
     }
     catch (...)
     {
@@ -194,8 +214,9 @@ std::shared_ptr<XmlNode> DomainPlatformPowerStatus_001::getXml(UIntN domainIndex
     apktStatus->addChild(XmlNode::createDataElement("name", "AC Peak Time Window (APKT)"));
     try
     {
+        m_acPeakTimeWindow = batch.getTimeInMilliseconds(apkt);
         apktStatus->addChild(XmlNode::createDataElement(
-        "value", getACPeakTimeWindow(getParticipantIndex(), domainIndex).toStringMilliseconds() + "msec"));
+        "value", m_acPeakTimeWindow.toStringMilliseconds() + "msec"));
     }
     catch (...)
     {
@@ -207,8 +228,8 @@ std::shared_ptr<XmlNode> DomainPlatformPowerStatus_001::getXml(UIntN domainIndex
     pbssStatus->addChild(XmlNode::createDataElement("name", "Platform Battery Steady State (PBSS)"));
     try
     {
-        pbssStatus->addChild(XmlNode::createDataElement(
-            "value", getPlatformBatterySteadyState(getParticipantIndex(), domainIndex).toString() + "mW"));
+        m_batterySteadyState = batch.getPower(pbss);
+        pbssStatus->addChild(XmlNode::createDataElement("value", m_batterySteadyState.toString() + "mW"));
     }
     catch (...)
     {
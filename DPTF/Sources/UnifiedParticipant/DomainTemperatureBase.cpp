@@ -32,9 +32,26 @@ DomainTemperatureBase::~DomainTemperatureBase()
 
 TemperatureThresholds DomainTemperatureBase::getTemperatureThresholds(UIntN participantIndex, UIntN domainIndex)
 {
-    Temperature aux0 = getAuxTemperatureThreshold(domainIndex, 0);
-    Temperature aux1 = getAuxTemperatureThreshold(domainIndex, 1);
-    Temperature hysteresis = getHysteresis(domainIndex);
+    // Read both aux trip points and the hysteresis with a single call into ESIF.  If the batch can't be executed
+    // every request reports an error and the defaults below are used.
+    EsifPrimitiveBatch batch;
+    auto aux0Request = batch.add(esif_primitive_type::GET_TEMPERATURE_THRESHOLDS, ESIF_DATA_TEMPERATURE,
+        domainIndex, 0);
+    auto aux1Request = batch.add(esif_primitive_type::GET_TEMPERATURE_THRESHOLDS, ESIF_DATA_TEMPERATURE,
+        domainIndex, 1);
+    auto hysteresisRequest = batch.add(esif_primitive_type::GET_TEMPERATURE_THRESHOLD_HYSTERESIS,
+        ESIF_DATA_TEMPERATURE, domainIndex);
+    try
+    {
+        getParticipantServices()->primitiveExecuteGetBatch(batch);
+    }
+    catch (...)
+    {
+    }
+
+    Temperature aux0 = getAuxTemperatureThreshold(batch, aux0Request);
+    Temperature aux1 = getAuxTemperatureThreshold(batch, aux1Request);
+    Temperature hysteresis = getHysteresis(batch, hysteresisRequest);
     return TemperatureThresholds(aux0, aux1, hysteresis);
 }
 
@@ -106,12 +123,11 @@ void DomainTemperatureBase::sendActivityLoggingDataIfEnabled(UIntN participantIn
     }
 }
 
-Temperature DomainTemperatureBase::getAuxTemperatureThreshold(UIntN domainIndex, UInt8 auxNumber)
+Temperature DomainTemperatureBase::getAuxTemperatureThreshold(const EsifPrimitiveBatch& batch, UIntN requestIndex)
 {
     try
     {
-        auto aux = getParticipantServices()->primitiveExecuteGetAsTemperatureTenthK(
-            esif_primitive_type::GET_TEMPERATURE_THRESHOLDS, domainIndex, auxNumber);
+        auto aux = batch.getTemperature(requestIndex);
         aux = Temperature::snapWithinAllowableTripPointRange(aux);
         return aux;
     }
@@ -121,13 +137,11 @@ Temperature DomainTemperatureBase::getAuxTemperatureThreshold(UIntN domainIndex,
     }
 }
 
-Temperature DomainTemperatureBase::getHysteresis(UIntN domainIndex) const
+Temperature DomainTemperatureBase::getHysteresis(const EsifPrimitiveBatch& batch, UIntN requestIndex) const
 {
     try
     {
-        return getParticipantServices()->primitiveExecuteGetAsTemperatureTenthK(
-            esif_primitive_type::GET_TEMPERATURE_THRESHOLD_HYSTERESIS,
-            domainIndex);
+        return batch.getTemperature(requestIndex);
     }
     catch (...)
     {
@@ -43,8 +43,8 @@ public:
 
 private:
 
-    Temperature getAuxTemperatureThreshold(UIntN domainIndex, UInt8 auxNumber);
-    Temperature getHysteresis(UIntN domainIndex) const;
+    Temperature getAuxTemperatureThreshold(const EsifPrimitiveBatch& batch, UIntN requestIndex);
+    Temperature getHysteresis(const EsifPrimitiveBatch& batch, UIntN requestIndex) const;
     void setAux0(Temperature &aux0, UIntN domainIndex);
     void setAux1(Temperature &aux1, UIntN domainIndex);
 
@@ -272,6 +272,26 @@ typedef struct _t_fpcDomainIterator {
 	EsifFpcDomainPtr *fpcDomainPtr;
 } EsifFpcDomainIterator, *EsifFpcDomainIteratorPtr;
 
+/* Primitive with its actions resolved when the DSP is loaded */
+typedef struct _t_EsifDspDispatchEntry {
+	EsifFpcPrimitivePtr primitive_ptr;
+	EsifFpcActionPtr *actions;	/* Points into EsifDspDispatch.actions */
+	UInt32 action_count;		/* Actions that fit in the primitive */
+} EsifDspDispatchEntry, *EsifDspDispatchEntryPtr;
+
+/*
+ * Dispatch table compiled from the FPC once it has been loaded. Primitives are
+ * grouped by tuple id, so an id indexes straight to the few domain and
+ * instance variants that share it.
+ */
+typedef struct _t_EsifDspDispatch {
+	UInt32 id_count;		/* Highest primitive id + 1 */
+	UInt32 *id_start;		/* id_count + 1 offsets into entries */
+	EsifDspDispatchEntryPtr entries;	/* By id, then in FPC order */
+	EsifFpcActionPtr *actions;	/* Action pointers for all entries */
+	EsifFpcAlgorithmPtr algorithms[MAX_ESIF_ACTION_ENUM_VALUE + 1];	/* By action type */
+} EsifDspDispatch, *EsifDspDispatchPtr;
+
 /* Upper Framework DSP */
 struct esif_up_dsp {
 	/*
@@ -309,6 +329,9 @@ struct esif_up_dsp {
 	struct esif_link_list   *algo_ptr;	/* Algorithm */
 	struct esif_link_list   *evt_ptr;	/* Events */
 
+	/* Compiled Lookups, NULL Falls Back To The Hash Table And Lists */
+	EsifDspDispatchPtr dispatch_ptr;
+
 	/* Boolean array indicating if a given action type is used in the DSP */
 	UInt8 contained_actions[MAX_ESIF_ACTION_ENUM_VALUE];
 
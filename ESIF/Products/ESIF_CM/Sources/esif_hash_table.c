@@ -97,6 +97,7 @@
  * follows the FNV-1a method of hash creation
  * http://www.isthe.com/chongo/tech/comp/fnv/index.html#FNV-1a
  */
+static const u32 FNV_OFFSET_BASIS = 2166136261U;
 static const u32 FNV_PRIME = 16777619;
 
 /* Function Declarations */
@@ -106,24 +107,6 @@ static u32 esif_compute_hash(
 	u32 data_length
 	);
 
-static struct esif_link_list *esif_ht_get_ll(
-	struct esif_ht *self,
-	u8 *key_ptr,
-	u32 key_length
-	);
-
-static struct esif_ht_node *esif_alloc_ht_node(
-	u8 *key_ptr,
-	u32 key_length,
-	void *item_ptr
-	);
-
-static struct esif_link_list_node *esif_find_node_in_ht_ll(
-	struct esif_link_list *ll_ptr,
-	u8 *key_ptr,
-	u32 key_length
-	);
-
 static u8 esif_cmp_keys(
 	u8 *key1_ptr,
 	u32 key1_length,
@@ -131,13 +114,20 @@ static u8 esif_cmp_keys(
 	u32 key2_length
 	);
 
+static u8 *esif_ht_node_key(struct esif_ht_node *ht_node);
+
 static void esif_destroy_ht_node(struct esif_ht_node *ht_node);
 
-static void esif_destroy_ht_nodes(
-	struct esif_link_list *ll_ptr,
-	item_destroy_func item_destroy_fptr
+static u32 esif_ht_slot_count(u32 item_count);
+
+static void esif_ht_place_node(
+	struct esif_ht_node *table,
+	u32 size,
+	struct esif_ht_node *ht_node
 	);
 
+static enum esif_rc esif_ht_grow(struct esif_ht *self);
+
 static struct esif_ht_node *esif_ht_get_ht_node(
 	struct esif_ht *self,
 	u8 *key_ptr,
@@ -152,7 +142,7 @@ static u32 esif_compute_hash(
 	u32 data_length
 	)
 {
-	u32 hash_value = 0;
+	u32 hash_value = FNV_OFFSET_BASIS;
 	u32 offset     = 0;
 
 	ESIF_ASSERT(data_ptr != NULL);
@@ -191,186 +181,158 @@ exit:
 	return keys_equal;
 }
 
-static struct esif_ht_node *esif_ht_get_ht_node(
-	struct esif_ht *self,
-	u8 *key_ptr,
-	u32 key_length
+/* Short keys live in the slot, longer ones on the heap */
+static u8 *esif_ht_node_key(
+	struct esif_ht_node *ht_node
 	)
 {
-	struct esif_link_list *ll_ptr = NULL;
-	struct esif_link_list_node *ll_node = NULL;
-	struct esif_ht_node *ht_node = NULL;
+	ESIF_ASSERT(ht_node != NULL);
 
-	ESIF_ASSERT(key_ptr != NULL);
-	ESIF_ASSERT(self != NULL);
+	if (ht_node->key_length > ESIF_HT_INLINE_KEY_SIZE)
+		return ht_node->key.key_ptr;
 
-	ll_ptr = esif_ht_get_ll(self, key_ptr, key_length);
-	if (ll_ptr == NULL) {
-		ESIF_ASSERT(ESIF_FALSE); /* Should never happen */
-		ESIF_TRACE_DYN_VERB("LL NULL for passed in key\n");
-		goto exit;
-	}
+	return ht_node->key.key_inline;
+}
 
-	ll_node = esif_find_node_in_ht_ll(ll_ptr, key_ptr, key_length);
-	if (ll_node == NULL) {
-		ESIF_TRACE_DYN_VERB("LL node not found for passed in key\n");
-		goto exit;
-	}
+/* Frees the key and empties the slot. This does not delete the item_ptr */
+static void esif_destroy_ht_node(
+	struct esif_ht_node *ht_node
+	)
+{
+	ESIF_ASSERT(ht_node != NULL);
 
-	ht_node = (struct esif_ht_node *)ll_node->data_ptr;
-exit:
-	return ht_node;
+	if ((ht_node->key_length > ESIF_HT_INLINE_KEY_SIZE) &&
+	    (ht_node->key.key_ptr != NULL))
+		esif_ccb_free(ht_node->key.key_ptr);
+
+	esif_ccb_memset(ht_node, 0, sizeof(*ht_node));
+	return;
 }
 
-/* Get link list corresponding to the hash index */
-struct esif_link_list * esif_ht_get_ll(
-	struct esif_ht *self,
-	u8 *key_ptr,
-	u32 key_length
+/* Smallest power of two number of slots that holds item_count items */
+static u32 esif_ht_slot_count(
+	u32 item_count
 	)
 {
-	struct esif_link_list *ll_ptr = NULL;
-	u32 hash_index;
-	
-	ESIF_ASSERT(key_ptr != NULL);
-	ESIF_ASSERT(self != NULL);
+	u64 slots = ESIF_HT_MIN_SLOTS;
 
-	hash_index = esif_compute_hash(key_ptr, key_length) % self->size;
+	while ((slots * ESIF_HT_MAX_LOAD_PERCENT) / 100 < item_count)
+		slots <<= 1;
 
-	ll_ptr = self->table[hash_index];
-	ESIF_TRACE_DYN_VERB(
-		"Key %p, key size %d, table %p index %d ll %p\n",
-		key_ptr,
-		key_length,
-		self,
-		hash_index,
-		ll_ptr);
-
-	return ll_ptr;
+	return (u32)slots;
 }
 
-static struct esif_link_list_node * esif_find_node_in_ht_ll(
-	struct esif_link_list *ll_ptr,
-	u8 *key_ptr,
-	u32 key_length
+/*
+ * Copies an in-use node into the first free slot of its probe sequence. The
+ * table must have at least one free slot. Equal keys share a probe sequence, so
+ * they stay in the order they were placed.
+ */
+static void esif_ht_place_node(
+	struct esif_ht_node *table,
+	u32 size,
+	struct esif_ht_node *ht_node
 	)
 {
-	struct esif_link_list_node *cur_ptr = NULL;
-	struct esif_ht_node *ht_node = NULL;
+	u32 mask = size - 1;
+	u32 index = ht_node->hash & mask;
 
-	ESIF_ASSERT(ll_ptr != NULL);
-	ESIF_ASSERT(key_ptr != NULL);
+	while (table[index].in_use)
+		index = (index + 1) & mask;
 
-	cur_ptr = ll_ptr->head_ptr;
-	while (cur_ptr) {
-		ht_node = (struct esif_ht_node *)cur_ptr->data_ptr;
-		if (ht_node != NULL) {
-			if (esif_cmp_keys(key_ptr, key_length,
-				ht_node->key_ptr, ht_node->key_length)) {
-				break;
-			}
-		}
-		cur_ptr = cur_ptr->next_ptr;
-	}
-	return cur_ptr;
+	table[index] = *ht_node;
 }
 
-static struct esif_ht_node *esif_alloc_ht_node(
-	u8 *key_ptr,
-	u32 key_length,
-	void *item_ptr
+/* Doubles the number of slots. Keys move with their slots and are not copied */
+static enum esif_rc esif_ht_grow(
+	struct esif_ht *self
 	)
 {
 	enum esif_rc rc = ESIF_OK;
-	struct esif_ht_node *ht_node_ptr = NULL;
-	
-	ESIF_ASSERT(key_ptr != NULL);
-	
-	ht_node_ptr =
-		(struct esif_ht_node *)esif_ccb_malloc(sizeof(*ht_node_ptr));
-	if (ht_node_ptr == NULL) {
-		ESIF_TRACE_ERROR("Unable to allocate HT node\n");
+	struct esif_ht_node *new_table = NULL;
+	u32 new_size = 0;
+	u32 start = 0;
+	u32 offset = 0;
+	u32 index = 0;
+
+	ESIF_ASSERT(self != NULL);
+
+	if (self->size > (0xFFFFFFFFU >> 1) / sizeof(*new_table)) {
 		rc = ESIF_E_NO_MEMORY;
 		goto exit;
 	}
+	new_size = self->size << 1;
 
-	ht_node_ptr->key_ptr = esif_ccb_malloc(key_length);
-	if (ht_node_ptr->key_ptr == NULL) {
-		ESIF_TRACE_ERROR("Unable to allocate HT node key ptr\n");
+	new_table = (struct esif_ht_node *)
+		esif_ccb_malloc(sizeof(*new_table) * new_size);
+	if (new_table == NULL) {
+		ESIF_TRACE_ERROR("Unable to grow hash table\n");
 		rc = ESIF_E_NO_MEMORY;
 		goto exit;
 	}
 
-	esif_ccb_memcpy(ht_node_ptr->key_ptr, key_ptr, key_length);
-	ht_node_ptr->key_length = key_length;
-	ht_node_ptr->item_ptr = item_ptr;
-exit:
-	if (rc != ESIF_OK) {
-		if (ht_node_ptr) {
-			if (ht_node_ptr->key_ptr)
-				esif_ccb_free(ht_node_ptr->key_ptr);
+	/*
+	 * Start after a free slot so a run that wraps past the end of the
+	 * table is moved front to back and duplicates keep their order.
+	 */
+	while (self->table[start].in_use)
+		start++;
 
-			esif_ccb_free(ht_node_ptr);
-			ht_node_ptr = NULL;
-		}
+	for (offset = 1; offset <= self->size; ++offset) {
+		index = (start + offset) & (self->size - 1);
+		if (self->table[index].in_use)
+			esif_ht_place_node(new_table, new_size, &self->table[index]);
 	}
 
-	return ht_node_ptr;
-}
-
-/* This does not delete the item_ptr */
-static void esif_destroy_ht_node(
-	struct esif_ht_node *ht_node
-	)
-{
-	ESIF_ASSERT(ht_node != NULL);
-
-	if (ht_node->key_ptr)
-		esif_ccb_free(ht_node->key_ptr);
-
-	/* TODO: If needed */
-	/* We can call the callback destroy func here so that
-	 * the caller does not have to destroy the item. Right 
-	 * now this is done before coming into this function 
-	 * for HT destroy only.
-	 */
-	esif_ccb_free(ht_node);
+	ESIF_TRACE_DYN_VERB("Grow hash table %p from %d to %d slots\n",
+		self,
+		self->size,
+		new_size);
 
-	return;
+	esif_ccb_free(self->table);
+	self->table = new_table;
+	self->size = new_size;
+exit:
+	return rc;
 }
 
-/* Destroys ht_node's in the Hash Table LL */
-void esif_destroy_ht_nodes(
-	struct esif_link_list *ll_ptr,
-	item_destroy_func item_destroy_fptr
+static struct esif_ht_node *esif_ht_get_ht_node(
+	struct esif_ht *self,
+	u8 *key_ptr,
+	u32 key_length
 	)
 {
-	struct esif_link_list_node *cur_ptr = NULL;
 	struct esif_ht_node *ht_node = NULL;
-	void *item_ptr = NULL;
+	u32 hash = 0;
+	u32 mask = 0;
+	u32 index = 0;
 
-	if (ll_ptr == NULL) {
-		goto exit;
-	}
+	ESIF_ASSERT(key_ptr != NULL);
+	ESIF_ASSERT(self != NULL);
 
-	cur_ptr = ll_ptr->head_ptr;
-	while (cur_ptr) {
-		ht_node = (struct esif_ht_node *)cur_ptr->data_ptr;
-		if (ht_node != NULL) {
-			if (item_destroy_fptr) {
-				item_ptr = ht_node->item_ptr;
-				ht_node->item_ptr = NULL;
-				item_destroy_fptr(item_ptr);
-			}
-
-			esif_destroy_ht_node(ht_node);
-			cur_ptr->data_ptr = NULL;
+	hash = esif_compute_hash(key_ptr, key_length);
+	mask = self->size - 1;
+
+	/* The load limit guarantees a free slot ends every probe */
+	for (index = hash & mask; self->table[index].in_use;
+	     index = (index + 1) & mask) {
+		if ((self->table[index].hash == hash) &&
+		    esif_cmp_keys(key_ptr, key_length,
+				  esif_ht_node_key(&self->table[index]),
+				  self->table[index].key_length)) {
+			ht_node = &self->table[index];
+			break;
 		}
-
-		cur_ptr = cur_ptr->next_ptr;
 	}
-exit:
-	return;
+
+	ESIF_TRACE_DYN_VERB(
+		"Key %p, key size %d, table %p index %d node %p\n",
+		key_ptr,
+		key_length,
+		self,
+		index,
+		ht_node);
+
+	return ht_node;
 }
 
 enum esif_rc esif_ht_add_item(
@@ -381,8 +343,7 @@ enum esif_rc esif_ht_add_item(
 	)
 {
 	enum esif_rc rc = ESIF_OK;
-	struct esif_link_list *ll_ptr = NULL;
-	struct esif_ht_node *ht_node = NULL;
+	struct esif_ht_node ht_node = {0};
 
 	if ((key_ptr == NULL) || (self == NULL)) {
 		ESIF_TRACE_DYN_VERB("NULL ptr passed in \n");
@@ -390,39 +351,43 @@ enum esif_rc esif_ht_add_item(
 		goto exit;
 	}
 
-	ll_ptr = esif_ht_get_ll(self, key_ptr, key_length);
-	if (ll_ptr == NULL) {
-		ESIF_ASSERT(ESIF_FALSE); /* Should never happen */
-		ESIF_TRACE_DYN_VERB("LL NULL for passed in key\n");
-		rc = ESIF_E_NOT_FOUND;
-		goto exit;
-	}
+	if (((u64)self->count + 1) * 100 >
+	    (u64)self->size * ESIF_HT_MAX_LOAD_PERCENT) {
+		rc = esif_ht_grow(self);
 
-	ht_node = esif_alloc_ht_node(key_ptr, key_length, item_ptr);
-	if (ht_node == NULL) {
-		rc = ESIF_E_NO_MEMORY;
-		goto exit;
+		/* A full table can still take items until one slot is left */
+		if ((rc != ESIF_OK) && (self->count + 1 < self->size))
+			rc = ESIF_OK;
+		if (rc != ESIF_OK)
+			goto exit;
 	}
 
-	rc = esif_link_list_add_at_back(ll_ptr, (void *)ht_node);
-	if (rc != ESIF_OK) {
-		ESIF_TRACE_ERROR("Unable to add new HT link list node\n");
-		goto exit;
+	if (key_length > ESIF_HT_INLINE_KEY_SIZE) {
+		ht_node.key.key_ptr = esif_ccb_malloc(key_length);
+		if (ht_node.key.key_ptr == NULL) {
+			ESIF_TRACE_ERROR("Unable to allocate HT node key ptr\n");
+			rc = ESIF_E_NO_MEMORY;
+			goto exit;
+		}
 	}
 
+	ht_node.hash = esif_compute_hash(key_ptr, key_length);
+	ht_node.in_use = ESIF_TRUE;
+	ht_node.key_length = key_length;
+	ht_node.item_ptr = item_ptr;
+	esif_ccb_memcpy(esif_ht_node_key(&ht_node), key_ptr, key_length);
+
+	esif_ht_place_node(self->table, self->size, &ht_node);
+	self->count++;
+
 	ESIF_TRACE_DYN_VERB(
-		"Key %p, key size %d, item %p, table %p ll %p\n",
+		"Key %p, key size %d, item %p, table %p count %d\n",
 		key_ptr,
 		key_length,
 		item_ptr,
 		self,
-		ll_ptr);
+		self->count);
 exit:
-	if (rc != ESIF_OK) {
-		if (ht_node != NULL)
-			esif_destroy_ht_node(ht_node);
-	}
-
 	return rc;
 }
 
@@ -433,9 +398,11 @@ enum esif_rc esif_ht_remove_item(
 	)
 {
 	enum esif_rc rc = ESIF_OK;
-	struct esif_link_list *ll_ptr = NULL;
-	struct esif_link_list_node *ll_node = NULL;
 	struct esif_ht_node *ht_node = NULL;
+	u32 mask = 0;
+	u32 hole = 0;
+	u32 index = 0;
+	u32 home = 0;
 
 	if ((key_ptr == NULL) || (self == NULL)) {
 		ESIF_TRACE_ERROR("NULL ptr passed in\n");
@@ -443,31 +410,33 @@ enum esif_rc esif_ht_remove_item(
 		goto exit;
 	}
 
-	ll_ptr = esif_ht_get_ll(self, key_ptr, key_length);
-	if (ll_ptr == NULL) {
-		ESIF_ASSERT(ESIF_FALSE); /* Should never happen */
-		ESIF_TRACE_DYN_VERB("LL NULL for passed in key\n");
+	ht_node = esif_ht_get_ht_node(self, key_ptr, key_length);
+	if (ht_node == NULL) {
+		ESIF_TRACE_DYN_VERB("HT node not found for passed in key\n");
 		rc = ESIF_E_NOT_FOUND;
 		goto exit;
 	}
 
-	ll_node = esif_find_node_in_ht_ll(ll_ptr, key_ptr, key_length);
-	if (ll_node == NULL) {
-		ESIF_TRACE_DYN_VERB("LL node not found for passed in key\n");
-		rc = ESIF_E_NOT_FOUND;
-		goto exit;
-	}
+	esif_destroy_ht_node(ht_node);
+	self->count--;
 
-	ht_node = (struct esif_ht_node *)ll_node->data_ptr;
-	if (ht_node == NULL) {
-		ESIF_ASSERT(ESIF_FALSE);
-		ESIF_TRACE_DYN_VERB("ht_node NULL\n");
-		rc = ESIF_E_PARAMETER_IS_NULL;
-		goto exit;
+	/*
+	 * Shift later members of the run back into the hole so lookups never
+	 * stop early. A node moves only if its home slot is not between the
+	 * hole and its current slot, which also keeps duplicates in order.
+	 */
+	mask = self->size - 1;
+	hole = (u32)(ht_node - self->table);
+	for (index = (hole + 1) & mask; self->table[index].in_use;
+	     index = (index + 1) & mask) {
+		home = self->table[index].hash & mask;
+		if (((index - home) & mask) >= ((index - hole) & mask)) {
+			self->table[hole] = self->table[index];
+			esif_ccb_memset(&self->table[index], 0,
+					sizeof(self->table[index]));
+			hole = index;
+		}
 	}
-
-	esif_destroy_ht_node(ht_node);
-	esif_link_list_node_remove(ll_ptr, ll_node);
 exit:
 	return rc;
 }
@@ -499,12 +468,11 @@ exit:
 	return item_ptr;
 }
 
-/* Create Hash Table */
+/* Create Hash Table sized for the given number of items */
 struct esif_ht * esif_ht_create(
 	u32 size
 	)
 {
-	u32 index = 0;
 	struct esif_ht *new_ht_ptr = NULL;
 
 	new_ht_ptr = (struct esif_ht *)
@@ -516,9 +484,10 @@ struct esif_ht * esif_ht_create(
 		goto exit;
 	}
 
-	new_ht_ptr->size = size;
-	new_ht_ptr->table = (struct esif_link_list **)
-		esif_ccb_malloc(sizeof(*new_ht_ptr->table) * size);
+	new_ht_ptr->size = esif_ht_slot_count(size);
+	new_ht_ptr->count = 0;
+	new_ht_ptr->table = (struct esif_ht_node *)
+		esif_ccb_malloc(sizeof(*new_ht_ptr->table) * new_ht_ptr->size);
 
 	if (new_ht_ptr->table == NULL) {
 		esif_ccb_mempool_free(ESIF_MEMPOOL_TYPE_HASH2, new_ht_ptr);
@@ -526,19 +495,9 @@ struct esif_ht * esif_ht_create(
 		goto exit;
 	}
 
-	for (index = 0; index < size; ++index) {
-		ESIF_TRACE_DYN_VERB("Create linked list %d\n", index);
-		new_ht_ptr->table[index] = esif_link_list_create();
-
-		if (new_ht_ptr->table[index] == NULL) {
-			ESIF_TRACE_DYN_VERB("Creation failed\n");
-			esif_ht_destroy(new_ht_ptr, NULL);
-			new_ht_ptr = NULL;
-			goto exit;
-		}
-	}
-
-	ESIF_TRACE_DYN_VERB("Have hash table %p\n", new_ht_ptr);
+	ESIF_TRACE_DYN_VERB("Have hash table %p with %d slots\n",
+		new_ht_ptr,
+		new_ht_ptr->size);
 exit:
 	return new_ht_ptr;
 }
@@ -550,6 +509,7 @@ void esif_ht_destroy(
 	)
 {
 	u32 index = 0;
+	void *item_ptr = NULL;
 
 	if ((self == NULL) || (self->table == NULL)) {
 		ESIF_TRACE_ERROR("Hash table ptr NULL\n");
@@ -559,14 +519,16 @@ void esif_ht_destroy(
 	ESIF_TRACE_DYN_VERB("Destroying hash table %p\n", self);
 
 	for (index = 0; index < self->size; ++index) {
-		if (self->table[index] == NULL)
+		if (!self->table[index].in_use)
 			continue;
 
-		ESIF_TRACE_DYN_VERB("Destroy linked list %d\n", index);
+		if (item_destroy_fptr) {
+			item_ptr = self->table[index].item_ptr;
+			self->table[index].item_ptr = NULL;
+			item_destroy_fptr(item_ptr);
+		}
 
-		esif_destroy_ht_nodes(self->table[index], item_destroy_fptr);
-		esif_link_list_destroy(self->table[index]);
-		self->table[index] = NULL;
+		esif_destroy_ht_node(&self->table[index]);
 	}
 
 	esif_ccb_free(self->table);
@@ -575,7 +537,6 @@ exit:
 	return;
 }
 
-
 /* Init */
 enum esif_rc esif_ht_init(void)
 {
@@ -58,15 +58,33 @@
 
 typedef void (*item_destroy_func) (void *item_ptr);
 
-struct esif_ht {
-	u32 size;
-	struct esif_link_list **table;
-};
+/*
+ * Open addressing (linear probing) hash table over a flat array of slots.  The
+ * table doubles once it is ESIF_HT_MAX_LOAD_PERCENT full, so the size passed
+ * to esif_ht_create is only the number of items expected.  Keys up to
+ * ESIF_HT_INLINE_KEY_SIZE bytes are stored in the slot itself; longer keys are
+ * copied to the heap.  Duplicate keys are allowed and are found in the order
+ * they were added, the same as the chained table this replaced.
+ */
+#define ESIF_HT_INLINE_KEY_SIZE		16
+#define ESIF_HT_MIN_SLOTS		8
+#define ESIF_HT_MAX_LOAD_PERCENT	70
 
 struct esif_ht_node {
-	u8 *key_ptr;
+	u32 hash;
+	u32 in_use;
 	u32 key_length;
 	void *item_ptr; /* points to the actual item */
+	union {
+		u8 key_inline[ESIF_HT_INLINE_KEY_SIZE];
+		u8 *key_ptr;
+	} key;
+};
+
+struct esif_ht {
+	u32 size;	/* Number of slots, always a power of two */
+	u32 count;	/* Number of items */
+	struct esif_ht_node *table;
 };
 
 #ifdef __cplusplus
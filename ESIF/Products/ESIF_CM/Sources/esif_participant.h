@@ -317,6 +317,12 @@ typedef struct _t_EsifUp {
 	UInt8 markedForDelete;
 	esif_ccb_event_t deleteEvent;
 	esif_ccb_lock_t objLock;
+
+	/* Token replaced action parameters, keyed by parameter address in the DSP */
+	struct esif_ht *tokenParamsPtr;
+	/* Tables replaced by a DSP reselect; their strings may still be in use */
+	struct esif_link_list *retiredTokenParamsPtr;
+	esif_ccb_lock_t tokenParamsLock;
 } EsifUp, *EsifUpPtr, **EsifUpPtrLocation;
 
 /*
@@ -464,6 +470,21 @@ EsifString EsifUp_CreateTokenReplacedParamString(
 	const EsifString paramStr
 	);
 
+/*
+ * Same as EsifUp_CreateTokenReplacedParamString, but the string is cached by
+ * the participant and must not be released by the caller.  It stays valid
+ * until the participant is destroyed, even if the DSP is selected again.
+ */
+EsifString EsifUp_GetTokenReplacedParamString(
+	const EsifUpPtr self,
+	const EsifFpcPrimitivePtr primitivePtr,
+	const EsifString paramStr
+	);
+
+/* Token replaced parameter cache counters, reported by memstats */
+extern atomic_t g_upTokenParamHits;
+extern atomic_t g_upTokenParamFills;
+
 Bool EsifUp_IsActionInDsp(
 	EsifUpPtr self,
 	enum esif_action_type actionType
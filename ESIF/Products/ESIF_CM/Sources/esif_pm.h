@@ -205,10 +205,24 @@ typedef struct _t_EsifUpManagerEntry {
 } EsifUpManagerEntry, *EsifUpManagerEntryPtr, **EsifUpManagerEntryPtrLocation;
 
 
-/* Participant Manager */
+/*
+ * Participant Manager
+ * fEntries is indexed by participant instance.  The remaining members index
+ * it so that lookups and enumeration do not scan MAX_PARTICIPANT_ENTRY slots:
+ * fNameIndexPtr maps the upper-cased name of every entry with a participant
+ * to its entry, fHidIndexPtr maps the ACPI device (HID) of each available
+ * participant to its entry, fLpInstanceMap maps a lower participant instance
+ * to the lowest upper participant instance using it, and the first
+ * fEntryCount members of fLiveInstances are the available instances in
+ * ascending order.  All are protected by fLock.
+ */
 typedef struct _t_EsifUppMgr {
 	UInt8 fEntryCount;
 	EsifUpManagerEntry fEntries[MAX_PARTICIPANT_ENTRY];
+	struct esif_ht *fNameIndexPtr;
+	struct esif_ht *fHidIndexPtr;
+	UInt8 fLpInstanceMap[ESIF_PARTICIPANT_INVALID_INSTANCE + 1];
+	UInt8 fLiveInstances[MAX_PARTICIPANT_ENTRY];
 	esif_ccb_lock_t fLock;
 } EsifUppMgr, *EsifUppMgrPtr, **EsifUppMgrPtrLocation;
 
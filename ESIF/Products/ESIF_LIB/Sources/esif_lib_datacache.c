@@ -31,11 +31,30 @@
 
 ///////////////////////////////////////////////////////
 // DataCache Class
+//
+// Entries are kept in an array sorted by key so that they can be written to
+// the DataVault and enumerated in order. Lookups by key use a hash index of the
+// array instead of a binary search, and keys are stored in an arena so that
+// loading a DataVault does not allocate each key separately.
+
+#define DATACACHE_MIN_CAPACITY		16		// Initial number of entries allocated
+#define DATACACHE_ARENA_BLOCKSIZE	4096	// Minimum size of a key storage block
 
 // private members
 static DataCacheEntryPtr DataCache_GetList(DataCachePtr self);
 static int DataCache_Search(DataCachePtr self, esif_string key);
 static int DataCache_FindInsertionPoint(DataCachePtr self, esif_string key);
+static eEsifError DataCache_Insert(DataCachePtr self, esif_string key, EsifDataPtr valuePtr, esif_flags_t flags, Bool copyKey);
+static eEsifError DataCache_Reserve(DataCachePtr self, UInt32 capacity);
+static void DataCache_IndexEntry(DataCachePtr self, UInt32 node);
+static void DataCache_UnindexEntry(DataCachePtr self, UInt32 node);
+static void DataCache_RenumberIndex(DataCachePtr self, UInt32 node, int delta);
+static void DataCache_RebuildIndex(DataCachePtr self);
+static UInt32 DataCache_HashKey(esif_string key);
+static char *DataCache_ArenaAlloc(DataCachePtr self, size_t len);
+static Bool DataCache_ArenaOwns(DataCachePtr self, const char *buf);
+static void DataCache_ArenaRelease(DataCachePtr self, const char *buf, size_t len);
+static void DataCache_ArenaCompact(DataCachePtr self);
 static EsifDataPtr CloneCacheData(EsifDataPtr dataPtr);
 
 // constructor
@@ -50,6 +69,7 @@ DataCachePtr DataCache_Create ()
 void DataCache_Destroy (DataCachePtr self)
 {
 	UInt32 i;
+	DataCacheArenaBlockPtr block = NULL;
 
 	if (NULL == self) {
 		return;
@@ -59,6 +79,12 @@ void DataCache_Destroy (DataCachePtr self)
 		EsifData_dtor(&self->elements[i].value);
 	}
 	esif_ccb_free(self->elements);
+	esif_ccb_free(self->index);
+
+	while ((block = self->arena) != NULL) {
+		self->arena = block->next;
+		esif_ccb_free(block);
+	}
 	WIPEPTR(self);
 	esif_ccb_free(self);
 }
@@ -89,8 +115,9 @@ DataCacheEntryPtr DataCache_GetValue (
 // member indicates the buf_ptr represents a file offset; not whether the EsifData
 // items owns the associated buffer.
 // Notes: The pair is inserted even if a key with the same name already exists.
-// The cache array will be re-allocated to fit the new member and old members
-// will be copied down if needed to allow insertion
+// The cache array grows geometrically and old members will be copied down if
+// needed to allow insertion. Appending in key order (as when a DataVault is read)
+// does not move any members.
 //
 eEsifError DataCache_InsertValue(
 	DataCachePtr self,
@@ -98,14 +125,42 @@ eEsifError DataCache_InsertValue(
 	EsifDataPtr valuePtr,
 	esif_flags_t flags
 	)
+{
+	return DataCache_Insert(self, key, valuePtr, flags, ESIF_TRUE);
+}
+
+
+//
+// Same as DataCache_InsertValue, but the key is not copied, so it must remain
+// valid for the life of the cache (such as a key in a mapped DataVault image)
+//
+eEsifError DataCache_InsertStaticValue(
+	DataCachePtr self,
+	esif_string key,
+	EsifDataPtr valuePtr,
+	esif_flags_t flags
+	)
+{
+	return DataCache_Insert(self, key, valuePtr, flags, ESIF_FALSE);
+}
+
+
+static eEsifError DataCache_Insert(
+	DataCachePtr self,
+	esif_string key,
+	EsifDataPtr valuePtr,
+	esif_flags_t flags,
+	Bool copyKey
+	)
 {
 	eEsifError rc = ESIF_OK;
-	DataCacheEntryPtr old_elements = NULL;
 	EsifData keydata;
 	EsifDataPtr valueClonePtr = NULL;
+	char *keyCopy = NULL;
+	size_t keyLen = 0;
 	int node = 0;
 
-	if ((NULL == self) || (NULL == valuePtr)) {
+	if ((NULL == self) || (NULL == key) || (NULL == valuePtr)) {
 		rc = ESIF_E_PARAMETER_IS_NULL;
 		goto exit;
 	}
@@ -116,29 +171,46 @@ eEsifError DataCache_InsertValue(
 		goto exit;
 	}
 
-	node = DataCache_FindInsertionPoint(self, key);
+	// Make room for the new pair
+	if (self->size >= self->capacity) {
+		rc = DataCache_Reserve(self, esif_ccb_max(DATACACHE_MIN_CAPACITY, self->capacity * 2));
+		if (rc != ESIF_OK) {
+			goto exit;
+		}
+	}
 
-	// Reallocate the elements to fit the new pair
-	old_elements = self->elements;
-	self->elements = (DataCacheEntryPtr)esif_ccb_realloc(self->elements, (self->size + 1) * sizeof(*self->elements));
-	if (NULL == self->elements) {
-		self->elements = old_elements;
-		rc = ESIF_E_NO_MEMORY;
-		goto exit;
+	// Copy the key into the arena unless it is static. The key never owns its buffer (buf_len = 0)
+	keyLen = esif_ccb_strlen(key, MAXAUTOLEN) + 1;
+	if (copyKey) {
+		keyCopy = DataCache_ArenaAlloc(self, keyLen);
+		if (NULL == keyCopy) {
+			rc = ESIF_E_NO_MEMORY;
+			goto exit;
+		}
+		esif_ccb_memcpy(keyCopy, key, keyLen - 1);
+		keyCopy[keyLen - 1] = 0;
 	}
-	
-	// Move old pairs down to fit the new pair
+	else {
+		keyCopy = key;
+	}
+
+	node = DataCache_FindInsertionPoint(self, key);
+
+	// Move old pairs down to fit the new pair and renumber them in the Hash Index
 	if (node < (int)self->size) {
 		memmove(&self->elements[node + 1], &self->elements[node], (self->size - node) * sizeof(*self->elements));
+		DataCache_RenumberIndex(self, node, 1);
 	}
 
 	// Insert the new pair
 	EsifData_ctor(&keydata);
-	EsifData_Set(&keydata, ESIF_DATA_STRING, esif_ccb_strdup(key), ESIFAUTOLEN, ESIFAUTOLEN);
+	EsifData_Set(&keydata, ESIF_DATA_STRING, keyCopy, 0, (u32)keyLen);
 	self->elements[node].key   = keydata;
 	self->elements[node].value = *valueClonePtr;
 	self->elements[node].flags = flags;
+	self->elements[node].hash  = DataCache_HashKey(key);
 	self->size++;
+	DataCache_IndexEntry(self, node);
 exit:
 	if (rc == ESIF_OK) {
 		esif_ccb_free(valueClonePtr); // Free pointer but don't destroy as the element owns buffer now
@@ -155,7 +227,9 @@ eEsifError DataCache_DeleteValue(
 	)
 {
 	eEsifError rc = ESIF_OK;
-	UInt32 node = 0;
+	int node = 0;
+	char *keyPtr = NULL;
+	size_t keyLen = 0;
 
 	if (NULL == self) {
 		rc = ESIF_E_PARAMETER_IS_NULL;
@@ -167,27 +241,25 @@ eEsifError DataCache_DeleteValue(
 		rc = ESIF_E_NOT_FOUND;
 		goto exit;
 	}
+
+	// Remove the pair from the Hash Index while the element numbers are unchanged
+	DataCache_UnindexEntry(self, node);
+
+	// The key buffer is reclaimed when the arena is compacted
+	keyPtr = (char *)self->elements[node].key.buf_ptr;
+	keyLen = self->elements[node].key.data_len;
 	EsifData_dtor(&self->elements[node].key);
 	EsifData_dtor(&self->elements[node].value);
 
-	if (node < self->size - 1) {
+	// Move the remaining pairs up and renumber them in the Hash Index
+	if (node < (int)self->size - 1) {
 		memmove(&self->elements[node], &self->elements[node + 1], (self->size - node - 1) * sizeof(*self->elements));
-		esif_ccb_memset(&self->elements[self->size - 1], 0, sizeof(self->elements[0]));
-	}
-
-	if (self->size > 1) {
-		DataCacheEntryPtr old_elements = self->elements;
-		self->elements = (DataCacheEntryPtr)esif_ccb_realloc(self->elements, (self->size - 1) * sizeof(*self->elements));
-		if (NULL == self->elements) {
-			self->elements = old_elements;
-			rc = ESIF_E_NO_MEMORY;
-			goto exit;
-		}
-	} else {
-		esif_ccb_free(self->elements);
-		self->elements = NULL;
+		DataCache_RenumberIndex(self, node + 1, -1);
 	}
 	self->size--;
+	esif_ccb_memset(&self->elements[self->size], 0, sizeof(self->elements[0]));
+
+	DataCache_ArenaRelease(self, keyPtr, keyLen);
 exit:
 	return rc;
 }
@@ -199,6 +271,76 @@ UInt32 DataCache_GetCount (DataCachePtr self)
 }
 
 
+int DataCache_FindMatch(
+	DataCachePtr self,
+	esif_string pattern,
+	UInt32 start
+	)
+{
+	size_t prefixLen = 0;
+	UInt32 node = 0;
+
+	if (NULL == self) {
+		return EOF;
+	}
+
+	// Start at the first key that sorts at or after the literal prefix of the pattern
+	if (pattern != NULL) {
+		prefixLen = esif_ccb_strcspn(pattern, "*?");
+	}
+	if (prefixLen > 0) {
+		UInt32 lo = 0;
+		UInt32 hi = self->size;
+		while (lo < hi) {
+			UInt32 mid = lo + (hi - lo) / 2;
+			if (esif_ccb_strnicmp((esif_string)self->elements[mid].key.buf_ptr, pattern, prefixLen) < 0) {
+				lo = mid + 1;
+			} else {
+				hi = mid;
+			}
+		}
+		start = esif_ccb_max(start, lo);
+	}
+
+	// Keys sharing the prefix are contiguous, so stop at the first one that does not
+	for (node = start; node < self->size; node++) {
+		esif_string key = (esif_string)self->elements[node].key.buf_ptr;
+		if (prefixLen > 0 && esif_ccb_strnicmp(key, pattern, prefixLen) != 0) {
+			break;
+		}
+		if (pattern == NULL || esif_ccb_strmatch(key, pattern)) {
+			return (int)node;
+		}
+	}
+	return EOF;
+}
+
+
+UInt32 DataCache_FindNext(
+	DataCachePtr self,
+	esif_string key
+	)
+{
+	UInt32 lo = 0;
+	UInt32 hi = 0;
+
+	if ((NULL == self) || (NULL == key)) {
+		return 0;
+	}
+
+	hi = self->size;
+	while (lo < hi) {
+		UInt32 mid = lo + (hi - lo) / 2;
+		if (esif_ccb_stricmp((esif_string)self->elements[mid].key.buf_ptr, key) <= 0) {
+			lo = mid + 1;
+		} else {
+			hi = mid;
+		}
+	}
+	return lo;
+}
+
+
 // Private Members
 DataCacheEntryPtr DataCache_GetList (DataCachePtr self)
 {
@@ -211,23 +353,24 @@ static int DataCache_Search (
 	esif_string key
 	)
 {
-	// Do Binary Search on Sorted Array
-	int items = 0;
-	
+	UInt32 hash = 0;
+	UInt32 mask = 0;
+	UInt32 slot = 0;
+
 	ESIF_ASSERT(self != NULL);
 
-	items = self->size;
-	int start = 0, end = items - 1, node = items / 2;
-	while (start <= end) {
-		int comp = esif_ccb_stricmp(key, (esif_string)(self->elements[node].key.buf_ptr));
-		if (comp == 0) {
-			return node;
-		} else if (comp > 0) {
-			start = node + 1;
-		} else {
-			end = node - 1;
+	if ((NULL == key) || (NULL == self->index)) {
+		return EOF;
+	}
+
+	// Probe the Hash Index until an empty slot is found
+	hash = DataCache_HashKey(key);
+	mask = self->indexSize - 1;
+	for (slot = hash & mask; self->index[slot] != 0; slot = (slot + 1) & mask) {
+		DataCacheEntryPtr entry = &self->elements[self->index[slot] - 1];
+		if (entry->hash == hash && esif_ccb_stricmp(key, (esif_string)entry->key.buf_ptr) == 0) {
+			return (int)(self->index[slot] - 1);
 		}
-		node = (end - start) / 2 + start;
 	}
 	return EOF;
 }
@@ -250,6 +393,12 @@ static int DataCache_FindInsertionPoint (
 	ESIF_ASSERT(self != NULL);
 
 	items = self->size;
+
+	// Keys are usually inserted in order, so check for an append first
+	if (items == 0 || esif_ccb_stricmp(key, (esif_string)self->elements[items - 1].key.buf_ptr) > 0) {
+		return items;
+	}
+
 	start = 0;
 	end = items - 1;
 	node = items / 2;
@@ -270,6 +419,241 @@ static int DataCache_FindInsertionPoint (
 }
 
 
+//
+// Grows the element array to hold at least capacity entries and sizes the Hash
+// Index so that it is never more than half full
+//
+static eEsifError DataCache_Reserve (
+	DataCachePtr self,
+	UInt32 capacity
+	)
+{
+	DataCacheEntryPtr new_elements = NULL;
+	UInt32 *new_index = NULL;
+	UInt32 indexSize = DATACACHE_MIN_CAPACITY;
+
+	ESIF_ASSERT(self != NULL);
+
+	if (capacity <= self->capacity) {
+		return ESIF_OK;
+	}
+
+	while (indexSize < capacity * 2) {
+		indexSize *= 2;
+	}
+	new_index = (UInt32 *)esif_ccb_malloc(indexSize * sizeof(*new_index));
+	if (NULL == new_index) {
+		return ESIF_E_NO_MEMORY;
+	}
+
+	new_elements = (DataCacheEntryPtr)esif_ccb_realloc(self->elements, capacity * sizeof(*self->elements));
+	if (NULL == new_elements) {
+		esif_ccb_free(new_index);
+		return ESIF_E_NO_MEMORY;
+	}
+	self->elements = new_elements;
+	self->capacity = capacity;
+
+	esif_ccb_free(self->index);
+	self->index = new_index;
+	self->indexSize = indexSize;
+	DataCache_RebuildIndex(self);
+	return ESIF_OK;
+}
+
+
+// Adds an element to the Hash Index
+static void DataCache_IndexEntry (
+	DataCachePtr self,
+	UInt32 node
+	)
+{
+	UInt32 mask = self->indexSize - 1;
+	UInt32 slot = self->elements[node].hash & mask;
+
+	while (self->index[slot] != 0) {
+		slot = (slot + 1) & mask;
+	}
+	self->index[slot] = node + 1;
+}
+
+
+//
+// Removes an element from the Hash Index. Entries after it in the same probe
+// run are shifted back into the freed slot, so no tombstones are left behind.
+//
+static void DataCache_UnindexEntry (
+	DataCachePtr self,
+	UInt32 node
+	)
+{
+	UInt32 mask = self->indexSize - 1;
+	UInt32 slot = self->elements[node].hash & mask;
+	UInt32 next = 0;
+
+	while (self->index[slot] != node + 1) {
+		if (self->index[slot] == 0) {
+			return;
+		}
+		slot = (slot + 1) & mask;
+	}
+
+	for (next = (slot + 1) & mask; self->index[next] != 0; next = (next + 1) & mask) {
+		UInt32 home = self->elements[self->index[next] - 1].hash & mask;
+
+		// Move the entry back unless its home slot lies cyclically in (slot, next]
+		if (((next > slot) && (home <= slot || home > next)) ||
+			((next < slot) && (home <= slot && home > next))) {
+			self->index[slot] = self->index[next];
+			slot = next;
+		}
+	}
+	self->index[slot] = 0;
+}
+
+
+// Adjusts the element numbers in the Hash Index after the elements from node onwards have moved by delta
+static void DataCache_RenumberIndex (
+	DataCachePtr self,
+	UInt32 node,
+	int delta
+	)
+{
+	UInt32 slot = 0;
+
+	for (slot = 0; slot < self->indexSize; slot++) {
+		if (self->index[slot] > node) {
+			self->index[slot] += delta;
+		}
+	}
+}
+
+
+// Rebuilds the Hash Index after elements have moved within the array
+static void DataCache_RebuildIndex (DataCachePtr self)
+{
+	UInt32 node = 0;
+
+	if (NULL == self->index) {
+		return;
+	}
+	esif_ccb_memset(self->index, 0, self->indexSize * sizeof(*self->index));
+	for (node = 0; node < self->size; node++) {
+		DataCache_IndexEntry(self, node);
+	}
+}
+
+
+// Case-insensitive FNV-1a hash of a key
+static UInt32 DataCache_HashKey (esif_string key)
+{
+	UInt32 hash = 2166136261U;
+
+	while (*key) {
+		hash ^= (UInt8)tolower((UInt8)*key++);
+		hash *= 16777619U;
+	}
+	return hash;
+}
+
+
+// Allocates key storage from the arena, adding a new block if the current one is full
+static char *DataCache_ArenaAlloc (
+	DataCachePtr self,
+	size_t len
+	)
+{
+	DataCacheArenaBlockPtr block = self->arena;
+	char *buf = NULL;
+
+	if ((NULL == block) || (block->size - block->used < len)) {
+		size_t blockSize = esif_ccb_max(DATACACHE_ARENA_BLOCKSIZE, len);
+		block = (DataCacheArenaBlockPtr)esif_ccb_malloc(sizeof(*block) + blockSize);
+		if (NULL == block) {
+			return NULL;
+		}
+		block->size = blockSize;
+		block->used = 0;
+		block->next = self->arena;
+		self->arena = block;
+	}
+	buf = &block->data[block->used];
+	block->used += len;
+	self->arenaUsed += len;
+	return buf;
+}
+
+
+// Returns whether a key buffer was allocated from the arena (rather than being a static key)
+static Bool DataCache_ArenaOwns (
+	DataCachePtr self,
+	const char *buf
+	)
+{
+	DataCacheArenaBlockPtr block = NULL;
+
+	for (block = self->arena; block != NULL; block = block->next) {
+		if (buf >= block->data && buf < &block->data[block->used]) {
+			return ESIF_TRUE;
+		}
+	}
+	return ESIF_FALSE;
+}
+
+
+// Records a deleted key and compacts the arena once at least half of it is unused
+static void DataCache_ArenaRelease (
+	DataCachePtr self,
+	const char *buf,
+	size_t len
+	)
+{
+	if ((NULL == buf) || !DataCache_ArenaOwns(self, buf)) {
+		return;
+	}
+	self->arenaFree += len;
+	if (self->arenaFree >= DATACACHE_ARENA_BLOCKSIZE && self->arenaFree * 2 >= self->arenaUsed) {
+		DataCache_ArenaCompact(self);
+	}
+}
+
+
+// Copies the keys still in use into a single new block and frees the old blocks
+static void DataCache_ArenaCompact (DataCachePtr self)
+{
+	DataCacheArenaBlockPtr oldArena = self->arena;
+	DataCacheArenaBlockPtr block = NULL;
+	size_t liveBytes = self->arenaUsed - self->arenaFree;
+	size_t blockSize = esif_ccb_max(DATACACHE_ARENA_BLOCKSIZE, liveBytes);
+	UInt32 node = 0;
+
+	block = (DataCacheArenaBlockPtr)esif_ccb_malloc(sizeof(*block) + blockSize);
+	if (NULL == block) {
+		return; // Keep using the old blocks
+	}
+	block->size = blockSize;
+	block->used = 0;
+	block->next = NULL;
+
+	for (node = 0; node < self->size; node++) {
+		EsifDataPtr key = &self->elements[node].key;
+		if (DataCache_ArenaOwns(self, (const char *)key->buf_ptr)) {
+			esif_ccb_memcpy(&block->data[block->used], key->buf_ptr, key->data_len);
+			key->buf_ptr = &block->data[block->used];
+			block->used += key->data_len;
+		}
+	}
+
+	self->arena = block;
+	self->arenaUsed = block->used;
+	self->arenaFree = 0;
+	while ((block = oldArena) != NULL) {
+		oldArena = block->next;
+		esif_ccb_free(block);
+	}
+}
+
+
 DataCachePtr DataCache_Clone(
 	DataCachePtr self
 	)
@@ -290,6 +674,11 @@ DataCachePtr DataCache_Clone(
 		goto exit;
 	}
 
+	rc = DataCache_Reserve(clonePtr, self->size);
+	if (rc != ESIF_OK) {
+		goto exit;
+	}
+
 	curElement = self->elements;
 	for (idx = 0; idx < self->size; idx++, curElement++) {
 		rc = DataCache_InsertValue(clonePtr,
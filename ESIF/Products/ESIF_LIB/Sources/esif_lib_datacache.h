@@ -39,6 +39,7 @@ struct DataCacheEntry_s {
 	esif_flags_t		flags;		// Flags for this Row (i.e., Persist, Encrypted, etc)
 	EsifData			key;		// Key for this Row
 	EsifData			value;		// Value for this Row
+	UInt32				hash;		// Case-insensitive hash of the Key
 };
 
 #endif	// _DATACACHE_CLASS
@@ -50,9 +51,27 @@ struct DataCache_s;
 typedef struct DataCache_s DataCache, *DataCachePtr, **DataCachePtrLocation;
 
 #ifdef _DATACACHE_CLASS
+
+// Block of key storage; deleted keys are reclaimed when the arena is compacted
+struct DataCacheArenaBlock_s;
+typedef struct DataCacheArenaBlock_s DataCacheArenaBlock, *DataCacheArenaBlockPtr;
+
+struct DataCacheArenaBlock_s {
+	DataCacheArenaBlockPtr	next;	// Next (older) block
+	size_t					size;	// Bytes available in this block
+	size_t					used;	// Bytes used in this block
+	char					data[1];
+};
+
 struct DataCache_s {
-	UInt32				size; // Number of DataCacheEntry's
-	DataCacheEntryPtr	elements; // Array of entry pointers
+	UInt32					size; // Number of DataCacheEntry's
+	UInt32					capacity; // Number of allocated DataCacheEntry's
+	DataCacheEntryPtr		elements; // Array of entries, sorted by key
+	UInt32					*index; // Hash index of entries (element number + 1, 0 = empty slot)
+	UInt32					indexSize; // Number of hash index slots (power of 2)
+	DataCacheArenaBlockPtr	arena; // Key storage
+	size_t					arenaUsed; // Bytes allocated from the arena
+	size_t					arenaFree; // Bytes of allocated keys that have been deleted
 };
 
 #endif	// _DATACACHE_CLASS
@@ -76,9 +95,21 @@ DataCacheEntryPtr DataCache_GetValue(DataCachePtr self, esif_string key);
 // items owns the associated buffer as traditionally used in the EsifData items.
 //
 eEsifError DataCache_InsertValue(DataCachePtr self, esif_string key, EsifDataPtr valuePtr, esif_flags_t flags);
+// Same as DataCache_InsertValue, but the key is not copied and must remain valid for the life of the cache
+eEsifError DataCache_InsertStaticValue(DataCachePtr self, esif_string key, EsifDataPtr valuePtr, esif_flags_t flags);
 eEsifError DataCache_DeleteValue(DataCachePtr self, esif_string key);
 UInt32 DataCache_GetCount(DataCachePtr self);
 
+//
+// Wildcard searches for "*" and "?" patterns. Only the entries that share the
+// literal prefix of the pattern (the part before the first wildcard) are visited.
+// A NULL pattern matches every key.
+//
+// Returns the number of the first entry at or after start whose key matches the pattern, or EOF
+int DataCache_FindMatch(DataCachePtr self, esif_string pattern, UInt32 start);
+// Returns the number of the first entry whose key sorts after the given key (0 if key is NULL)
+UInt32 DataCache_FindNext(DataCachePtr self, esif_string key);
+
 DataCachePtr DataCache_Clone(
 	DataCachePtr self
 	);
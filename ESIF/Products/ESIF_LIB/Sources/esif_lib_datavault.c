@@ -84,6 +84,35 @@ static eEsifError DataVault_WriteKeyValuePair(
 	IOStreamPtr destStreamPtr
 	);
 
+static eEsifError DataVault_SetCacheValue(
+	DataVaultPtr self,
+	EsifDataPtr path,
+	EsifDataPtr value,
+	esif_flags_t *flagsPtr
+	);
+
+static eEsifError DataVault_WriteJournal(
+	DataVaultPtr self,
+	EsifDataPtr path,
+	EsifDataPtr value,
+	esif_flags_t flags
+	);
+
+static eEsifError DataVault_ReplayJournal(
+	DataVaultPtr self
+	);
+
+static void DataVault_CompactCallback(
+	DataVaultPtr self
+	);
+
+static void DataVault_GetFileName(
+	DataVaultPtr self,
+	esif_string ext,
+	esif_string buffer,
+	size_t buf_len
+	);
+
 /////////////////////////////////////////////////////////////////////////
 // DataVault Class
 
@@ -95,6 +124,7 @@ static void DataVault_ctor(DataVaultPtr self)
 		esif_ccb_lock_init(&self->lock);
 		self->cache  = DataCache_Create();
 		self->stream = IOStream_Create();
+		esif_ccb_timer_init(&self->compact_timer, (esif_ccb_timer_cb)DataVault_CompactCallback, self);
 	}
 }
 
@@ -103,7 +133,20 @@ static void DataVault_ctor(DataVaultPtr self)
 static void DataVault_dtor(DataVaultPtr self)
 {
 	if (self) {
+		esif_ccb_timer_kill_w_wait(&self->compact_timer);
+		if (self->journal_len > 0) {
+			DataVault_CompactJournal(self);
+		}
+		if (self->journal) {
+			esif_ccb_fclose(self->journal);
+		}
 		DataCache_Destroy(self->cache);
+		if (self->image_mapped) {
+			esif_ccb_munmap_file(self->image, self->image_len);
+		}
+		else {
+			esif_ccb_free(self->image);
+		}
 		IOStream_Destroy(self->stream);
 		esif_ccb_lock_uninit(&self->lock);
 		WIPEPTR(self);
@@ -132,7 +175,64 @@ void DataVault_Destroy(DataVaultPtr self)
 }
 
 
+// Get the name of a file that accompanies the DataVault file, such as its Journal
+static void DataVault_GetFileName(
+	DataVaultPtr self,
+	esif_string ext,
+	esif_string buffer,
+	size_t buf_len
+	)
+{
+	size_t len = 0;
+	size_t ext_len = sizeof(ESIFDV_FILEEXT) - 1;
+
+	esif_ccb_strcpy(buffer, self->stream->file.name, buf_len);
+	len = esif_ccb_strlen(buffer, buf_len);
+	if (len >= ext_len && esif_ccb_stricmp(buffer + len - ext_len, ESIFDV_FILEEXT) == 0) {
+		buffer[len - ext_len] = 0;
+	}
+	esif_ccb_strcat(buffer, ext, buf_len);
+}
+
+
+// Compact the Journal by writing the DataVault to Disk and then removing the Journal
+eEsifError DataVault_CompactJournal(DataVaultPtr self)
+{
+	eEsifError rc = DataVault_WriteVault(self);
+
+	if (rc == ESIF_OK && IOStream_GetType(self->stream) == StreamFile) {
+		char journal_name[MAX_PATH] = {0};
+
+		if (self->journal) {
+			esif_ccb_fclose(self->journal);
+			self->journal = NULL;
+		}
+		DataVault_GetFileName(self, ESIFDV_JOURNALFILEEXT, journal_name, sizeof(journal_name));
+		esif_ccb_unlink(journal_name);
+		self->journal_len = 0;
+	}
+	return rc;
+}
+
+
+// Background Journal Compaction
+static void DataVault_CompactCallback(DataVaultPtr self)
+{
+	if (self) {
+		esif_ccb_write_lock(&self->lock);
+		if (self->journal_len > 0) {
+			DataVault_CompactJournal(self);
+		}
+		esif_ccb_write_unlock(&self->lock);
+	}
+}
+
+
 // Write DataVault to Disk
+//
+// The DataVault is written to a temporary file that replaces the DataVault file once it
+// is committed to disk, so a crash while writing never leaves a partial DataVault behind.
+//
 eEsifError DataVault_WriteVault(DataVaultPtr self)
 {
 	eEsifError rc = ESIF_OK;
@@ -143,13 +243,14 @@ eEsifError DataVault_WriteVault(DataVaultPtr self)
 	size_t memStreamBufSize = 0;
 	UInt32 idx;
 	DataCachePtr cacheClonePtr = NULL;
+	char tmp_name[MAX_PATH] = {0};
 
 	if (FLAGS_TEST(self->flags, ESIF_SERVICE_CONFIG_STATIC | ESIF_SERVICE_CONFIG_READONLY)) {
 		rc = ESIF_E_READONLY;
 		goto exit;
 	}
 
-	if (self->stream->file.name == NULL || self->cache == NULL) {
+	if (IOStream_GetType(self->stream) != StreamFile || self->stream->file.name == NULL || self->cache == NULL) {
 		rc = ESIF_E_PARAMETER_IS_NULL;
 		goto exit;
 	}
@@ -240,9 +341,10 @@ eEsifError DataVault_WriteVault(DataVaultPtr self)
 	memStreamBufSize = IOStream_GetSize(memStreamPtr);
 
 	//
-	// Now write the memory stream to the disk
+	// Now write the memory stream to the disk and replace the DataVault file with it
 	//
-	if (rc == ESIF_OK && IOStream_OpenFile(diskStreamPtr, self->stream->file.name, "wb") != EOK) {
+	DataVault_GetFileName(self, ESIFDV_TMPFILEEXT, tmp_name, sizeof(tmp_name));
+	if (rc == ESIF_OK && IOStream_OpenFile(diskStreamPtr, tmp_name, "wb") != EOK) {
 		rc = ESIF_E_IO_OPEN_FAILED;
 		goto exit;
 	}
@@ -251,9 +353,23 @@ eEsifError DataVault_WriteVault(DataVaultPtr self)
 		rc = ESIF_E_IO_ERROR;
 		goto exit;
 	}
+
+	if (rc == ESIF_OK && esif_ccb_fsync(diskStreamPtr->file.handle) != 0) {
+		rc = ESIF_E_IO_ERROR;
+		goto exit;
+	}
+	IOStream_Close(diskStreamPtr);
+
+	if (rc == ESIF_OK && esif_ccb_rename(tmp_name, self->stream->file.name) != 0) {
+		rc = ESIF_E_IO_ERROR;
+		goto exit;
+	}
 exit:
 	IOStream_Destroy(diskStreamPtr);
 	IOStream_Destroy(memStreamPtr);
+	if (rc != ESIF_OK && tmp_name[0]) {
+		esif_ccb_unlink(tmp_name);
+	}
 
 	if (rc != ESIF_OK && cacheClonePtr != NULL) {
 		DataCache_Destroy(self->cache);
@@ -372,6 +488,11 @@ exit:
 
 
 // Read DataVault from Disk
+//
+// Files are mapped (or Memory Blocks used in place) instead of being copied into
+// a memory stream. Static and Read-Only DataVaults keep that image, and their cache
+// entries point into it instead of owning copies of each key and value.
+//
 eEsifError DataVault_ReadVault(DataVaultPtr self)
 {
 	eEsifError rc = ESIF_OK;
@@ -381,13 +502,35 @@ eEsifError DataVault_ReadVault(DataVaultPtr self)
 	UInt32 hdrSize = 0;
 	UInt32 min_version = 0;
 	UInt32 max_version = 0;
+	BytePtr image = NULL;
+	size_t image_len = 0;
+	Bool image_mapped = ESIF_FALSE;
 
 	orgStreamPtr = self->stream;
 
-	// Read the file into a memory stream for faster accesses (hash, size, etc.)
-	rc = IOStream_CloneAsMemoryStream(self->stream, &memStreamPtr);
-	if (rc != ESIF_OK) {
-		goto exit;
+	if (IOStream_GetType(self->stream) == StreamFile) {
+		image = (BytePtr)esif_ccb_mmap_file(self->stream->file.name, &image_len);
+		image_mapped = (image != NULL);
+	}
+	else if (IOStream_GetType(self->stream) == StreamMemory) {
+		image = IOStream_GetMemoryBuffer(self->stream);
+		image_len = IOStream_GetSize(self->stream);
+	}
+
+	if (image != NULL) {
+		memStreamPtr = IOStream_Create();
+		if (NULL == memStreamPtr) {
+			rc = ESIF_E_NO_MEMORY;
+			goto exit;
+		}
+		IOStream_SetStaticMemory(memStreamPtr, image, image_len);
+	}
+	else {
+		// Read the file into a memory stream for faster accesses (hash, size, etc.)
+		rc = IOStream_CloneAsMemoryStream(self->stream, &memStreamPtr);
+		if (rc != ESIF_OK) {
+			goto exit;
+		}
 	}
 
 	self->stream = memStreamPtr;
@@ -418,6 +561,30 @@ eEsifError DataVault_ReadVault(DataVaultPtr self)
 		goto exit;
 	}
 
+	//
+	// Keep the image for Static and Read-Only DataVaults that are being loaded for the first time.
+	// Memory Blocks are copied once since the original stream may be replaced.
+	//
+	if ((image != NULL) &&
+		((self->flags | header.flags) & (ESIF_SERVICE_CONFIG_STATIC | ESIF_SERVICE_CONFIG_READONLY)) &&
+		(self->image == NULL) &&
+		(DataCache_GetCount(self->cache) == 0)) {
+
+		if (!image_mapped) {
+			image = (BytePtr)esif_ccb_malloc(esif_ccb_max(1, image_len));
+			if (NULL == image) {
+				rc = ESIF_E_NO_MEMORY;
+				goto exit;
+			}
+			esif_ccb_memcpy(image, IOStream_GetMemoryBuffer(memStreamPtr), image_len);
+			IOStream_SetStaticMemory(memStreamPtr, image, image_len);
+		}
+		self->image = image;
+		self->image_len = image_len;
+		self->image_mapped = image_mapped;
+		image_mapped = ESIF_FALSE;	// Now owned by the DataVault
+	}
+
 	// Save the header flags and version
 	self->flags = header.flags;
 	self->version = header.version;
@@ -429,6 +596,14 @@ exit:
 	self->stream = orgStreamPtr; // Restore the original stream
 	//esif_ccb_free(dataHdrsPtr);
 	IOStream_Destroy(memStreamPtr);
+	if (image_mapped) {
+		esif_ccb_munmap_file(image, image_len);
+	}
+
+	// Recover any changes Journaled since the DataVault file was last written
+	if (rc == ESIF_OK) {
+		rc = DataVault_ReplayJournal(self);
+	}
 	return rc;
 }
 
@@ -513,8 +688,13 @@ static eEsifError DataVault_ReadPayload(DataVaultPtr self)
 
 		fileOffset = curFileOffset;
 
-		// Add value (including allocated buf_ptr) to cache
-		DataCache_InsertValue(self->cache, (esif_string)key.buf_ptr, &value, item_flags);
+		// Add value (including allocated buf_ptr) to cache. Keys in the image are not copied
+		if (key.buf_len == 0) {
+			DataCache_InsertStaticValue(self->cache, (esif_string)key.buf_ptr, &value, item_flags);
+		}
+		else {
+			DataCache_InsertValue(self->cache, (esif_string)key.buf_ptr, &value, item_flags);
+		}
 
 		EsifData_dtor(&key);
 		EsifData_dtor(&value);
@@ -566,15 +746,17 @@ static eEsifError DataVault_ReadNextKeyValuePair(
 		goto exit;
 	}
 
-	// Use Memory Pointers for Static DataVaults, otherwise allocate memory
-	if ((IOStream_GetType(vault) == StreamMemory) && (self->flags & ESIF_SERVICE_CONFIG_STATIC)) {
+	// Use Memory Pointers into the image for Static and Read-Only DataVaults, otherwise allocate memory
+	if ((self->image != NULL) &&
+		(keyPtr->data_len > 0) &&
+		(IOStream_GetOffset(vault) + keyPtr->data_len <= self->image_len) &&
+		(self->image[IOStream_GetOffset(vault) + keyPtr->data_len - 1] == 0)) {
 		keyPtr->buf_len = 0;
 		keyPtr->buf_ptr = IOStream_GetMemoryBuffer(vault) + IOStream_GetOffset(vault);
 		if (IOStream_Seek(vault, keyPtr->data_len, SEEK_CUR) != EOK) {
 			rc = ESIF_E_IO_ERROR;
 			goto exit;
 		}
-		*flagsPtr &= ~ESIF_SERVICE_CONFIG_NOCACHE;	// ignore for Static DataVaults
 	}
 	else {
 		keyPtr->buf_len = esif_ccb_max(1, keyPtr->data_len);
@@ -606,6 +788,11 @@ static eEsifError DataVault_ReadNextKeyValuePair(
 		goto exit;
 	}
 
+	// The image already holds the data, so ignore NOCACHE for Static and Read-Only DataVaults
+	if (self->image != NULL) {
+		*flagsPtr &= ~ESIF_SERVICE_CONFIG_NOCACHE;
+	}
+
 	// If NOCACHE mode, use buf_ptr to store the file offset of the data and skip the file
 	if (*flagsPtr & ESIF_SERVICE_CONFIG_NOCACHE) {
 		size_t offset = IOStream_GetOffset(vault);
@@ -617,8 +804,8 @@ static eEsifError DataVault_ReadNextKeyValuePair(
 		valuePtr->buf_len = 0;	// buf_len == 0 so we don't release buffer as not allocated; data_len = original length
 	} 
 	else {
-		// Use static pointer for static data vaults (unless scrambled), otherwise make a dynamic copy
-		if ((IOStream_GetType(vault) == StreamMemory) && (self->flags & ESIF_SERVICE_CONFIG_STATIC) && !(*flagsPtr & ESIF_SERVICE_CONFIG_SCRAMBLE)) {
+		// Use pointer into the image (unless scrambled), otherwise make a dynamic copy
+		if ((self->image != NULL) && !(*flagsPtr & ESIF_SERVICE_CONFIG_SCRAMBLE)) {
 			valuePtr->buf_len = 0;	// static
 			valuePtr->buf_ptr = IOStream_GetMemoryBuffer(vault) + IOStream_GetOffset(vault);
 			if (valuePtr->buf_ptr == NULL || IOStream_Seek(vault, valuePtr->data_len, SEEK_CUR) != EOK) {
@@ -981,7 +1168,6 @@ eEsifError DataVault_SetValue(
 	)
 {
 	eEsifError rc = ESIF_OK;
-	DataCacheEntryPtr keypair;
 
 	if (FLAGS_TEST(self->flags, ESIF_SERVICE_CONFIG_STATIC | ESIF_SERVICE_CONFIG_READONLY)) {
 		return ESIF_E_READONLY;
@@ -1009,27 +1195,10 @@ eEsifError DataVault_SetValue(
 	// Write to Log
 	DataVault_WriteLog(self, (flags & ESIF_SERVICE_CONFIG_DELETE ? "DELETE" : "SET"), self->name, path, flags, value);
 
-	// Delete DataVault Key(s)?
-	if (esif_ccb_strpbrk((esif_string)path->buf_ptr, "*?") != NULL) {
-		if (flags & ESIF_SERVICE_CONFIG_DELETE) {
-			UInt32 item = 0;
-			while (item < self->cache->size) {
-				if (esif_ccb_strmatch((esif_string)self->cache->elements[item].key.buf_ptr, (esif_string)path->buf_ptr)) {
-					flags |= FLAGS_TEST(self->cache->elements[item].flags, ESIF_SERVICE_CONFIG_PERSIST);
-					if (DataCache_DeleteValue(self->cache, (esif_string)self->cache->elements[item].key.buf_ptr) == ESIF_OK) {
-						continue;
-					}
-				}
-				item++;
-			}
-			goto exit;
-		}
-		return ESIF_E_NOT_SUPPORTED; // Keys may not contain "*" or "?"
-	}
-
 	// Read data from File
 	// TODO: Change Parser Logic and Syntax instead
-	if (value && value->buf_ptr && esif_ccb_strncmp((char*)value->buf_ptr, "<<", 2) == 0) {
+	if (value && value->buf_ptr && esif_ccb_strncmp((char*)value->buf_ptr, "<<", 2) == 0 &&
+		esif_ccb_strpbrk((esif_string)path->buf_ptr, "*?") == NULL) {
 		void *buffer  = 0;
 		UInt32 buflen = 0;
 		if (ReadFileIntoBuffer((char*)value->buf_ptr + 2, &buffer, &buflen) == ESIF_OK) {
@@ -1046,6 +1215,44 @@ eEsifError DataVault_SetValue(
 		}
 	}
 
+	rc = DataVault_SetCacheValue(self, path, value, &flags);
+
+	// If Persisted, append the change to the Journal
+	if (rc == ESIF_OK && FLAGS_TEST(flags, ESIF_SERVICE_CONFIG_PERSIST)) {
+		rc = DataVault_WriteJournal(self, path, value, flags);
+	}
+	return rc;
+}
+
+
+// Apply a SET or DELETE to the DataVault's cache. Flags are updated with those of any deleted rows.
+static eEsifError DataVault_SetCacheValue(
+	DataVaultPtr self,
+	EsifDataPtr path,
+	EsifDataPtr value,
+	esif_flags_t *flagsPtr
+	)
+{
+	eEsifError rc = ESIF_OK;
+	DataCacheEntryPtr keypair;
+	esif_flags_t flags = *flagsPtr;
+
+	// Delete DataVault Key(s)?
+	if (esif_ccb_strpbrk((esif_string)path->buf_ptr, "*?") != NULL) {
+		if (flags & ESIF_SERVICE_CONFIG_DELETE) {
+			int item = DataCache_FindMatch(self->cache, (esif_string)path->buf_ptr, 0);
+			while (item != EOF) {
+				flags |= FLAGS_TEST(self->cache->elements[item].flags, ESIF_SERVICE_CONFIG_PERSIST);
+				if (DataCache_DeleteValue(self->cache, (esif_string)self->cache->elements[item].key.buf_ptr) != ESIF_OK) {
+					item++;
+				}
+				item = DataCache_FindMatch(self->cache, (esif_string)path->buf_ptr, item);
+			}
+			goto exit;
+		}
+		return ESIF_E_NOT_SUPPORTED; // Keys may not contain "*" or "?"
+	}
+
 	// Get the Data Row or create it if it does not exist
 	keypair = DataCache_GetValue(self->cache, (esif_string)path->buf_ptr);
 	if (keypair) {	// Match Found
@@ -1076,10 +1283,15 @@ eEsifError DataVault_SetValue(
 				}
 			} 
 
-			// Replace the File Offset stored in buf_ptr with a copy of the data for updated NOCACHE values
-			if (keypair->flags & ESIF_SERVICE_CONFIG_NOCACHE && keypair->value.buf_len == 0) {
+			// Replace the File Offset (NOCACHE) or the pointer into the DataVault image stored in buf_ptr
+			// with a copy of the data, since neither is owned by the row
+			if (keypair->value.buf_len == 0) {
+				void *new_buf = esif_ccb_malloc(esif_ccb_max(1, value->data_len));
+				if (new_buf == NULL) {
+					return ESIF_E_NO_MEMORY;
+				}
 				keypair->value.buf_len = esif_ccb_max(1, value->data_len);
-				keypair->value.buf_ptr = esif_ccb_malloc(value->buf_len);
+				keypair->value.buf_ptr = new_buf;
 			}
 			keypair->flags = flags;
 			keypair->value.type     = value->type;
@@ -1105,10 +1317,216 @@ eEsifError DataVault_SetValue(
 		EsifData_Destroy(valueClonePtr);
 	}
 exit:
-	// If Persisted, Flush to disk
-	if (rc == ESIF_OK && FLAGS_TEST(flags, ESIF_SERVICE_CONFIG_PERSIST)) {
-		rc = DataVault_WriteVault(self);
+	*flagsPtr = flags;
+	return rc;
+}
+
+
+// Checksum (FNV-1a) of a Journal Record
+static UInt32 DataVault_JournalChecksum(
+	UInt32 hash,
+	const void *buffer,
+	size_t bytes
+	)
+{
+	const UInt8 *ptr = (const UInt8 *)buffer;
+	size_t j;
+
+	for (j = 0; j < bytes; j++) {
+		hash ^= ptr[j];
+		hash *= 16777619U;
+	}
+	return hash;
+}
+
+
+//
+// Append a persisted SET or DELETE to the Journal and commit it to disk instead of rewriting
+// the whole DataVault. The Journal is Compacted into the DataVault file once it grows larger
+// than the DataVault, or in the background shortly after its first record is written.
+//
+static eEsifError DataVault_WriteJournal(
+	DataVaultPtr self,
+	EsifDataPtr path,
+	EsifDataPtr value,
+	esif_flags_t flags
+	)
+{
+	eEsifError rc = ESIF_OK;
+	DataVaultJournalRecord record = {0};
+	UInt8 *scrambled = NULL;
+	void *value_ptr = NULL;
+	UInt32 byte = 0;
+	size_t journal_len = 0;
+
+	// Write the whole DataVault if it has no file to Journal against (yet)
+	if (IOStream_GetType(self->stream) != StreamFile || self->stream->file.name == NULL) {
+		return DataVault_WriteVault(self);
 	}
+	if (self->journal == NULL) {
+		char journal_name[MAX_PATH] = {0};
+
+		if (!esif_ccb_file_exists(self->stream->file.name)) {
+			return DataVault_CompactJournal(self);
+		}
+		DataVault_GetFileName(self, ESIFDV_JOURNALFILEEXT, journal_name, sizeof(journal_name));
+		self->journal = esif_ccb_fopen(journal_name, "ab", NULL);
+		if (self->journal == NULL) {
+			return DataVault_CompactJournal(self);
+		}
+		esif_ccb_fseek(self->journal, 0, SEEK_END);
+		self->journal_len = (size_t)esif_ccb_ftell(self->journal);
+		self->journal_max = esif_ccb_max(ESIFDV_JOURNAL_MIN_SIZE, IOStream_GetFileSize(self->stream->file.name));
+	}
+
+	// Nothing to Journal for SETs without data since the cache is unchanged
+	if (!(flags & ESIF_SERVICE_CONFIG_DELETE)) {
+		if (value == NULL || value->buf_ptr == NULL) {
+			return ESIF_OK;
+		}
+		record.type = value->type;
+		record.value_len = value->data_len;
+		value_ptr = value->buf_ptr;
+	}
+
+	// Scramble Data?
+	if ((flags & ESIF_SERVICE_CONFIG_SCRAMBLE) && record.value_len > 0) {
+		scrambled = (UInt8 *)esif_ccb_malloc(record.value_len);
+		if (scrambled == NULL) {
+			rc = ESIF_E_NO_MEMORY;
+			goto exit;
+		}
+		for (byte = 0; byte < record.value_len; byte++)
+			scrambled[byte] = ~((UInt8 *)value_ptr)[byte];
+		value_ptr = scrambled;
+	}
+
+	esif_ccb_memcpy(&record.signature, ESIFDV_JOURNAL_SIGNATURE, sizeof(record.signature));
+	record.recordsize = sizeof(record);
+	record.flags = flags;
+	record.key_len = (UInt32)esif_ccb_strlen((esif_string)path->buf_ptr, MAX_DV_DATALEN) + 1;
+	record.checksum = DataVault_JournalChecksum(2166136261U, &record, sizeof(record));
+	record.checksum = DataVault_JournalChecksum(record.checksum, path->buf_ptr, record.key_len);
+	record.checksum = DataVault_JournalChecksum(record.checksum, value_ptr, record.value_len);
+
+	// Write Record: <header><key><value> and commit it to disk
+	journal_len = self->journal_len;
+	if ((esif_ccb_fwrite(&record, sizeof(record), 1, self->journal) != 1) ||
+		(esif_ccb_fwrite(path->buf_ptr, 1, record.key_len, self->journal) != record.key_len) ||
+		(record.value_len > 0 && esif_ccb_fwrite(value_ptr, 1, record.value_len, self->journal) != record.value_len) ||
+		(esif_ccb_fsync(self->journal) != 0)) {
+
+		// Fall back to writing the whole DataVault, which discards the partial record
+		rc = DataVault_CompactJournal(self);
+		goto exit;
+	}
+	self->journal_len += sizeof(record) + record.key_len + record.value_len;
+
+	if (self->journal_len >= self->journal_max) {
+		rc = DataVault_CompactJournal(self);
+	}
+	else if (journal_len == 0) {
+		esif_ccb_timer_set_msec(&self->compact_timer, ESIFDV_JOURNAL_COMPACT_MS);
+	}
+exit:
+	esif_ccb_free(scrambled);
+	return rc;
+}
+
+
+//
+// Replay the changes Journaled since the DataVault file was last written. Replaying is
+// idempotent, so it is safe after a crash at any point during a Compaction. A torn record
+// at the end of the Journal is discarded by Compacting the records before it.
+//
+static eEsifError DataVault_ReplayJournal(DataVaultPtr self)
+{
+	eEsifError rc = ESIF_OK;
+	char journal_name[MAX_PATH] = {0};
+	BytePtr journal = NULL;
+	size_t journal_len = 0;
+	size_t offset = 0;
+	Bool torn = ESIF_FALSE;
+
+	if (IOStream_GetType(self->stream) != StreamFile || self->stream->file.name == NULL ||
+		FLAGS_TEST(self->flags, ESIF_SERVICE_CONFIG_STATIC | ESIF_SERVICE_CONFIG_READONLY)) {
+		goto exit;
+	}
+
+	DataVault_GetFileName(self, ESIFDV_JOURNALFILEEXT, journal_name, sizeof(journal_name));
+	journal = (BytePtr)esif_ccb_mmap_file(journal_name, &journal_len);
+
+	while (journal != NULL && offset < journal_len) {
+		DataVaultJournalRecord record = {0};
+		UInt32 checksum = 0;
+		esif_flags_t flags = 0;
+		BytePtr key = NULL;
+		BytePtr data = NULL;
+		UInt8 *buffer = NULL;
+		EsifData path = { ESIF_DATA_STRING };
+		EsifData value = { ESIF_DATA_VOID };
+
+		// Validate the Record
+		if (journal_len - offset < sizeof(record)) {
+			torn = ESIF_TRUE;
+			break;
+		}
+		esif_ccb_memcpy(&record, journal + offset, sizeof(record));
+		if ((memcmp(record.signature, ESIFDV_JOURNAL_SIGNATURE, sizeof(record.signature)) != 0) ||
+			(record.recordsize < sizeof(record)) ||
+			(record.key_len == 0) ||
+			(record.key_len > MAX_DV_DATALEN) ||
+			(record.value_len > MAX_DV_DATALEN) ||
+			(journal_len - offset - sizeof(record) < (size_t)record.recordsize - sizeof(record) + record.key_len + record.value_len)) {
+			torn = ESIF_TRUE;
+			break;
+		}
+		key = journal + offset + record.recordsize;
+		data = key + record.key_len;
+
+		checksum = record.checksum;
+		record.checksum = 0;
+		record.checksum = DataVault_JournalChecksum(2166136261U, &record, sizeof(record));
+		record.checksum = DataVault_JournalChecksum(record.checksum, key, record.key_len);
+		record.checksum = DataVault_JournalChecksum(record.checksum, data, record.value_len);
+		if (record.checksum != checksum || key[record.key_len - 1] != 0) {
+			torn = ESIF_TRUE;
+			break;
+		}
+
+		// Apply the Record to the cache
+		flags = record.flags;
+		path.buf_ptr = key;
+		path.data_len = record.key_len;
+		if (!(flags & ESIF_SERVICE_CONFIG_DELETE)) {
+			value.type = (enum esif_data_type)record.type;
+			value.buf_ptr = data;
+			value.buf_len = value.data_len = record.value_len;
+
+			//  Unscramble Data?
+			if ((flags & ESIF_SERVICE_CONFIG_SCRAMBLE) && record.value_len > 0) {
+				UInt32 byte;
+				buffer = (UInt8 *)esif_ccb_malloc(record.value_len);
+				if (buffer == NULL) {
+					rc = ESIF_E_NO_MEMORY;
+					break;
+				}
+				for (byte = 0; byte < record.value_len; byte++)
+					buffer[byte] = ~data[byte];
+				value.buf_ptr = buffer;
+			}
+		}
+		DataVault_SetCacheValue(self, &path, ((flags & ESIF_SERVICE_CONFIG_DELETE) ? NULL : &value), &flags);
+		esif_ccb_free(buffer);
+
+		offset += record.recordsize + record.key_len + record.value_len;
+	}
+	esif_ccb_munmap_file(journal, journal_len);
+
+	if (rc == ESIF_OK && torn) {
+		rc = DataVault_CompactJournal(self);
+	}
+exit:
 	return rc;
 }
 
@@ -1219,23 +1637,17 @@ eEsifError EsifConfigFindNext(
 	ESIF_ASSERT(nameSpace && path && context);
 	DB = DataBank_GetNameSpace(g_DataBankMgr, (StringPtr)(nameSpace->buf_ptr));
 	if (DB) {
-		UInt32 item = 0;
+		int item = 0;
 
 		esif_ccb_read_lock(&DB->lock);
 
-		for (item = 0; item < DB->cache->size; item++) {
-			if (*context == NULL || esif_ccb_stricmp(DB->cache->elements[item].key.buf_ptr, *context) > 0) {
-				break;
-			}
-		}
-
-		// Find next matching key
-		while (item < DB->cache->size && EsifConfigKeyMatch(path, &DB->cache->elements[item].key) != ESIF_TRUE) {
-			item++;
-		}
+		// Find next matching key after the previous one. ESIF_DATA_AUTO and all other types match every key
+		item = DataCache_FindMatch(DB->cache,
+								   (path->type == ESIF_DATA_STRING ? (esif_string)path->buf_ptr : NULL),
+								   DataCache_FindNext(DB->cache, *context));
 
 		// Return matching item, if any
-		if (item < DB->cache->size) {
+		if (item != EOF) {
 			esif_ccb_free(*context);
 			*context = esif_ccb_strdup(DB->cache->elements[item].key.buf_ptr);
 			
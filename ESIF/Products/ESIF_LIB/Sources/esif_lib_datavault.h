@@ -22,6 +22,7 @@
 #include "esif_uf.h"
 #include "esif_lib_datacache.h"
 #include "esif_lib_iostream.h"
+#include "esif_ccb_timer.h"
 
 // Limits
 #define MAX_DV_DATALEN  0x7fffffff
@@ -30,7 +31,13 @@
 #define ESIFDV_FILEEXT              ".dv"				// DataVault File Extension
 #define ESIFDV_BAKFILEEXT           ".dvk"				// DataVault File Extension for Backup
 #define ESIFDV_LOGFILEEXT           ".lg"				// DataVault Log File Extension
+#define ESIFDV_JOURNALFILEEXT       ".dvj"				// DataVault Journal File Extension
+#define ESIFDV_TMPFILEEXT           ".dvt"				// DataVault File Extension while being Compacted
 #define ESIFDV_SIGNATURE            "\xE5\x1F"			// "ESIF" Signature = 0xE51F
+#define ESIFDV_JOURNAL_SIGNATURE    "\xE5\x1A"			// Journal Record Signature = 0xE51A
+
+#define ESIFDV_JOURNAL_MIN_SIZE     (64 * 1024)		// Journal Size that forces a Compaction, unless the DataVault is larger
+#define ESIFDV_JOURNAL_COMPACT_MS   30000				// Compact the Journal in the background this long after its first record
 
 #define ESIFDV_MAJOR_VERSION_MIN    1
 #define ESIFDV_MAJOR_VERSION        1
@@ -53,6 +60,13 @@ typedef struct DataVault_s {
 	char					description[ESIFDV_DATA_DESC_LEN];
 	IOStreamPtr				stream;
 	DataCachePtr			cache;
+	BytePtr					image;			// Read-only image of the vault that cache entries point into, if any
+	size_t					image_len;		// Size of the image
+	Bool					image_mapped;	// Image is a mapped file, otherwise an allocated copy
+	FILE					*journal;		// Journal of persisted changes not yet Compacted into the DataVault file, if open
+	size_t					journal_len;	// Current Journal Size
+	size_t					journal_max;	// Journal Size that forces a Compaction
+	esif_ccb_timer_t		compact_timer;	// Background Compaction Timer
 } DataVault, *DataVaultPtr;
 
 
@@ -64,6 +78,17 @@ typedef struct DataVaultHeader_s {
 	UInt32  flags;			// Global Flags
 } DataVaultHeader, *DataVaultHeaderPtr;
 
+// ESIFDV Journal Record v1.0.0, followed by <key><value>
+typedef struct DataVaultJournalRecord_s {
+	UInt8   signature[2];	// Record Signature
+	UInt16  recordsize;		// Record Header Size, including signature & recordsize
+	UInt32  flags;			// SET or DELETE Flags
+	UInt32  key_len;		// Key Length, including Null Terminator
+	UInt32  type;			// Value Type
+	UInt32  value_len;		// Value Length (Scrambled if SCRAMBLE flag set)
+	UInt32  checksum;		// Checksum of Record Header (with checksum = 0), Key and Value
+} DataVaultJournalRecord, *DataVaultJournalRecordPtr;
+
 #pragma pack(pop)
 
 #ifdef __cplusplus
@@ -76,6 +101,10 @@ void DataVault_Destroy(DataVaultPtr self);
 
 eEsifError DataVault_ReadVault(DataVaultPtr self);
 eEsifError DataVault_WriteVault(DataVaultPtr self);
+eEsifError DataVault_CompactJournal(DataVaultPtr self);
+
+eEsifError DataVault_GetValue(DataVaultPtr self, EsifDataPtr path, EsifDataPtr value, esif_flags_t *flagsPtr);
+eEsifError DataVault_SetValue(DataVaultPtr self, EsifDataPtr path, EsifDataPtr value, esif_flags_t flags);
 
 #ifdef __cplusplus
 }
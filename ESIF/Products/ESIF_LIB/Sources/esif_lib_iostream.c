@@ -55,7 +55,9 @@ static ESIF_INLINE void IOStream_dtor(IOStreamPtr self)
 			break;
 
 		case StreamMemory:
-			esif_ccb_free(self->memory.buffer);
+			if (self->memory.buf_len) {
+				esif_ccb_free(self->memory.buffer);
+			}
 			break;
 		}
 		WIPEPTR(self);
@@ -148,6 +150,29 @@ exit:
 }
 
 
+// Set IOStream to use a Memory Block owned by the caller (read-only, no copy)
+int IOStream_SetStaticMemory(
+	IOStreamPtr self,
+	BytePtr buffer,
+	size_t size
+	)
+{
+	if ((NULL == self) || (NULL == buffer)) {
+		return EINVAL;
+	}
+
+	// Clear everything when setting new contents
+	IOStream_dtor(self);
+
+	self->type = StreamMemory;
+	self->memory.buffer   = buffer;
+	self->memory.buf_len  = 0;	// Not owned, so never freed or grown
+	self->memory.data_len = size;
+	self->memory.offset   = 0;
+	return EOK;
+}
+
+
 // Set IOStream to use a File and open it
 int IOStream_OpenFile(
 	IOStreamPtr self,
@@ -424,7 +449,8 @@ size_t IOStream_Write(
 		break;
 
 	case StreamMemory:
-		if (NULL == self->memory.buffer) {
+		// Static Memory Blocks (buf_len == 0) are read-only
+		if ((NULL == self->memory.buffer) || (0 == self->memory.buf_len)) {
 			break;
 		}
 		//
@@ -79,6 +79,7 @@ void IOStream_Destroy(IOStreamPtr self);
 // Open/Close File or Memory Block
 int IOStream_SetFile(IOStreamPtr self, StringPtr filename, StringPtr mode);
 int IOStream_SetMemory(IOStreamPtr self, BytePtr buffer, size_t size);
+int IOStream_SetStaticMemory(IOStreamPtr self, BytePtr buffer, size_t size);	// Caller-owned, read-only buffer
 int IOStream_OpenFile(IOStreamPtr self, StringPtr filename, StringPtr mode);
 int IOStream_Open(IOStreamPtr self);	// fopen equivalent
 int IOStream_Close(IOStreamPtr self);	// fclose equivalent
@@ -0,0 +1,217 @@
+/******************************************************************************
+** Copyright (c) 2013-2016 Intel Corporation All Rights Reserved
+**
+** Licensed under the Apache License, Version 2.0 (the "License"); you may not
+** use this file except in compliance with the License.
+**
+** You may obtain a copy of the License at
+**     http://www.apache.org/licenses/LICENSE-2.0
+**
+** Unless required by applicable law or agreed to in writing, software
+** distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+** WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+**
+** See the License for the specific language governing permissions and
+** limitations under the License.
+**
+******************************************************************************/
+
+/*
+ * Checks that the compiled DSP dispatch table returns exactly what the hash
+ * table and linked list lookups return, for every DSP in a DSP DataVault.
+ * get_primitive, get_action and get_algorithm are each called with the
+ * dispatch table detached and attached and the results compared, including
+ * lookups that miss. The time per primitive execution lookup is printed for
+ * both paths.
+ *
+ * The DSP manager's lookups are static, so its source is included directly.
+ */
+
+#include "esif_uf_dspmgr.c"
+#include "esif_test.h"
+
+#define TEST_MAX_DSP_SIZE	(1024 * 1024)
+#define TEST_MAX_TUPLES		4096
+#define TEST_BENCH_LOOKUPS	2000000
+
+/* Provided by lin/main.c, which is not linked into the test */
+eEsifError esif_uf_os_init(void)
+{
+	return ESIF_OK;
+}
+
+void esif_uf_os_exit(void)
+{
+}
+
+/* Lookups made with the dispatch table detached, then attached */
+static EsifFpcPrimitivePtr both_get_primitive(EsifDspPtr dspPtr, EsifPrimitiveTuplePtr tuplePtr)
+{
+	EsifDspDispatchPtr dispatchPtr = dspPtr->dispatch_ptr;
+	EsifFpcPrimitivePtr expectedPtr = NULL;
+	EsifFpcPrimitivePtr actualPtr = NULL;
+
+	dspPtr->dispatch_ptr = NULL;
+	expectedPtr = dspPtr->get_primitive(dspPtr, tuplePtr);
+	dspPtr->dispatch_ptr = dispatchPtr;
+	actualPtr = dspPtr->get_primitive(dspPtr, tuplePtr);
+	CHECK(actualPtr == expectedPtr);
+	return actualPtr;
+}
+
+static void both_get_action(EsifDspPtr dspPtr, EsifFpcPrimitivePtr primitivePtr, UInt8 index)
+{
+	EsifDspDispatchPtr dispatchPtr = dspPtr->dispatch_ptr;
+	EsifFpcActionPtr expectedPtr = NULL;
+
+	dspPtr->dispatch_ptr = NULL;
+	expectedPtr = dspPtr->get_action(dspPtr, primitivePtr, index);
+	dspPtr->dispatch_ptr = dispatchPtr;
+	CHECK(dspPtr->get_action(dspPtr, primitivePtr, index) == expectedPtr);
+}
+
+static void both_get_algorithm(EsifDspPtr dspPtr, enum esif_action_type actionType)
+{
+	EsifDspDispatchPtr dispatchPtr = dspPtr->dispatch_ptr;
+	EsifFpcAlgorithmPtr expectedPtr = NULL;
+
+	dspPtr->dispatch_ptr = NULL;
+	expectedPtr = dspPtr->get_algorithm(dspPtr, actionType);
+	dspPtr->dispatch_ptr = dispatchPtr;
+	CHECK(dspPtr->get_algorithm(dspPtr, actionType) == expectedPtr);
+}
+
+/* ns per primitive execution: the primitive, each of its actions and their algorithms */
+static double time_lookups(EsifDspPtr dspPtr, EsifPrimitiveTuple *tuples, UInt32 tupleCount)
+{
+	volatile EsifFpcAlgorithmPtr sink = NULL;
+	EsifFpcPrimitivePtr primitivePtr = NULL;
+	EsifFpcActionPtr actionPtr = NULL;
+	UInt32 rounds = TEST_BENCH_LOOKUPS / tupleCount;
+	UInt32 round = 0;
+	UInt32 i = 0;
+	UInt8 j = 0;
+	double start = now_seconds();
+
+	for (round = 0; round < rounds; round++) {
+		for (i = 0; i < tupleCount; i++) {
+			primitivePtr = dspPtr->get_primitive(dspPtr, &tuples[i]);
+			for (j = 0; j < primitivePtr->num_actions; j++) {
+				actionPtr = dspPtr->get_action(dspPtr, primitivePtr, j);
+				sink = dspPtr->get_algorithm(dspPtr, actionPtr->type);
+			}
+		}
+	}
+	(void)sink;
+	return (now_seconds() - start) * 1e9 / ((double)rounds * tupleCount);
+}
+
+static void test_dsp(EsifFpcPtr fpcPtr)
+{
+	static EsifPrimitiveTuple tuples[TEST_MAX_TUPLES];
+	EsifDspPtr dspPtr = NULL;
+	EsifDspDispatchPtr dispatchPtr = NULL;
+	EsifFpcDomainPtr domainPtr = NULL;
+	EsifFpcPrimitivePtr primitivePtr = NULL;
+	EsifPrimitiveTuple missTuple = {0};
+	UInt32 tupleCount = 0;
+	UInt32 actionCount = 0;
+	UInt32 i = 0;
+	UInt32 j = 0;
+	UInt8 k = 0;
+	double hashNs = 0.0;
+	double dispatchNs = 0.0;
+
+	dspPtr = esif_dsp_create();
+	CHECK(dspPtr != NULL);
+	dspPtr->insert_primitive = insert_primitive;
+	dspPtr->insert_algorithm = insert_algorithm;
+	dspPtr->insert_domain = insert_domain;
+	dspPtr->insert_event = insert_event;
+	dspPtr->get_primitive = get_primitive;
+	dspPtr->get_action = get_action;
+	dspPtr->get_algorithm = get_algorithm;
+
+	CHECK(esif_fpc_load(fpcPtr, dspPtr) == ESIF_OK);
+	CHECK(dspPtr->dispatch_ptr != NULL);
+	dispatchPtr = dspPtr->dispatch_ptr;
+
+	domainPtr = (EsifFpcDomainPtr)(fpcPtr + 1);
+	for (i = 0; i < fpcPtr->number_of_domains; i++) {
+		primitivePtr = (EsifFpcPrimitivePtr)(domainPtr + 1);
+		for (j = 0; j < domainPtr->number_of_primitives; j++) {
+			CHECK(both_get_primitive(dspPtr, &primitivePtr->tuple) != NULL);
+			for (k = 0; k < primitivePtr->num_actions; k++, actionCount++)
+				both_get_action(dspPtr, primitivePtr, k);
+
+			/* Misses on a known id and on an id past the end of the table */
+			missTuple = primitivePtr->tuple;
+			missTuple.instance ^= 0x7777;
+			both_get_primitive(dspPtr, &missTuple);
+			missTuple = primitivePtr->tuple;
+			missTuple.id = 0xFFF0;
+			CHECK(both_get_primitive(dspPtr, &missTuple) == NULL);
+
+			if (tupleCount < TEST_MAX_TUPLES)
+				tuples[tupleCount++] = primitivePtr->tuple;
+			primitivePtr = (EsifFpcPrimitivePtr)((UInt8 *)primitivePtr + primitivePtr->size);
+		}
+		domainPtr = (EsifFpcDomainPtr)((UInt8 *)domainPtr + domainPtr->size);
+	}
+
+	/* Includes action types with no algorithm and values past the enum */
+	for (i = 0; i <= MAX_ESIF_ACTION_ENUM_VALUE + 2; i++)
+		both_get_algorithm(dspPtr, (enum esif_action_type)i);
+
+	if (tupleCount > 0) {
+		dspPtr->dispatch_ptr = NULL;
+		hashNs = time_lookups(dspPtr, tuples, tupleCount);
+		dspPtr->dispatch_ptr = dispatchPtr;
+		dispatchNs = time_lookups(dspPtr, tuples, tupleCount);
+	}
+
+	printf("%-20s primitives %4u actions %4u  hash+list %6.1f ns  dispatch %6.1f ns\n",
+	       fpcPtr->header.name, tupleCount, actionCount, hashNs, dispatchNs);
+	esif_dsp_destroy(dspPtr);
+}
+
+int main(int argc, char *argv[])
+{
+	static unsigned char data[TEST_MAX_DSP_SIZE];
+	struct edp_dir *edpPtr = NULL;
+	FILE *filePtr = NULL;
+	size_t size = 0;
+	size_t offset = 0;
+	UInt32 dspCount = 0;
+
+	if (argc < 2) {
+		printf("Usage: %s <dsp.dv>\n", argv[0]);
+		return 1;
+	}
+
+	filePtr = fopen(argv[1], "rb");
+	CHECK(filePtr != NULL);
+	size = fread(data, 1, sizeof(data), filePtr);
+	fclose(filePtr);
+
+	esif_ccb_lock_init(&g_mempool_lock);
+	CHECK(esif_ht_init() == ESIF_OK);
+	CHECK(esif_link_list_init() == ESIF_OK);
+
+	/* Each DSP in the DataVault is stored as an EDP image */
+	for (offset = 0; offset + sizeof(*edpPtr) < size; offset++) {
+		if (memcmp(data + offset, "@EDP", 4) != 0)
+			continue;
+		edpPtr = (struct edp_dir *)(data + offset);
+		CHECK(offset + edpPtr->fpc_offset + sizeof(EsifFpc) <= size);
+		test_dsp((EsifFpcPtr)(data + offset + edpPtr->fpc_offset));
+		dspCount++;
+	}
+	CHECK(dspCount > 0);
+	printf("esif_dsp_dispatch: all checks passed for %u DSPs\n", dspCount);
+
+	esif_link_list_exit();
+	esif_ht_exit();
+	esif_ccb_lock_uninit(&g_mempool_lock);
+	return 0;
+}
@@ -0,0 +1,330 @@
+/******************************************************************************
+** Copyright (c) 2013-2016 Intel Corporation All Rights Reserved
+**
+** Licensed under the Apache License, Version 2.0 (the "License"); you may not
+** use this file except in compliance with the License.
+**
+** You may obtain a copy of the License at
+**     http://www.apache.org/licenses/LICENSE-2.0
+**
+** Unless required by applicable law or agreed to in writing, software
+** distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+** WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+**
+** See the License for the specific language governing permissions and
+** limitations under the License.
+**
+******************************************************************************/
+
+/*
+ * Standalone unit and throughput test for the open addressing hash table in
+ * esif_hash_table.c.
+ */
+
+#include "esif_hash_table.h"
+#include "esif_uf_trace.h"
+#include "esif_test.h"
+
+/* The hash table only needs the mempools and trace globals from esif_uf */
+struct esif_ccb_mempool *g_mempool[ESIF_MEMPOOL_TYPE_MAX] = {0};
+esif_ccb_lock_t g_mempool_lock;
+int g_traceLevel = -1;
+struct esif_tracelevel_s g_traceinfo[ESIF_TRACELEVEL_DEBUG + 1] = {{0}};
+
+int EsifUfTraceMessage(
+	esif_tracemask_t module,
+	int level,
+	const char *func,
+	const char *file,
+	int line,
+	const char *msg,
+	...)
+{
+	return 0;
+}
+
+#ifdef ESIF_ATTR_MEMTRACE
+void *esif_memtrace_alloc(
+	void *old_ptr,
+	size_t size,
+	const char *func,
+	const char *file,
+	int line)
+{
+	void *mem_ptr = realloc(old_ptr, size);
+
+	if ((old_ptr == NULL) && (mem_ptr != NULL))
+		memset(mem_ptr, 0, size);
+	return mem_ptr;
+}
+
+void esif_memtrace_free(void *mem_ptr)
+{
+	free(mem_ptr);
+}
+#endif
+
+#define TEST_KEY_SIZE		32
+#define TEST_LONG_KEY_SIZE	(ESIF_HT_INLINE_KEY_SIZE + 8)
+#define TEST_RANDOM_KEYS	2000
+#define TEST_RANDOM_OPS		200000
+#define TEST_BENCH_MAX_KEYS	100000
+#define TEST_BENCH_LOOKUPS	20000000
+
+static int g_destroyed = 0;
+
+static void count_destroy(void *item_ptr)
+{
+	UNREFERENCED_PARAMETER(item_ptr);
+	g_destroyed++;
+}
+
+static u8 *make_key(char *key, const char *prefix, long index)
+{
+	esif_ccb_memset(key, 0, TEST_KEY_SIZE);
+	esif_ccb_sprintf(TEST_KEY_SIZE, key, "%s%ld", prefix, index);
+	return (u8 *)key;
+}
+
+/*
+ * Every item must be reachable from its home slot without crossing a free
+ * slot, and the number of used slots must match the count. This fails if a
+ * removal leaves a hole inside a probe run instead of shifting the run back.
+ */
+static void check_table(struct esif_ht *ht)
+{
+	u32 mask = ht->size - 1;
+	u32 used = 0;
+	u32 index = 0;
+	u32 probe = 0;
+
+	CHECK((ht->size & mask) == 0);
+	CHECK((u64)ht->count * 100 <= (u64)ht->size * ESIF_HT_MAX_LOAD_PERCENT);
+
+	for (index = 0; index < ht->size; index++) {
+		if (!ht->table[index].in_use)
+			continue;
+		used++;
+		for (probe = ht->table[index].hash & mask; probe != index;
+		     probe = (probe + 1) & mask)
+			CHECK(ht->table[probe].in_use);
+	}
+	CHECK(used == ht->count);
+}
+
+static void test_insert_find_delete(void)
+{
+	struct esif_ht *ht = esif_ht_create(4);
+	char key[TEST_KEY_SIZE];
+	long i = 0;
+
+	CHECK(ht != NULL);
+	for (i = 0; i < 5; i++)
+		CHECK(esif_ht_add_item(ht, make_key(key, "key", i), TEST_KEY_SIZE / 4, (void *)(i + 1)) == ESIF_OK);
+	CHECK(ht->count == 5);
+
+	for (i = 0; i < 5; i++)
+		CHECK(esif_ht_get_item(ht, make_key(key, "key", i), TEST_KEY_SIZE / 4) == (void *)(i + 1));
+	CHECK(esif_ht_get_item(ht, make_key(key, "key", 5), TEST_KEY_SIZE / 4) == NULL);
+
+	CHECK(esif_ht_remove_item(ht, make_key(key, "key", 2), TEST_KEY_SIZE / 4) == ESIF_OK);
+	CHECK(esif_ht_get_item(ht, make_key(key, "key", 2), TEST_KEY_SIZE / 4) == NULL);
+	CHECK(esif_ht_remove_item(ht, make_key(key, "key", 2), TEST_KEY_SIZE / 4) == ESIF_E_NOT_FOUND);
+	CHECK(ht->count == 4);
+	check_table(ht);
+
+	/* Keys longer than the inline buffer are copied to the heap */
+	CHECK(esif_ht_add_item(ht, make_key(key, "long", 0), TEST_LONG_KEY_SIZE, (void *)100) == ESIF_OK);
+	CHECK(esif_ht_get_item(ht, make_key(key, "long", 0), TEST_LONG_KEY_SIZE) == (void *)100);
+	CHECK(esif_ht_get_item(ht, make_key(key, "long", 0), TEST_LONG_KEY_SIZE - 1) == NULL);
+
+	CHECK(esif_ht_add_item(NULL, (u8 *)key, 1, NULL) == ESIF_E_PARAMETER_IS_NULL);
+	CHECK(esif_ht_add_item(ht, NULL, 1, NULL) == ESIF_E_PARAMETER_IS_NULL);
+	CHECK(esif_ht_remove_item(ht, NULL, 1) == ESIF_E_PARAMETER_IS_NULL);
+	CHECK(esif_ht_get_item(ht, NULL, 1) == NULL);
+
+	g_destroyed = 0;
+	esif_ht_destroy(ht, count_destroy);
+	CHECK(g_destroyed == 5);
+}
+
+static void test_backward_shift_delete(void)
+{
+	struct esif_ht *ht = esif_ht_create(0);
+	char key[TEST_KEY_SIZE];
+	long keys[ESIF_HT_MIN_SLOTS] = {0};
+	u32 home = 0;
+	u32 found = 0;
+	long i = 0;
+	long j = 0;
+
+	CHECK(ht != NULL);
+	CHECK(ht->size == ESIF_HT_MIN_SLOTS);
+
+	/* Find keys that share the last home slot so their run wraps around */
+	home = ht->size - 1;
+	for (i = 0; found < 4; i++) {
+		CHECK(esif_ht_add_item(ht, make_key(key, "c", i), TEST_KEY_SIZE, NULL) == ESIF_OK);
+		if (ht->table[home].in_use && (ht->table[home].item_ptr == NULL) &&
+		    (ht->count == 1))
+			keys[found++] = i;
+		CHECK(esif_ht_remove_item(ht, make_key(key, "c", i), TEST_KEY_SIZE) == ESIF_OK);
+	}
+	CHECK(ht->count == 0);
+
+	/* Remove each member of the run in turn; the others must stay reachable */
+	for (j = 0; j < (long)found; j++) {
+		for (i = 0; i < (long)found; i++)
+			CHECK(esif_ht_add_item(ht, make_key(key, "c", keys[i]), TEST_KEY_SIZE, (void *)(i + 1)) == ESIF_OK);
+		check_table(ht);
+
+		CHECK(esif_ht_remove_item(ht, make_key(key, "c", keys[j]), TEST_KEY_SIZE) == ESIF_OK);
+		check_table(ht);
+		for (i = 0; i < (long)found; i++)
+			CHECK(esif_ht_get_item(ht, make_key(key, "c", keys[i]), TEST_KEY_SIZE) ==
+			      ((i == j) ? NULL : (void *)(i + 1)));
+
+		for (i = 0; i < (long)found; i++)
+			if (i != j)
+				CHECK(esif_ht_remove_item(ht, make_key(key, "c", keys[i]), TEST_KEY_SIZE) == ESIF_OK);
+		CHECK(ht->count == 0);
+		check_table(ht);
+	}
+
+	esif_ht_destroy(ht, NULL);
+}
+
+static void test_duplicates_and_resize(void)
+{
+	struct esif_ht *ht = esif_ht_create(2);
+	char key[TEST_KEY_SIZE];
+	u32 key_length = 0;
+	u32 last_size = 0;
+	long pass = 0;
+	long i = 0;
+	long j = 0;
+
+	CHECK(ht != NULL);
+	for (pass = 0; pass < 2; pass++) {
+		key_length = pass ? TEST_LONG_KEY_SIZE : 8;
+
+		/* Five items per key, so the table grows several times with duplicates in place */
+		last_size = ht->size;
+		for (i = 0; i < 5000; i++) {
+			CHECK(esif_ht_add_item(ht, make_key(key, "d", i % 1000), key_length, (void *)(i + 1)) == ESIF_OK);
+			if (ht->size != last_size) {
+				CHECK(ht->size > last_size);
+				check_table(ht);
+				last_size = ht->size;
+			}
+		}
+		CHECK(ht->count == 5000);
+		CHECK(ht->size >= 5000 * 100 / ESIF_HT_MAX_LOAD_PERCENT);
+		check_table(ht);
+
+		/* Duplicates are found and removed in the order they were added */
+		for (i = 0; i < 1000; i++) {
+			for (j = 0; j < 5; j++) {
+				CHECK(esif_ht_get_item(ht, make_key(key, "d", i), key_length) == (void *)(i + 1 + j * 1000));
+				CHECK(esif_ht_remove_item(ht, make_key(key, "d", i), key_length) == ESIF_OK);
+			}
+			CHECK(esif_ht_get_item(ht, make_key(key, "d", i), key_length) == NULL);
+		}
+		CHECK(ht->count == 0);
+		check_table(ht);
+	}
+	esif_ht_destroy(ht, NULL);
+}
+
+static void test_random_against_reference(void)
+{
+	static long reference[TEST_RANDOM_KEYS];
+	struct esif_ht *ht = esif_ht_create(16);
+	char key[TEST_KEY_SIZE];
+	long i = 0;
+	long k = 0;
+	u32 count = 0;
+
+	CHECK(ht != NULL);
+	esif_ccb_memset(reference, 0, sizeof(reference));
+	srand(1);
+
+	for (i = 0; i < TEST_RANDOM_OPS; i++) {
+		k = rand() % TEST_RANDOM_KEYS;
+		make_key(key, "r", k);
+		if (reference[k]) {
+			CHECK(esif_ht_get_item(ht, (u8 *)key, TEST_KEY_SIZE) == (void *)reference[k]);
+			CHECK(esif_ht_remove_item(ht, (u8 *)key, TEST_KEY_SIZE) == ESIF_OK);
+			reference[k] = 0;
+		} else {
+			CHECK(esif_ht_get_item(ht, (u8 *)key, TEST_KEY_SIZE) == NULL);
+			reference[k] = i + 1;
+			CHECK(esif_ht_add_item(ht, (u8 *)key, TEST_KEY_SIZE, (void *)reference[k]) == ESIF_OK);
+		}
+		if ((i % 10000) == 0)
+			check_table(ht);
+	}
+	check_table(ht);
+
+	for (k = 0; k < TEST_RANDOM_KEYS; k++)
+		if (reference[k])
+			count++;
+	CHECK(ht->count == count);
+
+	g_destroyed = 0;
+	esif_ht_destroy(ht, count_destroy);
+	CHECK(g_destroyed == (int)count);
+}
+
+static void bench_lookups(void)
+{
+	static char keys[TEST_BENCH_MAX_KEYS][16];
+	struct esif_ht *ht = NULL;
+	volatile void *sink = NULL;
+	double start = 0.0;
+	double elapsed = 0.0;
+	long key_count = 0;
+	long rounds = 0;
+	long round = 0;
+	long i = 0;
+
+	for (i = 0; i < TEST_BENCH_MAX_KEYS; i++)
+		esif_ccb_sprintf(sizeof(keys[i]), keys[i], "%ld.%ld.%ld", i, i % 7, i % 13);
+
+	for (key_count = 1000; key_count <= TEST_BENCH_MAX_KEYS; key_count *= 10) {
+		ht = esif_ht_create(32);
+		CHECK(ht != NULL);
+		for (i = 0; i < key_count; i++)
+			CHECK(esif_ht_add_item(ht, (u8 *)keys[i], 12, (void *)(i + 1)) == ESIF_OK);
+
+		rounds = TEST_BENCH_LOOKUPS / key_count;
+		start = now_seconds();
+		for (round = 0; round < rounds; round++)
+			for (i = 0; i < key_count; i++)
+				sink = esif_ht_get_item(ht, (u8 *)keys[i], 12);
+		elapsed = now_seconds() - start;
+		CHECK(sink != NULL);
+
+		printf("%6ld keys: %12.0f lookups/sec\n", key_count,
+		       (elapsed > 0.0) ? (rounds * key_count) / elapsed : 0.0);
+		esif_ht_destroy(ht, NULL);
+	}
+}
+
+int main(void)
+{
+	esif_ccb_lock_init(&g_mempool_lock);
+	CHECK(esif_ht_init() == ESIF_OK);
+
+	test_insert_find_delete();
+	test_backward_shift_delete();
+	test_duplicates_and_resize();
+	test_random_against_reference();
+	printf("esif_hash_table: all checks passed\n");
+
+	bench_lookups();
+
+	esif_ht_exit();
+	esif_ccb_lock_uninit(&g_mempool_lock);
+	return 0;
+}
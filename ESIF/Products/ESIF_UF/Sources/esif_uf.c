@@ -86,6 +86,7 @@ typedef struct EsifLogFile_s {
 	esif_string		name;		// Log Name
 	esif_string		filename;	// Log file name
 	FILE			*handle;	// Log file handle or NULL if not open
+	Bool			batching;	// Defer flushing writes until the current batch ends
 } EsifLogFile;
 
 static EsifLogFile g_EsifLogFile[MAX_ESIFLOG] = {0};
@@ -249,7 +250,8 @@ int EsifLogFile_WriteArgsAppend(EsifLogType type, const char *append, const char
 				rc += appendlen;
 			}
 			rc = (int)esif_ccb_fwrite(buffer, sizeof(char), rc, g_EsifLogFile[type].handle);
-			fflush(g_EsifLogFile[type].handle);
+			if (!g_EsifLogFile[type].batching)
+				fflush(g_EsifLogFile[type].handle);
 			esif_ccb_free(buffer);
 		}
 	}
@@ -257,6 +259,23 @@ int EsifLogFile_WriteArgsAppend(EsifLogType type, const char *append, const char
 	return rc;
 }
 
+// Begin a batch of writes that are flushed together when the batch ends
+void EsifLogFile_BeginBatch(EsifLogType type)
+{
+	esif_ccb_write_lock(&g_EsifLogFile[type].lock);
+	g_EsifLogFile[type].batching = ESIF_TRUE;
+	esif_ccb_write_unlock(&g_EsifLogFile[type].lock);
+}
+
+void EsifLogFile_EndBatch(EsifLogType type)
+{
+	esif_ccb_write_lock(&g_EsifLogFile[type].lock);
+	g_EsifLogFile[type].batching = ESIF_FALSE;
+	if (g_EsifLogFile[type].handle != NULL)
+		fflush(g_EsifLogFile[type].handle);
+	esif_ccb_write_unlock(&g_EsifLogFile[type].lock);
+}
+
 esif_string EsifLogFile_GetFullPath(esif_string buffer, size_t buf_len, const char *filename)
 {
 	char *sep = NULL;
@@ -749,6 +768,16 @@ void EsifWebSetIpaddrPort(const char *ipaddr, u32 port, Bool restricted)
 	esif_ws_server_set_ipaddr_port(ipaddr, port, restricted);
 }
 
+void EsifWebSetMaxClients(u32 maxClients)
+{
+	esif_ws_server_set_max_clients(maxClients);
+}
+
+UInt64 EsifWebGetDroppedFrames()
+{
+	return esif_ws_server_get_dropped_frames();
+}
+
 #else
 
 eEsifError EsifWebStart()
@@ -768,6 +797,14 @@ void EsifWebSetIpaddrPort(const char *ipaddr, u32 port, Bool restricted)
 	UNREFERENCED_PARAMETER(port);
 	UNREFERENCED_PARAMETER(restricted);
 }
+void EsifWebSetMaxClients(u32 maxClients)
+{
+	UNREFERENCED_PARAMETER(maxClients);
+}
+UInt64 EsifWebGetDroppedFrames()
+{
+	return 0;
+}
 #endif
 
 
@@ -775,6 +812,7 @@ EsifInitTableEntry g_esifUfInitTable[] = {
 	{esif_uf_shell_init,				esif_uf_shell_exit,					ESIF_INIT_FLAG_NONE},
 	{esif_ccb_mempool_init_tracking,	esif_ccb_mempool_uninit_tracking,	ESIF_INIT_FLAG_NONE},
 	{EsifLogsInit,						EsifLogsExit,						ESIF_INIT_FLAG_NONE},
+	{EsifTraceRing_Init,				EsifTraceRing_Exit,					ESIF_INIT_FLAG_NONE},
 	{esif_link_list_init,				esif_link_list_exit,				ESIF_INIT_FLAG_NONE},
 	{esif_ht_init,						esif_ht_exit,						ESIF_INIT_FLAG_NONE},
 	{esif_ccb_tmrm_init,				esif_ccb_tmrm_exit,					ESIF_INIT_FLAG_NONE},
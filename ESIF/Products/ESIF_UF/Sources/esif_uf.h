@@ -76,6 +76,8 @@ extern int EsifLogFile_IsOpen(EsifLogType type);
 extern int EsifLogFile_Write(EsifLogType type, const char *fmt, ...);
 extern int EsifLogFile_WriteArgs(EsifLogType type, const char *fmt, va_list args);
 extern int EsifLogFile_WriteArgsAppend(EsifLogType type, const char *append, const char *fmt, va_list args);
+extern void EsifLogFile_BeginBatch(EsifLogType type);
+extern void EsifLogFile_EndBatch(EsifLogType type);
 extern esif_string EsifLogFile_GetFullPath(esif_string buffer, size_t buf_len, const char *filename);
 extern void EsifLogFile_DisplayList(void);
 extern esif_string EsifLogFile_GetFileNameFromType(EsifLogType logType);
@@ -248,6 +250,8 @@ extern eEsifError EsifWebStart();
 extern void EsifWebStop(void);
 extern int EsifWebIsStarted();
 extern void EsifWebSetIpaddrPort(const char *ipaddr, u32 port, Bool restricted);
+extern void EsifWebSetMaxClients(u32 maxClients);
+extern UInt64 EsifWebGetDroppedFrames();
 
 #ifdef __cplusplus
 }
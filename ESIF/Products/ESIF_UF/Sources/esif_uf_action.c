@@ -870,7 +870,7 @@ static eEsifError ESIF_CALLCONV EsifActWriteLogHandler(
 
 	msgLen = esif_ccb_strlen(message->buf_ptr, message->buf_len);
 	if (msgLen > 0) {
-		ESIF_TRACE_IFACTIVE(ESIF_TRACE_ID, logType,  message->buf_ptr);
+		ESIF_TRACE_IFACTIVE(ESIF_TRACE_ID, logType, "%s", (char *)message->buf_ptr);
 	}
 
 exit:
@@ -53,7 +53,6 @@ static eEsifError ESIF_CALLCONV ActionConfigGet(
 {
 	eEsifError rc = ESIF_OK;
 	EsifData params[2] = {0};
-	EsifString replacedStrs[2] = {0};
 	EsifString replacedStr = NULL;
 	UInt8 i;
 
@@ -70,11 +69,11 @@ static eEsifError ESIF_CALLCONV ActionConfigGet(
 		goto exit;
 	}
 
-	for (i = 0; i < sizeof(replacedStrs) / sizeof(*replacedStrs); i++) {
-		replacedStr = EsifUp_CreateTokenReplacedParamString(upPtr, primitivePtr, params[i].buf_ptr);
+	/* DataVault And Key Name */
+	for (i = 0; i < 2; i++) {
+		replacedStr = EsifUp_GetTokenReplacedParamString(upPtr, primitivePtr, params[i].buf_ptr);
 		if (replacedStr != NULL) {
 			params[i].buf_ptr = replacedStr;
-			replacedStrs[i] = replacedStr;
 		}
 	}
 
@@ -83,9 +82,6 @@ static eEsifError ESIF_CALLCONV ActionConfigGet(
 
 	rc = EsifConfigGet(&params[0], &params[1], responsePtr);
 exit:
-	for (i = 0; i < sizeof(replacedStrs) / sizeof(*replacedStrs); i++) {
-		esif_ccb_free(replacedStrs[i]);
-	}
 	return rc;
 }
 
@@ -101,7 +97,6 @@ static eEsifError ESIF_CALLCONV ActionConfigSet(
 	eEsifError rc = ESIF_OK;
 	esif_flags_t flags = ESIF_SERVICE_CONFIG_PERSIST;
 	EsifData params[3] = {0};
-	EsifString replacedStrs[2] = {0};
 	EsifString replacedStr = NULL;
 	UInt8 i;
 	UInt8 nparams = 2;
@@ -128,11 +123,11 @@ static eEsifError ESIF_CALLCONV ActionConfigSet(
 		flags = *(UInt32 *)(params[2].buf_ptr);
 	}
 
-	for (i = 0; i < sizeof(replacedStrs) / sizeof(*replacedStrs); i++) {
-		replacedStr = EsifUp_CreateTokenReplacedParamString(upPtr, primitivePtr, params[i].buf_ptr);
+	/* DataVault And Key Name */
+	for (i = 0; i < 2; i++) {
+		replacedStr = EsifUp_GetTokenReplacedParamString(upPtr, primitivePtr, params[i].buf_ptr);
 		if (replacedStr != NULL) {
 			params[i].buf_ptr = replacedStr;
-			replacedStrs[i] = replacedStr;
 		}
 	}
 
@@ -159,9 +154,6 @@ static eEsifError ESIF_CALLCONV ActionConfigSet(
 		ActionConfigSignalChangeEvents(upPtr, primitivePtr->tuple, requestPtr);
 	}
 exit:
-	for (i = 0; i < sizeof(replacedStrs) / sizeof(*replacedStrs); i++) {
-		esif_ccb_free(replacedStrs[i]);
-	}
 	return rc;
 }
 
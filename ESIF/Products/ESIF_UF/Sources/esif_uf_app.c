@@ -186,6 +186,9 @@ static eEsifError AppCreate(
 	//For Version 2
 	app_service_iface.fSendEventFuncPtr       = EsifSvcEventReceive;
 
+	//For Version 3
+	app_service_iface.fPrimitiveBatchFuncPtr  = EsifSvcPrimitiveBatchExec;
+
 	/* GetApplicationInterface Handleshake send ESIF receive APP Interface */
 	rc = ifaceFuncPtr(&appPtr->fInterface);
 	if (ESIF_OK != rc) {
@@ -922,7 +925,6 @@ static AppParticipantDataMapPtr EsifApp_GetParticipantDataMapFromInstance(
 	const u8 participantId
 	)
 {
-	UInt8 i = 0;
 	AppParticipantDataMapPtr upDataMapPtr = NULL;
 
 	/* First Find Upper Framework Pointer */
@@ -935,20 +937,14 @@ static AppParticipantDataMapPtr EsifApp_GetParticipantDataMapFromInstance(
 	ESIF_TRACE_DEBUG("Have Event For Participant %s\n", EsifUp_GetName(upPtr));
 
 	/*
-	 * Okay now we have to find the correct particpant handle based on the appPtr.  Note each
-	 * app will have a different particpant handle.
+	 * Each app has a different participant handle, but its participant data
+	 * map is indexed by participant instance (see EsifAppCreateParticipant).
 	 */
-	for (i = 0; i < MAX_PARTICIPANT_ENTRY; i++) {
-		if (NULL == appPtr->fParticipantData[i].fUpPtr) {
-			continue;
-		}
+	if ((participantId < MAX_PARTICIPANT_ENTRY) &&
+		(appPtr->fParticipantData[participantId].fUpPtr == upPtr)) {
+		upDataMapPtr = &appPtr->fParticipantData[participantId];
 
-		if (appPtr->fParticipantData[i].fUpPtr == upPtr) {
-			upDataMapPtr = &appPtr->fParticipantData[i];
-
-			ESIF_TRACE_DEBUG("Found participant data map for %s\n", EsifUp_GetName(upPtr));
-			break;
-		}
+		ESIF_TRACE_DEBUG("Found participant data map for %s\n", EsifUp_GetName(upPtr));
 	}
 
 exit:
@@ -51,6 +51,139 @@ static int ESIF_INLINE esif_ccb_socket_error(void)
 	return WSAGetLastError();
 }
 
+static int ESIF_INLINE esif_ccb_socket_set_nonblocking(esif_ccb_socket_t s)
+{
+	u_long mode = 1;
+	return ioctlsocket(s, FIONBIO, &mode);
+}
+
+static int ESIF_INLINE esif_ccb_socket_would_block(void)
+{
+	return (WSAGetLastError() == WSAEWOULDBLOCK);
+}
+
+/*
+ * Socket Poller. Windows has no epoll, so emulate it with WSAPoll over a fixed
+ * array of sockets. Wakeups are flagged and noticed within the wait slice.
+ */
+#define ESIF_CCB_POLLIN			POLLRDNORM
+#define ESIF_CCB_POLLOUT		POLLWRNORM
+#define ESIF_CCB_POLLERR		(POLLERR | POLLHUP | POLLNVAL)
+#define ESIF_CCB_POLL_WAKE_MSEC	50
+
+typedef struct esif_ccb_poll_event_s {
+	u32  events;
+	void *context;
+} esif_ccb_poll_event_t;
+
+typedef struct esif_ccb_poll_s {
+	WSAPOLLFD *fds;
+	void **contexts;
+	int count;
+	int capacity;
+	volatile LONG wake;
+} *esif_ccb_poll_t;
+
+#define ESIF_CCB_POLL_INVALID	NULL
+#define esif_ccb_poll_event_flags(e)	((e)->events)
+#define esif_ccb_poll_event_context(e)	((e)->context)
+
+static esif_ccb_poll_t ESIF_INLINE esif_ccb_poll_create(int maxSockets)
+{
+	esif_ccb_poll_t self = (esif_ccb_poll_t)esif_ccb_malloc(sizeof(*self));
+	if (self) {
+		self->fds = (WSAPOLLFD *)esif_ccb_malloc(maxSockets * sizeof(WSAPOLLFD));
+		self->contexts = (void **)esif_ccb_malloc(maxSockets * sizeof(void *));
+		self->capacity = maxSockets;
+		if (self->fds == NULL || self->contexts == NULL) {
+			esif_ccb_free(self->fds);
+			esif_ccb_free(self->contexts);
+			esif_ccb_free(self);
+			self = NULL;
+		}
+	}
+	return self;
+}
+
+static void ESIF_INLINE esif_ccb_poll_destroy(esif_ccb_poll_t self)
+{
+	if (self) {
+		esif_ccb_free(self->fds);
+		esif_ccb_free(self->contexts);
+		esif_ccb_free(self);
+	}
+}
+
+static int ESIF_INLINE esif_ccb_poll_add(esif_ccb_poll_t self, esif_ccb_socket_t s, u32 events, void *context)
+{
+	if (self->count >= self->capacity) {
+		return SOCKET_ERROR;
+	}
+	self->fds[self->count].fd = s;
+	self->fds[self->count].events = (SHORT)events;
+	self->fds[self->count].revents = 0;
+	self->contexts[self->count] = context;
+	self->count++;
+	return 0;
+}
+
+static int ESIF_INLINE esif_ccb_poll_modify(esif_ccb_poll_t self, esif_ccb_socket_t s, u32 events, void *context)
+{
+	int j;
+	for (j = 0; j < self->count; j++) {
+		if (self->fds[j].fd == s) {
+			self->fds[j].events = (SHORT)events;
+			self->contexts[j] = context;
+			return 0;
+		}
+	}
+	return SOCKET_ERROR;
+}
+
+static int ESIF_INLINE esif_ccb_poll_remove(esif_ccb_poll_t self, esif_ccb_socket_t s)
+{
+	int j;
+	for (j = 0; j < self->count; j++) {
+		if (self->fds[j].fd == s) {
+			self->count--;
+			self->fds[j] = self->fds[self->count];
+			self->contexts[j] = self->contexts[self->count];
+			return 0;
+		}
+	}
+	return SOCKET_ERROR;
+}
+
+static void ESIF_INLINE esif_ccb_poll_wake(esif_ccb_poll_t self)
+{
+	InterlockedExchange(&self->wake, 1);
+}
+
+/* Returns number of events, 0 on timeout or wakeup, or SOCKET_ERROR */
+static int ESIF_INLINE esif_ccb_poll_wait(esif_ccb_poll_t self, esif_ccb_poll_event_t *events, int maxEvents, int timeoutMsec)
+{
+	int elapsed = 0;
+	int found = 0;
+	int j;
+
+	do {
+		int slice = (timeoutMsec - elapsed < ESIF_CCB_POLL_WAKE_MSEC ? timeoutMsec - elapsed : ESIF_CCB_POLL_WAKE_MSEC);
+		int rc = WSAPoll(self->fds, (ULONG)self->count, slice);
+		if (rc == SOCKET_ERROR) {
+			return SOCKET_ERROR;
+		}
+		for (j = 0; rc > 0 && j < self->count && found < maxEvents; j++) {
+			if (self->fds[j].revents) {
+				events[found].events = (u32)self->fds[j].revents;
+				events[found].context = self->contexts[j];
+				found++;
+			}
+		}
+		elapsed += slice;
+	} while (found == 0 && InterlockedExchange(&self->wake, 0) == 0 && elapsed < timeoutMsec);
+	return found;
+}
+
 #endif
 
 #ifdef ESIF_ATTR_OS_LINUX
@@ -59,6 +192,10 @@ static int ESIF_INLINE esif_ccb_socket_error(void)
 #include <netinet/in.h>
 #include <arpa/inet.h>
 #include <netdb.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/epoll.h>
+#include <sys/eventfd.h>
 
 typedef int esif_ccb_socket_t;
 
@@ -76,6 +213,117 @@ static int ESIF_INLINE esif_ccb_socket_error(void)
 	return errno;
 }
 
+static int ESIF_INLINE esif_ccb_socket_set_nonblocking(esif_ccb_socket_t s)
+{
+	int flags = fcntl(s, F_GETFL, 0);
+	return (flags < 0 ? flags : fcntl(s, F_SETFL, flags | O_NONBLOCK));
+}
+
+static int ESIF_INLINE esif_ccb_socket_would_block(void)
+{
+	return (errno == EAGAIN || errno == EWOULDBLOCK || errno == EINTR);
+}
+
+/*
+ * Socket Poller. Level-triggered epoll plus an eventfd so other threads can
+ * wake the poller; wakeups are consumed here and never returned as events.
+ */
+#define ESIF_CCB_POLLIN			EPOLLIN
+#define ESIF_CCB_POLLOUT		EPOLLOUT
+#define ESIF_CCB_POLLERR		(EPOLLERR | EPOLLHUP)
+
+typedef struct epoll_event esif_ccb_poll_event_t;
+
+typedef struct esif_ccb_poll_s {
+	int epfd;
+	int wakefd;
+} *esif_ccb_poll_t;
+
+#define ESIF_CCB_POLL_INVALID	NULL
+#define esif_ccb_poll_event_flags(e)	((e)->events)
+#define esif_ccb_poll_event_context(e)	((e)->data.ptr)
+
+static esif_ccb_poll_t ESIF_INLINE esif_ccb_poll_create(int maxSockets)
+{
+	esif_ccb_poll_t self = (esif_ccb_poll_t)esif_ccb_malloc(sizeof(*self));
+	UNREFERENCED_PARAMETER(maxSockets);
+
+	if (self) {
+		struct epoll_event ev = {0};
+		self->epfd = epoll_create1(EPOLL_CLOEXEC);
+		self->wakefd = eventfd(0, EFD_NONBLOCK | EFD_CLOEXEC);
+		ev.events = EPOLLIN;
+		ev.data.ptr = NULL;
+		if (self->epfd < 0 || self->wakefd < 0 || epoll_ctl(self->epfd, EPOLL_CTL_ADD, self->wakefd, &ev) != 0) {
+			if (self->epfd >= 0)
+				close(self->epfd);
+			if (self->wakefd >= 0)
+				close(self->wakefd);
+			esif_ccb_free(self);
+			self = NULL;
+		}
+	}
+	return self;
+}
+
+static void ESIF_INLINE esif_ccb_poll_destroy(esif_ccb_poll_t self)
+{
+	if (self) {
+		close(self->wakefd);
+		close(self->epfd);
+		esif_ccb_free(self);
+	}
+}
+
+static int ESIF_INLINE esif_ccb_poll_add(esif_ccb_poll_t self, esif_ccb_socket_t s, u32 events, void *context)
+{
+	struct epoll_event ev = {0};
+	ev.events = events;
+	ev.data.ptr = context;
+	return epoll_ctl(self->epfd, EPOLL_CTL_ADD, s, &ev);
+}
+
+static int ESIF_INLINE esif_ccb_poll_modify(esif_ccb_poll_t self, esif_ccb_socket_t s, u32 events, void *context)
+{
+	struct epoll_event ev = {0};
+	ev.events = events;
+	ev.data.ptr = context;
+	return epoll_ctl(self->epfd, EPOLL_CTL_MOD, s, &ev);
+}
+
+static int ESIF_INLINE esif_ccb_poll_remove(esif_ccb_poll_t self, esif_ccb_socket_t s)
+{
+	struct epoll_event ev = {0};
+	return epoll_ctl(self->epfd, EPOLL_CTL_DEL, s, &ev);
+}
+
+static void ESIF_INLINE esif_ccb_poll_wake(esif_ccb_poll_t self)
+{
+	eventfd_write(self->wakefd, 1);
+}
+
+/* Returns number of events, 0 on timeout or wakeup, or SOCKET_ERROR */
+static int ESIF_INLINE esif_ccb_poll_wait(esif_ccb_poll_t self, esif_ccb_poll_event_t *events, int maxEvents, int timeoutMsec)
+{
+	int rc = epoll_wait(self->epfd, events, maxEvents, timeoutMsec);
+	int j = 0;
+
+	if (rc < 0) {
+		return (errno == EINTR ? 0 : SOCKET_ERROR);
+	}
+	/* Consume and filter out wakeup events */
+	while (j < rc) {
+		if (events[j].data.ptr == NULL) {
+			eventfd_t value = 0;
+			eventfd_read(self->wakefd, &value);
+			events[j] = events[--rc];
+			continue;
+		}
+		j++;
+	}
+	return rc;
+}
+
 #endif
 
 #endif /* _ESIF_UF_CCB_SOCK_H_ */
@@ -173,6 +173,7 @@ eEsifError EsifUpDomain_InitDomain(
 	esif_ccb_strcpy(self->participantName, EsifUp_GetName(upPtr), sizeof(self->participantName));
 
 	esif_ccb_lock_init(&self->tempLock);
+	EsifEnergySampler_Init(&self->energySampler);
 	
 exit:
 	return rc;
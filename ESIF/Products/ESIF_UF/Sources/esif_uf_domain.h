@@ -22,6 +22,7 @@
 #include "esif_uf_fpc.h"
 #include "esif_event.h"
 #include "esif_domain.h"
+#include "esif_uf_energy.h"
 
 #define ESIF_DOMAIN_STATE_INVALID 0xffffffff
 
@@ -82,8 +83,7 @@ typedef struct EsifUpDomain_s {
 										 * the device is no longer providing valid temperatures (so DPTF can
 										 * unthrottle for example if unable to read device temp)
 										 */
-	UInt64 lastPower;					/* rapl energy (prior to conversion) */
-	esif_ccb_time_t lastPowerTime;		/* time of last power sample in microseconds */
+	EsifEnergySampler energySampler;	/* RAPL energy samples shared by all power readers */
 	EsifDomainPollTypeId powerPollType;	/* Single threaded, multi threaded, or none */
 	UInt32 lastState;					/* check perf participants for state change */
 	/* Perf state detection */
@@ -88,12 +88,26 @@ static EsifDspPtr esif_dsp_create(void)
 }
 
 
+/* Free Compiled Dispatch Table */
+static void esif_dsp_dispatch_destroy(EsifDspDispatchPtr dispatchPtr)
+{
+	if (NULL == dispatchPtr) {
+		return;
+	}
+	esif_ccb_free(dispatchPtr->id_start);
+	esif_ccb_free(dispatchPtr->entries);
+	esif_ccb_free(dispatchPtr->actions);
+	esif_ccb_free(dispatchPtr);
+}
+
+
 /* Free DSP Upper Instance */
 static void esif_dsp_destroy(EsifDspPtr dspPtr)
 {
 	if (NULL == dspPtr) {
 		return;
 	}
+	esif_dsp_dispatch_destroy(dspPtr->dispatch_ptr);
 	esif_ht_destroy(dspPtr->ht_ptr, NULL);
 	esif_link_list_destroy(dspPtr->algo_ptr);
 	esif_link_list_destroy(dspPtr->domain_ptr);
@@ -163,6 +177,166 @@ static UInt32 get_percent_xform(
 }
 
 
+/* Number Of Actions That Fit In The Primitive, Same Bounds As insert_primitive */
+static UInt32 esif_dsp_primitive_action_count(EsifFpcPrimitivePtr primitivePtr)
+{
+	EsifFpcActionPtr actionPtr = (EsifFpcActionPtr)(primitivePtr + 1);
+	int remainingSize = (int)primitivePtr->size - (int)sizeof(*primitivePtr);
+	UInt32 count = 0;
+
+	for (count = 0; count < primitivePtr->num_actions; count++) {
+		if (remainingSize < (int)sizeof(*actionPtr)) {
+			break;
+		}
+		remainingSize -= actionPtr->size;
+		actionPtr = (EsifFpcActionPtr)((char*)actionPtr + actionPtr->size);
+	}
+	return count;
+}
+
+
+/*
+ * Find A Compiled Primitive By Tuple, Or By Address When primitivePtr Is Given.
+ * Duplicate Tuples Resolve To The First One In The FPC, Like The Hash Table.
+ */
+static EsifDspDispatchEntryPtr esif_dsp_dispatch_find(
+	EsifDspDispatchPtr dispatchPtr,
+	const EsifPrimitiveTuplePtr tuplePtr,
+	EsifFpcPrimitivePtr primitivePtr
+	)
+{
+	EsifDspDispatchEntryPtr entryPtr = NULL;
+	UInt32 i = 0;
+
+	if ((NULL == tuplePtr) || (tuplePtr->id >= dispatchPtr->id_count)) {
+		return NULL;
+	}
+
+	for (i = dispatchPtr->id_start[tuplePtr->id]; i < dispatchPtr->id_start[tuplePtr->id + 1]; i++) {
+		entryPtr = &dispatchPtr->entries[i];
+		if (primitivePtr != NULL) {
+			if (entryPtr->primitive_ptr == primitivePtr) {
+				return entryPtr;
+			}
+		} else if ((entryPtr->primitive_ptr->tuple.domain == tuplePtr->domain) &&
+			(entryPtr->primitive_ptr->tuple.instance == tuplePtr->instance)) {
+			return entryPtr;
+		}
+	}
+	return NULL;
+}
+
+
+/*
+ * Compile The Loaded FPC Into A Dispatch Table. Primitives Are Bucketed By Id
+ * With A Counting Sort So FPC Order Is Kept Within Each Id, Their Actions Are
+ * Resolved Up Front And Algorithms Are Indexed By Action Type.
+ */
+static eEsifError esif_dsp_dispatch_create(
+	EsifFpcPtr fpcPtr,
+	EsifDspPtr dspPtr
+	)
+{
+	eEsifError rc = ESIF_OK;
+	EsifDspDispatchPtr dispatchPtr = NULL;
+	EsifFpcDomainPtr domainPtr = NULL;
+	EsifFpcPrimitivePtr primitivePtr = NULL;
+	EsifFpcActionPtr actionPtr = NULL;
+	EsifDspDispatchEntryPtr entryPtr = NULL;
+	struct esif_link_list_node *nodePtr = NULL;
+	EsifFpcAlgorithmPtr algoPtr = NULL;
+	UInt32 *nextPtr = NULL;
+	UInt32 numPrim = 0;
+	UInt32 numActions = 0;
+	UInt32 actionIndex = 0;
+	UInt32 i = 0;
+	UInt32 j = 0;
+	UInt32 k = 0;
+
+	dispatchPtr = (EsifDspDispatchPtr)esif_ccb_malloc(sizeof(*dispatchPtr));
+	if (NULL == dispatchPtr) {
+		rc = ESIF_E_NO_MEMORY;
+		goto exit;
+	}
+
+	/* Size The Tables */
+	domainPtr = (EsifFpcDomainPtr)(fpcPtr + 1);
+	for (i = 0; i < fpcPtr->number_of_domains; i++) {
+		primitivePtr = (EsifFpcPrimitivePtr)(domainPtr + 1);
+		for (j = 0; j < domainPtr->number_of_primitives; j++) {
+			if (primitivePtr->tuple.id >= dispatchPtr->id_count) {
+				dispatchPtr->id_count = primitivePtr->tuple.id + 1;
+			}
+			numActions += esif_dsp_primitive_action_count(primitivePtr);
+			numPrim++;
+			primitivePtr = (EsifFpcPrimitivePtr)((UInt8 *)primitivePtr + primitivePtr->size);
+		}
+		domainPtr = (EsifFpcDomainPtr)((UInt8 *)domainPtr + domainPtr->size);
+	}
+
+	dispatchPtr->id_start = (UInt32 *)esif_ccb_malloc(sizeof(*dispatchPtr->id_start) * (dispatchPtr->id_count + 1));
+	nextPtr = (UInt32 *)esif_ccb_malloc(sizeof(*nextPtr) * (dispatchPtr->id_count + 1));
+	dispatchPtr->entries = (EsifDspDispatchEntryPtr)esif_ccb_malloc(sizeof(*dispatchPtr->entries) * (numPrim + 1));
+	dispatchPtr->actions = (EsifFpcActionPtr *)esif_ccb_malloc(sizeof(*dispatchPtr->actions) * (numActions + 1));
+	if (!dispatchPtr->id_start || !nextPtr || !dispatchPtr->entries || !dispatchPtr->actions) {
+		rc = ESIF_E_NO_MEMORY;
+		goto exit;
+	}
+
+	/* Count Primitives Per Id, Then Turn The Counts Into Start Offsets */
+	domainPtr = (EsifFpcDomainPtr)(fpcPtr + 1);
+	for (i = 0; i < fpcPtr->number_of_domains; i++) {
+		primitivePtr = (EsifFpcPrimitivePtr)(domainPtr + 1);
+		for (j = 0; j < domainPtr->number_of_primitives; j++) {
+			dispatchPtr->id_start[primitivePtr->tuple.id + 1]++;
+			primitivePtr = (EsifFpcPrimitivePtr)((UInt8 *)primitivePtr + primitivePtr->size);
+		}
+		domainPtr = (EsifFpcDomainPtr)((UInt8 *)domainPtr + domainPtr->size);
+	}
+	for (i = 0; i < dispatchPtr->id_count; i++) {
+		dispatchPtr->id_start[i + 1] += dispatchPtr->id_start[i];
+		nextPtr[i] = dispatchPtr->id_start[i];
+	}
+
+	/* Place Each Primitive And Resolve Its Actions */
+	domainPtr = (EsifFpcDomainPtr)(fpcPtr + 1);
+	for (i = 0; i < fpcPtr->number_of_domains; i++) {
+		primitivePtr = (EsifFpcPrimitivePtr)(domainPtr + 1);
+		for (j = 0; j < domainPtr->number_of_primitives; j++) {
+			entryPtr = &dispatchPtr->entries[nextPtr[primitivePtr->tuple.id]++];
+			entryPtr->primitive_ptr = primitivePtr;
+			entryPtr->actions = &dispatchPtr->actions[actionIndex];
+			entryPtr->action_count = esif_dsp_primitive_action_count(primitivePtr);
+
+			actionPtr = (EsifFpcActionPtr)(primitivePtr + 1);
+			for (k = 0; k < entryPtr->action_count; k++) {
+				dispatchPtr->actions[actionIndex++] = actionPtr;
+				actionPtr = (EsifFpcActionPtr)((UInt8 *)actionPtr + actionPtr->size);
+			}
+			primitivePtr = (EsifFpcPrimitivePtr)((UInt8 *)primitivePtr + primitivePtr->size);
+		}
+		domainPtr = (EsifFpcDomainPtr)((UInt8 *)domainPtr + domainPtr->size);
+	}
+
+	/* First Algorithm Of Each Action Type Wins, Like The List Walk */
+	for (nodePtr = dspPtr->algo_ptr->head_ptr; nodePtr != NULL; nodePtr = nodePtr->next_ptr) {
+		algoPtr = (EsifFpcAlgorithmPtr)nodePtr->data_ptr;
+		if ((algoPtr != NULL) &&
+			(algoPtr->action_type >= 0) && (algoPtr->action_type <= MAX_ESIF_ACTION_ENUM_VALUE) &&
+			(NULL == dispatchPtr->algorithms[algoPtr->action_type])) {
+			dispatchPtr->algorithms[algoPtr->action_type] = algoPtr;
+		}
+	}
+
+	dspPtr->dispatch_ptr = dispatchPtr;
+	dispatchPtr = NULL;
+exit:
+	esif_ccb_free(nextPtr);
+	esif_dsp_dispatch_destroy(dispatchPtr);
+	return rc;
+}
+
+
 /* Insert Primitive */
 static eEsifError insert_primitive(
 	EsifDspPtr dspPtr,
@@ -216,6 +390,11 @@ static EsifFpcPrimitivePtr get_primitive(
 		return NULL;
 	}
 
+	if (dspPtr->dispatch_ptr != NULL) {
+		EsifDspDispatchEntryPtr entryPtr = esif_dsp_dispatch_find(dspPtr->dispatch_ptr, tuplePtr, NULL);
+		return (entryPtr != NULL) ? entryPtr->primitive_ptr : NULL;
+	}
+
 	primitivePtr = (EsifFpcPrimitivePtr)
 		esif_ht_get_item(dspPtr->ht_ptr,
 		(UInt8 *)tuplePtr,
@@ -239,6 +418,13 @@ static EsifFpcActionPtr get_action(
 		return NULL;
 	}
 
+	if (dspPtr->dispatch_ptr != NULL) {
+		EsifDspDispatchEntryPtr entryPtr = esif_dsp_dispatch_find(dspPtr->dispatch_ptr, &primitivePtr->tuple, primitivePtr);
+		if ((entryPtr != NULL) && (index < entryPtr->action_count)) {
+			return entryPtr->actions[index];
+		}
+	}
+
 	/* First Action */
 	fpcActionPtr = (EsifFpcActionPtr)(primitivePtr + 1);
 
@@ -293,6 +479,13 @@ static EsifFpcAlgorithmPtr get_algorithm(
 		return NULL;
 	}
 
+	if (dspPtr->dispatch_ptr != NULL) {
+		if ((actionType < 0) || (actionType > MAX_ESIF_ACTION_ENUM_VALUE)) {
+			return NULL;
+		}
+		return dspPtr->dispatch_ptr->algorithms[actionType];
+	}
+
 	listPtr = dspPtr->algo_ptr;
 	currPtr = listPtr->head_ptr;
 
@@ -625,6 +818,13 @@ eEsifError esif_fpc_load(
 		eventPtr = (EsifFpcEventPtr)(eventPtr + 1);
 	}
 
+	/* Compile Lookups; Without Them The DSP Still Works From The Hash Table */
+	esif_dsp_dispatch_destroy(dspPtr->dispatch_ptr);
+	dspPtr->dispatch_ptr = NULL;
+	if (esif_dsp_dispatch_create(fpcPtr, dspPtr) != ESIF_OK) {
+		ESIF_TRACE_WARN("Fail to compile dispatch table, using hash table lookups\n");
+	}
+
 exit:
 	if (fpcPtr != NULL) {
 		ESIF_TRACE_DEBUG("%u domains, %u primitives and %u algorithms %u events inserted! status %s",
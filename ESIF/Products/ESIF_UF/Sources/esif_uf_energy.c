@@ -0,0 +1,207 @@
+/******************************************************************************
+** Copyright (c) 2013-2016 Intel Corporation All Rights Reserved
+**
+** Licensed under the Apache License, Version 2.0 (the "License"); you may not
+** use this file except in compliance with the License.
+**
+** You may obtain a copy of the License at
+**     http://www.apache.org/licenses/LICENSE-2.0
+**
+** Unless required by applicable law or agreed to in writing, software
+** distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+** WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+**
+** See the License for the specific language governing permissions and
+** limitations under the License.
+**
+******************************************************************************/
+
+#include "esif_uf_energy.h"
+
+#ifdef ESIF_ATTR_OS_WINDOWS
+//
+// The Windows banned-API check header must be included after all other headers, or issues can be identified
+// against Windows SDK/DDK included headers which we have no control over.
+//
+#define _SDL_BANNED_RECOMMENDED
+#include "win\banned.h"
+#endif
+
+#define ESIF_ENERGY_USEC_PER_SEC	1000000
+
+/* Sample i in age order, 0 being the oldest; the lock must be held */
+static EsifEnergySamplePtr EsifEnergySampler_GetSample(
+	EsifEnergySamplerPtr self,
+	UInt32 i
+	)
+{
+	return &self->samples[(self->head + ESIF_ENERGY_SAMPLE_COUNT - self->count + i) % ESIF_ENERGY_SAMPLE_COUNT];
+}
+
+
+void EsifEnergySampler_Init(EsifEnergySamplerPtr self)
+{
+	ESIF_ASSERT(self != NULL);
+
+	esif_ccb_memset(self, 0, sizeof(*self));
+	esif_ccb_lock_init(&self->lock);
+}
+
+
+void EsifEnergySampler_Uninit(EsifEnergySamplerPtr self)
+{
+	ESIF_ASSERT(self != NULL);
+
+	esif_ccb_lock_uninit(&self->lock);
+}
+
+
+void EsifEnergySampler_SetCounterRange(
+	EsifEnergySamplerPtr self,
+	UInt64 counterRange
+	)
+{
+	ESIF_ASSERT(self != NULL);
+
+	esif_ccb_write_lock(&self->lock);
+	self->counterRange = counterRange;
+	self->isCounterRangeSet = ESIF_TRUE;
+	esif_ccb_write_unlock(&self->lock);
+}
+
+
+Bool EsifEnergySampler_IsCounterRangeSet(EsifEnergySamplerPtr self)
+{
+	Bool isSet = ESIF_FALSE;
+
+	ESIF_ASSERT(self != NULL);
+
+	esif_ccb_read_lock(&self->lock);
+	isSet = self->isCounterRangeSet;
+	esif_ccb_read_unlock(&self->lock);
+
+	return isSet;
+}
+
+
+Bool EsifEnergySampler_IsSampleDue(
+	EsifEnergySamplerPtr self,
+	UInt64 timestamp
+	)
+{
+	Bool isDue = ESIF_TRUE;
+
+	ESIF_ASSERT(self != NULL);
+
+	esif_ccb_read_lock(&self->lock);
+	if (self->count > 0) {
+		isDue = (Bool)(timestamp >= EsifEnergySampler_GetSample(self, self->count - 1)->timestamp + ESIF_ENERGY_MIN_SAMPLE_USEC);
+	}
+	esif_ccb_read_unlock(&self->lock);
+
+	return isDue;
+}
+
+
+void EsifEnergySampler_AddSample(
+	EsifEnergySamplerPtr self,
+	UInt64 timestamp,
+	UInt64 counter
+	)
+{
+	EsifEnergySamplePtr newestPtr = NULL;
+	UInt64 energy = 0;
+
+	ESIF_ASSERT(self != NULL);
+
+	esif_ccb_write_lock(&self->lock);
+
+	if (self->count > 0) {
+		newestPtr = EsifEnergySampler_GetSample(self, self->count - 1);
+
+		/* Another reader already sampled at or after this time */
+		if (timestamp <= newestPtr->timestamp) {
+			goto exit;
+		}
+
+		if (counter >= self->lastCounter) {
+			energy = newestPtr->energy + (counter - self->lastCounter);
+		}
+		else if ((self->counterRange != 0) && (self->lastCounter <= self->counterRange)) {
+			/* Wrapped Around */
+			energy = newestPtr->energy + (self->counterRange - self->lastCounter) + counter;
+		}
+		else {
+			/* Counter Reset; Restart The Stream */
+			self->count = 0;
+			energy = 0;
+		}
+	}
+
+	self->samples[self->head].timestamp = timestamp;
+	self->samples[self->head].energy = energy;
+	self->head = (self->head + 1) % ESIF_ENERGY_SAMPLE_COUNT;
+	if (self->count < ESIF_ENERGY_SAMPLE_COUNT) {
+		self->count++;
+	}
+	self->lastCounter = counter;
+exit:
+	esif_ccb_write_unlock(&self->lock);
+}
+
+
+eEsifError EsifEnergySampler_GetAveragePower(
+	EsifEnergySamplerPtr self,
+	UInt64 window,
+	UInt64 *powerPtr
+	)
+{
+	eEsifError rc = ESIF_OK;
+	EsifEnergySamplePtr newestPtr = NULL;
+	EsifEnergySamplePtr startPtr = NULL;
+	UInt64 startTime = 0;
+	UInt32 low = 0;
+	UInt32 high = 0;
+	UInt32 mid = 0;
+
+	ESIF_ASSERT(self != NULL);
+	ESIF_ASSERT(powerPtr != NULL);
+
+	*powerPtr = 0;
+
+	esif_ccb_read_lock(&self->lock);
+
+	if (self->count < 2) {
+		rc = ESIF_I_AGAIN;
+		goto exit;
+	}
+
+	if (window < ESIF_ENERGY_MIN_WINDOW_USEC) {
+		window = ESIF_ENERGY_MIN_WINDOW_USEC;
+	}
+
+	/*
+	 * Binary search for the newest sample at or before the window start;
+	 * the ring is in time order and bounded, so this is constant time.
+	 */
+	newestPtr = EsifEnergySampler_GetSample(self, self->count - 1);
+	startTime = (newestPtr->timestamp > window) ? newestPtr->timestamp - window : 0;
+	low = 0;
+	high = self->count - 1;
+	while (low < high) {
+		mid = (low + high + 1) / 2;
+		if (EsifEnergySampler_GetSample(self, mid)->timestamp <= startTime) {
+			low = mid;
+		}
+		else {
+			high = mid - 1;
+		}
+	}
+	startPtr = EsifEnergySampler_GetSample(self, (low < self->count - 1) ? low : self->count - 2);
+
+	*powerPtr = (UInt64)((double)(newestPtr->energy - startPtr->energy) * ESIF_ENERGY_USEC_PER_SEC /
+		(double)(newestPtr->timestamp - startPtr->timestamp));
+exit:
+	esif_ccb_read_unlock(&self->lock);
+	return rc;
+}
@@ -0,0 +1,104 @@
+/******************************************************************************
+** Copyright (c) 2013-2016 Intel Corporation All Rights Reserved
+**
+** Licensed under the Apache License, Version 2.0 (the "License"); you may not
+** use this file except in compliance with the License.
+**
+** You may obtain a copy of the License at
+**     http://www.apache.org/licenses/LICENSE-2.0
+**
+** Unless required by applicable law or agreed to in writing, software
+** distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+** WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+**
+** See the License for the specific language governing permissions and
+** limitations under the License.
+**
+******************************************************************************/
+
+#pragma once
+#include "esif.h"
+
+/*
+ * Energy Counter Sampler
+ *
+ * Keeps a ring of (monotonic timestamp, energy) samples taken from a free
+ * running energy counter such as a RAPL energy_uj node, so that every reader
+ * of a domain shares one sample stream and can ask for the average power over
+ * its own window.  Counter wraparound is removed when a sample is added, so the
+ * stored energy only ever increases and any two samples give the energy used
+ * between them.  A counter that goes backwards by an unknown amount restarts
+ * the stream.
+ */
+
+#define ESIF_ENERGY_SAMPLE_COUNT		32		/* Samples kept per domain */
+#define ESIF_ENERGY_MIN_SAMPLE_USEC		100000	/* Readers within this interval share the newest sample */
+#define ESIF_ENERGY_MIN_WINDOW_USEC		1000000	/* Shortest averaging window, and the window used when none is given */
+
+typedef struct EsifEnergySample_s {
+	UInt64 timestamp;	/* Monotonic time in microseconds */
+	UInt64 energy;		/* Energy since the stream started, in counter units */
+} EsifEnergySample, *EsifEnergySamplePtr;
+
+typedef struct EsifEnergySampler_s {
+	esif_ccb_lock_t lock;
+	UInt64 counterRange;	/* Counter value at which it wraps to 0; 0 if unknown */
+	Bool isCounterRangeSet;	/* Range has been looked up, even if it was not found */
+	UInt64 lastCounter;		/* Raw counter of the newest sample */
+	UInt32 head;			/* Index the next sample is written to */
+	UInt32 count;			/* Number of valid samples */
+	EsifEnergySample samples[ESIF_ENERGY_SAMPLE_COUNT];
+} EsifEnergySampler, *EsifEnergySamplerPtr;
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+void EsifEnergySampler_Init(EsifEnergySamplerPtr self);
+void EsifEnergySampler_Uninit(EsifEnergySamplerPtr self);
+
+/*
+ * Sets the counter wraparound range (e.g. max_energy_range_uj); 0 if the
+ * counter has none, so that a missing range is not looked up again.
+ */
+void EsifEnergySampler_SetCounterRange(
+	EsifEnergySamplerPtr self,
+	UInt64 counterRange
+	);
+
+Bool EsifEnergySampler_IsCounterRangeSet(EsifEnergySamplerPtr self);
+
+/* Returns ESIF_TRUE if the newest sample is older than ESIF_ENERGY_MIN_SAMPLE_USEC at timestamp */
+Bool EsifEnergySampler_IsSampleDue(
+	EsifEnergySamplerPtr self,
+	UInt64 timestamp
+	);
+
+/*
+ * Adds a counter reading taken at a monotonic timestamp (usec).  Readings
+ * that are not newer than the newest sample are ignored.
+ */
+void EsifEnergySampler_AddSample(
+	EsifEnergySamplerPtr self,
+	UInt64 timestamp,
+	UInt64 counter
+	);
+
+/*
+ * Gets the average power, in counter units per second, over the window (usec)
+ * ending at the newest sample.  The window starts at the newest sample taken
+ * at or before its start, or the oldest sample if the stream is shorter than
+ * the window.  Windows shorter than ESIF_ENERGY_MIN_WINDOW_USEC, including 0,
+ * use ESIF_ENERGY_MIN_WINDOW_USEC so the result does not depend on how
+ * closely together other readers happened to sample.
+ * Returns ESIF_I_AGAIN with 0 power until there are two samples.
+ */
+eEsifError EsifEnergySampler_GetAveragePower(
+	EsifEnergySamplerPtr self,
+	UInt64 window,
+	UInt64 *powerPtr
+	);
+
+#ifdef __cplusplus
+}
+#endif
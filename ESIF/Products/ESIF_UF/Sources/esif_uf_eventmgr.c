@@ -23,7 +23,6 @@
 #include "esif_event.h"
 #include "esif_ccb_atomic.h"
 #include "esif_uf_eventmgr.h"
-#include "esif_queue.h"
 
 #ifdef ESIF_ATTR_OS_WINDOWS
 //
@@ -45,18 +44,20 @@
  *   EsifEventMgr_RegisterEventByGuid
  *   EsifEventMgr_UnregisterEventByGuid
  *
- * Event observer information is maintained as an array of linked lists with a list of observers the event types
- * There are 64 event lists (Information is placed in a given list given by the modulo 64 of the event type)
+ * The event queue is a bounded ring of preallocated slots.  Any thread may signal an event; a producer claims a
+ * slot with a compare-and-swap on the ring head, copies the event (small event data is copied into the slot
+ * itself), and then publishes the slot by advancing its sequence number.  The event thread is the only consumer.
+ * When the ring is full the event is dropped and counted rather than allocating or blocking the signaling thread.
+ *
+ * Event observer information is maintained in a table indexed by event type.  Each table entry points to an
+ * immutable array of the observers of that event type.  Events are delivered without taking any lock:
+ * readers announce themselves in an active reader count and walk the array that is currently published.
+ * Registration changes are serialized by the list lock; they build a new array, publish it, and retire the old
+ * one.  Retired arrays, and entries whose reference count reached 0, are only freed once no reader is active.
  * Event observers may register based on the event type or GUID.
  * EVENT_MGR_MATCH_ANY may be used as the participant ID during registration to observe events from all participants;
  * or if registration takes place before the participants are present.
- * Locks are released before any calls outside the event manager which may result in obtaining other locks;
- * locks re-acquired upon return.
  * A reference count is kept for each observer; events are only sent to observers with a positive reference count
- * When the reference count reaches 0, the node is garbage collected
- * Before an observer is called, the reference count is incremented so that the node is not removed while in use;
- * the reference count is decrement upon return and the node is garbage collected if the reference count is then 0.
- * A single garbage collection linked list is maintained.  Any garbage nodes are moved to that list for destruction.
  * Any steps required to enable/disable an event, for example DPPE, will be performed during creation/destruction.
  */
 static EsifEventMgr g_EsifEventMgr = {0};
@@ -88,10 +89,20 @@ static eEsifError EsifEventMgr_ProcessEvent(
 
 static eEsifError EsifEventMgr_EnableEvent(EventMgrEntryPtr entryPtr);
 static eEsifError EsifEventMgr_DisableEvent(EventMgrEntryPtr entryPtr);
-static eEsifError EsifEventMgr_MoveEntryToGarbage(EventMgrEntryPtr entryPtr);
-static eEsifError EsifEventMgr_DumpGarbage();
-static void EsifEventMgr_QueueDestroyCallback(void *ctxPtr);
-static void EsifEventMgr_LLEntryDestroyCallback(void *dataPtr);
+static EventMgrEntryPtr EsifEventMgr_FindEntry(
+	EventMgrObserverListPtr listPtr,
+	eEsifEventType eventType,
+	UInt8 participantId,
+	UInt16 domainId,
+	EVENT_OBSERVER_CALLBACK eventCallback,
+	void *contextPtr
+	);
+static eEsifError EsifEventMgr_ReplaceObserverList(
+	eEsifEventType eventType,
+	EventMgrEntryPtr addEntryPtr,
+	EventMgrEntryPtr removeEntryPtr
+	);
+static void EsifEventMgr_DumpGarbage();
 
 eEsifError ESIF_CALLCONV EsifEventMgr_SignalEvent(
 	UInt8 participantId,
@@ -103,31 +114,66 @@ eEsifError ESIF_CALLCONV EsifEventMgr_SignalEvent(
 	eEsifError rc = ESIF_OK;
 	EsifEventQueueItemPtr queueEventPtr = NULL;
 	EsifDataPtr queueDataPtr = NULL;
+	atomic_basetype position = 0;
+	atomic_basetype available = 0;
 
-	if (NULL == g_EsifEventMgr.eventQueuePtr) { /* Should never happen */
+	if (NULL == g_EsifEventMgr.eventQueue) { /* Should never happen */
 		rc = ESIF_E_UNSPECIFIED;
 		goto exit;
 	}
 
-	queueEventPtr = esif_ccb_malloc(sizeof(*queueEventPtr));
-	if (NULL == queueEventPtr) {
-		rc = ESIF_E_NO_MEMORY;
-		goto exit;
-	}
-
+	/* Data too large for the slot is copied before claiming one so that no allocation is made while holding it */
 	if ((eventDataPtr != NULL) &&
 	    (eventDataPtr->buf_ptr != NULL) && 
 	    (eventDataPtr->buf_len > 0) &&
 	    (eventDataPtr->data_len > 0) &&
-	    (eventDataPtr->buf_len >= eventDataPtr->data_len)) {
+	    (eventDataPtr->buf_len >= eventDataPtr->data_len) &&
+	    (eventDataPtr->data_len > ESIF_UF_EVENT_INLINE_DATA_SIZE)) {
 
 		queueDataPtr = esif_ccb_malloc(eventDataPtr->data_len);
 		if (NULL == queueDataPtr) {
 			rc = ESIF_E_NO_MEMORY;
 			goto exit;
 		}
-
 		esif_ccb_memcpy(queueDataPtr, eventDataPtr->buf_ptr, eventDataPtr->data_len);
+	}
+
+	/* Claim the slot at the head of the ring */
+	position = atomic_read(&g_EsifEventMgr.eventQueueHead);
+	for (;;) {
+		queueEventPtr = &g_EsifEventMgr.eventQueue[position & (ESIF_UF_EVENT_QUEUE_SIZE - 1)];
+		available = atomic_read(&queueEventPtr->sequence) - position;
+
+		if (available == 0) {
+			if (atomic_cmpxchg(&g_EsifEventMgr.eventQueueHead, position, position + 1) == position) {
+				break;
+			}
+			position = atomic_read(&g_EsifEventMgr.eventQueueHead);
+		} else if (available < 0) {
+			/* The event thread has not consumed this slot from the previous pass yet */
+			atomic_inc(&g_EsifEventMgr.eventQueueOverflows);
+			ESIF_TRACE_WARN("Event queue full; dropping %s event for Part. %u Dom. 0x%04X\n",
+				esif_event_type_str(eventType),
+				participantId,
+				domainId);
+			rc = ESIF_E_NO_MEMORY;
+			goto exit;
+		} else {
+			position = atomic_read(&g_EsifEventMgr.eventQueueHead);
+		}
+	}
+
+	esif_ccb_memset(&queueEventPtr->eventData, 0, sizeof(queueEventPtr->eventData));
+	if ((eventDataPtr != NULL) &&
+	    (eventDataPtr->buf_ptr != NULL) && 
+	    (eventDataPtr->buf_len > 0) &&
+	    (eventDataPtr->data_len > 0) &&
+	    (eventDataPtr->buf_len >= eventDataPtr->data_len)) {
+
+		if (NULL == queueDataPtr) {
+			esif_ccb_memcpy(queueEventPtr->inlineData, eventDataPtr->buf_ptr, eventDataPtr->data_len);
+			queueDataPtr = (EsifDataPtr)queueEventPtr->inlineData;
+		}
 
 		queueEventPtr->eventData.type = eventDataPtr->type;
 		queueEventPtr->eventData.buf_ptr = queueDataPtr;
@@ -144,18 +190,45 @@ eEsifError ESIF_CALLCONV EsifEventMgr_SignalEvent(
 		participantId,
 		domainId);
 
-	rc = esif_queue_enqueue(g_EsifEventMgr.eventQueuePtr, queueEventPtr);
-	if (rc != ESIF_OK) {
-		goto exit;
-	}
+	/* Publish the slot to the event thread */
+	esif_ccb_mb();
+	atomic_set(&queueEventPtr->sequence, position + 1);
+	queueDataPtr = NULL;
+
+	esif_ccb_sem_up(&g_EsifEventMgr.eventQueueDoorbell);
 
 exit:
-	if (rc != ESIF_OK) {
-		esif_ccb_free(queueEventPtr);
-		esif_ccb_free(queueDataPtr);
+	esif_ccb_free(queueDataPtr);
+	return rc;
+}
+
+
+/* Returns the slot at the tail of the ring if a producer has published it, otherwise NULL */
+static EsifEventQueueItemPtr EsifEventMgr_PeekEvent(void)
+{
+	atomic_basetype position = g_EsifEventMgr.eventQueueTail;
+	EsifEventQueueItemPtr queueEventPtr = &g_EsifEventMgr.eventQueue[position & (ESIF_UF_EVENT_QUEUE_SIZE - 1)];
 
+	if (atomic_read(&queueEventPtr->sequence) != position + 1) {
+		queueEventPtr = NULL;
 	}
-	return rc;
+	return queueEventPtr;
+}
+
+
+/* Frees any data copied out of the slot and hands the slot back to the producers for the next pass */
+static void EsifEventMgr_ReleaseEvent(EsifEventQueueItemPtr queueEventPtr)
+{
+	atomic_basetype position = g_EsifEventMgr.eventQueueTail;
+
+	if (queueEventPtr->eventData.buf_ptr != queueEventPtr->inlineData) {
+		esif_ccb_free(queueEventPtr->eventData.buf_ptr);
+	}
+	queueEventPtr->eventData.buf_ptr = NULL;
+
+	g_EsifEventMgr.eventQueueTail = position + 1;
+	esif_ccb_mb();
+	atomic_set(&queueEventPtr->sequence, position + ESIF_UF_EVENT_QUEUE_SIZE);
 }
 
 
@@ -166,24 +239,30 @@ static void *ESIF_CALLCONV EsifEventMgr_EventQueueThread(void *ctxPtr)
 	UNREFERENCED_PARAMETER(ctxPtr);
 
 	while(!g_EsifEventMgr.eventQueueExitFlag) {
-		queueEventPtr = esif_queue_pull(g_EsifEventMgr.eventQueuePtr);
+		esif_ccb_sem_down(&g_EsifEventMgr.eventQueueDoorbell);
 
-		if (NULL == queueEventPtr) {
-			continue;
-		}
+		/*
+		 * A doorbell may arrive while an earlier slot is still being filled by another producer;
+		 * that producer rings again once the slot is published.
+		 */
+		while (!g_EsifEventMgr.eventQueueExitFlag && ((queueEventPtr = EsifEventMgr_PeekEvent()) != NULL)) {
 
-		ESIF_TRACE_INFO("Dequeuing %s event for Part. %u Dom. 0x%04X\n",
-			esif_event_type_str(queueEventPtr->eventType),
-			queueEventPtr->participantId,
-			queueEventPtr->domainId);
+			ESIF_TRACE_INFO("Dequeuing %s event for Part. %u Dom. 0x%04X\n",
+				esif_event_type_str(queueEventPtr->eventType),
+				queueEventPtr->participantId,
+				queueEventPtr->domainId);
 
-		EsifEventMgr_ProcessEvent(queueEventPtr->participantId,
-			queueEventPtr->domainId,
-			queueEventPtr->eventType,
-			&queueEventPtr->eventData);
+			EsifEventMgr_ProcessEvent(queueEventPtr->participantId,
+				queueEventPtr->domainId,
+				queueEventPtr->eventType,
+				&queueEventPtr->eventData);
 
-		esif_ccb_free(queueEventPtr->eventData.buf_ptr);
-		esif_ccb_free(queueEventPtr);
+			EsifEventMgr_ReleaseEvent(queueEventPtr);
+		}
+
+		if (atomic_read(&g_EsifEventMgr.garbageCount) > 0) {
+			EsifEventMgr_DumpGarbage();
+		}
 	}
 	return 0;
 }
@@ -197,13 +276,10 @@ static eEsifError EsifEventMgr_ProcessEvent(
 	)
 {
 	eEsifError rc = ESIF_OK;
-	EsifLinkListPtr listPtr = NULL;
-	EsifLinkListNodePtr nodePtr = NULL;
-	EsifLinkListNodePtr nextNodePtr = NULL;
+	EventMgrObserverListPtr listPtr = NULL;
 	EventMgrEntryPtr entryPtr = NULL;
+	UInt32 i = 0;
 	char domain_str[8] = "";
-	atomic_t refCount = 0;
-	UInt8 shouldDumpGarbage = ESIF_FALSE;
 
 	UNREFERENCED_PARAMETER(domain_str);
 
@@ -244,63 +320,36 @@ static eEsifError EsifEventMgr_ProcessEvent(
 		}
 	}
 
-	esif_ccb_write_lock(&g_EsifEventMgr.listLock);
-
-	listPtr = g_EsifEventMgr.observerLists[(unsigned)eventType % NUM_EVENT_LISTS];
-	if(NULL == listPtr) {
-		rc = ESIF_E_UNSPECIFIED;
-		esif_ccb_write_unlock(&g_EsifEventMgr.listLock);
+	if ((unsigned)eventType >= ESIF_UF_EVENT_OBSERVER_TABLE_SIZE) {
+		rc = ESIF_E_EVENT_NOT_FOUND;
 		goto exit;
 	}
 
-	nodePtr = listPtr->head_ptr;
-	while (NULL != nodePtr) {
-		nextNodePtr = nodePtr->next_ptr;
+	/*
+	 * No lock is held while observers are called.  The list read here, and every entry in it,
+	 * stays valid until this thread leaves the active reader count; even if the observer is
+	 * unregistered (by the callback or by any other thread) in the meantime.
+	 */
+	atomic_inc(&g_EsifEventMgr.activeReaders);
 
-		entryPtr = (EventMgrEntryPtr)nodePtr->data_ptr;
+	listPtr = g_EsifEventMgr.observerTable[eventType];
+	for (i = 0; (listPtr != NULL) && (i < listPtr->count); i++) {
+		entryPtr = listPtr->entries[i];
 		ESIF_ASSERT(entryPtr != NULL);
 
-		if ((eventType == entryPtr->fpcEvent.esif_event) &&
-			((entryPtr->participantId == participantId) || (entryPtr->participantId == EVENT_MGR_MATCH_ANY)) &&
+		if (((entryPtr->participantId == participantId) || (entryPtr->participantId == EVENT_MGR_MATCH_ANY)) &&
 			((entryPtr->domainId == domainId) || (entryPtr->domainId == EVENT_MGR_MATCH_ANY) || (domainId == EVENT_MGR_DOMAIN_NA)) &&
-			(entryPtr->refCount > 0)) {
-
-			/*
-			 * Increment the reference count so that the node is not removed while in use,
-			 * then release the lock so that we avoid a deadlock condition
-			 */
-			atomic_inc(&entryPtr->refCount);
-			esif_ccb_write_unlock(&g_EsifEventMgr.listLock);
+			(atomic_read(&entryPtr->refCount) > 0)) {
 
 			entryPtr->callback(entryPtr->contextPtr,
 				participantId,
 				domainId,
 				&entryPtr->fpcEvent,
 				eventDataPtr);
-
-			/* 
-			 * Get the lock back and decrement the reference count.  Remove the node now
-			 * if the reference count is 0
-			 */
-			esif_ccb_write_lock(&g_EsifEventMgr.listLock);
-
-			nextNodePtr = nodePtr->next_ptr;
-
-			refCount = atomic_dec(&entryPtr->refCount);
-			if (refCount <= 0) {
-				EsifEventMgr_MoveEntryToGarbage(entryPtr);
-				esif_link_list_node_remove(listPtr, nodePtr);
-				shouldDumpGarbage = ESIF_TRUE;
-			}
 		}
-		nodePtr = nextNodePtr;
 	}
 
-	esif_ccb_write_unlock(&g_EsifEventMgr.listLock);
-
-	if (shouldDumpGarbage) {
-		EsifEventMgr_DumpGarbage();
-	}
+	atomic_dec(&g_EsifEventMgr.activeReaders);
 
 exit:
 	return rc;
@@ -553,42 +602,33 @@ static eEsifError EsifEventMgr_AddEntry(
 	)
 {
 	eEsifError rc = ESIF_OK;
-	EsifLinkListPtr listPtr = NULL;
-	EsifLinkListNodePtr nodePtr = NULL;
 	EventMgrEntryPtr curEntryPtr = NULL;
 	EventMgrEntryPtr newEntryPtr = NULL;
 	atomic_t refCount = 1;
 
 	ESIF_ASSERT(eventCallback != NULL);
 
-	esif_ccb_write_lock(&g_EsifEventMgr.listLock);
-
-	listPtr = g_EsifEventMgr.observerLists[fpcEventPtr->esif_event % NUM_EVENT_LISTS];
-	if(NULL == listPtr) {
-		rc = ESIF_E_UNSPECIFIED;
-		esif_ccb_write_unlock(&g_EsifEventMgr.listLock);
+	if ((unsigned)fpcEventPtr->esif_event >= ESIF_UF_EVENT_OBSERVER_TABLE_SIZE) {
+		rc = ESIF_E_EVENT_NOT_FOUND;
 		goto exit;
 	}
 
+	esif_ccb_write_lock(&g_EsifEventMgr.listLock);
+
 	/* 
 	 * First verify we don't already have the same entry.
 	 * If we do, just increment the reference count.
 	 */
-	nodePtr = listPtr->head_ptr;
-	while (nodePtr != NULL) {
-		curEntryPtr = (EventMgrEntryPtr) nodePtr->data_ptr;
-		if ((curEntryPtr->fpcEvent.esif_event == fpcEventPtr->esif_event) &&
-			(curEntryPtr->participantId == participantId) &&
-			(curEntryPtr->domainId == domainId) &&
-			(curEntryPtr->contextPtr == contextPtr) &&
-			(curEntryPtr->callback == eventCallback)){
-			break;
-		}
-		nodePtr = nodePtr->next_ptr;
-	}
+	curEntryPtr = EsifEventMgr_FindEntry(g_EsifEventMgr.observerTable[fpcEventPtr->esif_event],
+		fpcEventPtr->esif_event,
+		participantId,
+		domainId,
+		eventCallback,
+		contextPtr);
+
 	/* If we found an existing entry, update the reference count */
-	if (nodePtr != NULL) {
-		atomic_inc(&curEntryPtr->refCount);
+	if (curEntryPtr != NULL) {
+		refCount = atomic_inc(&curEntryPtr->refCount);
 		esif_ccb_write_unlock(&g_EsifEventMgr.listLock);
 		goto exit;
 	}
@@ -596,7 +636,7 @@ static eEsifError EsifEventMgr_AddEntry(
 
 	/*
 	 * If an matching observer entry was not present; create a new observer entry,
-	 * enable the events, and then place it into the list
+	 * enable the events, and then publish it in the observer list
 	 */
 	newEntryPtr = esif_ccb_malloc(sizeof(*newEntryPtr));
 	if (NULL == newEntryPtr) {
@@ -611,24 +651,20 @@ static eEsifError EsifEventMgr_AddEntry(
 	newEntryPtr->refCount = refCount;
 	esif_ccb_memcpy(&newEntryPtr->fpcEvent, fpcEventPtr, sizeof(newEntryPtr->fpcEvent));
 
-	nodePtr = esif_link_list_create_node(newEntryPtr);
-	if (NULL == nodePtr) {
-		rc = ESIF_E_NO_MEMORY;
+	rc = EsifEventMgr_EnableEvent(newEntryPtr);
+	if (ESIF_OK != rc) {
 		goto exit;
 	}
-	
+
 	esif_ccb_write_lock(&g_EsifEventMgr.listLock);
-	esif_link_list_add_node_at_back(listPtr, nodePtr);
+	rc = EsifEventMgr_ReplaceObserverList(newEntryPtr->fpcEvent.esif_event, newEntryPtr, NULL);
 	esif_ccb_write_unlock(&g_EsifEventMgr.listLock);
 
-	rc = EsifEventMgr_EnableEvent(newEntryPtr);
-	if (ESIF_OK != rc)
-	{
-		esif_ccb_write_lock(&g_EsifEventMgr.listLock);
-		esif_link_list_node_remove(listPtr, nodePtr);
-		esif_ccb_write_unlock(&g_EsifEventMgr.listLock);
+	if (ESIF_OK != rc) {
+		EsifEventMgr_DisableEvent(newEntryPtr);
 		goto exit;
 	}
+	EsifEventMgr_DumpGarbage();
 
 exit:
 	ESIF_TRACE_DEBUG("  RefCount: " ATOMIC_FMT "\n", refCount);
@@ -650,48 +686,123 @@ static eEsifError EsifEventMgr_ReleaseEntry(
 	)
 {
 	eEsifError rc = ESIF_OK;
-	EsifLinkListPtr listPtr = NULL;
-	EsifLinkListNodePtr nodePtr = NULL;
 	EventMgrEntryPtr curEntryPtr = NULL;
 	atomic_t refCount = -1;
 
 	ESIF_ASSERT(eventCallback != NULL);
 	ESIF_ASSERT(fpcEventPtr != NULL);
 
+	if ((unsigned)fpcEventPtr->esif_event >= ESIF_UF_EVENT_OBSERVER_TABLE_SIZE) {
+		rc = ESIF_E_EVENT_NOT_FOUND;
+		goto exit;
+	}
 
 	esif_ccb_write_lock(&g_EsifEventMgr.listLock);
 
-	listPtr = g_EsifEventMgr.observerLists[fpcEventPtr->esif_event % NUM_EVENT_LISTS];
-	if(NULL == listPtr) {
-		rc = ESIF_E_UNSPECIFIED;
-		goto exit;
+	/* Find the matching entry */
+	curEntryPtr = EsifEventMgr_FindEntry(g_EsifEventMgr.observerTable[fpcEventPtr->esif_event],
+		fpcEventPtr->esif_event,
+		participantId,
+		domainId,
+		eventCallback,
+		contextPtr);
+
+	if (curEntryPtr != NULL) {
+		refCount = atomic_dec(&curEntryPtr->refCount);
+		if (refCount <= 0) {
+			rc = EsifEventMgr_ReplaceObserverList(curEntryPtr->fpcEvent.esif_event, NULL, curEntryPtr);
+		}
 	}
+	esif_ccb_write_unlock(&g_EsifEventMgr.listLock);
 
-	/* Find the matching entry */
-	nodePtr = listPtr->head_ptr;
-	while (nodePtr != NULL) {
-		curEntryPtr = (EventMgrEntryPtr) nodePtr->data_ptr;
-		if ((curEntryPtr->fpcEvent.esif_event == fpcEventPtr->esif_event) &&
+	/* Readers may still hold the removed entry; it is freed once they have all left */
+	if ((curEntryPtr != NULL) && (refCount <= 0) && (ESIF_OK == rc)) {
+		EsifEventMgr_DisableEvent(curEntryPtr);
+
+		esif_ccb_write_lock(&g_EsifEventMgr.listLock);
+		rc = esif_link_list_add_at_back(g_EsifEventMgr.garbageList, (void *)curEntryPtr);
+		atomic_inc(&g_EsifEventMgr.garbageCount);
+		esif_ccb_write_unlock(&g_EsifEventMgr.listLock);
+	}
+	EsifEventMgr_DumpGarbage();
+exit:
+	return rc;
+}
+
+
+/* List lock should be held when called */
+static EventMgrEntryPtr EsifEventMgr_FindEntry(
+	EventMgrObserverListPtr listPtr,
+	eEsifEventType eventType,
+	UInt8 participantId,
+	UInt16 domainId,
+	EVENT_OBSERVER_CALLBACK eventCallback,
+	void *contextPtr
+	)
+{
+	EventMgrEntryPtr curEntryPtr = NULL;
+	UInt32 i = 0;
+
+	for (i = 0; (listPtr != NULL) && (i < listPtr->count); i++) {
+		curEntryPtr = listPtr->entries[i];
+		if ((curEntryPtr->fpcEvent.esif_event == eventType) &&
 			(curEntryPtr->participantId == participantId) &&
 			(curEntryPtr->domainId == domainId) &&
 			(curEntryPtr->contextPtr == contextPtr) &&
 			(curEntryPtr->callback == eventCallback)){
-			break;
+			return curEntryPtr;
 		}
-		nodePtr = nodePtr->next_ptr;
 	}
+	return NULL;
+}
 
-	if (nodePtr != NULL) {
-		refCount = atomic_dec(&curEntryPtr->refCount);
-		if (refCount <= 0) {
-			EsifEventMgr_MoveEntryToGarbage(curEntryPtr);
-			esif_link_list_node_remove(listPtr, nodePtr);
-		}
+
+/*
+ * Publishes a copy of the observer list for the event type with one entry added or removed,
+ * and retires the list it replaces.
+ * Write lock should be held when called
+ */
+static eEsifError EsifEventMgr_ReplaceObserverList(
+	eEsifEventType eventType,
+	EventMgrEntryPtr addEntryPtr,
+	EventMgrEntryPtr removeEntryPtr
+	)
+{
+	eEsifError rc = ESIF_OK;
+	EventMgrObserverListPtr oldListPtr = g_EsifEventMgr.observerTable[eventType];
+	EventMgrObserverListPtr newListPtr = NULL;
+	UInt32 oldCount = (oldListPtr != NULL ? oldListPtr->count : 0);
+	UInt32 i = 0;
+
+	newListPtr = esif_ccb_malloc(sizeof(*newListPtr) + (oldCount * sizeof(newListPtr->entries[0])));
+	if (NULL == newListPtr) {
+		rc = ESIF_E_NO_MEMORY;
 		goto exit;
 	}
+
+	for (i = 0; i < oldCount; i++) {
+		if (oldListPtr->entries[i] != removeEntryPtr) {
+			newListPtr->entries[newListPtr->count++] = oldListPtr->entries[i];
+		}
+	}
+	if (addEntryPtr != NULL) {
+		newListPtr->entries[newListPtr->count++] = addEntryPtr;
+	}
+
+	if (oldListPtr != NULL) {
+		rc = esif_link_list_add_at_back(g_EsifEventMgr.retiredLists, (void *)oldListPtr);
+		if (ESIF_OK != rc) {
+			esif_ccb_free(newListPtr);
+			goto exit;
+		}
+		atomic_inc(&g_EsifEventMgr.garbageCount);
+	}
+
+	/* The new list must be complete before readers can see it */
+	esif_ccb_mb();
+	g_EsifEventMgr.observerTable[eventType] = newListPtr;
+	esif_ccb_mb();
 exit:
-	esif_ccb_write_unlock(&g_EsifEventMgr.listLock);
-	EsifEventMgr_DumpGarbage();
 	return rc;
 }
 
@@ -786,64 +897,71 @@ Bool EsifEventMgr_IsEventRegistered(
 	)
 {
 	Bool bRet = ESIF_FALSE;
-	EsifLinkListPtr listPtr = NULL;
-	EsifLinkListNodePtr nodePtr = NULL;
+	EventMgrObserverListPtr listPtr = NULL;
 	EventMgrEntryPtr entryPtr = NULL;
+	UInt32 i = 0;
 
-	esif_ccb_read_lock(&g_EsifEventMgr.listLock);
-	listPtr = g_EsifEventMgr.observerLists[eventType % NUM_EVENT_LISTS];
-	if (NULL == listPtr) {
+	if ((unsigned)eventType >= ESIF_UF_EVENT_OBSERVER_TABLE_SIZE) {
 		goto exit;
 	}
-	nodePtr = listPtr->head_ptr;
-	while(NULL != nodePtr) {
-		entryPtr = (EventMgrEntryPtr)nodePtr->data_ptr;
+
+	atomic_inc(&g_EsifEventMgr.activeReaders);
+
+	listPtr = g_EsifEventMgr.observerTable[eventType];
+	for (i = 0; (listPtr != NULL) && (i < listPtr->count); i++) {
+		entryPtr = listPtr->entries[i];
 		ESIF_ASSERT(entryPtr != NULL);
 
-		if((eventType == entryPtr->fpcEvent.esif_event) &&
-			(entryPtr->contextPtr == key) && 
+		if((entryPtr->contextPtr == key) && 
 			((entryPtr->participantId == participantId) || (entryPtr->participantId == EVENT_MGR_MATCH_ANY)) &&
 			((entryPtr->domainId == domainId) || (entryPtr->domainId == EVENT_MGR_MATCH_ANY) || (domainId == EVENT_MGR_DOMAIN_NA)) &&
-			(entryPtr->refCount > 0)) {
+			(atomic_read(&entryPtr->refCount) > 0)) {
 
 			bRet = ESIF_TRUE;
 			break;
 		}
-
-		nodePtr = nodePtr->next_ptr;
 	}
+
+	atomic_dec(&g_EsifEventMgr.activeReaders);
 exit:
-	esif_ccb_read_unlock(&g_EsifEventMgr.listLock);
 	return bRet;
 }
 
 
+UInt64 EsifEventMgr_GetQueueOverflows(void)
+{
+	return (UInt64)atomic_read(&g_EsifEventMgr.eventQueueOverflows);
+}
+
+
 eEsifError EsifEventMgr_Init(void)
 {
 	eEsifError rc = ESIF_OK;
-	UInt8 i;
+	UInt32 i;
 
 	ESIF_TRACE_ENTRY_INFO();
 
 	esif_ccb_lock_init(&g_EsifEventMgr.listLock);
+	esif_ccb_sem_init(&g_EsifEventMgr.eventQueueDoorbell);
 
-	for (i = 0; i < NUM_EVENT_LISTS; i++) {
-		g_EsifEventMgr.observerLists[i] = esif_link_list_create();
-		if (NULL == g_EsifEventMgr.observerLists[i]) {
-			rc = ESIF_E_NO_MEMORY;
-			goto exit;
-		}
-	}
-
-	g_EsifEventMgr.eventQueuePtr = esif_queue_create(ESIF_UF_EVENT_QUEUE_SIZE, ESIF_UF_EVENT_QUEUE_NAME, ESIF_UF_EVENT_QUEUE_TIMEOUT);
+	g_EsifEventMgr.eventQueue = esif_ccb_malloc(ESIF_UF_EVENT_QUEUE_SIZE * sizeof(*g_EsifEventMgr.eventQueue));
+	g_EsifEventMgr.retiredLists = esif_link_list_create();
 	g_EsifEventMgr.garbageList = esif_link_list_create();
 
-	if ((NULL == g_EsifEventMgr.eventQueuePtr) ||
+	if ((NULL == g_EsifEventMgr.eventQueue) ||
+		(NULL == g_EsifEventMgr.retiredLists) ||
 		(NULL == g_EsifEventMgr.garbageList)) {
 		rc = ESIF_E_NO_MEMORY;
 		goto exit;
 	}
 
+	/* Each slot is initially ready for the first pass over the ring */
+	for (i = 0; i < ESIF_UF_EVENT_QUEUE_SIZE; i++) {
+		g_EsifEventMgr.eventQueue[i].sequence = i;
+	}
+	g_EsifEventMgr.eventQueueHead = 0;
+	g_EsifEventMgr.eventQueueTail = 0;
+
 	rc = esif_ccb_thread_create(&g_EsifEventMgr.eventQueueThread, EsifEventMgr_EventQueueThread, NULL);
 	if (rc != ESIF_OK) {
 		goto exit;
@@ -859,35 +977,51 @@ exit:
 
 void EsifEventMgr_Exit(void)
 {
-	UInt8 i;
-	EsifLinkListPtr listPtr = NULL;
+	UInt32 i;
+	UInt32 j;
+	EventMgrObserverListPtr listPtr = NULL;
+	EsifEventQueueItemPtr queueEventPtr = NULL;
 
 	ESIF_TRACE_ENTRY_INFO();
 
-	/* Remove all listeners */
+	/* Remove all listeners; the event thread has already been stopped */
 	esif_ccb_write_lock(&g_EsifEventMgr.listLock);
 
-	for (i = 0; i < NUM_EVENT_LISTS; i++) {
-		listPtr = g_EsifEventMgr.observerLists[i];
-		esif_link_list_free_data_and_destroy(listPtr, EsifEventMgr_LLEntryDestroyCallback);
-		g_EsifEventMgr.observerLists[i] = NULL;
+	for (i = 0; i < ESIF_UF_EVENT_OBSERVER_TABLE_SIZE; i++) {
+		listPtr = g_EsifEventMgr.observerTable[i];
+		g_EsifEventMgr.observerTable[i] = NULL;
+		if (listPtr != NULL) {
+			esif_ccb_write_unlock(&g_EsifEventMgr.listLock);
+			for (j = 0; j < listPtr->count; j++) {
+				EsifEventMgr_DisableEvent(listPtr->entries[j]);
+				esif_ccb_free(listPtr->entries[j]);
+			}
+			esif_ccb_free(listPtr);
+			esif_ccb_write_lock(&g_EsifEventMgr.listLock);
+		}
 	}
 
 	esif_ccb_write_unlock(&g_EsifEventMgr.listLock);
 
-	/* Destroy the event thread */
-
-	/* Event thread should already be destroyed in the disable func. Destroy the queue */
-	esif_queue_destroy(g_EsifEventMgr.eventQueuePtr, EsifEventMgr_QueueDestroyCallback);
-	g_EsifEventMgr.eventQueuePtr = NULL;
-
+	/* Free any events that were never delivered, then the ring */
+	if (g_EsifEventMgr.eventQueue != NULL) {
+		while ((queueEventPtr = EsifEventMgr_PeekEvent()) != NULL) {
+			EsifEventMgr_ReleaseEvent(queueEventPtr);
+		}
+		esif_ccb_free(g_EsifEventMgr.eventQueue);
+		g_EsifEventMgr.eventQueue = NULL;
+	}
 
-	/* Destroy the garbage list */
+	/* Destroy the retired lists and the garbage list; nothing can be reading them now */
 	esif_ccb_write_lock(&g_EsifEventMgr.listLock);
-	esif_link_list_free_data_and_destroy(g_EsifEventMgr.garbageList, EsifEventMgr_LLEntryDestroyCallback);
+	esif_link_list_free_data_and_destroy(g_EsifEventMgr.retiredLists, NULL);
+	g_EsifEventMgr.retiredLists = NULL;
+	esif_link_list_free_data_and_destroy(g_EsifEventMgr.garbageList, NULL);
 	g_EsifEventMgr.garbageList = NULL;
+	g_EsifEventMgr.garbageCount = 0;
 	esif_ccb_write_unlock(&g_EsifEventMgr.listLock);
 
+	esif_ccb_sem_uninit(&g_EsifEventMgr.eventQueueDoorbell);
 	esif_ccb_lock_uninit(&g_EsifEventMgr.listLock);
 
 	ESIF_TRACE_EXIT_INFO();
@@ -899,83 +1033,31 @@ void EsifEventMgr_Disable(void)
 
 	/* Release and destroy the event thread */
 	g_EsifEventMgr.eventQueueExitFlag = ESIF_TRUE;
-	esif_queue_signal_event(g_EsifEventMgr.eventQueuePtr);
+	esif_ccb_sem_up(&g_EsifEventMgr.eventQueueDoorbell);
 	esif_ccb_thread_join(&g_EsifEventMgr.eventQueueThread);
 
 	ESIF_TRACE_EXIT_INFO();
 }
 
-/* Write lock should be held when called */
-static eEsifError EsifEventMgr_MoveEntryToGarbage(EventMgrEntryPtr entryPtr)
-{
-	eEsifError rc = ESIF_OK;
-	EsifLinkListPtr listPtr = g_EsifEventMgr.garbageList;
-
-	ESIF_ASSERT(NULL != entryPtr);
-
-	if (NULL == listPtr) {
-		rc = ESIF_E_UNSPECIFIED;
-		goto exit;
-	}
-
-	rc = esif_link_list_add_at_back(listPtr, (void *)entryPtr);
-exit:
-	return rc;
-}
-
 
-static eEsifError EsifEventMgr_DumpGarbage()
+/*
+ * Frees retired observer lists and released entries once no reader can still hold them.
+ * Readers that start after a list is retired can only see its replacement, so it is
+ * enough to find the active reader count at 0 at any point after retirement.
+ */
+static void EsifEventMgr_DumpGarbage()
 {
-	eEsifError rc = ESIF_OK;
-	EsifLinkListPtr listPtr = g_EsifEventMgr.garbageList;
-	EsifLinkListNodePtr nodePtr = NULL;
-	EventMgrEntryPtr entryPtr = NULL;
-
-	if (NULL == listPtr) {
-		rc = ESIF_E_UNSPECIFIED;
-		goto exit;
-	}
-
 	esif_ccb_write_lock(&g_EsifEventMgr.listLock);
-	nodePtr = listPtr->head_ptr;
-	while(nodePtr) {
-		entryPtr = nodePtr->data_ptr;
-
-		/* remove the node first so that it isn't considered active while we disable events */
-		esif_link_list_node_remove(listPtr, nodePtr); 
-		esif_ccb_write_unlock(&g_EsifEventMgr.listLock);
-		EsifEventMgr_DisableEvent(entryPtr);
-		esif_ccb_free(entryPtr);
-		esif_ccb_write_lock(&g_EsifEventMgr.listLock);
-
-		nodePtr = listPtr->head_ptr;
-	}
-	esif_ccb_write_unlock(&g_EsifEventMgr.listLock);
-
-exit:
-	return rc;
-}
-
-
-static void EsifEventMgr_QueueDestroyCallback(void *ctxPtr)
-{
-	EsifEventQueueItemPtr queueEventPtr = (EsifEventQueueItemPtr)ctxPtr;
 
-	if(queueEventPtr != NULL) {
-		esif_ccb_free(queueEventPtr->eventData.buf_ptr);
-		esif_ccb_free(queueEventPtr);
+	/* Events for released entries were already disabled when they were released */
+	if ((atomic_read(&g_EsifEventMgr.garbageCount) > 0) &&
+		(atomic_read(&g_EsifEventMgr.activeReaders) == 0)) {
+		esif_link_list_free_data(g_EsifEventMgr.retiredLists, NULL);
+		esif_link_list_free_data(g_EsifEventMgr.garbageList, NULL);
+		atomic_set(&g_EsifEventMgr.garbageCount, 0);
 	}
-}
-
 
-static void EsifEventMgr_LLEntryDestroyCallback(
-	void *dataPtr
-	)
-{
 	esif_ccb_write_unlock(&g_EsifEventMgr.listLock);
-	EsifEventMgr_DisableEvent((EventMgrEntryPtr)dataPtr);
-	esif_ccb_free(dataPtr);
-	esif_ccb_write_lock(&g_EsifEventMgr.listLock);
 }
 
 
@@ -56,10 +56,10 @@
 #include "esif.h"
 #include "esif_uf_fpc.h"
 #include "esif_link_list.h"
-#include "esif_queue.h"
+#include "esif_ccb_atomic.h"
+#include "esif_ccb_sem.h"
 #include "esif_ccb_thread.h"
 
-#define NUM_EVENT_LISTS 64
 #define EVENT_MGR_DOMAIN_D0 '0D'
 #define EVENT_MGR_DOMAIN_NA 'NA'
  /*
@@ -70,9 +70,11 @@
   */
 #define EVENT_MGR_MATCH_ANY 0xFF
 
-#define ESIF_UF_EVENT_QUEUE_SIZE 0xFFFFFFFF
-#define ESIF_UF_EVENT_QUEUE_NAME "UfQueue"
-#define ESIF_UF_EVENT_QUEUE_TIMEOUT 0 /* No timeout */
+#define ESIF_UF_EVENT_QUEUE_SIZE 1024 /* Preallocated event slots; must be a power of 2 */
+#define ESIF_UF_EVENT_INLINE_DATA_SIZE 64 /* Event data up to this size is stored in the slot itself */
+
+/* Observer lists are indexed directly by event type */
+#define ESIF_UF_EVENT_OBSERVER_TABLE_SIZE (MAX_ESIF_EVENT_ENUM_VALUE + 1)
 
 #ifdef ESIF_ATTR_OS_WINDOWS
 #include "win\dppe.h"
@@ -116,26 +118,47 @@ typedef struct EventMgrEntry_s {
 	atomic_t refCount;					/* Reference count */
 } EventMgrEntry, *EventMgrEntryPtr;
 
-typedef struct EsifEventMgr_s {
-	EsifLinkListPtr observerLists[NUM_EVENT_LISTS];
-	esif_ccb_lock_t listLock;
-
-	EsifLinkListPtr garbageList;
-
-	EsifQueuePtr eventQueuePtr;
-	esif_ccb_sem_t eventQueueDoorbell;
-	Bool eventQueueExitFlag;
-
-	esif_thread_t eventQueueThread;
-}EsifEventMgr, *EsifEventMgrPtr;
-
+/*
+ * Read-mostly list of the observers of one event type.  A published list is never
+ * modified; registration changes publish a new copy and retire the old one.
+ */
+typedef struct EventMgrObserverList_s {
+	UInt32 count;
+	EventMgrEntryPtr entries[1];	/* Variable length */
+} EventMgrObserverList, *EventMgrObserverListPtr;
+
+/*
+ * Preallocated event queue slot.  The sequence number tells producers and the
+ * consumer which pass over the ring the slot is ready for.
+ */
 typedef struct EsifEventQueueItem_s {
+	atomic_t sequence;
 	UInt8 participantId;
 	UInt16 domainId;
 	eEsifEventType eventType;
 	EsifData eventData;
+	UInt8 inlineData[ESIF_UF_EVENT_INLINE_DATA_SIZE];
 }EsifEventQueueItem, *EsifEventQueueItemPtr;
 
+typedef struct EsifEventMgr_s {
+	EventMgrObserverListPtr observerTable[ESIF_UF_EVENT_OBSERVER_TABLE_SIZE];
+	esif_ccb_lock_t listLock;	/* Serializes observer list updates; not taken to deliver events */
+	atomic_t activeReaders;		/* Threads currently walking observer lists */
+
+	EsifLinkListPtr retiredLists;	/* Replaced observer lists waiting for readers to leave */
+	EsifLinkListPtr garbageList;	/* Released entries waiting for readers to leave */
+	atomic_t garbageCount;
+
+	EsifEventQueueItemPtr eventQueue;	/* Bounded multi-producer/single-consumer ring */
+	atomic_t eventQueueHead;	/* Next slot claimed by a producer */
+	atomic_basetype eventQueueTail;	/* Next slot read by the event thread */
+	atomic_t eventQueueOverflows;	/* Events dropped because the ring was full */
+	esif_ccb_sem_t eventQueueDoorbell;
+	Bool eventQueueExitFlag;
+
+	esif_thread_t eventQueueThread;
+}EsifEventMgr, *EsifEventMgrPtr;
+
 
 #ifdef __cplusplus
 extern "C" {
@@ -184,6 +207,9 @@ eEsifError ESIF_CALLCONV EsifEventMgr_SignalEvent(
 	const EsifDataPtr eventData
 	);
 
+/* Number of events dropped because the event queue was full */
+UInt64 EsifEventMgr_GetQueueOverflows(void);
+
 Bool EsifEventMgr_IsEventRegistered(
 	eEsifEventType eventType,
 	void *key,
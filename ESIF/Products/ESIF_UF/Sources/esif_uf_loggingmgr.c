@@ -60,6 +60,10 @@ static eEsifError EsifLogMgr_ParseCmdSchedule(
 	EsifLoggingManagerPtr self,
 	EsifShellCmdPtr shell
 	);
+static eEsifError EsifLogMgr_ParseCmdConvert(
+	EsifLoggingManagerPtr self,
+	EsifShellCmdPtr shell
+	);
 static void *ESIF_CALLCONV EsifLogMgr_ParticipantLogWorkerThread(void *ptr);
 static void EsifLogMgr_ParticipantLogFire(
 	EsifLoggingManagerPtr self
@@ -105,6 +109,10 @@ static void EsifLogMgr_UpdateCapabilityData(
 	EsifCapabilityDataPtr capabilityPtr
 	);
 static eEsifError EsifLogMgr_OpenParticipantLogFile(char *fileName);
+static eEsifError EsifLogMgr_OpenParticipantBinLogFile(
+	EsifLoggingManagerPtr self,
+	char *fileName
+	);
 static eEsifError ESIF_CALLCONV EsifLogMgr_EventCallback(
 	void *contextPtr,
 	UInt8 participantId,
@@ -124,6 +132,33 @@ static eEsifError EsifLogMgr_ParticipantLogAddDataNode(
 	size_t dataLength,
 	EsifParticipantLogDataNodePtr dataNodePtr
 	);
+static void EsifLogMgr_ParticipantLogRefreshDataNode(EsifParticipantLogDataNodePtr dataNodePtr);
+static void EsifLogMgr_ParticipantLogAddNodeHeader(
+	char *logString,
+	size_t dataLength,
+	EsifParticipantLogDataNodePtr dataNodePtr,
+	UInt32 previousParticipantId,
+	UInt32 previousDomainId,
+	Bool isFirstNode
+	);
+static eEsifError EsifLogMgr_PrepareBinaryLogSchema(
+	EsifLoggingManagerPtr self,
+	Bool isSchemaRequired
+	);
+static Bool EsifLogMgr_AddBinaryLogData(
+	EsifLoggingManagerPtr self,
+	UInt32 columnIndex,
+	EsifParticipantLogDataNodePtr dataNodePtr
+	);
+static eEsifError EsifLogMgr_ConvertBinaryLog(
+	const char *binaryPath,
+	const char *textPath,
+	UInt32 *recordCountPtr
+	);
+static void EsifLogMgr_ConvertWriteLine(
+	FILE *fp,
+	char *text
+	);
 void EsifLogMgr_ParticipantLogStart(EsifLoggingManagerPtr self);
 void EsifLogMgr_ParticipantLogStop(EsifLoggingManagerPtr self);
 static void EsifLogMgr_UpdateStatusCapabilityData(EsifParticipantLogDataNodePtr dataNodePtr);
@@ -141,6 +176,7 @@ static eEsifError EsifLogMgr_ParticipantLogAddCapabilityData(
 	);
 static void EsifLogMgr_DataLogWrite(
 	EsifLoggingManagerPtr self,
+	esif_listenermask_t listenersMask,
 	char *logstring,
 	...
 	);
@@ -245,6 +281,16 @@ static eEsifError EsifLogMgr_Init(EsifLoggingManagerPtr self)
 	self->isDefaultFile = ESIF_TRUE;
 	self->listenersMask = 0;
 
+	EsifBinLog_Init(&self->binLog);
+	self->isDefaultBinFile = ESIF_TRUE;
+	self->binFileName[0] = '\0';
+	self->binColumns = NULL;
+	self->binColumnCount = 0;
+	self->binColumnCapacity = 0;
+	self->binRecord = NULL;
+	self->binRecordSize = 0;
+	self->binRecordCapacity = 0;
+
 	self->argc = 0;
 	self->commandInfo = NULL;
 	self->commandInfoCount = 0;
@@ -305,6 +351,9 @@ void EsifLogMgr_Exit()
 	if ((self->listenersMask & ESIF_LISTENER_LOGFILE_MASK) > 0) {
 		EsifLogFile_Close(ESIF_LOG_PARTICIPANT);
 	}
+	if ((self->listenersMask & ESIF_LISTENER_BINARYFILE_MASK) > 0) {
+		EsifBinLog_Close(&self->binLog);
+	}
 	/*
 	 * Uninitialize the manager structure
 	 */
@@ -485,6 +534,9 @@ eEsifError EsifLogMgr_ParseCmdParticipantLog(
 	else if (esif_ccb_stricmp(argv[PARTICITPANTLOG_CMD_INDEX], PARTICIPANTLOG_CMD_SCHEDULE_STR) == 0) {
 		rc = EsifLogMgr_ParseCmdSchedule(self, shell);
 	}
+	else if (esif_ccb_stricmp(argv[PARTICITPANTLOG_CMD_INDEX], PARTICIPANTLOG_CMD_CONVERT_STR) == 0) {
+		rc = EsifLogMgr_ParseCmdConvert(self, shell);
+	}
 	else {
 		esif_ccb_sprintf_concat(OUT_BUF_LEN, output, "Error:Invalid usage. See help for command usage.\n");
 		rc = ESIF_E_NOT_SUPPORTED;
@@ -601,6 +653,9 @@ static eEsifError EsifLogMgr_ParseCmdStop(
 	if ((self->listenersMask & ESIF_LISTENER_LOGFILE_MASK) > 0) {
 		EsifLogFile_Close(ESIF_LOG_PARTICIPANT);
 	}
+	if ((self->listenersMask & ESIF_LISTENER_BINARYFILE_MASK) > 0) {
+		EsifBinLog_Close(&self->binLog);
+	}
 
 	esif_ccb_strcat(output, "Stopped participant logging\n", OUT_BUF_LEN);
 
@@ -639,9 +694,11 @@ eEsifError EsifLogMgr_ParseCmdRoute(
 	//reset the listener mask if new route target is specified
 	self->listenersMask = 0;
 	self->isDefaultFile = ESIF_TRUE;
+	self->isDefaultBinFile = ESIF_TRUE;
 
-	//Close the old file
+	//Close the old files
 	EsifLogFile_Close(ESIF_LOG_PARTICIPANT);
+	EsifBinLog_Close(&self->binLog);
 
 	if (esif_ccb_stricmp(argv[i], ESIF_LISTENER_ALL_STR) == 0) {
 		self->listenersMask = ESIF_LISTENER_ALL_MASK;
@@ -684,6 +741,25 @@ eEsifError EsifLogMgr_ParseCmdRoute(
 					self->isDefaultFile = ESIF_FALSE;
 				}
 			}
+			else if (esif_ccb_stricmp(argv[i], ESIF_LISTENER_BINARYFILE_STR) == 0) {
+				self->listenersMask = self->listenersMask | ESIF_LISTENER_BINARYFILE_MASK;
+				i++;
+
+				// Check if file name is available as argument
+				if ((UInt32)argc <= i) {
+					self->isDefaultBinFile = ESIF_TRUE;
+					rc = EsifLogMgr_OpenParticipantBinLogFile(self, NULL);
+				}
+				else {
+					self->isDefaultBinFile = ESIF_FALSE;
+					rc = EsifLogMgr_OpenParticipantBinLogFile(self, argv[i]);
+				}
+				if (rc != ESIF_OK) {
+					esif_ccb_sprintf_concat(OUT_BUF_LEN, output, "Error: Unable to open/create binary log file. Exiting\n");
+					self->listenersMask = 0;
+					goto exit;
+				}
+			}
 			else {
 				esif_ccb_sprintf_concat(OUT_BUF_LEN, output, "Invalid participant log target specified. See help for command line usage\n");
 				rc = ESIF_E_NOT_SUPPORTED;
@@ -806,6 +882,205 @@ exit:
 	return rc;
 }
 
+static eEsifError EsifLogMgr_ParseCmdConvert(
+	EsifLoggingManagerPtr self,
+	EsifShellCmdPtr shell
+	)
+{
+	eEsifError rc = ESIF_OK;
+	int argc = 0;
+	char **argv = NULL;
+	char *output = NULL;
+	UInt32 i = PARTICITPANTLOG_SUB_CMD_INDEX;
+	char binaryPath[MAX_PATH] = { 0 };
+	char textName[MAX_PATH] = { 0 };
+	char textPath[MAX_PATH] = { 0 };
+	char *fileExtn = NULL;
+	UInt32 recordCount = 0;
+
+	ESIF_ASSERT(self != NULL);
+	ESIF_ASSERT(shell != NULL);
+	ESIF_ASSERT(shell->outbuf != NULL);
+
+	UNREFERENCED_PARAMETER(self);
+
+	argc = shell->argc;
+	argv = shell->argv;
+	output = shell->outbuf;
+
+	if ((UInt32)argc <= i) {
+		esif_ccb_sprintf_concat(OUT_BUF_LEN, output, "Error: No binary log file specified. See help for command usage.\n");
+		rc = ESIF_E_INVALID_ARGUMENT_COUNT;
+		goto exit;
+	}
+	EsifLogFile_GetFullPath(binaryPath, sizeof(binaryPath), argv[i]);
+	i++;
+
+	if ((UInt32)argc > i) {
+		fileExtn = esif_ccb_strchr(argv[i], '.');
+		esif_ccb_sprintf(sizeof(textName), textName, (fileExtn == NULL) ? "%s.csv" : "%s", argv[i]);
+	}
+	else {
+		// Default to the binary log name with the extension used for text logs
+		esif_ccb_strcpy(textName, argv[i - 1], sizeof(textName));
+		fileExtn = strrchr(textName, '.');
+		if (fileExtn != NULL) {
+			*fileExtn = '\0';
+		}
+		esif_ccb_strcat(textName, ".csv", sizeof(textName));
+	}
+	EsifLogFile_GetFullPath(textPath, sizeof(textPath), textName);
+
+	if (esif_ccb_strcmp(binaryPath, textPath) == 0) {
+		esif_ccb_sprintf_concat(OUT_BUF_LEN, output, "Error: Output file would overwrite the binary log\n");
+		rc = ESIF_E_NOT_SUPPORTED;
+		goto exit;
+	}
+
+	rc = EsifLogMgr_ConvertBinaryLog(binaryPath, textPath, &recordCount);
+	if (rc != ESIF_OK) {
+		esif_ccb_sprintf_concat(OUT_BUF_LEN, output, "Error: Unable to convert %s : %s(%d)\n", binaryPath, esif_rc_str(rc), rc);
+		goto exit;
+	}
+	esif_ccb_sprintf_concat(OUT_BUF_LEN, output, "Converted %u records from %s to %s\n", recordCount, binaryPath, textPath);
+
+exit:
+	return rc;
+}
+
+/* Writes a binary participant log out in the same format the text log file listener uses */
+static eEsifError EsifLogMgr_ConvertBinaryLog(
+	const char *binaryPath,
+	const char *textPath,
+	UInt32 *recordCountPtr
+	)
+{
+	eEsifError rc = ESIF_OK;
+	EsifBinLog reader;
+	EsifBinLogChunkType chunkType = ESIF_BINLOG_CHUNK_TEXT;
+	EsifBinLogRecordHeader recordHeader = { 0 };
+	EsifBinLogColumnPtr columnPtr = NULL;
+	EsifCapabilityData capability = { 0 };
+	const char *text = NULL;
+	const UInt8 *recordPtr = NULL;
+	FILE *fp = NULL;
+	char *line = NULL;
+	size_t dataLength = MAX_LOG_DATA;
+	time_t sampleTime = 0;
+	struct tm time = { 0 };
+	UInt32 previousParticipantId = 0;
+	UInt32 previousDomainId = 0;
+	UInt32 record = 0;
+	UInt32 column = 0;
+
+	ESIF_ASSERT(binaryPath != NULL);
+	ESIF_ASSERT(textPath != NULL);
+	ESIF_ASSERT(recordCountPtr != NULL);
+
+	*recordCountPtr = 0;
+	EsifBinLog_Init(&reader);
+
+	line = (char *)esif_ccb_malloc(dataLength);
+	if (line == NULL) {
+		rc = ESIF_E_NO_MEMORY;
+		goto exit;
+	}
+
+	rc = EsifBinLog_OpenReader(&reader, binaryPath);
+	if (rc != ESIF_OK) {
+		goto exit;
+	}
+
+	fp = esif_ccb_fopen((esif_string)textPath, "w", NULL);
+	if (fp == NULL) {
+		rc = ESIF_E_IO_OPEN_FAILED;
+		goto exit;
+	}
+
+	while ((rc = EsifBinLog_ReadChunk(&reader, &chunkType, &text)) == ESIF_OK) {
+		switch (chunkType) {
+		case ESIF_BINLOG_CHUNK_SCHEMA:
+			esif_ccb_sprintf(dataLength, line, "%s \n", reader.headerText);
+			EsifLogMgr_ConvertWriteLine(fp, line);
+			break;
+		case ESIF_BINLOG_CHUNK_BLOCK:
+			for (record = 0; record < reader.recordCount; record++) {
+				recordPtr = reader.records + ((size_t)record * reader.recordSize);
+				esif_ccb_memcpy(&recordHeader, recordPtr, sizeof(recordHeader));
+
+				line[0] = '\0';
+				sampleTime = (time_t)recordHeader.time;
+				if (esif_ccb_localtime(&time, &sampleTime) == 0) {
+					esif_ccb_sprintf(dataLength, line, " %04d-%02d-%02d, %02d:%02d:%02d, %llu,",
+						time.tm_year + TIME_BASE_YEAR, time.tm_mon + 1, time.tm_mday, time.tm_hour, time.tm_min, time.tm_sec, recordHeader.msec);
+				}
+
+				previousParticipantId = (UInt32)-1;
+				previousDomainId = (UInt32)-1;
+				for (column = 0; column < reader.columnCount; column++) {
+					columnPtr = &reader.columns[column];
+					if (previousParticipantId != columnPtr->participantId) {
+						esif_ccb_sprintf_concat(dataLength, line, " %d, %s, %d,",
+							columnPtr->participantId,
+							(columnPtr->participantName[0] != '\0') ? columnPtr->participantName : "UNAVAIL",
+							columnPtr->domainIndex);
+					}
+					else if (previousDomainId != columnPtr->domainId) {
+						esif_ccb_sprintf_concat(dataLength, line, " %d,", columnPtr->domainIndex);
+					}
+
+					esif_ccb_memset(&capability, 0, sizeof(capability));
+					capability.type = columnPtr->capabilityType;
+					esif_ccb_memcpy(&capability.data, recordPtr + columnPtr->dataOffset,
+						esif_ccb_min(columnPtr->dataSize, sizeof(capability.data)));
+					EsifLogMgr_ParticipantLogAddCapabilityData(line, dataLength, &capability);
+
+					previousParticipantId = columnPtr->participantId;
+					previousDomainId = columnPtr->domainId;
+				}
+				esif_ccb_strcat(line, " \n", dataLength);
+				EsifLogMgr_ConvertWriteLine(fp, line);
+			}
+			*recordCountPtr += reader.recordCount;
+			break;
+		default:
+			esif_ccb_strcpy(line, text, dataLength);
+			EsifLogMgr_ConvertWriteLine(fp, line);
+			break;
+		}
+	}
+	if (rc == ESIF_E_ITERATION_DONE) {
+		rc = ESIF_OK;
+	}
+exit:
+	if (fp != NULL) {
+		esif_ccb_fclose(fp);
+	}
+	EsifBinLog_Uninit(&reader);
+	esif_ccb_free(line);
+	return rc;
+}
+
+/* Applies the same newline handling EsifLogFile_WriteArgsAppend does for the participant log file */
+static void EsifLogMgr_ConvertWriteLine(
+	FILE *fp,
+	char *text
+	)
+{
+	char *ch = NULL;
+	size_t length = esif_ccb_strlen(text, MAX_LOG_DATA);
+
+	for (ch = text; ch[0] && ch[1]; ch++) {
+		if (*ch == '\n') {
+			*ch = '\t';
+		}
+	}
+	esif_ccb_fwrite(text, sizeof(char), length, fp);
+	if ((length > 1) && (text[length - 1] != ' ')) {
+		esif_ccb_fwrite(" ", sizeof(char), 1, fp);
+	}
+}
+
 static eEsifError EsifLogMgr_GetInputParameters(
 	EsifLoggingManagerPtr self,
 	EsifShellCmdPtr shell,
@@ -1215,8 +1490,9 @@ static void EsifLogMgr_CleanupLoggingContext(EsifLoggingManagerPtr self)
 		self->listenersMask = 0;
 	}
 
-	//Close the old file
+	//Close the old files
 	EsifLogFile_Close(ESIF_LOG_PARTICIPANT);
+	EsifBinLog_Close(&self->binLog);
 
 	//Free the input argv
 	EsifLogMgr_DestroyArgv(self);
@@ -1603,9 +1879,9 @@ static void EsifLogMgr_ScheduledStartThread(const void *contextPtr)
 
 exit:
 	if (rc != ESIF_OK) {
-		EsifLogMgr_DataLogWrite(self, "\nError code : %s(%d)", esif_rc_str(rc), rc);		
-		EsifLogMgr_DataLogWrite(self, "\nStopped participant logging");
-		EsifLogMgr_DataLogWrite(self, "\n");
+		EsifLogMgr_DataLogWrite(self, self->listenersMask, "\nError code : %s(%d)", esif_rc_str(rc), rc);		
+		EsifLogMgr_DataLogWrite(self, self->listenersMask, "\nStopped participant logging");
+		EsifLogMgr_DataLogWrite(self, self->listenersMask, "\n");
 		EsifLogMgr_ParticipantLogStop(self);
 	}
 }
@@ -1639,6 +1915,13 @@ static eEsifError EsifLogMgr_OpenRouteTargetLogFileIfRequired(EsifLoggingManager
 			}
 		}
 	}
+
+	if ((self->listenersMask & ESIF_LISTENER_BINARYFILE_MASK) == ESIF_LISTENER_BINARYFILE_MASK) {
+		rc = EsifLogMgr_OpenParticipantBinLogFile(self, (self->isDefaultBinFile == ESIF_FALSE) ? self->binFileName : NULL);
+		if (rc != ESIF_OK) {
+			goto exit;
+		}
+	}
 exit:
 	return rc;
 }
@@ -1981,9 +2264,12 @@ static void EsifLogMgr_ParticipantLogFire(
 	UInt32 currentDomainId = (UInt32)-1;
 	UInt8 domainIndex = 0;
 	size_t dataLength = MAX_LOG_DATA;
-	EsifString partName = "UNK";
 	EsifUpPtr upPtr = NULL;
 	Bool printTimeInfo = ESIF_TRUE;
+	esif_listenermask_t textListenersMask = 0;
+	Bool isBinaryRecordValid = ESIF_FALSE;
+	UInt32 columnIndex = 0;
+	EsifBinLogRecordHeader recordHeader = { 0 };
 
 	ESIF_ASSERT(self != NULL);
 	ESIF_ASSERT(self->logData != NULL);
@@ -1993,67 +2279,73 @@ static void EsifLogMgr_ParticipantLogFire(
 		goto exit;
 	}
 
+	textListenersMask = self->listenersMask & ESIF_LISTENER_TEXT_MASK;
+
 	/*
 	 * Loop through the complete list
 	 */
 	esif_ccb_read_lock(&self->participantLogData.listLock);
+
+	// Binary records skip the header pass like the text listeners do; the schema carries the header instead
+	if (((self->listenersMask & ESIF_LISTENER_BINARYFILE_MASK) > 0) &&
+		EsifBinLog_IsOpen(&self->binLog) &&
+		(EsifLogMgr_PrepareBinaryLogSchema(self, self->isLogHeader) == ESIF_OK)) {
+		isBinaryRecordValid = (self->isLogHeader == ESIF_FALSE);
+	}
+
 	nodePtr = self->participantLogData.list->head_ptr;
 	while (nodePtr != NULL) {
 		curEntryPtr = (EsifParticipantLogDataNodePtr)nodePtr->data_ptr;
 		if (curEntryPtr != NULL) {
 			if (curEntryPtr->state >= ESIF_DATA_INITIALIZED) {
 				if (self->isLogHeader != ESIF_FALSE) {
-					if (printTimeInfo != ESIF_FALSE) {
-						esif_ccb_sprintf(dataLength, self->logData, " Date, Time, Server Msec,");
+					if (textListenersMask > 0) {
+						EsifLogMgr_ParticipantLogAddNodeHeader(self->logData,
+							dataLength,
+							curEntryPtr,
+							currentParticipantId,
+							currentDomainId,
+							printTimeInfo);
 						printTimeInfo = ESIF_FALSE;
 					}
-					if (currentParticipantId != curEntryPtr->participantId) {
-						esif_ccb_sprintf_concat(dataLength, self->logData, " Participant Index, Participant Name, Domain Id,");
-					}
-					else if ((currentParticipantId == curEntryPtr->participantId) &&
-						(currentDomainId != curEntryPtr->domainId)) {
-						esif_ccb_sprintf_concat(dataLength, self->logData, " Domain Id,");
-					}
-
-					partName = "UNK";
-					upPtr = EsifUpPm_GetAvailableParticipantByInstance((UInt8)curEntryPtr->participantId);
-					if (upPtr != NULL) {
-						partName = EsifUp_GetName(upPtr);
-						EsifUp_PutRef(upPtr);
-					}
-					EsifDomainIdToIndex((UInt16)curEntryPtr->domainId, &domainIndex);
-					esif_ccb_read_lock(&curEntryPtr->capabilityDataLock);
-					EsifLogMgr_ParticipantLogAddHeaderData(self->logData, dataLength, &curEntryPtr->capabilityData, partName, domainIndex);
-					esif_ccb_read_unlock(&curEntryPtr->capabilityDataLock);
 				}
 				else
 				{
-					if (printTimeInfo != ESIF_FALSE) {
-						esif_ccb_system_time(&msec);
-						if (esif_ccb_localtime(&time, &now) == 0) {
-							esif_ccb_sprintf(dataLength, self->logData, " %04d-%02d-%02d, %02d:%02d:%02d, %llu,",
-								time.tm_year + TIME_BASE_YEAR, time.tm_mon + 1, time.tm_mday, time.tm_hour, time.tm_min, time.tm_sec, msec);
+					EsifLogMgr_ParticipantLogRefreshDataNode(curEntryPtr);
+
+					if (textListenersMask > 0) {
+						if (printTimeInfo != ESIF_FALSE) {
+							esif_ccb_system_time(&msec);
+							if (esif_ccb_localtime(&time, &now) == 0) {
+								esif_ccb_sprintf(dataLength, self->logData, " %04d-%02d-%02d, %02d:%02d:%02d, %llu,",
+									time.tm_year + TIME_BASE_YEAR, time.tm_mon + 1, time.tm_mday, time.tm_hour, time.tm_min, time.tm_sec, msec);
+							}
+							printTimeInfo = ESIF_FALSE;
 						}
-						printTimeInfo = ESIF_FALSE;
-					}
-					/*
-					 * Print the participant Name and Index for every new participant Id
-					 */
-					EsifDomainIdToIndex((UInt16)curEntryPtr->domainId, &domainIndex);
-					if (currentParticipantId != curEntryPtr->participantId) {
-						upPtr = EsifUpPm_GetAvailableParticipantByInstance((UInt8)curEntryPtr->participantId);
-						if (upPtr != NULL) {
-							esif_ccb_sprintf_concat(dataLength, self->logData, " %d, %s, %d,", curEntryPtr->participantId, EsifUp_GetName(upPtr), domainIndex);
-							EsifUp_PutRef(upPtr);
-						} else {
-							esif_ccb_sprintf_concat(dataLength, self->logData, " %d, UNAVAIL, %d,", curEntryPtr->participantId, domainIndex);
+						/*
+						 * Print the participant Name and Index for every new participant Id
+						 */
+						EsifDomainIdToIndex((UInt16)curEntryPtr->domainId, &domainIndex);
+						if (currentParticipantId != curEntryPtr->participantId) {
+							upPtr = EsifUpPm_GetAvailableParticipantByInstance((UInt8)curEntryPtr->participantId);
+							if (upPtr != NULL) {
+								esif_ccb_sprintf_concat(dataLength, self->logData, " %d, %s, %d,", curEntryPtr->participantId, EsifUp_GetName(upPtr), domainIndex);
+								EsifUp_PutRef(upPtr);
+							} else {
+								esif_ccb_sprintf_concat(dataLength, self->logData, " %d, UNAVAIL, %d,", curEntryPtr->participantId, domainIndex);
+							}
 						}
+						else if ((currentParticipantId == curEntryPtr->participantId) &&
+							(currentDomainId != curEntryPtr->domainId)) {
+							esif_ccb_sprintf_concat(dataLength, self->logData, " %d,", domainIndex);
+						}
+						EsifLogMgr_ParticipantLogAddDataNode(self->logData, dataLength, curEntryPtr);
 					}
-					else if ((currentParticipantId == curEntryPtr->participantId) &&
-						(currentDomainId != curEntryPtr->domainId)) {
-						esif_ccb_sprintf_concat(dataLength, self->logData, " %d,", domainIndex);
+
+					if (isBinaryRecordValid != ESIF_FALSE) {
+						isBinaryRecordValid = EsifLogMgr_AddBinaryLogData(self, columnIndex, curEntryPtr);
+						columnIndex++;
 					}
-					EsifLogMgr_ParticipantLogAddDataNode(self->logData, dataLength, curEntryPtr);
 				}
 				currentParticipantId = curEntryPtr->participantId;
 				currentDomainId = curEntryPtr->domainId;
@@ -2065,12 +2357,204 @@ static void EsifLogMgr_ParticipantLogFire(
 
 	//Print the output only if PrintTimeInfo Flag has been switched off
 	if (printTimeInfo == ESIF_FALSE) {
-		EsifLogMgr_DataLogWrite(self, "%s \n", self->logData);
+		EsifLogMgr_DataLogWrite(self, textListenersMask, "%s \n", self->logData);
+	}
+
+	// A node initialized while sampling leaves the record short; the next interval writes a new schema
+	if ((isBinaryRecordValid != ESIF_FALSE) && (columnIndex == self->binColumnCount)) {
+		if (msec == 0) {
+			esif_ccb_system_time(&msec);
+		}
+		recordHeader.time = (Int64)now;
+		recordHeader.msec = (UInt64)msec;
+		esif_ccb_memcpy(self->binRecord, &recordHeader, sizeof(recordHeader));
+		EsifBinLog_WriteRecord(&self->binLog, self->binRecord, self->binRecordSize);
 	}
 exit:
 	return;
 }
 
+static void EsifLogMgr_ParticipantLogAddNodeHeader(
+	char *logString,
+	size_t dataLength,
+	EsifParticipantLogDataNodePtr dataNodePtr,
+	UInt32 previousParticipantId,
+	UInt32 previousDomainId,
+	Bool isFirstNode
+	)
+{
+	EsifString partName = "UNK";
+	EsifUpPtr upPtr = NULL;
+	UInt8 domainIndex = 0;
+
+	ESIF_ASSERT(logString != NULL);
+	ESIF_ASSERT(dataNodePtr != NULL);
+
+	if (isFirstNode != ESIF_FALSE) {
+		esif_ccb_sprintf(dataLength, logString, " Date, Time, Server Msec,");
+	}
+	if (previousParticipantId != dataNodePtr->participantId) {
+		esif_ccb_sprintf_concat(dataLength, logString, " Participant Index, Participant Name, Domain Id,");
+	}
+	else if ((previousParticipantId == dataNodePtr->participantId) &&
+		(previousDomainId != dataNodePtr->domainId)) {
+		esif_ccb_sprintf_concat(dataLength, logString, " Domain Id,");
+	}
+
+	upPtr = EsifUpPm_GetAvailableParticipantByInstance((UInt8)dataNodePtr->participantId);
+	if (upPtr != NULL) {
+		partName = EsifUp_GetName(upPtr);
+	}
+	EsifDomainIdToIndex((UInt16)dataNodePtr->domainId, &domainIndex);
+	esif_ccb_read_lock(&dataNodePtr->capabilityDataLock);
+	EsifLogMgr_ParticipantLogAddHeaderData(logString, dataLength, &dataNodePtr->capabilityData, partName, domainIndex);
+	esif_ccb_read_unlock(&dataNodePtr->capabilityDataLock);
+	if (upPtr != NULL) {
+		EsifUp_PutRef(upPtr);
+	}
+}
+
+/*
+ * Lays out one record column per initialized node and writes a new schema when the layout changed or a header is
+ * required.  The caller holds the participant data list lock.
+ */
+static eEsifError EsifLogMgr_PrepareBinaryLogSchema(
+	EsifLoggingManagerPtr self,
+	Bool isSchemaRequired
+	)
+{
+	eEsifError rc = ESIF_OK;
+	EsifLinkListNodePtr nodePtr = NULL;
+	EsifParticipantLogDataNodePtr curEntryPtr = NULL;
+	EsifBinLogColumnPtr columnPtr = NULL;
+	UInt32 columnCount = 0;
+	UInt32 recordSize = sizeof(EsifBinLogRecordHeader);
+	UInt32 previousParticipantId = (UInt32)-1;
+	UInt32 previousDomainId = (UInt32)-1;
+	EsifUpPtr upPtr = NULL;
+	void *newPtr = NULL;
+
+	ESIF_ASSERT(self != NULL);
+
+	for (nodePtr = self->participantLogData.list->head_ptr; nodePtr != NULL; nodePtr = nodePtr->next_ptr) {
+		curEntryPtr = (EsifParticipantLogDataNodePtr)nodePtr->data_ptr;
+		if ((curEntryPtr != NULL) && (curEntryPtr->state >= ESIF_DATA_INITIALIZED)) {
+			columnCount++;
+		}
+	}
+	if (columnCount == 0) {
+		rc = ESIF_E_NOT_SUPPORTED;
+		goto exit;
+	}
+
+	if (columnCount > self->binColumnCapacity) {
+		newPtr = esif_ccb_realloc(self->binColumns, columnCount * sizeof(*self->binColumns));
+		if (newPtr == NULL) {
+			rc = ESIF_E_NO_MEMORY;
+			goto exit;
+		}
+		self->binColumns = (EsifBinLogColumnPtr)newPtr;
+		self->binColumnCapacity = columnCount;
+	}
+
+	columnCount = 0;
+	for (nodePtr = self->participantLogData.list->head_ptr; nodePtr != NULL; nodePtr = nodePtr->next_ptr) {
+		curEntryPtr = (EsifParticipantLogDataNodePtr)nodePtr->data_ptr;
+		if ((curEntryPtr == NULL) || (curEntryPtr->state < ESIF_DATA_INITIALIZED) ||
+			(columnCount >= self->binColumnCapacity)) {
+			continue;
+		}
+		columnPtr = &self->binColumns[columnCount++];
+		esif_ccb_memset(columnPtr, 0, sizeof(*columnPtr));
+		columnPtr->participantId = curEntryPtr->participantId;
+		columnPtr->domainId = curEntryPtr->domainId;
+		columnPtr->capabilityType = curEntryPtr->capabilityData.type;
+		columnPtr->dataOffset = recordSize;
+		columnPtr->dataSize = EsifBinLog_GetCapabilityDataSize(curEntryPtr->capabilityData.type);
+		EsifDomainIdToIndex((UInt16)curEntryPtr->domainId, &columnPtr->domainIndex);
+		recordSize += columnPtr->dataSize;
+	}
+	self->binColumnCount = columnCount;
+
+	if (recordSize > self->binRecordCapacity) {
+		newPtr = esif_ccb_realloc(self->binRecord, recordSize);
+		if (newPtr == NULL) {
+			rc = ESIF_E_NO_MEMORY;
+			goto exit;
+		}
+		self->binRecord = (UInt8 *)newPtr;
+		self->binRecordCapacity = recordSize;
+	}
+	self->binRecordSize = recordSize;
+	esif_ccb_memset(self->binRecord, 0, recordSize);
+
+	if ((isSchemaRequired == ESIF_FALSE) &&
+		EsifBinLog_IsSchemaCurrent(&self->binLog, self->binColumns, self->binColumnCount)) {
+		goto exit;
+	}
+
+	// Names and the header text are only needed when the schema is written
+	columnCount = 0;
+	for (nodePtr = self->participantLogData.list->head_ptr; nodePtr != NULL; nodePtr = nodePtr->next_ptr) {
+		curEntryPtr = (EsifParticipantLogDataNodePtr)nodePtr->data_ptr;
+		if ((curEntryPtr == NULL) || (curEntryPtr->state < ESIF_DATA_INITIALIZED) ||
+			(columnCount >= self->binColumnCount)) {
+			continue;
+		}
+		columnPtr = &self->binColumns[columnCount];
+		upPtr = EsifUpPm_GetAvailableParticipantByInstance((UInt8)curEntryPtr->participantId);
+		if (upPtr != NULL) {
+			esif_ccb_strcpy(columnPtr->participantName, EsifUp_GetName(upPtr), sizeof(columnPtr->participantName));
+			EsifUp_PutRef(upPtr);
+		}
+		EsifLogMgr_ParticipantLogAddNodeHeader(self->logData,
+			MAX_LOG_DATA,
+			curEntryPtr,
+			previousParticipantId,
+			previousDomainId,
+			(columnCount == 0));
+		previousParticipantId = curEntryPtr->participantId;
+		previousDomainId = curEntryPtr->domainId;
+		columnCount++;
+	}
+
+	rc = EsifBinLog_WriteSchema(&self->binLog, self->binColumns, self->binColumnCount, self->logData);
+exit:
+	return rc;
+}
+
+/* Copies the capability data of a node into its record column; returns false if the node does not match it */
+static Bool EsifLogMgr_AddBinaryLogData(
+	EsifLoggingManagerPtr self,
+	UInt32 columnIndex,
+	EsifParticipantLogDataNodePtr dataNodePtr
+	)
+{
+	Bool isAdded = ESIF_FALSE;
+	EsifBinLogColumnPtr columnPtr = NULL;
+
+	ESIF_ASSERT(self != NULL);
+	ESIF_ASSERT(dataNodePtr != NULL);
+
+	if (columnIndex >= self->binColumnCount) {
+		goto exit;
+	}
+
+	columnPtr = &self->binColumns[columnIndex];
+	if ((columnPtr->participantId != dataNodePtr->participantId) ||
+		(columnPtr->domainId != dataNodePtr->domainId) ||
+		(columnPtr->capabilityType != dataNodePtr->capabilityData.type)) {
+		goto exit;
+	}
+
+	esif_ccb_read_lock(&dataNodePtr->capabilityDataLock);
+	esif_ccb_memcpy(self->binRecord + columnPtr->dataOffset, &dataNodePtr->capabilityData.data, columnPtr->dataSize);
+	esif_ccb_read_unlock(&dataNodePtr->capabilityDataLock);
+	isAdded = ESIF_TRUE;
+exit:
+	return isAdded;
+}
+
 static eEsifError EsifLogMgr_ParticipantLogAddHeaderData(
 	char *logString,
 	size_t dataLength,
@@ -2192,12 +2676,6 @@ static eEsifError EsifLogMgr_ParticipantLogAddDataNode(
 	ESIF_ASSERT(logString != NULL);
 	ESIF_ASSERT(dataNodePtr != NULL);
 
-	if (EsifLogMgr_IsStatusCapable(dataNodePtr->capabilityData.type)) {
-		esif_ccb_write_lock(&dataNodePtr->capabilityDataLock);
-		EsifLogMgr_UpdateStatusCapabilityData(dataNodePtr);
-		esif_ccb_write_unlock(&dataNodePtr->capabilityDataLock);
-	}
-
 	esif_ccb_read_lock(&dataNodePtr->capabilityDataLock);
 	EsifLogMgr_ParticipantLogAddCapabilityData(logString, dataLength, &dataNodePtr->capabilityData);
 	esif_ccb_read_unlock(&dataNodePtr->capabilityDataLock);
@@ -2205,6 +2683,18 @@ static eEsifError EsifLogMgr_ParticipantLogAddDataNode(
 	return rc;
 }
 
+/* Samples status capabilities once per interval, whichever listeners the data goes to */
+static void EsifLogMgr_ParticipantLogRefreshDataNode(EsifParticipantLogDataNodePtr dataNodePtr)
+{
+	ESIF_ASSERT(dataNodePtr != NULL);
+
+	if (EsifLogMgr_IsStatusCapable(dataNodePtr->capabilityData.type)) {
+		esif_ccb_write_lock(&dataNodePtr->capabilityDataLock);
+		EsifLogMgr_UpdateStatusCapabilityData(dataNodePtr);
+		esif_ccb_write_unlock(&dataNodePtr->capabilityDataLock);
+	}
+}
+
 static eEsifError EsifLogMgr_ParticipantLogAddCapabilityData(
 	char *logString,
 	size_t dataLength,
@@ -2419,6 +2909,7 @@ static void EsifLogMgr_UpdateStatusCapabilityData(EsifParticipantLogDataNodePtr
 
 static void EsifLogMgr_DataLogWrite(
 	EsifLoggingManagerPtr self,
+	esif_listenermask_t listenersMask,
 	char *logstring,
 	...
 	)
@@ -2433,40 +2924,23 @@ static void EsifLogMgr_DataLogWrite(
 		goto exit;
 	}
 
-	if (self->listenersMask == 0) {
+	if (listenersMask == 0) {
 		goto exit;
 	}
 
-	if ((self->listenersMask & ESIF_LISTENER_CONSOLE_MASK) > 0) {
+	if ((listenersMask & ESIF_LISTENER_CONSOLE_MASK) > 0) {
 		va_start(args, logstring);
 		rc += EsifConsole_WriteConsole(logstring, args);
 		va_end(args);
 	}
-	if ((self->listenersMask & ESIF_LISTENER_LOGFILE_MASK) > 0) {
+	if ((listenersMask & ESIF_LISTENER_LOGFILE_MASK) > 0) {
 		va_start(args, logstring);
 		rc += EsifLogFile_WriteArgsAppend(ESIF_LOG_PARTICIPANT, " ", logstring, args);
 		va_end(args);
 	}
-	if ((self->listenersMask & ESIF_LISTENER_DEBUGGER_MASK) > 0) {
-		size_t  msglen = 0;
-		char *buffer = 0;
-
-		va_start(args, logstring);
-		msglen = esif_ccb_vscprintf(logstring, args) + 1;
-		va_end(args);
-
-		buffer = (char *)esif_ccb_malloc(msglen);
 
-		if (NULL != buffer) {
-			va_start(args, logstring);
-			rc += esif_ccb_vsprintf(msglen, buffer, logstring, args);
-			va_end(args);
-
-			EsifLogMgr_LogToDebugger(buffer);
-			esif_ccb_free(buffer);
-		}
-	}
-	if ((self->listenersMask & ESIF_LISTENER_EVENTLOG_MASK) > 0) {
+	// Format once for all of the listeners that take a complete message
+	if ((listenersMask & (ESIF_LISTENER_DEBUGGER_MASK | ESIF_LISTENER_EVENTLOG_MASK | ESIF_LISTENER_BINARYFILE_MASK)) > 0) {
 		size_t  msglen = 0;
 		char *buffer = 0;
 
@@ -2481,7 +2955,15 @@ static void EsifLogMgr_DataLogWrite(
 			rc += esif_ccb_vsprintf(msglen, buffer, logstring, args);
 			va_end(args);
 
-			EsifLogMgr_LogToEvent(buffer);
+			if ((listenersMask & ESIF_LISTENER_DEBUGGER_MASK) > 0) {
+				EsifLogMgr_LogToDebugger(buffer);
+			}
+			if ((listenersMask & ESIF_LISTENER_EVENTLOG_MASK) > 0) {
+				EsifLogMgr_LogToEvent(buffer);
+			}
+			if ((listenersMask & ESIF_LISTENER_BINARYFILE_MASK) > 0) {
+				EsifBinLog_WriteText(&self->binLog, buffer);
+			}
 			esif_ccb_free(buffer);
 		}
 	}
@@ -2505,6 +2987,16 @@ static eEsifError EsifLogMgr_Uninit(EsifLoggingManagerPtr self)
 		self->logData = NULL;
 	}
 
+	EsifBinLog_Uninit(&self->binLog);
+	esif_ccb_free(self->binColumns);
+	self->binColumns = NULL;
+	self->binColumnCount = 0;
+	self->binColumnCapacity = 0;
+	esif_ccb_free(self->binRecord);
+	self->binRecord = NULL;
+	self->binRecordSize = 0;
+	self->binRecordCapacity = 0;
+
 	//Free the input argv
 	EsifLogMgr_DestroyArgv(self);
 
@@ -2642,6 +3134,45 @@ exit:
 	return rc;
 }
 
+static eEsifError EsifLogMgr_OpenParticipantBinLogFile(
+	EsifLoggingManagerPtr self,
+	char *fileName
+	)
+{
+	eEsifError rc = ESIF_OK;
+	char logname[MAX_PATH] = { 0 };
+	char fullpath[MAX_PATH] = { 0 };
+
+	ESIF_ASSERT(self != NULL);
+
+	if (fileName == NULL) {
+		time_t now = time(NULL);
+		struct tm time = { 0 };
+		if (esif_ccb_localtime(&time, &now) == 0) {
+			esif_ccb_sprintf(sizeof(logname), logname, "participant_log_%04d-%02d-%02d-%02d%02d%02d.bin",
+				time.tm_year + TIME_BASE_YEAR, time.tm_mon + 1, time.tm_mday, time.tm_hour, time.tm_min, time.tm_sec);
+		}
+	}
+	else {
+		char *fileExtn = esif_ccb_strchr(fileName, '.');
+		if (fileExtn == NULL) {
+			esif_ccb_sprintf(sizeof(logname), logname, "%s.bin", fileName);
+		}
+		else {
+			esif_ccb_sprintf(sizeof(logname), logname, "%s", fileName);
+		}
+	}
+	EsifLogFile_GetFullPath(fullpath, sizeof(fullpath), logname);
+
+	rc = EsifBinLog_Create(&self->binLog, fullpath);
+	if (rc != ESIF_OK) {
+		goto exit;
+	}
+	esif_ccb_strcpy(self->binFileName, fullpath, sizeof(self->binFileName));
+exit:
+	return rc;
+}
+
 
 static void EsifLogMgr_UpdateCapabilityData(
 	EsifParticipantLogDataNodePtr capabilityEntryPtr, 
@@ -2783,6 +3314,10 @@ static void EsifLogMgr_PrintListenerStatus(
 		if ((self->listenersMask & ESIF_LISTENER_LOGFILE_MASK) == ESIF_LISTENER_LOGFILE_MASK) {
 			esif_ccb_strcat(output, ESIF_LISTENER_LOGFILE_STR, datalength);
 		}
+		if ((self->listenersMask & ESIF_LISTENER_BINARYFILE_MASK) == ESIF_LISTENER_BINARYFILE_MASK) {
+			esif_ccb_strcat(output, " ", datalength);
+			esif_ccb_strcat(output, ESIF_LISTENER_BINARYFILE_STR, datalength);
+		}
 		esif_ccb_strcat(output, "\n", datalength);
 		if ((self->listenersMask & ESIF_LISTENER_LOGFILE_MASK) == ESIF_LISTENER_LOGFILE_MASK) {
 			esif_ccb_strcat(
@@ -2807,5 +3342,9 @@ static void EsifLogMgr_PrintListenerStatus(
 			}
 			esif_ccb_strcat(output, "\n", datalength);
 		}
+		if ((self->listenersMask & ESIF_LISTENER_BINARYFILE_MASK) == ESIF_LISTENER_BINARYFILE_MASK) {
+			esif_ccb_sprintf_concat(datalength, output, "Binary Log    : %s\n",
+				EsifBinLog_IsOpen(&self->binLog) ? self->binFileName : "NA");
+		}
 	}
 }
@@ -25,6 +25,7 @@
 #include "esif_uf_log.h"
 #include "esif_uf_trace.h"
 #include "esif_uf_ccb_logging_listener.h"
+#include "esif_uf_loggingmgr_bin.h"
 
 #define MAX_LOG_DATA	(24 * 1024)
 
@@ -41,6 +42,7 @@
 #define PARTICIPANTLOG_CMD_ROUTE_STR        "route"
 #define PARTICIPANTLOG_CMD_INTERVAL_STR     "interval"
 #define PARTICIPANTLOG_CMD_SCHEDULE_STR     "schedule"
+#define PARTICIPANTLOG_CMD_CONVERT_STR      "convert"
 
 #define ESIF_INVALID_DATA        0xFFFFFFFF
 
@@ -91,6 +93,15 @@ typedef struct EsifLoggingManager_s {
 	EsifCommandInfoPtr commandInfo;
 	int commandInfoCount;
 	char *logData;
+	EsifBinLog binLog;                 /* binary log file when routed to binary */
+	Bool isDefaultBinFile;
+	char binFileName[MAX_PATH];
+	EsifBinLogColumnPtr binColumns;    /* columns of the data being sampled */
+	UInt32 binColumnCount;
+	UInt32 binColumnCapacity;
+	UInt8 *binRecord;                  /* record being filled for the current interval */
+	UInt32 binRecordSize;
+	UInt32 binRecordCapacity;
 } EsifLoggingManager, *EsifLoggingManagerPtr;
 
 typedef enum EsifDataListenerType_e {
@@ -98,22 +109,28 @@ typedef enum EsifDataListenerType_e {
 	ESIF_LISTENER_DEBUGGER = 1,	// Overrides System Debug Logger (Windows=OutputDebugString, Linux=syslog)
 	ESIF_LISTENER_LOGFILE = 2, // Logs the data in the output file
 	ESIF_LISTENER_CONSOLE = 3, // Console Output
-	ESIF_LISTENER_MAX = 4,
+	ESIF_LISTENER_BINARYFILE = 4, // Logs the data in a compressed binary file
+	ESIF_LISTENER_MAX = 5,
 } EsifDataListenerType;
 
 #define ESIF_LISTENER_EVENTLOG_MASK  0x00000001
 #define ESIF_LISTENER_DEBUGGER_MASK  0x00000002
 #define ESIF_LISTENER_LOGFILE_MASK   0x00000004
 #define ESIF_LISTENER_CONSOLE_MASK   0x00000008
+#define ESIF_LISTENER_BINARYFILE_MASK 0x00000010
 #define ESIF_LISTENER_ALL_MASK       (ESIF_LISTENER_EVENTLOG_MASK | \
 									  ESIF_LISTENER_DEBUGGER_MASK | \
 									  ESIF_LISTENER_LOGFILE_MASK  | \
 									  ESIF_LISTENER_CONSOLE_MASK)
 
+/* Listeners that receive the data as formatted text; the binary file is only used when routed explicitly */
+#define ESIF_LISTENER_TEXT_MASK      ESIF_LISTENER_ALL_MASK
+
 #define ESIF_LISTENER_EVENTLOG_STR   "eventviewer"
 #define ESIF_LISTENER_DEBUGGER_STR   "debugger"
 #define ESIF_LISTENER_LOGFILE_STR    "file"
 #define ESIF_LISTENER_CONSOLE_STR    "console"
+#define ESIF_LISTENER_BINARYFILE_STR "binary"
 #define ESIF_LISTENER_ALL_STR        "all"
 
 typedef UInt32 esif_listenermask_t;
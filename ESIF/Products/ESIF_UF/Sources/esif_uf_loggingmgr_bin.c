@@ -0,0 +1,781 @@
+/******************************************************************************
+** Copyright (c) 2013-2016 Intel Corporation All Rights Reserved
+**
+** Licensed under the Apache License, Version 2.0 (the "License"); you may not
+** use this file except in compliance with the License.
+**
+** You may obtain a copy of the License at
+**     http://www.apache.org/licenses/LICENSE-2.0
+**
+** Unless required by applicable law or agreed to in writing, software
+** distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+** WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+**
+** See the License for the specific language governing permissions and
+** limitations under the License.
+**
+******************************************************************************/
+#define ESIF_TRACE_ID	ESIF_TRACEMODULE_LOGGINGMGR
+
+#include "esif_uf_loggingmgr_bin.h"
+#include "esif_uf_trace.h"
+
+#define ESIF_BINLOG_MAX_RUN     128		/* longest literal or zero run one control byte can describe */
+#define ESIF_BINLOG_ZERO_RUN    0x80	/* control byte flag for a run of zeros */
+
+static eEsifError EsifBinLog_Reserve(UInt8 **bufferPtr, size_t *sizePtr, size_t needed);
+static eEsifError EsifBinLog_WriteChunk(
+	EsifBinLogPtr self,
+	EsifBinLogChunkType type,
+	const void *payload,
+	UInt32 length
+	);
+static eEsifError EsifBinLog_WriteBlock(EsifBinLogPtr self);
+static void EsifBinLog_ResetSchema(EsifBinLogPtr self);
+static eEsifError EsifBinLog_SetSchema(
+	EsifBinLogPtr self,
+	const EsifBinLogColumn *columns,
+	UInt32 columnCount,
+	UInt32 recordSize,
+	const char *headerText,
+	size_t headerTextLength
+	);
+static eEsifError EsifBinLog_ParseSchema(EsifBinLogPtr self, const UInt8 *payload, UInt32 length);
+static eEsifError EsifBinLog_ParseBlock(EsifBinLogPtr self, const UInt8 *payload, UInt32 length);
+static size_t EsifBinLog_Encode(const UInt8 *records, UInt32 recordCount, UInt32 recordSize, UInt8 *scratch, UInt8 *out);
+static eEsifError EsifBinLog_Decode(
+	const UInt8 *in,
+	size_t inLength,
+	UInt32 recordCount,
+	UInt32 recordSize,
+	UInt8 *scratch,
+	UInt8 *records
+	);
+
+void EsifBinLog_Init(EsifBinLogPtr self)
+{
+	ESIF_ASSERT(self != NULL);
+
+	esif_ccb_memset(self, 0, sizeof(*self));
+	esif_ccb_lock_init(&self->lock);
+}
+
+void EsifBinLog_Uninit(EsifBinLogPtr self)
+{
+	ESIF_ASSERT(self != NULL);
+
+	EsifBinLog_Close(self);
+	esif_ccb_lock_uninit(&self->lock);
+}
+
+eEsifError EsifBinLog_Create(EsifBinLogPtr self, const char *fullpath)
+{
+	eEsifError rc = ESIF_OK;
+	EsifBinLogFileHeader header = { 0 };
+
+	ESIF_ASSERT(self != NULL);
+	ESIF_ASSERT(fullpath != NULL);
+
+	EsifBinLog_Close(self);
+
+	esif_ccb_write_lock(&self->lock);
+	self->handle = esif_ccb_fopen((esif_string)fullpath, "wb", NULL);
+	if (self->handle == NULL) {
+		ESIF_TRACE_ERROR("Unable to create binary log file %s", fullpath);
+		rc = ESIF_E_IO_OPEN_FAILED;
+		goto exit;
+	}
+
+	esif_ccb_memcpy(header.signature, ESIF_BINLOG_SIGNATURE, ESIF_BINLOG_SIGNATURE_LEN);
+	header.version = ESIF_BINLOG_VERSION;
+	header.byteOrderMark = ESIF_BINLOG_BYTE_ORDER_MARK;
+	if (esif_ccb_fwrite(&header, sizeof(header), 1, self->handle) != 1) {
+		rc = ESIF_E_IO_ERROR;
+		esif_ccb_fclose(self->handle);
+		self->handle = NULL;
+		goto exit;
+	}
+exit:
+	esif_ccb_write_unlock(&self->lock);
+	return rc;
+}
+
+void EsifBinLog_Close(EsifBinLogPtr self)
+{
+	ESIF_ASSERT(self != NULL);
+
+	esif_ccb_write_lock(&self->lock);
+	if (self->handle != NULL) {
+		EsifBinLog_WriteBlock(self);
+		esif_ccb_fclose(self->handle);
+		self->handle = NULL;
+	}
+	EsifBinLog_ResetSchema(self);
+
+	esif_ccb_free(self->records);
+	self->records = NULL;
+	self->recordsSize = 0;
+	esif_ccb_free(self->buffer);
+	self->buffer = NULL;
+	self->bufferSize = 0;
+	esif_ccb_free(self->scratch);
+	self->scratch = NULL;
+	self->scratchSize = 0;
+	esif_ccb_write_unlock(&self->lock);
+}
+
+Bool EsifBinLog_IsOpen(EsifBinLogPtr self)
+{
+	Bool isOpen = ESIF_FALSE;
+
+	ESIF_ASSERT(self != NULL);
+
+	esif_ccb_read_lock(&self->lock);
+	isOpen = (self->handle != NULL);
+	esif_ccb_read_unlock(&self->lock);
+	return isOpen;
+}
+
+Bool EsifBinLog_IsSchemaCurrent(EsifBinLogPtr self, const EsifBinLogColumn *columns, UInt32 columnCount)
+{
+	Bool isCurrent = ESIF_FALSE;
+	UInt32 i = 0;
+
+	ESIF_ASSERT(self != NULL);
+
+	esif_ccb_read_lock(&self->lock);
+	if ((self->columns != NULL) && (self->columnCount == columnCount)) {
+		isCurrent = ESIF_TRUE;
+		for (i = 0; i < columnCount; i++) {
+			if ((self->columns[i].participantId != columns[i].participantId) ||
+				(self->columns[i].domainId != columns[i].domainId) ||
+				(self->columns[i].capabilityType != columns[i].capabilityType) ||
+				(self->columns[i].dataOffset != columns[i].dataOffset) ||
+				(self->columns[i].dataSize != columns[i].dataSize)) {
+				isCurrent = ESIF_FALSE;
+				break;
+			}
+		}
+	}
+	esif_ccb_read_unlock(&self->lock);
+	return isCurrent;
+}
+
+eEsifError EsifBinLog_WriteSchema(
+	EsifBinLogPtr self,
+	const EsifBinLogColumn *columns,
+	UInt32 columnCount,
+	const char *headerText
+	)
+{
+	eEsifError rc = ESIF_OK;
+	EsifBinLogSchemaHeader schemaHeader = { 0 };
+	size_t headerTextLength = 0;
+	size_t payloadLength = 0;
+	UInt32 recordSize = sizeof(EsifBinLogRecordHeader);
+	UInt8 *payload = NULL;
+	UInt32 i = 0;
+
+	ESIF_ASSERT(self != NULL);
+	ESIF_ASSERT((columns != NULL) || (columnCount == 0));
+
+	headerText = (headerText != NULL) ? headerText : "";
+	headerTextLength = esif_ccb_strlen(headerText, ESIF_BINLOG_MAX_CHUNK_SIZE);
+	for (i = 0; i < columnCount; i++) {
+		if (columns[i].dataOffset + columns[i].dataSize > recordSize) {
+			recordSize = columns[i].dataOffset + columns[i].dataSize;
+		}
+	}
+
+	esif_ccb_write_lock(&self->lock);
+	if (self->handle == NULL) {
+		rc = ESIF_E_INVALID_HANDLE;
+		goto exit;
+	}
+
+	rc = EsifBinLog_WriteBlock(self);
+	if (rc != ESIF_OK) {
+		goto exit;
+	}
+
+	rc = EsifBinLog_SetSchema(self, columns, columnCount, recordSize, headerText, headerTextLength);
+	if (rc != ESIF_OK) {
+		goto exit;
+	}
+
+	payloadLength = sizeof(schemaHeader) + (columnCount * sizeof(*columns)) + headerTextLength;
+	rc = EsifBinLog_Reserve(&self->buffer, &self->bufferSize, payloadLength);
+	if (rc != ESIF_OK) {
+		goto exit;
+	}
+
+	schemaHeader.columnCount = columnCount;
+	schemaHeader.recordSize = recordSize;
+	schemaHeader.headerTextLength = (UInt32)headerTextLength;
+
+	payload = self->buffer;
+	esif_ccb_memcpy(payload, &schemaHeader, sizeof(schemaHeader));
+	payload += sizeof(schemaHeader);
+	if (columnCount > 0) {
+		esif_ccb_memcpy(payload, columns, columnCount * sizeof(*columns));
+		payload += columnCount * sizeof(*columns);
+	}
+	esif_ccb_memcpy(payload, headerText, headerTextLength);
+
+	rc = EsifBinLog_WriteChunk(self, ESIF_BINLOG_CHUNK_SCHEMA, self->buffer, (UInt32)payloadLength);
+exit:
+	esif_ccb_write_unlock(&self->lock);
+	return rc;
+}
+
+eEsifError EsifBinLog_WriteRecord(EsifBinLogPtr self, const void *record, UInt32 recordSize)
+{
+	eEsifError rc = ESIF_OK;
+
+	ESIF_ASSERT(self != NULL);
+	ESIF_ASSERT(record != NULL);
+
+	esif_ccb_write_lock(&self->lock);
+	if ((self->handle == NULL) || (self->columns == NULL)) {
+		rc = ESIF_E_INVALID_HANDLE;
+		goto exit;
+	}
+	if (recordSize != self->recordSize) {
+		rc = ESIF_E_PARAMETER_IS_OUT_OF_BOUNDS;
+		goto exit;
+	}
+
+	esif_ccb_memcpy(self->records + ((size_t)self->recordCount * self->recordSize), record, recordSize);
+	self->recordCount++;
+	if (self->recordCount >= ESIF_BINLOG_BLOCK_RECORDS) {
+		rc = EsifBinLog_WriteBlock(self);
+	}
+exit:
+	esif_ccb_write_unlock(&self->lock);
+	return rc;
+}
+
+eEsifError EsifBinLog_WriteText(EsifBinLogPtr self, const char *text)
+{
+	eEsifError rc = ESIF_OK;
+
+	ESIF_ASSERT(self != NULL);
+	ESIF_ASSERT(text != NULL);
+
+	esif_ccb_write_lock(&self->lock);
+	if (self->handle == NULL) {
+		rc = ESIF_E_INVALID_HANDLE;
+		goto exit;
+	}
+
+	// Keep the text in sequence with the samples logged before it
+	rc = EsifBinLog_WriteBlock(self);
+	if (rc != ESIF_OK) {
+		goto exit;
+	}
+	rc = EsifBinLog_WriteChunk(self, ESIF_BINLOG_CHUNK_TEXT, text, (UInt32)esif_ccb_strlen(text, ESIF_BINLOG_MAX_CHUNK_SIZE));
+	if (rc == ESIF_OK) {
+		fflush(self->handle);
+	}
+exit:
+	esif_ccb_write_unlock(&self->lock);
+	return rc;
+}
+
+eEsifError EsifBinLog_Flush(EsifBinLogPtr self)
+{
+	eEsifError rc = ESIF_OK;
+
+	ESIF_ASSERT(self != NULL);
+
+	esif_ccb_write_lock(&self->lock);
+	if (self->handle != NULL) {
+		rc = EsifBinLog_WriteBlock(self);
+		fflush(self->handle);
+	}
+	esif_ccb_write_unlock(&self->lock);
+	return rc;
+}
+
+eEsifError EsifBinLog_OpenReader(EsifBinLogPtr self, const char *fullpath)
+{
+	eEsifError rc = ESIF_OK;
+	EsifBinLogFileHeader header = { 0 };
+
+	ESIF_ASSERT(self != NULL);
+	ESIF_ASSERT(fullpath != NULL);
+
+	EsifBinLog_Close(self);
+
+	esif_ccb_write_lock(&self->lock);
+	self->handle = esif_ccb_fopen((esif_string)fullpath, "rb", NULL);
+	if (self->handle == NULL) {
+		rc = ESIF_E_IO_OPEN_FAILED;
+		goto exit;
+	}
+
+	if ((esif_ccb_fread(&header, sizeof(header), sizeof(header), 1, self->handle) != 1) ||
+		(memcmp(header.signature, ESIF_BINLOG_SIGNATURE, ESIF_BINLOG_SIGNATURE_LEN) != 0)) {
+		rc = ESIF_E_NOT_SUPPORTED;
+		goto exit;
+	}
+	if ((header.version != ESIF_BINLOG_VERSION) || (header.byteOrderMark != ESIF_BINLOG_BYTE_ORDER_MARK)) {
+		ESIF_TRACE_ERROR("Unsupported binary log version %u or byte order 0x%08X", header.version, header.byteOrderMark);
+		rc = ESIF_E_NOT_SUPPORTED;
+		goto exit;
+	}
+exit:
+	if ((rc != ESIF_OK) && (self->handle != NULL)) {
+		esif_ccb_fclose(self->handle);
+		self->handle = NULL;
+	}
+	esif_ccb_write_unlock(&self->lock);
+	return rc;
+}
+
+eEsifError EsifBinLog_ReadChunk(EsifBinLogPtr self, EsifBinLogChunkType *typePtr, const char **textPtr)
+{
+	eEsifError rc = ESIF_OK;
+	EsifBinLogChunkHeader chunkHeader = { 0 };
+	size_t bytesRead = 0;
+
+	ESIF_ASSERT(self != NULL);
+	ESIF_ASSERT(typePtr != NULL);
+	ESIF_ASSERT(textPtr != NULL);
+
+	*textPtr = NULL;
+
+	esif_ccb_write_lock(&self->lock);
+	if (self->handle == NULL) {
+		rc = ESIF_E_INVALID_HANDLE;
+		goto exit;
+	}
+
+	// Chunks of unknown types are skipped so newer writers stay readable
+	do {
+		bytesRead = esif_ccb_fread(&chunkHeader, sizeof(chunkHeader), sizeof(chunkHeader), 1, self->handle);
+		if (bytesRead != 1) {
+			rc = ESIF_E_ITERATION_DONE;
+			goto exit;
+		}
+		if ((chunkHeader.signature != ESIF_BINLOG_CHUNK_SIGNATURE) ||
+			(chunkHeader.length > ESIF_BINLOG_MAX_CHUNK_SIZE)) {
+			rc = ESIF_E_IO_ERROR;
+			goto exit;
+		}
+
+		rc = EsifBinLog_Reserve(&self->buffer, &self->bufferSize, (size_t)chunkHeader.length + 1);
+		if (rc != ESIF_OK) {
+			goto exit;
+		}
+		if ((chunkHeader.length > 0) &&
+			(esif_ccb_fread(self->buffer, self->bufferSize, chunkHeader.length, 1, self->handle) != 1)) {
+			rc = ESIF_E_IO_ERROR;
+			goto exit;
+		}
+		self->buffer[chunkHeader.length] = '\0';
+	} while ((chunkHeader.type != ESIF_BINLOG_CHUNK_SCHEMA) &&
+		(chunkHeader.type != ESIF_BINLOG_CHUNK_BLOCK) &&
+		(chunkHeader.type != ESIF_BINLOG_CHUNK_TEXT));
+
+	*typePtr = (EsifBinLogChunkType)chunkHeader.type;
+	switch (chunkHeader.type) {
+	case ESIF_BINLOG_CHUNK_SCHEMA:
+		rc = EsifBinLog_ParseSchema(self, self->buffer, chunkHeader.length);
+		break;
+	case ESIF_BINLOG_CHUNK_BLOCK:
+		rc = EsifBinLog_ParseBlock(self, self->buffer, chunkHeader.length);
+		break;
+	default:
+		*textPtr = (const char *)self->buffer;
+		break;
+	}
+exit:
+	esif_ccb_write_unlock(&self->lock);
+	return rc;
+}
+
+UInt32 EsifBinLog_GetCapabilityDataSize(UInt32 capabilityType)
+{
+	UInt32 size = 0;
+
+	switch (capabilityType) {
+	case ESIF_CAPABILITY_TYPE_ACTIVE_CONTROL:
+		size = sizeof(EsifActiveControlCapability);
+		break;
+	case ESIF_CAPABILITY_TYPE_CTDP_CONTROL:
+		size = sizeof(EsifConfigTdpControl);
+		break;
+	case ESIF_CAPABILITY_TYPE_CORE_CONTROL:
+		size = sizeof(EsifCoreControl);
+		break;
+	case ESIF_CAPABILITY_TYPE_DISPLAY_CONTROL:
+		size = sizeof(EsifDisplayControl);
+		break;
+	case ESIF_CAPABILITY_TYPE_DOMAIN_PRIORITY:
+		size = sizeof(EsifDomainPriority);
+		break;
+	case ESIF_CAPABILITY_TYPE_PERF_CONTROL:
+		size = sizeof(EsifPerformanceControl);
+		break;
+	case ESIF_CAPABILITY_TYPE_POWER_CONTROL:
+		size = sizeof(EsifPowerControl);
+		break;
+	case ESIF_CAPABILITY_TYPE_POWER_STATUS:
+		size = sizeof(EsifPowerStatus);
+		break;
+	case ESIF_CAPABILITY_TYPE_TEMP_STATUS:
+		size = sizeof(EsifTemperatureStatus);
+		break;
+	case ESIF_CAPABILITY_TYPE_UTIL_STATUS:
+		size = sizeof(EsifUtilizationStatus);
+		break;
+	case ESIF_CAPABILITY_TYPE_PIXELCLOCK_STATUS:
+		size = sizeof(EsifPixelClockStatus);
+		break;
+	case ESIF_CAPABILITY_TYPE_PIXELCLOCK_CONTROL:
+		size = sizeof(EsifPixelClockControl);
+		break;
+	case ESIF_CAPABILITY_TYPE_PLAT_POWER_STATUS:
+		size = sizeof(EsifPlatformPowerStatus);
+		break;
+	case ESIF_CAPABILITY_TYPE_TEMP_THRESHOLD:
+		size = sizeof(EsifTemperatureThresholdControl);
+		break;
+	case ESIF_CAPABILITY_TYPE_RFPROFILE_STATUS:
+		size = sizeof(EsifRfProfileStatus);
+		break;
+	case ESIF_CAPABILITY_TYPE_RFPROFILE_CONTROL:
+		size = sizeof(EsifRfProfileControl);
+		break;
+	case ESIF_CAPABILITY_TYPE_NETWORK_CONTROL:
+		size = sizeof(EsifNetworkControl);
+		break;
+	case ESIF_CAPABILITY_TYPE_XMITPOWER_CONTROL:
+		size = sizeof(EsifXmitPowerControl);
+		break;
+	case ESIF_CAPABILITY_TYPE_PSYS_CONTROL:
+		size = sizeof(EsifPSysControl);
+		break;
+	default:
+		break;
+	}
+	return size;
+}
+
+static eEsifError EsifBinLog_Reserve(UInt8 **bufferPtr, size_t *sizePtr, size_t needed)
+{
+	eEsifError rc = ESIF_OK;
+	UInt8 *newBuffer = NULL;
+
+	if (*sizePtr < needed) {
+		newBuffer = (UInt8 *)esif_ccb_realloc(*bufferPtr, needed);
+		if (newBuffer == NULL) {
+			rc = ESIF_E_NO_MEMORY;
+			goto exit;
+		}
+		*bufferPtr = newBuffer;
+		*sizePtr = needed;
+	}
+exit:
+	return rc;
+}
+
+static eEsifError EsifBinLog_WriteChunk(
+	EsifBinLogPtr self,
+	EsifBinLogChunkType type,
+	const void *payload,
+	UInt32 length
+	)
+{
+	eEsifError rc = ESIF_OK;
+	EsifBinLogChunkHeader chunkHeader = { 0 };
+
+	chunkHeader.signature = ESIF_BINLOG_CHUNK_SIGNATURE;
+	chunkHeader.type = type;
+	chunkHeader.length = length;
+
+	if ((esif_ccb_fwrite(&chunkHeader, sizeof(chunkHeader), 1, self->handle) != 1) ||
+		((length > 0) && (esif_ccb_fwrite(payload, length, 1, self->handle) != 1))) {
+		rc = ESIF_E_IO_ERROR;
+	}
+	return rc;
+}
+
+/* Compresses and writes the buffered records.  The caller holds the write lock. */
+static eEsifError EsifBinLog_WriteBlock(EsifBinLogPtr self)
+{
+	eEsifError rc = ESIF_OK;
+	EsifBinLogBlockHeader blockHeader = { 0 };
+	size_t rawSize = 0;
+	size_t encodedSize = 0;
+
+	if ((self->handle == NULL) || (self->recordCount == 0)) {
+		goto exit;
+	}
+
+	// Worst case the encoding adds one control byte per ESIF_BINLOG_MAX_RUN bytes
+	rawSize = (size_t)self->recordCount * self->recordSize;
+	rc = EsifBinLog_Reserve(&self->scratch, &self->scratchSize, rawSize);
+	if (rc != ESIF_OK) {
+		goto exit;
+	}
+	rc = EsifBinLog_Reserve(&self->buffer, &self->bufferSize,
+		sizeof(blockHeader) + rawSize + (rawSize / ESIF_BINLOG_MAX_RUN) + 1);
+	if (rc != ESIF_OK) {
+		goto exit;
+	}
+
+	blockHeader.recordCount = self->recordCount;
+	blockHeader.recordSize = self->recordSize;
+	esif_ccb_memcpy(self->buffer, &blockHeader, sizeof(blockHeader));
+	encodedSize = EsifBinLog_Encode(self->records, self->recordCount, self->recordSize, self->scratch,
+		self->buffer + sizeof(blockHeader));
+
+	rc = EsifBinLog_WriteChunk(self, ESIF_BINLOG_CHUNK_BLOCK, self->buffer, (UInt32)(sizeof(blockHeader) + encodedSize));
+exit:
+	// Records are dropped rather than retried so a failing disk cannot grow the buffer
+	self->recordCount = 0;
+	return rc;
+}
+
+static void EsifBinLog_ResetSchema(EsifBinLogPtr self)
+{
+	esif_ccb_free(self->columns);
+	self->columns = NULL;
+	self->columnCount = 0;
+	self->recordSize = 0;
+	self->recordCount = 0;
+	esif_ccb_free(self->headerText);
+	self->headerText = NULL;
+}
+
+static eEsifError EsifBinLog_SetSchema(
+	EsifBinLogPtr self,
+	const EsifBinLogColumn *columns,
+	UInt32 columnCount,
+	UInt32 recordSize,
+	const char *headerText,
+	size_t headerTextLength
+	)
+{
+	eEsifError rc = ESIF_OK;
+
+	EsifBinLog_ResetSchema(self);
+
+	// Always allocate at least one column so a schema is known to be set even when it is empty
+	self->columns = (EsifBinLogColumnPtr)esif_ccb_malloc((columnCount + 1) * sizeof(*columns));
+	self->headerText = (char *)esif_ccb_malloc(headerTextLength + 1);
+	if ((self->columns == NULL) || (self->headerText == NULL)) {
+		EsifBinLog_ResetSchema(self);
+		rc = ESIF_E_NO_MEMORY;
+		goto exit;
+	}
+	if (columnCount > 0) {
+		esif_ccb_memcpy(self->columns, columns, columnCount * sizeof(*columns));
+	}
+	esif_ccb_memcpy(self->headerText, headerText, headerTextLength);
+	self->headerText[headerTextLength] = '\0';
+	self->columnCount = columnCount;
+	self->recordSize = recordSize;
+
+	rc = EsifBinLog_Reserve(&self->records, &self->recordsSize, (size_t)ESIF_BINLOG_BLOCK_RECORDS * recordSize);
+	if (rc != ESIF_OK) {
+		EsifBinLog_ResetSchema(self);
+	}
+exit:
+	return rc;
+}
+
+static eEsifError EsifBinLog_ParseSchema(EsifBinLogPtr self, const UInt8 *payload, UInt32 length)
+{
+	eEsifError rc = ESIF_OK;
+	EsifBinLogSchemaHeader schemaHeader = { 0 };
+	const EsifBinLogColumn *columns = NULL;
+	UInt32 i = 0;
+
+	if (length < sizeof(schemaHeader)) {
+		rc = ESIF_E_IO_ERROR;
+		goto exit;
+	}
+	esif_ccb_memcpy(&schemaHeader, payload, sizeof(schemaHeader));
+
+	if ((schemaHeader.recordSize < sizeof(EsifBinLogRecordHeader)) ||
+		(schemaHeader.columnCount > (length - sizeof(schemaHeader)) / sizeof(EsifBinLogColumn)) ||
+		(schemaHeader.headerTextLength > length - sizeof(schemaHeader) - (schemaHeader.columnCount * sizeof(EsifBinLogColumn)))) {
+		rc = ESIF_E_IO_ERROR;
+		goto exit;
+	}
+
+	columns = (const EsifBinLogColumn *)(payload + sizeof(schemaHeader));
+	for (i = 0; i < schemaHeader.columnCount; i++) {
+		if ((columns[i].dataOffset < sizeof(EsifBinLogRecordHeader)) ||
+			(columns[i].dataSize > schemaHeader.recordSize) ||
+			(columns[i].dataOffset > schemaHeader.recordSize - columns[i].dataSize)) {
+			rc = ESIF_E_IO_ERROR;
+			goto exit;
+		}
+	}
+
+	rc = EsifBinLog_SetSchema(self,
+		columns,
+		schemaHeader.columnCount,
+		schemaHeader.recordSize,
+		(const char *)(columns + schemaHeader.columnCount),
+		schemaHeader.headerTextLength);
+	if (rc != ESIF_OK) {
+		goto exit;
+	}
+
+	// Names are written null terminated but do not trust the file
+	for (i = 0; i < self->columnCount; i++) {
+		self->columns[i].participantName[sizeof(self->columns[i].participantName) - 1] = '\0';
+	}
+exit:
+	return rc;
+}
+
+static eEsifError EsifBinLog_ParseBlock(EsifBinLogPtr self, const UInt8 *payload, UInt32 length)
+{
+	eEsifError rc = ESIF_OK;
+	EsifBinLogBlockHeader blockHeader = { 0 };
+	size_t rawSize = 0;
+
+	self->recordCount = 0;
+
+	if ((self->columns == NULL) || (length < sizeof(blockHeader))) {
+		rc = ESIF_E_IO_ERROR;
+		goto exit;
+	}
+	esif_ccb_memcpy(&blockHeader, payload, sizeof(blockHeader));
+
+	if ((blockHeader.recordSize != self->recordSize) ||
+		(blockHeader.recordCount > ESIF_BINLOG_MAX_CHUNK_SIZE / self->recordSize)) {
+		rc = ESIF_E_IO_ERROR;
+		goto exit;
+	}
+
+	rawSize = (size_t)blockHeader.recordCount * blockHeader.recordSize;
+	rc = EsifBinLog_Reserve(&self->records, &self->recordsSize, rawSize);
+	if (rc != ESIF_OK) {
+		goto exit;
+	}
+	rc = EsifBinLog_Reserve(&self->scratch, &self->scratchSize, rawSize);
+	if (rc != ESIF_OK) {
+		goto exit;
+	}
+
+	rc = EsifBinLog_Decode(payload + sizeof(blockHeader),
+		length - sizeof(blockHeader),
+		blockHeader.recordCount,
+		blockHeader.recordSize,
+		self->scratch,
+		self->records);
+	if (rc != ESIF_OK) {
+		goto exit;
+	}
+	self->recordCount = blockHeader.recordCount;
+exit:
+	return rc;
+}
+
+/*
+ * Transposes the records to column-major order, XORs each byte with the same byte of the previous record and
+ * run-length encodes the result.  Control bytes below ESIF_BINLOG_ZERO_RUN are followed by (control + 1) literal
+ * bytes; the others stand for ((control & ~ESIF_BINLOG_ZERO_RUN) + 1) zeros.
+ */
+static size_t EsifBinLog_Encode(const UInt8 *records, UInt32 recordCount, UInt32 recordSize, UInt8 *scratch, UInt8 *out)
+{
+	size_t length = (size_t)recordCount * recordSize;
+	size_t pos = 0;
+	size_t outPos = 0;
+	size_t start = 0;
+	size_t run = 0;
+	UInt32 column = 0;
+	UInt32 record = 0;
+
+	for (column = 0; column < recordSize; column++) {
+		scratch[pos++] = records[column];
+		for (record = 1; record < recordCount; record++) {
+			scratch[pos++] = records[(size_t)record * recordSize + column] ^
+				records[(size_t)(record - 1) * recordSize + column];
+		}
+	}
+
+	pos = 0;
+	while (pos < length) {
+		run = 0;
+		while ((pos + run < length) && (scratch[pos + run] == 0) && (run < ESIF_BINLOG_MAX_RUN)) {
+			run++;
+		}
+		if (run >= 2) {
+			out[outPos++] = (UInt8)(ESIF_BINLOG_ZERO_RUN | (run - 1));
+			pos += run;
+			continue;
+		}
+
+		// Literal bytes up to the next pair of zeros
+		start = pos;
+		while ((pos < length) && (pos - start < ESIF_BINLOG_MAX_RUN) &&
+			!((scratch[pos] == 0) && (pos + 1 < length) && (scratch[pos + 1] == 0))) {
+			pos++;
+		}
+		out[outPos++] = (UInt8)(pos - start - 1);
+		esif_ccb_memcpy(out + outPos, scratch + start, pos - start);
+		outPos += pos - start;
+	}
+	return outPos;
+}
+
+static eEsifError EsifBinLog_Decode(
+	const UInt8 *in,
+	size_t inLength,
+	UInt32 recordCount,
+	UInt32 recordSize,
+	UInt8 *scratch,
+	UInt8 *records
+	)
+{
+	eEsifError rc = ESIF_OK;
+	size_t length = (size_t)recordCount * recordSize;
+	size_t inPos = 0;
+	size_t pos = 0;
+	size_t run = 0;
+	UInt32 column = 0;
+	UInt32 record = 0;
+
+	while (pos < length) {
+		if (inPos >= inLength) {
+			rc = ESIF_E_IO_ERROR;
+			goto exit;
+		}
+		run = (in[inPos] & ~ESIF_BINLOG_ZERO_RUN) + 1;
+		if (run > length - pos) {
+			rc = ESIF_E_IO_ERROR;
+			goto exit;
+		}
+		if (in[inPos++] & ESIF_BINLOG_ZERO_RUN) {
+			esif_ccb_memset(scratch + pos, 0, run);
+		}
+		else {
+			if (run > inLength - inPos) {
+				rc = ESIF_E_IO_ERROR;
+				goto exit;
+			}
+			esif_ccb_memcpy(scratch + pos, in + inPos, run);
+			inPos += run;
+		}
+		pos += run;
+	}
+
+	pos = 0;
+	for (column = 0; column < recordSize; column++) {
+		records[column] = scratch[pos++];
+		for (record = 1; record < recordCount; record++) {
+			records[(size_t)record * recordSize + column] = scratch[pos++] ^
+				records[(size_t)(record - 1) * recordSize + column];
+		}
+	}
+exit:
+	return rc;
+}
@@ -0,0 +1,148 @@
+/******************************************************************************
+** Copyright (c) 2013-2016 Intel Corporation All Rights Reserved
+**
+** Licensed under the Apache License, Version 2.0 (the "License"); you may not
+** use this file except in compliance with the License.
+**
+** You may obtain a copy of the License at
+**     http://www.apache.org/licenses/LICENSE-2.0
+**
+** Unless required by applicable law or agreed to in writing, software
+** distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+** WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+**
+** See the License for the specific language governing permissions and
+** limitations under the License.
+**
+******************************************************************************/
+
+#pragma once
+#include "esif_uf.h"
+#include "esif_sdk_logging_data.h"
+
+/*
+ * Binary Participant Log Format
+ *
+ * The file starts with an EsifBinLogFileHeader followed by a sequence of chunks, each one an EsifBinLogChunkHeader
+ * and its payload:
+ *
+ *   SCHEMA - Describes the columns of the records that follow: an EsifBinLogSchemaHeader, one EsifBinLogColumn
+ *            per participant/domain/capability and the same header line the text log prints.  A new schema is
+ *            written whenever the set of logged capabilities changes.
+ *   BLOCK  - An EsifBinLogBlockHeader and a compressed block of fixed-width records.  Each record is an
+ *            EsifBinLogRecordHeader followed by the raw capability data of every column.
+ *   TEXT   - A message written to the log outside of the sampled data (errors, stop notices).
+ *
+ * Blocks are stored column-major with each byte XORed against the same byte of the previous record, which turns
+ * unchanged samples into runs of zeros, and the result is run-length encoded.  Values are stored in host byte
+ * order; the byte order mark in the file header lets a reader detect a mismatch.
+ */
+
+#define ESIF_BINLOG_SIGNATURE         "ESIFPLOG"
+#define ESIF_BINLOG_SIGNATURE_LEN     8
+#define ESIF_BINLOG_VERSION           1
+#define ESIF_BINLOG_BYTE_ORDER_MARK   0x01020304
+#define ESIF_BINLOG_CHUNK_SIGNATURE   0x4B4E4843	/* "CHNK" */
+#define ESIF_BINLOG_BLOCK_RECORDS     64			/* records buffered before a block is compressed and written */
+#define ESIF_BINLOG_MAX_CHUNK_SIZE    (16 * 1024 * 1024)
+
+typedef enum EsifBinLogChunkType_e {
+	ESIF_BINLOG_CHUNK_SCHEMA = 1,
+	ESIF_BINLOG_CHUNK_BLOCK = 2,
+	ESIF_BINLOG_CHUNK_TEXT = 3,
+} EsifBinLogChunkType;
+
+#pragma pack(push, 1)
+
+typedef struct EsifBinLogFileHeader_s {
+	char signature[ESIF_BINLOG_SIGNATURE_LEN];
+	UInt32 version;
+	UInt32 byteOrderMark;
+} EsifBinLogFileHeader, *EsifBinLogFileHeaderPtr;
+
+typedef struct EsifBinLogChunkHeader_s {
+	UInt32 signature;
+	UInt32 type;		/* EsifBinLogChunkType */
+	UInt32 length;		/* payload length in bytes, not including this header */
+} EsifBinLogChunkHeader, *EsifBinLogChunkHeaderPtr;
+
+typedef struct EsifBinLogSchemaHeader_s {
+	UInt32 columnCount;
+	UInt32 recordSize;
+	UInt32 headerTextLength;
+} EsifBinLogSchemaHeader, *EsifBinLogSchemaHeaderPtr;
+
+typedef struct EsifBinLogColumn_s {
+	UInt32 participantId;
+	UInt32 domainId;
+	UInt32 capabilityType;
+	UInt32 dataOffset;						/* offset of the capability data within a record */
+	UInt32 dataSize;
+	UInt8 domainIndex;
+	char participantName[ESIF_NAME_LEN];	/* empty if the participant was not available */
+} EsifBinLogColumn, *EsifBinLogColumnPtr;
+
+typedef struct EsifBinLogBlockHeader_s {
+	UInt32 recordCount;
+	UInt32 recordSize;
+} EsifBinLogBlockHeader, *EsifBinLogBlockHeaderPtr;
+
+typedef struct EsifBinLogRecordHeader_s {
+	Int64 time;			/* time_t of the sample */
+	UInt64 msec;		/* system time of the sample in ms */
+} EsifBinLogRecordHeader, *EsifBinLogRecordHeaderPtr;
+
+#pragma pack(pop)
+
+typedef struct EsifBinLog_s {
+	esif_ccb_lock_t lock;
+	FILE *handle;
+	EsifBinLogColumnPtr columns;	/* schema of the records being written or read */
+	UInt32 columnCount;
+	UInt32 recordSize;
+	char *headerText;
+	UInt8 *records;					/* uncompressed records of the current block */
+	UInt32 recordCount;
+	size_t recordsSize;
+	UInt8 *buffer;					/* chunk payload, compressed on write */
+	size_t bufferSize;
+	UInt8 *scratch;					/* block in column-major, delta encoded form */
+	size_t scratchSize;
+} EsifBinLog, *EsifBinLogPtr;
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+void EsifBinLog_Init(EsifBinLogPtr self);
+void EsifBinLog_Uninit(EsifBinLogPtr self);
+
+/* Writer */
+eEsifError EsifBinLog_Create(EsifBinLogPtr self, const char *fullpath);
+void EsifBinLog_Close(EsifBinLogPtr self);
+Bool EsifBinLog_IsOpen(EsifBinLogPtr self);
+Bool EsifBinLog_IsSchemaCurrent(EsifBinLogPtr self, const EsifBinLogColumn *columns, UInt32 columnCount);
+eEsifError EsifBinLog_WriteSchema(
+	EsifBinLogPtr self,
+	const EsifBinLogColumn *columns,
+	UInt32 columnCount,
+	const char *headerText
+	);
+eEsifError EsifBinLog_WriteRecord(EsifBinLogPtr self, const void *record, UInt32 recordSize);
+eEsifError EsifBinLog_WriteText(EsifBinLogPtr self, const char *text);
+eEsifError EsifBinLog_Flush(EsifBinLogPtr self);
+
+/*
+ * Reader
+ * EsifBinLog_ReadChunk returns ESIF_E_ITERATION_DONE at the end of the file.  After a SCHEMA chunk the columns and
+ * headerText members describe the new schema, after a BLOCK chunk records/recordCount hold the decoded records
+ * and after a TEXT chunk *textPtr points to the null terminated message.
+ */
+eEsifError EsifBinLog_OpenReader(EsifBinLogPtr self, const char *fullpath);
+eEsifError EsifBinLog_ReadChunk(EsifBinLogPtr self, EsifBinLogChunkType *typePtr, const char **textPtr);
+
+UInt32 EsifBinLog_GetCapabilityDataSize(UInt32 capabilityType);
+
+#ifdef __cplusplus
+}
+#endif
@@ -23,6 +23,7 @@
 #include "esif_uf_actmgr.h"	/* Action Manager            */
 #include "esif_uf_xform.h"
 #include "esif_sdk_iface_upe.h"
+#include "esif_hash_table.h"
 
 #ifdef ESIF_ATTR_OS_WINDOWS
 //
@@ -39,6 +40,10 @@
  */
 extern char *esif_str_replace(char *orig, char *rep, char *with);
 
+/* Token Replaced Parameter Cache Counters */
+atomic_t g_upTokenParamHits = ATOMIC_INIT(0);
+atomic_t g_upTokenParamFills = ATOMIC_INIT(0);
+
 /*
  * PRIVATE FUNCTION PROTOTYPES
  */
@@ -133,6 +138,8 @@ static eEsifError EsifUp_ExecuteIfaceSet(
 static EsifString EsifUp_SelectDsp(
 	EsifUpPtr self
 	);
+static void EsifUp_BuildTokenParams(EsifUpPtr self);
+static void EsifUp_DestroyTokenParams(EsifUpPtr self);
 
 /*
  * Friend functions
@@ -500,6 +507,7 @@ static eEsifError EsifUp_CreateParticipantByLpEventData(
 	newUpPtr->markedForDelete = ESIF_FALSE;
 	esif_ccb_event_init(&newUpPtr->deleteEvent);
 	esif_ccb_lock_init(&newUpPtr->objLock);
+	esif_ccb_lock_init(&newUpPtr->tokenParamsLock);
 
 	/* origin of creation */
 	newUpPtr->fOrigin = eParticipantOriginLF;
@@ -590,6 +598,7 @@ static eEsifError EsifUp_CreateParticipantByUpInterface(
 	newUpPtr->markedForDelete = ESIF_FALSE;
 	esif_ccb_event_init(&newUpPtr->deleteEvent);
 	esif_ccb_lock_init(&newUpPtr->objLock);
+	esif_ccb_lock_init(&newUpPtr->tokenParamsLock);
 
 	/* origin of creation */
 	newUpPtr->fOrigin = eParticipantOriginUF;
@@ -761,6 +770,8 @@ void EsifUp_DestroyParticipant(
 	EsifUpPtr self
 	)
 {
+	UInt8 domainIndex = 0;
+
 	if (self != NULL) {
 		self->markedForDelete = ESIF_TRUE;
 		EsifUp_PutRef(self);
@@ -768,8 +779,15 @@ void EsifUp_DestroyParticipant(
 		ESIF_TRACE_INFO("Destroy participant %d : wait for delete event...\n", EsifUp_GetInstance(self));
 		esif_ccb_event_wait(&self->deleteEvent);
 
+		EsifUp_DestroyTokenParams(self);
+
+		for (domainIndex = 0; domainIndex < self->domainCount; domainIndex++) {
+			EsifEnergySampler_Uninit(&self->domains[domainIndex].energySampler);
+		}
+
 		esif_ccb_event_uninit(&self->deleteEvent);
 		esif_ccb_lock_uninit(&self->objLock);
+		esif_ccb_lock_uninit(&self->tokenParamsLock);
 
 		esif_ccb_free(self);
 	}
@@ -814,6 +832,7 @@ static eEsifError EsifUp_SelectDspByLpEventData(
 	}
 	else {
 		ESIF_TRACE_DEBUG("Selected DSP (%s) for participant: %s. \n", dspName, EsifUp_GetName(self));
+		EsifUp_BuildTokenParams(self);
 	}
 
 exit:
@@ -847,6 +866,7 @@ static eEsifError EsifUp_SelectDspByUpInterface(
 	}
 	else {
 		ESIF_TRACE_DEBUG("Selected DSP (%s) for participant: %s. \n", dspName, EsifUp_GetName(self));
+		EsifUp_BuildTokenParams(self);
 	}
 
 exit:
@@ -1816,6 +1836,186 @@ exit:
 }
 
 
+static void EsifUp_DestroyTokenParam(void *itemPtr)
+{
+	esif_ccb_free(itemPtr);
+}
+
+
+static void EsifUp_DestroyTokenParamTable(void *itemPtr)
+{
+	esif_ht_destroy((struct esif_ht *)itemPtr, EsifUp_DestroyTokenParam);
+}
+
+
+/* Only called once no other references to the participant remain */
+static void EsifUp_DestroyTokenParams(
+	EsifUpPtr self
+	)
+{
+	struct esif_ht *htPtr = NULL;
+	struct esif_link_list *retiredPtr = NULL;
+
+	esif_ccb_write_lock(&self->tokenParamsLock);
+	htPtr = self->tokenParamsPtr;
+	self->tokenParamsPtr = NULL;
+	retiredPtr = self->retiredTokenParamsPtr;
+	self->retiredTokenParamsPtr = NULL;
+	esif_ccb_write_unlock(&self->tokenParamsLock);
+
+	esif_ht_destroy(htPtr, EsifUp_DestroyTokenParam);
+	if (retiredPtr != NULL) {
+		esif_link_list_free_data_and_destroy(retiredPtr, EsifUp_DestroyTokenParamTable);
+	}
+}
+
+
+/*
+ * Callers of EsifUp_GetTokenReplacedParamString may still be using strings
+ * from the current table, so it is set aside rather than freed and released
+ * with the participant.  If it cannot be set aside it is kept as the current
+ * table.  Caller must hold tokenParamsLock for write.
+ */
+static void EsifUp_RetireTokenParams(
+	EsifUpPtr self
+	)
+{
+	if (NULL == self->tokenParamsPtr) {
+		goto exit;
+	}
+
+	if (NULL == self->retiredTokenParamsPtr) {
+		self->retiredTokenParamsPtr = esif_link_list_create();
+		if (NULL == self->retiredTokenParamsPtr) {
+			goto exit;
+		}
+	}
+
+	if (esif_link_list_add_at_back(self->retiredTokenParamsPtr, self->tokenParamsPtr) == ESIF_OK) {
+		self->tokenParamsPtr = NULL;
+	}
+exit:
+	return;
+}
+
+
+/* Replace the tokens in a parameter and keep the result; caller must hold tokenParamsLock for write */
+static EsifString EsifUp_AddTokenParam(
+	EsifUpPtr self,
+	const EsifFpcPrimitivePtr primitivePtr,
+	const EsifString paramStr
+	)
+{
+	EsifString replacedStr = NULL;
+
+	if (NULL == self->tokenParamsPtr) {
+		self->tokenParamsPtr = esif_ht_create(ESIF_DSP_HASHTABLE_SIZE);
+		if (NULL == self->tokenParamsPtr) {
+			goto exit;
+		}
+	}
+
+	/* Another thread may have added it first */
+	replacedStr = (EsifString)esif_ht_get_item(self->tokenParamsPtr, (UInt8 *)&paramStr, sizeof(paramStr));
+	if (replacedStr != NULL) {
+		goto exit;
+	}
+
+	replacedStr = EsifUp_CreateTokenReplacedParamString(self, primitivePtr, paramStr);
+	if (replacedStr == NULL) {
+		goto exit;
+	}
+
+	if (esif_ht_add_item(self->tokenParamsPtr, (UInt8 *)&paramStr, sizeof(paramStr), replacedStr) != ESIF_OK) {
+		esif_ccb_free(replacedStr);
+		replacedStr = NULL;
+		goto exit;
+	}
+	atomic_inc(&g_upTokenParamFills);
+exit:
+	if ((NULL == replacedStr) && (esif_ccb_strstr(paramStr, "%nm%") != NULL)) {
+		ESIF_TRACE_ERROR("Unable to cache token replaced parameter %s\n", paramStr);
+	}
+	return replacedStr;
+}
+
+
+/* Replace the tokens in every string parameter of the DSP up front */
+static void EsifUp_BuildTokenParams(
+	EsifUpPtr self
+	)
+{
+	EsifDspPtr dspPtr = EsifUp_GetDsp(self);
+	EsifDspDispatchPtr dispatchPtr = NULL;
+	EsifDspDispatchEntryPtr entryPtr = NULL;
+	EsifData param = {0};
+	UInt32 i = 0;
+	UInt32 j = 0;
+	UInt8 k = 0;
+
+	esif_ccb_write_lock(&self->tokenParamsLock);
+	EsifUp_RetireTokenParams(self);
+
+	if ((NULL == dspPtr) || (NULL == dspPtr->dispatch_ptr)) {
+		goto exit;
+	}
+	dispatchPtr = dspPtr->dispatch_ptr;
+
+	for (i = 0; i < dispatchPtr->id_start[dispatchPtr->id_count]; i++) {
+		entryPtr = &dispatchPtr->entries[i];
+		for (j = 0; j < entryPtr->action_count; j++) {
+			for (k = 0; k < NUMBER_OF_PARAMETERS_FOR_AN_ACTION; k++) {
+				if (!entryPtr->actions[j]->param_valid[k] ||
+					(EsifFpcAction_GetParamAsEsifData(entryPtr->actions[j], k, &param) != ESIF_OK) ||
+					(param.type != ESIF_DATA_STRING) || (NULL == param.buf_ptr) ||
+					(NULL == esif_ccb_strstr((EsifString)param.buf_ptr, "%nm%"))) {
+					continue;
+				}
+				EsifUp_AddTokenParam(self, entryPtr->primitive_ptr, (EsifString)param.buf_ptr);
+			}
+		}
+	}
+exit:
+	esif_ccb_write_unlock(&self->tokenParamsLock);
+}
+
+
+EsifString EsifUp_GetTokenReplacedParamString(
+	const EsifUpPtr self,
+	const EsifFpcPrimitivePtr primitivePtr,
+	const EsifString paramStr
+	)
+{
+	EsifString replacedStr = NULL;
+
+	if ((NULL == paramStr) || (NULL == self) || (NULL == primitivePtr)) {
+		goto exit;
+	}
+
+	/* No token, nothing to replace */
+	if (NULL == esif_ccb_strstr(paramStr, "%nm%")) {
+		goto exit;
+	}
+
+	esif_ccb_read_lock(&self->tokenParamsLock);
+	if (self->tokenParamsPtr != NULL) {
+		replacedStr = (EsifString)esif_ht_get_item(self->tokenParamsPtr, (UInt8 *)&paramStr, sizeof(paramStr));
+	}
+	esif_ccb_read_unlock(&self->tokenParamsLock);
+
+	if (replacedStr != NULL) {
+		atomic_inc(&g_upTokenParamHits);
+		goto exit;
+	}
+
+	esif_ccb_write_lock(&self->tokenParamsLock);
+	replacedStr = EsifUp_AddTokenParam(self, primitivePtr, paramStr);
+	esif_ccb_write_unlock(&self->tokenParamsLock);
+exit:
+	return replacedStr;
+}
+
+
 #ifdef ESIF_FEAT_OPT_SIM_SUPPORT_ENABLED
 
 /* Let the simulator handle all primitives first.  If successful, don't do normal processing */
@@ -26,6 +26,7 @@
 #include "esif_uf_eventmgr.h"
 #include "esif_participant.h"
 #include "esif_uf_ccb_thermalapi.h"
+#include "esif_hash_table.h"
 
 #ifdef ESIF_ATTR_OS_WINDOWS
 //
@@ -45,6 +46,9 @@ EsifUppMgr g_uppMgr = {0};
  */
 static atomic_t g_ufpollQuit = ATOMIC_INIT(1);
 static int g_ufpollPeriod = ESIF_UFPOLL_PERIOD_DEFAULT;
+
+/* Name index item for names shared, ignoring case, by more than one entry */
+static EsifUpManagerEntry g_upNameCollision = {0};
 static esif_thread_t g_ufpollThread;
 static void EsifUfPollExit(esif_thread_t *ufpollThread);
 
@@ -122,8 +126,35 @@ static eEsifError EsifUpPm_ActionChangeHandler(
 	EsifDataPtr eventDataPtr
 	);
 
+static Bool EsifUpPm_GetIndexKey(
+	const char *str,
+	Bool foldCase,
+	char *keyPtr,
+	UInt32 *keyLenPtr
+	);
+
+static void EsifUpPm_IndexName(
+	EsifUpManagerEntryPtr entryPtr
+	);
+
+static void EsifUpPm_IndexLpInstances(void);
+
+static void EsifUpPm_AddLiveInstance(
+	const UInt8 upInstance
+	);
+
+static void EsifUpPm_RemoveLiveInstance(
+	const UInt8 upInstance
+	);
+
+static UInt8 EsifUpPm_GetLiveInstances(
+	UInt8 *instancesPtr
+	);
+
 static void *ESIF_CALLCONV EsifUfPollWorkerThread(void *ptr)
 {
+	UInt8 instances[MAX_PARTICIPANT_ENTRY] = {0};
+	UInt8 count = 0;
 	UInt8 i = 0;
 	
 	UNREFERENCED_PARAMETER(ptr);
@@ -135,8 +166,9 @@ static void *ESIF_CALLCONV EsifUfPollWorkerThread(void *ptr)
 	/* check temperature */
 	while (!atomic_read(&g_ufpollQuit)) {
 		
-		for (i = 0; i < MAX_PARTICIPANT_ENTRY; i++) {
-			EsifUpPtr upPtr = EsifUpPm_GetAvailableParticipantByInstance(i);
+		count = EsifUpPm_GetLiveInstances(instances);
+		for (i = 0; i < count; i++) {
+			EsifUpPtr upPtr = EsifUpPm_GetAvailableParticipantByInstance(instances[i]);
 			
 			if (NULL == upPtr) {
 				continue;
@@ -160,6 +192,185 @@ static void EsifUfPollExit(esif_thread_t *ufpollThread)
 	CMD_OUT("Upper Framework Polling Stopped\n");
 }
 
+
+/*
+ * Build the index key for a name or HID in keyPtr (ESIF_NAME_LEN bytes).
+ * Names are upper-cased so that case-insensitive lookups hit the same key.
+ * Returns ESIF_FALSE if the string is NULL or too long to belong to a
+ * participant.
+ */
+static Bool EsifUpPm_GetIndexKey(
+	const char *str,
+	Bool foldCase,
+	char *keyPtr,
+	UInt32 *keyLenPtr
+	)
+{
+	UInt32 len = 0;
+
+	if (NULL == str) {
+		return ESIF_FALSE;
+	}
+
+	for (len = 0; str[len] != '\0'; len++) {
+		if (len >= ESIF_NAME_LEN - 1) {
+			return ESIF_FALSE;
+		}
+		keyPtr[len] = (foldCase ? (char)toupper((unsigned char)str[len]) : str[len]);
+	}
+	keyPtr[len] = '\0';
+	*keyLenPtr = len;
+	return ESIF_TRUE;
+}
+
+
+/*
+ * Add an entry to the name index; the manager lock must be held for writing.
+ * Names that only differ in case share a key, which then maps to
+ * g_upNameCollision so that lookups for it fall back to a scan.
+ */
+static void EsifUpPm_IndexName(
+	EsifUpManagerEntryPtr entryPtr
+	)
+{
+	char key[ESIF_NAME_LEN] = {0};
+	UInt32 keyLen = 0;
+	EsifUpManagerEntryPtr existingPtr = NULL;
+
+	if (!EsifUpPm_GetIndexKey(EsifUp_GetName(entryPtr->fUpPtr), ESIF_TRUE, key, &keyLen) ||
+		(NULL == g_uppMgr.fNameIndexPtr)) {
+		return;
+	}
+
+	existingPtr = (EsifUpManagerEntryPtr)esif_ht_get_item(g_uppMgr.fNameIndexPtr, (u8 *)key, keyLen);
+	if (existingPtr == &g_upNameCollision) {
+		return;
+	}
+	if (existingPtr != NULL) {
+		esif_ht_remove_item(g_uppMgr.fNameIndexPtr, (u8 *)key, keyLen);
+		entryPtr = &g_upNameCollision;
+	}
+
+	if (esif_ht_add_item(g_uppMgr.fNameIndexPtr, (u8 *)key, keyLen, entryPtr) != ESIF_OK) {
+		ESIF_TRACE_ERROR("Unable to index participant %s\n", key);
+	}
+}
+
+
+/*
+ * Rebuild the lower to upper participant instance map.  The lowest upper
+ * instance wins when several share a lower instance, which is what the scan
+ * this replaced returned.  The manager lock must be held for writing.
+ */
+static void EsifUpPm_IndexLpInstances(void)
+{
+	UInt8 i = MAX_PARTICIPANT_ENTRY;
+
+	esif_ccb_memset(g_uppMgr.fLpInstanceMap, ESIF_INSTANCE_INVALID, sizeof(g_uppMgr.fLpInstanceMap));
+
+	while (i-- > 0) {
+		if (g_uppMgr.fEntries[i].fUpPtr != NULL) {
+			g_uppMgr.fLpInstanceMap[EsifUp_GetLpInstance(g_uppMgr.fEntries[i].fUpPtr)] = i;
+		}
+	}
+}
+
+
+/*
+ * Mark an instance as available in the live list and the HID index.  The
+ * caller sets the entry state; the manager lock must be held for writing.
+ */
+static void EsifUpPm_AddLiveInstance(
+	const UInt8 upInstance
+	)
+{
+	EsifUpDataPtr metaPtr = NULL;
+	char key[ESIF_NAME_LEN] = {0};
+	UInt32 keyLen = 0;
+	UInt8 i = 0;
+
+	/* Insert Into The Sorted Live List */
+	for (i = g_uppMgr.fEntryCount; (i > 0) && (g_uppMgr.fLiveInstances[i - 1] > upInstance); i--) {
+		g_uppMgr.fLiveInstances[i] = g_uppMgr.fLiveInstances[i - 1];
+	}
+	g_uppMgr.fLiveInstances[i] = upInstance;
+	g_uppMgr.fEntryCount++;
+
+	metaPtr = EsifUp_GetMetadata(g_uppMgr.fEntries[upInstance].fUpPtr);
+	if ((NULL == metaPtr) || (NULL == g_uppMgr.fHidIndexPtr)) {
+		return;
+	}
+
+	if (EsifUpPm_GetIndexKey(metaPtr->fAcpiDevice, ESIF_FALSE, key, &keyLen) &&
+		(esif_ht_add_item(g_uppMgr.fHidIndexPtr, (u8 *)key, keyLen, &g_uppMgr.fEntries[upInstance]) != ESIF_OK)) {
+		ESIF_TRACE_ERROR("Unable to index participant HID %s\n", key);
+	}
+}
+
+
+/*
+ * Remove an instance from the live list and the HID index.  The caller sets
+ * the entry state; the manager lock must be held for writing.
+ */
+static void EsifUpPm_RemoveLiveInstance(
+	const UInt8 upInstance
+	)
+{
+	EsifUpDataPtr metaPtr = NULL;
+	EsifUpDataPtr otherMetaPtr = NULL;
+	char key[ESIF_NAME_LEN] = {0};
+	UInt32 keyLen = 0;
+	UInt8 i = 0;
+
+	/* Remove From The Sorted Live List */
+	for (i = 0; (i < g_uppMgr.fEntryCount) && (g_uppMgr.fLiveInstances[i] != upInstance); i++)
+		;
+	if (i >= g_uppMgr.fEntryCount) {
+		return;
+	}
+	for (g_uppMgr.fEntryCount--; i < g_uppMgr.fEntryCount; i++) {
+		g_uppMgr.fLiveInstances[i] = g_uppMgr.fLiveInstances[i + 1];
+	}
+
+	metaPtr = EsifUp_GetMetadata(g_uppMgr.fEntries[upInstance].fUpPtr);
+	if ((NULL == metaPtr) || (NULL == g_uppMgr.fHidIndexPtr)) {
+		return;
+	}
+
+	if (!EsifUpPm_GetIndexKey(metaPtr->fAcpiDevice, ESIF_FALSE, key, &keyLen)) {
+		return;
+	}
+
+	/*
+	 * Several participants may share a HID and removal takes the first match,
+	 * so drop them all and put back the ones that are still available.
+	 */
+	while (esif_ht_remove_item(g_uppMgr.fHidIndexPtr, (u8 *)key, keyLen) == ESIF_OK)
+		;
+	for (i = 0; i < g_uppMgr.fEntryCount; i++) {
+		otherMetaPtr = EsifUp_GetMetadata(g_uppMgr.fEntries[g_uppMgr.fLiveInstances[i]].fUpPtr);
+		if ((otherMetaPtr != NULL) && !esif_ccb_strcmp(otherMetaPtr->fAcpiDevice, key)) {
+			esif_ht_add_item(g_uppMgr.fHidIndexPtr, (u8 *)key, keyLen, &g_uppMgr.fEntries[g_uppMgr.fLiveInstances[i]]);
+		}
+	}
+}
+
+
+/* Copy the available instances to instancesPtr (MAX_PARTICIPANT_ENTRY) and return their count */
+static UInt8 EsifUpPm_GetLiveInstances(
+	UInt8 *instancesPtr
+	)
+{
+	UInt8 count = 0;
+
+	esif_ccb_read_lock(&g_uppMgr.fLock);
+	count = g_uppMgr.fEntryCount;
+	esif_ccb_memcpy(instancesPtr, g_uppMgr.fLiveInstances, count * sizeof(*instancesPtr));
+	esif_ccb_read_unlock(&g_uppMgr.fLock);
+
+	return count;
+}
+
 /*
 ** ===========================================================================
 ** PUBLIC
@@ -223,7 +434,8 @@ eEsifError EsifUpPm_RegisterParticipant(
 		*upInstancePtr = EsifUp_GetInstance(upPtr);
 
 		entryPtr->fState = ESIF_PM_PARTICIPANT_STATE_CREATED;
-		g_uppMgr.fEntryCount++;
+		EsifUpPm_AddLiveInstance(*upInstancePtr);
+		EsifUpPm_IndexLpInstances();
 		esif_ccb_write_unlock(&g_uppMgr.fLock);
 		isUppMgrLocked = ESIF_FALSE;
 	}
@@ -266,7 +478,9 @@ eEsifError EsifUpPm_RegisterParticipant(
 
 		g_uppMgr.fEntries[i].fState = ESIF_PM_PARTICIPANT_STATE_CREATED;
 		g_uppMgr.fEntries[i].fUpPtr = upPtr;
-		g_uppMgr.fEntryCount++;
+		EsifUpPm_IndexName(&g_uppMgr.fEntries[i]);
+		EsifUpPm_AddLiveInstance(i);
+		EsifUpPm_IndexLpInstances();
 
 		*upInstancePtr = i;
 
@@ -379,6 +593,8 @@ static eEsifError EsifUpPm_ActionChangeHandler(
 	)
 {
 	eEsifError rc = ESIF_OK;
+	UInt8 instances[MAX_PARTICIPANT_ENTRY] = {0};
+	UInt8 count = 0;
 	UInt8 i = 0;
 	EsifUpPtr upPtr = NULL;
 	UInt32 actionType = 0;
@@ -397,9 +613,10 @@ static eEsifError EsifUpPm_ActionChangeHandler(
 
 	actionType = *((UInt32 *)eventDataPtr->buf_ptr);
 
-	for (i = 0; i < MAX_PARTICIPANT_ENTRY; i++) {
+	count = EsifUpPm_GetLiveInstances(instances);
+	for (i = 0; i < count; i++) {
 
-		upPtr = EsifUpPm_GetAvailableParticipantByInstance(i);
+		upPtr = EsifUpPm_GetAvailableParticipantByInstance(instances[i]);
 		if (NULL == upPtr) {
 			continue;
 		}
@@ -418,14 +635,17 @@ exit:
 eEsifError EsifUFPollStart(int pollInterval)
 {
 	eEsifError rc = ESIF_OK;
+	UInt8 instances[MAX_PARTICIPANT_ENTRY] = {0};
+	UInt8 count = 0;
 	UInt8 i = 0;
 
 	if (pollInterval >= ESIF_UFPOLL_PERIOD_MIN) {
 		g_ufpollPeriod = pollInterval;
 	}
 
-	for (i = 0; i < MAX_PARTICIPANT_ENTRY; i++) {
-		EsifUpPtr upPtr = EsifUpPm_GetAvailableParticipantByInstance(i);
+	count = EsifUpPm_GetLiveInstances(instances);
+	for (i = 0; i < count; i++) {
+		EsifUpPtr upPtr = EsifUpPm_GetAvailableParticipantByInstance(instances[i]);
 		
 		if (NULL == upPtr) {
 			continue;
@@ -445,12 +665,15 @@ eEsifError EsifUFPollStart(int pollInterval)
 void EsifUFPollStop()
 {
 	if (EsifUFPollStarted()) {
+		UInt8 instances[MAX_PARTICIPANT_ENTRY] = {0};
+		UInt8 count = 0;
 		UInt8 i = 0;
 		
 		EsifUfPollExit(&g_ufpollThread);
 
-		for (i = 0; i < MAX_PARTICIPANT_ENTRY; i++) {
-			EsifUpPtr upPtr = EsifUpPm_GetAvailableParticipantByInstance(i);
+		count = EsifUpPm_GetLiveInstances(instances);
+		for (i = 0; i < count; i++) {
+			EsifUpPtr upPtr = EsifUpPm_GetAvailableParticipantByInstance(instances[i]);
 			
 			if (NULL == upPtr) {
 				continue;
@@ -519,7 +742,7 @@ eEsifError EsifUpPm_ResumeParticipant(
 	upPtr = entryPtr->fUpPtr;
 	if ((NULL != upPtr) && (entryPtr->fState < ESIF_PM_PARTICIPANT_STATE_CREATED)) {
 		entryPtr->fState = ESIF_PM_PARTICIPANT_STATE_CREATED;
-		g_uppMgr.fEntryCount++;
+		EsifUpPm_AddLiveInstance(upInstance);
 
 		/*
 			* Get reference on participant before pass it to other function
@@ -572,7 +795,7 @@ eEsifError EsifUpPm_SuspendParticipant(
 		EsifUp_SuspendParticipant(upPtr);
 
 		entryPtr->fState = ESIF_PM_PARTICIPANT_STATE_REMOVED;
-		g_uppMgr.fEntryCount--;
+		EsifUpPm_RemoveLiveInstance(upInstance);
 
 	}
 	else {
@@ -634,56 +857,93 @@ Bool EsifUpPm_DoesAvailableParticipantExistByHID(
 	)
 {
 	Bool bRet = ESIF_FALSE;
-	EsifUpPtr upPtr = NULL;
-	EsifUpDataPtr metaPtr = NULL;
-	UInt8 i;
+	char key[ESIF_NAME_LEN] = {0};
+	UInt32 keyLen = 0;
 
 	if (NULL == participantHID) {
 		ESIF_TRACE_ERROR("The participant HID pointer is NULL\n");
 		goto exit;
 	}
 
+	if (!EsifUpPm_GetIndexKey(participantHID, ESIF_FALSE, key, &keyLen)) {
+		goto exit;
+	}
+
+	/* Only available participants are in the HID index */
 	esif_ccb_read_lock(&g_uppMgr.fLock);
+	if ((g_uppMgr.fHidIndexPtr != NULL) &&
+		(esif_ht_get_item(g_uppMgr.fHidIndexPtr, (u8 *)key, keyLen) != NULL)) {
+		bRet = ESIF_TRUE;
+	}
+	esif_ccb_read_unlock(&g_uppMgr.fLock);
+exit:
+	return bRet;
+}
 
-	for (i = 0; i < MAX_PARTICIPANT_ENTRY; i++) {
-		upPtr = EsifUpPm_GetAvailableParticipantByInstance(i);
 
-		if (NULL == upPtr) {
-			continue;
-		}
+/* Check an entry against a name lookup */
+static Bool EsifUpPm_IsEntryMatch(
+	const EsifUpManagerEntryPtr entryPtr,
+	const char *participantName,
+	Bool ignoreCase,
+	Bool availableOnly
+	)
+{
+	if ((NULL == entryPtr->fUpPtr) ||
+		(availableOnly && (entryPtr->fState <= ESIF_PM_PARTICIPANT_STATE_REMOVED))) {
+		return ESIF_FALSE;
+	}
+	if (ignoreCase) {
+		return (Bool)!esif_ccb_stricmp(participantName, EsifUp_GetName(entryPtr->fUpPtr));
+	}
+	return (Bool)!esif_ccb_strcmp(EsifUp_GetName(entryPtr->fUpPtr), participantName);
+}
 
-		metaPtr = EsifUp_GetMetadata(upPtr);
-		if (NULL == metaPtr) {
-			continue;
-		}
-		if ((g_uppMgr.fEntries[i].fState > ESIF_PM_PARTICIPANT_STATE_REMOVED) && !esif_ccb_strcmp(metaPtr->fAcpiDevice, participantHID)) {
-			bRet = ESIF_TRUE;
-			break;
-		}
 
-		EsifUp_PutRef(upPtr);
-		upPtr = NULL;
-	}
+/*
+ * Find the first entry for a participant name, comparing case-insensitively
+ * if ignoreCase is set and skipping removed participants if availableOnly is
+ * set.  The manager lock must be held.
+ */
+static EsifUpManagerEntryPtr EsifUpPm_GetEntryByName(
+	const char *participantName,
+	Bool ignoreCase,
+	Bool availableOnly
+	)
+{
+	EsifUpManagerEntryPtr entryPtr = NULL;
+	char key[ESIF_NAME_LEN] = {0};
+	UInt32 keyLen = 0;
+	UInt8 i = 0;
 
-	esif_ccb_read_unlock(&g_uppMgr.fLock);
-exit:
-	if (upPtr != NULL) {
-		EsifUp_PutRef(upPtr);
+	if (!EsifUpPm_GetIndexKey(participantName, ESIF_TRUE, key, &keyLen) ||
+		(NULL == g_uppMgr.fNameIndexPtr)) {
+		goto exit;
 	}
 
-	return bRet;
+	entryPtr = (EsifUpManagerEntryPtr)esif_ht_get_item(g_uppMgr.fNameIndexPtr, (u8 *)key, keyLen);
+	if (entryPtr == &g_upNameCollision) {
+		for (i = 0; i < MAX_PARTICIPANT_ENTRY; i++) {
+			if (EsifUpPm_IsEntryMatch(&g_uppMgr.fEntries[i], participantName, ignoreCase, availableOnly)) {
+				break;
+			}
+		}
+		entryPtr = (i < MAX_PARTICIPANT_ENTRY) ? &g_uppMgr.fEntries[i] : NULL;
+	}
+	else if ((entryPtr != NULL) && !EsifUpPm_IsEntryMatch(entryPtr, participantName, ignoreCase, availableOnly)) {
+		entryPtr = NULL;
+	}
+exit:
+	return entryPtr;
 }
 
 
-
 /* Check if a participant already exists by the name */
 Bool EsifUpPm_DoesAvailableParticipantExistByName (
 	char *participantName
 	)
 {
 	Bool bRet = ESIF_FALSE;
-	EsifUpPtr upPtr = NULL;
-	UInt8 i;
 
 	if (NULL == participantName) {
 		ESIF_TRACE_ERROR("The participant name pointer is NULL\n");
@@ -692,28 +952,12 @@ Bool EsifUpPm_DoesAvailableParticipantExistByName (
 
 	esif_ccb_read_lock(&g_uppMgr.fLock);
 
-	for (i = 0; i < MAX_PARTICIPANT_ENTRY; i++) {
-		upPtr = EsifUpPm_GetAvailableParticipantByInstance(i);
-
-		if (NULL == upPtr) {
-			continue;
-		}
-
-		if ((g_uppMgr.fEntries[i].fState > ESIF_PM_PARTICIPANT_STATE_REMOVED) && !esif_ccb_strcmp(EsifUp_GetName(upPtr), participantName)) {
-			bRet = ESIF_TRUE;
-			break;
-		}
-
-		EsifUp_PutRef(upPtr);
-		upPtr = NULL;
+	if (EsifUpPm_GetEntryByName(participantName, ESIF_FALSE, ESIF_TRUE) != NULL) {
+		bRet = ESIF_TRUE;
 	}
 
 	esif_ccb_read_unlock(&g_uppMgr.fLock);
 exit:
-	if (upPtr != NULL) {
-		EsifUp_PutRef(upPtr);
-	}
-	
 	return bRet;
 }
 
@@ -723,7 +967,7 @@ EsifUpPtr EsifUpPm_GetAvailableParticipantByName (
 	)
 {
 	EsifUpPtr upPtr = NULL;
-	UInt8 i;
+	EsifUpManagerEntryPtr entryPtr = NULL;
 
 	if (NULL == participantName) {
 		ESIF_TRACE_ERROR("The participant name pointer is NULL\n");
@@ -732,19 +976,13 @@ EsifUpPtr EsifUpPm_GetAvailableParticipantByName (
 
 	esif_ccb_read_lock(&g_uppMgr.fLock);
 
-	for (i = 0; i < MAX_PARTICIPANT_ENTRY; i++) {
-		upPtr = EsifUpPm_GetAvailableParticipantByInstance(i);
-
-		if (NULL == upPtr) {
-			continue;
-		}
-
-		if (!esif_ccb_stricmp(participantName, EsifUp_GetName(upPtr))) {
-			break;
+	entryPtr = EsifUpPm_GetEntryByName(participantName, ESIF_TRUE, ESIF_TRUE);
+	if (entryPtr != NULL) {
+		upPtr = entryPtr->fUpPtr;
+		if (EsifUp_GetRef(upPtr) != ESIF_OK) {
+			ESIF_TRACE_INFO("Unable to acquire reference on participant\n");
+			upPtr = NULL;
 		}
-
-		EsifUp_PutRef(upPtr);
-		upPtr = NULL;
 	}
 
 	esif_ccb_read_unlock(&g_uppMgr.fLock);
@@ -760,7 +998,6 @@ static EsifUpManagerEntryPtr EsifUpPm_GetParticipantEntryFromMetadata(
 {
 	EsifUpManagerEntryPtr entryPtr = NULL;
 	char *participantName = "";
-	UInt8 i;
 
 	/* Validate parameters */
 	if (NULL == metadataPtr) {
@@ -782,18 +1019,9 @@ static EsifUpManagerEntryPtr EsifUpPm_GetParticipantEntryFromMetadata(
 		break;
 	}
 
-	esif_ccb_write_lock(&g_uppMgr.fLock);
-	for (i = 0; i < MAX_PARTICIPANT_ENTRY; i++) {
-		entryPtr = &g_uppMgr.fEntries[i];
-
-		if (NULL != entryPtr->fUpPtr) {
-			if (!strcmp(EsifUp_GetName(entryPtr->fUpPtr), participantName)) {
-				break;
-			}
-		}
-		entryPtr = NULL;
-	}
-	esif_ccb_write_unlock(&g_uppMgr.fLock);
+	esif_ccb_read_lock(&g_uppMgr.fLock);
+	entryPtr = EsifUpPm_GetEntryByName(participantName, ESIF_FALSE, ESIF_FALSE);
+	esif_ccb_read_unlock(&g_uppMgr.fLock);
 
 exit:
 	return entryPtr;
@@ -807,7 +1035,7 @@ eEsifError EsifUpPm_MapLpidToParticipantInstance(
 	)
 {
 	eEsifError rc    = ESIF_E_INVALID_HANDLE;
-	UInt8 i = 0;
+	UInt8 i = ESIF_INSTANCE_INVALID;
 
 	/* Validate parameters */
 	if (NULL == upInstancePtr) {
@@ -817,13 +1045,7 @@ eEsifError EsifUpPm_MapLpidToParticipantInstance(
 	}
 
 	esif_ccb_read_lock(&g_uppMgr.fLock);
-
-	for (i = 0; i < MAX_PARTICIPANT_ENTRY; i++) {
-		if (g_uppMgr.fEntries[i].fUpPtr && (EsifUp_GetLpInstance(g_uppMgr.fEntries[i].fUpPtr) == lpInstance)) {
-			break;
-		}
-	}
-
+	i = g_uppMgr.fLpInstanceMap[lpInstance];
 	esif_ccb_read_unlock(&g_uppMgr.fLock);
 
 	if (i >= MAX_PARTICIPANT_ENTRY) {
@@ -874,7 +1096,8 @@ eEsifError EsifUpPm_GetNextUp(
 {
 	eEsifError rc = ESIF_OK;
 	EsifUpPtr nextUpPtr = NULL;
-	UInt8 i;
+	UInt8 i = 0;
+	UInt8 nextInstance = ESIF_INSTANCE_INVALID;
 
 	if ((NULL == upPtr) || (NULL == iteratorPtr)) {
 		ESIF_TRACE_WARN("Parameter is NULL\n");
@@ -897,14 +1120,31 @@ eEsifError EsifUpPm_GetNextUp(
 		iteratorPtr->ref_taken = ESIF_FALSE;
 	}
 
-	for (i = iteratorPtr->handle; i < MAX_PARTICIPANT_ENTRY; i++) {
-		nextUpPtr = EsifUpPm_GetAvailableParticipantByInstance(i);
+	/* Take the first available instance at or after the handle */
+	while (iteratorPtr->handle < MAX_PARTICIPANT_ENTRY) {
+		nextInstance = ESIF_INSTANCE_INVALID;
+
+		esif_ccb_read_lock(&g_uppMgr.fLock);
+		for (i = 0; i < g_uppMgr.fEntryCount; i++) {
+			if (g_uppMgr.fLiveInstances[i] >= iteratorPtr->handle) {
+				nextInstance = g_uppMgr.fLiveInstances[i];
+				break;
+			}
+		}
+		esif_ccb_read_unlock(&g_uppMgr.fLock);
+
+		if (nextInstance >= MAX_PARTICIPANT_ENTRY) {
+			break;
+		}
+
+		nextUpPtr = EsifUpPm_GetAvailableParticipantByInstance(nextInstance);
 		if (nextUpPtr != NULL) {
-			iteratorPtr->handle = i;
+			iteratorPtr->handle = nextInstance;
 			iteratorPtr->upPtr = nextUpPtr;
 			iteratorPtr->ref_taken = ESIF_TRUE;
 			break;
 		}
+		iteratorPtr->handle = nextInstance + 1;
 	}
 
 	*upPtr = nextUpPtr;
@@ -927,6 +1167,25 @@ eEsifError EsifUpPm_Init(void)
 	/* Initialize Lock */
 	esif_ccb_lock_init(&g_uppMgr.fLock);
 
+	/* Initialize Indexes */
+	g_uppMgr.fNameIndexPtr = esif_ht_create(MAX_PARTICIPANT_ENTRY);
+	g_uppMgr.fHidIndexPtr = esif_ht_create(MAX_PARTICIPANT_ENTRY);
+	if ((NULL == g_uppMgr.fNameIndexPtr) || (NULL == g_uppMgr.fHidIndexPtr)) {
+		ESIF_TRACE_ERROR("Unable to create participant indexes\n");
+		if (g_uppMgr.fNameIndexPtr != NULL) {
+			esif_ht_destroy(g_uppMgr.fNameIndexPtr, NULL);
+		}
+		if (g_uppMgr.fHidIndexPtr != NULL) {
+			esif_ht_destroy(g_uppMgr.fHidIndexPtr, NULL);
+		}
+		g_uppMgr.fNameIndexPtr = NULL;
+		g_uppMgr.fHidIndexPtr = NULL;
+		esif_ccb_lock_uninit(&g_uppMgr.fLock);
+		rc = ESIF_E_NO_MEMORY;
+		goto exit;
+	}
+	esif_ccb_memset(g_uppMgr.fLpInstanceMap, ESIF_INSTANCE_INVALID, sizeof(g_uppMgr.fLpInstanceMap));
+
 	EsifEventMgr_RegisterEventByType(ESIF_EVENT_PARTICIPANT_CREATE, EVENT_MGR_MATCH_ANY, EVENT_MGR_DOMAIN_D0, EsifUpPm_EventCallback, NULL);
 	EsifEventMgr_RegisterEventByType(ESIF_EVENT_PARTICIPANT_SUSPEND, EVENT_MGR_MATCH_ANY, EVENT_MGR_DOMAIN_D0, EsifUpPm_EventCallback, NULL);
 	EsifEventMgr_RegisterEventByType(ESIF_EVENT_PARTICIPANT_RESUME, EVENT_MGR_MATCH_ANY, EVENT_MGR_DOMAIN_D0, EsifUpPm_EventCallback, NULL);
@@ -934,6 +1193,7 @@ eEsifError EsifUpPm_Init(void)
 	EsifEventMgr_RegisterEventByType(ESIF_EVENT_ACTION_LOADED, EVENT_MGR_MATCH_ANY, EVENT_MGR_DOMAIN_D0, EsifUpPm_EventCallback, NULL);
 	EsifEventMgr_RegisterEventByType(ESIF_EVENT_ACTION_UNLOADED, EVENT_MGR_MATCH_ANY, EVENT_MGR_DOMAIN_D0, EsifUpPm_EventCallback, NULL);
 
+exit:
 	ESIF_TRACE_EXIT_INFO_W_STATUS(rc);
 	return rc;
 }
@@ -986,6 +1246,14 @@ static eEsifError EsifUpPm_DestroyParticipants(void)
 		entryPtr->fState = ESIF_PM_PARTICIPANT_STATE_AVAILABLE;
 	}
 
+	/* The entries are all free now, so drop the indexes over them */
+	esif_ht_destroy(g_uppMgr.fNameIndexPtr, NULL);
+	esif_ht_destroy(g_uppMgr.fHidIndexPtr, NULL);
+	g_uppMgr.fNameIndexPtr = NULL;
+	g_uppMgr.fHidIndexPtr = NULL;
+	g_uppMgr.fEntryCount = 0;
+	esif_ccb_memset(g_uppMgr.fLpInstanceMap, ESIF_INSTANCE_INVALID, sizeof(g_uppMgr.fLpInstanceMap));
+
 	esif_ccb_write_unlock(&g_uppMgr.fLock);
 
 	ESIF_TRACE_INFO("The participants are destroyed in ESIF UF participant manager\n");
@@ -292,6 +292,78 @@ exit:
 	return rc;
 }
 
+/*
+ * Execute a list of GET_* primitives in a single call.  The response buffer
+ * is carved into one 8 byte aligned slot per item and each item is executed
+ * with the same handle validation as EsifSvcPrimitiveExec.
+ */
+eEsifError ESIF_CALLCONV EsifSvcPrimitiveBatchExec(
+	const void *esifHandle,
+	const void *appHandle,
+	EsifPrimitiveBatchItemPtr items,
+	const UInt32 itemCount,
+	EsifDataPtr responsePtr
+	)
+{
+	eEsifError rc = ESIF_OK;
+	EsifData void_request = {ESIF_DATA_VOID, NULL, 0, 0};
+	EsifData item_response = {0};
+	UInt64 required_size = 0;
+	UInt32 i = 0;
+
+	if ((NULL == esifHandle) || (NULL == appHandle)) {
+		ESIF_TRACE_ERROR("Invalid esif or app handle\n");
+		rc = ESIF_E_INVALID_HANDLE;
+		goto exit;
+	}
+
+	if ((NULL == items) || (NULL == responsePtr)) {
+		ESIF_TRACE_ERROR("Invalid batch item or response buffer pointer\n");
+		rc = ESIF_E_PARAMETER_IS_NULL;
+		goto exit;
+	}
+
+	/* Assign each item its slot before executing anything */
+	for (i = 0; i < itemCount; i++) {
+		items[i].fOffset = (UInt32)required_size;
+		items[i].fDataLength = 0;
+		items[i].fStatus = ESIF_E_UNSPECIFIED;
+		required_size += ESIF_PRIMITIVE_BATCH_ALIGN((UInt64)items[i].fResponseSize);
+		if (required_size > 0xFFFFFFFF) {
+			rc = ESIF_E_PARAMETER_IS_OUT_OF_BOUNDS;
+			goto exit;
+		}
+	}
+
+	if ((responsePtr->buf_len < required_size) || ((NULL == responsePtr->buf_ptr) && (required_size > 0))) {
+		responsePtr->data_len = (UInt32)required_size;
+		rc = ESIF_E_NEED_LARGER_BUFFER;
+		goto exit;
+	}
+
+	for (i = 0; i < itemCount; i++) {
+		item_response.type = (enum esif_data_type)items[i].fResponseType;
+		item_response.buf_ptr = (UInt8 *)responsePtr->buf_ptr + items[i].fOffset;
+		item_response.buf_len = items[i].fResponseSize;
+		item_response.data_len = 0;
+
+		items[i].fStatus = EsifSvcPrimitiveExec(esifHandle,
+			appHandle,
+			items[i].fParticipantHandle,
+			items[i].fDomainHandle,
+			&void_request,
+			&item_response,
+			(ePrimitiveType)items[i].fPrimitive,
+			items[i].fInstance);
+		items[i].fDataLength = item_response.data_len;
+	}
+	responsePtr->data_len = (UInt32)required_size;
+
+	ESIF_TRACE_DEBUG("Executed batch of %u primitives (%u bytes)\n", itemCount, (UInt32)required_size);
+exit:
+	return rc;
+}
+
 /* Provide write access to ESIF log object */
 eEsifError ESIF_CALLCONV EsifSvcWriteLog(
 	const void *esifHandle,
@@ -48,6 +48,12 @@ eEsifError ESIF_CALLCONV EsifSvcPrimitiveExec(const void *esifHandle,
 								const ePrimitiveType primitive,
 								const UInt8 instance);
 
+eEsifError ESIF_CALLCONV EsifSvcPrimitiveBatchExec(const void *esifHandle,
+								const void *appHandle,
+								EsifPrimitiveBatchItemPtr items,
+								const UInt32 itemCount,
+								EsifDataPtr responsePtr);
+
 eEsifError ESIF_CALLCONV EsifSvcWriteLog(const void *esifHandle,
 						   const void *appHandle,
 						   const void *participantHandle,
@@ -3320,9 +3320,29 @@ static char *esif_shell_cmd_memstats(EsifShellCmdPtr shell)
 		reset = 1;
 	}
 
+	/* Upper Framework counters are kept locally, so show them even without the LF */
+	*output = 0;
+	if (FORMAT_TEXT == g_format) {
+		esif_ccb_sprintf(OUT_BUF_LEN, output,
+						 "\nUF Memory Stats: \n"
+						 "-----------------------\n");
+#ifdef ESIF_ATTR_MEMTRACE
+		esif_ccb_sprintf_concat(OUT_BUF_LEN, output,
+						 "MemAllocs:       " ATOMIC_FMT "\n"
+						 "MemFrees:        " ATOMIC_FMT "\n",
+						 atomic_read(&g_memtrace.allocs),
+						 atomic_read(&g_memtrace.frees));
+#endif
+		esif_ccb_sprintf_concat(OUT_BUF_LEN, output,
+						 "TokenParamHits:  " ATOMIC_FMT "\n"
+						 "TokenParamFills: " ATOMIC_FMT "\n",
+						 atomic_read(&g_upTokenParamHits),
+						 atomic_read(&g_upTokenParamFills));
+	}
+
 	ipc_ptr = esif_ipc_alloc_command(&command_ptr, data_len);
 	if (NULL == ipc_ptr || NULL == command_ptr) {
-		esif_ccb_sprintf(OUT_BUF_LEN, output, "%s: esif_ipc_alloc_command failed for %u bytes\n",
+		esif_ccb_sprintf_concat(OUT_BUF_LEN, output, "%s: esif_ipc_alloc_command failed for %u bytes\n",
 						 ESIF_FUNC, data_len);
 		goto exit;
 	}
@@ -3340,13 +3360,13 @@ static char *esif_shell_cmd_memstats(EsifShellCmdPtr shell)
 	ipc_execute(ipc_ptr);
 
 	if (ESIF_OK != ipc_ptr->return_code) {
-		esif_ccb_sprintf(OUT_BUF_LEN, output, "%s: ipc error code = %s(%d)\n",
+		esif_ccb_sprintf_concat(OUT_BUF_LEN, output, "%s: ipc error code = %s(%d)\n",
 						 ESIF_FUNC, esif_rc_str(ipc_ptr->return_code), ipc_ptr->return_code);
 		goto exit;
 	}
 
 	if (ESIF_OK != command_ptr->return_code) {
-		esif_ccb_sprintf(OUT_BUF_LEN, output, "%s: command error code = %s(%d)\n",
+		esif_ccb_sprintf_concat(OUT_BUF_LEN, output, "%s: command error code = %s(%d)\n",
 						 ESIF_FUNC, esif_rc_str(command_ptr->return_code), command_ptr->return_code);
 		goto exit;
 	}
@@ -3354,7 +3374,7 @@ static char *esif_shell_cmd_memstats(EsifShellCmdPtr shell)
 	// Our data
 	data_ptr = (struct esif_command_get_memory_stats *)(command_ptr + 1);
 	if (FORMAT_TEXT == g_format) {
-		esif_ccb_sprintf(OUT_BUF_LEN, output,
+		esif_ccb_sprintf_concat(OUT_BUF_LEN, output,
 						 "\nGlobal Memory Stats: \n"
 						 "-----------------------\n"
 						 "MemAllocs: %u\n"
@@ -3364,7 +3384,7 @@ static char *esif_shell_cmd_memstats(EsifShellCmdPtr shell)
 						 data_ptr->stats.frees,
 						 data_ptr->stats.allocs - data_ptr->stats.frees);
 	} else {
-		esif_ccb_sprintf(OUT_BUF_LEN, output,
+		esif_ccb_sprintf_concat(OUT_BUF_LEN, output,
 						 "<memstats>\n"
 						 "  <global>\n"
 						 "    <memAllocs>%u</memAllocs>\n"
@@ -4576,7 +4596,7 @@ char *esif_shell_cmd_trace(EsifShellCmdPtr shell)
 			}
 			CMD_OUT("\n");
 		}
-		CMD_OUT("\n");
+		CMD_OUT("\nTrace Ring Overflows: %llu\n\n", (unsigned long long)EsifTraceRing_GetOverflows());
 	}
 	return output;
 }
@@ -6085,11 +6105,16 @@ static char *esif_shell_cmd_event(EsifShellCmdPtr shell)
 		}
 	}
 
-	EsifEventMgr_SignalEvent(participant_id, domain_id, event_type, eventDataPtr);
+	rc = EsifEventMgr_SignalEvent(participant_id, domain_id, event_type, eventDataPtr);
 
 	esif_ccb_sprintf(OUT_BUF_LEN, output,
 					 "\nSEND EVENT %s(%d) PARTICIPANT %d DOMAIN %d\n", esif_event_type_str(event_type), event_type, participant_id, domain_id);
 
+	if (rc != ESIF_OK) {
+		esif_ccb_sprintf_concat(OUT_BUF_LEN, output, "Event Queue Overflows: %llu\n",
+			(unsigned long long)EsifEventMgr_GetQueueOverflows());
+	}
+
 exit:
 	if (rc != ESIF_OK) {
 		esif_ccb_sprintf_concat(OUT_BUF_LEN, output, "Error: RC = %s(%d)\n",
@@ -6233,6 +6258,9 @@ static char *esif_shell_cmd_help(EsifShellCmdPtr shell)
 		"ui getmodulesingroup <appname> <groupId> Get A List Of Modules For The Group\n"
 		"ui getmoduledata <appname> <groupId> <moduleId>\n"
 		"                                         Get Data For The App/Group/Module\n"
+		"                                         Append 'json' to the getgroups,\n"
+		"                                         getmodulesingroup or getmoduledata\n"
+		"                                         arguments to return JSON, not XML\n"
 		"\n"
 		"DSP COMMANDS:\n"
 		"dsps                                     List all loaded DSPs\n"
@@ -6301,6 +6329,7 @@ static char *esif_shell_cmd_help(EsifShellCmdPtr shell)
 		"config open   [@datavault]               Open and Load DataVault\n"
 		"config close  [@datavault]               Close DataVault\n"
 		"config drop   [@datavault]               Drop Closed DataVault\n"
+		"config benchmark [sets]                  Measure Persisted SET Latency\n"
 		"config get    [@datavault] <key>         Get DataVault Key (or wildcard)\n"
 		"config set    [@datavault] <key> <value> [ESIF_DATA_TYPE] [option ...]\n"
 		"                                         Set DataVault Key/Value/Type\n"
@@ -6397,14 +6426,18 @@ static char *esif_shell_cmd_help(EsifShellCmdPtr shell)
 		"                                        Logs the participant data log to the\n"
 		"                                        specified target.The target can be any\n"
 		"                                        of the following\n"
-		"                                        (CONSOLE,EVENTVIEWER,DEBUGGER,FILE,ALL)\n"
+		"                                        (CONSOLE,EVENTVIEWER,DEBUGGER,FILE,\n"
+		"                                        BINARY,ALL)\n"
 		"                                        Default target is FILE\n"
 		"                                        If all is specified as target, then\n"
 		"                                        log target is set for all the available\n"
-		"                                        targets\n"
+		"                                        text targets\n"
+		"                                        BINARY logs to a compressed binary file\n"
+		"                                        (.bin) that convert turns into the\n"
+		"                                        FILE format\n"
 		"                                        Filename is optional and will be\n"
-		"                                        considered only if file is specified\n"
-		"                                        as target and filename should be the\n"
+		"                                        considered only if file or binary is\n"
+		"                                        specified as target and filename should be the\n"
 		"                                        following argument immediately after\n"
 		"                                        it.If no filename is specified, By\n"
 		"                                        default a new file will be created\n"
@@ -6416,6 +6449,11 @@ static char *esif_shell_cmd_help(EsifShellCmdPtr shell)
 		"                                        for file and new file will be created\n"
 		"participantlog "PARTICIPANTLOG_CMD_STOP_STR"                     Stops participant data logging if\n"
 		"                                        started already\n"
+		"participantlog "PARTICIPANTLOG_CMD_CONVERT_STR" <binfile> [filename]\n"
+		"                                        Converts a binary participant log to\n"
+		"                                        the text format of the FILE target.\n"
+		"                                        Default output is binfile with a .csv\n"
+		"                                        extension\n"
 		"\n"										  
 		"USER-MODE TRACE LOGGING:\n"
 		"trace                             Show User Mode Trace Settings\n"
@@ -6475,21 +6513,25 @@ static char *esif_shell_cmd_ui(EsifShellCmdPtr shell)
 		if (argc >= 3)
 			appname_str = argv[2];
 	}
-	// ui getgroups <appname>
+	// ui getgroups <appname> [json]
 	else if (esif_ccb_stricmp(subcmd, "getgroups")==0) {
 		command = eAppStatusCommandGetGroups;
 		if (argc >= 3)
 			appname_str = argv[2];
+		if (argc >= 4 && esif_ccb_stricmp(argv[3], "json")==0)
+			appStatusIn |= ESIF_APP_STATUS_FORMAT_JSON;
 	}
-	// ui getmodulesingroup <appname> <gid>
+	// ui getmodulesingroup <appname> <gid> [json]
 	else if (esif_ccb_stricmp(subcmd, "getmodulesingroup")==0 && argc >= 4) {
 		command = eAppStatusCommandGetModulesInGroup;
 
 		appname_str = argv[2];
 		gid  = (u8)esif_atoi(argv[3]);
 		appStatusIn = gid;
+		if (argc >= 5 && esif_ccb_stricmp(argv[4], "json")==0)
+			appStatusIn |= ESIF_APP_STATUS_FORMAT_JSON;
 	}
-	// ui getmoduledata <appname> <gid> <mid>
+	// ui getmoduledata <appname> <gid> <mid> [json]
 	else if (esif_ccb_stricmp(subcmd, "getmoduledata")==0 && argc >= 5) {
 		command = eAppStatusCommandGetModuleData;
 
@@ -6501,6 +6543,8 @@ static char *esif_shell_cmd_ui(EsifShellCmdPtr shell)
 		gmid = gmid << 16;
 		gmid = gmid | mid;
 		appStatusIn = gmid;
+		if (argc >= 6 && esif_ccb_stricmp(argv[5], "json")==0)
+			appStatusIn |= ESIF_APP_STATUS_FORMAT_JSON;
 	}
 	// unknown subcmd
 	else {
@@ -6546,13 +6590,15 @@ static char *esif_shell_cmd_web(EsifShellCmdPtr shell)
 	// web [status]
 	if (argc < 2 || esif_ccb_stricmp(argv[1], "status")==0) {
 		esif_ccb_sprintf(OUT_BUF_LEN, output, "web server %s\n", (EsifWebIsStarted() ? "started" : "stopped"));
+		esif_ccb_sprintf_concat(OUT_BUF_LEN, output, "broadcast frames dropped: %llu\n", (unsigned long long)EsifWebGetDroppedFrames());
 	}
-	// web start [restricted] [ip.addr] [port]
+	// web start [restricted] [ip.addr] [port] [maxclients]
 	else if (esif_ccb_stricmp(argv[1], "start")==0) {
 		if (!EsifWebIsStarted()) {
 			int arg=2;
 			char *ipaddr = NULL;
 			u32 port = 0;
+			u32 maxClients = 0;
 			Bool restricted = ESIF_FALSE;
 			Bool forbidden = ESIF_FALSE;
 			int tries = 0;
@@ -6567,6 +6613,9 @@ static char *esif_shell_cmd_web(EsifShellCmdPtr shell)
 			if (argc > arg && isdigit(argv[arg][0])) {
 				port = esif_atoi(argv[arg++]);
 			}
+			if (argc > arg && isdigit(argv[arg][0])) {
+				maxClients = esif_atoi(argv[arg++]);
+			}
 
 			// Verify Access Control
 			if ((DCfg_Get().opt.GenericUIAccessControl && !restricted) || (DCfg_Get().opt.RestrictedUIAccessControl && restricted)) {
@@ -6574,6 +6623,7 @@ static char *esif_shell_cmd_web(EsifShellCmdPtr shell)
 			}
 			else {
 				EsifWebSetIpaddrPort(ipaddr, port, restricted);
+				EsifWebSetMaxClients(maxClients);
 				EsifWebStart();
 
 				// thread synchronization delay for output
@@ -7153,6 +7203,94 @@ static char *esif_shell_cmd_config(EsifShellCmdPtr shell)
 			char datavault[MAX_PATH]={0};
 			esif_build_path(datavault, MAX_PATH, ESIF_PATHTYPE_DV, namesp, ESIFDV_FILEEXT);
 			ignore = esif_ccb_unlink(datavault);
+			esif_build_path(datavault, MAX_PATH, ESIF_PATHTYPE_DV, namesp, ESIFDV_JOURNALFILEEXT);
+			ignore = esif_ccb_unlink(datavault);
+		}
+	}
+	// config benchmark [sets]
+	else if (esif_ccb_stricmp(subcmd, "benchmark")==0) {
+		static const UInt32 vault_keys[] = { 100, 1000, 10000 };
+		UInt32 sets = (argc > opt ? (UInt32)esif_atoi(argv[opt++]) : 100);
+		size_t j = 0;
+
+		if (sets == 0) {
+			sets = 100;
+		}
+		CMD_OUT("\n  Keys   Sets   Avg Set(us)  Max Set(us)  Full Write(us)\n  ------ ------ ------------ ------------ --------------\n");
+
+		// Measure persisted SETs against a temporary DataVault of each size
+		for (j = 0; rc == ESIF_OK && j < sizeof(vault_keys) / sizeof(vault_keys[0]); j++) {
+			char datavault[MAX_PATH] = {0};
+			char journal[MAX_PATH] = {0};
+			char key[32] = {0};
+			UInt32 number = 0;
+			EsifData path = { ESIF_DATA_STRING };
+			EsifData value = { ESIF_DATA_UINT32 };
+			esif_ccb_time_t start = 0;
+			UInt64 elapsed = 0;
+			UInt64 total = 0;
+			UInt64 longest = 0;
+			UInt64 fullwrite = 0;
+			UInt32 k = 0;
+			DataVaultPtr DB = DataVault_Create("dvbench");
+
+			if (DB == NULL) {
+				rc = ESIF_E_NO_MEMORY;
+				break;
+			}
+			esif_build_path(datavault, sizeof(datavault), ESIF_PATHTYPE_DV, DB->name, ESIFDV_FILEEXT);
+			esif_build_path(journal, sizeof(journal), ESIF_PATHTYPE_DV, DB->name, ESIFDV_JOURNALFILEEXT);
+			esif_ccb_unlink(datavault);
+			esif_ccb_unlink(journal);
+			IOStream_SetFile(DB->stream, datavault, "rb");
+
+			path.buf_ptr = key;
+			path.buf_len = sizeof(key);
+			value.buf_ptr = &number;
+			value.buf_len = value.data_len = sizeof(number);
+
+			// Populate the DataVault and write it in full
+			for (k = 0; rc == ESIF_OK && k < vault_keys[j]; k++) {
+				esif_ccb_sprintf(sizeof(key), key, "/benchmark/%05u", k);
+				path.data_len = (u32)esif_ccb_strlen(key, sizeof(key)) + 1;
+				number = k;
+				esif_ccb_write_lock(&DB->lock);
+				rc = DataVault_SetValue(DB, &path, &value, ESIF_SERVICE_CONFIG_PERSIST);
+				esif_ccb_write_unlock(&DB->lock);
+			}
+			if (rc == ESIF_OK) {
+				esif_ccb_write_lock(&DB->lock);
+				start = esif_ccb_monotonic_time_usec();
+				rc = DataVault_CompactJournal(DB);
+				fullwrite = esif_ccb_monotonic_time_usec() - start;
+				esif_ccb_write_unlock(&DB->lock);
+			}
+
+			// Update existing keys one at a time
+			for (k = 0; rc == ESIF_OK && k < sets; k++) {
+				esif_ccb_sprintf(sizeof(key), key, "/benchmark/%05u", (k * 7919) % vault_keys[j]);
+				path.data_len = (u32)esif_ccb_strlen(key, sizeof(key)) + 1;
+				number = k;
+				start = esif_ccb_monotonic_time_usec();
+				esif_ccb_write_lock(&DB->lock);
+				rc = DataVault_SetValue(DB, &path, &value, ESIF_SERVICE_CONFIG_PERSIST);
+				esif_ccb_write_unlock(&DB->lock);
+				elapsed = esif_ccb_monotonic_time_usec() - start;
+				total += elapsed;
+				longest = esif_ccb_max(longest, elapsed);
+			}
+
+			if (rc == ESIF_OK) {
+				CMD_OUT("  %-6u %-6u %-12llu %-12llu %llu\n", vault_keys[j], sets, (unsigned long long)(total / sets), (unsigned long long)longest, (unsigned long long)fullwrite);
+			}
+			DataVault_Destroy(DB);
+			esif_ccb_unlink(datavault);
+			esif_ccb_unlink(journal);
+		}
+		CMD_OUT("\n");
+
+		if (rc != ESIF_OK) {
+			esif_ccb_sprintf(OUT_BUF_LEN, output, "%s\n", esif_rc_str(rc));
 		}
 	}
 	// config select @datavault
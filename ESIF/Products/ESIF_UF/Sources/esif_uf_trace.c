@@ -18,6 +18,7 @@
 
 #include "esif.h"
 #include "esif_uf_trace.h"
+#include "esif_ccb_atomic.h"
 
 #ifdef ESIF_ATTR_OS_WINDOWS
 /*
@@ -108,12 +109,710 @@ const char *EsifTraceModule_ToString(enum esif_tracemodule val)
 	return str;
 }
 
-int EsifUfTraceMessageArgs(
+/*
+ * Asynchronous Trace Ring
+ *
+ * Each tracing thread owns a single-producer/single-consumer ring that holds trace messages
+ * as binary records (timestamp, module, level, format pointer, raw arguments). A background
+ * drainer thread formats the records and routes them in batches, so the calling thread never
+ * formats, allocates or waits on file I/O. The drainer polls the rings periodically and is woken
+ * early whenever a ring becomes half full. Messages that do not fit in a full ring are dropped
+ * and counted as overflows. Messages with conversions that cannot be captured (%n, %ls, %lc)
+ * or that are too large for the ring are routed synchronously.
+ */
+#define ESIF_TRACERING_SIZE			(64 * 1024)					/* Ring Size per Thread */
+#define ESIF_TRACERING_MAX_RECORD	(ESIF_TRACERING_SIZE / 4)	/* Max Record Size */
+#define ESIF_TRACERING_DRAIN_MS		50							/* Drainer Polling Interval */
+#define ESIF_TRACERING_MAX_SPEC		48							/* Max Conversion Spec Length */
+#define ESIF_TRACERING_NULLSTR		0xFFFFFFFF					/* Captured NULL String */
+#define ESIF_TRACERING_ALIGN(size)	(((size) + 7) & ~((size_t)7))
+#define ESIF_TRACE_MODULES_LEN		512							/* Max Module Names List Length */
+
+/* Captured Argument Types, based on printf Conversion and Length Modifier */
+typedef enum EsifTraceArgType_e {
+	TRACEARG_NONE = 0,		/* Unsupported Conversion */
+	TRACEARG_INT,			/* %d %u %x %c and hh/h variants */
+	TRACEARG_LONG,			/* %ld %lu %lx */
+	TRACEARG_LLONG,			/* %lld %llu %llx %qd %jd */
+	TRACEARG_SIZE,			/* %zd %zu %zx */
+	TRACEARG_PTRDIFF,		/* %td %tu */
+	TRACEARG_DOUBLE,		/* %f %e %g %a */
+	TRACEARG_LDOUBLE,		/* %Lf %Le %Lg %La */
+	TRACEARG_POINTER,		/* %p */
+	TRACEARG_STRING,		/* %s */
+} EsifTraceArgType;
+
+/* Parsed printf Conversion Specification */
+typedef struct EsifTraceSpec_s {
+	const char			*start;			/* Start of Spec ("%") */
+	size_t				len;			/* Spec Length */
+	Bool				starWidth;		/* Width is an int Argument */
+	Bool				starPrecision;	/* Precision is an int Argument */
+	EsifTraceArgType	type;			/* Argument Type */
+} EsifTraceSpec;
+
+/* Trace Ring Record Header, followed by Captured Arguments */
+typedef struct EsifTraceRecord_s {
+	UInt32				size;		/* Record Size including Header, or 0 = Wrap to Start of Ring */
+	int					level;		/* Trace Level */
+	esif_tracemask_t	module;		/* Trace Module Mask */
+	int					line;		/* Source Line */
+	esif_ccb_time_t		msec;		/* Timestamp */
+	const char			*func;		/* Source Function */
+	const char			*file;		/* Source File */
+	const char			*msg;		/* Message Format (String Literal) */
+} EsifTraceRecord, *EsifTraceRecordPtr;
+
+/* Per-Thread Trace Ring. head and tail are running byte counts */
+typedef struct EsifTraceRing_s {
+	atomic_t				head;		/* Bytes Written by Owning Thread */
+	atomic_t				tail;		/* Bytes Consumed by Drainer */
+	atomic_t				orphaned;	/* Owning Thread has Exited */
+	struct EsifTraceRing_s	*next;		/* Next Registered Ring */
+	UInt8					buffer[ESIF_TRACERING_SIZE];
+} EsifTraceRing, *EsifTraceRingPtr;
+
+/* Growable Text Buffer used by the Drainer */
+typedef struct EsifTraceText_s {
+	char	*buf;
+	size_t	buf_len;
+	size_t	data_len;
+} EsifTraceText;
+
+static struct {
+	atomic_t			active;		/* Capture Messages in Trace Rings */
+	atomic_t			writers;	/* Threads inside EsifTraceRing_Capture */
+	Bool				exitFlag;	/* Stop Drainer Thread */
+	esif_ccb_tls_t		tlsKey;		/* Calling Thread's Trace Ring */
+	esif_ccb_lock_t		lock;		/* Registered Rings Lock */
+	EsifTraceRingPtr	rings;		/* Registered Rings */
+	esif_thread_t		drainer;	/* Drainer Thread */
+	esif_ccb_sem_t		wakeup;		/* Wake Drainer Thread */
+	atomic_t			overflows;	/* Dropped Messages */
+	EsifTraceText		text;		/* Drainer Message Buffer */
+} g_traceRing;
+
+/* Marks the Drainer thread, which always routes its own messages synchronously */
+#define ESIF_TRACERING_NORING	((void *)&g_traceRing)
+
+static int EsifUfTraceRoute(
+	esif_tracemask_t module,
+	int level,
+	const char *func,
+	const char *file,
+	int line,
+	esif_ccb_time_t msec,
+	const char *msg,
+	va_list arglist);
+
+/* Parse the printf Conversion Specification at fmt, which points to a "%" */
+static void EsifTraceSpec_Parse(
+	const char *fmt,
+	EsifTraceSpec *spec)
+{
+	const char *ch = fmt + 1;
+	int longs = 0;
+	char length = 0;
+
+	esif_ccb_memset(spec, 0, sizeof(*spec));
+	spec->start = fmt;
+
+	while (*ch && esif_ccb_strchr("-+ #0'", *ch) != NULL)
+		ch++;
+	if (*ch == '*') {
+		spec->starWidth = ESIF_TRUE;
+		ch++;
+	}
+	while (*ch >= '0' && *ch <= '9')
+		ch++;
+	if (*ch == '.') {
+		ch++;
+		if (*ch == '*') {
+			spec->starPrecision = ESIF_TRUE;
+			ch++;
+		}
+		while (*ch >= '0' && *ch <= '9')
+			ch++;
+	}
+	while (*ch && esif_ccb_strchr("hlqLzjt", *ch) != NULL) {
+		if (*ch == 'l')
+			longs++;
+		else if (*ch == 'q')
+			longs = 2;
+		else if (*ch != 'h')
+			length = *ch;
+		ch++;
+	}
+
+	switch (*ch) {
+	case 'd':
+	case 'i':
+	case 'u':
+	case 'o':
+	case 'x':
+	case 'X':
+		if (length == 'z')
+			spec->type = TRACEARG_SIZE;
+		else if (length == 't')
+			spec->type = TRACEARG_PTRDIFF;
+		else if (longs >= 2 || length == 'j')
+			spec->type = TRACEARG_LLONG;
+		else if (longs == 1)
+			spec->type = TRACEARG_LONG;
+		else
+			spec->type = TRACEARG_INT;
+		break;
+	case 'c':
+		spec->type = (longs ? TRACEARG_NONE : TRACEARG_INT);
+		break;
+	case 's':
+		spec->type = (longs ? TRACEARG_NONE : TRACEARG_STRING);
+		break;
+	case 'p':
+		spec->type = TRACEARG_POINTER;
+		break;
+	case 'f':
+	case 'F':
+	case 'e':
+	case 'E':
+	case 'g':
+	case 'G':
+	case 'a':
+	case 'A':
+		spec->type = (length == 'L' ? TRACEARG_LDOUBLE : TRACEARG_DOUBLE);
+		break;
+	default:
+		spec->type = TRACEARG_NONE;
+		break;
+	}
+	if (*ch)
+		ch++;
+	spec->len = (size_t)(ch - fmt);
+	if (spec->len > ESIF_TRACERING_MAX_SPEC)
+		spec->type = TRACEARG_NONE;
+}
+
+/* Rebuild a Conversion Specification with any "*" Width and Precision replaced by their captured values */
+static void EsifTraceSpec_Build(
+	const EsifTraceSpec *spec,
+	int width,
+	int precision,
+	char *buffer,
+	size_t buf_len)
+{
+	const char *ch = spec->start;
+	const char *end = spec->start + spec->len;
+	size_t len = 0;
+
+	for (; ch < end && len + 12 < buf_len; ch++) {
+		if (*ch == '*' && ch[-1] == '.' && spec->starPrecision) {
+			if (precision < 0)
+				len--; // Negative Precision is treated as if omitted
+			else
+				len += esif_ccb_sprintf(buf_len - len, buffer + len, "%d", precision);
+		}
+		else if (*ch == '*') {
+			len += esif_ccb_sprintf(buf_len - len, buffer + len, "%d", width);
+		}
+		else {
+			buffer[len++] = *ch;
+		}
+	}
+	buffer[len] = 0;
+}
+
+#define TRACEARG_PUT(type, value) \
+	do { \
+		type val_ = (type)(value); \
+		if (buffer) \
+			esif_ccb_memcpy(buffer + len, &val_, sizeof(val_)); \
+		len += sizeof(val_); \
+	} while (0)
+
+/* Capture the arguments of a trace message into buffer, or just measure them if buffer is NULL.
+ * Returns ESIF_FALSE if the message contains a conversion that cannot be captured.
+ */
+static Bool EsifTraceRing_CaptureArgs(
+	const char *msg,
+	va_list args,
+	UInt8 *buffer,
+	size_t *lenPtr)
+{
+	const char *fmt = msg;
+	EsifTraceSpec spec = {0};
+	size_t len = 0;
+
+	while ((fmt = esif_ccb_strchr(fmt, '%')) != NULL) {
+		if (fmt[1] == '%') {
+			fmt += 2;
+			continue;
+		}
+		EsifTraceSpec_Parse(fmt, &spec);
+		if (spec.type == TRACEARG_NONE)
+			return ESIF_FALSE;
+		if (spec.starWidth)
+			TRACEARG_PUT(int, va_arg(args, int));
+		if (spec.starPrecision)
+			TRACEARG_PUT(int, va_arg(args, int));
+
+		switch (spec.type) {
+		case TRACEARG_INT:
+			TRACEARG_PUT(int, va_arg(args, int));
+			break;
+		case TRACEARG_LONG:
+			TRACEARG_PUT(long, va_arg(args, long));
+			break;
+		case TRACEARG_LLONG:
+			TRACEARG_PUT(long long, va_arg(args, long long));
+			break;
+		case TRACEARG_SIZE:
+			TRACEARG_PUT(size_t, va_arg(args, size_t));
+			break;
+		case TRACEARG_PTRDIFF:
+			TRACEARG_PUT(ptrdiff_t, va_arg(args, ptrdiff_t));
+			break;
+		case TRACEARG_DOUBLE:
+			TRACEARG_PUT(double, va_arg(args, double));
+			break;
+		case TRACEARG_LDOUBLE:
+			TRACEARG_PUT(long double, va_arg(args, long double));
+			break;
+		case TRACEARG_POINTER:
+			TRACEARG_PUT(void *, va_arg(args, void *));
+			break;
+		case TRACEARG_STRING: {
+			const char *str = va_arg(args, const char *);
+			UInt32 str_len = (str ? (UInt32)esif_ccb_strlen(str, ESIF_TRACERING_MAX_RECORD) : ESIF_TRACERING_NULLSTR);
+			TRACEARG_PUT(UInt32, str_len);
+			if (str) {
+				if (buffer) {
+					esif_ccb_memcpy(buffer + len, str, str_len);
+					buffer[len + str_len] = 0;
+				}
+				len += str_len + 1;
+			}
+			break;
+		}
+		default:
+			return ESIF_FALSE;
+		}
+		fmt += spec.len;
+	}
+	*lenPtr = len;
+	return ESIF_TRUE;
+}
+
+/* Append formatted text to a Text Buffer, growing it as necessary */
+static void EsifTraceText_Append(
+	EsifTraceText *self,
+	const char *fmt,
+	...)
+{
+	va_list args;
+	int len = 0;
+
+	va_start(args, fmt);
+	if (self->buf) {
+		len = esif_ccb_vsprintf(self->buf_len - self->data_len, self->buf + self->data_len, fmt, args);
+	}
+	else {
+		len = esif_ccb_vscprintf(fmt, args);
+	}
+	va_end(args);
+	if (len <= 0)
+		return;
+
+	if (self->buf == NULL || self->data_len + len >= self->buf_len) {
+		size_t buf_len = esif_ccb_max(self->buf_len * 2, self->data_len + len + ESIF_TRACERING_MAX_SPEC);
+		char *buf = (char *)esif_ccb_realloc(self->buf, buf_len);
+		if (buf == NULL)
+			return;
+		self->buf = buf;
+		self->buf_len = buf_len;
+		va_start(args, fmt);
+		esif_ccb_vsprintf(self->buf_len - self->data_len, self->buf + self->data_len, fmt, args);
+		va_end(args);
+	}
+	self->data_len += len;
+}
+
+#define TRACEARG_GET(type, var) \
+	do { \
+		esif_ccb_memcpy(&(var), args + offset, sizeof(type)); \
+		offset += sizeof(type); \
+	} while (0)
+
+#define TRACEARG_FORMAT(type) \
+	do { \
+		type val_; \
+		TRACEARG_GET(type, val_); \
+		EsifTraceText_Append(text, spec_str, val_); \
+	} while (0)
+
+/* Format a captured trace message into a Text Buffer */
+static void EsifTraceRing_FormatArgs(
+	const char *msg,
+	const UInt8 *args,
+	EsifTraceText *text)
+{
+	const char *fmt = msg;
+	const char *next = NULL;
+	EsifTraceSpec spec = {0};
+	char spec_str[ESIF_TRACERING_MAX_SPEC + 24] = {0};
+	size_t offset = 0;
+
+	text->data_len = 0;
+	if (text->buf)
+		text->buf[0] = 0;
+
+	while ((next = esif_ccb_strchr(fmt, '%')) != NULL) {
+		int width = 0;
+		int precision = 0;
+
+		if (next > fmt)
+			EsifTraceText_Append(text, "%.*s", (int)(next - fmt), fmt);
+		if (next[1] == '%') {
+			EsifTraceText_Append(text, "%%");
+			fmt = next + 2;
+			continue;
+		}
+		EsifTraceSpec_Parse(next, &spec);
+		if (spec.starWidth)
+			TRACEARG_GET(int, width);
+		if (spec.starPrecision)
+			TRACEARG_GET(int, precision);
+		EsifTraceSpec_Build(&spec, width, precision, spec_str, sizeof(spec_str));
+
+		switch (spec.type) {
+		case TRACEARG_INT:
+			TRACEARG_FORMAT(int);
+			break;
+		case TRACEARG_LONG:
+			TRACEARG_FORMAT(long);
+			break;
+		case TRACEARG_LLONG:
+			TRACEARG_FORMAT(long long);
+			break;
+		case TRACEARG_SIZE:
+			TRACEARG_FORMAT(size_t);
+			break;
+		case TRACEARG_PTRDIFF:
+			TRACEARG_FORMAT(ptrdiff_t);
+			break;
+		case TRACEARG_DOUBLE:
+			TRACEARG_FORMAT(double);
+			break;
+		case TRACEARG_LDOUBLE:
+			TRACEARG_FORMAT(long double);
+			break;
+		case TRACEARG_POINTER:
+			TRACEARG_FORMAT(void *);
+			break;
+		case TRACEARG_STRING: {
+			UInt32 str_len = 0;
+			TRACEARG_GET(UInt32, str_len);
+			if (str_len == ESIF_TRACERING_NULLSTR) {
+				EsifTraceText_Append(text, spec_str, (const char *)NULL);
+			}
+			else {
+				EsifTraceText_Append(text, spec_str, (const char *)(args + offset));
+				offset += str_len + 1;
+			}
+			break;
+		}
+		default:
+			break;
+		}
+		fmt = next + spec.len;
+	}
+	if (*fmt)
+		EsifTraceText_Append(text, "%s", fmt);
+}
+
+/* Thread-Local Storage Destructor: Drainer frees the ring once it is empty */
+static void EsifTraceRing_ThreadExit(void *ctx)
+{
+	if (ctx && ctx != ESIF_TRACERING_NORING) {
+		atomic_set(&((EsifTraceRingPtr)ctx)->orphaned, 1);
+	}
+}
+
+/* Get the calling thread's Trace Ring, creating and registering it on first use */
+static EsifTraceRingPtr EsifTraceRing_Get(void)
+{
+	EsifTraceRingPtr self = (EsifTraceRingPtr)esif_ccb_tls_get(g_traceRing.tlsKey);
+
+	if (self == ESIF_TRACERING_NORING)
+		return NULL;
+	if (self == NULL) {
+		self = (EsifTraceRingPtr)esif_ccb_malloc(sizeof(*self));
+		if (self == NULL)
+			return NULL;
+		if (esif_ccb_tls_set(g_traceRing.tlsKey, self) != 0) {
+			esif_ccb_free(self);
+			return NULL;
+		}
+		esif_ccb_write_lock(&g_traceRing.lock);
+		self->next = g_traceRing.rings;
+		g_traceRing.rings = self;
+		esif_ccb_write_unlock(&g_traceRing.lock);
+	}
+	return self;
+}
+
+/* Capture a Trace Message in the calling thread's Trace Ring.
+ * Returns ESIF_OK if captured or dropped due to overflow, otherwise the message must be routed synchronously
+ */
+static eEsifError EsifTraceRing_Capture(
+	esif_tracemask_t module,
+	int level,
+	const char *func,
+	const char *file,
+	int line,
+	esif_ccb_time_t msec,
+	const char *msg,
+	va_list arglist)
+{
+	EsifTraceRingPtr self = NULL;
+	EsifTraceRecordPtr record = NULL;
+	size_t args_len = 0;
+	size_t size = 0;
+	size_t needed = 0;
+	size_t head = 0;
+	size_t used = 0;
+	size_t pos = 0;
+	Bool captured = ESIF_FALSE;
+	eEsifError rc = ESIF_OK;
+	va_list args;
+
+	// Counted before active is checked, so EsifTraceRing_Exit can wait for writers before freeing the rings
+	atomic_inc(&g_traceRing.writers);
+	if (!atomic_read(&g_traceRing.active) || (self = EsifTraceRing_Get()) == NULL) {
+		rc = ESIF_E_NOT_SUPPORTED;
+		goto exit;
+	}
+
+	va_copy(args, arglist);
+	captured = EsifTraceRing_CaptureArgs(msg, args, NULL, &args_len);
+	va_end(args);
+	size = ESIF_TRACERING_ALIGN(sizeof(EsifTraceRecord) + args_len);
+	if (!captured || size > ESIF_TRACERING_MAX_RECORD) {
+		rc = ESIF_E_NOT_SUPPORTED;
+		goto exit;
+	}
+
+	// Records never straddle the end of the ring, so skip the remainder if it is too small
+	head = (size_t)self->head;
+	used = head - (size_t)atomic_read(&self->tail);
+	pos = head % ESIF_TRACERING_SIZE;
+	needed = size;
+	if (size > ESIF_TRACERING_SIZE - pos)
+		needed += ESIF_TRACERING_SIZE - pos;
+	if (needed > ESIF_TRACERING_SIZE - used) {
+		atomic_inc(&g_traceRing.overflows);
+		goto exit;
+	}
+	if (needed > size) {
+		((EsifTraceRecordPtr)(self->buffer + pos))->size = 0;
+		pos = 0;
+	}
+
+	record = (EsifTraceRecordPtr)(self->buffer + pos);
+	record->size = (UInt32)size;
+	record->level = level;
+	record->module = module;
+	record->line = line;
+	record->msec = msec;
+	record->func = func;
+	record->file = file;
+	record->msg = msg;
+	va_copy(args, arglist);
+	EsifTraceRing_CaptureArgs(msg, args, (UInt8 *)(record + 1), &args_len);
+	va_end(args);
+
+	atomic_add((long)needed, &self->head);
+
+	// Wake the Drainer early rather than wait for its next poll once the ring is half full
+	if (used < ESIF_TRACERING_SIZE / 2 && used + needed >= ESIF_TRACERING_SIZE / 2)
+		esif_ccb_sem_up(&g_traceRing.wakeup);
+exit:
+	atomic_dec(&g_traceRing.writers);
+	return rc;
+}
+
+/* Route a formatted Trace Message */
+static int EsifTraceRing_RouteText(
+	esif_tracemask_t module,
+	int level,
+	const char *func,
+	const char *file,
+	int line,
+	esif_ccb_time_t msec,
+	const char *msg,
+	...)
+{
+	int rc = 0;
+	va_list args;
+	va_start(args, msg);
+	rc = EsifUfTraceRoute(module, level, func, file, line, msec, msg, args);
+	va_end(args);
+	return rc;
+}
+
+/* Format and Route all Trace Messages currently in the Trace Rings in timestamp order.
+ * Returns the number of messages routed.
+ */
+static size_t EsifTraceRing_Drain(void)
+{
+	size_t count = 0;
+	EsifTraceRingPtr ring = NULL;
+	EsifTraceRingPtr *prev = NULL;
+
+	esif_ccb_read_lock(&g_traceRing.lock);
+	for (;;) {
+		EsifTraceRingPtr oldest = NULL;
+		EsifTraceRecordPtr record = NULL;
+
+		// Find the oldest pending record in any ring, skipping wrap markers
+		for (ring = g_traceRing.rings; ring != NULL; ring = ring->next) {
+			size_t tail = (size_t)atomic_read(&ring->tail);
+			size_t head = (size_t)atomic_read(&ring->head);
+			EsifTraceRecordPtr next = NULL;
+
+			if (head == tail)
+				continue;
+			next = (EsifTraceRecordPtr)(ring->buffer + (tail % ESIF_TRACERING_SIZE));
+			if (next->size == 0) {
+				atomic_add((long)(ESIF_TRACERING_SIZE - (tail % ESIF_TRACERING_SIZE)), &ring->tail);
+				if (head == (size_t)atomic_read(&ring->tail))
+					continue;
+				next = (EsifTraceRecordPtr)ring->buffer;
+			}
+			if (record == NULL || next->msec < record->msec) {
+				oldest = ring;
+				record = next;
+			}
+		}
+		if (record == NULL)
+			break;
+
+		if (count++ == 0)
+			EsifLogFile_BeginBatch(ESIF_LOG_TRACE);
+		EsifTraceRing_FormatArgs(record->msg, (const UInt8 *)(record + 1), &g_traceRing.text);
+		EsifTraceRing_RouteText(record->module, record->level, record->func, record->file, record->line, record->msec, "%s", (g_traceRing.text.buf ? g_traceRing.text.buf : ""));
+		atomic_add((long)record->size, &oldest->tail);
+	}
+	esif_ccb_read_unlock(&g_traceRing.lock);
+	if (count)
+		EsifLogFile_EndBatch(ESIF_LOG_TRACE);
+
+	// Free empty rings whose threads have exited
+	esif_ccb_write_lock(&g_traceRing.lock);
+	prev = &g_traceRing.rings;
+	while ((ring = *prev) != NULL) {
+		if (atomic_read(&ring->orphaned) && atomic_read(&ring->head) == atomic_read(&ring->tail)) {
+			*prev = ring->next;
+			esif_ccb_free(ring);
+		}
+		else {
+			prev = &ring->next;
+		}
+	}
+	esif_ccb_write_unlock(&g_traceRing.lock);
+	return count;
+}
+
+/* Drainer Thread */
+static void *ESIF_CALLCONV EsifTraceRing_DrainerThread(void *ctx)
+{
+	long overflows = 0;
+	UNREFERENCED_PARAMETER(ctx);
+
+	esif_ccb_tls_set(g_traceRing.tlsKey, ESIF_TRACERING_NORING);
+
+	while (!g_traceRing.exitFlag) {
+		long dropped = 0;
+
+		esif_ccb_sem_timed_down(&g_traceRing.wakeup, ESIF_TRACERING_DRAIN_MS);
+		EsifTraceRing_Drain();
+		dropped = atomic_read(&g_traceRing.overflows);
+		if (dropped != overflows) {
+			ESIF_TRACE_WARN("Trace Ring overflow: %ld messages dropped\n", dropped - overflows);
+			overflows = dropped;
+		}
+	}
+	EsifTraceRing_Drain();
+	return 0;
+}
+
+eEsifError EsifTraceRing_Init(void)
+{
+	eEsifError rc = ESIF_OK;
+
+	esif_ccb_memset(&g_traceRing, 0, sizeof(g_traceRing));
+	esif_ccb_lock_init(&g_traceRing.lock);
+	esif_ccb_sem_init(&g_traceRing.wakeup);
+	if (esif_ccb_tls_create(&g_traceRing.tlsKey, EsifTraceRing_ThreadExit) != 0) {
+		rc = ESIF_E_NO_MEMORY;
+		goto exit;
+	}
+	rc = esif_ccb_thread_create(&g_traceRing.drainer, EsifTraceRing_DrainerThread, NULL);
+	if (rc != ESIF_OK) {
+		esif_ccb_tls_delete(g_traceRing.tlsKey);
+		goto exit;
+	}
+	atomic_set(&g_traceRing.active, 1);
+exit:
+	if (rc != ESIF_OK) {
+		esif_ccb_sem_uninit(&g_traceRing.wakeup);
+		esif_ccb_lock_uninit(&g_traceRing.lock);
+	}
+	return rc;
+}
+
+void EsifTraceRing_Exit(void)
+{
+	EsifTraceRingPtr ring = NULL;
+
+	if (!atomic_read(&g_traceRing.active))
+		return;
+
+	// Stop capturing, wait for threads already writing a record, and let the Drainer route any pending messages before it exits
+	atomic_set(&g_traceRing.active, 0);
+	while (atomic_read(&g_traceRing.writers) != 0) {
+		esif_ccb_sleep_msec(1);
+	}
+	g_traceRing.exitFlag = ESIF_TRUE;
+	esif_ccb_sem_up(&g_traceRing.wakeup);
+	esif_ccb_thread_join(&g_traceRing.drainer);
+
+	esif_ccb_write_lock(&g_traceRing.lock);
+	while ((ring = g_traceRing.rings) != NULL) {
+		g_traceRing.rings = ring->next;
+		esif_ccb_free(ring);
+	}
+	esif_ccb_write_unlock(&g_traceRing.lock);
+
+	esif_ccb_tls_delete(g_traceRing.tlsKey);
+	esif_ccb_sem_uninit(&g_traceRing.wakeup);
+	esif_ccb_lock_uninit(&g_traceRing.lock);
+	esif_ccb_free(g_traceRing.text.buf);
+	g_traceRing.text.buf = NULL;
+}
+
+UInt64 EsifTraceRing_GetOverflows(void)
+{
+	return (UInt64)atomic_read(&g_traceRing.overflows);
+}
+
+/* Format and Route a Trace Message synchronously on the calling thread */
+static int EsifUfTraceRoute(
 	esif_tracemask_t module,
 	int level,
 	const char *func,
 	const char *file,
 	int line,
+	esif_ccb_time_t msec,
 	const char *msg,
 	va_list arglist)
 {
@@ -125,35 +824,23 @@ int EsifUfTraceMessageArgs(
 	size_t fmtlen=esif_ccb_strlen(msg, 0x7FFFFFFF);
 	int  detailed_message = (level >= DETAILED_TRACELEVEL ? ESIF_TRUE : ESIF_FALSE);
 	va_list args;
-	esif_ccb_time_t msec = 0;
 	enum esif_tracemodule moduleid = ESIF_TRACEMODULE_DEFAULT;
-	char *module_name = NULL;
-	size_t module_len = 0;
-
-	esif_ccb_system_time(&msec);
+	char module_name[ESIF_TRACE_MODULES_LEN] = {0};
 
 	// Build Trace Module Name(s) List [NAME or NAME1|NAME2|...]
 	while (module) {
 		if (module & 0x1) {
-			const char *this_module = EsifTraceModule_ToString(moduleid);
-			char *old_name = module_name;
-			module_len += (esif_ccb_strlen(this_module, MAX_PATH) + 2);
-			module_name = esif_ccb_realloc(module_name, module_len);
-			if (module_name == NULL) {
-				module_name = old_name;
-				goto exit;
+			if (module_name[0]) {
+				esif_ccb_strcat(module_name, "><", sizeof(module_name));
 			}
-			if (old_name) {
-				esif_ccb_strcat(module_name, "><", module_len);
-			}
-			esif_ccb_strcat(module_name, this_module, module_len);
+			esif_ccb_strcat(module_name, EsifTraceModule_ToString(moduleid), sizeof(module_name));
 		}
 		module >>= 1;
 		if (module) {
 			moduleid++;
 		}
 	}
-	if (module_name == NULL)
+	if (module_name[0] == 0)
 		goto exit;
 
 	level = esif_ccb_min(level, ESIF_TRACELEVEL_MAX);
@@ -180,10 +867,9 @@ int EsifUfTraceMessageArgs(
 	}
 
 	if (g_traceinfo[level].routes & ESIF_TRACEROUTE_LOGFILE && EsifLogFile_IsOpen(ESIF_LOG_TRACE)) {
-		time_t now=0;
+		time_t now = (time_t)(msec / 1000);
 		char timestamp[MAX_CTIME_LEN]={0};
 
-		time(&now);
 		esif_ccb_ctime(timestamp, sizeof(timestamp), &now);
 		timestamp[20] = 0; // truncate year
 
@@ -346,10 +1032,26 @@ int EsifUfTraceMessageArgs(
 	}
 #endif
 exit:
-	esif_ccb_free(module_name);
 	return rc;
 }
 
+int EsifUfTraceMessageArgs(
+	esif_tracemask_t module,
+	int level,
+	const char *func,
+	const char *file,
+	int line,
+	const char *msg,
+	va_list arglist)
+{
+	esif_ccb_time_t msec = 0;
+
+	esif_ccb_system_time(&msec);
+	if (EsifTraceRing_Capture(module, level, func, file, line, msec, msg, arglist) == ESIF_OK)
+		return 0;
+	return EsifUfTraceRoute(module, level, func, file, line, msec, msg, arglist);
+}
+
 /* Note different parameters for builds without OS Trace support to conserve code size */
 
 #ifdef ESIF_FEAT_OPT_OS_TRACE
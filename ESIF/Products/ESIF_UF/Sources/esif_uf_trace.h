@@ -185,6 +185,13 @@ extern struct esif_tracelevel_s g_traceinfo[];
 extern const enum esif_tracemodule EsifTraceModule_FromString(const char *name);
 extern const char *EsifTraceModule_ToString(enum esif_tracemodule val);
 
+/* Asynchronous Trace Ring. Messages are captured in binary by the calling thread and
+ * formatted later by a background thread, so trace message formats must be string literals
+ */
+extern eEsifError EsifTraceRing_Init(void);
+extern void EsifTraceRing_Exit(void);
+extern UInt64 EsifTraceRing_GetOverflows(void);
+
 #ifdef __cplusplus
 }
 #endif
@@ -43,6 +43,9 @@
 #define MAX_STR_LINE_LEN 64
 #define MAX_FMT_STR_LEN 15 // "%<Int32>s"
 #define MAX_ACTION_HT_SIZE 30
+#define MAX_NODE_HT_SIZE 127
+#define MAX_SYSFS_NODES 1024
+#define SYSFS_NODE_RETRY_MSEC 5000 // Retry interval for nodes which could not be opened
 #define MAX_SYSFS_POLL_STRING 50
 #define MAX_ACX_ENTRIES 10
 #define MAX_SYSFS_PSTATES 0x7FFFFFFFFFFFFFFE
@@ -173,6 +176,26 @@ struct tzPolicy {
 };
 #pragma pack(pop)
 
+/*
+ * Sysfs Node Cache
+ * Each sysfs node read by the action is opened once and kept open; later reads
+ * use pread() on the cached descriptor.  Nodes that could not be opened are
+ * cached as well so the enumeration loops do not retry every index on each
+ * poll.  actionHashTablePtr maps a participant/primitive tuple to the node it
+ * resolved to.  Both tables are flushed when devices are added or removed.
+ */
+struct sysfsNode {
+	int fd;			/* -1 if the node could not be opened */
+	u64 retryTime;	/* Monotonic time (msec) to retry opening a missing node */
+};
+
+/* Request for sysfs_get_int64_batch */
+struct sysfsNodeRequest {
+	const char *filename;
+	Int64 value;
+	int rc;			/* Same as sysfs_get_int64 */
+};
+
 static struct tzPolicy* tzPolicies = NULL;
 
 static int sysfs_set_int64(char *path, char *filename, Int64 val);
@@ -180,7 +203,14 @@ static int sysfs_set_string(const char *path, const char *filename, char *val);
 static int sysfs_get_string(const char *path, const char *filename, char *str);
 static int sysfs_get_string_multiline(const char *path, const char *filename, char *str);
 static int sysfs_get_int64(const char *path, const char *filename, Int64 *p64);
-static int sysfs_get_int64_direct(int fd, Int64 *p64);
+static int sysfs_get_int64_batch(const char *path, struct sysfsNodeRequest *requests, int count);
+static int sysfs_node_read(const char *path, const char *filename, char *buf, size_t buf_len);
+static int sysfs_node_pread(struct sysfsNode *nodePtr, char *buf, size_t buf_len);
+static struct sysfsNode *sysfs_node_get_wlock(const char *filepath, Bool reopen);
+static void sysfs_node_cache_flush_wlock(void);
+static u64 sysfs_monotonic_time_usec(void);
+static enum esif_rc sysfs_get_rapl_power(EsifUpDomainPtr domainPtr, const char *path, const char *filename, const EsifDataPtr requestPtr, u64 *powerPtr);
+static int GetActionContext(struct sysfsActionHashKey *keyPtr, Int64 *p64);
 static int replace_str(char *str, char *old, char *new, char *rpl_buff, int rpl_buff_len);
 static int get_key_value_pair_from_str(const char *str, char *key, char *value);
 static enum esif_rc get_thermal_rel_str(enum esif_thermal_rel_type type, char *table_str);
@@ -197,6 +227,9 @@ static enum esif_rc get_supported_brightness_levels(char *table_str, char *parti
 static eEsifError get_participant_scope(char *acpi_name, char *acpi_scope);
 static int SetActionContext(struct sysfsActionHashKey *keyPtr, EsifString devicePathName, EsifString deviceNodeName);
 static struct esif_ht *actionHashTablePtr = NULL;
+static struct esif_ht *nodeHashTablePtr = NULL;
+static u32 nodeCount = 0;
+static esif_ccb_lock_t nodeCacheLock;
 static char sys_long_string_val[MAX_SYSFS_STRING];
 static eEsifError SetFanLevel(const EsifUpPtr upPtr, const EsifDataPtr requestPtr, const EsifString devicePathPtr);
 static eEsifError SetBrightnessLevel(const EsifUpPtr upPtr, const EsifDataPtr requestPtr, const EsifString devicePathPtr);
@@ -240,10 +273,9 @@ static eEsifError ESIF_CALLCONV ActionSysfsGet(
 
 	eEsifError rc = ESIF_OK;
 	EsifData params[5] = {0};
-	EsifString replacedStrs[5] = {0};
 	EsifString replacedStr = NULL;
 	UInt8 i = 0;
-	u64 sysval = 0;
+	Int64 sysval = 0;
 	u64 tripval = 0;
 	int node_idx = 0;
 	int node2_idx = 0;
@@ -261,9 +293,6 @@ static eEsifError ESIF_CALLCONV ActionSysfsGet(
 	char cur_node_name[MAX_SYSFS_PATH] = { 0 };
 	char alt_node_name[MAX_SYSFS_PATH]= { 0 };
 	char idx_holder[MAX_IDX_HOLDER] = { 0 };
-	static struct timeval starttm = { 0 };
-	struct timeval endtm = { 0 };
-	double elapsed_tm = 0;
 	u64 ret_val = 0;
 	int domain_idx0 = 0;	// DTS 0
 	int domain_idx1 = 0;	// DTS 1
@@ -276,7 +305,7 @@ static eEsifError ESIF_CALLCONV ActionSysfsGet(
 	char table_str[BINARY_TABLE_SIZE];
 	TableObject tableObject = {0};
 	struct sysfsActionHashKey key = {0};
-	size_t actionContext = 0;
+	int actionContext = 0;
 	EsifUpDataPtr metaPtr = NULL;
 
 	UNREFERENCED_PARAMETER(actCtx);
@@ -292,11 +321,10 @@ static eEsifError ESIF_CALLCONV ActionSysfsGet(
 		ESIF_TRACE_WARN("Failed to get action parameters. Error code: %d .\n",rc);
 		goto exit;
 	}
-	for (i = 0; i < sizeof(replacedStrs) / sizeof(*replacedStrs); i++) {
-		replacedStr = EsifUp_CreateTokenReplacedParamString(upPtr, primitivePtr, params[i].buf_ptr);
+	for (i = 0; i < sizeof(params) / sizeof(*params); i++) {
+		replacedStr = EsifUp_GetTokenReplacedParamString(upPtr, primitivePtr, params[i].buf_ptr);
 		if (replacedStr != NULL) {
 			params[i].buf_ptr = replacedStr;
-			replacedStrs[i] = replacedStr;
 		}
 	}
 	ESIF_ASSERT(NULL != params[0].buf_ptr);
@@ -334,21 +362,16 @@ static eEsifError ESIF_CALLCONV ActionSysfsGet(
 	devicePathPtr = esif_ccb_strtok(deviceFullPathPtr, "|", &pathTok);
 	deviceAltPathPtr = esif_ccb_strtok(NULL, "|", &pathTok);
 
-	// Assemble hash table key to look for existing file pointer to sysfs node
+	// Assemble hash table key to look for the sysfs node previously resolved for this primitive
 	key.participantId = EsifUp_GetInstance(upPtr);
 	key.primitiveTuple = primitivePtr->tuple;
-	actionContext = (size_t) esif_ht_get_item(actionHashTablePtr, (u8 *)&key, sizeof(key));
-
-	// actionContext is not a pointer but instead the file descriptor. It cannot possibly be 0 because 0 is reserved for stdout
-	// So if we do get 0 it would translate to NULL pointer which means that the key is not found in the hash table
-	if (actionContext) {
-		if (sysfs_get_int64_direct((int) actionContext, &sysval) > 0) {
-			tripval = sysval;
-			*(u32 *) responsePtr->buf_ptr = (u32) tripval;
-			goto exit;
-		} else {
-			ESIF_TRACE_WARN("Failed to get action context, attempting to read from sysfs.\n");
-		}
+	actionContext = GetActionContext(&key, &sysval);
+	if (actionContext > 0) {
+		tripval = sysval;
+		*(u32 *) responsePtr->buf_ptr = (u32) tripval;
+		goto exit;
+	} else if (actionContext < 0) {
+		ESIF_TRACE_WARN("Failed to get action context, attempting to read from sysfs.\n");
 	}
 
 	sysopt = *(enum esif_sysfs_command *) command;
@@ -509,25 +532,11 @@ static eEsifError ESIF_CALLCONV ActionSysfsGet(
 					rc = ESIF_E_INVALID_DOMAIN_ID;
 					goto exit;
 				}
-				if (domainPtr->lastPowerTime == 0) {
-					esif_ccb_get_time(&starttm);
-					domainPtr->lastPowerTime = (u64)(starttm.tv_sec * 1000000) + starttm.tv_usec;
-				}
-
-				esif_ccb_get_time(&endtm);
-				elapsed_tm = (((endtm.tv_sec * 1000000) + endtm.tv_usec) - (domainPtr->lastPowerTime)) / 1000000.0;
-
-				if (sysfs_get_int64(parm1, parm2, &sysval) < 1) {
-					rc = ESIF_E_PRIMITIVE_ACTION_FAILURE;
+				rc = sysfs_get_rapl_power(domainPtr, parm1, parm2, requestPtr, &ret_val);
+				if (rc != ESIF_OK) {
 					goto exit;
 				}
 
-				if (elapsed_tm > 0) {
-					ret_val = (u64) ((sysval - domainPtr->lastPower) / elapsed_tm);
-					domainPtr->lastPowerTime = (u64)(endtm.tv_sec * 1000000) + endtm.tv_usec;
-				}
-				domainPtr->lastPower = sysval;
-
 				*(u32 *) responsePtr->buf_ptr = (u32) ret_val;
 				break;
 			case ESIF_SYSFS_GET_CPU_PDL: /* pdl */
@@ -777,7 +786,6 @@ static eEsifError ESIF_CALLCONV ActionSysfsSet(
 	char *pathTok = NULL;
 	eEsifError rc = ESIF_OK;
 	EsifData params[5] = {0};
-	EsifString replacedStrs[5] = {0};
 	EsifString replacedStr = NULL;
 	UInt8 i = 0;
 	enum esif_sysfs_command sysopt = 0;
@@ -812,11 +820,10 @@ static eEsifError ESIF_CALLCONV ActionSysfsSet(
 		goto exit;
 	}
 
-	for (i = 0; i < sizeof(replacedStrs) / sizeof(*replacedStrs); i++) {
-		replacedStr = EsifUp_CreateTokenReplacedParamString(upPtr, primitivePtr, params[i].buf_ptr);
+	for (i = 0; i < sizeof(params) / sizeof(*params); i++) {
+		replacedStr = EsifUp_GetTokenReplacedParamString(upPtr, primitivePtr, params[i].buf_ptr);
 		if (replacedStr != NULL) {
 			params[i].buf_ptr = replacedStr;
-			replacedStrs[i] = replacedStr;
 		}
 	}
 	if (requestPtr == NULL || requestPtr->buf_ptr == NULL || params[0].buf_ptr == NULL) {
@@ -1072,19 +1079,50 @@ static void get_full_scope_str(char *orig, char *new)
 
 static int SetActionContext(struct sysfsActionHashKey *keyPtr, EsifString devicePathName, EsifString deviceNodeName)
 {
-	int fd = 0;
+	struct sysfsNode *nodePtr = NULL;
 	char filepath[MAX_SYSFS_PATH] = { 0 };
-	int ret = 0;
+	int ret = -1;
 
 	ESIF_TRACE_ENTRY();
 	esif_ccb_sprintf(MAX_SYSFS_PATH, filepath, "%s/%s", devicePathName, deviceNodeName);
-	fd = open(filepath, O_RDONLY);
 
-	if (fd != -1) {
-		size_t actionContext = (size_t) fd;
-		ret = esif_ht_add_item(actionHashTablePtr, (u8 *) keyPtr, sizeof(struct sysfsActionHashKey), (void *) actionContext);
+	esif_ccb_write_lock(&nodeCacheLock);
+	nodePtr = sysfs_node_get_wlock(filepath, ESIF_FALSE);
+	if ((nodePtr != NULL) && (nodePtr->fd != -1)) {
+		esif_ht_remove_item(actionHashTablePtr, (u8 *) keyPtr, sizeof(struct sysfsActionHashKey));
+		ret = esif_ht_add_item(actionHashTablePtr, (u8 *) keyPtr, sizeof(struct sysfsActionHashKey), (void *) nodePtr);
+	}
+	esif_ccb_write_unlock(&nodeCacheLock);
+
+	return ret;
+}
+
+/*
+ * Reads the node previously resolved for a primitive.  Returns 1 on success,
+ * 0 if no node is cached for the primitive and -1 if the cached node could not
+ * be read, in which case the caller should resolve the node again.
+ */
+static int GetActionContext(struct sysfsActionHashKey *keyPtr, Int64 *p64)
+{
+	struct sysfsNode *nodePtr = NULL;
+	char buf[MAX_SYSFS_PATH] = { 0 };
+	int ret = 0;
+
+	esif_ccb_read_lock(&nodeCacheLock);
+	nodePtr = (struct sysfsNode *) esif_ht_get_item(actionHashTablePtr, (u8 *) keyPtr, sizeof(struct sysfsActionHashKey));
+	if (nodePtr != NULL) {
+		ret = -1;
+		if ((sysfs_node_pread(nodePtr, buf, sizeof(buf)) > 0) && (esif_ccb_sscanf(buf, "%lld", p64) > 0)) {
+			ret = 1;
+		}
 	}
+	esif_ccb_read_unlock(&nodeCacheLock);
 
+	if (ret < 0) {
+		esif_ccb_write_lock(&nodeCacheLock);
+		esif_ht_remove_item(actionHashTablePtr, (u8 *) keyPtr, sizeof(struct sysfsActionHashKey));
+		esif_ccb_write_unlock(&nodeCacheLock);
+	}
 	return ret;
 }
 
@@ -1143,21 +1181,17 @@ exit:
 
 static int sysfs_get_string(const char *path, const char *filename, char *str)
 {
-	FILE *fd = NULL;
 	int rc = -1;
-	char filepath[MAX_SYSFS_PATH] = { 0 };
-
-	esif_ccb_sprintf(MAX_SYSFS_PATH, filepath, "%s/%s", path, filename);
+	char buf[MAX_SYSFS_PATH] = { 0 };
 
-	if ((fd = esif_ccb_fopen(filepath, "r", NULL)) == NULL) {
+	if (sysfs_node_read(path, filename, buf, sizeof(buf)) < 0) {
 		goto exit;
 	}
 
 	// Use dynamic format width specifier to avoid scanf buffer overflow
 	char fmt[MAX_FMT_STR_LEN] = { 0 };
 	esif_ccb_sprintf(sizeof(fmt), fmt, "%%%ds", (int)MAX_SYSFS_PATH - 1);
-	rc = esif_ccb_fscanf(fd, fmt, SCANFBUF(str, MAX_SYSFS_PATH));
-	esif_ccb_fclose(fd);
+	rc = esif_ccb_sscanf(buf, fmt, SCANFBUF(str, MAX_SYSFS_PATH));
 
 exit:
 	return rc;
@@ -1190,16 +1224,13 @@ exit:
 
 static int sysfs_get_int64(const char *path, const char *filename, Int64 *p64)
 {
-	FILE *fd = NULL;
 	int rc = 0;
-	char filepath[MAX_SYSFS_PATH] = { 0 };
-	esif_ccb_sprintf(MAX_SYSFS_PATH, filepath, "%s/%s", path, filename);
+	char buf[MAX_SYSFS_PATH] = { 0 };
 
-	if ((fd = esif_ccb_fopen(filepath, "r", NULL)) == NULL) {
+	if (sysfs_node_read(path, filename, buf, sizeof(buf)) < 0) {
 		goto exit;
 	}
-	rc = esif_ccb_fscanf(fd, "%lld", p64);
-	esif_ccb_fclose(fd);
+	rc = esif_ccb_sscanf(buf, "%lld", p64);
 
 exit:
 	// Klocwork bounds check. Should depend on context
@@ -1209,25 +1240,268 @@ exit:
 	return rc;
 }
 
-static int sysfs_get_int64_direct(int fd, Int64 *p64)
+/*
+ * Reads several integer nodes from the same directory with a single pass over
+ * the node cache.  Returns the number of nodes read successfully.
+ */
+static int sysfs_get_int64_batch(const char *path, struct sysfsNodeRequest *requests, int count)
 {
-	int rc = 0;
-	char buf[MAX_SYSFS_STRING] = {0};
+	struct sysfsNode *nodePtr = NULL;
+	char filepath[MAX_SYSFS_PATH] = { 0 };
+	char buf[MAX_SYSFS_PATH] = { 0 };
+	int misses = 0;
+	int found = 0;
+	int i = 0;
 
-	lseek(fd, 0, SEEK_SET);
-	if (read(fd, buf, MAX_SYSFS_STRING) > 0) {
-		rc = esif_ccb_sscanf(buf, "%lld", p64);
-		if (ESIF_OK != rc) {
-			ESIF_TRACE_WARN("Failed to get file scan. Error code: %d .\n",rc);
+	esif_ccb_read_lock(&nodeCacheLock);
+	for (i = 0; i < count; i++) {
+		requests[i].rc = -1;
+		esif_ccb_sprintf(MAX_SYSFS_PATH, filepath, "%s/%s", path, requests[i].filename);
+		nodePtr = (struct sysfsNode *) esif_ht_get_item(nodeHashTablePtr, (u8 *) filepath, (u32) esif_ccb_strlen(filepath, MAX_SYSFS_PATH));
+		if ((nodePtr != NULL) && (sysfs_node_pread(nodePtr, buf, sizeof(buf)) > 0)) {
+			requests[i].rc = esif_ccb_sscanf(buf, "%lld", &requests[i].value);
+		}
+		else {
+			misses++;
 		}
 	}
-	else {
-		ESIF_TRACE_WARN("Error on context file read: %s\n", strerror(errno));
+	esif_ccb_read_unlock(&nodeCacheLock);
+
+	// Open, reopen or retry the remaining nodes under a single write lock
+	if (misses > 0) {
+		esif_ccb_write_lock(&nodeCacheLock);
+		for (i = 0; i < count; i++) {
+			if (requests[i].rc != -1) {
+				continue;
+			}
+			requests[i].rc = 0;
+			esif_ccb_sprintf(MAX_SYSFS_PATH, filepath, "%s/%s", path, requests[i].filename);
+			nodePtr = sysfs_node_get_wlock(filepath, ESIF_TRUE);
+			if ((nodePtr != NULL) && (sysfs_node_pread(nodePtr, buf, sizeof(buf)) > 0)) {
+				requests[i].rc = esif_ccb_sscanf(buf, "%lld", &requests[i].value);
+			}
+		}
+		esif_ccb_write_unlock(&nodeCacheLock);
+	}
+
+	for (i = 0; i < count; i++) {
+		if (requests[i].rc > 0) {
+			found++;
+		}
+		else {
+			requests[i].rc = 0;
+		}
+	}
+	return found;
+}
+
+static u64 sysfs_monotonic_time_usec(void)
+{
+	struct timespec now = {0};
+
+	clock_gettime(CLOCK_MONOTONIC, &now);
+	return ((u64) now.tv_sec * 1000000) + ((u64) now.tv_nsec / 1000);
+}
+
+/*
+ * Average RAPL power of a domain from its shared energy sample stream.  The
+ * energy counter is only read when the newest sample is older than
+ * ESIF_ENERGY_MIN_SAMPLE_USEC, so readers polling the same domain share
+ * samples instead of resetting each other's interval.  Callers may pass a
+ * longer averaging window in msec as ESIF_DATA_TIME request data; otherwise
+ * ESIF_ENERGY_MIN_WINDOW_USEC is used.  The first read returns 0.
+ */
+static enum esif_rc sysfs_get_rapl_power(EsifUpDomainPtr domainPtr, const char *path, const char *filename, const EsifDataPtr requestPtr, u64 *powerPtr)
+{
+	enum esif_rc rc = ESIF_OK;
+	EsifEnergySamplerPtr samplerPtr = &domainPtr->energySampler;
+	Int64 counter = 0;
+	Int64 counterRange = 0;
+	u64 window = 0;
+	u64 now = 0;
+
+	/* Looked up once; a missing range is remembered as 0 */
+	if (!EsifEnergySampler_IsCounterRangeSet(samplerPtr)) {
+		if ((sysfs_get_int64(path, "max_energy_range_uj", &counterRange) < 1) || (counterRange < 0)) {
+			counterRange = 0;
+		}
+		EsifEnergySampler_SetCounterRange(samplerPtr, (UInt64) counterRange);
+	}
+
+	now = sysfs_monotonic_time_usec();
+	if (EsifEnergySampler_IsSampleDue(samplerPtr, now)) {
+		if (sysfs_get_int64(path, filename, &counter) < 1) {
+			rc = ESIF_E_PRIMITIVE_ACTION_FAILURE;
+			goto exit;
+		}
+		EsifEnergySampler_AddSample(samplerPtr, now, (UInt64) counter);
+	}
+
+	if ((requestPtr != NULL) && (ESIF_DATA_TIME == requestPtr->type) &&
+		(requestPtr->buf_ptr != NULL) && (requestPtr->buf_len >= sizeof(UInt32))) {
+		window = (u64) *(UInt32 *) requestPtr->buf_ptr * 1000;
+	}
+
+	if (EsifEnergySampler_GetAveragePower(samplerPtr, window, powerPtr) == ESIF_I_AGAIN) {
+		*powerPtr = 0;
+	}
+exit:
+	return rc;
+}
+
+/*
+ * Reads a node from offset 0 into a null terminated buffer.  Must be called
+ * with nodeCacheLock held.  Returns the number of bytes read or -1.
+ */
+static int sysfs_node_pread(struct sysfsNode *nodePtr, char *buf, size_t buf_len)
+{
+	ssize_t len = -1;
+
+	if (nodePtr->fd != -1) {
+		len = pread(nodePtr->fd, buf, buf_len - 1, 0);
+	}
+	if (len < 0) {
+		buf[0] = '\0';
+		return -1;
+	}
+	buf[len] = '\0';
+	return (int) len;
+}
+
+/*
+ * Finds or creates the cache entry for a node path.  A node which could not be
+ * opened is retried once its retry time has passed; reopen forces an open node
+ * to be reopened, and a missing node to be retried immediately.  Must be called
+ * with nodeCacheLock held for write.
+ */
+static struct sysfsNode *sysfs_node_get_wlock(const char *filepath, Bool reopen)
+{
+	struct sysfsNode *nodePtr = NULL;
+	u32 pathLen = (u32) esif_ccb_strlen(filepath, MAX_SYSFS_PATH);
+
+	if (NULL == nodeHashTablePtr) {
+		goto exit;
+	}
+
+	nodePtr = (struct sysfsNode *) esif_ht_get_item(nodeHashTablePtr, (u8 *) filepath, pathLen);
+	if (NULL == nodePtr) {
+		if (nodeCount >= MAX_SYSFS_NODES) {
+			sysfs_node_cache_flush_wlock();
+		}
+		nodePtr = (struct sysfsNode *) esif_ccb_malloc(sizeof(*nodePtr));
+		if (NULL == nodePtr) {
+			goto exit;
+		}
+		nodePtr->fd = -1;
+		if (esif_ht_add_item(nodeHashTablePtr, (u8 *) filepath, pathLen, (void *) nodePtr) != ESIF_OK) {
+			esif_ccb_free(nodePtr);
+			nodePtr = NULL;
+			goto exit;
+		}
+		nodeCount++;
+		reopen = ESIF_TRUE;
+	}
+	else if ((-1 == nodePtr->fd) && ((sysfs_monotonic_time_usec() / 1000) >= nodePtr->retryTime)) {
+		reopen = ESIF_TRUE;
+	}
+
+	if (reopen) {
+		if (nodePtr->fd != -1) {
+			close(nodePtr->fd);
+		}
+		nodePtr->fd = open(filepath, O_RDONLY);
+		if (-1 == nodePtr->fd) {
+			nodePtr->retryTime = (sysfs_monotonic_time_usec() / 1000) + SYSFS_NODE_RETRY_MSEC;
+		}
+	}
+exit:
+	return nodePtr;
+}
+
+/*
+ * Reads a node through the node cache.  Returns the number of bytes read or -1
+ * if the node could not be opened or read.
+ */
+static int sysfs_node_read(const char *path, const char *filename, char *buf, size_t buf_len)
+{
+	struct sysfsNode *nodePtr = NULL;
+	char filepath[MAX_SYSFS_PATH] = { 0 };
+	Bool isMissing = ESIF_FALSE;
+	int rc = -1;
+
+	esif_ccb_sprintf(MAX_SYSFS_PATH, filepath, "%s/%s", path, filename);
+
+	esif_ccb_read_lock(&nodeCacheLock);
+	nodePtr = (struct sysfsNode *) esif_ht_get_item(nodeHashTablePtr, (u8 *) filepath, (u32) esif_ccb_strlen(filepath, MAX_SYSFS_PATH));
+	if (nodePtr != NULL) {
+		if (nodePtr->fd != -1) {
+			rc = sysfs_node_pread(nodePtr, buf, buf_len);
+		}
+		else {
+			isMissing = (Bool) ((sysfs_monotonic_time_usec() / 1000) < nodePtr->retryTime);
+		}
 	}
+	esif_ccb_read_unlock(&nodeCacheLock);
 
+	// Open the node if it is not cached yet and reopen it if the cached descriptor failed
+	if ((rc < 0) && !isMissing) {
+		esif_ccb_write_lock(&nodeCacheLock);
+		nodePtr = sysfs_node_get_wlock(filepath, (Bool) (nodePtr != NULL));
+		if (nodePtr != NULL) {
+			rc = sysfs_node_pread(nodePtr, buf, buf_len);
+		}
+		else {
+			// Cache not available; read the node directly
+			struct sysfsNode node = { open(filepath, O_RDONLY) };
+			rc = sysfs_node_pread(&node, buf, buf_len);
+			if (node.fd != -1) {
+				close(node.fd);
+			}
+		}
+		esif_ccb_write_unlock(&nodeCacheLock);
+	}
 	return rc;
 }
 
+static void SysfsNodeCleanUp(void *itemPtr)
+{
+	struct sysfsNode *nodePtr = (struct sysfsNode *) itemPtr;
+
+	if (nodePtr != NULL) {
+		if (nodePtr->fd != -1) {
+			close(nodePtr->fd);
+		}
+		esif_ccb_free(nodePtr);
+	}
+}
+
+/* Drops all cached nodes along with the primitive to node mappings */
+static void sysfs_node_cache_flush_wlock(void)
+{
+	if (actionHashTablePtr != NULL) {
+		esif_ht_destroy(actionHashTablePtr, NULL);
+	}
+	if (nodeHashTablePtr != NULL) {
+		esif_ht_destroy(nodeHashTablePtr, SysfsNodeCleanUp);
+	}
+	actionHashTablePtr = esif_ht_create(MAX_ACTION_HT_SIZE);
+	nodeHashTablePtr = esif_ht_create(MAX_NODE_HT_SIZE);
+	nodeCount = 0;
+}
+
+/*
+ * Called by the udev listener when a device is added or removed since cached
+ * sysfs nodes may have gone away or been renumbered
+ */
+void EsifActSysfsInvalidateCache(void)
+{
+	esif_ccb_write_lock(&nodeCacheLock);
+	if (nodeHashTablePtr != NULL) {
+		sysfs_node_cache_flush_wlock();
+	}
+	esif_ccb_write_unlock(&nodeCacheLock);
+}
+
 static int sysfs_set_int64(char *path, char *filename, Int64 val)
 {
 	FILE *fd = NULL;
@@ -1399,7 +1673,19 @@ static enum esif_rc get_rapl_power_control_capabilities(
 	u64 time2Min = 0;
 	u64 time2Max = 0;
 	u64 step2 = 0;
-	u64 sysval = 0;
+	struct sysfsNodeRequest limits[] = {
+		{"power_limit_0_min_uw"},
+		{"power_limit_0_max_uw"},
+		{"power_limit_0_step_uw"},
+		{"power_limit_0_tmin_us"},
+		{"power_limit_0_tmax_us"},
+		{"power_limit_1_min_uw"},
+		{"power_limit_1_max_uw"},
+		{"power_limit_1_step_uw"},
+		{"power_limit_1_tmin_us"},
+		{"power_limit_1_tmax_us"}
+	};
+	int i = 0;
 	u8 guid_compare[ESIF_GUID_LEN] = ESIF_PARTICIPANT_PLAT_CLASS_GUID;
 	int candidate_found = 0;
 	int guid_different = 0;
@@ -1466,46 +1752,24 @@ static enum esif_rc get_rapl_power_control_capabilities(
 
 
 	esif_ccb_sprintf(MAX_SYSFS_PATH, cur_path, "%s/%s/power_limits", path, node);
-	if (sysfs_get_int64(cur_path, "power_limit_0_min_uw", &sysval) < 1) {
-		goto exit;
-	}
-	pl1Min = sysval;
-	if (sysfs_get_int64(cur_path, "power_limit_0_max_uw",  &sysval) < 1) {
-		goto exit;
-	}
-	pl1Max = sysval;
-	if (sysfs_get_int64(cur_path, "power_limit_0_step_uw", &sysval) < 1) {
-		goto exit;
-	}
-	step1 = sysval;
-	if (sysfs_get_int64(cur_path, "power_limit_0_tmin_us", &sysval) < 1) {
-		goto exit;
-	}
-	time1Min = sysval;
-	if (sysfs_get_int64(cur_path, "power_limit_0_tmax_us", &sysval) < 1) {
-		goto exit;
-	}
-	time1Max = sysval;
-	if (sysfs_get_int64(cur_path, "power_limit_1_min_uw",  &sysval) < 1) {
-		sysval = 0;  /* we don't care - dptf doesn't use this value anyways */
-	}
-	pl2Min = sysval;
-	if (sysfs_get_int64(cur_path, "power_limit_1_max_uw",  &sysval) < 1) {
-		sysval = 0;  /* we don't care - dptf doesn't use this value anyways */
-	}
-	pl2Max = sysval;
-	if (sysfs_get_int64(cur_path, "power_limit_1_step_uw", &sysval) < 1) {
-		sysval = 0;  /* we don't care - dptf doesn't use this value anyways */
-	}
-	step2 = sysval;
-	if (sysfs_get_int64(cur_path, "power_limit_1_tmin_us", &sysval) < 1) {
-		sysval = 0;  /* we don't care - dptf doesn't use this value anyways */
-	}
-	time2Min = sysval;
-	if (sysfs_get_int64(cur_path, "power_limit_1_tmax_us", &sysval) < 1) {
-		sysval = 0;  /* we don't care - dptf doesn't use this value anyways */
+	sysfs_get_int64_batch(cur_path, limits, sizeof(limits) / sizeof(*limits));
+
+	/* PL1 limits are required; dptf doesn't use the PL2 values so they default to 0 */
+	for (i = 0; i < 5; i++) {
+		if (limits[i].rc < 1) {
+			goto exit;
+		}
 	}
-	time2Max = sysval;
+	pl1Min = limits[0].value;
+	pl1Max = limits[1].value;
+	step1 = limits[2].value;
+	time1Min = limits[3].value;
+	time1Max = limits[4].value;
+	pl2Min = (limits[5].rc > 0) ? limits[5].value : 0;
+	pl2Max = (limits[6].rc > 0) ? limits[6].value : 0;
+	step2 = (limits[7].rc > 0) ? limits[7].value : 0;
+	time2Min = (limits[8].rc > 0) ? limits[8].value : 0;
+	time2Max = (limits[9].rc > 0) ? limits[9].value : 0;
 	pl1Min = (pl1Min > 0) ? pl1Min / 1000 : 0;
 	pl1Max = (pl1Max > 0) ? pl1Max / 1000 : 0;
 	time1Min = (time1Min > 0) ? time1Min / 100 : 0;
@@ -1696,15 +1960,6 @@ exit:
 	return rc;
 }
 
-static void ActionContextCleanUp(void *itemPtr)
-{
-	ESIF_TRACE_ENTRY();
-
-	size_t actionContext = (size_t) itemPtr;
-	int fd = (int) actionContext;
-	if (fd) close(fd);
-}
-
 static eEsifError SetFanLevel(const EsifUpPtr upPtr, const EsifDataPtr requestPtr, const EsifString devicePathPtr)
 {
 	eEsifError rc = ESIF_OK;
@@ -2109,7 +2364,9 @@ static EsifActIfaceStatic g_sysfs = {
 enum esif_rc EsifActSysfsInit()
 {
 	EsifActMgr_RegisterAction((EsifActIfacePtr)&g_sysfs);
+	esif_ccb_lock_init(&nodeCacheLock);
 	actionHashTablePtr = esif_ht_create(MAX_ACTION_HT_SIZE);
+	nodeHashTablePtr = esif_ht_create(MAX_NODE_HT_SIZE);
 	SetThermalZonePolicy();
 	GetNumberOfCpuCores();
 	ESIF_TRACE_EXIT_INFO();
@@ -2120,11 +2377,19 @@ enum esif_rc EsifActSysfsInit()
 void EsifActSysfsExit()
 {
 	EsifActMgr_UnregisterAction((EsifActIfacePtr)&g_sysfs);
+	esif_ccb_write_lock(&nodeCacheLock);
 	if (actionHashTablePtr)
-		esif_ht_destroy(actionHashTablePtr, ActionContextCleanUp);
+		esif_ht_destroy(actionHashTablePtr, NULL);
+	if (nodeHashTablePtr)
+		esif_ht_destroy(nodeHashTablePtr, SysfsNodeCleanUp);
+	actionHashTablePtr = NULL;
+	nodeHashTablePtr = NULL;
+	nodeCount = 0;
+	esif_ccb_write_unlock(&nodeCacheLock);
 	if(cpufreq)
 		esif_ccb_free(cpufreq);
 	ResetThermalZonePolicy();
+	esif_ccb_lock_uninit(&nodeCacheLock);
 	ESIF_TRACE_EXIT_INFO();
 }
 
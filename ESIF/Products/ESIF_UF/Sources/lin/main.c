@@ -23,6 +23,7 @@
 #include <errno.h>
 #include <fcntl.h>
 #include <sys/file.h>
+#include <signal.h>
 
 #include "esif_uf.h"
 #include "esif_uf_appmgr.h"
@@ -49,6 +50,10 @@ static void *esif_udev_listen(void *ptr);
 static void esif_process_udev_event(char *udev_target);
 static int kobj_uevent_parse(char *buffer, int len, char **zone_name, int *temp, int *event);
 
+#ifdef ESIF_FEAT_OPT_ACTION_SYSFS
+void EsifActSysfsInvalidateCache(void);
+#endif
+
 static esif_thread_t g_udev_thread;
 static Bool g_udev_quit = ESIF_TRUE;
 static char *g_udev_target = NULL;
@@ -293,6 +298,14 @@ static int check_for_uevent(int fd) {
 		return 0;
 	}
 
+#ifdef ESIF_FEAT_OPT_ACTION_SYSFS
+	/* Kernel uevents start with "<action>@<devpath>"; cached sysfs nodes may be stale after add/remove */
+	if ((len > 4 && esif_ccb_strncmp(buffer, "add@", 4) == 0) ||
+		(len > 7 && esif_ccb_strncmp(buffer, "remove@", 7) == 0)) {
+		EsifActSysfsInvalidateCache();
+	}
+#endif
+
 	while (i < len) {
 
 		buf_ptr = buffer + i;
@@ -226,7 +226,7 @@ static int esif_ws_http_process_static_pages (
 				ESIF_UF_VERSION,
 				esif_ws_http_time_stamp(time(0), tmpbuffer));
 
-			send(connection->socket, buffer, (int)esif_ccb_strlen(buffer, bufferSize), ESIF_WS_SEND_FLAGS);
+			esif_ws_client_write_to_socket(connection, buffer, esif_ccb_strlen(buffer, bufferSize));
 			goto exit;
 		}
 	}
@@ -265,9 +265,12 @@ static int esif_ws_http_process_static_pages (
 				(long)st.st_size, 
 				content_disposition);
 
-	send(connection->socket, buffer, (int)esif_ccb_strlen(buffer, bufferSize), ESIF_WS_SEND_FLAGS);
+	// Queue response; the server sends it as the client socket accepts more data
+	esif_ws_client_write_to_socket(connection, buffer, esif_ccb_strlen(buffer, bufferSize));
 	while ((msgLen = (int)esif_ccb_fread(buffer, bufferSize, 1, bufferSize, file_fp)) > 0) {
-		send(connection->socket, buffer, (int)msgLen, ESIF_WS_SEND_FLAGS);
+		if (esif_ws_client_write_to_socket(connection, buffer, (size_t)msgLen) != EXIT_SUCCESS) {
+			break;
+		}
 	}
 	esif_ccb_fclose(file_fp);
 
@@ -429,7 +432,7 @@ static void esif_ws_http_send_error_code (
 		}
 		
 		esif_ccb_sprintf(sizeof(buffer), buffer, (char*)"HTTP/1.1 %d %s" CRLF CRLF "<h1>%d %s</h1>", error_code, message, error_code, message);
-		send(connection->socket, buffer, (int)esif_ccb_strlen(buffer, sizeof(buffer)), ESIF_WS_SEND_FLAGS);
+		esif_ws_client_write_to_socket(connection, buffer, esif_ccb_strlen(buffer, sizeof(buffer)));
 	}
 	esif_ws_client_close_client(connection);
 }
\ No newline at end of file
@@ -22,6 +22,8 @@
 #include "esif_ws_server.h"
 #include "esif_ccb_atomic.h"
 #include "esif_ccb_lock.h"
+#include "esif_ccb_sem.h"
+#include "esif_ccb_thread.h"
 #include "esif_uf_shell.h"
 
 #ifdef ESIF_ATTR_OS_WINDOWS
@@ -36,17 +38,13 @@
 #define MESSAGE_SUCCESS 0
 #define MESSAGE_ERROR 1
 
-/* Max number of Client connections. This cannot exceed FD_SETSIZE-1 (Default: Windows=64, Linux=1024) */
-#define MAX_CLIENTS		10
-
-#if (MAX_CLIENTS > (FD_SETSIZE - 1))
-# undef  MAX_CLIENTS
-# define MAX_CLIENTS	(FD_SETSIZE - 1)
-#endif
-#define MAX_SOCKETS		(MAX_CLIENTS + 1)
-
 #define	MIN_REST_OUT_PADDING	15	/* space for "%u:" */
 
+#define WS_POLL_MAX_EVENTS		64		/* Max events processed per poller wakeup */
+#define WS_POLL_TIMEOUT_MSEC	2050	/* Poller timeout so we notice g_ws_quit */
+#define WS_RECV_BUFFER_INITIAL	1024	/* Initial size of per-client input buffer */
+#define WS_SEND_BUFFER_INITIAL	4096	/* Initial size of per-client output buffer */
+
 /* for cleaning data that may be written to the socket */
 #define ASCII_CHAR_LBOUND 32
 #define ASCII_CHAR_UBOUND 127
@@ -71,8 +69,15 @@ extern int g_shell_enabled;
 #define WEBSOCKET_RESTRICTED_PORT	"888"		// System Port
 #define WEBSOCKET_FRAME_SIZE_DEFAULT (sizeof(WsSocketFrame) + sizeof(EsifCapability))
 
-static char *esif_ws_server_get_rest_response(size_t *msgLenPtr);
-static char *esif_ws_server_get_rest_buffer(void);
+/* REST command queued for execution on the REST worker thread */
+typedef struct WsRestJob_s {
+	struct WsRestJob_s *next;
+	u32 clientIndex;
+	u32 generation;
+	size_t commandLen;
+	char command[1];	/* Variable length, NUL-terminated */
+} WsRestJob, *WsRestJobPtr;
+
 static void esif_ws_server_initialize_clients(void);
 static int esif_ws_broadcast_frame(const u8 *framePtr, size_t frameSize);
 
@@ -84,15 +89,27 @@ static int esif_ws_server_create_inet_addr(
 	char *protPtr
 	);
 
-void esif_ws_server_execute_rest_cmd(
+char *esif_ws_server_execute_rest_cmd(
 	const char *dataPtr,
 	const size_t dataSize
 	);
 
+static eEsifError esif_ws_server_queue_rest_cmd(
+	ClientRecordPtr clientPtr,
+	const char *dataPtr,
+	size_t dataSize
+	);
+
+static void *ESIF_CALLCONV esif_ws_server_rest_worker_thread(void *ptr);
+
+static void esif_ws_server_accept_clients(void);
 static void esif_ws_client_initialize_client(ClientRecordPtr);
 static eEsifError esif_ws_client_process_request(ClientRecordPtr clientPtr);
+static eEsifError esif_ws_client_process_input(ClientRecordPtr clientPtr);
+static int esif_ws_client_flush(ClientRecordPtr clientPtr);
+static void esif_ws_client_update(ClientRecordPtr clientPtr);
 
-static int esif_ws_client_write_to_socket(
+static int esif_ws_client_queue_output(
 	ClientRecordPtr clientPtr,
 	const char *bufferPtr,
 	size_t bufferSize
@@ -100,16 +117,12 @@ static int esif_ws_client_write_to_socket(
 
 static eEsifError esif_ws_client_open_client(
 	ClientRecordPtr clientPtr,
-	char *bufferPtr,
-	size_t bufferSize,
-	size_t messageLength
+	size_t *consumedPtr
 	);
 
 static eEsifError esif_ws_client_process_active_client(
 	ClientRecordPtr clientPtr,
-	char *bufferPtr,
-	size_t bufferSize,
-	size_t messageLength
+	size_t *consumedPtr
 	);
 
 static Bool charIsLineFeed(
@@ -123,10 +136,21 @@ static void strip_extended_ascii(
 static void esif_ws_protocol_initialize(ProtocolPtr protPtr);
 
 static esif_ccb_mutex_t g_ws_lock;      /* lock ws global variables. Move all these to a struct */
-static ClientRecordPtr g_clients = NULL; /* dynamically allocated array of MAX_CLIENTS */
+static ClientRecordPtr g_clients = NULL; /* dynamically allocated array of g_ws_client_slots */
+static u32 g_ws_client_slots = 0;      /* number of client slots allocated when server started */
+static u32 g_ws_max_clients = WS_DEFAULT_MAX_CLIENTS; /* configured client limit; applied on next start */
 static char *g_ws_http_buffer = NULL; /* dynamically allocated buffer of size OUT_BUF_LEN */
 static u32  g_ws_http_buffer_len = 0; /* current allocated size of g_ws_http_buffer */
-static char *g_rest_out = NULL;
+static esif_ccb_poll_t g_ws_poll = ESIF_CCB_POLL_INVALID; /* poller for listener and client sockets */
+static Bool g_ws_dirty = ESIF_FALSE;   /* client state changed on another thread; revisit all clients */
+static atomic_t g_ws_dropped_frames = 0; /* broadcast frames dropped due to client backpressure */
+
+static esif_ccb_mutex_t g_ws_rest_lock; /* lock REST job queue */
+static esif_ccb_sem_t g_ws_rest_sem;    /* signaled once for each queued REST job */
+static WsRestJobPtr g_ws_rest_head = NULL;
+static WsRestJobPtr g_ws_rest_tail = NULL;
+static esif_thread_t g_ws_rest_thread;
+static atomic_t g_ws_rest_quit = 0;
 
 static atomic_t g_ws_quit = 0;
 atomic_t g_ws_threads = 0;
@@ -147,32 +171,28 @@ esif_ccb_socket_t g_listen = INVALID_SOCKET;
 
 int esif_ws_init(void)
 {
-	int index=0;
+	u32 index=0;
 	int retVal=0;
 	char *ipaddr = (char*)g_ws_ipaddr;
 	char *portPtr = g_ws_port;
 
 	struct sockaddr_in addrSrvr = {0};
-	struct sockaddr_in addrClient = {0};
 	socklen_t len_inet = 0;
 
-	esif_ccb_socket_t client_socket = INVALID_SOCKET;
-
 	int option = 1;
-	eEsifError req_results = ESIF_OK;
-	ClientRecordPtr clientPtr = NULL;
-
-	int selRetVal = 0;
-	int maxfd = 0;
-	int setsize = 0;
+	Bool restStarted = ESIF_FALSE;
+	WsRestJobPtr jobPtr = NULL;
 
-	struct timeval tv={0}; 	/* Timeout value */
-	fd_set workingSet = {0};
+	int eventCount = 0;
+	esif_ccb_poll_event_t events[WS_POLL_MAX_EVENTS];
 
 	atomic_inc(&g_ws_threads);
 	atomic_set(&g_ws_quit, 0);
+	atomic_set(&g_ws_rest_quit, 0);
 
 	esif_ccb_mutex_init(&g_ws_lock);
+	esif_ccb_mutex_init(&g_ws_rest_lock);
+	esif_ccb_sem_init(&g_ws_rest_sem);
 	esif_ccb_mutex_lock(&g_ws_lock);
 
 
@@ -180,10 +200,11 @@ int esif_ws_init(void)
 
 	esif_ccb_socket_init();
 
-	// Allocate pool of Client Records and HTTP input buffer
+	// Allocate pool of Client Records, HTTP input buffer, and Socket Poller
 	esif_ws_server_initialize_clients();
 	esif_ws_buffer_resize(WS_BUFFER_LENGTH);
-	if (NULL == g_clients || NULL == g_ws_http_buffer) {
+	g_ws_poll = esif_ccb_poll_create((int)g_ws_client_slots + 1);
+	if (NULL == g_clients || NULL == g_ws_http_buffer || ESIF_CCB_POLL_INVALID == g_ws_poll) {
 		ESIF_TRACE_DEBUG("Out of memory");
 		goto exit;
 	}
@@ -214,120 +235,87 @@ int esif_ws_init(void)
 		goto exit;
 	}
 
-	retVal = listen(g_listen, MAX_CLIENTS);
+	retVal = listen(g_listen, (int)g_ws_client_slots);
 	if (retVal < 0) {
 		ESIF_TRACE_DEBUG("listen system call failed, error #%d", errno);
 		goto exit;
 	}
 
-	/* Accept client requests and new connections until told to quit */
-	while (!atomic_read(&g_ws_quit)) {
-
-		/* Build file descriptor set of active sockets */
-		maxfd = 0;
-		setsize = 0;
-
-		/* Clear the FD set we will check after each iteration */
-		FD_ZERO(&workingSet);
-
-		/* Add our listner to the FD set to check */
-		FD_SET((u_int)g_listen, &workingSet);
-		maxfd = (int)g_listen + 1;
-		setsize++;
-
-		/* Add our current clients to the FD set to check */
-		for (index = 0; index < MAX_CLIENTS && setsize < MAX_SOCKETS; index++) {
-			if (g_clients[index].socket != INVALID_SOCKET) {
-				FD_SET((u_int)g_clients[index].socket, &workingSet);
-				maxfd = esif_ccb_max(maxfd, (int)g_clients[index].socket + 1);
-				setsize++;
-			}
-		}
+	if (esif_ccb_socket_set_nonblocking(g_listen) != 0 ||
+		esif_ccb_poll_add(g_ws_poll, g_listen, ESIF_CCB_POLLIN, &g_listen) != 0) {
+		ESIF_TRACE_DEBUG("unable to poll listener, error #%d", esif_ccb_socket_error());
+		goto exit;
+	}
 
-		/* If we have nothing functional in the FD set to check; break */
-		if (maxfd == 0) {
-			break;
-		}
+	/* Execute REST commands on a worker so slow shell commands do not block the event loop */
+	if (esif_ccb_thread_create(&g_ws_rest_thread, esif_ws_server_rest_worker_thread, NULL) != ESIF_OK) {
+		ESIF_TRACE_DEBUG("unable to start REST worker thread");
+		goto exit;
+	}
+	restStarted = ESIF_TRUE;
 
-		/*
-		 *  timeout of N + 0.05 secs
-		 */
-		tv.tv_sec  = 2;
-		tv.tv_usec = 50000;
+	/* Accept client requests and new connections until told to quit */
+	while (!atomic_read(&g_ws_quit)) {
 
 		/* Wait for activity on listener or client sockets for up to maximum timeout period */
 		esif_ccb_mutex_unlock(&g_ws_lock);
-		selRetVal  = select(maxfd, &workingSet, NULL, NULL, &tv);
+		eventCount = esif_ccb_poll_wait(g_ws_poll, events, WS_POLL_MAX_EVENTS, WS_POLL_TIMEOUT_MSEC);
 		esif_ccb_mutex_lock(&g_ws_lock);
 
-		if (selRetVal == SOCKET_ERROR) {
+		if (eventCount == SOCKET_ERROR) {
 			break;
-		} else if (!selRetVal) {
-			continue;
 		}
 
-		/* Accept any new connections on the listening socket */
-		if (FD_ISSET(g_listen, &workingSet)) {
-			int sockets = 1;
-			len_inet = sizeof addrClient;
-
-			client_socket = (int)accept(g_listen, (struct sockaddr*)&addrClient, &len_inet);
-
-			if (client_socket == SOCKET_ERROR) {
-				ESIF_TRACE_DEBUG("accept(2)");
-				goto exit;
-			}
-
-			/* Find the first empty client in our list */
-			for (index = 0; index < MAX_CLIENTS && sockets < MAX_SOCKETS; index++) {
-				if (g_clients[index].socket == INVALID_SOCKET) {
-					esif_ws_client_initialize_client(&g_clients[index]);
-					g_clients[index].socket = client_socket;
-					client_socket = INVALID_SOCKET;
-					break;
-				}
-				sockets++;
-			}
+		for (index = 0; index < (u32)eventCount; index++) {
+			void *context = esif_ccb_poll_event_context(&events[index]);
+			u32 flags = esif_ccb_poll_event_flags(&events[index]);
+			ClientRecordPtr clientPtr = (ClientRecordPtr)context;
 
-			/* If all clients are in use, close the new client */
-			if (index >= MAX_CLIENTS || sockets >= MAX_SOCKETS) {
-				ESIF_TRACE_DEBUG("Connection Limit Exceeded (%d)", MAX_CLIENTS);
-				esif_ccb_socket_close(client_socket);
-				client_socket = INVALID_SOCKET;
+			/* Accept any new connections on the listening socket */
+			if (context == &g_listen) {
+				esif_ws_server_accept_clients();
 				continue;
 			}
-			if (client_socket != INVALID_SOCKET) {
-				esif_ccb_socket_close(client_socket);
-				client_socket = INVALID_SOCKET;
-			}
-		}
 
-		/* Go through our client list and check if the FD set indicates any have activity */
-		for (index = 0; index < MAX_CLIENTS; index++) {
-			client_socket = g_clients[index].socket;
-			if (client_socket == INVALID_SOCKET || client_socket == g_listen) {
+			/* Ignore stale events for clients closed earlier in this batch */
+			if (clientPtr->socket == INVALID_SOCKET) {
 				continue;
 			}
 
-			/* Process client if it is in the set of active file descriptors */
-			if (FD_ISSET(client_socket, &workingSet)) {
-				ESIF_TRACE_DEBUG("Client %d connected\n", client_socket);
-
+			if (flags & ESIF_CCB_POLLOUT) {
+				esif_ws_client_flush(clientPtr);
+			}
+			if ((flags & ESIF_CCB_POLLIN) && !clientPtr->closeNow) {
 				/******************** Process the client request ********************/
-				clientPtr = &g_clients[index];
-				req_results = esif_ws_client_process_request(clientPtr);
+				eEsifError req_results = esif_ws_client_process_request(clientPtr);
 
 				if (req_results == ESIF_E_WS_DISC) {
-					ESIF_TRACE_DEBUG("Client %d disconnected\n", client_socket);
-					esif_ws_client_initialize_client(clientPtr); /* reset */
+					ESIF_TRACE_DEBUG("Client %d disconnected\n", clientPtr->socket);
+					clientPtr->closePending = ESIF_TRUE;
 				}
 				else if (req_results == ESIF_E_NO_MEMORY) {
 					ESIF_TRACE_DEBUG("Out of memory\n");
-					esif_ws_client_initialize_client(clientPtr); /* reset */
+					clientPtr->closeNow = ESIF_TRUE;
 				}
+			}
+			else if (flags & ESIF_CCB_POLLERR) {
+				clientPtr->closeNow = ESIF_TRUE;
+			}
+			esif_ws_client_update(clientPtr);
+		}
 
-				/* Clear everything after use */
-				esif_ws_protocol_initialize(&clientPtr->prot);
+		/* Revisit clients whose state was changed by the REST worker or broadcasts */
+		if (g_ws_dirty) {
+			g_ws_dirty = ESIF_FALSE;
+			for (index = 0; index < g_ws_client_slots; index++) {
+				ClientRecordPtr clientPtr = &g_clients[index];
+				if (clientPtr->socket == INVALID_SOCKET) {
+					continue;
+				}
+				if (clientPtr->recvLen > 0 && esif_ws_client_process_input(clientPtr) == ESIF_E_NO_MEMORY) {
+					clientPtr->closeNow = ESIF_TRUE;
+				}
+				esif_ws_client_update(clientPtr);
 			}
 		}
 	}
@@ -338,17 +326,33 @@ exit:
 		esif_ccb_socket_close(g_listen);
 		g_listen = INVALID_SOCKET;
 	}
+
+	/* Stop REST worker; it needs g_ws_lock to deliver responses */
+	if (restStarted) {
+		esif_ccb_mutex_unlock(&g_ws_lock);
+		atomic_set(&g_ws_rest_quit, 1);
+		esif_ccb_sem_up(&g_ws_rest_sem);
+		esif_ccb_thread_join(&g_ws_rest_thread);
+		esif_ccb_mutex_lock(&g_ws_lock);
+	}
+	while ((jobPtr = g_ws_rest_head) != NULL) {
+		g_ws_rest_head = jobPtr->next;
+		esif_ccb_free(jobPtr);
+	}
+	g_ws_rest_tail = NULL;
+
 	if (g_clients) {
-		for (index = 0; index < MAX_CLIENTS; index++) {
-			esif_ws_client_close_client(&g_clients[index]);
+		for (index = 0; index < g_ws_client_slots; index++) {
+			esif_ws_client_initialize_client(&g_clients[index]);
 		}
 		esif_ccb_free(g_clients);
 		g_clients = NULL;
+		g_ws_client_slots = 0;
 	}
-	esif_ccb_free(g_rest_out);
+	esif_ccb_poll_destroy(g_ws_poll);
+	g_ws_poll = ESIF_CCB_POLL_INVALID;
 	esif_ccb_free(g_ws_http_buffer);
 	esif_ccb_free(g_ws_broadcast_frame);
-	g_rest_out = NULL;
 	g_ws_http_buffer = NULL;
 	g_ws_http_buffer_len = 0;
 	g_ws_broadcast_frame = NULL;
@@ -356,6 +360,8 @@ exit:
 	esif_ccb_socket_exit();
 	atomic_dec(&g_ws_threads);
 	esif_ccb_mutex_unlock(&g_ws_lock);
+	esif_ccb_sem_uninit(&g_ws_rest_sem);
+	esif_ccb_mutex_uninit(&g_ws_rest_lock);
 	esif_ccb_mutex_uninit(&g_ws_lock);
 	return 0;
 }
@@ -387,43 +393,42 @@ void esif_ws_server_set_ipaddr_port(const char *ipaddr, u32 portPtr, Bool restri
 	g_ws_restricted = restricted;
 }
 
-
-char *esif_ws_server_get_rest_response(size_t *msgLenPtr)
+/* Set Max number of Client connections. Takes effect the next time the server is started */
+void esif_ws_server_set_max_clients(u32 maxClients)
 {
-	char *msgPtr = g_rest_out;
-	size_t msgLen = 0;
-
-	ESIF_TRACE_DEBUG("Message Received: %s \n", msgPtr);
-
-	if (msgPtr == NULL) {
-		goto exit;
+	if (maxClients == 0) {
+		maxClients = WS_DEFAULT_MAX_CLIENTS;
 	}
+	g_ws_max_clients = esif_ccb_min(maxClients, WS_MAX_CLIENTS_LIMIT);
+}
 
-	msgLen = esif_ccb_strlen((char *)msgPtr, g_ws_http_buffer_len);
-	if (msgLen == 0) {
-		goto exit;
-	}
+u32 esif_ws_server_get_max_clients(void)
+{
+	return g_ws_max_clients;
+}
 
-	*msgLenPtr = msgLen;
-exit:
-	return msgPtr;
+/* Broadcast frames dropped for backlogged clients since ESIF started */
+UInt64 esif_ws_server_get_dropped_frames(void)
+{
+	return (UInt64)atomic_read(&g_ws_dropped_frames);
 }
 
 
-void esif_ws_server_execute_rest_cmd(
+/* Execute a REST command and return a dynamically allocated "msgid:response" string, or NULL */
+char *esif_ws_server_execute_rest_cmd(
 	const char *dataPtr,
 	const size_t dataSize
 	)
 {
 	char *command_buf = NULL;
+	char *rest_out = NULL;
 
 	if (atomic_read(&g_ws_quit))
-		return;
+		return NULL;
 
 	command_buf = strchr(dataPtr, ':');
 	if (NULL == command_buf) {
-		esif_ccb_free(g_rest_out);
-		g_rest_out = esif_ccb_strdup("0:ERROR");
+		rest_out = esif_ccb_strdup("0:ERROR");
 	}
 	else {
 		u32 msg_id = atoi(dataPtr);
@@ -482,8 +487,7 @@ void esif_ws_server_execute_rest_cmd(
 			if (response) {
 				char buffer[MAX_PATH] = { 0 };
 				esif_ccb_sprintf(sizeof(buffer), buffer, "%d:%s", msg_id, response);
-				esif_ccb_free(g_rest_out);
-				g_rest_out = esif_ccb_strdup(buffer);
+				rest_out = esif_ccb_strdup(buffer);
 				goto exit;
 			}
 		}
@@ -495,23 +499,113 @@ void esif_ws_server_execute_rest_cmd(
 			if (NULL != cmd_results) {
 				strip_extended_ascii(cmd_results);
 				size_t out_len = esif_ccb_strlen(cmd_results, OUT_BUF_LEN) + MIN_REST_OUT_PADDING;
-				esif_ccb_free(g_rest_out);
-				g_rest_out = (EsifString) esif_ccb_malloc(out_len);
-				if (g_rest_out && out_len >= MIN_REST_OUT_PADDING) {
-					esif_ccb_sprintf(out_len, g_rest_out, "%u:%s", msg_id, cmd_results);
+				rest_out = (EsifString) esif_ccb_malloc(out_len);
+				if (rest_out && out_len >= MIN_REST_OUT_PADDING) {
+					esif_ccb_sprintf(out_len, rest_out, "%u:%s", msg_id, cmd_results);
 				}
-				esif_ws_buffer_resize(WS_BUFFER_LENGTH);
 			}
 			else {
-				esif_ccb_free(g_rest_out);
-				g_rest_out = esif_ccb_strdup("0:");
+				rest_out = esif_ccb_strdup("0:");
 			}
 		}
 		esif_uf_shell_unlock();
 	}
 
 exit:
-	return;
+	return rest_out;
+}
+
+
+/* Queue a copy of a REST command for the REST worker thread. Called with g_ws_lock held */
+static eEsifError esif_ws_server_queue_rest_cmd(
+	ClientRecordPtr clientPtr,
+	const char *dataPtr,
+	size_t dataSize
+	)
+{
+	WsRestJobPtr jobPtr = (WsRestJobPtr)esif_ccb_malloc(sizeof(*jobPtr) + dataSize);
+	if (NULL == jobPtr) {
+		return ESIF_E_NO_MEMORY;
+	}
+	jobPtr->clientIndex = (u32)(clientPtr - g_clients);
+	jobPtr->generation = clientPtr->generation;
+	jobPtr->commandLen = dataSize;
+	esif_ccb_memcpy(jobPtr->command, dataPtr, dataSize);
+	jobPtr->command[dataSize] = 0;
+
+	esif_ccb_mutex_lock(&g_ws_rest_lock);
+	if (g_ws_rest_tail) {
+		g_ws_rest_tail->next = jobPtr;
+	}
+	else {
+		g_ws_rest_head = jobPtr;
+	}
+	g_ws_rest_tail = jobPtr;
+	esif_ccb_mutex_unlock(&g_ws_rest_lock);
+
+	clientPtr->restPending = ESIF_TRUE;
+	esif_ccb_sem_up(&g_ws_rest_sem);
+	return ESIF_OK;
+}
+
+
+/* REST worker: execute queued commands in order and queue the responses to their clients */
+static void *ESIF_CALLCONV esif_ws_server_rest_worker_thread(void *ptr)
+{
+	UNREFERENCED_PARAMETER(ptr);
+
+	while (!atomic_read(&g_ws_rest_quit)) {
+		WsRestJobPtr jobPtr = NULL;
+		char *restRespPtr = NULL;
+		u8 *framePtr = NULL;
+		size_t frameSize = 0;
+
+		esif_ccb_sem_down(&g_ws_rest_sem);
+
+		esif_ccb_mutex_lock(&g_ws_rest_lock);
+		jobPtr = g_ws_rest_head;
+		if (jobPtr) {
+			g_ws_rest_head = jobPtr->next;
+			if (g_ws_rest_head == NULL) {
+				g_ws_rest_tail = NULL;
+			}
+		}
+		esif_ccb_mutex_unlock(&g_ws_rest_lock);
+
+		if (NULL == jobPtr) {
+			continue;
+		}
+
+		restRespPtr = esif_ws_server_execute_rest_cmd(jobPtr->command, jobPtr->commandLen);
+		if (restRespPtr != NULL) {
+			size_t restRespSize = esif_ccb_strlen(restRespPtr, OUT_BUF_LEN + MIN_REST_OUT_PADDING);
+			size_t bufferSize = restRespSize + sizeof(WsSocketFrame);
+			framePtr = (u8 *)esif_ccb_malloc(bufferSize);
+			if (framePtr) {
+				esif_ws_socket_build_payload(restRespPtr, restRespSize, (WsSocketFramePtr)framePtr, bufferSize, &frameSize, TEXT_FRAME);
+			}
+		}
+
+		/* Deliver response unless the client disconnected and its slot was reused */
+		esif_ccb_mutex_lock(&g_ws_lock);
+		if (g_clients && jobPtr->clientIndex < g_ws_client_slots) {
+			ClientRecordPtr clientPtr = &g_clients[jobPtr->clientIndex];
+			if (clientPtr->socket != INVALID_SOCKET && clientPtr->generation == jobPtr->generation) {
+				if (framePtr && frameSize > 0) {
+					esif_ws_client_write_to_socket(clientPtr, (char *)framePtr, frameSize);
+				}
+				clientPtr->restPending = ESIF_FALSE;
+				g_ws_dirty = ESIF_TRUE;
+				esif_ccb_poll_wake(g_ws_poll);
+			}
+		}
+		esif_ccb_mutex_unlock(&g_ws_lock);
+
+		esif_ccb_free(framePtr);
+		esif_ccb_free(restRespPtr);
+		esif_ccb_free(jobPtr);
+	}
+	return 0;
 }
 
 
@@ -586,53 +680,199 @@ static int esif_ws_server_create_inet_addr(
 }
 
 
-static int esif_ws_client_write_to_socket(
+/* Accept all pending connections on the non-blocking listener */
+static void esif_ws_server_accept_clients(void)
+{
+	struct sockaddr_in addrClient = {0};
+	socklen_t len_inet = 0;
+	esif_ccb_socket_t client_socket = INVALID_SOCKET;
+	u32 index = 0;
+
+	for (;;) {
+		len_inet = sizeof addrClient;
+		client_socket = accept(g_listen, (struct sockaddr*)&addrClient, &len_inet);
+
+		if (client_socket == INVALID_SOCKET || client_socket == SOCKET_ERROR) {
+			if (!esif_ccb_socket_would_block()) {
+				ESIF_TRACE_DEBUG("accept(2) error #%d", esif_ccb_socket_error());
+			}
+			break;
+		}
+
+		/* Find the first empty client in our list */
+		for (index = 0; index < g_ws_client_slots; index++) {
+			if (g_clients[index].socket == INVALID_SOCKET) {
+				break;
+			}
+		}
+
+		/* If all clients are in use, close the new client */
+		if (index >= g_ws_client_slots) {
+			ESIF_TRACE_DEBUG("Connection Limit Exceeded (%u)", g_ws_client_slots);
+			esif_ccb_socket_close(client_socket);
+			continue;
+		}
+
+		esif_ws_client_initialize_client(&g_clients[index]);
+		if (esif_ccb_socket_set_nonblocking(client_socket) != 0 ||
+			esif_ccb_poll_add(g_ws_poll, client_socket, ESIF_CCB_POLLIN, &g_clients[index]) != 0) {
+			ESIF_TRACE_DEBUG("Unable to poll client, error #%d", esif_ccb_socket_error());
+			esif_ccb_socket_close(client_socket);
+			continue;
+		}
+		g_clients[index].socket = client_socket;
+		g_clients[index].pollEvents = ESIF_CCB_POLLIN;
+		ESIF_TRACE_DEBUG("Client %d connected\n", client_socket);
+	}
+}
+
+
+/* Append data to a client's output queue */
+static int esif_ws_client_queue_output(
 	ClientRecordPtr clientPtr,
 	const char *bufferPtr,
 	size_t bufferSize
 	)
 {
-	ssize_t ret=0;
-
-	ret = send(clientPtr->socket, (char*)bufferPtr, (int)bufferSize, ESIF_WS_SEND_FLAGS);
-	if (ret == -1 || ret != (ssize_t)bufferSize) {
-		esif_ccb_socket_close(clientPtr->socket);
-		clientPtr->socket = INVALID_SOCKET;
-		ESIF_TRACE_DEBUG("Error writing to socket: %s", (ret == -1 ? "Error in sending packets\n" : "Incomplete data\n"));
+	if (clientPtr->socket == INVALID_SOCKET || clientPtr->closeNow) {
 		return EXIT_FAILURE;
 	}
+
+	/* Reclaim space already sent before growing the buffer */
+	if (clientPtr->sendOffset > 0 && clientPtr->sendLen + bufferSize > clientPtr->sendBufLen) {
+		clientPtr->sendLen -= clientPtr->sendOffset;
+		esif_ccb_memmove(clientPtr->sendBuf, clientPtr->sendBuf + clientPtr->sendOffset, clientPtr->sendLen);
+		clientPtr->sendOffset = 0;
+	}
+	if (clientPtr->sendLen + bufferSize > clientPtr->sendBufLen) {
+		size_t newLen = esif_ccb_max(esif_ccb_max(clientPtr->sendBufLen * 2, WS_SEND_BUFFER_INITIAL), clientPtr->sendLen + bufferSize);
+		u8 *newBuffer = (u8 *)esif_ccb_realloc(clientPtr->sendBuf, newLen);
+		if (NULL == newBuffer) {
+			return EXIT_FAILURE;
+		}
+		clientPtr->sendBuf = newBuffer;
+		clientPtr->sendBufLen = newLen;
+	}
+	esif_ccb_memcpy(clientPtr->sendBuf + clientPtr->sendLen, bufferPtr, bufferSize);
+	clientPtr->sendLen += bufferSize;
 	return EXIT_SUCCESS;
 }
 
+
+/* Send as much pending output as the socket will accept without blocking */
+static int esif_ws_client_flush(ClientRecordPtr clientPtr)
+{
+	while (clientPtr->sendOffset < clientPtr->sendLen) {
+		ssize_t ret = send(clientPtr->socket,
+			(char*)clientPtr->sendBuf + clientPtr->sendOffset,
+			(int)(clientPtr->sendLen - clientPtr->sendOffset),
+			ESIF_WS_SEND_FLAGS);
+
+		if (ret > 0) {
+			clientPtr->sendOffset += (size_t)ret;
+		}
+		else if (ret == SOCKET_ERROR && esif_ccb_socket_would_block()) {
+			break;
+		}
+		else {
+			ESIF_TRACE_DEBUG("Error writing to socket: error #%d\n", esif_ccb_socket_error());
+			clientPtr->closeNow = ESIF_TRUE;
+			return EXIT_FAILURE;
+		}
+	}
+	if (clientPtr->sendOffset == clientPtr->sendLen) {
+		clientPtr->sendOffset = clientPtr->sendLen = 0;
+	}
+	return EXIT_SUCCESS;
+}
+
+
+/* Queue data for a client and send as much as possible without blocking. Called with g_ws_lock held */
+int esif_ws_client_write_to_socket(
+	ClientRecordPtr clientPtr,
+	const char *bufferPtr,
+	size_t bufferSize
+	)
+{
+	if (esif_ws_client_queue_output(clientPtr, bufferPtr, bufferSize) != EXIT_SUCCESS) {
+		clientPtr->closeNow = ESIF_TRUE;
+		return EXIT_FAILURE;
+	}
+	return esif_ws_client_flush(clientPtr);
+}
+
+
+/* Close client if finished, otherwise update the poller with the events it is now interested in */
+static void esif_ws_client_update(ClientRecordPtr clientPtr)
+{
+	size_t pending = clientPtr->sendLen - clientPtr->sendOffset;
+	u32 events = 0;
+
+	if (clientPtr->socket == INVALID_SOCKET) {
+		return;
+	}
+	if (clientPtr->closeNow || (clientPtr->closePending && pending == 0)) {
+		esif_ws_client_initialize_client(clientPtr); /* reset */
+		return;
+	}
+
+	/* Stop reading while a REST command is outstanding or the client is not draining its output */
+	if (!clientPtr->restPending && !clientPtr->closePending && pending <= WS_MAX_PENDING_OUTPUT) {
+		events |= ESIF_CCB_POLLIN;
+	}
+	if (pending > 0) {
+		events |= ESIF_CCB_POLLOUT;
+	}
+	if (events != clientPtr->pollEvents) {
+		if (esif_ccb_poll_modify(g_ws_poll, clientPtr->socket, events, clientPtr) != 0) {
+			esif_ws_client_initialize_client(clientPtr); /* reset */
+			return;
+		}
+		clientPtr->pollEvents = events;
+	}
+}
+
+
 static int esif_ws_broadcast_frame(
 	const u8 *framePtr,
 	size_t frameSize
 	)
 {
-	ssize_t ret = 0;
 	int rc = EXIT_SUCCESS;
-	int index = 0;
+	u32 index = 0;
+	Bool wake = ESIF_FALSE;
 
 	if (NULL == g_clients) {
 		rc = EXIT_FAILURE;
 		goto exit;
 	}
 
-	for (index = 0; index < MAX_CLIENTS; index++) {
+	for (index = 0; index < g_ws_client_slots; index++) {
 		ClientRecordPtr clientPtr = &g_clients[index];
 
-		if (clientPtr->socket == INVALID_SOCKET || clientPtr->socket == g_listen || clientPtr->state != STATE_NORMAL) {
+		if (clientPtr->socket == INVALID_SOCKET || clientPtr->state != STATE_NORMAL || clientPtr->closePending || clientPtr->closeNow) {
 			continue;
 		}
 
-		ret = send(clientPtr->socket, (char*)framePtr, (int)frameSize, ESIF_WS_SEND_FLAGS);
+		/* Drop frames for slow clients rather than buffering without limit */
+		if ((clientPtr->sendLen - clientPtr->sendOffset) + frameSize > WS_MAX_PENDING_OUTPUT) {
+			atomic_inc(&g_ws_dropped_frames);
+			ESIF_TRACE_DEBUG("Client %d backlogged; broadcast frame dropped\n", clientPtr->socket);
+			continue;
+		}
 
-		if (ret == -1 || ret != (ssize_t)frameSize) {
-			esif_ccb_socket_close(clientPtr->socket);
-			clientPtr->socket = INVALID_SOCKET;
-			ESIF_TRACE_DEBUG("Error writing to socket: %s", (ret == -1 ? "Error in sending packets\n" : "Incomplete data\n"));
+		if (esif_ws_client_write_to_socket(clientPtr, (const char *)framePtr, frameSize) != EXIT_SUCCESS) {
 			rc = EXIT_FAILURE;
 		}
+		if (clientPtr->closeNow || clientPtr->sendLen > clientPtr->sendOffset) {
+			wake = ESIF_TRUE;
+		}
+	}
+
+	/* Let the event loop close failed clients and poll for writability */
+	if (wake) {
+		g_ws_dirty = ESIF_TRUE;
+		esif_ccb_poll_wake(g_ws_poll);
 	}
 
 exit:
@@ -641,69 +881,128 @@ exit:
 
 
 /*
- * This function processes requests for either websocket connections or
- * http connections.
+ * This function reads whatever data is available from the client socket and
+ * processes any complete requests for either websocket connections or
+ * http connections. Partial requests are kept until the rest arrives.
  */
 static eEsifError esif_ws_client_process_request(ClientRecordPtr clientPtr)
 {
 	eEsifError result = ESIF_OK;
 	ssize_t messageLength  = 0;
-
-	esif_ccb_memset(g_ws_http_buffer, 0, g_ws_http_buffer_len);
+	size_t maxInput = g_ws_http_buffer_len;
+
+	/* Grow input buffer if necessary, up to the size of the HTTP buffer */
+	if (clientPtr->recvLen + 1 >= clientPtr->recvBufLen && clientPtr->recvBufLen < maxInput) {
+		size_t newLen = esif_ccb_min(esif_ccb_max(clientPtr->recvBufLen * 2, WS_RECV_BUFFER_INITIAL), maxInput);
+		char *newBuffer = (char *)esif_ccb_realloc(clientPtr->recvBuf, newLen);
+		if (NULL == newBuffer) {
+			result = ESIF_E_NO_MEMORY;
+			goto exit;
+		}
+		clientPtr->recvBuf = newBuffer;
+		clientPtr->recvBufLen = newLen;
+	}
+	if (clientPtr->recvLen + 1 >= clientPtr->recvBufLen) {
+		ESIF_TRACE_DEBUG("Request too large\n");
+		result = ESIF_E_WS_DISC;
+		goto exit;
+	}
 
 	/*Pull the next message from the client socket */
-	messageLength = recv(clientPtr->socket, (char*)g_ws_http_buffer, g_ws_http_buffer_len, 0);
+	messageLength = recv(clientPtr->socket, clientPtr->recvBuf + clientPtr->recvLen, (int)(clientPtr->recvBufLen - clientPtr->recvLen - 1), 0);
+	if (messageLength == SOCKET_ERROR && esif_ccb_socket_would_block()) {
+		goto exit;
+	}
 	if (messageLength == 0 || messageLength == SOCKET_ERROR) {
 		ESIF_TRACE_DEBUG("no messages received from the socket\n");
+		clientPtr->closeNow = ESIF_TRUE;
 		result =  ESIF_E_WS_DISC;
 		goto exit;
 	}
 	ESIF_TRACE_DEBUG("%d bytes received\n", (int)messageLength);
+	clientPtr->recvLen += (size_t)messageLength;
+	clientPtr->recvBuf[clientPtr->recvLen] = 0;
 
-	switch (clientPtr->state) {
-	case STATE_OPENING:
-		result = esif_ws_client_open_client(clientPtr, (char *)g_ws_http_buffer, g_ws_http_buffer_len, (size_t)messageLength);
-		break;
-	case STATE_NORMAL:
-		result = esif_ws_client_process_active_client(clientPtr, (char *)g_ws_http_buffer, g_ws_http_buffer_len, (size_t)messageLength);
-		break;
-	default:
-		result = ESIF_E_WS_DISC;
-		break;
-	}
-
+	result = esif_ws_client_process_input(clientPtr);
 exit:
 	return result;
 }
 
 
+/* Process as many complete requests as are buffered for this client */
+static eEsifError esif_ws_client_process_input(ClientRecordPtr clientPtr)
+{
+	eEsifError result = ESIF_OK;
+
+	while (clientPtr->recvLen > 0 && !clientPtr->restPending && !clientPtr->closePending && !clientPtr->closeNow) {
+		size_t consumed = 0;
+
+		switch (clientPtr->state) {
+		case STATE_OPENING:
+			result = esif_ws_client_open_client(clientPtr, &consumed);
+			break;
+		case STATE_NORMAL:
+			result = esif_ws_client_process_active_client(clientPtr, &consumed);
+			break;
+		default:
+			result = ESIF_E_WS_DISC;
+			break;
+		}
+
+		if (result == ESIF_E_WS_DISC) {
+			clientPtr->closePending = ESIF_TRUE;
+		}
+		if (result != ESIF_OK) {
+			break;
+		}
+		if (consumed == 0) {
+			break;	/* Incomplete request; wait for more data */
+		}
+
+		clientPtr->recvLen -= consumed;
+		esif_ccb_memmove(clientPtr->recvBuf, clientPtr->recvBuf + consumed, clientPtr->recvLen);
+		clientPtr->recvBuf[clientPtr->recvLen] = 0;
+	}
+	return result;
+}
+
+
 /*
  * This function processes the socket when it is in the "opening" state
  */
 static eEsifError esif_ws_client_open_client(
 	ClientRecordPtr clientPtr,
-	char *bufferPtr,
-	size_t bufferSize,
-	size_t messageLength
+	size_t *consumedPtr
 	)
 {
 	eEsifError result = ESIF_OK;
 	FrameType frameType;
 	size_t frameSize = 0;
+	char *bufferPtr = NULL;
+	size_t bufferSize = 0;
+	size_t messageLength = clientPtr->recvLen;
 
 	ESIF_ASSERT(clientPtr->state == STATE_OPENING);
 	ESIF_ASSERT(messageLength > 0);
 
 	ESIF_TRACE_DEBUG("Socket in its opening state\n");
+
+	/* Responses are built in the HTTP buffer, which may have grown since the client connected */
+	esif_ws_buffer_resize(WS_BUFFER_LENGTH);
+	bufferPtr = g_ws_http_buffer;
+	bufferSize = g_ws_http_buffer_len;
+
 	/*Determine the initial frame type:  http frame type or websocket frame type */
-	frameType = esif_ws_socket_get_initial_frame_type(bufferPtr, messageLength, &clientPtr->prot);
+	frameType = esif_ws_socket_get_initial_frame_type(clientPtr->recvBuf, messageLength, &clientPtr->prot);
+
+	/* Wait for the rest of the request unless the input buffer is already full */
+	if (INCOMPLETE_FRAME == frameType && messageLength + 1 < bufferSize) {
+		ESIF_TRACE_DEBUG("Incomplete frame received\n");
+		goto exit;
+	}
 
 	if ((INCOMPLETE_FRAME == frameType) ||  (ERROR_FRAME == frameType)) {
-		if (INCOMPLETE_FRAME == frameType) {
-			ESIF_TRACE_DEBUG("Incomplete frame received\n");
-		} else {
-			ESIF_TRACE_DEBUG("Improper format for frame\n");
-		}
+		ESIF_TRACE_DEBUG("Improper format for frame\n");
 
 		/*
 		 * If the socket frame type is in error or is incomplete and happens to
@@ -740,12 +1039,19 @@ static eEsifError esif_ws_client_open_client(
 
 		/**************************** This is a now a websocket connection ****************************/
 		clientPtr->state = STATE_NORMAL;
+		*consumedPtr = (size_t)(esif_ccb_strstr(clientPtr->recvBuf, "\r\n\r\n") - clientPtr->recvBuf) + 4;
 	}
 
 	if (HTTP_FRAME == frameType) {
-		result = esif_ws_http_process_reqs(clientPtr, g_ws_http_buffer, g_ws_http_buffer_len, messageLength);
+		/* HTTP responses are always "Connection: close" */
+		esif_ccb_memcpy(bufferPtr, clientPtr->recvBuf, messageLength);
+		result = esif_ws_http_process_reqs(clientPtr, bufferPtr, bufferSize, messageLength);
+		clientPtr->closePending = ESIF_TRUE;
+		*consumedPtr = messageLength;
 	}
 exit:
+	/* Clear everything after use */
+	esif_ws_protocol_initialize(&clientPtr->prot);
 	return result;
 }
 
@@ -771,13 +1077,13 @@ static void strip_extended_ascii(char *bufferToClean)
 }
 
 /*
- * This function processes requests for clients already opened.
+ * This function processes the next buffered frame for clients already opened.
+ * TEXT frames are queued to the REST worker; no further frames are processed
+ * for this client until the response has been queued.
  */
 static eEsifError esif_ws_client_process_active_client(
 	ClientRecordPtr clientPtr,
-	char *bufferPtr,
-	size_t bufferSize,
-	size_t messageLength
+	size_t *consumedPtr
 	)
 {
 	eEsifError result = ESIF_OK;
@@ -785,134 +1091,75 @@ static eEsifError esif_ws_client_process_active_client(
 	size_t frameSize       = 0;
 	char *data 		   = NULL;
 	size_t dataSize        = 0;
-	char *restRespPtr = NULL;
-	size_t restRespSize = 0;
 	size_t bytesRemaining  = 0;
-	char *bufferRemaining = NULL;
-	char *textStrPtr = NULL;
-
-	do {
-		/* If more frames remaining, copy them into buffer and reparse */
-		if (bytesRemaining != 0) {
-			esif_ccb_memcpy(bufferPtr, bufferRemaining, bytesRemaining);
-			messageLength = bytesRemaining;
-			bytesRemaining = 0;
-		}
-
-		frameType = esif_ws_socket_get_subsequent_frame_type((WsSocketFramePtr)bufferPtr, messageLength, &data, &dataSize, &bytesRemaining);
-		ESIF_TRACE_DEBUG("FrameType: %d\n", frameType);
-
-		/* Save remaining frames for reparsing if more than one frame received */
-		if (bytesRemaining > 0) {
-			if (bufferRemaining == NULL) {
-				bufferRemaining = (char *)esif_ccb_malloc(bytesRemaining);
-				if (NULL == bufferRemaining) {
-					result = ESIF_E_NO_MEMORY;
-					goto exit;
-				}
-			}
-			esif_ccb_memcpy(bufferRemaining, data + dataSize, bytesRemaining);
-		}
-		else {
-			esif_ccb_free(bufferRemaining);
-			bufferRemaining = NULL;
-		}
-
-		/*Now, if the frame type is an incomplete type or if it is an error type of frame */
-		if ((INCOMPLETE_FRAME == frameType) ||  (ERROR_FRAME == frameType)) {
-			if (INCOMPLETE_FRAME == frameType) {
-				ESIF_TRACE_DEBUG("Incomplete frame received; closing socket\n");
-			} else {
-				ESIF_TRACE_DEBUG("Improper format for frame; closing socket\n");
-			}
-
-			/*
-			 * If the socket is not in its opening state while its frame type is in error or is incomplete
-			 * setup to store the payload to send to the client
-			 */
-			esif_ws_socket_build_payload(NULL, 0, (WsSocketFramePtr)bufferPtr, bufferSize, &frameSize, CLOSING_FRAME);
-			esif_ws_client_write_to_socket(clientPtr, bufferPtr, frameSize);
-
-			/*
-			 * Force the socket state into its closing state
-			 */
-			result =   ESIF_E_WS_DISC;
-			goto exit;
-
-		}
+	char frame[WS_HEADER_BUF_LEN] = { 0 };
 
-		if (CLOSING_FRAME == frameType) {
-			ESIF_TRACE_DEBUG("Close frame received; closing socket\n");
-			esif_ws_socket_build_payload(NULL, 0, (WsSocketFramePtr)bufferPtr, bufferSize, &frameSize, CLOSING_FRAME);
-			esif_ws_client_write_to_socket(clientPtr, bufferPtr, frameSize);
+	frameType = esif_ws_socket_get_subsequent_frame_type((WsSocketFramePtr)clientPtr->recvBuf, clientPtr->recvLen, &data, &dataSize, &bytesRemaining);
+	ESIF_TRACE_DEBUG("FrameType: %d\n", frameType);
 
-			result =   ESIF_E_WS_DISC;
-			goto exit;
-		}
+	/* Wait for the rest of the frame unless the input buffer is already full */
+	if (INCOMPLETE_FRAME == frameType && clientPtr->recvLen + 1 < g_ws_http_buffer_len) {
+		ESIF_TRACE_DEBUG("Incomplete frame received\n");
+		goto exit;
+	}
 
-		if (TEXT_FRAME == frameType) {
+	/*Now, if the frame type is an incomplete type or if it is an error type of frame */
+	if ((INCOMPLETE_FRAME == frameType) ||  (ERROR_FRAME == frameType)) {
+		ESIF_TRACE_DEBUG("Improper format for frame; closing socket\n");
 
-			/* Use a copy of the frame text to send to the rest API */
-			textStrPtr = (char*)esif_ccb_malloc(dataSize + 1);
-			if (NULL == textStrPtr) {
-				result = ESIF_E_NO_MEMORY;
-				goto exit;
-			}
-			esif_ccb_memcpy(textStrPtr, data, dataSize);
-			textStrPtr[dataSize] = 0;
+		/*
+		 * If the socket is not in its opening state while its frame type is in error or is incomplete
+		 * setup to store the payload to send to the client
+		 */
+		esif_ws_socket_build_payload(NULL, 0, (WsSocketFramePtr)frame, sizeof(frame), &frameSize, CLOSING_FRAME);
+		esif_ws_client_write_to_socket(clientPtr, frame, frameSize);
 
-			esif_ws_server_execute_rest_cmd((const char*)textStrPtr,
-				esif_ccb_strlen((const char*)textStrPtr, bufferSize));
+		/*
+		 * Force the socket state into its closing state
+		 */
+		result =   ESIF_E_WS_DISC;
+		goto exit;
+	}
 
-			// Reset Output Buffer since REST cmd may have grown it
-			if (bufferSize != g_ws_http_buffer_len) {
-				bufferPtr = g_ws_http_buffer;
-				bufferSize = g_ws_http_buffer_len;
-			}
+	*consumedPtr = clientPtr->recvLen - bytesRemaining;
 
-			/* Get message to send*/
-			restRespPtr = esif_ws_server_get_rest_response(&restRespSize);
-			
-			if (restRespPtr != NULL) {
-				esif_ws_socket_build_payload(restRespPtr, restRespSize, (WsSocketFramePtr)bufferPtr, bufferSize, &frameSize, TEXT_FRAME);
+	if (CLOSING_FRAME == frameType) {
+		ESIF_TRACE_DEBUG("Close frame received; closing socket\n");
+		esif_ws_socket_build_payload(NULL, 0, (WsSocketFramePtr)frame, sizeof(frame), &frameSize, CLOSING_FRAME);
+		esif_ws_client_write_to_socket(clientPtr, frame, frameSize);
 
-				if (esif_ws_client_write_to_socket(clientPtr, bufferPtr, frameSize) == EXIT_FAILURE) {
-					result =  ESIF_E_WS_DISC;
-					goto exit;
-				}
-			}
+		result =   ESIF_E_WS_DISC;
+		goto exit;
+	}
 
-			esif_ccb_free(textStrPtr);
-			textStrPtr = NULL;
-		}
+	if (TEXT_FRAME == frameType) {
+		/* Send a copy of the frame text to the REST worker */
+		result = esif_ws_server_queue_rest_cmd(clientPtr, data, dataSize);
+	}
 
-		/* Handle unsolicited PONG (keepalive) messages from Internet Explorer 10 */
-		if (PONG_FRAME == frameType) {
-			esif_ws_socket_build_payload("", 0, (WsSocketFramePtr)bufferPtr, bufferSize, &frameSize, TEXT_FRAME);
-			esif_ws_client_write_to_socket(clientPtr, bufferPtr, frameSize);
-		}
+	/* Handle unsolicited PONG (keepalive) messages from Internet Explorer 10 */
+	if (PONG_FRAME == frameType) {
+		esif_ws_socket_build_payload("", 0, (WsSocketFramePtr)frame, sizeof(frame), &frameSize, TEXT_FRAME);
+		esif_ws_client_write_to_socket(clientPtr, frame, frameSize);
+	}
 
-	} while (bytesRemaining != 0);
 exit:
-	esif_ccb_free(textStrPtr);
-	esif_ccb_free(bufferRemaining);
-	textStrPtr = NULL;
-	bufferRemaining = NULL;
-
 	return result;
 }
 
 
 void esif_ws_server_initialize_clients(void)
 {
-	int index=0;
-	g_clients = (ClientRecordPtr)esif_ccb_malloc(MAX_CLIENTS * sizeof(*g_clients));
-	for (index = 0; (g_clients && index < MAX_CLIENTS); ++index) {
+	u32 index=0;
+	g_ws_client_slots = g_ws_max_clients;
+	g_clients = (ClientRecordPtr)esif_ccb_malloc(g_ws_client_slots * sizeof(*g_clients));
+	for (index = 0; (g_clients && index < g_ws_client_slots); ++index) {
 		g_clients[index].socket = INVALID_SOCKET;
 		esif_ws_client_initialize_client(&g_clients[index]);
 	}
 }
 
+/* Reset client slot: close its socket and release its buffers */
 void esif_ws_client_initialize_client(ClientRecordPtr clientPtr)
 {
 	if (NULL == clientPtr) {
@@ -922,12 +1169,28 @@ void esif_ws_client_initialize_client(ClientRecordPtr clientPtr)
 	clientPtr->state     = STATE_OPENING;
 	esif_ws_protocol_initialize(&clientPtr->prot);
 	if (clientPtr->socket != INVALID_SOCKET) {
+		if (g_ws_poll != ESIF_CCB_POLL_INVALID) {
+			esif_ccb_poll_remove(g_ws_poll, clientPtr->socket);
+		}
 		esif_ccb_socket_close(clientPtr->socket);
 	}
 	clientPtr->socket = INVALID_SOCKET;
+
+	esif_ccb_free(clientPtr->recvBuf);
+	esif_ccb_free(clientPtr->sendBuf);
+	clientPtr->recvBuf = NULL;
+	clientPtr->recvLen = clientPtr->recvBufLen = 0;
+	clientPtr->sendBuf = NULL;
+	clientPtr->sendOffset = clientPtr->sendLen = clientPtr->sendBufLen = 0;
+	clientPtr->pollEvents = 0;
+	clientPtr->restPending = ESIF_FALSE;
+	clientPtr->closePending = ESIF_FALSE;
+	clientPtr->closeNow = ESIF_FALSE;
+	clientPtr->generation++;
 }
 
 
+/* Close client once any queued output has been sent */
 void esif_ws_client_close_client(ClientRecordPtr clientPtr)
 {
 	if (NULL == clientPtr) {
@@ -935,12 +1198,7 @@ void esif_ws_client_close_client(ClientRecordPtr clientPtr)
 	}
 
 	esif_ws_protocol_initialize(&clientPtr->prot);
-	clientPtr->state = STATE_OPENING;
-
-	if (clientPtr->socket != INVALID_SOCKET) {
-		esif_ccb_socket_close(clientPtr->socket);
-		clientPtr->socket = INVALID_SOCKET;
-	}
+	clientPtr->closePending = ESIF_TRUE;
 }
 
 
@@ -975,7 +1233,7 @@ eEsifError esif_ws_broadcast_data_buffer(const u8 *bufferPtr, size_t bufferSize)
 {
 	eEsifError rc = ESIF_OK;
 	size_t frameSize = 0; /* max frame size. will be updated when payload built */
-	
+
 	if (NULL == bufferPtr) {
 		return ESIF_E_PARAMETER_IS_NULL;
 	}
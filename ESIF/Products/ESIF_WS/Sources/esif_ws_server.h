@@ -35,20 +35,43 @@ typedef enum SocketState_e {
 	STATE_NORMAL
 }SocketState, *SocketStatePtr;
 
+/* Client Connection. Buffers are owned by the client and grow on demand */
 typedef struct ClientRecord_s {
 	esif_ccb_socket_t socket;
 	SocketState state;
 	Protocol prot;
+
+	u32 generation;			/* Incremented whenever this slot is reused, to discard stale REST responses */
+	u32 pollEvents;			/* Events currently registered with the poller */
+
+	char *recvBuf;			/* Unparsed input, always NUL-terminated */
+	size_t recvLen;
+	size_t recvBufLen;
+
+	u8 *sendBuf;			/* Pending output not yet accepted by the socket */
+	size_t sendOffset;
+	size_t sendLen;
+	size_t sendBufLen;
+
+	Bool restPending;		/* REST command queued to worker; stop reading until it completes */
+	Bool closePending;		/* Close once pending output is flushed */
+	Bool closeNow;			/* Socket error; close at next opportunity */
 } ClientRecord, *ClientRecordPtr;
 
 #pragma pack(pop)
 
-
+#define WS_DEFAULT_MAX_CLIENTS	10		/* Default Max number of Client connections */
+#define WS_MAX_CLIENTS_LIMIT	1024	/* Upper limit for configurable Max Clients */
+#define WS_MAX_PENDING_OUTPUT	(1024 * 1024)	/* Max pending output per client before broadcasts are dropped */
 
 int  esif_ws_init(void);
 void esif_ws_exit(esif_thread_t *threadPtr);
 void esif_ws_server_set_ipaddr_port(const char *ipaddr, u32 port, Bool restricted);
+void esif_ws_server_set_max_clients(u32 maxClients);
+u32  esif_ws_server_get_max_clients(void);
+UInt64 esif_ws_server_get_dropped_frames(void);
 void esif_ws_client_close_client(ClientRecordPtr clientPtr);
+int  esif_ws_client_write_to_socket(ClientRecordPtr clientPtr, const char *bufferPtr, size_t bufferSize);
 u32  esif_ws_buffer_resize(u32 size);
 eEsifError esif_ws_broadcast_data_buffer(const u8 *bufferPtr, size_t bufferSize);
 
@@ -445,6 +445,12 @@ FrameType esif_ws_socket_get_subsequent_frame_type(
 
 		payloadLength = esif_ws_socket_get_payload_size(framePtr, incomingFrameLen, &frameType);
 		if (payloadLength <= 0) {
+			/* Empty payload: report where the next frame starts */
+			if (frameType == (FrameType)mode) {
+				*dataPtr = (char *)framePtr + hdrLen;
+				*dataLength = 0;
+				*bytesRemaining = incomingFrameLen - hdrLen;
+			}
 			return frameType;
 		}
 